@@ -0,0 +1,253 @@
+/* Compares sp_hashmap against a conventional separate-chaining hash map, with
+ * one heap-allocated node per element, on 1M random unsigned long keys. Both
+ * maps start empty and grow on demand, and both use the same hash function.
+ * Every phase reports the average time per operation in nanoseconds.
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_hashmap.h"
+
+#define N      1000000UL
+#define ROUNDS 3
+
+/* The mixing step of sp_hash for a single word */
+#if ULONG_MAX > 0xFFFFFFFFUL
+#define MULT 0x9E3779B97F4A7C15UL
+#else
+#define MULT 0x9E3779B9UL
+#endif
+#define HALF (sizeof(unsigned long) * 4)
+
+static size_t hash(unsigned long key)
+{
+	unsigned long h = (sizeof(key) ^ key) * MULT;
+	h ^= h >> HALF;
+	h *= MULT;
+	h ^= h >> HALF;
+	return (size_t)h;
+}
+
+struct node {
+	struct node  *next;
+	unsigned long key;
+	unsigned long val;
+};
+
+struct chained {
+	struct node **buckets;
+	size_t size;
+	size_t capacity;
+};
+
+static void chained_init(struct chained *map)
+{
+	map->capacity = 8;
+	map->size     = 0;
+	map->buckets  = calloc(map->capacity, sizeof(*map->buckets));
+}
+
+static void chained_fini(struct chained *map)
+{
+	size_t i;
+	for (i = 0; i < map->capacity; i++) {
+		struct node *node = map->buckets[i], *next;
+		for (; node != NULL; node = next) {
+			next = node->next;
+			free(node);
+		}
+	}
+	free(map->buckets);
+}
+
+static void chained_grow(struct chained *map)
+{
+	const size_t capacity = map->capacity * 2;
+	struct node **buckets = calloc(capacity, sizeof(*buckets));
+	size_t i;
+	for (i = 0; i < map->capacity; i++) {
+		struct node *node = map->buckets[i], *next;
+		for (; node != NULL; node = next) {
+			const size_t b = hash(node->key) & (capacity - 1);
+			next = node->next;
+			node->next = buckets[b];
+			buckets[b] = node;
+		}
+	}
+	free(map->buckets);
+	map->buckets  = buckets;
+	map->capacity = capacity;
+}
+
+static void chained_insert(struct chained *map, unsigned long key, unsigned long val)
+{
+	struct node **b = &map->buckets[hash(key) & (map->capacity - 1)], *node;
+	for (node = *b; node != NULL; node = node->next) {
+		if (node->key == key) {
+			node->val = val;
+			return;
+		}
+	}
+	node = malloc(sizeof(*node));
+	node->key  = key;
+	node->val  = val;
+	node->next = *b;
+	*b = node;
+	if (++map->size > map->capacity)
+		chained_grow(map);
+}
+
+static unsigned long *chained_get(const struct chained *map, unsigned long key)
+{
+	struct node *node = map->buckets[hash(key) & (map->capacity - 1)];
+	for (; node != NULL; node = node->next)
+		if (node->key == key)
+			return &node->val;
+	return NULL;
+}
+
+static void chained_remove(struct chained *map, unsigned long key)
+{
+	struct node **link = &map->buckets[hash(key) & (map->capacity - 1)], *node;
+	for (; (node = *link) != NULL; link = &node->next) {
+		if (node->key == key) {
+			*link = node->next;
+			free(node);
+			--map->size;
+			return;
+		}
+	}
+}
+
+/* xorshift, so that the key sequence does not depend on the libc. Its period
+ * is 2^w-1 for w-bit words, so no key repeats. */
+static unsigned long state = 88172645UL;
+static unsigned long next_key(void)
+{
+#if ULONG_MAX > 0xFFFFFFFFUL
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+#else
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+#endif
+	return state;
+}
+
+static double elapsed(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / N;
+}
+
+static void report(const char *phase, double sp, double ch)
+{
+	printf("%-8s sp_hashmap %7.1f ns/op   chained %7.1f ns/op   (%.2fx)\n", phase, sp, ch, ch / sp);
+}
+
+int main(void)
+{
+	unsigned long *keys, *miss, *more, *hits, sum = 0;
+	double t[4][2];
+	size_t i, r;
+	clock_t start;
+
+	keys = malloc(N * sizeof(*keys));
+	miss = malloc(N * sizeof(*miss));
+	more = malloc(N * sizeof(*more));
+	hits = malloc(N * sizeof(*hits));
+	if (keys == NULL || miss == NULL || more == NULL || hits == NULL) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+	/* Three disjoint sets of keys: present, absent, and replacements */
+	for (i = 0; i < N; i++) {
+		keys[i] = next_key();
+		miss[i] = next_key();
+		more[i] = next_key();
+	}
+	/* Lookups go in shuffled order, otherwise the chained map would walk its
+	 * nodes in allocation order */
+	memcpy(hits, keys, N * sizeof(*hits));
+	for (i = N - 1; i > 0; i--) {
+		const size_t j = next_key() % (i + 1);
+		const unsigned long tmp = hits[i];
+		hits[i] = hits[j];
+		hits[j] = tmp;
+	}
+	memset(t, 0, sizeof(t));
+
+	for (r = 0; r < ROUNDS; r++) {
+		struct sp_hashmap *sp;
+		struct chained ch;
+
+		/* insert */
+		start = clock();
+		sp = sp_hashmap_create(sizeof(unsigned long), sizeof(unsigned long), 0, NULL, NULL);
+		for (i = 0; i < N; i++)
+			sp_hashmap_insertul(sp, keys[i], &keys[i]);
+		t[0][0] += elapsed(start);
+		start = clock();
+		chained_init(&ch);
+		for (i = 0; i < N; i++)
+			chained_insert(&ch, keys[i], keys[i]);
+		t[0][1] += elapsed(start);
+
+		/* hits */
+		start = clock();
+		for (i = 0; i < N; i++)
+			sum += *(unsigned long*)sp_hashmap_getul(sp, hits[i]);
+		t[1][0] += elapsed(start);
+		start = clock();
+		for (i = 0; i < N; i++)
+			sum += *chained_get(&ch, hits[i]);
+		t[1][1] += elapsed(start);
+
+		/* misses */
+		start = clock();
+		for (i = 0; i < N; i++)
+			sum += sp_hashmap_getul(sp, miss[i]) == NULL;
+		t[2][0] += elapsed(start);
+		start = clock();
+		for (i = 0; i < N; i++)
+			sum += chained_get(&ch, miss[i]) == NULL;
+		t[2][1] += elapsed(start);
+
+		/* churn: replace every key with a new one, one remove and one
+		 * insert per operation */
+		start = clock();
+		for (i = 0; i < N; i++) {
+			sp_hashmap_removeul(sp, keys[i], NULL);
+			sp_hashmap_insertul(sp, more[i], &more[i]);
+		}
+		t[3][0] += elapsed(start);
+		start = clock();
+		for (i = 0; i < N; i++) {
+			chained_remove(&ch, keys[i]);
+			chained_insert(&ch, more[i], more[i]);
+		}
+		t[3][1] += elapsed(start);
+
+		if (sp->size != N || ch.size != N) {
+			fprintf(stderr, "size mismatch\n");
+			return 1;
+		}
+		sp_hashmap_destroy(sp, NULL, NULL);
+		chained_fini(&ch);
+	}
+
+	report("insert", t[0][0] / ROUNDS, t[0][1] / ROUNDS);
+	report("hit",    t[1][0] / ROUNDS, t[1][1] / ROUNDS);
+	report("miss",   t[2][0] / ROUNDS, t[2][1] / ROUNDS);
+	report("churn",  t[3][0] / ROUNDS, t[3][1] / ROUNDS);
+	/* Keeps the lookups from being optimized out */
+	fprintf(stderr, "checksum %lu\n", sum);
+	free(keys);
+	free(miss);
+	free(more);
+	free(hits);
+	return 0;
+}
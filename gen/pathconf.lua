@@ -5,6 +5,28 @@
 C_TEMPLATES = {
 	dir = 'src/',
 
+	'bitarray/bitarray.c',
+	'deque/deque.c',
+	'hashmap/hashmap.c',
+	'intern/intern.c',
+	'list/list.c',
+	'ulist/ulist.c',
+	'matrix/matrix.c',
+	'sparse/sparse.c',
+	'pqueue/pqueue.c',
+	'ipqueue/ipqueue.c',
+	'avl/avl.c',
+	'rbtree/rbtree.c',
+	'bptree/bptree.c',
+	'art/art.c',
+	'bloom/bloom.c',
+	'slotmap/slotmap.c',
+	'fenwick/fenwick.c',
+	'segtree/segtree.c',
+	'lru/lru.c',
+	'wheel/wheel.c',
+	'pool/pool.c',
+	'chashmap/chashmap.c',
 	'internal/internal.c',
 	'queue/queue.c',
 	'stack/stack.c',
@@ -15,7 +37,29 @@ H_TEMPLATES = {
 	dir = 'src/',
 
 	'internal.h',
+	'sp_bitarray.h',
+	'sp_deque.h',
 	'sp_errcodes.h',
+	'sp_hashmap.h',
+	'sp_intern.h',
+	'sp_list.h',
+	'sp_ulist.h',
+	'sp_matrix.h',
+	'sp_sparse.h',
+	'sp_pqueue.h',
+	'sp_ipqueue.h',
+	'sp_avl.h',
+	'sp_rbtree.h',
+	'sp_bptree.h',
+	'sp_art.h',
+	'sp_bloom.h',
+	'sp_slotmap.h',
+	'sp_fenwick.h',
+	'sp_segtree.h',
+	'sp_lru.h',
+	'sp_wheel.h',
+	'sp_pool.h',
+	'sp_chashmap.h',
 	'sp_queue.h',
 	'sp_stack.h',
 	'sp_utils.h',
@@ -60,16 +104,397 @@ MAN_TEMPLATES = {
 		'sp_queue_eq.3',
 		'sp_queue_get.3',
 		'sp_queue_insert.3',
+		'sp_queue_last.3',
 		'sp_queue_map.3',
 		'sp_queue_peek.3',
+		'sp_queue_peekback.3',
 		'sp_queue_pop.3',
+		'sp_queue_popback.3',
 		'sp_queue_print.3',
 		'sp_queue_push.3',
+		'sp_queue_pushfront.3',
 		'sp_queue_qinsert.3',
 		'sp_queue_qremove.3',
 		'sp_queue_remove.3',
+		'sp_queue_rotate.3',
+		'sp_queue_rpush.3',
 		'sp_queue_set.3',
 	},
+	{
+		parent = 'man/sp_deque.7',
+		dir = 'man/deque/',
+
+		'sp_deque_clear.3',
+		'sp_deque_copy.3',
+		'sp_deque_create.3',
+		'sp_deque_destroy.3',
+		'sp_deque_eq.3',
+		'sp_deque_get.3',
+		'sp_deque_insert.3',
+		'sp_deque_map.3',
+		'sp_deque_peekback.3',
+		'sp_deque_peekfront.3',
+		'sp_deque_popback.3',
+		'sp_deque_popfront.3',
+		'sp_deque_print.3',
+		'sp_deque_pushback.3',
+		'sp_deque_pushfront.3',
+		'sp_deque_qinsert.3',
+		'sp_deque_qremove.3',
+		'sp_deque_remove.3',
+		'sp_deque_set.3',
+	},
+	{
+		parent = 'man/sp_bitarray.7',
+		dir = 'man/bitarray/',
+
+		'sp_bitarray_and.3',
+		'sp_bitarray_clear.3',
+		'sp_bitarray_copy.3',
+		'sp_bitarray_count.3',
+		'sp_bitarray_create.3',
+		'sp_bitarray_destroy.3',
+		'sp_bitarray_eq.3',
+		'sp_bitarray_fill.3',
+		'sp_bitarray_get.3',
+		'sp_bitarray_next.3',
+		'sp_bitarray_pop.3',
+		'sp_bitarray_print.3',
+		'sp_bitarray_push.3',
+		'sp_bitarray_resize.3',
+		'sp_bitarray_set.3',
+	},
+	{
+		parent = 'man/sp_hashmap.7',
+		dir = 'man/hashmap/',
+
+		'sp_hashmap_clear.3',
+		'sp_hashmap_copy.3',
+		'sp_hashmap_create.3',
+		'sp_hashmap_destroy.3',
+		'sp_hashmap_eq.3',
+		'sp_hashmap_get.3',
+		'sp_hashmap_insert.3',
+		'sp_hashmap_map.3',
+		'sp_hashmap_print.3',
+		'sp_hashmap_remove.3',
+		'sp_hashmap_reserve.3',
+	},
+	{
+		parent = 'man/sp_chashmap.7',
+		dir = 'man/chashmap/',
+
+		'sp_chashmap_clear.3',
+		'sp_chashmap_create.3',
+		'sp_chashmap_destroy.3',
+		'sp_chashmap_get.3',
+		'sp_chashmap_insert.3',
+		'sp_chashmap_map.3',
+		'sp_chashmap_print.3',
+		'sp_chashmap_remove.3',
+		'sp_chashmap_size.3',
+	},
+	{
+		parent = 'man/sp_intern.7',
+		dir = 'man/intern/',
+
+		'sp_intern_add.3',
+		'sp_intern_clear.3',
+		'sp_intern_create.3',
+		'sp_intern_destroy.3',
+		'sp_intern_find.3',
+		'sp_intern_get.3',
+		'sp_intern_print.3',
+	},
+	{
+		parent = 'man/sp_list.7',
+		dir = 'man/list/',
+
+		'sp_list_clear.3',
+		'sp_list_copy.3',
+		'sp_list_create.3',
+		'sp_list_destroy.3',
+		'sp_list_elem.3',
+		'sp_list_eq.3',
+		'sp_list_insertafter.3',
+		'sp_list_insertbefore.3',
+		'sp_list_map.3',
+		'sp_list_move.3',
+		'sp_list_popback.3',
+		'sp_list_popfront.3',
+		'sp_list_print.3',
+		'sp_list_pushback.3',
+		'sp_list_pushfront.3',
+		'sp_list_remove.3',
+		'sp_list_splice.3',
+	},
+	{
+		parent = 'man/sp_ulist.7',
+		dir = 'man/ulist/',
+
+		'sp_ulist_clear.3',
+		'sp_ulist_copy.3',
+		'sp_ulist_create.3',
+		'sp_ulist_destroy.3',
+		'sp_ulist_eq.3',
+		'sp_ulist_get.3',
+		'sp_ulist_insert.3',
+		'sp_ulist_map.3',
+		'sp_ulist_popback.3',
+		'sp_ulist_popfront.3',
+		'sp_ulist_print.3',
+		'sp_ulist_pushback.3',
+		'sp_ulist_pushfront.3',
+		'sp_ulist_remove.3',
+	},
+	{
+		parent = 'man/sp_matrix.7',
+		dir = 'man/matrix/',
+
+		'sp_matrix_add.3',
+		'sp_matrix_col.3',
+		'sp_matrix_colsum.3',
+		'sp_matrix_copy.3',
+		'sp_matrix_create.3',
+		'sp_matrix_destroy.3',
+		'sp_matrix_emul.3',
+		'sp_matrix_eq.3',
+		'sp_matrix_fill.3',
+		'sp_matrix_get.3',
+		'sp_matrix_map.3',
+		'sp_matrix_mul.3',
+		'sp_matrix_print.3',
+		'sp_matrix_reshape.3',
+		'sp_matrix_row.3',
+		'sp_matrix_rowsum.3',
+		'sp_matrix_scale.3',
+		'sp_matrix_set.3',
+		'sp_matrix_slice.3',
+		'sp_matrix_sub.3',
+		'sp_matrix_transpose.3',
+		'sp_matrix_transposed.3',
+	},
+	{
+		parent = 'man/sp_sparse.7',
+		dir = 'man/sparse/',
+
+		'sp_sparse_coo_clear.3',
+		'sp_sparse_coo_create.3',
+		'sp_sparse_coo_destroy.3',
+		'sp_sparse_coo_push.3',
+		'sp_sparse_csc.3',
+		'sp_sparse_csr.3',
+		'sp_sparse_destroy.3',
+		'sp_sparse_get.3',
+		'sp_sparse_mul.3',
+		'sp_sparse_mulrange.3',
+		'sp_sparse_mulv.3',
+		'sp_sparse_mulvrange.3',
+		'sp_sparse_print.3',
+		'sp_sparse_split.3',
+	},
+	{
+		parent = 'man/sp_pqueue.7',
+		dir = 'man/pqueue/',
+
+		'sp_pqueue_clear.3',
+		'sp_pqueue_create.3',
+		'sp_pqueue_destroy.3',
+		'sp_pqueue_heapify.3',
+		'sp_pqueue_merge.3',
+		'sp_pqueue_peek.3',
+		'sp_pqueue_pop.3',
+		'sp_pqueue_print.3',
+		'sp_pqueue_push.3',
+	},
+	{
+		parent = 'man/sp_ipqueue.7',
+		dir = 'man/ipqueue/',
+
+		'sp_ipqueue_clear.3',
+		'sp_ipqueue_contains.3',
+		'sp_ipqueue_create.3',
+		'sp_ipqueue_destroy.3',
+		'sp_ipqueue_get.3',
+		'sp_ipqueue_peek.3',
+		'sp_ipqueue_pop.3',
+		'sp_ipqueue_print.3',
+		'sp_ipqueue_push.3',
+		'sp_ipqueue_remove.3',
+		'sp_ipqueue_top.3',
+		'sp_ipqueue_update.3',
+	},
+	{
+		parent = 'man/sp_avl.7',
+		dir = 'man/avl/',
+
+		'sp_avl_build.3',
+		'sp_avl_clear.3',
+		'sp_avl_create.3',
+		'sp_avl_destroy.3',
+		'sp_avl_erase.3',
+		'sp_avl_find.3',
+		'sp_avl_first.3',
+		'sp_avl_insert.3',
+		'sp_avl_key.3',
+		'sp_avl_lowerbound.3',
+		'sp_avl_print.3',
+		'sp_avl_rank.3',
+		'sp_avl_remove.3',
+		'sp_avl_select.3',
+		'sp_avl_upperbound.3',
+	},
+	{
+		parent = 'man/sp_rbtree.7',
+		dir = 'man/rbtree/',
+
+		'sp_rbtree_clear.3',
+		'sp_rbtree_create.3',
+		'sp_rbtree_destroy.3',
+		'sp_rbtree_find.3',
+		'sp_rbtree_first.3',
+		'sp_rbtree_insert.3',
+		'sp_rbtree_inserthint.3',
+		'sp_rbtree_lowerbound.3',
+		'sp_rbtree_print.3',
+		'sp_rbtree_remove.3',
+		'sp_rbtree_upperbound.3',
+	},
+	{
+		parent = 'man/sp_bptree.7',
+		dir = 'man/bptree/',
+
+		'sp_bptree_build.3',
+		'sp_bptree_clear.3',
+		'sp_bptree_create.3',
+		'sp_bptree_destroy.3',
+		'sp_bptree_first.3',
+		'sp_bptree_get.3',
+		'sp_bptree_insert.3',
+		'sp_bptree_key.3',
+		'sp_bptree_lowerbound.3',
+		'sp_bptree_print.3',
+		'sp_bptree_remove.3',
+		'sp_bptree_upperbound.3',
+	},
+	{
+		parent = 'man/sp_art.7',
+		dir = 'man/art/',
+
+		'sp_art_clear.3',
+		'sp_art_create.3',
+		'sp_art_destroy.3',
+		'sp_art_get.3',
+		'sp_art_insert.3',
+		'sp_art_longestprefix.3',
+		'sp_art_print.3',
+		'sp_art_remove.3',
+		'sp_art_scan.3',
+	},
+	{
+		parent = 'man/sp_bloom.7',
+		dir = 'man/bloom/',
+
+		'sp_bloom_clear.3',
+		'sp_bloom_contains.3',
+		'sp_bloom_create.3',
+		'sp_bloom_deserialize.3',
+		'sp_bloom_destroy.3',
+		'sp_bloom_fpr.3',
+		'sp_bloom_insert.3',
+		'sp_bloom_intersect.3',
+		'sp_bloom_print.3',
+		'sp_bloom_serialize.3',
+		'sp_bloom_union.3',
+	},
+	{
+		parent = 'man/sp_slotmap.7',
+		dir = 'man/slotmap/',
+
+		'sp_slotmap_at.3',
+		'sp_slotmap_clear.3',
+		'sp_slotmap_contains.3',
+		'sp_slotmap_create.3',
+		'sp_slotmap_destroy.3',
+		'sp_slotmap_get.3',
+		'sp_slotmap_insert.3',
+		'sp_slotmap_map.3',
+		'sp_slotmap_print.3',
+		'sp_slotmap_remove.3',
+	},
+	{
+		parent = 'man/sp_fenwick.7',
+		dir = 'man/fenwick/',
+
+		'sp_fenwick_add.3',
+		'sp_fenwick_build.3',
+		'sp_fenwick_clear.3',
+		'sp_fenwick_create.3',
+		'sp_fenwick_destroy.3',
+		'sp_fenwick_get.3',
+		'sp_fenwick_lowerbound.3',
+		'sp_fenwick_prefix.3',
+		'sp_fenwick_print.3',
+		'sp_fenwick_set.3',
+		'sp_fenwick_sum.3',
+	},
+	{
+		parent = 'man/sp_segtree.7',
+		dir = 'man/segtree/',
+
+		'sp_segtree_add.3',
+		'sp_segtree_build.3',
+		'sp_segtree_clear.3',
+		'sp_segtree_create.3',
+		'sp_segtree_destroy.3',
+		'sp_segtree_fill.3',
+		'sp_segtree_get.3',
+		'sp_segtree_max.3',
+		'sp_segtree_min.3',
+		'sp_segtree_print.3',
+		'sp_segtree_set.3',
+		'sp_segtree_sum.3',
+	},
+	{
+		parent = 'man/sp_lru.7',
+		dir = 'man/lru/',
+
+		'sp_lru_clear.3',
+		'sp_lru_create.3',
+		'sp_lru_destroy.3',
+		'sp_lru_get.3',
+		'sp_lru_insert.3',
+		'sp_lru_peek.3',
+		'sp_lru_print.3',
+		'sp_lru_remove.3',
+	},
+	{
+		parent = 'man/sp_wheel.7',
+		dir = 'man/wheel/',
+
+		'sp_wheel_advance.3',
+		'sp_wheel_cancel.3',
+		'sp_wheel_clear.3',
+		'sp_wheel_create.3',
+		'sp_wheel_destroy.3',
+		'sp_wheel_get.3',
+		'sp_wheel_print.3',
+		'sp_wheel_remaining.3',
+		'sp_wheel_reschedule.3',
+		'sp_wheel_schedule.3',
+	},
+	{
+		parent = 'man/sp_pool.7',
+		dir = 'man/pool/',
+
+		'sp_pool_alloc.3',
+		'sp_pool_create.3',
+		'sp_pool_destroy.3',
+		'sp_pool_free.3',
+		'sp_pool_print.3',
+		'sp_pool_reserve.3',
+		'sp_pool_reset.3',
+	},
 }
 
 -- Iterator function for *_TEMPLATES tables
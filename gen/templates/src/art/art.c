@@ -0,0 +1,507 @@
+#include "../sp_art.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_art *sp_art_create(size_t val_size)
+{
+	struct sp_art *ret;
+	size_t va;
+
+	if (val_size > SP_SIZE_MAX / 2) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Leaves hold their header, followed by the value, which is aligned for
+	 * any type of its size, and by the bytes of the key */
+	va = val_size != 0 ? SP_ALIGNOF_SIZE(val_size) : 1;
+	ret->val_offset = (sizeof(struct sp_art_leaf) + va - 1) / va * va;
+	ret->val_size   = val_size;
+	ret->root       = NULL;
+	ret->size       = 0;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_art_clear(struct sp_art *art, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art SP_EINVAL */
+#endif
+	if (art->root == NULL)
+		return 0;
+	if (dtor != NULL && (err = sp_art_dtor(art, art->root, dtor))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_art_free(art->root);
+	art->root = NULL;
+	art->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_art_destroy(struct sp_art *art, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art SP_EINVAL */
+#endif
+	if (sp_art_clear(art, dtor))
+		return SP_ECALLBK;
+	free(art);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_art_insert(struct sp_art *art, const void *key, size_t len, const void *val)
+{
+	const unsigned char *const k = key;
+	struct sp_art_leaf *leaf;
+	void **ref, **child;
+	size_t depth = 0, p;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art SP_EINVAL */
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL && art->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (len > SP_SIZE_MAX - art->val_offset - art->val_size) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return SP_ERANGE;
+	}
+
+	for (ref = &art->root;;) {
+		struct sp_art_node *const node = *ref, *split;
+
+		if (node == NULL) {
+			if ((*ref = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			break;
+		}
+
+		if (node->type == SP_ART_LEAF) {
+			struct sp_art_leaf *const old = *ref;
+			const unsigned char *const ok = SP_ART_KEY(art, old);
+			const size_t max = MIN(old->len, len);
+			if (old->len == len && memcmp(ok + depth, k + depth, len - depth) == 0) {
+				if (art->val_size != 0)
+					memcpy(SP_ART_VAL(art, old), val, art->val_size);
+				return 0;
+			}
+			/* Both keys go below a new node, whose path is the rest of
+			 * their common prefix, and a key ending there is its terminal
+			 * leaf */
+			for (p = depth; p < max && ok[p] == k[p]; p++)
+				;
+			if ((leaf = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			if ((split = sp_art_newnode(SP_ART_NODE4)) == NULL) {
+				free(leaf);
+				return SP_ENOMEM;
+			}
+			split->prefix_len = p - depth;
+			memcpy(split->prefix, k + depth, MIN(p - depth, SP_ART_PREFIX));
+			*ref = split;
+			if (old->len == p)
+				split->term = old;
+			else
+				sp_art_addchild(ref, ok[p], old);
+			if (len == p)
+				split->term = leaf;
+			else
+				sp_art_addchild(ref, k[p], leaf);
+			break;
+		}
+
+		p = sp_art_mismatch(art, node, k, len, depth);
+		if (p < node->prefix_len) {
+			/* The key leaves the path of the node, which is split where
+			 * they differ, the rest of it going below a new node */
+			unsigned char c;
+			if ((leaf = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			if ((split = sp_art_newnode(SP_ART_NODE4)) == NULL) {
+				free(leaf);
+				return SP_ENOMEM;
+			}
+			split->prefix_len = p;
+			memcpy(split->prefix, node->prefix, MIN(p, SP_ART_PREFIX));
+			if (node->prefix_len <= SP_ART_PREFIX) {
+				c = node->prefix[p];
+				node->prefix_len -= p + 1;
+				memmove(node->prefix, node->prefix + p + 1, node->prefix_len);
+			} else {
+				const unsigned char *const mk = SP_ART_KEY(art, sp_art_minleaf(node));
+				c = mk[depth + p];
+				node->prefix_len -= p + 1;
+				memcpy(node->prefix, mk + depth + p + 1, MIN(node->prefix_len, SP_ART_PREFIX));
+			}
+			*ref = split;
+			sp_art_addchild(ref, c, node);
+			if (len == depth + p)
+				split->term = leaf;
+			else
+				sp_art_addchild(ref, k[depth + p], leaf);
+			break;
+		}
+
+		depth += node->prefix_len;
+		if (depth == len) {
+			if (node->term != NULL) {
+				if (art->val_size != 0)
+					memcpy(SP_ART_VAL(art, node->term), val, art->val_size);
+				return 0;
+			}
+			if ((node->term = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			break;
+		}
+		if ((child = sp_art_child(node, k[depth])) == NULL) {
+			if ((leaf = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			if (sp_art_addchild(ref, k[depth], leaf)) {
+				free(leaf);
+				return SP_ENOMEM;
+			}
+			break;
+		}
+		ref = child;
+		++depth;
+	}
+	++art->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_art_insert$SUFFIX$(struct sp_art *art, $TYPE$ key, const void *val)
+{
+	unsigned char buf[sizeof(key) + 1];
+	size_t len;
+	SP_KEY_ENCODE($TYPE$, key, buf, len);
+	return sp_art_insert(art, buf, len, val);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_art_insertstr(struct sp_art *art, const char *key, const void *val)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+#endif
+	return sp_art_insert(art, key, strlen(key), val);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_art_get(const struct sp_art *art, const void *key, size_t len)
+{
+	const unsigned char *const k = key;
+	const struct sp_art_leaf *leaf = NULL;
+	const void *node;
+	size_t depth = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art NULL */
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return NULL;
+	}
+#endif
+	/* Only the stored bytes of the paths are compared on the way down, as
+	 * the key of the leaf reached is compared in full */
+	for (node = art->root; node != NULL; ) {
+		const struct sp_art_node *const n = node;
+		void **child;
+		if (SP_ART_TYPE(node) == SP_ART_LEAF) {
+			leaf = node;
+			break;
+		}
+		if (n->prefix_len != 0 && (n->prefix_len > len - depth
+				|| memcmp(n->prefix, k + depth, MIN(n->prefix_len, SP_ART_PREFIX)) != 0))
+			return NULL;
+		depth += n->prefix_len;
+		if (depth == len) {
+			leaf = n->term;
+			break;
+		}
+		if ((child = sp_art_child(n, k[depth])) == NULL)
+			return NULL;
+		node = *child;
+		++depth;
+	}
+	if (leaf == NULL || leaf->len != len || (len != 0 && memcmp(SP_ART_KEY(art, leaf), k, len) != 0))
+		return NULL;
+	return SP_ART_VAL(art, leaf);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_art_get$SUFFIX$(const struct sp_art *art, $TYPE$ key)
+{
+	unsigned char buf[sizeof(key) + 1];
+	size_t len;
+	SP_KEY_ENCODE($TYPE$, key, buf, len);
+	return sp_art_get(art, buf, len);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_art_getstr(const struct sp_art *art, const char *key)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR key NULL */
+#endif
+	return sp_art_get(art, key, strlen(key));
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_art_remove(struct sp_art *art, const void *key, size_t len, int (*dtor)(void*))
+{
+	const unsigned char *const k = key;
+	struct sp_art_leaf *leaf;
+	void **ref, **parent = NULL;
+	size_t depth = 0;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art SP_EINVAL */
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (ref = &art->root;;) {
+		struct sp_art_node *const n = *ref;
+		void **child;
+		if (n == NULL)
+			return SP_ENOKEY;
+		if (n->type == SP_ART_LEAF) {
+			leaf = *ref;
+			break;
+		}
+		if (n->prefix_len != 0 && (n->prefix_len > len - depth
+				|| memcmp(n->prefix, k + depth, MIN(n->prefix_len, SP_ART_PREFIX)) != 0))
+			return SP_ENOKEY;
+		depth += n->prefix_len;
+		if (depth == len) {
+			leaf = n->term;
+			break;
+		}
+		if ((child = sp_art_child(n, k[depth])) == NULL)
+			return SP_ENOKEY;
+		parent = ref;
+		ref    = child;
+		++depth;
+	}
+	if (leaf == NULL || leaf->len != len || (len != 0 && memcmp(SP_ART_KEY(art, leaf), k, len) != 0))
+		return SP_ENOKEY;
+	if (dtor != NULL && (err = dtor(SP_ART_VAL(art, leaf)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+
+	/* A terminal leaf is detached from the node reached, and any other leaf
+	 * from the node above it */
+	if (leaf != *ref) {
+		((struct sp_art_node*)*ref)->term = NULL;
+		sp_art_shrink(ref);
+	} else if (parent != NULL) {
+		sp_art_delchild(parent, k[depth - 1]);
+	} else {
+		*ref = NULL;
+	}
+	free(leaf);
+	--art->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_art_remove$SUFFIX$(struct sp_art *art, $TYPE$ key, int (*dtor)(void*))
+{
+	unsigned char buf[sizeof(key) + 1];
+	size_t len;
+	SP_KEY_ENCODE($TYPE$, key, buf, len);
+	return sp_art_remove(art, buf, len, dtor);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_art_removestr(struct sp_art *art, const char *key, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+#endif
+	return sp_art_remove(art, key, strlen(key), dtor);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_art_longestprefix(const struct sp_art *art, const void *key, size_t len, size_t *match)
+{
+	const unsigned char *const k = key;
+	const struct sp_art_leaf *best = NULL;
+	const void *node;
+	size_t depth = 0;
+	int verified = 1;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art NULL */
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return NULL;
+	}
+#endif
+	/* The path down is known to match the key as long as all of its bytes
+	 * were stored in the nodes passed, and is otherwise verified with the
+	 * first terminal leaf found */
+	for (node = art->root; node != NULL; ) {
+		const struct sp_art_node *const n = node;
+		void **child;
+		if (SP_ART_TYPE(node) == SP_ART_LEAF) {
+			const struct sp_art_leaf *const leaf = node;
+			if (leaf->len <= len && (leaf->len == 0 || memcmp(SP_ART_KEY(art, leaf), k, leaf->len) == 0))
+				best = leaf;
+			break;
+		}
+		if (n->prefix_len != 0 && (n->prefix_len > len - depth
+				|| memcmp(n->prefix, k + depth, MIN(n->prefix_len, SP_ART_PREFIX)) != 0))
+			break;
+		if (n->prefix_len > SP_ART_PREFIX)
+			verified = 0;
+		depth += n->prefix_len;
+		if (n->term != NULL) {
+			if (!verified && memcmp(SP_ART_KEY(art, n->term), k, depth) != 0)
+				break;
+			best     = n->term;
+			verified = 1;
+		}
+		if (depth == len || (child = sp_art_child(n, k[depth])) == NULL)
+			break;
+		node = *child;
+		++depth;
+	}
+	if (match != NULL)
+		*match = best != NULL ? best->len : 0;
+	return best != NULL ? SP_ART_VAL(art, best) : NULL;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_art_longestprefixstr(const struct sp_art *art, const char *key, size_t *match)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR key NULL */
+#endif
+	return sp_art_longestprefix(art, key, strlen(key), match);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_art_scan(const struct sp_art *art, const void *prefix, size_t len, int (*func)(const void*, size_t, void*))
+{
+	const unsigned char *const k = prefix;
+	const struct sp_art_leaf *leaf;
+	const void *node;
+	size_t depth = 0;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+	if (prefix == NULL && len != 0) {
+		error(("prefix is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	node = art->root;
+	/* The walk goes down until the prefix ends, within or at the end of the
+	 * path of a node, all of whose keys then share the same first len bytes,
+	 * so that the prefix only needs to be verified against one of them */
+	while (node != NULL && depth < len && SP_ART_TYPE(node) != SP_ART_LEAF) {
+		const struct sp_art_node *const n = node;
+		void **child;
+		if (memcmp(n->prefix, k + depth, MIN(MIN(n->prefix_len, len - depth), SP_ART_PREFIX)) != 0)
+			return 0;
+		if (n->prefix_len >= len - depth)
+			break;
+		depth += n->prefix_len;
+		if ((child = sp_art_child(n, k[depth])) == NULL)
+			return 0;
+		node = *child;
+		++depth;
+	}
+	if (node == NULL)
+		return 0;
+	leaf = sp_art_minleaf(node);
+	if (leaf->len < len || (len != 0 && memcmp(SP_ART_KEY(art, leaf), k, len) != 0))
+		return 0;
+	if ((err = sp_art_walk(art, node, func, NULL))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+		return SP_ECALLBK;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_art_scanstr(const struct sp_art *art, const char *prefix, int (*func)(const void*, size_t, void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR prefix SP_EINVAL */
+#endif
+	return sp_art_scan(art, prefix, strlen(prefix), func);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_art_print(const struct sp_art *art, int (*func)(const void*, size_t, void*))
+{
+	size_t idx = 0;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR art SP_EINVAL */
+#endif
+	printf("sp_art_print()\nsize: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)art->size, (SP_SIZE_T)art->val_size);
+	if (art->root != NULL && (err = sp_art_walk(art, art->root, func, &idx))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+		return SP_ECALLBK;
+	}
+	return 0;
+}
+/*F}*/
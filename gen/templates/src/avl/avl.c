@@ -0,0 +1,685 @@
+#include "../sp_avl.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_avl *sp_avl_create(size_t key_size, size_t val_size, size_t capacity, int (*cmp)(const void*, const void*))
+{
+	struct sp_avl *ret;
+	size_t align;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (key_size > SP_SIZE_MAX / 2 - 64 || val_size > SP_SIZE_MAX / 2 - 64) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Each node holds its links, followed by the key and the value, which are
+	 * padded to keep them aligned for any type of their size. Sets have no
+	 * value at all. Nodes are blocks of a pool embedded in the tree. Their
+	 * size is rounded up here, as a pool derives the alignment of its blocks
+	 * from their size alone, which misses a key more aligned than the value. */
+	align = MAX(SP_ALIGNOF_SIZE(key_size), sizeof(struct sp_avl_node*));
+	ret->root       = NULL;
+	ret->key_size   = key_size;
+	ret->val_size   = val_size;
+	ret->key_offset = (sizeof(struct sp_avl_node) + SP_ALIGNOF_SIZE(key_size) - 1) / SP_ALIGNOF_SIZE(key_size) * SP_ALIGNOF_SIZE(key_size);
+	ret->val_offset = ret->key_offset + key_size;
+	if (val_size != 0) {
+		ret->val_offset = (ret->val_offset + SP_ALIGNOF_SIZE(val_size) - 1) / SP_ALIGNOF_SIZE(val_size) * SP_ALIGNOF_SIZE(val_size);
+		align = MAX(align, SP_ALIGNOF_SIZE(val_size));
+	}
+	ret->size       = 0;
+	ret->cmp        = cmp;
+	if (sp_pool_init(&ret->pool, (ret->val_offset + val_size + align - 1) / align * align, capacity, NULL, NULL)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_avl_clear(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+#endif
+	if (kdtor != NULL || vdtor != NULL) {
+		for (node = sp_avl_first(avl); node != NULL; node = sp_avl_next(node)) {
+			int err;
+			if (kdtor != NULL && (err = kdtor(SP_AVL_KEY(avl, node)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+				return SP_ECALLBK;
+			}
+			if (vdtor != NULL && (err = vdtor(SP_AVL_VAL(avl, node)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+
+	/* Every node is free again, so the pool can carve them from the start,
+	 * without visiting the tree */
+	sp_pool_reset(&avl->pool);
+	avl->root = NULL;
+	avl->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_avl_destroy(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+#endif
+	if (sp_avl_clear(avl, kdtor, vdtor))
+		return SP_ECALLBK;
+	sp_pool_fini(&avl->pool);
+	free(avl);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_avl_insert(struct sp_avl *avl, const void *key, const void *val)
+{
+	struct sp_avl_node *parent = NULL, **link;
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	if (val == NULL && avl->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	link = &avl->root;
+	while (*link != NULL) {
+		const int c = avl->cmp(key, SP_AVL_KEY(avl, *link));
+		parent = *link;
+		if (c < 0)
+			link = &parent->left;
+		else if (c > 0)
+			link = &parent->right;
+		else {
+			if (avl->val_size != 0)
+				memcpy(SP_AVL_VAL(avl, parent), val, avl->val_size);
+			return 0;
+		}
+	}
+	if ((err = sp_pool_take(&avl->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy(SP_AVL_KEY(avl, node), key, avl->key_size);
+	if (avl->val_size != 0)
+		memcpy(SP_AVL_VAL(avl, node), val, avl->val_size);
+	sp_avl_link(avl, parent, link, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_avl_insert$SUFFIX$(struct sp_avl *avl, $TYPE$ key, const void *val)
+{
+	struct sp_avl_node *parent = NULL, **link;
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	if (val == NULL && avl->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	link = &avl->root;
+	while (*link != NULL) {
+		const $TYPE$ k = *($TYPE$*)SP_AVL_KEY(avl, *link);
+		parent = *link;
+		if (key < k)
+			link = &parent->left;
+		else if (k < key)
+			link = &parent->right;
+		else {
+			if (avl->val_size != 0)
+				memcpy(SP_AVL_VAL(avl, parent), val, avl->val_size);
+			return 0;
+		}
+	}
+	if ((err = sp_pool_take(&avl->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	*($TYPE$*)SP_AVL_KEY(avl, node) = key;
+	if (avl->val_size != 0)
+		memcpy(SP_AVL_VAL(avl, node), val, avl->val_size);
+	sp_avl_link(avl, parent, link, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_avl_build(struct sp_avl *avl, const void *keys, const void *vals, size_t n)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	size_t i;
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	/*. C_ERR_NULLPTR keys SP_EINVAL */
+	if (vals == NULL && avl->val_size != 0) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+	if (avl->size != 0) {
+		error(("avl is not empty"));
+		return SP_EILLEGAL;
+	}
+	for (i = 1; i < n; i++) {
+		if (avl->cmp((char*)keys + (i - 1) * avl->key_size, (char*)keys + i * avl->key_size) >= 0) {
+			error(("keys are not sorted in strictly increasing order"));
+			return SP_EILLEGAL;
+		}
+	}
+#endif
+	/* All nodes are set aside up front, so that building cannot fail */
+	if ((err = sp_pool_reserve(&avl->pool, n)))
+		return err;
+	avl->root = sp_avl_build_range(avl, keys, avl->val_size != 0 ? vals : NULL, n, NULL);
+	avl->size = n;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_avl_build$SUFFIX$(struct sp_avl *avl, const $TYPE$ *keys, const void *vals, size_t n)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	size_t i;
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	/*. C_ERR_NULLPTR keys SP_EINVAL */
+	if (vals == NULL && avl->val_size != 0) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->key_size != sizeof(*keys)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(*keys)));
+		return SP_EILLEGAL;
+	}
+	if (avl->size != 0) {
+		error(("avl is not empty"));
+		return SP_EILLEGAL;
+	}
+	for (i = 1; i < n; i++) {
+		if (!(keys[i - 1] < keys[i])) {
+			error(("keys are not sorted in strictly increasing order"));
+			return SP_EILLEGAL;
+		}
+	}
+#endif
+	/* See sp_avl_build() */
+	if ((err = sp_pool_reserve(&avl->pool, n)))
+		return err;
+	avl->root = sp_avl_build_range(avl, (const char*)keys, avl->val_size != 0 ? vals : NULL, n, NULL);
+	avl->size = n;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_find(const struct sp_avl *avl, const void *key)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	/*. C_ERR_NULLPTR key NULL */
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return NULL;
+	}
+#endif
+	node = avl->root;
+	while (node != NULL) {
+		const int c = avl->cmp(key, SP_AVL_KEY(avl, node));
+		if (c == 0)
+			break;
+		node = c < 0 ? node->left : node->right;
+	}
+	return node;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_find$SUFFIX$(const struct sp_avl *avl, $TYPE$ key)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	node = avl->root;
+	while (node != NULL) {
+		const $TYPE$ k = *($TYPE$*)SP_AVL_KEY(avl, node);
+		if (key < k)
+			node = node->left;
+		else if (k < key)
+			node = node->right;
+		else
+			break;
+	}
+	return node;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_lowerbound(const struct sp_avl *avl, const void *key)
+{
+	struct sp_avl_node *node, *ret = NULL;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	/*. C_ERR_NULLPTR key NULL */
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return NULL;
+	}
+#endif
+	for (node = avl->root; node != NULL;) {
+		if (avl->cmp(SP_AVL_KEY(avl, node), key) >= 0) {
+			ret  = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_lowerbound$SUFFIX$(const struct sp_avl *avl, $TYPE$ key)
+{
+	struct sp_avl_node *node, *ret = NULL;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	for (node = avl->root; node != NULL;) {
+		if (!(*($TYPE$*)SP_AVL_KEY(avl, node) < key)) {
+			ret  = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_upperbound(const struct sp_avl *avl, const void *key)
+{
+	struct sp_avl_node *node, *ret = NULL;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	/*. C_ERR_NULLPTR key NULL */
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return NULL;
+	}
+#endif
+	for (node = avl->root; node != NULL;) {
+		if (avl->cmp(SP_AVL_KEY(avl, node), key) > 0) {
+			ret  = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_upperbound$SUFFIX$(const struct sp_avl *avl, $TYPE$ key)
+{
+	struct sp_avl_node *node, *ret = NULL;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	for (node = avl->root; node != NULL;) {
+		if (key < *($TYPE$*)SP_AVL_KEY(avl, node)) {
+			ret  = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+void *sp_avl_key(const struct sp_avl *avl, const struct sp_avl_node *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	return SP_AVL_KEY(avl, node);
+}
+/*F}*/
+
+/*F{*/
+void *sp_avl_val(const struct sp_avl *avl, const struct sp_avl_node *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	return SP_AVL_VAL(avl, node);
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_first(const struct sp_avl *avl)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+#endif
+	if ((node = avl->root) != NULL)
+		while (node->left != NULL)
+			node = node->left;
+	return node;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_last(const struct sp_avl *avl)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+#endif
+	if ((node = avl->root) != NULL)
+		while (node->right != NULL)
+			node = node->right;
+	return node;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_next(const struct sp_avl_node *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	if (node->right != NULL) {
+		node = node->right;
+		while (node->left != NULL)
+			node = node->left;
+		return (struct sp_avl_node*)node;
+	}
+	while (node->parent != NULL && node->parent->right == node)
+		node = node->parent;
+	return node->parent;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_prev(const struct sp_avl_node *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	if (node->left != NULL) {
+		node = node->left;
+		while (node->right != NULL)
+			node = node->right;
+		return (struct sp_avl_node*)node;
+	}
+	while (node->parent != NULL && node->parent->left == node)
+		node = node->parent;
+	return node->parent;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_avl_rank(const struct sp_avl *avl, const void *key)
+{
+	const struct sp_avl_node *node;
+	size_t ret = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl 0 */
+	/*. C_ERR_NULLPTR key 0 */
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return 0;
+	}
+#endif
+	/* Every time the search goes right, the node and its left subtree are
+	 * known to hold smaller keys */
+	for (node = avl->root; node != NULL;) {
+		if (avl->cmp(SP_AVL_KEY(avl, node), key) < 0) {
+			ret += SP_AVL_SIZE(node->left) + 1;
+			node = node->right;
+		} else {
+			node = node->left;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_avl_rank$SUFFIX$(const struct sp_avl *avl, $TYPE$ key)
+{
+	const struct sp_avl_node *node;
+	size_t ret = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl 0 */
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return 0;
+	}
+#endif
+	/* See sp_avl_rank() */
+	for (node = avl->root; node != NULL;) {
+		if (*($TYPE$*)SP_AVL_KEY(avl, node) < key) {
+			ret += SP_AVL_SIZE(node->left) + 1;
+			node = node->right;
+		} else {
+			node = node->left;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_avl_node *sp_avl_select(const struct sp_avl *avl, size_t idx)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl NULL */
+	if (idx >= avl->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	node = avl->root;
+	for (;;) {
+		const size_t left = SP_AVL_SIZE(node->left);
+		if (idx < left) {
+			node = node->left;
+		} else if (idx > left) {
+			idx -= left + 1;
+			node = node->right;
+		} else {
+			return node;
+		}
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_avl_remove(struct sp_avl *avl, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((node = sp_avl_find(avl, key)) == NULL)
+		return SP_ENOKEY;
+	return sp_avl_erase(avl, node, kdtor, vdtor);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_avl_remove$SUFFIX$(struct sp_avl *avl, $TYPE$ key, int (*dtor)(void*))
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((node = sp_avl_find$SUFFIX$(avl, key)) == NULL)
+		return SP_ENOKEY;
+	return sp_avl_erase(avl, node, NULL, dtor);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_avl_erase(struct sp_avl *avl, struct sp_avl_node *node, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+#endif
+	if (kdtor != NULL && (err = kdtor(SP_AVL_KEY(avl, node)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_AVL_VAL(avl, node)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+		return SP_ECALLBK;
+	}
+	sp_avl_unlink(avl, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_avl_print(const struct sp_avl *avl, int (*func)(const void*, const void*))
+{
+	const struct sp_avl_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+#endif
+	printf("sp_avl_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT", height: %d\n",
+		(SP_SIZE_T)avl->size, (SP_SIZE_T)avl->pool.capacity, (SP_SIZE_T)avl->key_size, (SP_SIZE_T)avl->val_size,
+		SP_AVL_HEIGHT(avl->root));
+	for (node = sp_avl_first(avl); node != NULL; node = sp_avl_next(node), i++) {
+		const void *const key = SP_AVL_KEY(avl, node),
+		           *const val = SP_AVL_VAL(avl, node);
+		int err;
+		printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+		if (func == NULL)
+			printf("%p\t%p\n", key, val);
+		else if ((err = func(key, val))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_avl_print$SUFFIX$(const struct sp_avl *avl)
+{
+	const struct sp_avl_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR avl SP_EINVAL */
+	if (avl->key_size != sizeof($TYPE$)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof($TYPE$)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_avl_print$SUFFIX$()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT", height: %d\n",
+		(SP_SIZE_T)avl->size, (SP_SIZE_T)avl->pool.capacity, (SP_SIZE_T)avl->key_size, (SP_SIZE_T)avl->val_size,
+		SP_AVL_HEIGHT(avl->root));
+	for (node = sp_avl_first(avl); node != NULL; node = sp_avl_next(node), i++) {
+		const $TYPE$ elem = *($TYPE$*)SP_AVL_KEY(avl, node);
+		printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)i, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,425 @@
+#include "../sp_bitarray.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_bitarray *sp_bitarray_create(size_t capacity)
+{
+	struct sp_bitarray *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (capacity > SP_SIZE_MAX / SP_WORD_BIT * SP_WORD_BIT) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->size     = 0;
+	ret->capacity = SP_WORDS(capacity) * SP_WORD_BIT;
+	ret->data     = calloc(SP_WORDS(capacity), sizeof(*ret->data));
+	if (ret->data == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bitarray_clear(struct sp_bitarray *bitarray)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+#endif
+	memset(bitarray->data, 0, SP_WORDS(bitarray->size) * sizeof(*bitarray->data));
+	bitarray->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_destroy(struct sp_bitarray *bitarray)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+#endif
+	free(bitarray->data);
+	free(bitarray);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_bitarray_eq(const struct sp_bitarray *bitarray1, const struct sp_bitarray *bitarray2)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray1 0 */
+	/*. C_ERR_NULLPTR bitarray2 0 */
+#endif
+	/* Bits past size are always 0, so whole words can be compared */
+	return bitarray1->size == bitarray2->size
+		&& !memcmp(bitarray1->data, bitarray2->data, SP_WORDS(bitarray1->size) * sizeof(*bitarray1->data));
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bitarray_copy(struct sp_bitarray *dest, const struct sp_bitarray *src)
+{
+	size_t words;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+#endif
+	if ((err = sp_bitbuf_fit(&dest->data, &dest->capacity, src->size)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	words = SP_WORDS(src->size);
+	memcpy(dest->data, src->data, words * sizeof(*dest->data));
+	if (dest->size > src->size)
+		memset(dest->data + words, 0, (SP_WORDS(dest->size) - words) * sizeof(*dest->data));
+	dest->size = src->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bitarray_resize(struct sp_bitarray *bitarray, size_t size)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+#endif
+	if (size < bitarray->size) {
+		/* Keep the bits past size zeroed */
+		const size_t words = SP_WORDS(size);
+		if (size % SP_WORD_BIT != 0)
+			bitarray->data[words - 1] &= ~(~0UL << size % SP_WORD_BIT);
+		memset(bitarray->data + words, 0, (SP_WORDS(bitarray->size) - words) * sizeof(*bitarray->data));
+	} else if ((err = sp_bitbuf_fit(&bitarray->data, &bitarray->capacity, size))) {
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	}
+	bitarray->size = size;
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_push(struct sp_bitarray *bitarray, int bit)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+#endif
+	if (sp_size_try_add(bitarray->size, 1))
+		return SP_ERANGE;
+	if ((err = sp_bitbuf_fit(&bitarray->data, &bitarray->capacity, bitarray->size + 1)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	if (bit)
+		bitarray->data[bitarray->size / SP_WORD_BIT] |= 1UL << bitarray->size % SP_WORD_BIT;
+	++bitarray->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_bitarray_pop(struct sp_bitarray *bitarray)
+{
+	unsigned long *word, mask;
+	int ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray 0 */
+	if (bitarray->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY bitarray */
+		return 0;
+	}
+#endif
+	--bitarray->size;
+	word  = bitarray->data + bitarray->size / SP_WORD_BIT;
+	mask  = 1UL << bitarray->size % SP_WORD_BIT;
+	ret   = (*word & mask) != 0;
+	*word &= ~mask;
+	return ret;
+}
+/*F}*/
+
+
+/*F{*/
+int sp_bitarray_get(const struct sp_bitarray *bitarray, size_t idx)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray 0 */
+	if (idx >= bitarray->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	return (bitarray->data[idx / SP_WORD_BIT] >> idx % SP_WORD_BIT) & 1UL;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_set(struct sp_bitarray *bitarray, size_t idx, int bit)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+	if (idx >= bitarray->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (bit)
+		bitarray->data[idx / SP_WORD_BIT] |= 1UL << idx % SP_WORD_BIT;
+	else
+		bitarray->data[idx / SP_WORD_BIT] &= ~(1UL << idx % SP_WORD_BIT);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_flip(struct sp_bitarray *bitarray, size_t idx)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+	if (idx >= bitarray->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	bitarray->data[idx / SP_WORD_BIT] ^= 1UL << idx % SP_WORD_BIT;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bitarray_fill(struct sp_bitarray *bitarray, size_t idx, size_t n, int bit)
+{
+	size_t first, last;
+	unsigned long head, tail;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+	if (idx > bitarray->size || n > bitarray->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (n == 0)
+		return 0;
+	first = idx / SP_WORD_BIT;
+	last  = (idx + n - 1) / SP_WORD_BIT;
+	head  = ~0UL << idx % SP_WORD_BIT;
+	tail  = ~0UL >> (SP_WORD_BIT - 1 - (idx + n - 1) % SP_WORD_BIT);
+	if (first == last)
+		head = tail = head & tail;
+	/* Partial words on both ends are masked, everything in between is
+	 * filled with a single memset */
+	if (bit) {
+		bitarray->data[first] |= head;
+		bitarray->data[last]  |= tail;
+	} else {
+		bitarray->data[first] &= ~head;
+		bitarray->data[last]  &= ~tail;
+	}
+	if (last - first > 1)
+		memset(bitarray->data + first + 1, bit ? 0xff : 0, (last - first - 1) * sizeof(*bitarray->data));
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_and(struct sp_bitarray *dest, const struct sp_bitarray *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest->size != src->size) {
+		error(("bitarray sizes differ ("SP_SIZE_FMT" != "SP_SIZE_FMT")", (SP_SIZE_T)dest->size, (SP_SIZE_T)src->size));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < SP_WORDS(dest->size); i++)
+		dest->data[i] &= src->data[i];
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_or(struct sp_bitarray *dest, const struct sp_bitarray *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest->size != src->size) {
+		error(("bitarray sizes differ ("SP_SIZE_FMT" != "SP_SIZE_FMT")", (SP_SIZE_T)dest->size, (SP_SIZE_T)src->size));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < SP_WORDS(dest->size); i++)
+		dest->data[i] |= src->data[i];
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_xor(struct sp_bitarray *dest, const struct sp_bitarray *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest->size != src->size) {
+		error(("bitarray sizes differ ("SP_SIZE_FMT" != "SP_SIZE_FMT")", (SP_SIZE_T)dest->size, (SP_SIZE_T)src->size));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < SP_WORDS(dest->size); i++)
+		dest->data[i] ^= src->data[i];
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_andnot(struct sp_bitarray *dest, const struct sp_bitarray *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest->size != src->size) {
+		error(("bitarray sizes differ ("SP_SIZE_FMT" != "SP_SIZE_FMT")", (SP_SIZE_T)dest->size, (SP_SIZE_T)src->size));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < SP_WORDS(dest->size); i++)
+		dest->data[i] &= ~src->data[i];
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+size_t sp_bitarray_count(const struct sp_bitarray *bitarray)
+{
+	size_t i, ret = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray 0 */
+#endif
+	for (i = 0; i < SP_WORDS(bitarray->size); i++)
+		ret += SP_POPCOUNT(bitarray->data[i]);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_bitarray_rank(const struct sp_bitarray *bitarray, size_t idx)
+{
+	size_t i, ret = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray 0 */
+	if (idx > bitarray->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	for (i = 0; i < idx / SP_WORD_BIT; i++)
+		ret += SP_POPCOUNT(bitarray->data[i]);
+	if (idx % SP_WORD_BIT != 0)
+		ret += SP_POPCOUNT(bitarray->data[i] & ~(~0UL << idx % SP_WORD_BIT));
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_bitarray_select(const struct sp_bitarray *bitarray, size_t n)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray 0 */
+#endif
+	for (i = 0; i < SP_WORDS(bitarray->size); i++) {
+		unsigned long word = bitarray->data[i];
+		const size_t count = SP_POPCOUNT(word);
+		if (n < count) {
+			/* Drop the n lowest set bits of the word */
+			while (n != 0) {
+				word &= word - 1;
+				--n;
+			}
+			return i * SP_WORD_BIT + SP_CTZ(word);
+		}
+		n -= count;
+	}
+	return bitarray->size;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_bitarray_next(const struct sp_bitarray *bitarray, size_t idx)
+{
+	size_t i;
+	unsigned long word;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray 0 */
+#endif
+	if (idx >= bitarray->size)
+		return bitarray->size;
+	i    = idx / SP_WORD_BIT;
+	word = bitarray->data[i] & (~0UL << idx % SP_WORD_BIT);
+	while (word == 0) {
+		if (++i == SP_WORDS(bitarray->size))
+			return bitarray->size;
+		word = bitarray->data[i];
+	}
+	return i * SP_WORD_BIT + SP_CTZ(word);
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bitarray_print(const struct sp_bitarray *bitarray)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bitarray SP_EINVAL */
+#endif
+	printf("sp_bitarray_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT"\n",
+		(SP_SIZE_T)bitarray->size, (SP_SIZE_T)bitarray->capacity);
+	for (i = 0; i < bitarray->size; i++) {
+		if (i % SP_WORD_BIT == 0)
+			printf("%s["SP_SIZE_FMT"]\t", i ? "\n" : "", (SP_SIZE_T)i);
+		putchar('0' + (int)((bitarray->data[i / SP_WORD_BIT] >> i % SP_WORD_BIT) & 1UL));
+	}
+	if (bitarray->size != 0)
+		putchar('\n');
+	return 0;
+}
+/*F}*/
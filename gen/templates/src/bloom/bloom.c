@@ -0,0 +1,296 @@
+#include "../sp_bloom.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_bloom *sp_bloom_create(size_t capacity, double fpr, int blocked)
+{
+	const double ln2 = 0.69314718055994530942;
+	const size_t align = blocked ? SP_BLOOM_BLOCK : 64;
+	double bits;
+	size_t nhashes;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (!(fpr > 0 && fpr < 1)) {
+		error(("fpr must lie between 0 and 1"));
+		return NULL;
+	}
+
+	/* The filter of capacity elements with the lowest false positive rate
+	 * for its size has -capacity * ln fpr / ln^2 2 bits, rounded up to a
+	 * multiple of 64, or of a block, and -ln fpr / ln 2 hashes */
+	bits = -(double)MAX(capacity, 1) * sp_log(fpr) / (ln2 * ln2);
+	if (bits > (double)(SP_SIZE_MAX - 2 * SP_BLOOM_BLOCK)) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+	nhashes = (size_t)(-sp_log(fpr) / ln2 + 0.5);
+	return sp_bloom_alloc(((size_t)bits / align + 1) * align, MAX(nhashes, 1), blocked);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bloom_clear(struct sp_bloom *bloom)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom SP_EINVAL */
+#endif
+	sp_bitarray_fill(bloom->bits, 0, bloom->bits->size, 0);
+	bloom->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bloom_destroy(struct sp_bloom *bloom)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom SP_EINVAL */
+#endif
+	sp_bitarray_destroy(bloom->bits);
+	free(bloom);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bloom_insert(struct sp_bloom *bloom, const void *data, size_t len)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom SP_EINVAL */
+	if (data == NULL && len != 0) {
+		error(("data is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	/* Elements which were reported as present are not counted again */
+	if (!sp_bloom_probe(bloom, data, len, 1))
+		++bloom->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_bloom_insert$SUFFIX$(struct sp_bloom *bloom, $TYPE$ elem)
+{
+	unsigned char buf[sizeof(elem) + 1];
+	size_t len;
+	SP_KEY_ENCODE($TYPE$, elem, buf, len);
+	return sp_bloom_insert(bloom, buf, len);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bloom_insertstr(struct sp_bloom *bloom, const char *str)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR str SP_EINVAL */
+#endif
+	return sp_bloom_insert(bloom, str, strlen(str));
+}
+/*F}*/
+
+/*F{*/
+int sp_bloom_contains(const struct sp_bloom *bloom, const void *data, size_t len)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom 0 */
+	if (data == NULL && len != 0) {
+		error(("data is NULL"));
+		return 0;
+	}
+#endif
+	return sp_bloom_probe(bloom, data, len, 0);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_bloom_contains$SUFFIX$(const struct sp_bloom *bloom, $TYPE$ elem)
+{
+	unsigned char buf[sizeof(elem) + 1];
+	size_t len;
+	SP_KEY_ENCODE($TYPE$, elem, buf, len);
+	return sp_bloom_contains(bloom, buf, len);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_bloom_containsstr(const struct sp_bloom *bloom, const char *str)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR str 0 */
+#endif
+	return sp_bloom_contains(bloom, str, strlen(str));
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bloom_union(struct sp_bloom *dest, const struct sp_bloom *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest->nbits != src->nbits || dest->nhashes != src->nhashes || dest->blocked != src->blocked) {
+		error(("filters have different parameters"));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < dest->nbits / SP_WORD_BIT; i++)
+		dest->bits->data[dest->offset + i] |= src->bits->data[src->offset + i];
+	dest->size = sp_bloom_estimate(dest);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bloom_intersect(struct sp_bloom *dest, const struct sp_bloom *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest->nbits != src->nbits || dest->nhashes != src->nhashes || dest->blocked != src->blocked) {
+		error(("filters have different parameters"));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < dest->nbits / SP_WORD_BIT; i++)
+		dest->bits->data[dest->offset + i] &= src->bits->data[src->offset + i];
+	dest->size = sp_bloom_estimate(dest);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+double sp_bloom_fpr(const struct sp_bloom *bloom)
+{
+	const unsigned long *words;
+	size_t span, i, j, x;
+	double ret = 0, p;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom 0 */
+#endif
+	/* A query looks at bits of a single region, which is a block or the
+	 * whole filter, and each of them is set with a probability equal to the
+	 * fill of the region */
+	words = bloom->bits->data + bloom->offset;
+	span  = bloom->blocked ? SP_BLOOM_BLOCK : bloom->nbits;
+	for (i = 0; i < bloom->nbits / SP_WORD_BIT; i += span / SP_WORD_BIT) {
+		for (j = 0, x = 0; j < span / SP_WORD_BIT; j++)
+			x += SP_POPCOUNT(words[i + j]);
+		for (j = 0, p = 1; j < bloom->nhashes; j++)
+			p *= (double)x / (double)span;
+		ret += p;
+	}
+	return ret / (double)(bloom->nbits / span);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+size_t sp_bloom_serialize(const struct sp_bloom *bloom, void *buf, size_t size)
+{
+	unsigned char *const out = buf;
+	const unsigned long *words;
+	size_t i, ret, x;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom 0 */
+#endif
+	ret = SP_BLOOM_HEADER + bloom->nbits / 8;
+	if (buf == NULL || size < ret)
+		return ret;
+
+	/* The header holds a magic number, a version, the flags, 2 bytes of
+	 * padding, and the numbers of hashes, bits and elements in big-endian
+	 * order, followed by the bits, 8 per byte from the lowest one */
+	memcpy(out, "SPBF", 4);
+	out[4] = 1;
+	out[5] = (unsigned char)bloom->blocked;
+	out[6] = 0;
+	out[7] = 0;
+	for (i = 0, x = bloom->nhashes; i < 4; i++, x = x >> 4 >> 4)
+		out[11 - i] = (unsigned char)(x & 0xFF);
+	for (i = 0, x = bloom->nbits; i < 8; i++, x = x >> 4 >> 4)
+		out[19 - i] = (unsigned char)(x & 0xFF);
+	for (i = 0, x = bloom->size; i < 8; i++, x = x >> 4 >> 4)
+		out[27 - i] = (unsigned char)(x & 0xFF);
+	words = bloom->bits->data + bloom->offset;
+	for (i = 0; i < bloom->nbits / 8; i++)
+		out[SP_BLOOM_HEADER + i] = (unsigned char)(words[i * 8 / SP_WORD_BIT] >> i * 8 % SP_WORD_BIT & 0xFF);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+struct sp_bloom *sp_bloom_deserialize(const void *buf, size_t size)
+{
+	const unsigned char *const in = buf;
+	struct sp_bloom *ret;
+	unsigned long *words;
+	size_t i, nhashes = 0, nbits = 0, count = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR buf NULL */
+#endif
+	if (size < SP_BLOOM_HEADER || memcmp(in, "SPBF", 4) != 0 || in[4] != 1 || in[5] > 1) {
+		error(("buf does not hold a serialized bloom filter"));
+		return NULL;
+	}
+	for (i = 0; i < 4; i++)
+		nhashes = nhashes << 8 | in[8 + i];
+	for (i = 0; i < 8; i++) {
+		if (nbits > SP_SIZE_MAX >> 8 || count > SP_SIZE_MAX >> 8) {
+			/*. C_ERRMSG_SIZE_T_OVERFLOW */
+			return NULL;
+		}
+		nbits = nbits << 8 | in[12 + i];
+		count = count << 8 | in[20 + i];
+	}
+	if (nhashes == 0 || nbits == 0 || nbits % (in[5] ? SP_BLOOM_BLOCK : 64) != 0
+			|| nbits > SP_SIZE_MAX - SP_BLOOM_BLOCK) {
+		error(("buf holds invalid filter parameters"));
+		return NULL;
+	}
+	if (size - SP_BLOOM_HEADER < nbits / 8) {
+		error(("buf is too short for the filter (%lu < %lu)",
+					(unsigned long)size, (unsigned long)(SP_BLOOM_HEADER + nbits / 8)));
+		return NULL;
+	}
+
+	if ((ret = sp_bloom_alloc(nbits, nhashes, in[5])) == NULL)
+		return NULL;
+	words = ret->bits->data + ret->offset;
+	for (i = 0; i < nbits / 8; i++)
+		words[i * 8 / SP_WORD_BIT] |= (unsigned long)in[SP_BLOOM_HEADER + i] << i * 8 % SP_WORD_BIT;
+	ret->size = count;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_bloom_print(const struct sp_bloom *bloom)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR bloom SP_EINVAL */
+#endif
+	printf("sp_bloom_print()\nsize: "SP_SIZE_FMT", nbits: "SP_SIZE_FMT", nhashes: "SP_SIZE_FMT", blocked: %d\n",
+		(SP_SIZE_T)bloom->size, (SP_SIZE_T)bloom->nbits, (SP_SIZE_T)bloom->nhashes, bloom->blocked);
+	printf("set bits: "SP_SIZE_FMT", false positive rate: %g\n",
+		(SP_SIZE_T)sp_bitarray_count(bloom->bits), sp_bloom_fpr(bloom));
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,652 @@
+#include "../sp_bptree.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_bptree *sp_bptree_create(size_t key_size, size_t val_size, size_t node_size, int (*cmp)(const void*, const void*))
+{
+	struct sp_bptree *ret;
+	const size_t ps = sizeof(struct sp_bptree_node*);
+	size_t ka, va;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (key_size > SP_SIZE_MAX / 16 || val_size > SP_SIZE_MAX / 16) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+	if (node_size == 0)
+		node_size = SP_BPTREE_NODE_SIZE;
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Leaves hold the node header, followed by an array of keys and an array
+	 * of values, while inner nodes hold the header, an array of keys and an
+	 * array of one child more. Each array is aligned for any type of the size
+	 * of its items, and as many items as fit into node_size are held, but no
+	 * less than 3. */
+	ka = key_size != 0 ? SP_ALIGNOF_SIZE(key_size) : 1;
+	va = val_size != 0 ? SP_ALIGNOF_SIZE(val_size) : 1;
+	ret->key_offset = (sizeof(struct sp_bptree_node) + ka - 1) / ka * ka;
+
+	ret->leaf_cap = 0;
+	if (node_size > ret->key_offset + va)
+		ret->leaf_cap = (node_size - ret->key_offset - (va - 1)) / MAX(key_size + val_size, 1);
+	ret->leaf_cap   = MAX(ret->leaf_cap, 3);
+	ret->val_offset = (ret->key_offset + ret->leaf_cap * key_size + va - 1) / va * va;
+	ret->leaf_size  = ret->val_offset + ret->leaf_cap * val_size;
+
+	ret->inner_cap = 0;
+	if (node_size > ret->key_offset + 2 * ps)
+		ret->inner_cap = (node_size - ret->key_offset - (ps - 1) - ps) / (key_size + ps);
+	ret->inner_cap    = MAX(ret->inner_cap, 3);
+	ret->child_offset = (ret->key_offset + ret->inner_cap * key_size + ps - 1) / ps * ps;
+	ret->inner_size   = ret->child_offset + (ret->inner_cap + 1) * ps;
+
+	ret->root     = NULL;
+	ret->head     = NULL;
+	ret->tail     = NULL;
+	ret->key_size = key_size;
+	ret->val_size = val_size;
+	ret->size     = 0;
+	ret->height   = 0;
+	ret->cmp      = cmp;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bptree_clear(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_bptree_node *node;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	if (kdtor != NULL || vdtor != NULL) {
+		for (node = tree->head; node != NULL; node = node->next) {
+			for (i = 0; i < node->count; i++) {
+				int err;
+				if (kdtor != NULL && (err = kdtor(SP_BPTREE_KEY(tree, node, i)))) {
+					/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+					return SP_ECALLBK;
+				}
+				if (vdtor != NULL && (err = vdtor(SP_BPTREE_VAL(tree, node, i)))) {
+					/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+					return SP_ECALLBK;
+				}
+			}
+		}
+	}
+	if (tree->root != NULL)
+		sp_bptree_free(tree, tree->root, tree->height);
+	tree->root   = NULL;
+	tree->head   = NULL;
+	tree->tail   = NULL;
+	tree->size   = 0;
+	tree->height = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_destroy(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	if (sp_bptree_clear(tree, kdtor, vdtor))
+		return SP_ECALLBK;
+	free(tree);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bptree_insert(struct sp_bptree *tree, const void *key, const void *val)
+{
+	struct sp_bptree_node *path[SP_BPTREE_MAX_HEIGHT], *node;
+	size_t slot[SP_BPTREE_MAX_HEIGHT], l;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	if (val == NULL && tree->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Separators are the smallest keys of the subtrees to their right, so that
+	 * the subtree to take is the one after all separators not above key */
+	for (l = 0, node = tree->root; l + 1 < tree->height; l++) {
+		path[l] = node;
+		slot[l] = sp_bptree_rank(tree, node, key, 1);
+		node = SP_BPTREE_CHILD(tree, node)[slot[l]];
+	}
+	if (node != NULL) {
+		path[l] = node;
+		slot[l] = sp_bptree_rank(tree, node, key, 0);
+		if (slot[l] < node->count && tree->cmp(SP_BPTREE_KEY(tree, node, slot[l]), key) == 0) {
+			if (tree->val_size != 0)
+				memcpy(SP_BPTREE_VAL(tree, node, slot[l]), val, tree->val_size);
+			return 0;
+		}
+	}
+	if (sp_bptree_insert_at(tree, path, slot, key, val))
+		return SP_ENOMEM;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_bptree_insert$SUFFIX$(struct sp_bptree *tree, $TYPE$ key, const void *val)
+{
+	struct sp_bptree_node *path[SP_BPTREE_MAX_HEIGHT], *node;
+	size_t slot[SP_BPTREE_MAX_HEIGHT], l;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	if (val == NULL && tree->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->key_size != sizeof(key)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (l = 0, node = tree->root; l + 1 < tree->height; l++) {
+		path[l] = node;
+		SP_BPTREE_RANK(tree, node, $TYPE$, key, <=, slot[l]);
+		node = SP_BPTREE_CHILD(tree, node)[slot[l]];
+	}
+	if (node != NULL) {
+		path[l] = node;
+		SP_BPTREE_RANK(tree, node, $TYPE$, key, <, slot[l]);
+		if (slot[l] < node->count && !(key < *($TYPE$*)SP_BPTREE_KEY(tree, node, slot[l]))) {
+			if (tree->val_size != 0)
+				memcpy(SP_BPTREE_VAL(tree, node, slot[l]), val, tree->val_size);
+			return 0;
+		}
+	}
+	if (sp_bptree_insert_at(tree, path, slot, &key, val))
+		return SP_ENOMEM;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bptree_build(struct sp_bptree *tree, const void *keys, const void *vals, size_t n)
+{
+#ifdef STAPLE_DEBUG
+	size_t i;
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR keys SP_EINVAL */
+	if (vals == NULL && tree->val_size != 0) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+	if (tree->size != 0) {
+		error(("tree is not empty"));
+		return SP_EILLEGAL;
+	}
+	for (i = 1; i < n; i++) {
+		if (tree->cmp((char*)keys + (i - 1) * tree->key_size, (char*)keys + i * tree->key_size) >= 0) {
+			error(("keys are not sorted in strictly increasing order"));
+			return SP_EILLEGAL;
+		}
+	}
+#endif
+	if (n != 0 && sp_bptree_bulkload(tree, keys, vals, n))
+		return SP_ENOMEM;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bptree_build$SUFFIX$(struct sp_bptree *tree, const $TYPE$ *keys, const void *vals, size_t n)
+{
+#ifdef STAPLE_DEBUG
+	size_t i;
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR keys SP_EINVAL */
+	if (vals == NULL && tree->val_size != 0) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->key_size != sizeof(*keys)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(*keys)));
+		return SP_EILLEGAL;
+	}
+	if (tree->size != 0) {
+		error(("tree is not empty"));
+		return SP_EILLEGAL;
+	}
+	for (i = 1; i < n; i++) {
+		if (!(keys[i - 1] < keys[i])) {
+			error(("keys are not sorted in strictly increasing order"));
+			return SP_EILLEGAL;
+		}
+	}
+#endif
+	if (n != 0 && sp_bptree_bulkload(tree, (const char*)keys, vals, n))
+		return SP_ENOMEM;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_bptree_get(const struct sp_bptree *tree, const void *key)
+{
+	const struct sp_bptree_node *node;
+	size_t l, pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	/*. C_ERR_NULLPTR key NULL */
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return NULL;
+	}
+#endif
+	if ((node = tree->root) == NULL)
+		return NULL;
+	for (l = 1; l < tree->height; l++)
+		node = SP_BPTREE_CHILD(tree, node)[sp_bptree_rank(tree, node, key, 1)];
+	pos = sp_bptree_rank(tree, node, key, 0);
+	if (pos < node->count && tree->cmp(SP_BPTREE_KEY(tree, node, pos), key) == 0)
+		return SP_BPTREE_VAL(tree, node, pos);
+	return NULL;
+}
+/*F}*/
+
+/*F{*/
+void *sp_bptree_get$SUFFIX$(const struct sp_bptree *tree, $TYPE$ key)
+{
+	const struct sp_bptree_node *node;
+	size_t l, pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	if (tree->key_size != sizeof(key)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	if ((node = tree->root) == NULL)
+		return NULL;
+	for (l = 1; l < tree->height; l++) {
+		SP_BPTREE_RANK(tree, node, $TYPE$, key, <=, pos);
+		node = SP_BPTREE_CHILD(tree, node)[pos];
+	}
+	SP_BPTREE_RANK(tree, node, $TYPE$, key, <, pos);
+	if (pos < node->count && !(key < *($TYPE$*)SP_BPTREE_KEY(tree, node, pos)))
+		return SP_BPTREE_VAL(tree, node, pos);
+	return NULL;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bptree_remove(struct sp_bptree *tree, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_bptree_node *path[SP_BPTREE_MAX_HEIGHT], *node;
+	size_t slot[SP_BPTREE_MAX_HEIGHT], l;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((node = tree->root) == NULL)
+		return SP_ENOKEY;
+	for (l = 0; l + 1 < tree->height; l++) {
+		path[l] = node;
+		slot[l] = sp_bptree_rank(tree, node, key, 1);
+		node = SP_BPTREE_CHILD(tree, node)[slot[l]];
+	}
+	path[l] = node;
+	slot[l] = sp_bptree_rank(tree, node, key, 0);
+	if (slot[l] == node->count || tree->cmp(SP_BPTREE_KEY(tree, node, slot[l]), key) != 0)
+		return SP_ENOKEY;
+	if (kdtor != NULL && (err = kdtor(SP_BPTREE_KEY(tree, node, slot[l])))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_BPTREE_VAL(tree, node, slot[l])))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+		return SP_ECALLBK;
+	}
+	sp_bptree_erase_at(tree, path, slot);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_bptree_remove$SUFFIX$(struct sp_bptree *tree, $TYPE$ key, int (*dtor)(void*))
+{
+	struct sp_bptree_node *path[SP_BPTREE_MAX_HEIGHT], *node;
+	size_t slot[SP_BPTREE_MAX_HEIGHT], l;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	if (tree->key_size != sizeof(key)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((node = tree->root) == NULL)
+		return SP_ENOKEY;
+	for (l = 0; l + 1 < tree->height; l++) {
+		path[l] = node;
+		SP_BPTREE_RANK(tree, node, $TYPE$, key, <=, slot[l]);
+		node = SP_BPTREE_CHILD(tree, node)[slot[l]];
+	}
+	path[l] = node;
+	SP_BPTREE_RANK(tree, node, $TYPE$, key, <, slot[l]);
+	if (slot[l] == node->count || key < *($TYPE$*)SP_BPTREE_KEY(tree, node, slot[l]))
+		return SP_ENOKEY;
+	if (dtor != NULL && (err = dtor(SP_BPTREE_VAL(tree, node, slot[l])))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_bptree_erase_at(tree, path, slot);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_first(const struct sp_bptree *tree, struct sp_bptree_iter *it)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_NULLPTR it 0 */
+#endif
+	it->node = tree->head;
+	it->idx  = 0;
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_last(const struct sp_bptree *tree, struct sp_bptree_iter *it)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_NULLPTR it 0 */
+#endif
+	it->node = tree->tail;
+	it->idx  = it->node != NULL ? it->node->count - 1 : 0;
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_lowerbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it)
+{
+	struct sp_bptree_node *node;
+	size_t l;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_NULLPTR key 0 */
+	/*. C_ERR_NULLPTR it 0 */
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return 0;
+	}
+#endif
+	it->node = NULL;
+	it->idx  = 0;
+	if ((node = tree->root) == NULL)
+		return 0;
+	for (l = 1; l < tree->height; l++)
+		node = SP_BPTREE_CHILD(tree, node)[sp_bptree_rank(tree, node, key, 1)];
+	it->node = node;
+	it->idx  = sp_bptree_rank(tree, node, key, 0);
+	/* The bound may be the first key of the next leaf */
+	if (it->idx == node->count) {
+		it->node = node->next;
+		it->idx  = 0;
+	}
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_lowerbound$SUFFIX$(const struct sp_bptree *tree, $TYPE$ key, struct sp_bptree_iter *it)
+{
+	struct sp_bptree_node *node;
+	size_t l, pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_NULLPTR it 0 */
+	if (tree->key_size != sizeof(key)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(key)));
+		return 0;
+	}
+#endif
+	it->node = NULL;
+	it->idx  = 0;
+	if ((node = tree->root) == NULL)
+		return 0;
+	for (l = 1; l < tree->height; l++) {
+		SP_BPTREE_RANK(tree, node, $TYPE$, key, <=, pos);
+		node = SP_BPTREE_CHILD(tree, node)[pos];
+	}
+	SP_BPTREE_RANK(tree, node, $TYPE$, key, <, pos);
+	it->node = node;
+	it->idx  = pos;
+	if (pos == node->count) {
+		it->node = node->next;
+		it->idx  = 0;
+	}
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_upperbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it)
+{
+	struct sp_bptree_node *node;
+	size_t l;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_NULLPTR key 0 */
+	/*. C_ERR_NULLPTR it 0 */
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return 0;
+	}
+#endif
+	it->node = NULL;
+	it->idx  = 0;
+	if ((node = tree->root) == NULL)
+		return 0;
+	for (l = 1; l < tree->height; l++)
+		node = SP_BPTREE_CHILD(tree, node)[sp_bptree_rank(tree, node, key, 1)];
+	it->node = node;
+	it->idx  = sp_bptree_rank(tree, node, key, 1);
+	if (it->idx == node->count) {
+		it->node = node->next;
+		it->idx  = 0;
+	}
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_upperbound$SUFFIX$(const struct sp_bptree *tree, $TYPE$ key, struct sp_bptree_iter *it)
+{
+	struct sp_bptree_node *node;
+	size_t l, pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_NULLPTR it 0 */
+	if (tree->key_size != sizeof(key)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(key)));
+		return 0;
+	}
+#endif
+	it->node = NULL;
+	it->idx  = 0;
+	if ((node = tree->root) == NULL)
+		return 0;
+	for (l = 1; l < tree->height; l++) {
+		SP_BPTREE_RANK(tree, node, $TYPE$, key, <=, pos);
+		node = SP_BPTREE_CHILD(tree, node)[pos];
+	}
+	SP_BPTREE_RANK(tree, node, $TYPE$, key, <=, pos);
+	it->node = node;
+	it->idx  = pos;
+	if (pos == node->count) {
+		it->node = node->next;
+		it->idx  = 0;
+	}
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_next(struct sp_bptree_iter *it)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR it 0 */
+#endif
+	if (it->node == NULL)
+		return 0;
+	if (++it->idx == it->node->count) {
+		it->node = it->node->next;
+		it->idx  = 0;
+	}
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+int sp_bptree_prev(struct sp_bptree_iter *it)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR it 0 */
+#endif
+	if (it->node == NULL)
+		return 0;
+	if (it->idx == 0) {
+		it->node = it->node->prev;
+		it->idx  = it->node != NULL ? it->node->count - 1 : 0;
+	} else {
+		--it->idx;
+	}
+	return it->node != NULL;
+}
+/*F}*/
+
+/*F{*/
+void *sp_bptree_key(const struct sp_bptree *tree, const struct sp_bptree_iter *it)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	/*. C_ERR_NULLPTR it NULL */
+	/*. C_ERR_NULLPTR it->node NULL */
+#endif
+	return SP_BPTREE_KEY(tree, it->node, it->idx);
+}
+/*F}*/
+
+/*F{*/
+void *sp_bptree_val(const struct sp_bptree *tree, const struct sp_bptree_iter *it)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	/*. C_ERR_NULLPTR it NULL */
+	/*. C_ERR_NULLPTR it->node NULL */
+#endif
+	return SP_BPTREE_VAL(tree, it->node, it->idx);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_bptree_print(const struct sp_bptree *tree, int (*func)(const void*, const void*))
+{
+	const struct sp_bptree_node *node;
+	size_t i, j = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	printf("sp_bptree_print()\nsize: "SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT", leaf_cap: "SP_SIZE_FMT", inner_cap: "SP_SIZE_FMT", height: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)tree->size, (SP_SIZE_T)tree->key_size, (SP_SIZE_T)tree->val_size,
+		(SP_SIZE_T)tree->leaf_cap, (SP_SIZE_T)tree->inner_cap, (SP_SIZE_T)tree->height);
+	for (node = tree->head; node != NULL; node = node->next) {
+		for (i = 0; i < node->count; i++, j++) {
+			const void *const key = SP_BPTREE_KEY(tree, node, i),
+			           *const val = SP_BPTREE_VAL(tree, node, i);
+			int err;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)j);
+			if (func == NULL)
+				printf("%p\t%p\n", key, val);
+			else if ((err = func(key, val))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_bptree_print$SUFFIX$(const struct sp_bptree *tree)
+{
+	const struct sp_bptree_node *node;
+	size_t i, j = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	if (tree->key_size != sizeof($TYPE$)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof($TYPE$)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_bptree_print$SUFFIX$()\nsize: "SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT", leaf_cap: "SP_SIZE_FMT", inner_cap: "SP_SIZE_FMT", height: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)tree->size, (SP_SIZE_T)tree->key_size, (SP_SIZE_T)tree->val_size,
+		(SP_SIZE_T)tree->leaf_cap, (SP_SIZE_T)tree->inner_cap, (SP_SIZE_T)tree->height);
+	for (node = tree->head; node != NULL; node = node->next) {
+		for (i = 0; i < node->count; i++, j++) {
+			const $TYPE$ elem = *($TYPE$*)SP_BPTREE_KEY(tree, node, i);
+			printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)j, $FMT_ARGS$);
+		}
+	}
+	return 0;
+}
+/*F}*/
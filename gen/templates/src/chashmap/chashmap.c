@@ -0,0 +1,417 @@
+#include "../sp_chashmap.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_chashmap *sp_chashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t nshards, size_t (*hash)(const void*), int (*cmp)(const void*, const void*))
+{
+	struct sp_chashmap *ret;
+	size_t n, i;
+	unsigned bits;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (val_size == 0) {
+		error(("val_size cannot be 0"));
+		return NULL;
+	}
+	/*. C_ERR_CAPACITY_ZERO */
+	if (nshards == 0) {
+		error(("nshards cannot be 0"));
+		return NULL;
+	}
+#endif
+#ifndef SP_ATOMICS
+	error(("atomic operations are not supported by this compiler"));
+	return NULL;
+#endif
+	if (nshards > SP_SIZE_MAX / 2 / sizeof(*ret->shards)) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+	for (n = 1, bits = 0; n < nshards; n *= 2, bits++);
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	ret->shards = malloc(n * sizeof(*ret->shards));
+	if (ret->shards == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret);
+		return NULL;
+	}
+
+	/* The capacity is spread evenly across all shards */
+	capacity = capacity / n + (capacity % n != 0);
+	for (i = 0; i < n; i++) {
+		struct sp_chashmap_shard *const shard = ret->shards + i;
+		shard->table = sp_hashmap_create(key_size, val_size, capacity, hash, cmp);
+		if (shard->table == NULL) {
+			while (i-- > 0)
+				sp_hashmap_destroy(ret->shards[i].table, NULL, NULL);
+			free(ret->shards);
+			free(ret);
+			return NULL;
+		}
+		shard->retired    = NULL;
+		shard->nretired   = 0;
+		shard->epoch      = 0;
+		shard->readers[0] = 0;
+		shard->readers[1] = 0;
+		shard->seq        = 0;
+		shard->lock       = 0;
+	}
+	ret->nshards     = n;
+	ret->shard_shift = bits ? SP_WORD_BIT - bits : SP_WORD_BIT - 1;
+	ret->key_size    = key_size;
+	ret->val_size    = val_size;
+	ret->hash        = hash;
+	ret->cmp         = cmp;
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_chashmap_clear(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		int err;
+		SP_LOCK(&shard->lock);
+		SP_SEQ_BEGIN(&shard->seq);
+		err = sp_hashmap_clear(shard->table, kdtor, vdtor);
+		SP_SEQ_END(&shard->seq);
+		SP_UNLOCK(&shard->lock);
+		if (err)
+			return err;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_chashmap_destroy(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t i, j;
+	int error;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	if ((error = sp_chashmap_clear(map, kdtor, vdtor)))
+		return error;
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		sp_hashmap_destroy(shard->table, NULL, NULL);
+		for (j = 0; j < shard->nretired; j++)
+			sp_hashmap_destroy(shard->retired[j].table, NULL, NULL);
+		free(shard->retired);
+	}
+	free(map->shards);
+	free(map);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_chashmap_size(const struct sp_chashmap *map)
+{
+	size_t i, ret = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map 0 */
+#endif
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		const struct sp_hashmap *tab;
+		unsigned long epoch;
+		SP_EPOCH_ENTER(shard, epoch);
+		tab = SP_LOAD_ACQUIRE(&shard->table);
+		ret += SP_LOAD_RELAXED(&tab->size);
+		SP_EPOCH_LEAVE(shard, epoch);
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_chashmap_map(struct sp_chashmap *map, int (*func)(const void*, void*))
+{
+	size_t i, j;
+	void *tmp;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	tmp = malloc(map->val_size);
+	if (tmp == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	/* func works on a copy of each value, so that readers only have to wait
+	 * while a value which has actually changed is written back */
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		struct sp_hashmap *tab;
+		SP_LOCK(&shard->lock);
+		tab = shard->table;
+		for (j = 0; j < tab->capacity; j++) {
+			void *const val = SP_HASHTAB_VAL(tab, j);
+			int err;
+			if (tab->ctrl[j] & 0x80)
+				continue;
+			memcpy(tmp, val, map->val_size);
+			err = func(SP_HASHTAB_KEY(tab, j), tmp);
+			if (memcmp(tmp, val, map->val_size)) {
+				SP_SEQ_BEGIN(&shard->seq);
+				memcpy(val, tmp, map->val_size);
+				SP_SEQ_END(&shard->seq);
+			}
+			if (err) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				SP_UNLOCK(&shard->lock);
+				free(tmp);
+				return SP_ECALLBK;
+			}
+		}
+		SP_UNLOCK(&shard->lock);
+	}
+	free(tmp);
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_chashmap_insert(struct sp_chashmap *map, const void *key, const void *val)
+{
+	struct sp_chashmap_shard *shard;
+	struct sp_hashmap *tab;
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+#endif
+	hash  = SP_HASH(map, key);
+	shard = SP_CHASHMAP_SHARD(map, hash);
+	SP_LOCK(&shard->lock);
+	tab = shard->table;
+	idx = sp_hashtab_find(tab, key, hash);
+	if (idx == tab->capacity) {
+		if ((err = sp_chashtab_reserve(shard, hash))) {
+			SP_UNLOCK(&shard->lock);
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		}
+		tab = shard->table;
+		SP_SEQ_BEGIN(&shard->seq);
+		sp_hashtab_claim(tab, hash, &idx);
+		memcpy(SP_HASHTAB_KEY(tab, idx), key, map->key_size);
+	} else {
+		SP_SEQ_BEGIN(&shard->seq);
+	}
+	memcpy(SP_HASHTAB_VAL(tab, idx), val, map->val_size);
+	SP_SEQ_END(&shard->seq);
+	if (shard->nretired != 0)
+		sp_chashtab_reclaim(shard);
+	SP_UNLOCK(&shard->lock);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_chashmap_insert$SUFFIX$(struct sp_chashmap *map, $TYPE$ key, const void *val)
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Keys are compared bytewise, so padding bits must be zeroed */
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_chashmap_insert(map, &k, val);
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_chashmap_get(const struct sp_chashmap *map, const void *key, void *val)
+{
+	struct sp_chashmap_shard *shard;
+	unsigned long epoch;
+	size_t hash;
+	int ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+#endif
+	hash  = SP_HASH(map, key);
+	shard = SP_CHASHMAP_SHARD(map, hash);
+
+	/* Readers never write to the shard's table. Instead, they retry if a
+	 * writer has modified the shard in the meantime. */
+	SP_EPOCH_ENTER(shard, epoch);
+	for (;;) {
+		const unsigned long seq = SP_LOAD_ACQUIRE(&shard->seq);
+		const struct sp_hashmap *tab;
+		size_t idx;
+		if (seq & 1)
+			continue;
+		tab = SP_LOAD_ACQUIRE(&shard->table);
+		idx = sp_hashtab_find(tab, key, hash);
+		if (idx != tab->capacity && val != NULL)
+			memcpy(val, SP_HASHTAB_VAL(tab, idx), map->val_size);
+		SP_FENCE_ACQUIRE();
+		if (SP_LOAD_RELAXED(&shard->seq) == seq) {
+			ret = idx == tab->capacity ? SP_ENOKEY : 0;
+			break;
+		}
+	}
+	SP_EPOCH_LEAVE(shard, epoch);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_chashmap_get$SUFFIX$(const struct sp_chashmap *map, $TYPE$ key, void *val)
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_chashmap_get(map, &k, val);
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_chashmap_remove(struct sp_chashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_chashmap_shard *shard;
+	struct sp_hashmap *tab;
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+#endif
+	hash  = SP_HASH(map, key);
+	shard = SP_CHASHMAP_SHARD(map, hash);
+	SP_LOCK(&shard->lock);
+	tab = shard->table;
+	idx = sp_hashtab_find(tab, key, hash);
+	if (idx == tab->capacity) {
+		SP_UNLOCK(&shard->lock);
+		return SP_ENOKEY;
+	}
+	if (kdtor != NULL && (err = kdtor(SP_HASHTAB_KEY(tab, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+		SP_UNLOCK(&shard->lock);
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_HASHTAB_VAL(tab, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+		SP_UNLOCK(&shard->lock);
+		return SP_ECALLBK;
+	}
+	SP_SEQ_BEGIN(&shard->seq);
+	sp_hashtab_erase(tab, idx);
+	SP_SEQ_END(&shard->seq);
+	if (shard->nretired != 0)
+		sp_chashtab_reclaim(shard);
+	SP_UNLOCK(&shard->lock);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_chashmap_remove$SUFFIX$(struct sp_chashmap *map, $TYPE$ key, int (*dtor)(void*))
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_chashmap_remove(map, &k, NULL, dtor);
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_chashmap_print(const struct sp_chashmap *map, int (*func)(const void*, const void*))
+{
+	size_t i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	printf("sp_chashmap_print()\nshards: "SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)map->nshards, (SP_SIZE_T)map->key_size, (SP_SIZE_T)map->val_size);
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		const struct sp_hashmap *tab;
+		SP_LOCK(&shard->lock);
+		tab = shard->table;
+		printf("shard "SP_SIZE_FMT", size/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT"\n",
+			(SP_SIZE_T)i, (SP_SIZE_T)tab->size, (SP_SIZE_T)tab->capacity);
+		for (j = 0; j < tab->capacity; j++) {
+			const void *const key = SP_HASHTAB_KEY(tab, j),
+			           *const val = SP_HASHTAB_VAL(tab, j);
+			int err;
+			if (tab->ctrl[j] & 0x80)
+				continue;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)j);
+			if (func == NULL)
+				printf("%p\t%p\n", key, val);
+			else if ((err = func(key, val))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				SP_UNLOCK(&shard->lock);
+				return SP_ECALLBK;
+			}
+		}
+		SP_UNLOCK(&shard->lock);
+	}
+	return 0;
+}
+/*F}*/
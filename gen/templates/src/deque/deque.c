@@ -0,0 +1,1196 @@
+#include "../sp_deque.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_deque *sp_deque_create(size_t elem_size, size_t block_size)
+{
+	struct sp_deque *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	if (block_size == 0) {
+		error(("block_size cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (block_size > SP_SIZE_MAX / elem_size) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->elem_size  = elem_size;
+	ret->size       = 0;
+	ret->block_size = block_size;
+	ret->nblocks    = 1;
+	ret->head       = block_size / 2;
+	ret->blocks     = malloc(sizeof(*ret->blocks));
+	if (ret->blocks == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret);
+		return NULL;
+	}
+	ret->blocks[0] = malloc(block_size * elem_size);
+	if (ret->blocks[0] == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret->blocks);
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_clear(struct sp_deque *deque, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+#endif
+	if (dtor != NULL)
+		while (deque->size != 0) {
+			int err;
+			if ((err = dtor(sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+			++deque->head;
+			--deque->size;
+		}
+	deque->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_destroy(struct sp_deque *deque, int (*dtor)(void*))
+{
+	int error;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+#endif
+	if ((error = sp_deque_clear(deque, dtor)))
+		return error;
+	for (i = 0; i < deque->nblocks; i++)
+		free(deque->blocks[i]);
+	free(deque->blocks);
+	free(deque);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_deque_eq(const struct sp_deque *deque1, const struct sp_deque *deque2, int (*cmp)(const void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque1 0 */
+	/*. C_ERR_NULLPTR deque2 0 */
+#endif
+	if (deque1->elem_size != deque2->elem_size || deque1->size != deque2->size)
+		return 0;
+	if (cmp) {
+		for (i = 0; i < deque1->size; i++) {
+			const void *const p = sp_blockbuf_get(i, deque1->blocks, deque1->head, deque1->block_size, deque1->elem_size),
+			           *const q = sp_blockbuf_get(i, deque2->blocks, deque2->head, deque2->block_size, deque2->elem_size);
+			if (cmp(p, q))
+				return 0;
+		}
+		return 1;
+	}
+	/* Compare the largest slices of memory contiguous in both deques */
+	i = 0;
+	while (i != deque1->size) {
+		const size_t left1 = deque1->block_size - (deque1->head + i) % deque1->block_size,
+		             left2 = deque2->block_size - (deque2->head + i) % deque2->block_size,
+		             len   = MIN(MIN(left1, left2), deque1->size - i);
+		const void *const p = sp_blockbuf_get(i, deque1->blocks, deque1->head, deque1->block_size, deque1->elem_size),
+		           *const q = sp_blockbuf_get(i, deque2->blocks, deque2->head, deque2->block_size, deque2->elem_size);
+		if (memcmp(p, q, len * deque1->elem_size))
+			return 0;
+		i += len;
+	}
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_copy(struct sp_deque *dest, const struct sp_deque *src, int (*cpy)(void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+#endif
+	/* Spare blocks of dest are too small to be reused for larger elements */
+	if (dest->elem_size < src->elem_size)
+		for (i = 0; i < dest->nblocks; i++) {
+			free(dest->blocks[i]);
+			dest->blocks[i] = NULL;
+		}
+	dest->elem_size = src->elem_size;
+	dest->size      = 0;
+	for (i = 0; i < src->size; i++) {
+		const void *const s = sp_blockbuf_get(i, src->blocks, src->head, src->block_size, src->elem_size);
+		void *d;
+		if (sp_blockbuf_fit(&dest->blocks, &dest->nblocks, &dest->head, dest->size, dest->block_size, dest->elem_size, 0))
+			return SP_ENOMEM;
+		d = sp_blockbuf_get(dest->size, dest->blocks, dest->head, dest->block_size, dest->elem_size);
+		if (cpy == NULL) {
+			memcpy(d, s, src->elem_size);
+		} else {
+			int err;
+			if ((err = cpy(d, s))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO cpy err */
+				return SP_ECALLBK;
+			}
+		}
+		++dest->size;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_map(struct sp_deque *deque, int (*func)(void*, size_t))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	i = 0;
+	while (i != deque->size) {
+		char *p = sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+		size_t len = MIN(deque->block_size - (deque->head + i) % deque->block_size, deque->size - i);
+		while (len != 0) {
+			int err;
+			if ((err = func(p, i))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				return SP_ECALLBK;
+			}
+			p += deque->elem_size;
+			++i;
+			--len;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_pushfront(struct sp_deque *deque, const void *elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 1))
+		return SP_ENOMEM;
+	--deque->head;
+	memcpy(sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size), elem, deque->elem_size);
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_pushfront$SUFFIX$(struct sp_deque *deque, $TYPE$ elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 1))
+		return SP_ENOMEM;
+	--deque->head;
+	*($TYPE$*)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size) = elem;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_pushfrontstr(struct sp_deque *deque, const char *elem)
+{
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 1))
+		return SP_ENOMEM;
+	len = sp_strnlen(elem, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	--deque->head;
+	*(char**)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size) = buf;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_pushfrontstrn(struct sp_deque *deque, const char *elem, size_t len)
+{
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 1))
+		return SP_ENOMEM;
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	--deque->head;
+	*(char**)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size) = buf;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_pushback(struct sp_deque *deque, const void *elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	memcpy(sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size), elem, deque->elem_size);
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_pushback$SUFFIX$(struct sp_deque *deque, $TYPE$ elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	*($TYPE$*)sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size) = elem;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_pushbackstr(struct sp_deque *deque, const char *elem)
+{
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	len = sp_strnlen(elem, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	*(char**)sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size) = buf;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_pushbackstrn(struct sp_deque *deque, const char *elem, size_t len)
+{
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	*(char**)sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size) = buf;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_insert(struct sp_deque *deque, size_t idx, const void *elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, idx < deque->size / 2))
+		return SP_ENOMEM;
+	sp_blockbuf_insert(elem, idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_insert$SUFFIX$(struct sp_deque *deque, size_t idx, $TYPE$ elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, idx < deque->size / 2))
+		return SP_ENOMEM;
+	sp_blockbuf_insert(&elem, idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_insertstr(struct sp_deque *deque, size_t idx, const char *elem)
+{
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, idx < deque->size / 2))
+		return SP_ENOMEM;
+	len = sp_strnlen(elem, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	sp_blockbuf_insert(&buf, idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_insertstrn(struct sp_deque *deque, size_t idx, const char *elem, size_t len)
+{
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, idx < deque->size / 2))
+		return SP_ENOMEM;
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	sp_blockbuf_insert(&buf, idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_qinsert(struct sp_deque *deque, size_t idx, const void *elem)
+{
+	void *p, *q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	q = sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	memcpy(q, p, deque->elem_size);
+	memcpy(p, elem, deque->elem_size);
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_qinsert$SUFFIX$(struct sp_deque *deque, size_t idx, $TYPE$ elem)
+{
+	void *p, *q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	q = sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	*($TYPE$*)q = *($TYPE$*)p;
+	*($TYPE$*)p = elem;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_qinsertstr(struct sp_deque *deque, size_t idx, const char *elem)
+{
+	void *p, *q;
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	len = sp_strnlen(elem, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	q = sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	*(char**)q = *(char**)p;
+	*(char**)p = buf;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_qinsertstrn(struct sp_deque *deque, size_t idx, const char *elem, size_t len)
+{
+	void *p, *q;
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque elem SP_EILLEGAL */
+	if (idx > deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, 0))
+		return SP_ENOMEM;
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	q = sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	*(char**)q = *(char**)p;
+	*(char**)p = buf;
+	++deque->size;
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+void *sp_deque_peekfront(const struct sp_deque *deque)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return NULL;
+	}
+#endif
+	return sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_peekfront$SUFFIX$(const struct sp_deque *deque)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return 0;
+	}
+#endif
+	return *($TYPE$*)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_peekfrontstr(const struct sp_deque *deque)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return NULL;
+	}
+#endif
+	return *(char**)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+
+/*F{*/
+void *sp_deque_peekback(const struct sp_deque *deque)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return NULL;
+	}
+#endif
+	return sp_blockbuf_get(deque->size - 1, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_peekback$SUFFIX$(const struct sp_deque *deque)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return 0;
+	}
+#endif
+	return *($TYPE$*)sp_blockbuf_get(deque->size - 1, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_peekbackstr(const struct sp_deque *deque)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return NULL;
+	}
+#endif
+	return *(char**)sp_blockbuf_get(deque->size - 1, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_popfront(struct sp_deque *deque, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	++deque->head;
+	--deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_popfront$SUFFIX$(struct sp_deque *deque)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return 0;
+	}
+#endif
+	ret = *($TYPE$*)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	++deque->head;
+	--deque->size;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_popfrontstr(struct sp_deque *deque)
+{
+	char *ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return NULL;
+	}
+#endif
+	ret = *(char**)sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	++deque->head;
+	--deque->size;
+	return ret;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_popback(struct sp_deque *deque, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(sp_blockbuf_get(deque->size - 1, deque->blocks, deque->head, deque->block_size, deque->elem_size)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	--deque->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_popback$SUFFIX$(struct sp_deque *deque)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return 0;
+	}
+#endif
+	ret = *($TYPE$*)sp_blockbuf_get(deque->size - 1, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	--deque->size;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_popbackstr(struct sp_deque *deque)
+{
+	char *ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (deque->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY deque */
+		return NULL;
+	}
+#endif
+	ret = *(char**)sp_blockbuf_get(deque->size - 1, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	--deque->size;
+	return ret;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_remove(struct sp_deque *deque, size_t idx, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_blockbuf_remove(idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_remove$SUFFIX$(struct sp_deque *deque, size_t idx)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	ret = *($TYPE$*)sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	sp_blockbuf_remove(idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_removestr(struct sp_deque *deque, size_t idx)
+{
+	char *ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	ret = *(char**)sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	sp_blockbuf_remove(idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return ret;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_qremove(struct sp_deque *deque, size_t idx, int (*dtor)(void*))
+{
+	void *p;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	if (dtor != NULL && (err = dtor(p))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	--deque->size;
+	memcpy(p, sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size), deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_qremove$SUFFIX$(struct sp_deque *deque, size_t idx)
+{
+	$TYPE$ *p;
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	ret = *p;
+	--deque->size;
+	*p = *($TYPE$*)sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_qremovestr(struct sp_deque *deque, size_t idx)
+{
+	char **p;
+	char *ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	ret = *p;
+	--deque->size;
+	*p = *(char**)sp_blockbuf_get(deque->size, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	return ret;
+}
+/*F}*/
+
+
+/*F{*/
+void *sp_deque_get(const struct sp_deque *deque, size_t idx)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	return sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_deque_get$SUFFIX$(const struct sp_deque *deque, size_t idx)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ 0 */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	return *($TYPE$*)sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+char *sp_deque_getstr(const struct sp_deque *deque, size_t idx)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* NULL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	return *(char**)sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_set(struct sp_deque *deque, size_t idx, void *val)
+{
+	char *p;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	memcpy(p, val, deque->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_set$SUFFIX$(struct sp_deque *deque, size_t idx, $TYPE$ val)
+{
+	char *p;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque val SP_EILLEGAL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	*($TYPE$*)p = val;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_setstr(struct sp_deque *deque, size_t idx, const char *val)
+{
+	char *p;
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque val SP_EILLEGAL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	free(*(char**)p);
+	len = sp_strnlen(val, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*val));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, val, len * sizeof(*val));
+	buf[len] = '\0';
+	*(char**)p = buf;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_deque_setstrn(struct sp_deque *deque, size_t idx, const char *val, size_t len)
+{
+	char *p;
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque val SP_EILLEGAL */
+	if (idx >= deque->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	p = sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+	free(*(char**)p);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*val));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, val, len * sizeof(*val));
+	buf[len] = '\0';
+	*(char**)p = buf;
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_print(const struct sp_deque *deque, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (deque == NULL) {
+		error(("deque is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_deque_print()\nsize: "SP_SIZE_FMT", block_size: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)deque->size, (SP_SIZE_T)deque->block_size, (SP_SIZE_T)deque->elem_size);
+	if (func == NULL)
+		for (i = 0; i < deque->size; i++) {
+			const void *const elem = sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+			printf("["SP_SIZE_FMT"]\t%p\n", (SP_SIZE_T)i, elem);
+		}
+	else
+		for (i = 0; i < deque->size; i++) {
+			const void *const elem = sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+			int err;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+			if ((err = func(elem)) != 0) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				return SP_ECALLBK;
+			}
+		}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_print$SUFFIX$(const struct sp_deque *deque)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_deque_print$SUFFIX$()\nsize: "SP_SIZE_FMT", block_size: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)deque->size, (SP_SIZE_T)deque->block_size, (SP_SIZE_T)deque->elem_size);
+	for (i = 0; i < deque->size; i++) {
+		const $TYPE$ elem = *($TYPE$*)sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+		printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)i, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_deque_printstr(const struct sp_deque *deque)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR deque SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE deque char* SP_EILLEGAL */
+#endif
+	printf("sp_deque_printstr()\nsize: "SP_SIZE_FMT", block_size: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)deque->size, (SP_SIZE_T)deque->block_size, (SP_SIZE_T)deque->elem_size);
+	for (i = 0; i < deque->size; i++) {
+		const char *const elem = *(char**)sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+		printf("["SP_SIZE_FMT"]\t%s\n", (SP_SIZE_T)i, elem);
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,247 @@
+#include "../sp_fenwick.h"
+#include "../internal.h"
+
+/*F{*/
+#include <string.h>
+struct sp_fenwick *sp_fenwick_create(size_t elem_size, size_t size)
+{
+	struct sp_fenwick *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	if (size == 0) {
+		error(("size cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (size > SP_SIZE_MAX / elem_size) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = size;
+	ret->data      = malloc(size * elem_size);
+	if (ret->data == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret);
+		return NULL;
+	}
+	memset(ret->data, 0, size * elem_size);
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_fenwick_clear(struct sp_fenwick *fw)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw SP_EINVAL */
+#endif
+	memset(fw->data, 0, fw->size * fw->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_fenwick_destroy(struct sp_fenwick *fw)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw SP_EINVAL */
+#endif
+	free(fw->data);
+	free(fw);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_fenwick_build$SUFFIX$(struct sp_fenwick *fw, const $TYPE$ *vals)
+{
+	$TYPE$ *t;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw SP_EINVAL */
+	/*. C_ERR_NULLPTR vals SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw $TYPE$ SP_EILLEGAL */
+#endif
+	t = fw->data;
+	for (i = 0; i < fw->size; i++)
+		t[i] = vals[i];
+	/* Every node passes its total on to its parent, in one sweep */
+	for (i = 1; i <= fw->size; i++) {
+		const size_t j = i + SP_FENWICK_LOWBIT(i);
+		if (j <= fw->size)
+			t[j - 1] += t[i - 1];
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_fenwick_add$SUFFIX$(struct sp_fenwick *fw, size_t idx, $TYPE$ delta)
+{
+	$TYPE$ *t;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw delta SP_EILLEGAL */
+	if (idx >= fw->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	t = fw->data;
+	for (i = idx + 1; i <= fw->size; i += SP_FENWICK_LOWBIT(i))
+		t[i - 1] += delta;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_fenwick_set$SUFFIX$(struct sp_fenwick *fw, size_t idx, $TYPE$ val)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw val SP_EILLEGAL */
+	if (idx >= fw->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	return sp_fenwick_add$SUFFIX$(fw, idx, ($TYPE$)(val - sp_fenwick_get$SUFFIX$(fw, idx)));
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_fenwick_get$SUFFIX$(const struct sp_fenwick *fw, size_t idx)
+{
+	const $TYPE$ *t;
+	$TYPE$ ret;
+	size_t i, stop;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw $TYPE$ 0 */
+	if (idx >= fw->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	t = fw->data;
+	/* Node idx + 1 covers (stop, idx + 1], so take away everything in
+	 * (stop, idx], which its children cover */
+	ret  = t[idx];
+	stop = idx + 1 - SP_FENWICK_LOWBIT(idx + 1);
+	for (i = idx; i > stop; i -= SP_FENWICK_LOWBIT(i))
+		ret -= t[i - 1];
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_fenwick_prefix$SUFFIX$(const struct sp_fenwick *fw, size_t n)
+{
+	const $TYPE$ *t;
+	$TYPE$ ret = 0;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw $TYPE$ 0 */
+	if (n > fw->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	t = fw->data;
+	for (i = n; i > 0; i -= SP_FENWICK_LOWBIT(i))
+		ret += t[i - 1];
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_fenwick_sum$SUFFIX$(const struct sp_fenwick *fw, size_t idx, size_t n)
+{
+	const $TYPE$ *t;
+	$TYPE$ ret = 0;
+	size_t hi, lo;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw $TYPE$ 0 */
+	if (idx > fw->size || n > fw->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	t = fw->data;
+	/* Both prefixes share the nodes above their common ancestor, which
+	 * are skipped rather than added and taken away again */
+	hi = idx + n;
+	lo = idx;
+	while (hi > lo) {
+		ret += t[hi - 1];
+		hi  -= SP_FENWICK_LOWBIT(hi);
+	}
+	while (lo > hi) {
+		ret -= t[lo - 1];
+		lo  -= SP_FENWICK_LOWBIT(lo);
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+size_t sp_fenwick_lowerbound$SUFFIX$(const struct sp_fenwick *fw, $TYPE$ target)
+{
+	const $TYPE$ *t;
+	size_t pos = 0, step = 1;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw target 0 */
+#endif
+	t = fw->data;
+	while (step <= fw->size / 2)
+		step *= 2;
+	/* Descend from the largest node, keeping pos at the longest prefix
+	 * whose sum is still below target */
+	for (; step > 0; step /= 2) {
+		if (pos + step <= fw->size && t[pos + step - 1] < target) {
+			pos   += step;
+			target = ($TYPE$)(target - t[pos - 1]);
+		}
+	}
+	return pos;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_fenwick_print$SUFFIX$(const struct sp_fenwick *fw)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR fw SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE fw $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_fenwick_print$SUFFIX$()\nsize: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)fw->size, (SP_SIZE_T)fw->elem_size);
+	for (i = 0; i < fw->size; i++) {
+		const $TYPE$ elem = sp_fenwick_get$SUFFIX$(fw, i);
+		printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)i, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
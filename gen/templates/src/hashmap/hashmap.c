@@ -0,0 +1,419 @@
+#include "../sp_hashmap.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_hashmap *sp_hashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t (*hash)(const void*), int (*cmp)(const void*, const void*))
+{
+	struct sp_hashmap *ret;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (val_size == 0) {
+		error(("val_size cannot be 0"));
+		return NULL;
+	}
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (key_size > SP_SIZE_MAX / 2 - 16 || val_size > SP_SIZE_MAX / 2 - 16) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Keys and values are stored next to each other in a single slot. Both
+	 * are padded to keep them aligned for any type of their size. */
+	ret->ctrl        = NULL;
+	ret->slots       = NULL;
+	ret->key_size    = key_size;
+	ret->val_size    = val_size;
+	ret->val_offset  = (key_size + SP_ALIGNOF_SIZE(val_size) - 1) / SP_ALIGNOF_SIZE(val_size) * SP_ALIGNOF_SIZE(val_size);
+	ret->slot_size   = MAX(SP_ALIGNOF_SIZE(key_size), SP_ALIGNOF_SIZE(val_size));
+	ret->slot_size   = (ret->val_offset + val_size + ret->slot_size - 1) / ret->slot_size * ret->slot_size;
+	ret->size        = 0;
+	ret->capacity    = 0;
+	ret->growth_left = 0;
+	ret->hash        = hash;
+	ret->cmp         = cmp;
+	if (sp_hashtab_fit(ret, capacity)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_hashmap_clear(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	if (kdtor != NULL || vdtor != NULL)
+		for (i = 0; i < map->capacity && map->size != 0; i++) {
+			int err;
+			if (map->ctrl[i] & 0x80)
+				continue;
+			if (kdtor != NULL && (err = kdtor(SP_HASHTAB_KEY(map, i)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+				return SP_ECALLBK;
+			}
+			if (vdtor != NULL && (err = vdtor(SP_HASHTAB_VAL(map, i)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+				return SP_ECALLBK;
+			}
+			sp_hashtab_erase(map, i);
+		}
+	memset(map->ctrl, SP_CTRL_EMPTY, map->capacity);
+	map->size        = 0;
+	map->growth_left = SP_HASHTAB_FILL(map->capacity);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_hashmap_destroy(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	int error;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	if ((error = sp_hashmap_clear(map, kdtor, vdtor)))
+		return error;
+	free(map->ctrl);
+	free(map->slots);
+	free(map);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_hashmap_reserve(struct sp_hashmap *map, size_t n)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	if ((err = sp_hashtab_fit(map, MAX(n, map->size))))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_hashmap_eq(const struct sp_hashmap *map1, const struct sp_hashmap *map2, int (*cmp)(const void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map1 0 */
+	/*. C_ERR_NULLPTR map2 0 */
+#endif
+	if (map1->key_size != map2->key_size || map1->val_size != map2->val_size || map1->size != map2->size)
+		return 0;
+	for (i = 0; i < map1->capacity; i++) {
+		const char *const key = SP_HASHTAB_KEY(map1, i),
+		           *const v1  = SP_HASHTAB_VAL(map1, i);
+		const char *v2;
+		size_t j;
+		if (map1->ctrl[i] & 0x80)
+			continue;
+		j = sp_hashtab_find(map2, key, SP_HASH(map2, key));
+		if (j == map2->capacity)
+			return 0;
+		v2 = SP_HASHTAB_VAL(map2, j);
+		if (cmp ? cmp(v1, v2) : memcmp(v1, v2, map1->val_size))
+			return 0;
+	}
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_hashmap_copy(struct sp_hashmap *dest, const struct sp_hashmap *src, int (*kcpy)(void*, const void*), int (*vcpy)(void*, const void*))
+{
+	unsigned char *ctrl;
+	void *slots;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+#endif
+	ctrl  = malloc(src->capacity);
+	slots = malloc(src->capacity * src->slot_size);
+	if (ctrl == NULL || slots == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ctrl);
+		free(slots);
+		return SP_ENOMEM;
+	}
+	free(dest->ctrl);
+	free(dest->slots);
+	dest->ctrl        = ctrl;
+	dest->slots       = slots;
+	dest->key_size    = src->key_size;
+	dest->val_size    = src->val_size;
+	dest->val_offset  = src->val_offset;
+	dest->slot_size   = src->slot_size;
+	dest->size        = src->size;
+	dest->capacity    = src->capacity;
+	dest->growth_left = src->growth_left;
+	dest->hash        = src->hash;
+	dest->cmp         = src->cmp;
+
+	/* Same capacity and hash function, so every element keeps its slot */
+	memcpy(dest->ctrl, src->ctrl, src->capacity);
+	if (kcpy == NULL && vcpy == NULL) {
+		memcpy(dest->slots, src->slots, src->capacity * src->slot_size);
+		return 0;
+	}
+	for (i = 0; i < src->capacity; i++) {
+		char *const dk = SP_HASHTAB_KEY(dest, i),
+		     *const dv = SP_HASHTAB_VAL(dest, i);
+		const char *const sk = SP_HASHTAB_KEY(src, i),
+		           *const sv = SP_HASHTAB_VAL(src, i);
+		int err = 0;
+		if (src->ctrl[i] & 0x80)
+			continue;
+		if (kcpy == NULL)
+			memcpy(dk, sk, src->key_size);
+		else if ((err = kcpy(dk, sk))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO kcpy err */
+		}
+		if (err == 0) {
+			if (vcpy == NULL)
+				memcpy(dv, sv, src->val_size);
+			else if ((err = vcpy(dv, sv))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO vcpy err */
+			}
+		}
+		if (err) {
+			/* Turn all slots which were not copied into tombstones */
+			for (; i < dest->capacity; i++)
+				if (!(dest->ctrl[i] & 0x80)) {
+					dest->ctrl[i] = SP_CTRL_DELETED;
+					--dest->size;
+				}
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_hashmap_map(struct sp_hashmap *map, int (*func)(const void*, void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	for (i = 0; i < map->capacity; i++) {
+		int err;
+		if (map->ctrl[i] & 0x80)
+			continue;
+		if ((err = func(SP_HASHTAB_KEY(map, i), SP_HASHTAB_VAL(map, i)))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_hashmap_insert(struct sp_hashmap *map, const void *key, const void *val)
+{
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+#endif
+	hash = SP_HASH(map, key);
+	idx  = sp_hashtab_find(map, key, hash);
+	if (idx == map->capacity) {
+		if ((err = sp_hashtab_claim(map, hash, &idx)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		memcpy(SP_HASHTAB_KEY(map, idx), key, map->key_size);
+	}
+	memcpy(SP_HASHTAB_VAL(map, idx), val, map->val_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_hashmap_insert$SUFFIX$(struct sp_hashmap *map, $TYPE$ key, const void *val)
+{
+	$TYPE$ k;
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Keys are compared bytewise, so padding bits must be zeroed */
+	memset(&k, 0, sizeof(k));
+	k    = key;
+	SP_HASH_FIXED(hash, map, &k, sizeof(k));
+	SP_HASHTAB_PROBE(idx, map, &k, sizeof(k), hash);
+	if (idx == map->capacity) {
+		if ((err = sp_hashtab_claim(map, hash, &idx)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		memcpy(SP_HASHTAB_KEY(map, idx), &k, sizeof(k));
+	}
+	memcpy(SP_HASHTAB_VAL(map, idx), val, map->val_size);
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+void *sp_hashmap_get(const struct sp_hashmap *map, const void *key)
+{
+	size_t idx;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map NULL */
+	/*. C_ERR_NULLPTR key NULL */
+#endif
+	idx = sp_hashtab_find(map, key, SP_HASH(map, key));
+	return idx == map->capacity ? NULL : SP_HASHTAB_VAL(map, idx);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_hashmap_get$SUFFIX$(const struct sp_hashmap *map, $TYPE$ key)
+{
+	$TYPE$ k;
+	size_t hash, idx;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map NULL */
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	SP_HASH_FIXED(hash, map, &k, sizeof(k));
+	SP_HASHTAB_PROBE(idx, map, &k, sizeof(k), hash);
+	return idx == map->capacity ? NULL : SP_HASHTAB_VAL(map, idx);
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_hashmap_remove(struct sp_hashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+#endif
+	idx = sp_hashtab_find(map, key, SP_HASH(map, key));
+	if (idx == map->capacity)
+		return SP_ENOKEY;
+	if (kdtor != NULL && (err = kdtor(SP_HASHTAB_KEY(map, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_HASHTAB_VAL(map, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+		return SP_ECALLBK;
+	}
+	sp_hashtab_erase(map, idx);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_hashmap_remove$SUFFIX$(struct sp_hashmap *map, $TYPE$ key, int (*dtor)(void*))
+{
+	$TYPE$ k;
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	SP_HASH_FIXED(hash, map, &k, sizeof(k));
+	SP_HASHTAB_PROBE(idx, map, &k, sizeof(k), hash);
+	if (idx == map->capacity)
+		return SP_ENOKEY;
+	if (dtor != NULL && (err = dtor(SP_HASHTAB_VAL(map, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_hashtab_erase(map, idx);
+	return 0;
+}
+/*F}*/
+
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_hashmap_print(const struct sp_hashmap *map, int (*func)(const void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR map SP_EINVAL */
+#endif
+	printf("sp_hashmap_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)map->size, (SP_SIZE_T)map->capacity, (SP_SIZE_T)map->key_size, (SP_SIZE_T)map->val_size);
+	for (i = 0; i < map->capacity; i++) {
+		const void *const key = SP_HASHTAB_KEY(map, i),
+		           *const val = SP_HASHTAB_VAL(map, i);
+		int err;
+		if (map->ctrl[i] & 0x80)
+			continue;
+		printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+		if (func == NULL)
+			printf("%p\t%p\n", key, val);
+		else if ((err = func(key, val))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,217 @@
+#include "../sp_intern.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_intern *sp_intern_create(size_t capacity)
+{
+	struct sp_intern *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (capacity > SP_SIZE_MAX / sizeof(*ret->strs)) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* The index maps each string to its id. Its keys point into the arena,
+	 * so the strings themselves are never stored twice. */
+	ret->index = sp_hashmap_create(sizeof(struct sp_intern_str), sizeof(size_t), MAX(capacity, 1), sp_intern_hash, sp_intern_cmp);
+	if (ret->index == NULL) {
+		free(ret);
+		return NULL;
+	}
+	ret->size       = 0;
+	ret->capacity   = MAX(capacity, 1);
+	ret->blocks     = NULL;
+	ret->nblocks    = 0;
+	ret->block_size = 0;
+	ret->block_left = 0;
+	ret->strs       = malloc(ret->capacity * sizeof(*ret->strs));
+	if (ret->strs == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		sp_hashmap_destroy(ret->index, NULL, NULL);
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_intern_clear(struct sp_intern *pool)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	for (i = 0; i < pool->nblocks; i++)
+		free(pool->blocks[i]);
+	free(pool->blocks);
+	sp_hashmap_clear(pool->index, NULL, NULL);
+	pool->blocks     = NULL;
+	pool->nblocks    = 0;
+	pool->block_size = 0;
+	pool->block_left = 0;
+	pool->size       = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_intern_destroy(struct sp_intern *pool)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	sp_intern_clear(pool);
+	sp_hashmap_destroy(pool->index, NULL, NULL);
+	free(pool->strs);
+	free(pool);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_intern_add(struct sp_intern *pool, const char *str, size_t *id)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR str SP_EINVAL */
+#endif
+	return sp_intern_addn(pool, str, sp_strnlen(str, SP_SIZE_MAX), id);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_intern_addn(struct sp_intern *pool, const char *str, size_t len, size_t *id)
+{
+	struct sp_intern_str key;
+	size_t hash, i;
+	char *buf;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR str SP_EINVAL */
+#endif
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	key.str = str;
+	key.len = len;
+	hash = sp_hash(str, len);
+	i = sp_hashtab_find(pool->index, &key, hash);
+	if (i != pool->index->capacity) {
+		if (id != NULL)
+			*id = *(size_t*)SP_HASHTAB_VAL(pool->index, i);
+		return 0;
+	}
+
+	/* Make room everywhere first, so that a failure leaves the pool as it
+	 * was (save for a new arena block, which is only freed on clear) */
+	if (len + 1 > pool->block_left && (err = sp_intern_grow(pool, len + 1)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	if (sp_size_try_add(pool->size * sizeof(*pool->strs), sizeof(*pool->strs)))
+		return SP_ERANGE;
+	if (sp_buf_fit((void**)&pool->strs, pool->size, &pool->capacity, sizeof(*pool->strs)))
+		return SP_ENOMEM;
+	if ((err = sp_hashtab_claim(pool->index, hash, &i)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+
+	if (len + 1 > pool->block_left) {
+		/* The string got a block of its own, see sp_intern_grow */
+		buf = pool->blocks[pool->nblocks - 2];
+	} else {
+		buf = pool->blocks[pool->nblocks - 1] + (pool->block_size - pool->block_left);
+		pool->block_left -= len + 1;
+	}
+	memcpy(buf, str, len);
+	buf[len] = '\0';
+	key.str = buf;
+	memcpy(SP_HASHTAB_KEY(pool->index, i), &key, sizeof(key));
+	memcpy(SP_HASHTAB_VAL(pool->index, i), &pool->size, sizeof(pool->size));
+	pool->strs[pool->size] = key;
+	if (id != NULL)
+		*id = pool->size;
+	++pool->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_intern_find(const struct sp_intern *pool, const char *str, size_t *id)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR str SP_EINVAL */
+#endif
+	return sp_intern_findn(pool, str, sp_strnlen(str, SP_SIZE_MAX), id);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_intern_findn(const struct sp_intern *pool, const char *str, size_t len, size_t *id)
+{
+	struct sp_intern_str key;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR str SP_EINVAL */
+#endif
+	key.str = str;
+	key.len = len;
+	i = sp_hashtab_find(pool->index, &key, sp_hash(str, len));
+	if (i == pool->index->capacity)
+		return SP_ENOKEY;
+	if (id != NULL)
+		*id = *(size_t*)SP_HASHTAB_VAL(pool->index, i);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+const char *sp_intern_get(const struct sp_intern *pool, size_t id)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool NULL */
+	if (id >= pool->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	return pool->strs[id].str;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_intern_print(const struct sp_intern *pool)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	printf("sp_intern_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", blocks: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)pool->size, (SP_SIZE_T)pool->capacity, (SP_SIZE_T)pool->nblocks);
+	for (i = 0; i < pool->size; i++) {
+		printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+		fwrite(pool->strs[i].str, 1, pool->strs[i].len, stdout);
+		putchar('\n');
+	}
+	return 0;
+}
+/*F}*/
@@ -135,6 +135,98 @@ void *sp_ringbuf_get(size_t idx, const void *buf, size_t capacity, size_t elem_s
 }
 /*F}*/
 
+/*F{*/
+#include <string.h>
+/* Shift n consecutive ring buffer elements, the first of which resides at
+ * physical index start, one slot to the left. The slot preceding start must be
+ * unoccupied. Rather than moving the elements one at a time, the range is split
+ * into at most 3 contiguous spans:
+ * 	(1)	_ _ _ _ _ 1 2 3	the elements up to the end of the buffer,
+ * 	(2)	4 _ _ _ _ _ _ _	the element that wraps from index 0 to the end,
+ * 	(3)	_ 5 6 7 _ _ _ _	the remaining elements after index 0.
+ */
+void sp_ringbuf_shl(void *buf, size_t capacity, size_t elem_size, size_t start, size_t n)
+{
+	char *const p = buf;
+	if (n == 0)
+		return;
+	if (start != 0) {
+		const size_t len = MIN(n, capacity - start);
+		memmove(p + (start - 1) * elem_size, p + start * elem_size, len * elem_size);
+		if ((n -= len) == 0)
+			return;
+	}
+	memcpy(p + (capacity - 1) * elem_size, p, elem_size);
+	memmove(p, p + elem_size, (n - 1) * elem_size);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Shift n consecutive ring buffer elements, the first of which resides at
+ * physical index start, one slot to the right. The slot following the last
+ * element must be unoccupied. This is the mirror image of sp_ringbuf_shl, the
+ * spans are processed in reverse order.
+ */
+void sp_ringbuf_shr(void *buf, size_t capacity, size_t elem_size, size_t start, size_t n)
+{
+	char *const p = buf;
+	if (n == 0)
+		return;
+	if (n > capacity - start) {
+		const size_t len = n - (capacity - start);
+		memmove(p + elem_size, p, len * elem_size);
+		n -= len;
+	}
+	if (n == capacity - start) {
+		memcpy(p, p + (capacity - 1) * elem_size, elem_size);
+		--n;
+	}
+	memmove(p + (start + 1) * elem_size, p + start * elem_size, n * elem_size);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Move n consecutive ring buffer elements from physical index from to physical
+ * index to, with the semantics of memmove. Both ranges may wrap around, so the
+ * copy is split into at most 3 contiguous spans at the points where either of
+ * them reaches the end of the buffer. When the destination starts at least n
+ * slots ahead of the source the spans are copied front to back, otherwise back
+ * to front, so no element is overwritten before it has been read. The
+ * destination may overlap the beginning or the end of the source, not both.
+ */
+void sp_ringbuf_move(void *buf, size_t capacity, size_t elem_size, size_t to, size_t from, size_t n)
+{
+	char *const p = buf;
+	size_t len;
+	if (n == 0 || to == from)
+		return;
+	if ((to < from ? to + (capacity - from) : to - from) >= n) {
+		while (n != 0) {
+			len = MIN(n, MIN(capacity - from, capacity - to));
+			memmove(p + to * elem_size, p + from * elem_size, len * elem_size);
+			from = from + len == capacity ? 0 : from + len;
+			to   = to + len == capacity ? 0 : to + len;
+			n -= len;
+		}
+	} else {
+		/* Work from one past the last element of either range */
+		from = n > capacity - from ? n - (capacity - from) : from + n;
+		to   = n > capacity - to ? n - (capacity - to) : to + n;
+		while (n != 0) {
+			len = MIN(n, MIN(from, to));
+			from -= len;
+			to   -= len;
+			memmove(p + to * elem_size, p + from * elem_size, len * elem_size);
+			from = from == 0 ? capacity : from;
+			to   = to == 0 ? capacity : to;
+			n -= len;
+		}
+	}
+}
+/*F}*/
+
 /*F{*/
 #include <string.h>
 /* Insert an element into a ring buffer. The buffer must already have sufficient
@@ -142,36 +234,22 @@ void *sp_ringbuf_get(size_t idx, const void *buf, size_t capacity, size_t elem_s
  * <0;size>. */
 void sp_ringbuf_insert(const void *elem, size_t idx, void *buf, size_t *size, size_t capacity, size_t elem_size, void **head, void **tail)
 {
-	void *s, *d;
-	size_t i;
+	void *d;
 	/* The new element splits the original buffer into 2 sub-buffers. Since
 	 * the entire buffer is circular, we can choose which of the 2
 	 * sub-buffers to shift away to make room. We pick the smaller one to
-	 * minimize the number of shifts.
+	 * minimize the number of bytes moved.
 	 */
 	if (*size != 0) {
 		if (idx < *size / 2) {
-			s = *head;
+			const size_t h = ((char*)*head - (char*)buf) / elem_size;
+			sp_ringbuf_shl(buf, capacity, elem_size, h, idx);
 			sp_ringbuf_decr(head, buf, capacity, elem_size);
-			d = *head;
-			i = 0;
-			while (i != idx) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_incr(&s, buf, capacity, elem_size);
-				++i;
-			}
+			d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
 		} else {
-			s = *tail;
+			d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
+			sp_ringbuf_shr(buf, capacity, elem_size, ((char*)d - (char*)buf) / elem_size, *size - idx);
 			sp_ringbuf_incr(tail, buf, capacity, elem_size);
-			d = *tail;
-			i = *size;
-			while (i != idx) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_decr(&s, buf, capacity, elem_size);
-				--i;
-			}
 		}
 	} else {
 		d = *tail;
@@ -182,38 +260,25 @@ void sp_ringbuf_insert(const void *elem, size_t idx, void *buf, size_t *size, si
 /*F}*/
 
 /*F{*/
-#include <string.h>
 /* Remove an element from a ring buffer. Indexing starts from left to right,
  * valid index values are in range <0;size>.
  */
 void sp_ringbuf_remove(size_t idx, void *buf, size_t *size, size_t capacity, size_t elem_size, void **head, void **tail)
 {
-	void *s, *d;
 	/* The gap from the removed element splits the original buffer into 2
 	 * sub-buffers.  Since the entire buffer is circular, we can choose
 	 * which of the 2 sub-buffers to shift to cover the gap. We pick the
-	 * smaller one to minimize the number of shifts.
+	 * smaller one to minimize the number of bytes moved.
 	 */
 	if (*size != 1) {
 		if (idx < *size / 2) {
-			s = d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
-			sp_ringbuf_decr(&s, buf, capacity, elem_size);
-			while (idx != 0) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_decr(&s, buf, capacity, elem_size);
-				--idx;
-			}
+			const size_t h = ((char*)*head - (char*)buf) / elem_size;
+			sp_ringbuf_shr(buf, capacity, elem_size, h, idx);
 			sp_ringbuf_incr(head, buf, capacity, elem_size);
 		} else {
-			s = d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
+			void *s = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
 			sp_ringbuf_incr(&s, buf, capacity, elem_size);
-			while (idx != *size - 1) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_incr(&s, buf, capacity, elem_size);
-				++idx;
-			}
+			sp_ringbuf_shl(buf, capacity, elem_size, ((char*)s - (char*)buf) / elem_size, *size - idx - 1);
 			sp_ringbuf_decr(tail, buf, capacity, elem_size);
 		}
 	}
@@ -221,6 +286,2905 @@ void sp_ringbuf_remove(size_t idx, void *buf, size_t *size, size_t capacity, siz
 }
 /*F}*/
 
+/*F{*/
+#include <string.h>
+/* Block buffers store elements in fixed-size blocks, referenced by a "map" of
+ * block pointers. Positions are counted from the beginning of the first block
+ * in the map, so element idx resides at position (head + idx). Blocks are never
+ * moved or reallocated (only the map is), which keeps element addresses stable.
+ *
+ * This function ensures there is room for one more element at the front (if
+ * front is non-0) or at the back of the buffer. If the map runs out of room,
+ * the used block pointers are re-centered in a new map, twice as long if more
+ * than half of the old one was in use. Blocks which fall out of use are kept
+ * for later reuse, so in a steady state no allocations take place at all.
+ * Return values are identical to sp_buf_fit.
+ */
+int sp_blockbuf_fit(void ***blocks, size_t *nblocks, size_t *head, size_t size, size_t block_size, size_t elem_size, int front)
+{
+	size_t b;
+	if (front ? *head == 0 : *head + size == *nblocks * block_size) {
+		const size_t first = *head / block_size,
+		             used  = size ? (*head + size - 1) / block_size - first + 1 : 0;
+		const size_t limit = MIN(SP_SIZE_MAX / block_size, SP_SIZE_MAX / sizeof(void*));
+		size_t n = *nblocks, i, j, k;
+		void **map;
+		/* Leave at least one free block on both ends after re-centering */
+		while (n < 2 * (used + 1)) {
+			if (n > limit / 2) {
+				n = limit;
+				break;
+			}
+			n *= 2;
+		}
+		if (n < used + 2) {
+			error(("size_t overflow detected, deque size limit reached"));
+			return 2;
+		}
+		map = malloc(n * sizeof(*map));
+		if (map == NULL) {
+			/*. C_ERRMSG_MALLOC */
+			return 1;
+		}
+		k = (n - used) / 2;
+		memcpy(map + k, *blocks + first, used * sizeof(*map));
+		j = (k == 0) ? used : 0;
+		for (i = 0; i < *nblocks; i++) {
+			if (i >= first && i < first + used)
+				continue;
+			map[j++] = (*blocks)[i];
+			if (j == k)
+				j += used;
+		}
+		while (j < n) {
+			map[j++] = NULL;
+			if (j == k)
+				j += used;
+		}
+		free(*blocks);
+		*blocks  = map;
+		*nblocks = n;
+		*head    = k * block_size + *head % block_size;
+	}
+	b = front ? (*head - 1) / block_size : (*head + size) / block_size;
+	if ((*blocks)[b] == NULL && ((*blocks)[b] = malloc(block_size * elem_size)) == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return 1;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+/* Return address of nth element in a block buffer. */
+void *sp_blockbuf_get(size_t idx, void *const *blocks, size_t head, size_t block_size, size_t elem_size)
+{
+	const size_t pos = head + idx;
+	return (char*)blocks[pos / block_size] + pos % block_size * elem_size;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Shift n consecutive block buffer elements, starting at position start, one
+ * position to the left. The position preceding start must be unoccupied, but
+ * its block must be allocated. Elements are moved with one memmove per block
+ * and one memcpy per block boundary crossed.
+ */
+void sp_blockbuf_shl(void *const *blocks, size_t block_size, size_t elem_size, size_t start, size_t n)
+{
+	while (n != 0) {
+		char *const blk = blocks[start / block_size];
+		const size_t off = start % block_size;
+		size_t len;
+		if (off == 0) {
+			memcpy((char*)blocks[start / block_size - 1] + (block_size - 1) * elem_size, blk, elem_size);
+			++start;
+			--n;
+			continue;
+		}
+		len = MIN(n, block_size - off);
+		memmove(blk + (off - 1) * elem_size, blk + off * elem_size, len * elem_size);
+		start += len;
+		n     -= len;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Shift n consecutive block buffer elements, starting at position start, one
+ * position to the right. The position following the last element must be
+ * unoccupied, but its block must be allocated. This is the mirror image of
+ * sp_blockbuf_shl, elements are processed from the back.
+ */
+void sp_blockbuf_shr(void *const *blocks, size_t block_size, size_t elem_size, size_t start, size_t n)
+{
+	size_t end = start + n;
+	while (n != 0) {
+		char *const blk = blocks[(end - 1) / block_size];
+		const size_t off = (end - 1) % block_size;
+		size_t len;
+		if (off == block_size - 1) {
+			memcpy(blocks[(end - 1) / block_size + 1], blk + off * elem_size, elem_size);
+			--end;
+			--n;
+			continue;
+		}
+		len = MIN(n, off + 1);
+		memmove(blk + (off + 2 - len) * elem_size, blk + (off + 1 - len) * elem_size, len * elem_size);
+		end -= len;
+		n   -= len;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Insert an element into a block buffer. Similarly to sp_ringbuf_insert, the
+ * smaller of the 2 sub-buffers split by idx is shifted to make room, so the
+ * caller must have called sp_blockbuf_fit with front set to (idx < size / 2).
+ */
+void sp_blockbuf_insert(const void *elem, size_t idx, void *const *blocks, size_t *head, size_t *size, size_t block_size, size_t elem_size)
+{
+	if (idx < *size / 2) {
+		sp_blockbuf_shl(blocks, block_size, elem_size, *head, idx);
+		--(*head);
+	} else {
+		sp_blockbuf_shr(blocks, block_size, elem_size, *head + idx, *size - idx);
+	}
+	memcpy(sp_blockbuf_get(idx, blocks, *head, block_size, elem_size), elem, elem_size);
+	++(*size);
+}
+/*F}*/
+
+/*F{*/
+/* Remove an element from a block buffer. The smaller of the 2 sub-buffers split
+ * by idx is shifted to cover the gap. */
+void sp_blockbuf_remove(size_t idx, void *const *blocks, size_t *head, size_t *size, size_t block_size, size_t elem_size)
+{
+	if (idx < *size / 2) {
+		sp_blockbuf_shr(blocks, block_size, elem_size, *head, idx);
+		++(*head);
+	} else {
+		sp_blockbuf_shl(blocks, block_size, elem_size, *head + idx + 1, *size - idx - 1);
+	}
+	--(*size);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Same as sp_buf_fit, but for packed bit buffers. capacity and size are
+ * expressed in bits, capacity is always a multiple of SP_WORD_BIT. The buffer
+ * is enlarged (doubled, just like in sp_buf_fit) until size bits fit in it.
+ * Newly allocated words are zeroed.
+ */
+int sp_bitbuf_fit(unsigned long **buf, size_t *capacity, size_t size)
+{
+	if (size > *capacity) {
+		const size_t max   = SP_SIZE_MAX / SP_WORD_BIT,
+		             need  = SP_WORDS(size),
+		             words = *capacity / SP_WORD_BIT;
+		size_t n = MAX(words, 1);
+		if (need > max) {
+			error(("size_t overflow detected, bitarray size limit reached"));
+			return 2;
+		}
+		while (n < need)
+			n = (n > max / 2) ? max : 2 * n;
+		*buf = realloc(*buf, n * sizeof(**buf));
+		if (*buf == NULL) {
+			/*. C_ERRMSG_REALLOC */
+			return 1;
+		}
+		memset(*buf + words, 0, (n - words) * sizeof(**buf));
+		*capacity = n * SP_WORD_BIT;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+/* Portable population count, see SP_POPCOUNT. Works for any width of unsigned
+ * long up to 255 bits. */
+size_t sp_popcount(unsigned long x)
+{
+	x = x - ((x >> 1) & (~0UL / 3));
+	x = (x & (~0UL / 15 * 3)) + ((x >> 2) & (~0UL / 15 * 3));
+	x = (x + (x >> 4)) & (~0UL / 255 * 15);
+	return (size_t)((x * (~0UL / 255)) >> (sizeof(x) - 1) * CHAR_BIT);
+}
+/*F}*/
+
+/*F{*/
+/* Portable count of trailing zero bits, see SP_CTZ. x must not be 0. */
+size_t sp_ctz(unsigned long x)
+{
+	size_t n = 0;
+	while (!(x & 1UL)) {
+		x >>= 1;
+		++n;
+	}
+	return n;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Default hash function for hashmap keys. Keys no longer than a word are mixed
+ * in a single round, which is the fast path for integer keys.
+ */
+size_t sp_hash(const void *data, size_t size)
+{
+	const unsigned char *p = data;
+	unsigned long h = (unsigned long)size, w;
+	while (size > sizeof(w)) {
+		memcpy(&w, p, sizeof(w));
+		h = (h ^ w) * SP_HASH_MULT;
+		h ^= h >> SP_WORD_BIT / 2;
+		p    += sizeof(w);
+		size -= sizeof(w);
+	}
+	w = 0;
+	memcpy(&w, p, size);
+	h = (h ^ w) * SP_HASH_MULT;
+	h ^= h >> SP_WORD_BIT / 2;
+	h *= SP_HASH_MULT;
+	h ^= h >> SP_WORD_BIT / 2;
+	return (size_t)h;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+#include <string.h>
+/* Returns the index of the slot holding key, or map->capacity if not found */
+size_t sp_hashtab_find(const struct sp_hashmap *map, const void *key, size_t hash)
+{
+	size_t ret;
+	SP_HASHTAB_PROBE(ret, map, key, map->key_size, hash);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+#include <string.h>
+/* Returns the first empty or deleted slot in the probe sequence of hash */
+size_t sp_hashtab_slot(const struct sp_hashmap *map, size_t hash)
+{
+	const size_t mask = map->capacity / SP_GROUP - 1;
+	size_t g = SP_H1(hash) & mask, step = 0;
+	for (;;) {
+		SP_CTRL_GROUP w;
+		unsigned long m;
+		SP_CTRL_LOAD(w, map->ctrl + g * SP_GROUP);
+		if ((m = SP_CTRL_MATCH_FREE(w)) != 0)
+			return g * SP_GROUP + SP_CTRL_INDEX(m);
+		g = (g + ++step) & mask;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+#include <string.h>
+/* Reserves a slot for a new key with the given hash and stores its index in
+ * idx. The caller is responsible for filling in the key and value. If the table
+ * runs out of empty slots, it is either rehashed in place (when most of the
+ * used slots are tombstones), or doubled.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_hashtab_claim(struct sp_hashmap *map, size_t hash, size_t *idx)
+{
+	size_t i = sp_hashtab_slot(map, hash);
+	if (map->growth_left == 0 && map->ctrl[i] != SP_CTRL_DELETED) {
+		const size_t fill = SP_HASHTAB_FILL(map->capacity);
+		int err;
+		if (map->size < fill / 2)
+			err = sp_hashtab_rehash(map, map->capacity);
+		else if (sp_size_try_add(fill, 1))
+			err = 2;
+		else
+			err = sp_hashtab_fit(map, fill + 1);
+		if (err)
+			return err;
+		i = sp_hashtab_slot(map, hash);
+	}
+	if (map->ctrl[i] == SP_CTRL_EMPTY)
+		--map->growth_left;
+	map->ctrl[i] = SP_H2(hash);
+	++map->size;
+	*idx = i;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+#include <string.h>
+/* Frees up a slot. If its group still has an empty slot, no probe sequence can
+ * have passed through the group, so the slot can be made empty again instead of
+ * leaving a tombstone behind.
+ */
+void sp_hashtab_erase(struct sp_hashmap *map, size_t idx)
+{
+	SP_CTRL_GROUP w;
+	SP_CTRL_LOAD(w, map->ctrl + idx / SP_GROUP * SP_GROUP);
+	if (SP_CTRL_MATCH_EMPTY(w)) {
+		map->ctrl[idx] = SP_CTRL_EMPTY;
+		++map->growth_left;
+	} else {
+		map->ctrl[idx] = SP_CTRL_DELETED;
+	}
+	--map->size;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+/* Makes room for n elements without further rehashing. The capacity is a power
+ * of 2 with at least 8 slots, to guarantee that 1/8 of the slots stay empty.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_hashtab_fit(struct sp_hashmap *map, size_t n)
+{
+	const size_t limit = SP_SIZE_MAX / map->slot_size;
+	size_t capacity = MAX(8, SP_GROUP);
+	while (SP_HASHTAB_FILL(capacity) < n) {
+		if (capacity > limit / 2) {
+			error(("size_t overflow detected, hashmap size limit reached"));
+			return 2;
+		}
+		capacity *= 2;
+	}
+	if (capacity > limit) {
+		error(("size_t overflow detected, hashmap size limit reached"));
+		return 2;
+	}
+	if (capacity > map->capacity)
+		return sp_hashtab_rehash(map, capacity);
+	if (n > map->size + map->growth_left)
+		return sp_hashtab_rehash(map, map->capacity);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+#include <string.h>
+/* Moves all elements into a freshly allocated table with the given capacity,
+ * which also gets rid of all tombstones. Returns 1 on allocation failure and 0
+ * otherwise, in which case the map is left untouched.
+ */
+int sp_hashtab_rehash(struct sp_hashmap *map, size_t capacity)
+{
+	const size_t mask = capacity / SP_GROUP - 1;
+	unsigned char *ctrl;
+	char *slots;
+	size_t i;
+
+	ctrl  = malloc(capacity);
+	slots = malloc(capacity * map->slot_size);
+	if (ctrl == NULL || slots == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ctrl);
+		free(slots);
+		return 1;
+	}
+	memset(ctrl, SP_CTRL_EMPTY, capacity);
+	for (i = 0; i < map->capacity; i++) {
+		const char *const key = SP_HASHTAB_KEY(map, i);
+		size_t hash, g, step = 0, j;
+		if (map->ctrl[i] & 0x80)
+			continue;
+		hash = SP_HASH(map, key);
+		g = SP_H1(hash) & mask;
+		for (;;) {
+			SP_CTRL_GROUP w;
+			unsigned long m;
+			SP_CTRL_LOAD(w, ctrl + g * SP_GROUP);
+			if ((m = SP_CTRL_MATCH_EMPTY(w)) != 0) {
+				j = g * SP_GROUP + SP_CTRL_INDEX(m);
+				break;
+			}
+			g = (g + ++step) & mask;
+		}
+		ctrl[j] = SP_H2(hash);
+		memcpy(slots + j * map->slot_size, key, map->slot_size);
+	}
+	free(map->ctrl);
+	free(map->slots);
+	map->ctrl        = ctrl;
+	map->slots       = slots;
+	map->capacity    = capacity;
+	map->growth_left = SP_HASHTAB_FILL(capacity) - map->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_hashmap.h"
+#include <string.h>
+/* Inserts every element of src into dest, which must have the same key and
+ * value sizes, enough room, and none of the keys of src. src is left untouched.
+ */
+void sp_hashtab_reinsert(struct sp_hashmap *dest, const struct sp_hashmap *src)
+{
+	size_t i;
+	for (i = 0; i < src->capacity; i++) {
+		const char *const key = SP_HASHTAB_KEY(src, i);
+		size_t hash, j;
+		if (src->ctrl[i] & 0x80)
+			continue;
+		hash = SP_HASH(src, key);
+		j    = sp_hashtab_slot(dest, hash);
+		if (dest->ctrl[j] == SP_CTRL_EMPTY)
+			--dest->growth_left;
+		dest->ctrl[j] = SP_H2(hash);
+		memcpy(SP_HASHTAB_KEY(dest, j), key, src->slot_size);
+		++dest->size;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_chashmap.h"
+#include <string.h>
+/* Makes sure that sp_hashtab_claim can reserve a slot for the given hash in the
+ * shard's table without rehashing it, which lock-free readers could not
+ * survive. The shard's lock must be held.
+ * A full table is replaced by a copy, twice its size, or of the same size if
+ * most of its used slots are tombstones. The copy is published atomically, so
+ * readers never wait for it, and the old table is retired until no reader can
+ * be inside it anymore.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_chashtab_reserve(struct sp_chashmap_shard *shard, size_t hash)
+{
+	struct sp_hashmap *const tab = shard->table, *tmp;
+	struct sp_chashmap_retired *retired;
+	const size_t fill = SP_HASHTAB_FILL(tab->capacity);
+	int err;
+
+	if (tab->growth_left != 0 || tab->ctrl[sp_hashtab_slot(tab, hash)] == SP_CTRL_DELETED)
+		return 0;
+	if (tab->size >= fill / 2 && sp_size_try_add(fill, 1))
+		return 2;
+	tmp = sp_hashmap_create(tab->key_size, tab->val_size, 1, tab->hash, tab->cmp);
+	if (tmp == NULL)
+		return 1;
+	if ((err = sp_hashtab_fit(tmp, tab->size < fill / 2 ? fill : fill + 1))) {
+		sp_hashmap_destroy(tmp, NULL, NULL);
+		return err;
+	}
+	sp_hashtab_reinsert(tmp, tab);
+
+	retired = realloc(shard->retired, (shard->nretired + 1) * sizeof(*retired));
+	if (retired == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		sp_hashmap_destroy(tmp, NULL, NULL);
+		return 1;
+	}
+	retired[shard->nretired].table = tab;
+	retired[shard->nretired].epoch = SP_LOAD_RELAXED(&shard->epoch);
+	++shard->nretired;
+	shard->retired = retired;
+	SP_STORE_RELEASE(&shard->table, tmp);
+	sp_chashtab_reclaim(shard);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_chashmap.h"
+/* Frees the retired tables of a shard which no reader can be inside of anymore,
+ * see SP_EPOCH_ENTER. The epoch is advanced at most twice, each time only if no
+ * reader of the previous epoch is left. The shard's lock must be held.
+ */
+void sp_chashtab_reclaim(struct sp_chashmap_shard *shard)
+{
+	unsigned long epoch = SP_LOAD_RELAXED(&shard->epoch);
+	size_t i, n;
+	for (i = 0; i < 2; i++) {
+		SP_FENCE_SEQ_CST();
+		if (SP_LOAD_ACQUIRE(&shard->readers[(epoch + 1) & 1]) != 0)
+			break;
+		SP_STORE_RELEASE(&shard->epoch, ++epoch);
+	}
+	for (i = n = 0; i < shard->nretired; i++) {
+		if (epoch - shard->retired[i].epoch >= 2)
+			sp_hashmap_destroy(shard->retired[i].table, NULL, NULL);
+		else
+			shard->retired[n++] = shard->retired[i];
+	}
+	shard->nretired = n;
+	if (n == 0) {
+		free(shard->retired);
+		shard->retired = NULL;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_intern.h"
+/* Hashes the contents of an interned string, see sp_intern_create */
+size_t sp_intern_hash(const void *key)
+{
+	const struct sp_intern_str *const s = key;
+	return sp_hash(s->str, s->len);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_intern.h"
+#include <string.h>
+/* Compares the contents of two interned strings, see sp_intern_create */
+int sp_intern_cmp(const void *key1, const void *key2)
+{
+	const struct sp_intern_str *const s1 = key1, *const s2 = key2;
+	return s1->len != s2->len || memcmp(s1->str, s2->str, s1->len);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_intern.h"
+/* Adds a block of at least n bytes to the arena of an intern pool. A string
+ * too long for a regular block gets one of its own, which is slotted in before
+ * the current block, so that the room left in the current block is not lost.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_intern_grow(struct sp_intern *pool, size_t n)
+{
+	const size_t size = pool->block_size > SP_INTERN_BLOCK_MAX / 2
+		? SP_INTERN_BLOCK_MAX : MAX(pool->block_size * 2, SP_INTERN_BLOCK);
+	char **blocks, *block;
+
+	if (pool->nblocks >= SP_SIZE_MAX / sizeof(*blocks)) {
+		error(("size_t overflow detected, intern pool size limit reached"));
+		return 2;
+	}
+	blocks = realloc(pool->blocks, (pool->nblocks + 1) * sizeof(*blocks));
+	if (blocks == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	pool->blocks = blocks;
+	block = malloc(MAX(size, n));
+	if (block == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return 1;
+	}
+	if (n > size && pool->nblocks != 0) {
+		blocks[pool->nblocks] = blocks[pool->nblocks - 1];
+		blocks[pool->nblocks - 1] = block;
+	} else {
+		blocks[pool->nblocks] = block;
+		pool->block_size = MAX(size, n);
+		pool->block_left = pool->block_size;
+	}
+	++pool->nblocks;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_list.h"
+/* Links the chain of nodes from first to last into a list, before pos, or at
+ * the end if pos is NULL. The size of the list is left for the caller to
+ * update.
+ */
+void sp_list_link(struct sp_list *list, struct sp_list_node *pos, struct sp_list_node *first, struct sp_list_node *last)
+{
+	struct sp_list_node *const prev = pos == NULL ? list->tail : pos->prev;
+	first->prev = prev;
+	last->next  = pos;
+	if (prev == NULL)
+		list->head = first;
+	else
+		prev->next = first;
+	if (pos == NULL)
+		list->tail = last;
+	else
+		pos->prev = last;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_list.h"
+/* Cuts the chain of nodes from first to last out of a list, leaving the links
+ * inside the chain intact. The size of the list is left for the caller to
+ * update.
+ */
+void sp_list_unlink(struct sp_list *list, struct sp_list_node *first, struct sp_list_node *last)
+{
+	if (first->prev == NULL)
+		list->head = last->next;
+	else
+		first->prev->next = last->next;
+	if (last->next == NULL)
+		list->tail = first->prev;
+	else
+		last->next->prev = first->prev;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ulist.h"
+/* Takes the spare node of an unrolled list, or allocates a new one. The node
+ * is empty and not linked yet. Returns NULL on allocation failure.
+ */
+struct sp_ulist_node *sp_ulist_alloc(struct sp_ulist *ulist)
+{
+	struct sp_ulist_node *node = ulist->spare;
+	if (node != NULL) {
+		ulist->spare = NULL;
+	} else if ((node = malloc(ulist->data_offset + ulist->node_cap * ulist->elem_size)) == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	node->count = 0;
+	++ulist->nnodes;
+	return node;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ulist.h"
+/* Unlinks a node from an unrolled list. One node is kept aside for reuse, so
+ * that splitting and merging the same nodes back and forth does not keep
+ * calling malloc.
+ */
+void sp_ulist_release(struct sp_ulist *ulist, struct sp_ulist_node *node)
+{
+	if (node->prev == NULL)
+		ulist->head = node->next;
+	else
+		node->prev->next = node->next;
+	if (node->next == NULL)
+		ulist->tail = node->prev;
+	else
+		node->next->prev = node->prev;
+	if (ulist->cursor == node)
+		ulist->cursor = NULL;
+	--ulist->nnodes;
+	if (ulist->spare == NULL)
+		ulist->spare = node;
+	else
+		free(node);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ulist.h"
+/* Finds the node holding the idx-th element of an unrolled list, and turns idx
+ * into the index of the element within that node. The walk starts from the
+ * head, the tail or the node found by the previous lookup, whichever is
+ * closest, and skips whole nodes by their counts. The node found becomes the
+ * new cursor. idx must be smaller than the size of the list.
+ */
+struct sp_ulist_node *sp_ulist_seek(struct sp_ulist *ulist, size_t *idx)
+{
+	struct sp_ulist_node *node = ulist->head;
+	size_t start = 0, dist = *idx;
+
+	if (ulist->size - *idx < dist) {
+		node  = ulist->tail;
+		start = ulist->size - node->count;
+		dist  = ulist->size - *idx;
+	}
+	if (ulist->cursor != NULL && (*idx > ulist->cursor_idx ? *idx - ulist->cursor_idx : ulist->cursor_idx - *idx) < dist) {
+		node  = ulist->cursor;
+		start = ulist->cursor_idx;
+	}
+	while (*idx < start) {
+		node   = node->prev;
+		start -= node->count;
+	}
+	while (*idx - start >= node->count) {
+		start += node->count;
+		node   = node->next;
+	}
+	ulist->cursor     = node;
+	ulist->cursor_idx = start;
+	*idx -= start;
+	return node;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ulist.h"
+#include <string.h>
+/* Opens a gap for a new element at position idx of an unrolled list, where idx
+ * may be equal to the size of the list, and returns its address. A full node
+ * is split in half, except at either end of the list, where a new node is
+ * started instead, so that pushing elements fills the nodes completely.
+ * Returns NULL on allocation failure.
+ */
+void *sp_ulist_slot(struct sp_ulist *ulist, size_t idx)
+{
+	const size_t elem_size = ulist->elem_size;
+	struct sp_ulist_node *node;
+	size_t start;
+
+	if (ulist->head == NULL) {
+		if ((node = sp_ulist_alloc(ulist)) == NULL)
+			return NULL;
+		node->prev  = NULL;
+		node->next  = NULL;
+		ulist->head = node;
+		ulist->tail = node;
+		start = 0;
+	} else if (idx == ulist->size) {
+		node  = ulist->tail;
+		start = ulist->size - node->count;
+		idx   = node->count;
+	} else {
+		node  = sp_ulist_seek(ulist, &idx);
+		start = ulist->cursor_idx;
+	}
+
+	if (node->count == ulist->node_cap) {
+		struct sp_ulist_node *const fresh = sp_ulist_alloc(ulist);
+		if (fresh == NULL)
+			return NULL;
+		if (idx == 0 && node->prev == NULL) {
+			fresh->prev = NULL;
+			fresh->next = node;
+			node->prev  = fresh;
+			ulist->head = fresh;
+			node = fresh;
+		} else {
+			const size_t half = node->count / 2;
+			fresh->prev = node;
+			fresh->next = node->next;
+			if (node->next == NULL)
+				ulist->tail = fresh;
+			else
+				node->next->prev = fresh;
+			node->next = fresh;
+			if (idx == node->count && fresh->next == NULL) {
+				start += node->count;
+				node = fresh;
+				idx  = 0;
+			} else {
+				memcpy(SP_ULIST_ELEM(ulist, fresh, 0), SP_ULIST_ELEM(ulist, node, half), (node->count - half) * elem_size);
+				fresh->count = node->count - half;
+				node->count  = half;
+				if (idx > half) {
+					start += half;
+					node = fresh;
+					idx -= half;
+				}
+			}
+		}
+	}
+
+	memmove(SP_ULIST_ELEM(ulist, node, idx + 1), SP_ULIST_ELEM(ulist, node, idx), (node->count - idx) * elem_size);
+	++node->count;
+	++ulist->size;
+	ulist->cursor     = node;
+	ulist->cursor_idx = start;
+	return SP_ULIST_ELEM(ulist, node, idx);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ulist.h"
+#include <string.h>
+/* Removes the idx-th element of a node of an unrolled list, where start is the
+ * position of the first element of the node within the list. A node left less
+ * than half full is merged with a neighbour, or takes elements over from it if
+ * they do not fit in a single node together, so that every node other than
+ * the head and the tail stays at least half full.
+ */
+void sp_ulist_erase(struct sp_ulist *ulist, struct sp_ulist_node *node, size_t idx, size_t start)
+{
+	const size_t elem_size = ulist->elem_size;
+	struct sp_ulist_node *const prev = node->prev, *const next = node->next;
+
+	memmove(SP_ULIST_ELEM(ulist, node, idx), SP_ULIST_ELEM(ulist, node, idx + 1), (node->count - idx - 1) * elem_size);
+	--node->count;
+	--ulist->size;
+	ulist->cursor     = node;
+	ulist->cursor_idx = start;
+	if (node->count >= ulist->node_cap / 2)
+		return;
+
+	if (next != NULL && node->count + next->count <= ulist->node_cap) {
+		memcpy(SP_ULIST_ELEM(ulist, node, node->count), SP_ULIST_ELEM(ulist, next, 0), next->count * elem_size);
+		node->count += next->count;
+		sp_ulist_release(ulist, next);
+	} else if (prev != NULL && prev->count + node->count <= ulist->node_cap) {
+		memcpy(SP_ULIST_ELEM(ulist, prev, prev->count), SP_ULIST_ELEM(ulist, node, 0), node->count * elem_size);
+		ulist->cursor_idx = start - prev->count;
+		prev->count += node->count;
+		sp_ulist_release(ulist, node);
+		ulist->cursor = prev;
+	} else if (next != NULL) {
+		const size_t n = (next->count - node->count) / 2;
+		memcpy(SP_ULIST_ELEM(ulist, node, node->count), SP_ULIST_ELEM(ulist, next, 0), n * elem_size);
+		memmove(SP_ULIST_ELEM(ulist, next, 0), SP_ULIST_ELEM(ulist, next, n), (next->count - n) * elem_size);
+		node->count += n;
+		next->count -= n;
+	} else if (prev != NULL) {
+		const size_t n = (prev->count - node->count) / 2;
+		memmove(SP_ULIST_ELEM(ulist, node, n), SP_ULIST_ELEM(ulist, node, 0), node->count * elem_size);
+		memcpy(SP_ULIST_ELEM(ulist, node, 0), SP_ULIST_ELEM(ulist, prev, prev->count - n), n * elem_size);
+		prev->count -= n;
+		node->count += n;
+		ulist->cursor_idx = start - n;
+	} else if (node->count == 0) {
+		sp_ulist_release(ulist, node);
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_sparse.h"
+/* Makes room for one more entry in a COO builder, doubling the capacity of all
+ * three of its arrays. Each array is only replaced once it has been grown, so
+ * a failure leaves the builder intact. Returns 1 if memory allocation failed,
+ * or 2 if the capacity cannot grow any further. */
+int sp_sparse_coo_fit(struct sp_sparse_coo *coo)
+{
+	const size_t max = SP_SIZE_MAX / MAX(coo->elem_size, sizeof(size_t));
+	size_t capacity;
+	void *p;
+
+	if (coo->size < coo->capacity)
+		return 0;
+	if (coo->capacity >= max) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return 2;
+	}
+	capacity = coo->capacity <= max / 2 ? coo->capacity * 2 : max;
+
+	if ((p = realloc(coo->vals, capacity * coo->elem_size)) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	coo->vals = p;
+	if ((p = realloc(coo->row_idx, capacity * sizeof(size_t))) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	coo->row_idx = p;
+	if ((p = realloc(coo->col_idx, capacity * sizeof(size_t))) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	coo->col_idx = p;
+	coo->capacity = capacity;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_sparse.h"
+#include <string.h>
+/* Builds a CSR or CSC matrix out of the entries of a COO builder, with two
+ * passes of a stable counting sort: first by the minor index (column for CSR),
+ * then by the major index. Entries thus end up sorted by both, and duplicate
+ * entries end up adjacent, in order of insertion. */
+struct sp_sparse *sp_sparse_compress(const struct sp_sparse_coo *coo, int format)
+{
+	const size_t nnz       = coo->size,
+	             elem_size = coo->elem_size,
+	             nmajor    = format == SP_SPARSE_CSR ? coo->rows : coo->cols,
+	             nminor    = format == SP_SPARSE_CSR ? coo->cols : coo->rows;
+	const size_t *const major = format == SP_SPARSE_CSR ? coo->row_idx : coo->col_idx,
+	             *const minor = format == SP_SPARSE_CSR ? coo->col_idx : coo->row_idx;
+	struct sp_sparse *ret;
+	size_t *count, *perm, i;
+
+	if (nmajor >= SP_SIZE_MAX / sizeof(size_t) || nminor >= SP_SIZE_MAX / sizeof(size_t)) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	ret->ptr  = malloc((nmajor + 1) * sizeof(size_t));
+	ret->idx  = malloc(MAX(nnz, 1) * sizeof(size_t));
+	ret->vals = malloc(MAX(nnz, 1) * elem_size);
+	count     = malloc((nminor + 1) * sizeof(size_t));
+	perm      = malloc(MAX(nnz, 1) * sizeof(size_t));
+	if (ret->ptr == NULL || ret->idx == NULL || ret->vals == NULL || count == NULL || perm == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret->ptr);
+		free(ret->idx);
+		free(ret->vals);
+		free(count);
+		free(perm);
+		free(ret);
+		return NULL;
+	}
+
+	/* perm lists the entries ordered by minor index */
+	memset(count, 0, (nminor + 1) * sizeof(size_t));
+	for (i = 0; i < nnz; i++)
+		++count[minor[i] + 1];
+	for (i = 1; i < nminor; i++)
+		count[i] += count[i - 1];
+	for (i = 0; i < nnz; i++)
+		perm[count[minor[i]]++] = i;
+
+	/* Scatter them by major index, using ptr as the insertion cursor of
+	 * every major index, and shift it back into place afterwards */
+	memset(ret->ptr, 0, (nmajor + 1) * sizeof(size_t));
+	for (i = 0; i < nnz; i++)
+		++ret->ptr[major[i] + 1];
+	for (i = 1; i < nmajor; i++)
+		ret->ptr[i] += ret->ptr[i - 1];
+	for (i = 0; i < nnz; i++) {
+		const size_t q = perm[i], dst = ret->ptr[major[q]]++;
+		ret->idx[dst] = minor[q];
+		memcpy((char*)ret->vals + dst * elem_size, (char*)coo->vals + q * elem_size, elem_size);
+	}
+	for (i = nmajor; i > 0; i--)
+		ret->ptr[i] = ret->ptr[i - 1];
+	ret->ptr[0] = 0;
+	free(count);
+	free(perm);
+
+	ret->elem_size = elem_size;
+	ret->rows      = coo->rows;
+	ret->cols      = coo->cols;
+	ret->nnz       = nnz;
+	ret->format    = format;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Swaps two non-overlapping objects of n bytes, through a buffer on the stack */
+void sp_memswap(void *a, void *b, size_t n)
+{
+	char tmp[64], *p = a, *q = b;
+	while (n > 0) {
+		const size_t k = MIN(n, sizeof(tmp));
+		memcpy(tmp, p, k);
+		memcpy(p, q, k);
+		memcpy(q, tmp, k);
+		p += k;
+		q += k;
+		n -= k;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pqueue.h"
+/* Moves the element at idx towards the root, until its parent comes before it */
+void sp_pqueue_siftup(struct sp_pqueue *pq, size_t idx)
+{
+	while (idx > 0) {
+		const size_t parent = (idx - 1) / pq->arity;
+		if (!SP_PQUEUE_BEFORE(pq, SP_PQUEUE_ELEM(pq, idx), SP_PQUEUE_ELEM(pq, parent)))
+			break;
+		sp_memswap(SP_PQUEUE_ELEM(pq, idx), SP_PQUEUE_ELEM(pq, parent), pq->elem_size);
+		idx = parent;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pqueue.h"
+/* Moves the element at idx towards the leaves, until it comes before all of
+ * its children */
+void sp_pqueue_siftdown(struct sp_pqueue *pq, size_t idx)
+{
+	while (pq->size >= 2 && idx <= (pq->size - 2) / pq->arity) {
+		size_t child = idx * pq->arity + 1, best = child;
+		const size_t end = pq->size - child > pq->arity ? child + pq->arity : pq->size;
+		for (++child; child < end; child++)
+			if (SP_PQUEUE_BEFORE(pq, SP_PQUEUE_ELEM(pq, child), SP_PQUEUE_ELEM(pq, best)))
+				best = child;
+		if (!SP_PQUEUE_BEFORE(pq, SP_PQUEUE_ELEM(pq, best), SP_PQUEUE_ELEM(pq, idx)))
+			break;
+		sp_memswap(SP_PQUEUE_ELEM(pq, idx), SP_PQUEUE_ELEM(pq, best), pq->elem_size);
+		idx = best;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pqueue.h"
+/* Restores the heap property of the whole queue in linear time, by sifting
+ * down every element which has children, from the last one to the root */
+void sp_pqueue_heapify_all(struct sp_pqueue *pq)
+{
+	size_t i;
+	if (pq->size < 2)
+		return;
+	for (i = (pq->size - 2) / pq->arity + 1; i-- > 0;)
+		sp_pqueue_siftdown(pq, i);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pqueue.h"
+/* Makes room for n more elements, at least doubling the capacity. Return
+ * values are identical to sp_buf_fit. */
+int sp_pqueue_reserve(struct sp_pqueue *pq, size_t n)
+{
+	const size_t max = SP_SIZE_MAX / pq->elem_size;
+	size_t capacity;
+	void *p;
+
+	if (n <= pq->capacity - pq->size)
+		return 0;
+	if (n > max - pq->size) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return 2;
+	}
+	capacity = pq->capacity <= max / 2 ? pq->capacity * 2 : max;
+	capacity = MAX(capacity, pq->size + n);
+	if ((p = realloc(pq->data, capacity * pq->elem_size)) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	pq->data     = p;
+	pq->capacity = capacity;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ipqueue.h"
+/* Moves the handle at idx towards the root, until its parent comes before it */
+void sp_ipqueue_siftup(struct sp_ipqueue *ipq, size_t idx)
+{
+	const size_t h = ipq->heap[idx];
+	const void *const elem = SP_IPQUEUE_ELEM(ipq, h);
+	while (idx > 0) {
+		const size_t parent = (idx - 1) / ipq->arity;
+		if (!SP_PQUEUE_BEFORE(ipq, elem, SP_IPQUEUE_ELEM(ipq, ipq->heap[parent])))
+			break;
+		ipq->heap[idx] = ipq->heap[parent];
+		ipq->pos[ipq->heap[idx]] = idx;
+		idx = parent;
+	}
+	ipq->heap[idx] = h;
+	ipq->pos[h]    = idx;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ipqueue.h"
+/* Moves the handle at idx towards the leaves, until it comes before all of
+ * its children */
+void sp_ipqueue_siftdown(struct sp_ipqueue *ipq, size_t idx)
+{
+	const size_t h = ipq->heap[idx];
+	const void *const elem = SP_IPQUEUE_ELEM(ipq, h);
+	while (ipq->size >= 2 && idx <= (ipq->size - 2) / ipq->arity) {
+		size_t child = idx * ipq->arity + 1, best = child;
+		const size_t end = ipq->size - child > ipq->arity ? child + ipq->arity : ipq->size;
+		for (++child; child < end; child++)
+			if (SP_PQUEUE_BEFORE(ipq, SP_IPQUEUE_ELEM(ipq, ipq->heap[child]), SP_IPQUEUE_ELEM(ipq, ipq->heap[best])))
+				best = child;
+		if (!SP_PQUEUE_BEFORE(ipq, SP_IPQUEUE_ELEM(ipq, ipq->heap[best]), elem))
+			break;
+		ipq->heap[idx] = ipq->heap[best];
+		ipq->pos[ipq->heap[idx]] = idx;
+		idx = best;
+	}
+	ipq->heap[idx] = h;
+	ipq->pos[h]    = idx;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ipqueue.h"
+/* Takes the handle at idx out of the heap by swapping it with the last one,
+ * and returns it. The handle lands among the free ones, and the heap must then
+ * be repaired at idx, unless idx was the last index. */
+size_t sp_ipqueue_detach(struct sp_ipqueue *ipq, size_t idx)
+{
+	const size_t h = ipq->heap[idx], last = ipq->heap[--ipq->size];
+	ipq->heap[idx]       = last;
+	ipq->pos[last]       = idx;
+	ipq->heap[ipq->size] = h;
+	ipq->pos[h]          = ipq->size;
+	return h;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_ipqueue.h"
+/* Makes room for one more handle, doubling the capacity. Return values are
+ * identical to sp_buf_fit. */
+int sp_ipqueue_reserve(struct sp_ipqueue *ipq)
+{
+	const size_t max = SP_SIZE_MAX / MAX(ipq->elem_size, sizeof(size_t));
+	size_t capacity;
+	void *p;
+
+	if (ipq->count < ipq->capacity)
+		return 0;
+	if (ipq->capacity == max) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return 2;
+	}
+	capacity = ipq->capacity <= max / 2 ? ipq->capacity * 2 : max;
+
+	/* A failure leaves the larger buffers in place, which is harmless */
+	if ((p = realloc(ipq->data, capacity * ipq->elem_size)) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	ipq->data = p;
+	if ((p = realloc(ipq->heap, capacity * sizeof(size_t))) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	ipq->heap = p;
+	if ((p = realloc(ipq->pos, capacity * sizeof(size_t))) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	ipq->pos      = p;
+	ipq->capacity = capacity;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_avl.h"
+/* Rotates the subtree of node to the right (or left), and returns its new
+ * root. The parent of the subtree is left for the caller to relink. */
+struct sp_avl_node *sp_avl_rotate(struct sp_avl_node *node, int right)
+{
+	struct sp_avl_node *const pivot = right ? node->left : node->right,
+	                   *const inner = right ? pivot->right : pivot->left;
+	if (right) {
+		node->left   = inner;
+		pivot->right = node;
+	} else {
+		node->right  = inner;
+		pivot->left  = node;
+	}
+	if (inner != NULL)
+		inner->parent = node;
+	pivot->parent = node->parent;
+	node->parent  = pivot;
+	SP_AVL_UPDATE(node);
+	SP_AVL_UPDATE(pivot);
+	return pivot;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_avl.h"
+/* Walks up from node to the root, restoring the balance of every subtree on
+ * the way and the sizes they hold. The walk cannot stop early, because every
+ * ancestor of a changed node has changed in size. */
+void sp_avl_fixup(struct sp_avl *avl, struct sp_avl_node *node)
+{
+	while (node != NULL) {
+		struct sp_avl_node *const parent = node->parent;
+		struct sp_avl_node **const link = parent == NULL ? &avl->root
+			: parent->left == node ? &parent->left : &parent->right;
+		const int balance = SP_AVL_HEIGHT(node->left) - SP_AVL_HEIGHT(node->right);
+		if (balance > 1) {
+			if (SP_AVL_HEIGHT(node->left->left) < SP_AVL_HEIGHT(node->left->right))
+				node->left = sp_avl_rotate(node->left, 0);
+			node = sp_avl_rotate(node, 1);
+		} else if (balance < -1) {
+			if (SP_AVL_HEIGHT(node->right->right) < SP_AVL_HEIGHT(node->right->left))
+				node->right = sp_avl_rotate(node->right, 1);
+			node = sp_avl_rotate(node, 0);
+		} else {
+			SP_AVL_UPDATE(node);
+		}
+		*link = node;
+		node = parent;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_avl.h"
+/* Attaches a new leaf at link, which is a child pointer of parent (or the root
+ * pointer), and rebalances the tree */
+void sp_avl_link(struct sp_avl *avl, struct sp_avl_node *parent, struct sp_avl_node **link, struct sp_avl_node *node)
+{
+	node->left   = NULL;
+	node->right  = NULL;
+	node->parent = parent;
+	node->size   = 1;
+	node->height = 1;
+	*link = node;
+	++avl->size;
+	sp_avl_fixup(avl, parent);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_avl.h"
+/* Detaches a node from an AVL tree, rebalances the tree and gives the node
+ * back to the pool. A node with two children is replaced by its successor,
+ * which is relinked instead of copied, so that no other node changes its
+ * address. */
+void sp_avl_unlink(struct sp_avl *avl, struct sp_avl_node *node)
+{
+	struct sp_avl_node *const parent = node->parent;
+	struct sp_avl_node **const link = parent == NULL ? &avl->root
+		: parent->left == node ? &parent->left : &parent->right;
+	struct sp_avl_node *fix;
+
+	if (node->left != NULL && node->right != NULL) {
+		struct sp_avl_node *succ = node->right;
+		while (succ->left != NULL)
+			succ = succ->left;
+		if (succ->parent == node) {
+			fix = succ;
+		} else {
+			fix = succ->parent;
+			fix->left = succ->right;
+			if (succ->right != NULL)
+				succ->right->parent = fix;
+			succ->right = node->right;
+			succ->right->parent = succ;
+		}
+		succ->left = node->left;
+		succ->left->parent = succ;
+		succ->parent = parent;
+		*link = succ;
+	} else {
+		struct sp_avl_node *const child = node->left != NULL ? node->left : node->right;
+		if (child != NULL)
+			child->parent = parent;
+		*link = child;
+		fix = parent;
+	}
+	sp_avl_fixup(avl, fix);
+	sp_pool_give(&avl->pool, node);
+	--avl->size;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_avl.h"
+#include <string.h>
+/* Builds a perfectly balanced subtree out of n sorted keys and their values,
+ * taking the middle one as the root, and returns it. The caller must make sure
+ * that n nodes can be allocated. */
+struct sp_avl_node *sp_avl_build_range(struct sp_avl *avl, const char *keys, const char *vals, size_t n, struct sp_avl_node *parent)
+{
+	struct sp_avl_node *node;
+	void *block;
+	const size_t mid = n / 2;
+
+	if (n == 0)
+		return NULL;
+	sp_pool_take(&avl->pool, &block);
+	node = block;
+	memcpy(SP_AVL_KEY(avl, node), keys + mid * avl->key_size, avl->key_size);
+	if (vals != NULL)
+		memcpy(SP_AVL_VAL(avl, node), vals + mid * avl->val_size, avl->val_size);
+	node->parent = parent;
+	node->left   = sp_avl_build_range(avl, keys, vals, mid, node);
+	node->right  = sp_avl_build_range(avl, keys + (mid + 1) * avl->key_size,
+		vals == NULL ? NULL : vals + (mid + 1) * avl->val_size, n - mid - 1, node);
+	SP_AVL_UPDATE(node);
+	return node;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_rbtree.h"
+/* Rotates the subtree of node to the right (or left), and puts the new root
+ * of the subtree in place of node */
+void sp_rbtree_rotate(struct sp_rbtree *tree, struct sp_rbnode *node, int right)
+{
+	struct sp_rbnode *const pivot  = right ? node->left : node->right,
+	                 *const inner  = right ? pivot->right : pivot->left,
+	                 *const parent = node->parent;
+	if (right) {
+		node->left   = inner;
+		pivot->right = node;
+	} else {
+		node->right  = inner;
+		pivot->left  = node;
+	}
+	if (inner != NULL)
+		inner->parent = node;
+	pivot->parent = parent;
+	node->parent  = pivot;
+	if (parent == NULL)
+		tree->root = pivot;
+	else if (parent->left == node)
+		parent->left = pivot;
+	else
+		parent->right = pivot;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_rbtree.h"
+/* Attaches a new red leaf at link, which is a child pointer of parent (or the
+ * root pointer), and restores the red-black properties. At most two rotations
+ * are made, and recoloring goes up the tree in amortized constant time. */
+void sp_rbtree_link(struct sp_rbtree *tree, struct sp_rbnode *parent, struct sp_rbnode **link, struct sp_rbnode *node)
+{
+	node->left   = NULL;
+	node->right  = NULL;
+	node->parent = parent;
+	node->color  = SP_RBTREE_RED;
+	*link = node;
+	++tree->size;
+
+	while ((parent = node->parent) != NULL && parent->color == SP_RBTREE_RED) {
+		/* A red parent is never the root, so the grandparent exists */
+		struct sp_rbnode *const gparent = parent->parent;
+		const int left = parent == gparent->left;
+		struct sp_rbnode *const uncle = left ? gparent->right : gparent->left;
+		if (!SP_RBTREE_IS_BLACK(uncle)) {
+			parent->color  = SP_RBTREE_BLACK;
+			uncle->color   = SP_RBTREE_BLACK;
+			gparent->color = SP_RBTREE_RED;
+			node = gparent;
+			continue;
+		}
+		if (node == (left ? parent->right : parent->left)) {
+			sp_rbtree_rotate(tree, parent, !left);
+			parent = node;
+		}
+		parent->color  = SP_RBTREE_BLACK;
+		gparent->color = SP_RBTREE_RED;
+		sp_rbtree_rotate(tree, gparent, left);
+		break;
+	}
+	tree->root->color = SP_RBTREE_BLACK;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_rbtree.h"
+/* Detaches a node from a red-black tree and restores the red-black properties.
+ * A node with two children is replaced by its successor, which is relinked
+ * instead of copied, because nodes belong to the user. */
+void sp_rbtree_unlink(struct sp_rbtree *tree, struct sp_rbnode *node)
+{
+	struct sp_rbnode *const nparent = node->parent;
+	struct sp_rbnode **const link = nparent == NULL ? &tree->root
+		: nparent->left == node ? &nparent->left : &nparent->right;
+	struct sp_rbnode *child, *parent;
+	int color;
+
+	if (node->left == NULL || node->right == NULL) {
+		child  = node->left != NULL ? node->left : node->right;
+		parent = nparent;
+		color  = node->color;
+		if (child != NULL)
+			child->parent = parent;
+		*link = child;
+	} else {
+		struct sp_rbnode *succ = node->right;
+		while (succ->left != NULL)
+			succ = succ->left;
+		child = succ->right;
+		color = succ->color;
+		if (succ->parent == node) {
+			parent = succ;
+		} else {
+			parent = succ->parent;
+			parent->left = child;
+			if (child != NULL)
+				child->parent = parent;
+			succ->right = node->right;
+			succ->right->parent = succ;
+		}
+		succ->left = node->left;
+		succ->left->parent = succ;
+		succ->parent = nparent;
+		succ->color  = node->color;
+		*link = succ;
+	}
+	--tree->size;
+	if (color == SP_RBTREE_RED)
+		return;
+
+	/* A black node is gone, so the path through child lacks one black node.
+	 * Since it did have one, child has a sibling. */
+	while (child != tree->root && SP_RBTREE_IS_BLACK(child)) {
+		const int left = child == parent->left;
+		struct sp_rbnode *sib = left ? parent->right : parent->left, *near, *far;
+		if (sib->color == SP_RBTREE_RED) {
+			sib->color    = SP_RBTREE_BLACK;
+			parent->color = SP_RBTREE_RED;
+			sp_rbtree_rotate(tree, parent, !left);
+			sib = left ? parent->right : parent->left;
+		}
+		near = left ? sib->left : sib->right;
+		far  = left ? sib->right : sib->left;
+		if (SP_RBTREE_IS_BLACK(near) && SP_RBTREE_IS_BLACK(far)) {
+			sib->color = SP_RBTREE_RED;
+			child  = parent;
+			parent = child->parent;
+			continue;
+		}
+		if (SP_RBTREE_IS_BLACK(far)) {
+			near->color = SP_RBTREE_BLACK;
+			sib->color  = SP_RBTREE_RED;
+			sp_rbtree_rotate(tree, sib, left);
+			far = sib;
+			sib = near;
+		}
+		sib->color    = parent->color;
+		parent->color = SP_RBTREE_BLACK;
+		far->color    = SP_RBTREE_BLACK;
+		sp_rbtree_rotate(tree, parent, !left);
+		child = tree->root;
+	}
+	if (child != NULL)
+		child->color = SP_RBTREE_BLACK;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bptree.h"
+/* Binary search for the number of keys of a B+tree node which compare less
+ * than (or, if upper is set, not greater than) key */
+size_t sp_bptree_rank(const struct sp_bptree *tree, const struct sp_bptree_node *node, const void *key, int upper)
+{
+	size_t lo = 0, n = node->count;
+	while (n > 0) {
+		const size_t half = n / 2;
+		const int c = tree->cmp(SP_BPTREE_KEY(tree, node, lo + half), key);
+		if (c < 0 || (upper && c == 0)) {
+			lo += half + 1;
+			n  -= half + 1;
+		} else {
+			n = half;
+		}
+	}
+	return lo;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+/* Inserts item at pos into the array src of n items of the given size, and
+ * moves all but the first left items of the result to the array dst */
+void sp_bptree_split(char *src, char *dst, size_t n, size_t left, size_t pos, const void *item, size_t size)
+{
+	if (pos < left) {
+		memcpy(dst, src + (left - 1) * size, (n - left + 1) * size);
+		memmove(src + (pos + 1) * size, src + pos * size, (left - 1 - pos) * size);
+		memcpy(src + pos * size, item, size);
+	} else {
+		memcpy(dst, src + left * size, (pos - left) * size);
+		memcpy(dst + (pos - left) * size, item, size);
+		memcpy(dst + (pos - left + 1) * size, src + pos * size, (n - pos) * size);
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bptree.h"
+#include <string.h>
+/* Inserts a new key and its value into a B+tree, at index slot[height - 1] of
+ * the leaf at the end of path. path holds the nodes on the way from the root,
+ * and slot the index of the child taken at each of them. Full nodes are split
+ * from the leaf upwards, and all the nodes needed for that are allocated
+ * first, so that the tree is left unchanged on failure. Returns 1 on
+ * allocation failure and 0 otherwise. */
+int sp_bptree_insert_at(struct sp_bptree *tree, struct sp_bptree_node **path, const size_t *slot, const void *key, const void *val)
+{
+	struct sp_bptree_node *fresh[SP_BPTREE_MAX_HEIGHT + 1], *node, *right, *child;
+	const size_t h = tree->height, ks = tree->key_size, vs = tree->val_size;
+	size_t need = 0, pos, left, l, k;
+	const void *sep;
+
+	if (h == 0) {
+		if ((node = malloc(tree->leaf_size)) == NULL) {
+			/*. C_ERRMSG_MALLOC */
+			return 1;
+		}
+		node->prev  = NULL;
+		node->next  = NULL;
+		node->count = 1;
+		memcpy(SP_BPTREE_KEY(tree, node, 0), key, ks);
+		if (vs != 0)
+			memcpy(SP_BPTREE_VAL(tree, node, 0), val, vs);
+		tree->root   = node;
+		tree->head   = node;
+		tree->tail   = node;
+		tree->height = 1;
+		tree->size   = 1;
+		return 0;
+	}
+
+	/* A full leaf takes a new leaf, every full ancestor above it a new inner
+	 * node, and a full root a new root */
+	if (path[h - 1]->count == tree->leaf_cap) {
+		for (need = 1, l = h - 1; l > 0 && path[l - 1]->count == tree->inner_cap; l--)
+			need++;
+		need += l == 0;
+	}
+	for (k = 0; k < need; k++) {
+		if ((fresh[k] = malloc(k == 0 ? tree->leaf_size : tree->inner_size)) == NULL) {
+			/*. C_ERRMSG_MALLOC */
+			while (k > 0)
+				free(fresh[--k]);
+			return 1;
+		}
+	}
+
+	node = path[h - 1];
+	pos  = slot[h - 1];
+	++tree->size;
+	if (need == 0) {
+		memmove(SP_BPTREE_KEY(tree, node, pos + 1), SP_BPTREE_KEY(tree, node, pos), (node->count - pos) * ks);
+		memcpy(SP_BPTREE_KEY(tree, node, pos), key, ks);
+		if (vs != 0) {
+			memmove(SP_BPTREE_VAL(tree, node, pos + 1), SP_BPTREE_VAL(tree, node, pos), (node->count - pos) * vs);
+			memcpy(SP_BPTREE_VAL(tree, node, pos), val, vs);
+		}
+		++node->count;
+		return 0;
+	}
+
+	/* Split the leaf, keeping the larger half on the left */
+	right = fresh[0];
+	left  = (tree->leaf_cap + 2) / 2;
+	sp_bptree_split(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, right, 0), tree->leaf_cap, left, pos, key, ks);
+	if (vs != 0)
+		sp_bptree_split(SP_BPTREE_VAL(tree, node, 0), SP_BPTREE_VAL(tree, right, 0), tree->leaf_cap, left, pos, val, vs);
+	right->count = tree->leaf_cap + 1 - left;
+	node->count  = left;
+	right->prev  = node;
+	right->next  = node->next;
+	if (node->next != NULL)
+		node->next->prev = right;
+	else
+		tree->tail = right;
+	node->next = right;
+
+	/* Insert the first key of the new node and the node itself into the
+	 * parent, splitting it around its middle key if it is full, which is then
+	 * moved up instead */
+	sep   = SP_BPTREE_KEY(tree, right, 0);
+	child = right;
+	for (l = h - 1, k = 1; l > 0; l--) {
+		node = path[l - 1];
+		pos  = slot[l - 1];
+		if (node->count < tree->inner_cap) {
+			memmove(SP_BPTREE_KEY(tree, node, pos + 1), SP_BPTREE_KEY(tree, node, pos), (node->count - pos) * ks);
+			memcpy(SP_BPTREE_KEY(tree, node, pos), sep, ks);
+			memmove(SP_BPTREE_CHILD(tree, node) + pos + 2, SP_BPTREE_CHILD(tree, node) + pos + 1, (node->count - pos) * sizeof(child));
+			SP_BPTREE_CHILD(tree, node)[pos + 1] = child;
+			++node->count;
+			return 0;
+		}
+		right = fresh[k++];
+		right->prev = NULL;
+		right->next = NULL;
+		left = tree->inner_cap / 2;
+		sp_bptree_split(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, right, 0), tree->inner_cap, left + 1, pos, sep, ks);
+		sp_bptree_split((char*)SP_BPTREE_CHILD(tree, node), (char*)SP_BPTREE_CHILD(tree, right), tree->inner_cap + 1, left + 1, pos + 1, &child, sizeof(child));
+		right->count = tree->inner_cap - left;
+		node->count  = left;
+		sep   = SP_BPTREE_KEY(tree, node, left);
+		child = right;
+	}
+
+	/* The root was split */
+	node = fresh[k];
+	node->prev  = NULL;
+	node->next  = NULL;
+	node->count = 1;
+	memcpy(SP_BPTREE_KEY(tree, node, 0), sep, ks);
+	SP_BPTREE_CHILD(tree, node)[0] = tree->root;
+	SP_BPTREE_CHILD(tree, node)[1] = child;
+	tree->root = node;
+	++tree->height;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bptree.h"
+#include <string.h>
+/* Refills the child at idx of parent, which has one key less than the minimum,
+ * with a key of a sibling which can spare one, or else merges it with a
+ * sibling. leaf tells whether the child is a leaf. Returns 1 if the children
+ * were merged, in which case the parent has lost a key, and 0 otherwise. */
+int sp_bptree_rebalance(struct sp_bptree *tree, struct sp_bptree_node *parent, size_t idx, int leaf)
+{
+	struct sp_bptree_node **const children = SP_BPTREE_CHILD(tree, parent);
+	struct sp_bptree_node *const node = children[idx], *left, *right;
+	const size_t min = (leaf ? tree->leaf_cap : tree->inner_cap) / 2,
+	             ks = tree->key_size, vs = tree->val_size;
+	size_t s;
+
+	if (idx > 0 && (left = children[idx - 1])->count > min) {
+		const size_t n = --left->count;
+		memmove(SP_BPTREE_KEY(tree, node, 1), SP_BPTREE_KEY(tree, node, 0), node->count * ks);
+		if (leaf) {
+			memcpy(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, left, n), ks);
+			if (vs != 0) {
+				memmove(SP_BPTREE_VAL(tree, node, 1), SP_BPTREE_VAL(tree, node, 0), node->count * vs);
+				memcpy(SP_BPTREE_VAL(tree, node, 0), SP_BPTREE_VAL(tree, left, n), vs);
+			}
+			memcpy(SP_BPTREE_KEY(tree, parent, idx - 1), SP_BPTREE_KEY(tree, node, 0), ks);
+		} else {
+			memmove(SP_BPTREE_CHILD(tree, node) + 1, SP_BPTREE_CHILD(tree, node), (node->count + 1) * sizeof(node));
+			memcpy(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, parent, idx - 1), ks);
+			SP_BPTREE_CHILD(tree, node)[0] = SP_BPTREE_CHILD(tree, left)[n + 1];
+			memcpy(SP_BPTREE_KEY(tree, parent, idx - 1), SP_BPTREE_KEY(tree, left, n), ks);
+		}
+		++node->count;
+		return 0;
+	}
+
+	if (idx < parent->count && (right = children[idx + 1])->count > min) {
+		const size_t n = --right->count;
+		if (leaf) {
+			memcpy(SP_BPTREE_KEY(tree, node, node->count), SP_BPTREE_KEY(tree, right, 0), ks);
+			memmove(SP_BPTREE_KEY(tree, right, 0), SP_BPTREE_KEY(tree, right, 1), n * ks);
+			if (vs != 0) {
+				memcpy(SP_BPTREE_VAL(tree, node, node->count), SP_BPTREE_VAL(tree, right, 0), vs);
+				memmove(SP_BPTREE_VAL(tree, right, 0), SP_BPTREE_VAL(tree, right, 1), n * vs);
+			}
+			memcpy(SP_BPTREE_KEY(tree, parent, idx), SP_BPTREE_KEY(tree, right, 0), ks);
+		} else {
+			memcpy(SP_BPTREE_KEY(tree, node, node->count), SP_BPTREE_KEY(tree, parent, idx), ks);
+			SP_BPTREE_CHILD(tree, node)[node->count + 1] = SP_BPTREE_CHILD(tree, right)[0];
+			memcpy(SP_BPTREE_KEY(tree, parent, idx), SP_BPTREE_KEY(tree, right, 0), ks);
+			memmove(SP_BPTREE_KEY(tree, right, 0), SP_BPTREE_KEY(tree, right, 1), n * ks);
+			memmove(SP_BPTREE_CHILD(tree, right), SP_BPTREE_CHILD(tree, right) + 1, (n + 1) * sizeof(node));
+		}
+		++node->count;
+		return 0;
+	}
+
+	/* Neither sibling can spare a key, so the node and one of them fit
+	 * together into the left one of the pair */
+	s = idx > 0 ? idx - 1 : idx;
+	left  = children[s];
+	right = children[s + 1];
+	if (leaf) {
+		memcpy(SP_BPTREE_KEY(tree, left, left->count), SP_BPTREE_KEY(tree, right, 0), right->count * ks);
+		if (vs != 0)
+			memcpy(SP_BPTREE_VAL(tree, left, left->count), SP_BPTREE_VAL(tree, right, 0), right->count * vs);
+		left->count += right->count;
+		left->next = right->next;
+		if (right->next != NULL)
+			right->next->prev = left;
+		else
+			tree->tail = left;
+	} else {
+		memcpy(SP_BPTREE_KEY(tree, left, left->count), SP_BPTREE_KEY(tree, parent, s), ks);
+		memcpy(SP_BPTREE_KEY(tree, left, left->count + 1), SP_BPTREE_KEY(tree, right, 0), right->count * ks);
+		memcpy(SP_BPTREE_CHILD(tree, left) + left->count + 1, SP_BPTREE_CHILD(tree, right), (right->count + 1) * sizeof(node));
+		left->count += right->count + 1;
+	}
+	free(right);
+	memmove(SP_BPTREE_KEY(tree, parent, s), SP_BPTREE_KEY(tree, parent, s + 1), (parent->count - s - 1) * ks);
+	memmove(children + s + 1, children + s + 2, (parent->count - s - 1) * sizeof(*children));
+	--parent->count;
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bptree.h"
+#include <string.h>
+/* Removes the key at index slot[height - 1] of the leaf at the end of path,
+ * with path and slot as for insertion, and its value, and rebalances the tree
+ * from the leaf upwards */
+void sp_bptree_erase_at(struct sp_bptree *tree, struct sp_bptree_node **path, const size_t *slot)
+{
+	const size_t h = tree->height, pos = slot[h - 1];
+	struct sp_bptree_node *node = path[h - 1];
+	size_t l;
+
+	memmove(SP_BPTREE_KEY(tree, node, pos), SP_BPTREE_KEY(tree, node, pos + 1), (node->count - pos - 1) * tree->key_size);
+	if (tree->val_size != 0)
+		memmove(SP_BPTREE_VAL(tree, node, pos), SP_BPTREE_VAL(tree, node, pos + 1), (node->count - pos - 1) * tree->val_size);
+	--node->count;
+	--tree->size;
+
+	for (l = h - 1; l > 0; l--) {
+		if (path[l]->count >= (l == h - 1 ? tree->leaf_cap : tree->inner_cap) / 2)
+			return;
+		if (!sp_bptree_rebalance(tree, path[l - 1], slot[l - 1], l == h - 1))
+			return;
+	}
+
+	/* An empty root is dropped, with the tree losing a level */
+	node = tree->root;
+	if (node->count != 0)
+		return;
+	if (h == 1) {
+		tree->root = NULL;
+		tree->head = NULL;
+		tree->tail = NULL;
+	} else {
+		tree->root = SP_BPTREE_CHILD(tree, node)[0];
+	}
+	free(node);
+	--tree->height;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bptree.h"
+#include <string.h>
+/* Fills an empty B+tree with n sorted keys and their values, level by level
+ * from the leaves up. Nodes are filled as evenly as possible, which leaves all
+ * of them at least half full. Nodes of each level are chained through their
+ * next pointers while the level above is built. Returns 1 on allocation
+ * failure, leaving the tree empty, and 0 otherwise. */
+int sp_bptree_bulkload(struct sp_bptree *tree, const char *keys, const char *vals, size_t n)
+{
+	struct sp_bptree_node *level[SP_BPTREE_MAX_HEIGHT], *node, *prev, *child;
+	const size_t ks = tree->key_size, vs = tree->val_size;
+	size_t h = 0, m, parts, i, j;
+
+	parts = (n + tree->leaf_cap - 1) / tree->leaf_cap;
+	level[0] = NULL;
+	for (i = 0, prev = NULL; i < parts; i++, prev = node) {
+		const size_t count = n / parts + (i < n % parts);
+		if ((node = malloc(tree->leaf_size)) == NULL)
+			goto fail;
+		node->prev  = prev;
+		node->next  = NULL;
+		node->count = count;
+		if (prev != NULL)
+			prev->next = node;
+		else
+			level[0] = node;
+		memcpy(SP_BPTREE_KEY(tree, node, 0), keys, count * ks);
+		keys += count * ks;
+		if (vs != 0) {
+			memcpy(SP_BPTREE_VAL(tree, node, 0), vals, count * vs);
+			vals += count * vs;
+		}
+	}
+	tree->tail = prev;
+
+	while (parts > 1) {
+		m     = parts;
+		parts = (m + tree->inner_cap) / (tree->inner_cap + 1);
+		child = level[h];
+		level[++h] = NULL;
+		for (i = 0, prev = NULL; i < parts; i++, prev = node) {
+			const size_t count = m / parts + (i < m % parts);
+			if ((node = malloc(tree->inner_size)) == NULL)
+				goto fail;
+			node->prev  = prev;
+			node->next  = NULL;
+			node->count = count - 1;
+			if (prev != NULL)
+				prev->next = node;
+			else
+				level[h] = node;
+			for (j = 0; j < count; j++, child = child->next) {
+				SP_BPTREE_CHILD(tree, node)[j] = child;
+				if (j > 0) {
+					/* The separator is the smallest key under the child */
+					const struct sp_bptree_node *min = child;
+					size_t d;
+					for (d = 1; d < h; d++)
+						min = SP_BPTREE_CHILD(tree, min)[0];
+					memcpy(SP_BPTREE_KEY(tree, node, j - 1), SP_BPTREE_KEY(tree, min, 0), ks);
+				}
+			}
+		}
+	}
+
+	/* Inner nodes are not chained */
+	for (i = 1; i <= h; i++) {
+		for (node = level[i]; node != NULL; node = prev) {
+			prev = node->next;
+			node->prev = NULL;
+			node->next = NULL;
+		}
+	}
+	tree->root   = level[h];
+	tree->head   = level[0];
+	tree->height = h + 1;
+	tree->size   = n;
+	return 0;
+
+fail:
+	/*. C_ERRMSG_MALLOC */
+	for (i = 0; i <= h; i++) {
+		for (node = level[i]; node != NULL; node = prev) {
+			prev = node->next;
+			free(node);
+		}
+	}
+	tree->tail = NULL;
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bptree.h"
+/* Frees a subtree of the given height of a B+tree */
+void sp_bptree_free(struct sp_bptree *tree, struct sp_bptree_node *node, size_t height)
+{
+	size_t i;
+	if (height > 1)
+		for (i = 0; i <= node->count; i++)
+			sp_bptree_free(tree, SP_BPTREE_CHILD(tree, node)[i], height - 1);
+	free(node);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+#include <string.h>
+/* Allocates an adaptive radix tree leaf holding copies of a key of len bytes
+ * and of its value */
+struct sp_art_leaf *sp_art_newleaf(const struct sp_art *art, const void *key, size_t len, const void *val)
+{
+	struct sp_art_leaf *ret;
+	if ((ret = malloc(art->val_offset + art->val_size + len)) == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	ret->type = SP_ART_LEAF;
+	ret->len  = len;
+	if (art->val_size != 0)
+		memcpy(SP_ART_VAL(art, ret), val, art->val_size);
+	if (len != 0)
+		memcpy(SP_ART_KEY(art, ret), key, len);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+#include <string.h>
+/* Allocates an empty inner node of an adaptive radix tree */
+void *sp_art_newnode(int type)
+{
+	static const size_t sizes[] = {
+		0,
+		sizeof(struct sp_art_node4),
+		sizeof(struct sp_art_node16),
+		sizeof(struct sp_art_node48),
+		sizeof(struct sp_art_node256),
+	};
+	struct sp_art_node *ret;
+	size_t i;
+
+	if ((ret = malloc(sizes[type])) == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	ret->type       = type;
+	ret->count      = 0;
+	ret->prefix_len = 0;
+	ret->term       = NULL;
+	if (type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)ret;
+		memset(n->index, 0, sizeof(n->index));
+		for (i = 0; i < 48; i++)
+			n->children[i] = NULL;
+	} else if (type == SP_ART_NODE256) {
+		struct sp_art_node256 *const n = (struct sp_art_node256*)ret;
+		for (i = 0; i < 256; i++)
+			n->children[i] = NULL;
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+/* Looks up the child of an inner node of an adaptive radix tree for the byte
+ * c, returning the address of the pointer to it, or NULL if there is none */
+void **sp_art_child(const struct sp_art_node *node, unsigned char c)
+{
+	size_t i, pos;
+	if (node->type == SP_ART_NODE4) {
+		struct sp_art_node4 *const n = (struct sp_art_node4*)node;
+		for (i = 0; i < node->count; i++)
+			if (n->keys[i] == c)
+				return &n->children[i];
+		return NULL;
+	}
+	if (node->type == SP_ART_NODE16) {
+		/* The keys are sorted, so that the position of c is the number of
+		 * keys below it, counted without branches over all 16 slots, in a
+		 * loop which compilers turn into SIMD instructions */
+		struct sp_art_node16 *const n = (struct sp_art_node16*)node;
+		for (i = 0, pos = 0; i < 16; i++)
+			pos += (n->keys[i] < c) & (i < node->count);
+		return pos < node->count && n->keys[pos] == c ? &n->children[pos] : NULL;
+	}
+	if (node->type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)node;
+		return n->index[c] != 0 ? &n->children[n->index[c] - 1] : NULL;
+	} else {
+		struct sp_art_node256 *const n = (struct sp_art_node256*)node;
+		return n->children[c] != NULL ? &n->children[c] : NULL;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+#include <string.h>
+/* Adds a child for the byte c to the inner node pointed to by *ref, which is
+ * replaced by a node of the next larger type if it is full. Returns 1 on
+ * allocation failure, leaving the node unchanged, and 0 otherwise. */
+int sp_art_addchild(void **ref, unsigned char c, void *child)
+{
+	struct sp_art_node *const node = *ref, *grown;
+	size_t i, pos;
+
+	if (node->type == SP_ART_NODE4 || node->type == SP_ART_NODE16) {
+		const size_t cap = node->type == SP_ART_NODE4 ? 4 : 16;
+		unsigned char *const keys = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->keys : ((struct sp_art_node16*)node)->keys;
+		void **const children = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->children : ((struct sp_art_node16*)node)->children;
+		if (node->count < cap) {
+			for (pos = 0; pos < node->count && keys[pos] < c; pos++)
+				;
+			memmove(keys + pos + 1, keys + pos, node->count - pos);
+			memmove(children + pos + 1, children + pos, (node->count - pos) * sizeof(*children));
+			keys[pos]     = c;
+			children[pos] = child;
+			++node->count;
+			return 0;
+		}
+		if ((grown = sp_art_newnode(node->type + 1)) == NULL)
+			return 1;
+		memcpy(grown, node, sizeof(*node));
+		grown->type = node->type + 1;
+		if (node->type == SP_ART_NODE4) {
+			struct sp_art_node16 *const n = (struct sp_art_node16*)grown;
+			memcpy(n->keys, keys, 4);
+			memcpy(n->children, children, 4 * sizeof(*children));
+		} else {
+			struct sp_art_node48 *const n = (struct sp_art_node48*)grown;
+			for (i = 0; i < 16; i++) {
+				n->index[keys[i]] = i + 1;
+				n->children[i]    = children[i];
+			}
+		}
+	} else if (node->type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)node;
+		if (node->count < 48) {
+			for (i = 0; n->children[i] != NULL; i++)
+				;
+			n->children[i] = child;
+			n->index[c]    = i + 1;
+			++node->count;
+			return 0;
+		}
+		if ((grown = sp_art_newnode(SP_ART_NODE256)) == NULL)
+			return 1;
+		memcpy(grown, node, sizeof(*node));
+		grown->type = SP_ART_NODE256;
+		for (i = 0; i < 256; i++)
+			if (n->index[i] != 0)
+				((struct sp_art_node256*)grown)->children[i] = n->children[n->index[i] - 1];
+	} else {
+		((struct sp_art_node256*)node)->children[c] = child;
+		++node->count;
+		return 0;
+	}
+
+	free(node);
+	*ref = grown;
+	return sp_art_addchild(ref, c, child);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+#include <string.h>
+/* Removes the child for the byte c from the inner node pointed to by *ref,
+ * which is then shrunk if needed */
+void sp_art_delchild(void **ref, unsigned char c)
+{
+	struct sp_art_node *const node = *ref;
+	size_t i;
+
+	if (node->type == SP_ART_NODE4 || node->type == SP_ART_NODE16) {
+		unsigned char *const keys = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->keys : ((struct sp_art_node16*)node)->keys;
+		void **const children = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->children : ((struct sp_art_node16*)node)->children;
+		for (i = 0; keys[i] != c; i++)
+			;
+		memmove(keys + i, keys + i + 1, node->count - i - 1);
+		memmove(children + i, children + i + 1, (node->count - i - 1) * sizeof(*children));
+	} else if (node->type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)node;
+		n->children[n->index[c] - 1] = NULL;
+		n->index[c] = 0;
+	} else {
+		((struct sp_art_node256*)node)->children[c] = NULL;
+	}
+	--node->count;
+	sp_art_shrink(ref);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+#include <string.h>
+/* Replaces the inner node pointed to by *ref, which has just lost a child or
+ * its terminal leaf, by its only remaining child or leaf, or by a node of a
+ * smaller type once few enough children are left. A node is only shrunk well
+ * below the capacity of the smaller type, so that alternating insertions and
+ * removals do not resize it every time. Shrinking is skipped if allocation
+ * fails, as the node stays valid. */
+void sp_art_shrink(void **ref)
+{
+	struct sp_art_node *const node = *ref;
+	struct sp_art_node *shrunk;
+	size_t i, j;
+
+	if (node->count + (node->term != NULL) == 1) {
+		void *child;
+		i = 0;
+		if (node->term != NULL) {
+			*ref = node->term;
+		} else if (SP_ART_TYPE(child = sp_art_next(node, &i)) == SP_ART_LEAF) {
+			*ref = child;
+		} else {
+			/* The only child takes over the path of the node, followed by
+			 * the byte leading to the child and the path of the child */
+			struct sp_art_node *const next = child;
+			unsigned char prefix[SP_ART_PREFIX];
+			size_t n = MIN(node->prefix_len, SP_ART_PREFIX);
+			memcpy(prefix, node->prefix, n);
+			if (n < SP_ART_PREFIX) {
+				for (j = 0; j < 256 && sp_art_child(node, (unsigned char)j) == NULL; j++)
+					;
+				prefix[n++] = (unsigned char)j;
+			}
+			if (n < SP_ART_PREFIX)
+				memcpy(prefix + n, next->prefix, MIN(next->prefix_len, SP_ART_PREFIX - n));
+			next->prefix_len += node->prefix_len + 1;
+			memcpy(next->prefix, prefix, MIN(next->prefix_len, SP_ART_PREFIX));
+			*ref = next;
+		}
+		free(node);
+		return;
+	}
+
+	if (node->type == SP_ART_NODE256 && node->count <= 37) {
+		const struct sp_art_node256 *const n = (const struct sp_art_node256*)node;
+		struct sp_art_node48 *s;
+		if ((shrunk = sp_art_newnode(SP_ART_NODE48)) == NULL)
+			return;
+		s = (struct sp_art_node48*)shrunk;
+		for (i = 0, j = 0; i < 256; i++) {
+			if (n->children[i] != NULL) {
+				s->index[i]      = j + 1;
+				s->children[j++] = n->children[i];
+			}
+		}
+	} else if (node->type == SP_ART_NODE48 && node->count <= 12) {
+		const struct sp_art_node48 *const n = (const struct sp_art_node48*)node;
+		struct sp_art_node16 *s;
+		if ((shrunk = sp_art_newnode(SP_ART_NODE16)) == NULL)
+			return;
+		s = (struct sp_art_node16*)shrunk;
+		for (i = 0, j = 0; i < 256; i++) {
+			if (n->index[i] != 0) {
+				s->keys[j]       = i;
+				s->children[j++] = n->children[n->index[i] - 1];
+			}
+		}
+	} else if (node->type == SP_ART_NODE16 && node->count <= 3) {
+		const struct sp_art_node16 *const n = (const struct sp_art_node16*)node;
+		struct sp_art_node4 *s;
+		if ((shrunk = sp_art_newnode(SP_ART_NODE4)) == NULL)
+			return;
+		s = (struct sp_art_node4*)shrunk;
+		memcpy(s->keys, n->keys, node->count);
+		memcpy(s->children, n->children, node->count * sizeof(*s->children));
+	} else {
+		return;
+	}
+	i = shrunk->type;
+	memcpy(shrunk, node, sizeof(*node));
+	shrunk->type = i;
+	free(node);
+	*ref = shrunk;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+/* Returns the first child of an inner node of an adaptive radix tree at or
+ * after position *pos, in ascending order of bytes, and moves *pos past it.
+ * Returns NULL if there are no more children. */
+void *sp_art_next(const struct sp_art_node *node, size_t *pos)
+{
+	if (node->type == SP_ART_NODE4 || node->type == SP_ART_NODE16) {
+		void *const *const children = node->type == SP_ART_NODE4 ?
+			((const struct sp_art_node4*)node)->children : ((const struct sp_art_node16*)node)->children;
+		return *pos < node->count ? children[(*pos)++] : NULL;
+	}
+	if (node->type == SP_ART_NODE48) {
+		const struct sp_art_node48 *const n = (const struct sp_art_node48*)node;
+		for (; *pos < 256; ++*pos)
+			if (n->index[*pos] != 0)
+				return n->children[n->index[(*pos)++] - 1];
+	} else {
+		const struct sp_art_node256 *const n = (const struct sp_art_node256*)node;
+		for (; *pos < 256; ++*pos)
+			if (n->children[*pos] != NULL)
+				return n->children[(*pos)++];
+	}
+	return NULL;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+/* Returns the number of bytes of the compressed path of an inner node, which
+ * starts at depth, that match a key of len bytes. Only the first SP_ART_PREFIX
+ * bytes of the path are stored in the node, and the rest is read from the key
+ * of any leaf below it. */
+size_t sp_art_mismatch(const struct sp_art *art, const struct sp_art_node *node, const unsigned char *key, size_t len, size_t depth)
+{
+	const size_t max = MIN(node->prefix_len, len - depth);
+	size_t i;
+	for (i = 0; i < max && i < SP_ART_PREFIX; i++)
+		if (node->prefix[i] != key[depth + i])
+			return i;
+	if (i < max) {
+		const unsigned char *const k = SP_ART_KEY(art, sp_art_minleaf(node));
+		for (; i < max; i++)
+			if (k[depth + i] != key[depth + i])
+				return i;
+	}
+	return max;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+/* Returns the leaf with the smallest key under a node of an adaptive radix
+ * tree. A terminal leaf is a prefix of all other keys below its node. */
+struct sp_art_leaf *sp_art_minleaf(const void *node)
+{
+	size_t pos;
+	while (SP_ART_TYPE(node) != SP_ART_LEAF) {
+		const struct sp_art_node *const n = node;
+		if (n->term != NULL)
+			return n->term;
+		pos  = 0;
+		node = sp_art_next(n, &pos);
+	}
+	return (struct sp_art_leaf*)node;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+#include <stdio.h>
+/* Calls func on the key, key length and value of every element under a node
+ * of an adaptive radix tree, in lexicographic order of keys, stopping at the
+ * first non-0 return value, which is returned. If idx is not NULL, every
+ * element is printed after its index, which is counted in *idx, and func may
+ * then be NULL to print the key and the address of the value instead. */
+int sp_art_walk(const struct sp_art *art, const void *node, int (*func)(const void*, size_t, void*), size_t *idx)
+{
+	const struct sp_art_node *const n = node;
+	const void *child;
+	size_t pos = 0;
+	int err;
+
+	if (SP_ART_TYPE(node) == SP_ART_LEAF) {
+		const struct sp_art_leaf *const leaf = node;
+		if (idx != NULL) {
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)(*idx)++);
+			if (func == NULL) {
+				const unsigned char *const key = SP_ART_KEY(art, leaf);
+				size_t i;
+				for (i = 0; i < leaf->len; i++) {
+					if (key[i] >= 0x20 && key[i] < 0x7f && key[i] != '\\')
+						putchar(key[i]);
+					else
+						printf("\\x%02x", key[i]);
+				}
+				printf("\t%p\n", (void*)SP_ART_VAL(art, leaf));
+				return 0;
+			}
+		}
+		return func(SP_ART_KEY(art, leaf), leaf->len, SP_ART_VAL(art, leaf));
+	}
+	if (n->term != NULL && (err = sp_art_walk(art, n->term, func, idx)))
+		return err;
+	while ((child = sp_art_next(n, &pos)) != NULL)
+		if ((err = sp_art_walk(art, child, func, idx)))
+			return err;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+/* Calls dtor on the value of every element under a node of an adaptive radix
+ * tree, stopping at the first non-0 return value, which is returned */
+int sp_art_dtor(const struct sp_art *art, const void *node, int (*dtor)(void*))
+{
+	const struct sp_art_node *const n = node;
+	const void *child;
+	size_t pos = 0;
+	int err;
+	if (SP_ART_TYPE(node) == SP_ART_LEAF)
+		return dtor(SP_ART_VAL(art, node));
+	if (n->term != NULL && (err = dtor(SP_ART_VAL(art, n->term))))
+		return err;
+	while ((child = sp_art_next(n, &pos)) != NULL)
+		if ((err = sp_art_dtor(art, child, dtor)))
+			return err;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_art.h"
+/* Frees a subtree of an adaptive radix tree */
+void sp_art_free(void *node)
+{
+	struct sp_art_node *const n = node;
+	void *child;
+	size_t pos = 0;
+	if (SP_ART_TYPE(node) != SP_ART_LEAF) {
+		free(n->term);
+		while ((child = sp_art_next(n, &pos)) != NULL)
+			sp_art_free(child);
+	}
+	free(node);
+}
+/*F}*/
+
+/*F{*/
+/* Hashes data with the 32-bit MurmurHash3, reading it byte by byte, so that
+ * the hash, which is returned in the low 32 bits, is the same on all machines
+ * and serialized bloom filters can be shared between them */
+unsigned long sp_bloom_hash(const void *data, size_t len)
+{
+	const unsigned char *const p = data;
+	unsigned long h = 0, k;
+	size_t i, j;
+	for (i = 0; i + 4 <= len; i += 4) {
+		k = (unsigned long)p[i] | (unsigned long)p[i + 1] << 8
+			| (unsigned long)p[i + 2] << 16 | (unsigned long)p[i + 3] << 24;
+		k = k * 0xCC9E2D51UL & 0xFFFFFFFFUL;
+		k = (k << 15 | k >> 17) & 0xFFFFFFFFUL;
+		k = k * 0x1B873593UL & 0xFFFFFFFFUL;
+		h ^= k;
+		h = (h << 13 | h >> 19) & 0xFFFFFFFFUL;
+		h = (h * 5 + 0xE6546B64UL) & 0xFFFFFFFFUL;
+	}
+	if (len % 4 != 0) {
+		for (k = 0, j = len % 4; j > 0; j--)
+			k = k << 8 | p[i + j - 1];
+		k = k * 0xCC9E2D51UL & 0xFFFFFFFFUL;
+		k = (k << 15 | k >> 17) & 0xFFFFFFFFUL;
+		k = k * 0x1B873593UL & 0xFFFFFFFFUL;
+		h ^= k;
+	}
+	h ^= (unsigned long)len & 0xFFFFFFFFUL;
+	SP_BLOOM_MIX(h);
+	return h;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bloom.h"
+/* Visits the bits of an element in a bloom filter, setting them if set is
+ * non-0. Returns 1 if all of them were already set, and 0 otherwise. The bits
+ * are picked by double hashing: the i-th one is h1 + i * h2 modulo the number
+ * of bits, where h2 is derived from the hash h1 of the element. */
+int sp_bloom_probe(const struct sp_bloom *bloom, const void *data, size_t len, int set)
+{
+	unsigned long *const words = bloom->bits->data + bloom->offset;
+	unsigned long h1 = sp_bloom_hash(data, len), h2 = h1 ^ 0x5BD1E995UL, delta;
+	size_t i, m, bit, pos, step, base = 0;
+	int ret = 1;
+
+	SP_BLOOM_MIX(h2);
+	if (bloom->blocked) {
+		/* All bits of an element lie in one block, picked by h1. h2 walks
+		 * the 32-bit space in steps of delta and is remixed after every
+		 * step, and the bits are taken from its top 9 bits, so that they
+		 * do not form a progression which other elements of the block
+		 * would repeat */
+		base  = h1 % (bloom->nbits / SP_BLOOM_BLOCK) * SP_BLOOM_BLOCK;
+		delta = ((h2 >> 15 | h2 << 17) & 0xFFFFFFFFUL) | 1;
+		m = pos = step = 0;
+	} else {
+		/* Filters of more than 2^32 bits take h2 as the high half of a
+		 * 64-bit starting position */
+		m     = bloom->nbits;
+		pos   = (m >> 16 >> 16 != 0 ? (size_t)h2 << 16 << 16 | h1 : h1) % m;
+		step  = h2 % m != 0 ? h2 % m : 1;
+		delta = 0;
+	}
+	for (i = 0; i < bloom->nhashes; i++) {
+		unsigned long mask;
+		if (bloom->blocked) {
+			bit = base + (size_t)(h2 >> 23);
+			h2  = (h2 + delta) * 0x9E3779B9UL & 0xFFFFFFFFUL;
+		} else {
+			bit  = pos;
+			pos += step;
+			if (pos >= m)
+				pos -= m;
+		}
+		mask = 1UL << bit % SP_WORD_BIT;
+		if (!(words[bit / SP_WORD_BIT] & mask)) {
+			if (!set)
+				return 0;
+			words[bit / SP_WORD_BIT] |= mask;
+			ret = 0;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bloom.h"
+/* Allocates an empty bloom filter of nbits bits, which must be a multiple of
+ * 64, or of SP_BLOOM_BLOCK if it is blocked */
+struct sp_bloom *sp_bloom_alloc(size_t nbits, size_t nhashes, int blocked)
+{
+	struct sp_bloom *ret;
+	const size_t total = nbits + (blocked ? SP_BLOOM_BLOCK : 0);
+
+	if ((ret = malloc(sizeof(*ret))) == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	if ((ret->bits = sp_bitarray_create(total)) == NULL) {
+		free(ret);
+		return NULL;
+	}
+	if (sp_bitarray_resize(ret->bits, total)) {
+		sp_bitarray_destroy(ret->bits);
+		free(ret);
+		return NULL;
+	}
+
+	/* Blocked filters get one spare block, so that they can start at the
+	 * first word aligned to a cache line, and every block fits in one */
+	ret->offset = 0;
+	if (blocked) {
+		const size_t line = SP_BLOOM_BLOCK / CHAR_BIT;
+		ret->offset = (line - (size_t)ret->bits->data % line) % line / sizeof(*ret->bits->data);
+	}
+	ret->nbits   = nbits;
+	ret->nhashes = nhashes;
+	ret->size    = 0;
+	ret->blocked = blocked != 0;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_bloom.h"
+/* Estimates the number of elements in a bloom filter of m bits and k hashes
+ * from the number x of its bits which are set, as -m / k * ln (1 - x / m), a
+ * full filter being counted as one bit short of full */
+size_t sp_bloom_estimate(const struct sp_bloom *bloom)
+{
+	const double m = (double)bloom->nbits;
+	double x = (double)sp_bitarray_count(bloom->bits), n;
+	if (x >= m)
+		x = m - 1;
+	n = -m / (double)bloom->nhashes * sp_log(1 - x / m);
+	return n >= (double)SP_SIZE_MAX ? SP_SIZE_MAX : (size_t)(n + 0.5);
+}
+/*F}*/
+
+/*F{*/
+/* Natural logarithm of a positive number, which spares the library a
+ * dependency on the math library. The number x is scaled by powers of 2 into
+ * [1, 2), where ln x = 2 atanh z with z = (x - 1) / (x + 1), whose series
+ * converges to double precision within 20 terms. */
+double sp_log(double x)
+{
+	const double ln2 = 0.69314718055994530942;
+	double z, z2, term, ret = 0;
+	int e = 0, i;
+	while (x >= 2) {
+		x /= 2;
+		e++;
+	}
+	while (x < 1) {
+		x *= 2;
+		e--;
+	}
+	z    = (x - 1) / (x + 1);
+	z2   = z * z;
+	term = z;
+	for (i = 1; i < 40; i += 2) {
+		ret  += term / i;
+		term *= z2;
+	}
+	return 2 * ret + e * ln2;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_slotmap.h"
+/* Doubles the capacity of all buffers of a slot map. Return values are
+ * identical to sp_buf_fit. */
+int sp_slotmap_reserve(struct sp_slotmap *sm)
+{
+	const size_t max = MIN(SP_SIZE_MAX / MAX(sm->elem_size, sizeof(struct sp_slotmap_slot)),
+			(size_t)SP_SLOTMAP_MAX);
+	size_t capacity;
+	void *p;
+
+	if (sm->capacity >= max) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return 2;
+	}
+	capacity = sm->capacity <= max / 2 ? sm->capacity * 2 : max;
+
+	/* A failure leaves the larger buffers in place, which is harmless */
+	if ((p = realloc(sm->data, capacity * sm->elem_size)) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	sm->data = p;
+	if ((p = realloc(sm->owner, capacity * sizeof(size_t))) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	sm->owner = p;
+	if ((p = realloc(sm->slots, capacity * sizeof(struct sp_slotmap_slot))) == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	sm->slots    = p;
+	sm->capacity = capacity;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_slotmap.h"
+/* Appends an uninitialized element to a slot map, which the caller has to
+ * fill in at position size - 1, and gives it a slot. Returns 0, or SP_ERANGE
+ * or SP_ENOMEM if the map could not grow. */
+int sp_slotmap_acquire(struct sp_slotmap *sm, struct sp_slotmap_handle *handle)
+{
+	struct sp_slotmap_slot *slot;
+	size_t idx;
+	int err;
+
+	/* Slots are reused in the order they were freed, so that generations
+	 * of any single slot advance as slowly as possible */
+	if (sm->nfree == 0) {
+		if (sm->count == sm->capacity && (err = sp_slotmap_reserve(sm)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		idx = sm->count++;
+		sm->slots[idx].gen = 0;
+	} else {
+		idx = sm->head;
+		sm->head = sm->slots[idx].pos;
+		--sm->nfree;
+	}
+	slot = sm->slots + idx;
+	++slot->gen;
+	slot->pos = sm->size;
+	sm->owner[sm->size++] = idx;
+	if (handle != NULL) {
+		handle->idx = (unsigned long)idx;
+		handle->gen = slot->gen;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_slotmap.h"
+#include <string.h>
+/* Removes the element at position pos of a slot map, and frees its slot */
+void sp_slotmap_release(struct sp_slotmap *sm, size_t pos)
+{
+	const size_t idx = sm->owner[pos], last = --sm->size;
+	struct sp_slotmap_slot *const slot = sm->slots + idx;
+
+	/* The last element fills the hole, and its slot follows it */
+	if (pos != last) {
+		memcpy(SP_SLOTMAP_ELEM(sm, pos), SP_SLOTMAP_ELEM(sm, last), sm->elem_size);
+		sm->owner[pos] = sm->owner[last];
+		sm->slots[sm->owner[pos]].pos = pos;
+	}
+
+	/* A slot whose generation wraps around is never used again, as its
+	 * old handles would become valid */
+	slot->gen = (slot->gen + 1) & SP_SLOTMAP_MAX;
+	if (slot->gen == 0)
+		return;
+	if (sm->nfree++ == 0)
+		sm->head = idx;
+	else
+		sm->slots[sm->tail].pos = idx;
+	sm->tail = idx;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_lru.h"
+/* Empties an LRU cache, without touching its counters */
+void sp_lru_reset(struct sp_lru *lru)
+{
+	size_t i;
+	for (i = 0; i < lru->capacity; i++)
+		lru->entries[i].next = i + 1;
+	lru->size   = 0;
+	lru->weight = 0;
+	lru->head   = lru->capacity;
+	lru->tail   = lru->capacity;
+	lru->free   = 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_lru.h"
+/* Links an entry of an LRU cache in front of the recency list */
+void sp_lru_link(struct sp_lru *lru, size_t idx)
+{
+	struct sp_lru_entry *const e = lru->entries + idx;
+	e->prev = lru->capacity;
+	e->next = lru->head;
+	if (lru->head != lru->capacity)
+		lru->entries[lru->head].prev = idx;
+	else
+		lru->tail = idx;
+	lru->head = idx;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_lru.h"
+/* Takes an entry of an LRU cache out of the recency list */
+void sp_lru_unlink(struct sp_lru *lru, size_t idx)
+{
+	const struct sp_lru_entry *const e = lru->entries + idx;
+	if (e->prev != lru->capacity)
+		lru->entries[e->prev].next = e->next;
+	else
+		lru->head = e->next;
+	if (e->next != lru->capacity)
+		lru->entries[e->next].prev = e->prev;
+	else
+		lru->tail = e->prev;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_lru.h"
+/* Takes an entry out of an LRU cache, and its key out of the index, where it
+ * is at slot. The key is not looked at, as destructors may have freed it. */
+void sp_lru_drop(struct sp_lru *lru, size_t idx, size_t slot)
+{
+	struct sp_lru_entry *const e = lru->entries + idx;
+	sp_lru_unlink(lru, idx);
+	sp_hashtab_erase(lru->index, slot);
+	lru->weight -= e->weight;
+	--lru->size;
+	e->next   = lru->free;
+	lru->free = idx;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_lru.h"
+#include "../sp_errcodes.h"
+/* Evicts the least recently used entry of a non-empty LRU cache. Returns 0,
+ * or SP_ECALLBK if the eviction callback failed, in which case the entry
+ * stays. */
+int sp_lru_evict(struct sp_lru *lru)
+{
+	const size_t idx = lru->tail;
+	const size_t slot = sp_hashtab_find(lru->index, SP_LRU_KEY(lru, idx), SP_HASH(lru->index, SP_LRU_KEY(lru, idx)));
+	int err;
+	if (lru->evict != NULL && (err = lru->evict(SP_LRU_KEY(lru, idx), SP_LRU_VAL(lru, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO evict err */
+		return SP_ECALLBK;
+	}
+	sp_lru_drop(lru, idx, slot);
+	++lru->evictions;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_wheel.h"
+/* Makes a freshly allocated node a pending timer, due delay ticks from now,
+ * or on the next tick if delay is 0, and fills in its handle if one is given.
+ */
+void sp_wheel_arm(struct sp_wheel *wheel, struct sp_wheel_node *node, unsigned long delay, struct sp_wheel_handle *handle)
+{
+	node->expiry = wheel->now + (delay == 0 ? 1 : delay);
+	++node->gen;
+	sp_wheel_place(wheel, node);
+	++wheel->size;
+	if (handle != NULL) {
+		handle->node = node;
+		handle->gen  = node->gen;
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_wheel.h"
+/* Links a pending timer at the back of the slot of its expiry. Counting from
+ * the next tick to be processed, a timer goes on the lowest level whose slots
+ * span its delay, where the slot is picked by the bits of the expiry which
+ * that level resolves. Timers on higher levels are cascaded down when their
+ * slot comes up, which is never before the tick they are due on.
+ */
+void sp_wheel_place(struct sp_wheel *wheel, struct sp_wheel_node *node)
+{
+	const unsigned long delta = node->expiry - (wheel->now + 1);
+	struct sp_wheel_link *slot;
+	int level = 0;
+
+	while (level < SP_WHEEL_LEVELS - 1 && (delta >> ((level + 1) * SP_WHEEL_BITS)) != 0)
+		++level;
+	slot = &wheel->slots[level * SP_WHEEL_SLOTS + ((node->expiry >> (level * SP_WHEEL_BITS)) & (SP_WHEEL_SLOTS - 1))];
+	node->link.prev  = slot->prev;
+	node->link.next  = slot;
+	slot->prev->next = &node->link;
+	slot->prev       = &node->link;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_wheel.h"
+/* Gives an unlinked timer back to the pool of its wheel. Bumping the
+ * generation invalidates every handle to it. A node whose generation wraps
+ * around is never used again, as its old handles would become valid. */
+void sp_wheel_release(struct sp_wheel *wheel, struct sp_wheel_node *node)
+{
+	if (++node->gen != 0)
+		sp_pool_give(&wheel->pool, node);
+	--wheel->size;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_wheel.h"
+/* Empties the slot which the next tick selects on a level above the first, and
+ * places its timers again, on the levels below.
+ */
+void sp_wheel_cascade(struct sp_wheel *wheel, int level)
+{
+	struct sp_wheel_link *const slot = &wheel->slots[level * SP_WHEEL_SLOTS + (((wheel->now + 1) >> (level * SP_WHEEL_BITS)) & (SP_WHEEL_SLOTS - 1))];
+	struct sp_wheel_link *link = slot->next;
+
+	slot->next = slot->prev = slot;
+	while (link != slot) {
+		struct sp_wheel_node *const node = (struct sp_wheel_node*)link;
+		link = link->next;
+		sp_wheel_place(wheel, node);
+	}
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pool.h"
+/* Initializes an object pool in place, with a first slab of capacity blocks,
+ * so that other modules can embed a pool as their node allocator. Every block
+ * is large enough to hold the free list link, and padded to keep the next one
+ * aligned. Returns 2 on size_t overflow, 1 on allocation failure and 0
+ * otherwise.
+ */
+int sp_pool_init(struct sp_pool *pool, size_t block_size, size_t capacity, int (*ctor)(void*), int (*dtor)(void*))
+{
+	const size_t align = MAX(SP_ALIGNOF_SIZE(block_size), sizeof(void*));
+	int err;
+
+	if (block_size > SP_SIZE_MAX / 2 - 16) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return 2;
+	}
+	pool->slabs      = NULL;
+	pool->free       = NULL;
+	pool->tail       = NULL;
+	pool->block_size = block_size;
+	pool->stride     = (MAX(block_size, sizeof(void*)) + align - 1) / align * align;
+	pool->size       = 0;
+	pool->capacity   = 0;
+	pool->nslabs     = 0;
+	pool->used       = 0;
+	pool->left       = 0;
+	pool->ctor       = ctor;
+	pool->dtor       = dtor;
+	if (capacity != 0 && (err = sp_pool_grow(pool, capacity))) {
+		free(pool->slabs);
+		return err;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pool.h"
+/* Frees the slabs of a pool initialized with sp_pool_init, without invoking
+ * any hooks. */
+void sp_pool_fini(struct sp_pool *pool)
+{
+	size_t i;
+	for (i = 0; i < pool->nslabs; i++)
+		free(pool->slabs[i].data);
+	free(pool->slabs);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pool.h"
+/* Appends a slab of at least n blocks to a pool, and twice as many as the last
+ * slab otherwise. Blocks are only carved out of it once the slabs before it are
+ * used up. Returns 2 on size_t overflow, 1 on allocation failure and 0
+ * otherwise.
+ */
+int sp_pool_grow(struct sp_pool *pool, size_t n)
+{
+	const size_t limit = SP_SIZE_MAX / pool->stride;
+	struct sp_pool_slab *slabs;
+	size_t size = pool->nslabs == 0 ? 0 : pool->slabs[pool->nslabs - 1].size;
+
+	size = size == 0 ? n : size > limit / 2 ? limit : MAX(size * 2, n);
+	if (n > limit || sp_size_try_add(pool->capacity, size) || pool->nslabs >= SP_SIZE_MAX / sizeof(*slabs)) {
+		error(("size_t overflow detected, pool size limit reached"));
+		return 2;
+	}
+	slabs = realloc(pool->slabs, (pool->nslabs + 1) * sizeof(*slabs));
+	if (slabs == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	pool->slabs = slabs;
+	slabs[pool->nslabs].data = malloc(size * pool->stride);
+	if (slabs[pool->nslabs].data == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return 1;
+	}
+	slabs[pool->nslabs].size = size;
+	++pool->nslabs;
+	pool->capacity += size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pool.h"
+/* Takes a block from the free list of a pool, or carves it out of the slabs,
+ * moving on to the next slab once the current one is used up and appending a
+ * new one if there is none left. No hooks are invoked, which lets modules that
+ * embed a pool keep their own error handling. Returns 2 on size_t overflow, 1
+ * on allocation failure and 0 otherwise.
+ */
+int sp_pool_take(struct sp_pool *pool, void **block)
+{
+	int err;
+	if (pool->free != NULL) {
+		*block = pool->free;
+		pool->free = *(void**)pool->free;
+	} else {
+		if (pool->left == 0) {
+			if (pool->used == pool->nslabs && (err = sp_pool_grow(pool, 1)))
+				return err;
+			pool->left = pool->slabs[pool->used++].size;
+		}
+		*block = SP_POOL_CARVE(pool);
+	}
+	++pool->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pool.h"
+/* Puts a block back on the free list of a pool, without invoking any hooks */
+void sp_pool_give(struct sp_pool *pool, void *block)
+{
+	if (pool->free == NULL)
+		pool->tail = block;
+	*(void**)block = pool->free;
+	pool->free = block;
+	--pool->size;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_pool.h"
+#include <string.h>
+/* Hands every slab of src over to dest, which must have the same stride. The
+ * blocks in use stay where they are. Slabs which src has carved blocks out of
+ * go before the slab dest is carving, so that carving goes on where it was,
+ * and the others go right after it. The free list of src is appended to that
+ * of dest, and if dest is carving a slab as well, what is left of the slab src
+ * was carving goes on the free list too, so that no block is lost. src is left
+ * without slabs. Returns 2 on size_t overflow, 1 on allocation failure and 0
+ * otherwise.
+ */
+int sp_pool_merge(struct sp_pool *dest, struct sp_pool *src)
+{
+	struct sp_pool_slab *slabs;
+	const size_t pos = dest->used == 0 ? 0 : dest->used - 1, cur = dest->used != 0;
+
+	if (src->nslabs == 0)
+		return 0;
+	if (src->nslabs > SP_SIZE_MAX / sizeof(*slabs) - dest->nslabs || sp_size_try_add(dest->capacity, src->capacity)) {
+		error(("size_t overflow detected, pool size limit reached"));
+		return 2;
+	}
+	slabs = realloc(dest->slabs, (dest->nslabs + src->nslabs) * sizeof(*slabs));
+	if (slabs == NULL) {
+		/*. C_ERRMSG_REALLOC */
+		return 1;
+	}
+	memmove(slabs + pos + cur + src->nslabs, slabs + pos + cur, (dest->nslabs - pos - cur) * sizeof(*slabs));
+	if (cur)
+		slabs[pos + src->used] = slabs[pos];
+	memcpy(slabs + pos, src->slabs, src->used * sizeof(*slabs));
+	memcpy(slabs + pos + src->used + cur, src->slabs + src->used, (src->nslabs - src->used) * sizeof(*slabs));
+
+	dest->slabs = slabs;
+	if (src->free != NULL) {
+		if (dest->free == NULL)
+			dest->free = src->free;
+		else
+			*(void**)dest->tail = src->free;
+		dest->tail = src->tail;
+	}
+	if (cur) {
+		/* The slab src was carving now lies among the used up ones */
+		while (src->left != 0) {
+			void *const block = SP_POOL_CARVE(src);
+			if (dest->free == NULL)
+				dest->tail = block;
+			*(void**)block = dest->free;
+			dest->free = block;
+		}
+		dest->used += src->used;
+	} else {
+		dest->used = src->used;
+		dest->left = src->left;
+	}
+	dest->nslabs   += src->nslabs;
+	dest->size     += src->size;
+	dest->capacity += src->capacity;
+
+	free(src->slabs);
+	src->slabs    = NULL;
+	src->free     = NULL;
+	src->tail     = NULL;
+	src->size     = 0;
+	src->capacity = 0;
+	src->nslabs   = 0;
+	src->used     = 0;
+	src->left     = 0;
+	return 0;
+}
+/*F}*/
+
 /*F{*/
 size_t sp_strnlen(const char *s, size_t maxlen)
 {
@@ -0,0 +1,462 @@
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_ipqueue *sp_ipqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*))
+{
+	struct sp_ipqueue *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	/*. C_ERR_CAPACITY_ZERO */
+	if (arity == 1) {
+		error(("arity must be at least 2"));
+		return NULL;
+	}
+	if (order != SP_PQUEUE_MIN && order != SP_PQUEUE_MAX) {
+		error(("order must be SP_PQUEUE_MIN or SP_PQUEUE_MAX"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(elem_size, sizeof(size_t))) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = 0;
+	ret->count     = 0;
+	ret->capacity  = capacity;
+	ret->arity     = arity ? arity : SP_PQUEUE_ARITY;
+	ret->order     = order;
+	ret->cmp       = cmp;
+	ret->data      = malloc(capacity * elem_size);
+	ret->heap      = malloc(capacity * sizeof(size_t));
+	ret->pos       = malloc(capacity * sizeof(size_t));
+	if (ret->data == NULL || ret->heap == NULL || ret->pos == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret->data);
+		free(ret->heap);
+		free(ret->pos);
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ipqueue_clear(struct sp_ipqueue *ipq, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+#endif
+	if (dtor != NULL) {
+		size_t i;
+		for (i = 0; i < ipq->size; i++) {
+			int err;
+			if ((err = dtor(SP_IPQUEUE_ELEM(ipq, ipq->heap[i])))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	ipq->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_ipqueue_destroy(struct sp_ipqueue *ipq, int (*dtor)(void*))
+{
+	int error;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+#endif
+	if ((error = sp_ipqueue_clear(ipq, dtor)))
+		return SP_ECALLBK;
+	free(ipq->data);
+	free(ipq->heap);
+	free(ipq->pos);
+	free(ipq);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_ipqueue_push(struct sp_ipqueue *ipq, const void *elem, size_t *handle)
+{
+	size_t h;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Reuse the most recently freed handle, if there is one */
+	if (ipq->size == ipq->count) {
+		if ((err = sp_ipqueue_reserve(ipq)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		ipq->heap[ipq->size] = ipq->count;
+		ipq->pos[ipq->count] = ipq->size;
+		++ipq->count;
+	}
+	h = ipq->heap[ipq->size];
+	memcpy(SP_IPQUEUE_ELEM(ipq, h), elem, ipq->elem_size);
+	sp_ipqueue_siftup(ipq, ipq->size++);
+	if (handle != NULL)
+		*handle = h;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ipqueue_push$SUFFIX$(struct sp_ipqueue *ipq, $TYPE$ elem, size_t *handle)
+{
+	size_t h;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq elem SP_EILLEGAL */
+#endif
+	/* See sp_ipqueue_push() */
+	if (ipq->size == ipq->count) {
+		if ((err = sp_ipqueue_reserve(ipq)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		ipq->heap[ipq->size] = ipq->count;
+		ipq->pos[ipq->count] = ipq->size;
+		++ipq->count;
+	}
+	h = ipq->heap[ipq->size];
+	(($TYPE$*)ipq->data)[h] = elem;
+	if (ipq->order == SP_PQUEUE_MIN)
+		SP_IPQUEUE_SIFTUP($TYPE$, ipq, ipq->size, SP_PQUEUE_LT);
+	else
+		SP_IPQUEUE_SIFTUP($TYPE$, ipq, ipq->size, SP_PQUEUE_GT);
+	++ipq->size;
+	if (handle != NULL)
+		*handle = h;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_ipqueue_peek(const struct sp_ipqueue *ipq)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq NULL */
+	if (ipq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ipq */
+		return NULL;
+	}
+#endif
+	return SP_IPQUEUE_ELEM(ipq, ipq->heap[0]);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_ipqueue_peek$SUFFIX$(const struct sp_ipqueue *ipq)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq $TYPE$ 0 */
+	if (ipq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ipq */
+		return 0;
+	}
+#endif
+	return (($TYPE$*)ipq->data)[ipq->heap[0]];
+}
+/*F}*/
+
+/*F{*/
+size_t sp_ipqueue_top(const struct sp_ipqueue *ipq)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq 0 */
+	if (ipq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ipq */
+		return 0;
+	}
+#endif
+	return ipq->heap[0];
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ipqueue_pop(struct sp_ipqueue *ipq, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	if (ipq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ipq */
+		return SP_EILLEGAL;
+	}
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(SP_IPQUEUE_ELEM(ipq, ipq->heap[0])))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_ipqueue_detach(ipq, 0);
+	if (ipq->size > 0)
+		sp_ipqueue_siftdown(ipq, 0);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_ipqueue_pop$SUFFIX$(struct sp_ipqueue *ipq)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq 0 */
+	if (ipq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ipq */
+		return 0;
+	}
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq $TYPE$ 0 */
+#endif
+	ret = (($TYPE$*)ipq->data)[sp_ipqueue_detach(ipq, 0)];
+	if (ipq->size > 0) {
+		if (ipq->order == SP_PQUEUE_MIN)
+			SP_IPQUEUE_SIFTDOWN($TYPE$, ipq, 0, SP_PQUEUE_LT);
+		else
+			SP_IPQUEUE_SIFTDOWN($TYPE$, ipq, 0, SP_PQUEUE_GT);
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+int sp_ipqueue_contains(const struct sp_ipqueue *ipq, size_t handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq 0 */
+#endif
+	return SP_IPQUEUE_LIVE(ipq, handle);
+}
+/*F}*/
+
+/*F{*/
+void *sp_ipqueue_get(const struct sp_ipqueue *ipq, size_t handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq NULL */
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return NULL;
+	}
+#endif
+	return SP_IPQUEUE_ELEM(ipq, handle);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_ipqueue_get$SUFFIX$(const struct sp_ipqueue *ipq, size_t handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq $TYPE$ 0 */
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return 0;
+	}
+#endif
+	return (($TYPE$*)ipq->data)[handle];
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_ipqueue_update(struct sp_ipqueue *ipq, size_t handle, const void *elem)
+{
+	int up;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return SP_EINDEX;
+	}
+#endif
+	/* A key which moved towards the top can only go up, and vice versa */
+	up = SP_PQUEUE_BEFORE(ipq, elem, SP_IPQUEUE_ELEM(ipq, handle));
+	memcpy(SP_IPQUEUE_ELEM(ipq, handle), elem, ipq->elem_size);
+	if (up)
+		sp_ipqueue_siftup(ipq, ipq->pos[handle]);
+	else
+		sp_ipqueue_siftdown(ipq, ipq->pos[handle]);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ipqueue_update$SUFFIX$(struct sp_ipqueue *ipq, size_t handle, $TYPE$ elem)
+{
+	$TYPE$ *p;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq elem SP_EILLEGAL */
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return SP_EINDEX;
+	}
+#endif
+	/* See sp_ipqueue_update() */
+	p = ($TYPE$*)ipq->data + handle;
+	if (ipq->order == SP_PQUEUE_MIN) {
+		const int up = SP_PQUEUE_LT(elem, *p);
+		*p = elem;
+		if (up)
+			SP_IPQUEUE_SIFTUP($TYPE$, ipq, ipq->pos[handle], SP_PQUEUE_LT);
+		else
+			SP_IPQUEUE_SIFTDOWN($TYPE$, ipq, ipq->pos[handle], SP_PQUEUE_LT);
+	} else {
+		const int up = SP_PQUEUE_GT(elem, *p);
+		*p = elem;
+		if (up)
+			SP_IPQUEUE_SIFTUP($TYPE$, ipq, ipq->pos[handle], SP_PQUEUE_GT);
+		else
+			SP_IPQUEUE_SIFTDOWN($TYPE$, ipq, ipq->pos[handle], SP_PQUEUE_GT);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ipqueue_remove(struct sp_ipqueue *ipq, size_t handle, int (*dtor)(void*))
+{
+	size_t idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return SP_EINDEX;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(SP_IPQUEUE_ELEM(ipq, handle)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+
+	/* The last handle of the heap fills the gap, and may have to move
+	 * either way from there; sifting down after up is then a no-op */
+	idx = ipq->pos[handle];
+	sp_ipqueue_detach(ipq, idx);
+	if (idx < ipq->size) {
+		const size_t moved = ipq->heap[idx];
+		sp_ipqueue_siftup(ipq, idx);
+		sp_ipqueue_siftdown(ipq, ipq->pos[moved]);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_ipqueue_remove$SUFFIX$(struct sp_ipqueue *ipq, size_t handle)
+{
+	size_t idx;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq $TYPE$ 0 */
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return 0;
+	}
+#endif
+	/* See sp_ipqueue_remove() */
+	idx = ipq->pos[handle];
+	sp_ipqueue_detach(ipq, idx);
+	if (idx < ipq->size) {
+		const size_t moved = ipq->heap[idx];
+		if (ipq->order == SP_PQUEUE_MIN) {
+			SP_IPQUEUE_SIFTUP($TYPE$, ipq, idx, SP_PQUEUE_LT);
+			SP_IPQUEUE_SIFTDOWN($TYPE$, ipq, ipq->pos[moved], SP_PQUEUE_LT);
+		} else {
+			SP_IPQUEUE_SIFTUP($TYPE$, ipq, idx, SP_PQUEUE_GT);
+			SP_IPQUEUE_SIFTDOWN($TYPE$, ipq, ipq->pos[moved], SP_PQUEUE_GT);
+		}
+	}
+	return (($TYPE$*)ipq->data)[handle];
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_ipqueue_print(const struct sp_ipqueue *ipq, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+#endif
+	printf("sp_ipqueue_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", arity: "SP_SIZE_FMT", order: %s\n",
+		(SP_SIZE_T)ipq->size, (SP_SIZE_T)ipq->capacity, (SP_SIZE_T)ipq->elem_size, (SP_SIZE_T)ipq->arity,
+		ipq->order == SP_PQUEUE_MIN ? "min" : "max");
+	for (i = 0; i < ipq->size; i++) {
+		const void *const elem = SP_IPQUEUE_ELEM(ipq, ipq->heap[i]);
+		int err;
+		printf("["SP_SIZE_FMT"]\t#"SP_SIZE_FMT"\t", (SP_SIZE_T)i, (SP_SIZE_T)ipq->heap[i]);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_ipqueue_print$SUFFIX$(const struct sp_ipqueue *ipq)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ipq SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ipq $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_ipqueue_print$SUFFIX$()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", arity: "SP_SIZE_FMT", order: %s\n",
+		(SP_SIZE_T)ipq->size, (SP_SIZE_T)ipq->capacity, (SP_SIZE_T)ipq->elem_size, (SP_SIZE_T)ipq->arity,
+		ipq->order == SP_PQUEUE_MIN ? "min" : "max");
+	for (i = 0; i < ipq->size; i++) {
+		const $TYPE$ elem = (($TYPE$*)ipq->data)[ipq->heap[i]];
+		printf("["SP_SIZE_FMT"]\t#"SP_SIZE_FMT"\t"$FMT_STR$"\n", (SP_SIZE_T)i, (SP_SIZE_T)ipq->heap[i], $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,435 @@
+#include "../sp_list.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_list *sp_list_create(size_t elem_size, size_t capacity)
+{
+	struct sp_list *ret;
+	size_t align;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (elem_size > SP_SIZE_MAX / 2 - 16) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Each node holds its links, followed by the element, which is padded to
+	 * keep it aligned for any type of its size. Nodes are blocks of a pool
+	 * embedded in the list. */
+	align = MAX(SP_ALIGNOF_SIZE(elem_size), sizeof(struct sp_list_node*));
+	ret->head        = NULL;
+	ret->tail        = NULL;
+	ret->elem_size   = elem_size;
+	ret->size        = 0;
+	ret->data_offset = (sizeof(struct sp_list_node) + SP_ALIGNOF_SIZE(elem_size) - 1) / SP_ALIGNOF_SIZE(elem_size) * SP_ALIGNOF_SIZE(elem_size);
+	if (sp_pool_init(&ret->pool, (ret->data_offset + elem_size + align - 1) / align * align, capacity, NULL, NULL)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_clear(struct sp_list *list, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+#endif
+	if (dtor != NULL) {
+		struct sp_list_node *node;
+		for (node = list->head; node != NULL; node = node->next) {
+			int err;
+			if ((err = dtor((char*)node + list->data_offset))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	/* Every node is free again, so the pool can carve them from the start */
+	sp_pool_reset(&list->pool);
+	list->head = NULL;
+	list->tail = NULL;
+	list->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_destroy(struct sp_list *list, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+#endif
+	if (sp_list_clear(list, dtor))
+		return SP_ECALLBK;
+	sp_pool_fini(&list->pool);
+	free(list);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_list_eq(const struct sp_list *list1, const struct sp_list *list2, int (*cmp)(const void*, const void*))
+{
+	const struct sp_list_node *p, *q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list1 0 */
+	/*. C_ERR_NULLPTR list2 0 */
+#endif
+	if (list1->elem_size != list2->elem_size || list1->size != list2->size)
+		return 0;
+	for (p = list1->head, q = list2->head; p != NULL; p = p->next, q = q->next) {
+		const void *const a = (const char*)p + list1->data_offset,
+		           *const b = (const char*)q + list2->data_offset;
+		if (cmp ? cmp(a, b) : memcmp(a, b, list1->elem_size))
+			return 0;
+	}
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_list_copy(struct sp_list *dest, const struct sp_list *src, int (*cpy)(void*, const void*))
+{
+	const struct sp_list_node *s;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	if (dest->elem_size != src->elem_size) {
+		error(("dest->elem_size does not match src->elem_size"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Once cleared, every node of dest is free. Reserve the rest up front,
+	 * so that running out of memory leaves dest empty, not half-copied. */
+	sp_list_clear(dest, NULL);
+	if ((err = sp_pool_reserve(&dest->pool, src->size)))
+		return err;
+	for (s = src->head; s != NULL; s = s->next) {
+		void *d;
+		sp_pool_take(&dest->pool, &d);
+		if (cpy == NULL) {
+			memcpy((char*)d + dest->data_offset, (const char*)s + src->data_offset, src->elem_size);
+		} else if ((err = cpy((char*)d + dest->data_offset, (const char*)s + src->data_offset))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO cpy err */
+			sp_pool_give(&dest->pool, d);
+			return SP_ECALLBK;
+		}
+		sp_list_link(dest, NULL, d, d);
+		++dest->size;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_list_map(struct sp_list *list, int (*func)(void*, size_t))
+{
+	struct sp_list_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	for (node = list->head; node != NULL; node = node->next) {
+		int err;
+		if ((err = func((char*)node + list->data_offset, i++))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_list_pushfront(struct sp_list *list, const void *elem)
+{
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((err = sp_pool_take(&list->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)node + list->data_offset, elem, list->elem_size);
+	sp_list_link(list, list->head, node, node);
+	++list->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_pushfront$SUFFIX$(struct sp_list *list, $TYPE$ elem)
+{
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE list elem SP_EILLEGAL */
+#endif
+	if ((err = sp_pool_take(&list->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	*($TYPE$*)((char*)node + list->data_offset) = elem;
+	sp_list_link(list, list->head, node, node);
+	++list->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_list_pushback(struct sp_list *list, const void *elem)
+{
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((err = sp_pool_take(&list->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)node + list->data_offset, elem, list->elem_size);
+	sp_list_link(list, NULL, node, node);
+	++list->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_pushback$SUFFIX$(struct sp_list *list, $TYPE$ elem)
+{
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE list elem SP_EILLEGAL */
+#endif
+	if ((err = sp_pool_take(&list->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	*($TYPE$*)((char*)node + list->data_offset) = elem;
+	sp_list_link(list, NULL, node, node);
+	++list->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_list_insertafter(struct sp_list *list, struct sp_list_node *node, const void *elem)
+{
+	void *new;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((err = sp_pool_take(&list->pool, &new)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)new + list->data_offset, elem, list->elem_size);
+	sp_list_link(list, node->next, new, new);
+	++list->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_list_insertbefore(struct sp_list *list, struct sp_list_node *node, const void *elem)
+{
+	void *new;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((err = sp_pool_take(&list->pool, &new)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)new + list->data_offset, elem, list->elem_size);
+	sp_list_link(list, node, new, new);
+	++list->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_popfront(struct sp_list *list, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	if (list->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY list */
+		return SP_EILLEGAL;
+	}
+#endif
+	return sp_list_remove(list, list->head, dtor);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_popback(struct sp_list *list, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	if (list->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY list */
+		return SP_EILLEGAL;
+	}
+#endif
+	return sp_list_remove(list, list->tail, dtor);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_remove(struct sp_list *list, struct sp_list_node *node, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+#endif
+	if (dtor != NULL && (err = dtor((char*)node + list->data_offset))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_list_unlink(list, node, node);
+	--list->size;
+	sp_pool_give(&list->pool, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_list_elem(const struct sp_list *list, const struct sp_list_node *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list NULL */
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	return (char*)node + list->data_offset;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_splice(struct sp_list *dest, struct sp_list_node *pos, struct sp_list *src)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest == src) {
+		error(("dest and src are the same list"));
+		return SP_EILLEGAL;
+	}
+	if (dest->elem_size != src->elem_size) {
+		error(("dest->elem_size does not match src->elem_size"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* The nodes stay where they are, so dest takes over the pool of src */
+	if ((err = sp_pool_merge(&dest->pool, &src->pool)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	if (src->head != NULL)
+		sp_list_link(dest, pos, src->head, src->tail);
+	dest->size += src->size;
+
+	src->head = NULL;
+	src->tail = NULL;
+	src->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_move(struct sp_list *list, struct sp_list_node *pos, struct sp_list_node *first, struct sp_list_node *last)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_NULLPTR first SP_EINVAL */
+	/*. C_ERR_NULLPTR last SP_EINVAL */
+#endif
+	sp_list_unlink(list, first, last);
+	sp_list_link(list, pos, first, last);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_print(const struct sp_list *list, int (*func)(const void*))
+{
+	const struct sp_list_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+#endif
+	printf("sp_list_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)list->size, (SP_SIZE_T)list->pool.capacity, (SP_SIZE_T)list->elem_size);
+	for (node = list->head; node != NULL; node = node->next) {
+		const void *const elem = (const char*)node + list->data_offset;
+		int err;
+		printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i++);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_list_print$SUFFIX$(const struct sp_list *list)
+{
+	const struct sp_list_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR list SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE list $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_list_print$SUFFIX$()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)list->size, (SP_SIZE_T)list->pool.capacity, (SP_SIZE_T)list->elem_size);
+	for (node = list->head; node != NULL; node = node->next) {
+		const $TYPE$ elem = *(const $TYPE$*)((const char*)node + list->data_offset);
+		printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)i++, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
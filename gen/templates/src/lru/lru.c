@@ -0,0 +1,317 @@
+#include "../sp_lru.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_lru *sp_lru_create(size_t key_size, size_t val_size, size_t capacity, size_t max_weight, size_t (*hash)(const void*), int (*cmp)(const void*, const void*), int (*evict)(void*, void*))
+{
+	struct sp_lru *ret;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (val_size == 0) {
+		error(("val_size cannot be 0"));
+		return NULL;
+	}
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(MAX(key_size, val_size), sizeof(struct sp_lru_entry))) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* The index is sized for capacity up front, and never holds more */
+	ret->index      = sp_hashmap_create(key_size, sizeof(size_t), capacity, hash, cmp);
+	ret->entries    = malloc(capacity * sizeof(struct sp_lru_entry));
+	ret->keys       = malloc(capacity * key_size);
+	ret->vals       = malloc(capacity * val_size);
+	if (ret->index == NULL || ret->entries == NULL || ret->keys == NULL || ret->vals == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		if (ret->index != NULL)
+			sp_hashmap_destroy(ret->index, NULL, NULL);
+		free(ret->entries);
+		free(ret->keys);
+		free(ret->vals);
+		free(ret);
+		return NULL;
+	}
+	ret->key_size   = key_size;
+	ret->val_size   = val_size;
+	ret->capacity   = capacity;
+	ret->max_weight = max_weight;
+	ret->hits       = 0;
+	ret->misses     = 0;
+	ret->evictions  = 0;
+	ret->evict      = evict;
+	sp_lru_reset(ret);
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_lru_clear(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+#endif
+	for (i = lru->head; i != lru->capacity; i = lru->entries[i].next) {
+		int err;
+		if (kdtor != NULL && (err = kdtor(SP_LRU_KEY(lru, i)))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+			return SP_ECALLBK;
+		}
+		if (vdtor != NULL && (err = vdtor(SP_LRU_VAL(lru, i)))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+			return SP_ECALLBK;
+		}
+	}
+	sp_hashmap_clear(lru->index, NULL, NULL);
+	sp_lru_reset(lru);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_lru_destroy(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	int error;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+#endif
+	if ((error = sp_lru_clear(lru, kdtor, vdtor)))
+		return SP_ECALLBK;
+	sp_hashmap_destroy(lru->index, NULL, NULL);
+	free(lru->entries);
+	free(lru->keys);
+	free(lru->vals);
+	free(lru);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_lru_insert(struct sp_lru *lru, const void *key, const void *val, size_t weight)
+{
+	const size_t *pos;
+	size_t idx, old;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+#endif
+	if (lru->max_weight != 0 && weight > lru->max_weight)
+		return SP_ERANGE;
+
+	/* An existing entry moves to the front first, so that making room
+	 * never evicts it */
+	pos = sp_hashmap_get(lru->index, key);
+	idx = pos != NULL ? *pos : lru->capacity;
+	old = 0;
+	if (idx != lru->capacity) {
+		sp_lru_unlink(lru, idx);
+		sp_lru_link(lru, idx);
+		old = lru->entries[idx].weight;
+	}
+	while ((idx == lru->capacity && lru->size == lru->capacity)
+			|| (lru->max_weight != 0 && lru->weight - old > lru->max_weight - weight)) {
+		if ((err = sp_lru_evict(lru)))
+			return err;
+	}
+
+	if (idx == lru->capacity) {
+		idx = lru->free;
+		if ((err = sp_hashmap_insert(lru->index, key, &idx)))
+			return err;
+		lru->free = lru->entries[idx].next;
+		memcpy(SP_LRU_KEY(lru, idx), key, lru->key_size);
+		sp_lru_link(lru, idx);
+		++lru->size;
+	}
+	memcpy(SP_LRU_VAL(lru, idx), val, lru->val_size);
+	lru->weight = lru->weight - old + weight;
+	lru->entries[idx].weight = weight;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_lru_insert$SUFFIX$(struct sp_lru *lru, $TYPE$ key, const void *val, size_t weight)
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+	if (lru->key_size != sizeof(key)) {
+		error(("lru->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)lru->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Keys are compared bytewise, so padding bits must be zeroed */
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_lru_insert(lru, &k, val, weight);
+}
+/*F}*/
+
+/*F{*/
+void *sp_lru_get(struct sp_lru *lru, const void *key)
+{
+	const size_t *pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru NULL */
+	/*. C_ERR_NULLPTR key NULL */
+#endif
+	if ((pos = sp_hashmap_get(lru->index, key)) == NULL) {
+		++lru->misses;
+		return NULL;
+	}
+	++lru->hits;
+	if (lru->head != *pos) {
+		sp_lru_unlink(lru, *pos);
+		sp_lru_link(lru, *pos);
+	}
+	return SP_LRU_VAL(lru, *pos);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_lru_get$SUFFIX$(struct sp_lru *lru, $TYPE$ key)
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru NULL */
+	if (lru->key_size != sizeof(key)) {
+		error(("lru->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)lru->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_lru_get(lru, &k);
+}
+/*F}*/
+
+/*F{*/
+void *sp_lru_peek(const struct sp_lru *lru, const void *key)
+{
+	const size_t *pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru NULL */
+	/*. C_ERR_NULLPTR key NULL */
+#endif
+	pos = sp_hashmap_get(lru->index, key);
+	return pos == NULL ? NULL : SP_LRU_VAL(lru, *pos);
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+void *sp_lru_peek$SUFFIX$(const struct sp_lru *lru, $TYPE$ key)
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru NULL */
+	if (lru->key_size != sizeof(key)) {
+		error(("lru->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)lru->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_lru_peek(lru, &k);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_lru_remove(struct sp_lru *lru, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t slot, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+	/*. C_ERR_NULLPTR key SP_EINVAL */
+#endif
+	slot = sp_hashtab_find(lru->index, key, SP_HASH(lru->index, key));
+	if (slot == lru->index->capacity)
+		return SP_ENOKEY;
+	idx = *(const size_t*)SP_HASHTAB_VAL(lru->index, slot);
+	if (kdtor != NULL && (err = kdtor(SP_LRU_KEY(lru, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO kdtor err */
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_LRU_VAL(lru, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO vdtor err */
+		return SP_ECALLBK;
+	}
+	sp_lru_drop(lru, idx, slot);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_lru_remove$SUFFIX$(struct sp_lru *lru, $TYPE$ key, int (*dtor)(void*))
+{
+	$TYPE$ k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+	if (lru->key_size != sizeof(key)) {
+		error(("lru->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)lru->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_lru_remove(lru, &k, NULL, dtor);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_lru_print(const struct sp_lru *lru, int (*func)(const void*, const void*))
+{
+	size_t i, n = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR lru SP_EINVAL */
+#endif
+	printf("sp_lru_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", weight/max_weight: "SP_SIZE_FMT"/"SP_SIZE_FMT", hits: %lu, misses: %lu, evictions: %lu\n",
+		(SP_SIZE_T)lru->size, (SP_SIZE_T)lru->capacity, (SP_SIZE_T)lru->weight, (SP_SIZE_T)lru->max_weight,
+		lru->hits, lru->misses, lru->evictions);
+	for (i = lru->head; i != lru->capacity; i = lru->entries[i].next) {
+		const void *const key = SP_LRU_KEY(lru, i),
+		           *const val = SP_LRU_VAL(lru, i);
+		int err;
+		printf("["SP_SIZE_FMT"]\t"SP_SIZE_FMT"\t", (SP_SIZE_T)n++, (SP_SIZE_T)lru->entries[i].weight);
+		if (func == NULL)
+			printf("%p\t%p\n", key, val);
+		else if ((err = func(key, val))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,851 @@
+#include "../sp_matrix.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_matrix *sp_matrix_create(size_t elem_size, size_t depth, size_t rows, size_t cols, size_t align)
+{
+	struct sp_matrix *ret;
+	size_t size, offset;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	if (depth == 0 || rows == 0 || cols == 0) {
+		error(("matrix dimensions cannot be 0"));
+		return NULL;
+	}
+	if (align & (align - 1)) {
+		error(("align must be a power of 2"));
+		return NULL;
+	}
+#endif
+	align = MAX(align, SP_ALIGNOF_SIZE(elem_size));
+	size  = depth * rows * cols;
+	if ((rows != 0 && depth > SP_SIZE_MAX / rows)
+			|| (cols != 0 && depth * rows > SP_SIZE_MAX / cols)
+			|| align > SP_SIZE_MAX - sizeof(*ret)
+			|| (elem_size != 0 && size > (SP_SIZE_MAX - sizeof(*ret) - align) / elem_size)) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	/* The elements follow the structure in the same block of memory,
+	 * starting at the first address aligned to align bytes */
+	ret = malloc(sizeof(*ret) + align - 1 + size * elem_size);
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	offset = (size_t)((char*)ret + sizeof(*ret)) % align;
+
+	ret->data      = (char*)ret + sizeof(*ret) + (align - offset) % align;
+	ret->elem_size = elem_size;
+	ret->depth     = depth;
+	ret->rows      = rows;
+	ret->cols      = cols;
+	ret->size      = size;
+	ret->align     = align;
+	ret->pstride   = rows * cols;
+	ret->rstride   = cols;
+	ret->cstride   = 1;
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_destroy(struct sp_matrix *matrix, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	if (matrix->align == 0) {
+		error(("cannot destroy a matrix view"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL) {
+		size_t i;
+		for (i = 0; i < matrix->size; i++) {
+			int err;
+			if ((err = dtor((char*)matrix->data + i * matrix->elem_size))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	free(matrix);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_slice(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row, size_t col, size_t depth, size_t rows, size_t cols)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR view SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (depth == 0 || rows == 0 || cols == 0) {
+		error(("view dimensions cannot be 0"));
+		return SP_EILLEGAL;
+	}
+	if (plane >= src->depth || depth > src->depth - plane
+			|| row >= src->rows || rows > src->rows - row
+			|| col >= src->cols || cols > src->cols - col) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	/* The strides of src carry over unchanged, only the origin moves */
+	view->data      = SP_MATRIX_ELEM(src, plane, row, col);
+	view->elem_size = src->elem_size;
+	view->depth     = depth;
+	view->rows      = rows;
+	view->cols      = cols;
+	view->size      = depth * rows * cols;
+	view->align     = 0;
+	view->pstride   = src->pstride;
+	view->rstride   = src->rstride;
+	view->cstride   = src->cstride;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_matrix_row(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+#endif
+	return sp_matrix_slice(view, src, plane, row, 0, 1, 1, src->cols);
+}
+/*F}*/
+
+/*F{*/
+int sp_matrix_col(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t col)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+#endif
+	return sp_matrix_slice(view, src, plane, 0, col, 1, src->rows, 1);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_transposed(struct sp_matrix *view, const struct sp_matrix *src)
+{
+	size_t rows, rstride;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR view SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+#endif
+	/* Saved first, in case view and src are the same structure */
+	rows    = src->rows;
+	rstride = src->rstride;
+
+	view->data      = src->data;
+	view->elem_size = src->elem_size;
+	view->depth     = src->depth;
+	view->rows      = src->cols;
+	view->cols      = rows;
+	view->size      = src->size;
+	view->align     = 0;
+	view->pstride   = src->pstride;
+	view->rstride   = src->cstride;
+	view->cstride   = rstride;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_reshape(struct sp_matrix *view, const struct sp_matrix *src, size_t depth, size_t rows, size_t cols)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR view SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (depth == 0 || rows == 0 || cols == 0) {
+		error(("view dimensions cannot be 0"));
+		return SP_EILLEGAL;
+	}
+	if (src->size % depth != 0 || src->size / depth % rows != 0 || src->size / depth / rows != cols) {
+		error(("view size does not match the size of src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Any other layout would need a different stride for every element */
+	if (!SP_MATRIX_PACKED(src)) {
+		error(("cannot reshape a matrix whose elements are not contiguous"));
+		return SP_EILLEGAL;
+	}
+	view->data      = src->data;
+	view->elem_size = src->elem_size;
+	view->depth     = depth;
+	view->rows      = rows;
+	view->cols      = cols;
+	view->size      = src->size;
+	view->align     = 0;
+	view->pstride   = rows * cols;
+	view->rstride   = cols;
+	view->cstride   = 1;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_matrix_eq(const struct sp_matrix *matrix1, const struct sp_matrix *matrix2, int (*cmp)(const void*, const void*))
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix1 0 */
+	/*. C_ERR_NULLPTR matrix2 0 */
+#endif
+	if (matrix1->elem_size != matrix2->elem_size
+			|| matrix1->depth != matrix2->depth
+			|| matrix1->rows  != matrix2->rows
+			|| matrix1->cols  != matrix2->cols)
+		return 0;
+	if (cmp == NULL && SP_MATRIX_PACKED(matrix1) && SP_MATRIX_PACKED(matrix2))
+		return !memcmp(matrix1->data, matrix2->data, matrix1->size * matrix1->elem_size);
+	for (k = 0; k < matrix1->depth; k++)
+	for (i = 0; i < matrix1->rows; i++)
+	for (j = 0; j < matrix1->cols; j++) {
+		const void *const p = SP_MATRIX_ELEM(matrix1, k, i, j),
+		           *const q = SP_MATRIX_ELEM(matrix2, k, i, j);
+		if (cmp == NULL ? memcmp(p, q, matrix1->elem_size) : cmp(p, q))
+			return 0;
+	}
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_matrix_copy(struct sp_matrix *dest, const struct sp_matrix *src, int (*cpy)(void*, const void*))
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	if (dest->elem_size != src->elem_size || dest->depth != src->depth
+			|| dest->rows != src->rows || dest->cols != src->cols) {
+		error(("dest and src dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (cpy == NULL && SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(src)) {
+		memcpy(dest->data, src->data, src->size * src->elem_size);
+		return 0;
+	}
+	for (k = 0; k < src->depth; k++)
+	for (i = 0; i < src->rows; i++) {
+		if (cpy == NULL && SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(src)) {
+			memcpy(SP_MATRIX_ELEM(dest, k, i, 0), SP_MATRIX_ELEM(src, k, i, 0), src->cols * src->elem_size);
+			continue;
+		}
+		for (j = 0; j < src->cols; j++) {
+			int err;
+			void *const p = SP_MATRIX_ELEM(dest, k, i, j);
+			const void *const q = SP_MATRIX_ELEM(src, k, i, j);
+			if (cpy == NULL)
+				memcpy(p, q, src->elem_size);
+			else if ((err = cpy(p, q))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO cpy err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_map(struct sp_matrix *matrix, int (*func)(void*, size_t))
+{
+	size_t k, i, j, n;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	n = 0;
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++)
+	for (j = 0; j < matrix->cols; j++) {
+		int err;
+		if ((err = func(SP_MATRIX_ELEM(matrix, k, i, j), n++))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_matrix_get(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix NULL */
+	if (plane >= matrix->depth || row >= matrix->rows || col >= matrix->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	return SP_MATRIX_ELEM(matrix, plane, row, col);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_matrix_get$SUFFIX$(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE matrix $TYPE$ 0 */
+	if (plane >= matrix->depth || row >= matrix->rows || col >= matrix->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	return *($TYPE$*)SP_MATRIX_ELEM(matrix, plane, row, col);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_matrix_set(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, const void *val)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+	if (plane >= matrix->depth || row >= matrix->rows || col >= matrix->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	memcpy(SP_MATRIX_ELEM(matrix, plane, row, col), val, matrix->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_set$SUFFIX$(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, $TYPE$ val)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE matrix val SP_EILLEGAL */
+	if (plane >= matrix->depth || row >= matrix->rows || col >= matrix->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	*($TYPE$*)SP_MATRIX_ELEM(matrix, plane, row, col) = val;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_matrix_fill(struct sp_matrix *matrix, const void *val)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+#endif
+	if (SP_MATRIX_PACKED(matrix)) {
+		/* Copy the first element, then keep doubling the filled region */
+		size_t done;
+		memcpy(matrix->data, val, matrix->elem_size);
+		for (done = 1; done < matrix->size; done *= 2) {
+			const size_t len = MIN(done, matrix->size - done);
+			memcpy((char*)matrix->data + done * matrix->elem_size, matrix->data, len * matrix->elem_size);
+		}
+		return 0;
+	}
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++)
+	for (j = 0; j < matrix->cols; j++)
+		memcpy(SP_MATRIX_ELEM(matrix, k, i, j), val, matrix->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_fill$SUFFIX$(struct sp_matrix *matrix, $TYPE$ val)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE matrix val SP_EILLEGAL */
+#endif
+	if (SP_MATRIX_PACKED(matrix)) {
+		$TYPE$ *const p = matrix->data;
+		for (i = 0; i < matrix->size; i++)
+			p[i] = val;
+		return 0;
+	}
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++) {
+		$TYPE$ *const p = ($TYPE$*)SP_MATRIX_ELEM(matrix, k, i, 0);
+		const size_t cs = matrix->cstride;
+		for (j = 0; j < matrix->cols; j++)
+			p[j * cs] = val;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_matrix_transpose(struct sp_matrix *dest, const struct sp_matrix *src)
+{
+	size_t rows, cols, elem_size, k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest == src) {
+		error(("dest and src must be different matrices"));
+		return SP_EILLEGAL;
+	}
+	if (dest->elem_size != src->elem_size || dest->depth != src->depth
+			|| dest->rows != src->cols || dest->cols != src->rows) {
+		error(("dest dimensions do not match transposed src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	rows      = src->rows;
+	cols      = src->cols;
+	elem_size = src->elem_size;
+
+	/* Swap square tiles small enough for both the rows read from src and
+	 * the rows written to dest to stay in cache. Common element sizes are
+	 * copied with a constant size, so that the copy compiles to a move. */
+	for (k = 0; k < src->depth; k++) {
+		const char *const s = SP_MATRIX_ELEM(src, k, 0, 0);
+		char *const       d = SP_MATRIX_ELEM(dest, k, 0, 0);
+		const size_t srs = src->rstride,  scs = src->cstride,
+		             drs = dest->rstride, dcs = dest->cstride;
+		size_t ii, jj;
+		for (ii = 0; ii < rows; ii += SP_MATRIX_BLOCK)
+		for (jj = 0; jj < cols; jj += SP_MATRIX_BLOCK) {
+			const size_t iend = MIN(ii + SP_MATRIX_BLOCK, rows),
+			             jend = MIN(jj + SP_MATRIX_BLOCK, cols);
+			size_t i, j;
+#define SP_MATRIX_TRANSPOSE_TILE(N) \
+			for (i = ii; i < iend; i++) \
+				for (j = jj; j < jend; j++) \
+					memcpy(d + (j * drs + i * dcs) * (N), s + (i * srs + j * scs) * (N), (N))
+			switch (elem_size) {
+			case 1:  SP_MATRIX_TRANSPOSE_TILE(1);         break;
+			case 2:  SP_MATRIX_TRANSPOSE_TILE(2);         break;
+			case 4:  SP_MATRIX_TRANSPOSE_TILE(4);         break;
+			case 8:  SP_MATRIX_TRANSPOSE_TILE(8);         break;
+			default: SP_MATRIX_TRANSPOSE_TILE(elem_size); break;
+			}
+#undef SP_MATRIX_TRANSPOSE_TILE
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_mul$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b)
+{
+	size_t m, n, p, k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR b SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE b $TYPE$ SP_EILLEGAL */
+	if (dest == a || dest == b) {
+		error(("dest must be different from both operands"));
+		return SP_EILLEGAL;
+	}
+	if (a->depth != b->depth || dest->depth != a->depth || b->rows != a->cols
+			|| dest->rows != a->rows || dest->cols != b->cols) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	m = a->rows;
+	n = a->cols;
+	p = b->cols;
+
+	for (k = 0; k < a->depth; k++) {
+		const $TYPE$ *const pa = ($TYPE$*)SP_MATRIX_ELEM(a, k, 0, 0),
+		             *const pb = ($TYPE$*)SP_MATRIX_ELEM(b, k, 0, 0);
+		$TYPE$ *const pc = ($TYPE$*)SP_MATRIX_ELEM(dest, k, 0, 0);
+		const size_t ars = a->rstride, acs = a->cstride,
+		             brs = b->rstride, bcs = b->cstride,
+		             crs = dest->rstride, ccs = dest->cstride;
+		size_t i, j, l, jj, ll;
+
+		/* Without unit-stride rows in b and dest (e.g. when b is a
+		 * transposed view), fall back to one dot product per element,
+		 * which then walks the columns of b sequentially instead */
+		if (!SP_MATRIX_UNIT_ROWS(b) || !SP_MATRIX_UNIT_ROWS(dest)) {
+			for (i = 0; i < m; i++)
+			for (j = 0; j < p; j++) {
+				$TYPE$ sum = 0;
+				for (l = 0; l < n; l++)
+					sum += pa[i * ars + l * acs] * pb[l * brs + j * bcs];
+				pc[i * crs + j * ccs] = sum;
+			}
+			continue;
+		}
+
+		/* The loops run in i-k-j order, so that the innermost loop walks
+		 * rows of b and dest with unit stride and can be vectorized by the
+		 * compiler. Each pass covers a panel of b small enough to stay in
+		 * cache, and updates 4 rows of dest at once, so that every element
+		 * loaded from b is used 4 times. */
+		for (i = 0; i < m; i++)
+			for (j = 0; j < p; j++)
+				pc[i * crs + j] = 0;
+		for (jj = 0; jj < p; jj += SP_MATRIX_TILE_J)
+		for (ll = 0; ll < n; ll += SP_MATRIX_TILE_K) {
+			const size_t jend = MIN(jj + SP_MATRIX_TILE_J, p),
+			             lend = MIN(ll + SP_MATRIX_TILE_K, n);
+			for (i = 0; i + 4 <= m; i += 4) {
+				$TYPE$ *const c0 = pc + i * crs, *const c1 = c0 + crs,
+				       *const c2 = c1 + crs,     *const c3 = c2 + crs;
+				const $TYPE$ *const a0 = pa + i * ars, *const a1 = a0 + ars,
+				             *const a2 = a1 + ars,     *const a3 = a2 + ars;
+				for (l = ll; l < lend; l++) {
+					const $TYPE$ x0 = a0[l * acs], x1 = a1[l * acs],
+					             x2 = a2[l * acs], x3 = a3[l * acs];
+					const $TYPE$ *const br = pb + l * brs;
+					for (j = jj; j < jend; j++) {
+						const $TYPE$ y = br[j];
+						c0[j] += x0 * y;
+						c1[j] += x1 * y;
+						c2[j] += x2 * y;
+						c3[j] += x3 * y;
+					}
+				}
+			}
+			for (; i < m; i++) {
+				$TYPE$ *const cr = pc + i * crs;
+				for (l = ll; l < lend; l++) {
+					const $TYPE$ x = pa[i * ars + l * acs];
+					const $TYPE$ *const br = pb + l * brs;
+					for (j = jj; j < jend; j++)
+						cr[j] += x * br[j];
+				}
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_add$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR b SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE b $TYPE$ SP_EILLEGAL */
+	if (!SP_MATRIX_SAME_SHAPE(dest, a) || !SP_MATRIX_SAME_SHAPE(dest, b)) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(a) && SP_MATRIX_PACKED(b)) {
+		const $TYPE$ *const pa = a->data, *const pb = b->data;
+		$TYPE$ *const pc = dest->data;
+		for (i = 0; i < dest->size; i++)
+			pc[i] = pa[i] + pb[i];
+		return 0;
+	}
+	for (k = 0; k < dest->depth; k++)
+	for (i = 0; i < dest->rows; i++) {
+		const $TYPE$ *const pa = ($TYPE$*)SP_MATRIX_ELEM(a, k, i, 0),
+		             *const pb = ($TYPE$*)SP_MATRIX_ELEM(b, k, i, 0);
+		$TYPE$ *const pc = ($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t acs = a->cstride, bcs = b->cstride, ccs = dest->cstride;
+		if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(a) && SP_MATRIX_UNIT_ROWS(b))
+			for (j = 0; j < dest->cols; j++)
+				pc[j] = pa[j] + pb[j];
+		else
+			for (j = 0; j < dest->cols; j++)
+				pc[j * ccs] = pa[j * acs] + pb[j * bcs];
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_sub$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR b SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE b $TYPE$ SP_EILLEGAL */
+	if (!SP_MATRIX_SAME_SHAPE(dest, a) || !SP_MATRIX_SAME_SHAPE(dest, b)) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(a) && SP_MATRIX_PACKED(b)) {
+		const $TYPE$ *const pa = a->data, *const pb = b->data;
+		$TYPE$ *const pc = dest->data;
+		for (i = 0; i < dest->size; i++)
+			pc[i] = pa[i] - pb[i];
+		return 0;
+	}
+	for (k = 0; k < dest->depth; k++)
+	for (i = 0; i < dest->rows; i++) {
+		const $TYPE$ *const pa = ($TYPE$*)SP_MATRIX_ELEM(a, k, i, 0),
+		             *const pb = ($TYPE$*)SP_MATRIX_ELEM(b, k, i, 0);
+		$TYPE$ *const pc = ($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t acs = a->cstride, bcs = b->cstride, ccs = dest->cstride;
+		if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(a) && SP_MATRIX_UNIT_ROWS(b))
+			for (j = 0; j < dest->cols; j++)
+				pc[j] = pa[j] - pb[j];
+		else
+			for (j = 0; j < dest->cols; j++)
+				pc[j * ccs] = pa[j * acs] - pb[j * bcs];
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_emul$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR b SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE b $TYPE$ SP_EILLEGAL */
+	if (!SP_MATRIX_SAME_SHAPE(dest, a) || !SP_MATRIX_SAME_SHAPE(dest, b)) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Adding the product to negative zero is exact for every type, and
+	 * keeps compilers from warning about _Bool operands in arithmetic */
+	if (SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(a) && SP_MATRIX_PACKED(b)) {
+		const $TYPE$ *const pa = a->data, *const pb = b->data;
+		$TYPE$ *const pc = dest->data;
+		for (i = 0; i < dest->size; i++) {
+			$TYPE$ x = -($TYPE$)0;
+			x += pa[i] * pb[i];
+			pc[i] = x;
+		}
+		return 0;
+	}
+	for (k = 0; k < dest->depth; k++)
+	for (i = 0; i < dest->rows; i++) {
+		const $TYPE$ *const pa = ($TYPE$*)SP_MATRIX_ELEM(a, k, i, 0),
+		             *const pb = ($TYPE$*)SP_MATRIX_ELEM(b, k, i, 0);
+		$TYPE$ *const pc = ($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t acs = a->cstride, bcs = b->cstride, ccs = dest->cstride;
+		if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(a) && SP_MATRIX_UNIT_ROWS(b))
+			for (j = 0; j < dest->cols; j++) {
+				$TYPE$ x = -($TYPE$)0;
+				x += pa[j] * pb[j];
+				pc[j] = x;
+			}
+		else
+			for (j = 0; j < dest->cols; j++) {
+				$TYPE$ x = -($TYPE$)0;
+				x += pa[j * acs] * pb[j * bcs];
+				pc[j * ccs] = x;
+			}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_scale$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *src, $TYPE$ factor)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE src $TYPE$ SP_EILLEGAL */
+	if (!SP_MATRIX_SAME_SHAPE(dest, src)) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* See sp_matrix_emul() */
+	if (SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(src)) {
+		const $TYPE$ *const ps = src->data;
+		$TYPE$ *const pd = dest->data;
+		for (i = 0; i < dest->size; i++) {
+			$TYPE$ x = -($TYPE$)0;
+			x += ps[i] * factor;
+			pd[i] = x;
+		}
+		return 0;
+	}
+	for (k = 0; k < dest->depth; k++)
+	for (i = 0; i < dest->rows; i++) {
+		const $TYPE$ *const ps = ($TYPE$*)SP_MATRIX_ELEM(src, k, i, 0);
+		$TYPE$ *const pd = ($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t scs = src->cstride, dcs = dest->cstride;
+		if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(src))
+			for (j = 0; j < dest->cols; j++) {
+				$TYPE$ x = -($TYPE$)0;
+				x += ps[j] * factor;
+				pd[j] = x;
+			}
+		else
+			for (j = 0; j < dest->cols; j++) {
+				$TYPE$ x = -($TYPE$)0;
+				x += ps[j * scs] * factor;
+				pd[j * dcs] = x;
+			}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_rowsum$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *src)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE src $TYPE$ SP_EILLEGAL */
+	if (dest->depth != src->depth || dest->rows != src->rows || dest->cols != 1) {
+		error(("dest dimensions do not match row sums of src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (k = 0; k < src->depth; k++)
+	for (i = 0; i < src->rows; i++) {
+		const $TYPE$ *const ps = ($TYPE$*)SP_MATRIX_ELEM(src, k, i, 0);
+		const size_t scs = src->cstride;
+		$TYPE$ sum = 0;
+		for (j = 0; j < src->cols; j++)
+			sum += ps[j * scs];
+		*($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0) = sum;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_matrix_colsum$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *src)
+{
+	size_t k;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE src $TYPE$ SP_EILLEGAL */
+	if (dest->depth != src->depth || dest->rows != 1 || dest->cols != src->cols) {
+		error(("dest dimensions do not match column sums of src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Accumulate whole rows instead of walking down columns, so that
+	 * memory is read sequentially */
+	for (k = 0; k < src->depth; k++) {
+		$TYPE$ *const pd = ($TYPE$*)SP_MATRIX_ELEM(dest, k, 0, 0);
+		const size_t cols = src->cols, scs = src->cstride, dcs = dest->cstride;
+		size_t i, j;
+		for (i = 0; i < src->rows; i++) {
+			const $TYPE$ *const ps = ($TYPE$*)SP_MATRIX_ELEM(src, k, i, 0);
+			if (i == 0)
+				for (j = 0; j < cols; j++)
+					pd[j * dcs] = ps[j * scs];
+			else if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(src))
+				for (j = 0; j < cols; j++)
+					pd[j] += ps[j];
+			else
+				for (j = 0; j < cols; j++)
+					pd[j * dcs] += ps[j * scs];
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_matrix_print(const struct sp_matrix *matrix, int (*func)(const void*))
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+#endif
+	printf("sp_matrix_print()\ndepth: "SP_SIZE_FMT", rows: "SP_SIZE_FMT", cols: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)matrix->depth, (SP_SIZE_T)matrix->rows, (SP_SIZE_T)matrix->cols, (SP_SIZE_T)matrix->elem_size);
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++)
+	for (j = 0; j < matrix->cols; j++) {
+		const void *const elem = SP_MATRIX_ELEM(matrix, k, i, j);
+		int err;
+		printf("["SP_SIZE_FMT", "SP_SIZE_FMT", "SP_SIZE_FMT"]\t", (SP_SIZE_T)k, (SP_SIZE_T)i, (SP_SIZE_T)j);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_matrix_print$SUFFIX$(const struct sp_matrix *matrix)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR matrix SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE matrix $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_matrix_print$SUFFIX$()\ndepth: "SP_SIZE_FMT", rows: "SP_SIZE_FMT", cols: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)matrix->depth, (SP_SIZE_T)matrix->rows, (SP_SIZE_T)matrix->cols, (SP_SIZE_T)matrix->elem_size);
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++)
+	for (j = 0; j < matrix->cols; j++) {
+		const $TYPE$ elem = *(const $TYPE$*)SP_MATRIX_ELEM(matrix, k, i, j);
+		printf("["SP_SIZE_FMT", "SP_SIZE_FMT", "SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)k, (SP_SIZE_T)i, (SP_SIZE_T)j, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
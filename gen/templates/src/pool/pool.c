@@ -0,0 +1,148 @@
+#include "../sp_pool.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_pool *sp_pool_create(size_t block_size, size_t capacity, int (*ctor)(void*), int (*dtor)(void*))
+{
+	struct sp_pool *ret;
+
+#ifdef STAPLE_DEBUG
+	if (block_size == 0) {
+		error(("block_size cannot be 0"));
+		return NULL;
+	}
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	if (sp_pool_init(ret, block_size, capacity, ctor, dtor)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pool_destroy(struct sp_pool *pool)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	sp_pool_fini(pool);
+	free(pool);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pool_reset(struct sp_pool *pool)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	/* Every block is free again, and the slabs are carved from the start, so
+	 * there is no need to walk them */
+	pool->free = NULL;
+	pool->size = 0;
+	pool->used = 0;
+	pool->left = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pool_reserve(struct sp_pool *pool, size_t n)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	/* Blocks which are not handed out are either on the free list, or yet to
+	 * be carved out of the slabs */
+	if (n <= pool->capacity - pool->size)
+		return 0;
+	if ((err = sp_pool_grow(pool, n - (pool->capacity - pool->size))))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_pool_alloc(struct sp_pool *pool)
+{
+	void *block;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool NULL */
+#endif
+	if (sp_pool_take(pool, &block))
+		return NULL;
+	if (pool->ctor != NULL && (err = pool->ctor(block))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO ctor err */
+		sp_pool_give(pool, block);
+		return NULL;
+	}
+	return block;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pool_free(struct sp_pool *pool, void *block)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	size_t i;
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR block SP_EINVAL */
+	for (i = 0; i < pool->nslabs; i++) {
+		const struct sp_pool_slab *const slab = &pool->slabs[i];
+		if ((char*)block >= slab->data && (char*)block < slab->data + slab->size * pool->stride)
+			break;
+	}
+	if (i == pool->nslabs || ((char*)block - pool->slabs[i].data) % pool->stride != 0) {
+		error(("block was not allocated from this pool"));
+		return SP_EILLEGAL;
+	}
+	if (pool->size == 0) {
+		error(("pool has no blocks in use"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (pool->dtor != NULL && (err = pool->dtor(block))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_pool_give(pool, block);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_pool_print(const struct sp_pool *pool)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+#endif
+	printf("sp_pool_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", block_size: "SP_SIZE_FMT", stride: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)pool->size, (SP_SIZE_T)pool->capacity, (SP_SIZE_T)pool->block_size, (SP_SIZE_T)pool->stride);
+	for (i = 0; i < pool->nslabs; i++) {
+		const size_t carved = i + 1 < pool->used ? pool->slabs[i].size
+			: i + 1 == pool->used ? pool->slabs[i].size - pool->left : 0;
+		printf("["SP_SIZE_FMT"]\t"SP_SIZE_FMT"/"SP_SIZE_FMT"\t%p\n", (SP_SIZE_T)i,
+			(SP_SIZE_T)carved, (SP_SIZE_T)pool->slabs[i].size, (void*)pool->slabs[i].data);
+	}
+	return 0;
+}
+/*F}*/
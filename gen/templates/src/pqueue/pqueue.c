@@ -0,0 +1,367 @@
+#include "../sp_pqueue.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_pqueue *sp_pqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*))
+{
+	struct sp_pqueue *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	/*. C_ERR_CAPACITY_ZERO */
+	if (arity == 1) {
+		error(("arity must be at least 2"));
+		return NULL;
+	}
+	if (order != SP_PQUEUE_MIN && order != SP_PQUEUE_MAX) {
+		error(("order must be SP_PQUEUE_MIN or SP_PQUEUE_MAX"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / elem_size) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = 0;
+	ret->capacity  = capacity;
+	ret->arity     = arity ? arity : SP_PQUEUE_ARITY;
+	ret->order     = order;
+	ret->cmp       = cmp;
+	ret->data      = malloc(capacity * elem_size);
+	if (ret->data == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pqueue_clear(struct sp_pqueue *pq, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+#endif
+	if (dtor != NULL) {
+		const void *const end = (char*)pq->data + pq->size * pq->elem_size;
+		char *p = pq->data;
+		while (p != end) {
+			int err;
+			if ((err = dtor(p))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+			p += pq->elem_size;
+		}
+	}
+	pq->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_pqueue_destroy(struct sp_pqueue *pq, int (*dtor)(void*))
+{
+	int error;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+#endif
+	if ((error = sp_pqueue_clear(pq, dtor)))
+		return SP_ECALLBK;
+	free(pq->data);
+	free(pq);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_pqueue_push(struct sp_pqueue *pq, const void *elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	if (pq->cmp == NULL) {
+		error(("pq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (sp_size_try_add(pq->size * pq->elem_size, pq->elem_size))
+		return SP_ERANGE;
+	if (sp_buf_fit(&pq->data, pq->size, &pq->capacity, pq->elem_size))
+		return SP_ENOMEM;
+	memcpy(SP_PQUEUE_ELEM(pq, pq->size), elem, pq->elem_size);
+	sp_pqueue_siftup(pq, pq->size++);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pqueue_push$SUFFIX$(struct sp_pqueue *pq, $TYPE$ elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE pq elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(pq->size * pq->elem_size, pq->elem_size))
+		return SP_ERANGE;
+	if (sp_buf_fit(&pq->data, pq->size, &pq->capacity, pq->elem_size))
+		return SP_ENOMEM;
+	(($TYPE$*)pq->data)[pq->size] = elem;
+	if (pq->order == SP_PQUEUE_MIN)
+		SP_PQUEUE_SIFTUP($TYPE$, pq->data, pq->size, pq->arity, SP_PQUEUE_LT);
+	else
+		SP_PQUEUE_SIFTUP($TYPE$, pq->data, pq->size, pq->arity, SP_PQUEUE_GT);
+	++pq->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_pqueue_peek(const struct sp_pqueue *pq)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq NULL */
+	if (pq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY pq */
+		return NULL;
+	}
+#endif
+	return pq->data;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_pqueue_peek$SUFFIX$(const struct sp_pqueue *pq)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE pq $TYPE$ 0 */
+	if (pq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY pq */
+		return 0;
+	}
+#endif
+	return *($TYPE$*)pq->data;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_pqueue_pop(struct sp_pqueue *pq, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+	if (pq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY pq */
+		return SP_EILLEGAL;
+	}
+	if (pq->cmp == NULL) {
+		error(("pq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(pq->data))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	if (--pq->size > 0) {
+		memcpy(pq->data, SP_PQUEUE_ELEM(pq, pq->size), pq->elem_size);
+		sp_pqueue_siftdown(pq, 0);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_pqueue_pop$SUFFIX$(struct sp_pqueue *pq)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq 0 */
+	if (pq->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY pq */
+		return 0;
+	}
+	/*. C_ERR_INCOMPAT_ELEM_TYPE pq $TYPE$ 0 */
+#endif
+	ret = *($TYPE$*)pq->data;
+	if (--pq->size > 0) {
+		(($TYPE$*)pq->data)[0] = (($TYPE$*)pq->data)[pq->size];
+		if (pq->order == SP_PQUEUE_MIN)
+			SP_PQUEUE_SIFTDOWN($TYPE$, pq->data, pq->size, 0, pq->arity, SP_PQUEUE_LT);
+		else
+			SP_PQUEUE_SIFTDOWN($TYPE$, pq->data, pq->size, 0, pq->arity, SP_PQUEUE_GT);
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_pqueue_heapify(struct sp_pqueue *pq, const void *arr, size_t n)
+{
+	size_t i;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+	/*. C_ERR_NULLPTR arr SP_EINVAL */
+	if (pq->cmp == NULL) {
+		error(("pq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((err = sp_pqueue_reserve(pq, n)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy(SP_PQUEUE_ELEM(pq, pq->size), arr, n * pq->elem_size);
+
+	/* A few elements added to a large queue are cheaper to sift up one by
+	 * one, otherwise the whole queue is rebuilt in linear time */
+	if (n < pq->size / 8) {
+		for (i = 0; i < n; i++)
+			sp_pqueue_siftup(pq, pq->size++);
+	} else {
+		pq->size += n;
+		sp_pqueue_heapify_all(pq);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_pqueue_heapify$SUFFIX$(struct sp_pqueue *pq, const $TYPE$ *arr, size_t n)
+{
+	size_t i;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+	/*. C_ERR_NULLPTR arr SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE pq $TYPE$ SP_EILLEGAL */
+#endif
+	if ((err = sp_pqueue_reserve(pq, n)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy(($TYPE$*)pq->data + pq->size, arr, n * sizeof($TYPE$));
+
+	/* See sp_pqueue_heapify() */
+	if (n < pq->size / 8) {
+		for (i = 0; i < n; i++, pq->size++)
+			if (pq->order == SP_PQUEUE_MIN)
+				SP_PQUEUE_SIFTUP($TYPE$, pq->data, pq->size, pq->arity, SP_PQUEUE_LT);
+			else
+				SP_PQUEUE_SIFTUP($TYPE$, pq->data, pq->size, pq->arity, SP_PQUEUE_GT);
+	} else {
+		pq->size += n;
+		if (pq->order == SP_PQUEUE_MIN)
+			SP_PQUEUE_HEAPIFY($TYPE$, pq->data, pq->size, pq->arity, SP_PQUEUE_LT);
+		else
+			SP_PQUEUE_HEAPIFY($TYPE$, pq->data, pq->size, pq->arity, SP_PQUEUE_GT);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pqueue_merge(struct sp_pqueue *dest, const struct sp_pqueue *src)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest == src) {
+		error(("dest and src must be different"));
+		return SP_EILLEGAL;
+	}
+	if (dest->elem_size != src->elem_size || dest->order != src->order) {
+		error(("dest and src are incompatible"));
+		return SP_EILLEGAL;
+	}
+#endif
+	return sp_pqueue_heapify(dest, src->data, src->size);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_pqueue_merge$SUFFIX$(struct sp_pqueue *dest, const struct sp_pqueue *src)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	if (dest == src) {
+		error(("dest and src must be different"));
+		return SP_EILLEGAL;
+	}
+	if (dest->elem_size != src->elem_size || dest->order != src->order) {
+		error(("dest and src are incompatible"));
+		return SP_EILLEGAL;
+	}
+#endif
+	return sp_pqueue_heapify$SUFFIX$(dest, src->data, src->size);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_pqueue_print(const struct sp_pqueue *pq, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+#endif
+	printf("sp_pqueue_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", arity: "SP_SIZE_FMT", order: %s\n",
+		(SP_SIZE_T)pq->size, (SP_SIZE_T)pq->capacity, (SP_SIZE_T)pq->elem_size, (SP_SIZE_T)pq->arity,
+		pq->order == SP_PQUEUE_MIN ? "min" : "max");
+	for (i = 0; i < pq->size; i++) {
+		const void *const elem = SP_PQUEUE_ELEM(pq, i);
+		int err;
+		printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_pqueue_print$SUFFIX$(const struct sp_pqueue *pq)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR pq SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE pq $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_pqueue_print$SUFFIX$()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", arity: "SP_SIZE_FMT", order: %s\n",
+		(SP_SIZE_T)pq->size, (SP_SIZE_T)pq->capacity, (SP_SIZE_T)pq->elem_size, (SP_SIZE_T)pq->arity,
+		pq->order == SP_PQUEUE_MIN ? "min" : "max");
+	for (i = 0; i < pq->size; i++) {
+		const $TYPE$ elem = (($TYPE$*)pq->data)[i];
+		printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)i, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
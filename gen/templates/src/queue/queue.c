@@ -285,6 +285,307 @@ int sp_queue_pushstrn(struct sp_queue *queue, const char *elem, size_t len)
 }
 /*F}*/
 
+/*F{*/
+#include "../sp_errcodes.h"
+#include "../sp_intern.h"
+int sp_queue_pushistr(struct sp_queue *queue, struct sp_intern *pool, const char *elem)
+{
+	size_t id;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(queue->size * queue->elem_size, queue->elem_size))
+		return SP_ERANGE;
+	if (sp_ringbuf_fit(&queue->data, queue->size, &queue->capacity, queue->elem_size, &queue->head, &queue->tail))
+		return SP_ENOMEM;
+	if ((err = sp_intern_add(pool, elem, &id)))
+		return err;
+	if (queue->size != 0)
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	*(const char**)queue->tail = pool->strs[id].str;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_pushfront(struct sp_queue *queue, const void *elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if (sp_size_try_add(queue->size * queue->elem_size, queue->elem_size))
+		return SP_ERANGE;
+	if (sp_ringbuf_fit(&queue->data, queue->size, &queue->capacity, queue->elem_size, &queue->head, &queue->tail))
+		return SP_ENOMEM;
+	if (queue->size != 0)
+		sp_ringbuf_decr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+	memcpy(queue->head, elem, queue->elem_size);
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_queue_pushfront$SUFFIX$(struct sp_queue *queue, $TYPE$ elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(queue->size * queue->elem_size, queue->elem_size))
+		return SP_ERANGE;
+	if (sp_ringbuf_fit(&queue->data, queue->size, &queue->capacity, queue->elem_size, &queue->head, &queue->tail))
+		return SP_ENOMEM;
+	if (queue->size != 0)
+		sp_ringbuf_decr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+	*($TYPE$*)queue->head = elem;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_pushfrontstr(struct sp_queue *queue, const char *elem)
+{
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(queue->size * queue->elem_size, queue->elem_size))
+		return SP_ERANGE;
+	if (sp_ringbuf_fit(&queue->data, queue->size, &queue->capacity, queue->elem_size, &queue->head, &queue->tail))
+		return SP_ENOMEM;
+	len = sp_strnlen(elem, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	if (queue->size != 0)
+		sp_ringbuf_decr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+	*(char**)queue->head = buf;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_pushfrontstrn(struct sp_queue *queue, const char *elem, size_t len)
+{
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(queue->size * queue->elem_size, queue->elem_size))
+		return SP_ERANGE;
+	if (sp_ringbuf_fit(&queue->data, queue->size, &queue->capacity, queue->elem_size, &queue->head, &queue->tail))
+		return SP_ENOMEM;
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	if (queue->size != 0)
+		sp_ringbuf_decr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+	*(char**)queue->head = buf;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_rpush(struct sp_queue *queue, const void *elem, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if (queue->size == queue->capacity) {
+		if (dtor != NULL && (err = dtor(queue->head))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+			return SP_ECALLBK;
+		}
+		sp_ringbuf_incr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+		--queue->size;
+	}
+	if (queue->size != 0)
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	memcpy(queue->tail, elem, queue->elem_size);
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_queue_rpush$SUFFIX$(struct sp_queue *queue, $TYPE$ elem)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	if (queue->size == queue->capacity) {
+		sp_ringbuf_incr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+		--queue->size;
+	}
+	if (queue->size != 0)
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	*($TYPE$*)queue->tail = elem;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_rpushstr(struct sp_queue *queue, const char *elem)
+{
+	char *buf;
+	size_t len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	len = sp_strnlen(elem, SP_SIZE_MAX);
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	if (queue->size == queue->capacity) {
+		free(*(char**)queue->head);
+		sp_ringbuf_incr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+		--queue->size;
+	}
+	if (queue->size != 0)
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	*(char**)queue->tail = buf;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_rpushstrn(struct sp_queue *queue, const char *elem, size_t len)
+{
+	char *buf;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	buf = malloc((len + 1) * sizeof(*elem));
+	if (buf == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return SP_ENOMEM;
+	}
+	memcpy(buf, elem, len * sizeof(*elem));
+	buf[len] = '\0';
+	if (queue->size == queue->capacity) {
+		free(*(char**)queue->head);
+		sp_ringbuf_incr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+		--queue->size;
+	}
+	if (queue->size != 0)
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	*(char**)queue->tail = buf;
+	++queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_rpushn(struct sp_queue *queue, const void *elems, size_t n, int (*dtor)(void*))
+{
+	size_t drop, start, len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR elems SP_EINVAL */
+#endif
+	if (n == 0)
+		return 0;
+
+	/* Elements which would be overwritten within this very call are
+	 * skipped altogether, only the newest capacity elements are copied. */
+	if (n > queue->capacity) {
+		elems = (const char*)elems + (n - queue->capacity) * queue->elem_size;
+		n = queue->capacity;
+	}
+
+	/* Discard the oldest elements to make room */
+	drop = (n > queue->capacity - queue->size) ? n - (queue->capacity - queue->size) : 0;
+	if (dtor != NULL) {
+		while (drop != 0) {
+			int err;
+			if ((err = dtor(queue->head))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+			sp_ringbuf_incr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+			--queue->size;
+			--drop;
+		}
+	} else if (drop != 0) {
+		queue->head  = sp_ringbuf_get(drop, queue->data, queue->capacity, queue->elem_size, queue->head);
+		queue->size -= drop;
+	}
+	if (queue->size == 0)
+		queue->tail = queue->head;
+	else
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+
+	/* Copy the new elements in at most 2 contiguous spans */
+	start = ((char*)queue->tail - (char*)queue->data) / queue->elem_size;
+	len   = MIN(n, queue->capacity - start);
+	memcpy(queue->tail, elems, len * queue->elem_size);
+	memcpy(queue->data, (const char*)elems + len * queue->elem_size, (n - len) * queue->elem_size);
+	queue->tail  = sp_ringbuf_get(n - 1, queue->data, queue->capacity, queue->elem_size, queue->tail);
+	queue->size += n;
+	return 0;
+}
+/*F}*/
+
 /*F{*/
 #include "../sp_errcodes.h"
 #include <string.h>
@@ -580,6 +881,51 @@ char *sp_queue_peekstr(const struct sp_queue *queue)
 /*F}*/
 
 
+/*F{*/
+void *sp_queue_peekback(const struct sp_queue *queue)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue NULL */
+	if (queue->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY queue */
+		return NULL;
+	}
+#endif
+	return queue->tail;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_queue_peekback$SUFFIX$(const struct sp_queue *queue)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue $TYPE$ 0 */
+	if (queue->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY queue */
+		return 0;
+	}
+#endif
+	return *($TYPE$*)queue->tail;
+}
+/*F}*/
+
+/*F{*/
+char *sp_queue_peekbackstr(const struct sp_queue *queue)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue char* NULL */
+	if (queue->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY queue */
+		return NULL;
+	}
+#endif
+	return *(char**)queue->tail;
+}
+/*F}*/
+
+
 /*F{*/
 #include "../sp_errcodes.h"
 #include <string.h>
@@ -645,6 +991,70 @@ char *sp_queue_popstr(struct sp_queue *queue)
 /*F}*/
 
 
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_queue_popback(struct sp_queue *queue, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	if (queue->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY queue */
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(queue->tail))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	if (queue->size != 1)
+		sp_ringbuf_decr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	--queue->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_queue_popback$SUFFIX$(struct sp_queue *queue)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue 0 */
+	if (queue->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY queue */
+		return 0;
+	}
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue $TYPE$ 0 */
+#endif
+	ret = *($TYPE$*)queue->tail;
+	if (queue->size != 1)
+		sp_ringbuf_decr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	--queue->size;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+char *sp_queue_popbackstr(struct sp_queue *queue)
+{
+	char *ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue NULL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE queue char* NULL */
+	if (queue->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY queue */
+		return NULL;
+	}
+#endif
+	ret = *(char**)queue->tail;
+	if (queue->size != 1)
+		sp_ringbuf_decr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+	--queue->size;
+	return ret;
+}
+/*F}*/
+
+
 /*F{*/
 #include "../sp_errcodes.h"
 #include <string.h>
@@ -782,6 +1192,72 @@ char *sp_queue_qremovestr(struct sp_queue *queue, size_t idx)
 /*F}*/
 
 
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_last(const struct sp_queue *queue, size_t n, void *dest)
+{
+	const char *src;
+	size_t start, len;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	if (n > queue->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (n == 0)
+		return 0;
+	src   = sp_ringbuf_get(queue->size - n, queue->data, queue->capacity, queue->elem_size, queue->head);
+	start = (src - (char*)queue->data) / queue->elem_size;
+	len   = MIN(n, queue->capacity - start);
+	memcpy(dest, src, len * queue->elem_size);
+	memcpy((char*)dest + len * queue->elem_size, queue->data, (n - len) * queue->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_queue_rotate(struct sp_queue *queue, size_t n)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR queue SP_EINVAL */
+#endif
+	if (queue->size == 0)
+		return 0;
+	n %= queue->size;
+	if (n == 0)
+		return 0;
+	if (queue->size == queue->capacity) {
+		/* The ring is full, so only its ends need to change */
+		queue->head = sp_ringbuf_get(n, queue->data, queue->capacity, queue->elem_size, queue->head);
+		queue->tail = sp_ringbuf_get(queue->size - 1, queue->data, queue->capacity, queue->elem_size, queue->head);
+	} else {
+		const size_t capacity = queue->capacity;
+		size_t head = ((char*)queue->head - (char*)queue->data) / queue->elem_size;
+		size_t tail = ((char*)queue->tail - (char*)queue->data) / queue->elem_size;
+		if (n <= queue->size / 2) {
+			/* Move n elements from the front to the back */
+			sp_ringbuf_move(queue->data, capacity, queue->elem_size, tail == capacity - 1 ? 0 : tail + 1, head, n);
+			head = n < capacity - head ? head + n : n - (capacity - head);
+			tail = n < capacity - tail ? tail + n : n - (capacity - tail);
+		} else {
+			/* Move (size - n) elements from the back to the front */
+			n = queue->size - n;
+			head = head >= n ? head - n : head + (capacity - n);
+			tail = tail >= n ? tail - n : tail + (capacity - n);
+			sp_ringbuf_move(queue->data, capacity, queue->elem_size, head, tail == capacity - 1 ? 0 : tail + 1, n);
+		}
+		queue->head = (char*)queue->data + head * queue->elem_size;
+		queue->tail = (char*)queue->data + tail * queue->elem_size;
+	}
+	return 0;
+}
+/*F}*/
+
 /*F{*/
 void *sp_queue_get(const struct sp_queue *queue, size_t idx)
 {
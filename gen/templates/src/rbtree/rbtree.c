@@ -0,0 +1,283 @@
+#include "../sp_rbtree.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_rbtree *sp_rbtree_create(int (*cmp)(const struct sp_rbnode*, const struct sp_rbnode*))
+{
+	struct sp_rbtree *ret;
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	ret->root = NULL;
+	ret->size = 0;
+	ret->cmp  = cmp;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_rbtree_clear(struct sp_rbtree *tree, int (*dtor)(struct sp_rbnode*))
+{
+	struct sp_rbnode *node;
+	int ret = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	node = tree->root;
+	tree->root = NULL;
+	tree->size = 0;
+	if (dtor == NULL)
+		return 0;
+
+	/* Nodes are visited in post-order, so that each one can be freed by dtor
+	 * right after the next one has been looked up. As the nodes already left
+	 * the tree, dtor is called on all of them even if it fails. */
+	while (node != NULL && (node->left != NULL || node->right != NULL))
+		node = node->left != NULL ? node->left : node->right;
+	while (node != NULL) {
+		struct sp_rbnode *next = node->parent;
+		int err;
+		if (next != NULL && next->left == node && next->right != NULL) {
+			next = next->right;
+			while (next->left != NULL || next->right != NULL)
+				next = next->left != NULL ? next->left : next->right;
+		}
+		if ((err = dtor(node))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+			ret = SP_ECALLBK;
+		}
+		node = next;
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+int sp_rbtree_destroy(struct sp_rbtree *tree, int (*dtor)(struct sp_rbnode*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	if (sp_rbtree_clear(tree, dtor))
+		return SP_ECALLBK;
+	free(tree);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_rbtree_insert(struct sp_rbtree *tree, struct sp_rbnode *node)
+{
+	struct sp_rbnode *parent = NULL, **link;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Equal nodes go right, to keep them in insertion order */
+	link = &tree->root;
+	while (*link != NULL) {
+		parent = *link;
+		link = tree->cmp(node, parent) < 0 ? &parent->left : &parent->right;
+	}
+	sp_rbtree_link(tree, parent, link, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_rbtree_inserthint(struct sp_rbtree *tree, struct sp_rbnode *hint, struct sp_rbnode *node)
+{
+	struct sp_rbnode *prev;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* The node fits right before hint (or at the end of the tree) if it is
+	 * ordered between hint and its predecessor. The free child pointer next
+	 * to them is then found without a single comparison. */
+	prev = hint == NULL ? sp_rbtree_last(tree) : sp_rbtree_prev(hint);
+	if ((hint != NULL && tree->cmp(node, hint) > 0) || (prev != NULL && tree->cmp(node, prev) < 0))
+		return sp_rbtree_insert(tree, node);
+	if (hint != NULL && hint->left == NULL)
+		sp_rbtree_link(tree, hint, &hint->left, node);
+	else if (prev != NULL)
+		sp_rbtree_link(tree, prev, &prev->right, node);
+	else
+		sp_rbtree_link(tree, NULL, &tree->root, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_rbtree_remove(struct sp_rbtree *tree, struct sp_rbnode *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR node SP_EINVAL */
+	if (tree->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY tree */
+		return SP_EILLEGAL;
+	}
+#endif
+	sp_rbtree_unlink(tree, node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_find(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*))
+{
+	struct sp_rbnode *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	/*. C_ERR_NULLPTR cmp NULL */
+#endif
+	/* Of several equal nodes, the first one is found */
+	node = sp_rbtree_lowerbound(tree, key, cmp);
+	return node != NULL && cmp(key, node) == 0 ? node : NULL;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_lowerbound(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*))
+{
+	struct sp_rbnode *node, *ret = NULL;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	/*. C_ERR_NULLPTR cmp NULL */
+#endif
+	for (node = tree->root; node != NULL;) {
+		if (cmp(key, node) <= 0) {
+			ret  = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_upperbound(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*))
+{
+	struct sp_rbnode *node, *ret = NULL;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+	/*. C_ERR_NULLPTR cmp NULL */
+#endif
+	for (node = tree->root; node != NULL;) {
+		if (cmp(key, node) < 0) {
+			ret  = node;
+			node = node->left;
+		} else {
+			node = node->right;
+		}
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_first(const struct sp_rbtree *tree)
+{
+	struct sp_rbnode *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+#endif
+	if ((node = tree->root) != NULL)
+		while (node->left != NULL)
+			node = node->left;
+	return node;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_last(const struct sp_rbtree *tree)
+{
+	struct sp_rbnode *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree NULL */
+#endif
+	if ((node = tree->root) != NULL)
+		while (node->right != NULL)
+			node = node->right;
+	return node;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_next(const struct sp_rbnode *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	if (node->right != NULL) {
+		node = node->right;
+		while (node->left != NULL)
+			node = node->left;
+		return (struct sp_rbnode*)node;
+	}
+	while (node->parent != NULL && node->parent->right == node)
+		node = node->parent;
+	return node->parent;
+}
+/*F}*/
+
+/*F{*/
+struct sp_rbnode *sp_rbtree_prev(const struct sp_rbnode *node)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR node NULL */
+#endif
+	if (node->left != NULL) {
+		node = node->left;
+		while (node->right != NULL)
+			node = node->right;
+		return (struct sp_rbnode*)node;
+	}
+	while (node->parent != NULL && node->parent->left == node)
+		node = node->parent;
+	return node->parent;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_rbtree_print(const struct sp_rbtree *tree, int (*func)(const struct sp_rbnode*))
+{
+	const struct sp_rbnode *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	printf("sp_rbtree_print()\nsize: "SP_SIZE_FMT"\n", (SP_SIZE_T)tree->size);
+	for (node = sp_rbtree_first(tree); node != NULL; node = sp_rbtree_next(node), i++) {
+		int err;
+		printf("["SP_SIZE_FMT"]\t%c\t", (SP_SIZE_T)i, node->color == SP_RBTREE_RED ? 'R' : 'B');
+		if (func == NULL)
+			printf("%p\n", (const void*)node);
+		else if ((err = func(node))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
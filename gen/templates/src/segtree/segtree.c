@@ -0,0 +1,262 @@
+#include "../sp_segtree.h"
+#include "../internal.h"
+
+/*F{*/
+#include <string.h>
+struct sp_segtree *sp_segtree_create(size_t elem_size, size_t size)
+{
+	struct sp_segtree *ret;
+	size_t cap = 1, height = 0;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	if (size == 0) {
+		error(("size cannot be 0"));
+		return NULL;
+	}
+#endif
+	while (cap < size && cap <= SP_SIZE_MAX / 4) {
+		cap *= 2;
+		height++;
+	}
+	if (cap < size || cap > SP_SIZE_MAX / 2 / SP_SEGTREE_FIELDS / elem_size) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = size;
+	ret->cap       = cap;
+	ret->height    = height;
+	ret->data      = malloc(2 * cap * SP_SEGTREE_FIELDS * elem_size);
+	ret->lazy      = malloc(cap);
+	if (ret->data == NULL || ret->lazy == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret->data);
+		free(ret->lazy);
+		free(ret);
+		return NULL;
+	}
+	memset(ret->data, 0, 2 * cap * SP_SEGTREE_FIELDS * elem_size);
+	memset(ret->lazy, 0, cap);
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_segtree_clear(struct sp_segtree *tree)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	memset(tree->data, 0, 2 * tree->cap * SP_SEGTREE_FIELDS * tree->elem_size);
+	memset(tree->lazy, 0, tree->cap);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_segtree_destroy(struct sp_segtree *tree)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+#endif
+	free(tree->data);
+	free(tree->lazy);
+	free(tree);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_segtree_build$SUFFIX$(struct sp_segtree *tree, const $TYPE$ *vals)
+{
+	size_t i, h;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_NULLPTR vals SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree $TYPE$ SP_EILLEGAL */
+#endif
+	sp_segtree_clear(tree);
+	for (i = 0; i < tree->size; i++) {
+		$TYPE$ *const leaf = SP_SEGTREE_NODE($TYPE$, tree, tree->cap + i);
+		leaf[SP_SEGTREE_SUM] = leaf[SP_SEGTREE_MIN] = leaf[SP_SEGTREE_MAX] = vals[i];
+	}
+	for (h = 1; h <= tree->height; h++) {
+		for (i = tree->cap >> h; i < tree->cap >> (h - 1); i++)
+			SP_SEGTREE_PULL($TYPE$, tree, i, h);
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_segtree_get$SUFFIX$(const struct sp_segtree *tree, size_t idx)
+{
+	size_t leaf;
+	$TYPE$ ret;
+	size_t h;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree $TYPE$ 0 */
+	if (idx >= tree->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	leaf = tree->cap + idx;
+	/* Replaying the pending updates above the leaf, oldest first, leaves
+	 * the tree as it is */
+	ret = SP_SEGTREE_NODE($TYPE$, tree, leaf)[SP_SEGTREE_SUM];
+	for (h = 1; h <= tree->height; h++) {
+		const $TYPE$ *const node = SP_SEGTREE_NODE($TYPE$, tree, leaf >> h);
+		if (tree->lazy[leaf >> h] == SP_SEGTREE_SET)
+			ret = node[SP_SEGTREE_VALUE];
+		else if (tree->lazy[leaf >> h] == SP_SEGTREE_ADD)
+			ret += node[SP_SEGTREE_DELTA];
+	}
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_segtree_set$SUFFIX$(struct sp_segtree *tree, size_t idx, $TYPE$ val)
+{
+	size_t leaf;
+	$TYPE$ *node;
+	size_t h;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree val SP_EILLEGAL */
+	if (idx >= tree->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	leaf = tree->cap + idx;
+	for (h = tree->height; h >= 1; h--)
+		SP_SEGTREE_PUSH($TYPE$, tree, leaf >> h, h);
+	node = SP_SEGTREE_NODE($TYPE$, tree, leaf);
+	node[SP_SEGTREE_SUM] = node[SP_SEGTREE_MIN] = node[SP_SEGTREE_MAX] = val;
+	for (h = 1; h <= tree->height; h++)
+		SP_SEGTREE_PULL($TYPE$, tree, leaf >> h, h);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_segtree_add$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n, $TYPE$ delta)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree delta SP_EILLEGAL */
+	if (idx > tree->size || n > tree->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	SP_SEGTREE_UPDATE($TYPE$, tree, idx, n, SP_SEGTREE_ADD, delta);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_segtree_fill$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n, $TYPE$ val)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree val SP_EILLEGAL */
+	if (idx > tree->size || n > tree->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	SP_SEGTREE_UPDATE($TYPE$, tree, idx, n, SP_SEGTREE_SET, val);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_segtree_sum$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree $TYPE$ 0 */
+	if (idx > tree->size || n > tree->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	SP_SEGTREE_QUERY($TYPE$, tree, idx, n, SP_SEGTREE_SUM, ret);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_segtree_min$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree $TYPE$ 0 */
+	if (idx >= tree->size || n == 0 || n > tree->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	SP_SEGTREE_QUERY($TYPE$, tree, idx, n, SP_SEGTREE_MIN, ret);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_segtree_max$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n)
+{
+	$TYPE$ ret;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree $TYPE$ 0 */
+	if (idx >= tree->size || n == 0 || n > tree->size - idx) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	SP_SEGTREE_QUERY($TYPE$, tree, idx, n, SP_SEGTREE_MAX, ret);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_segtree_print$SUFFIX$(const struct sp_segtree *tree)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR tree SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE tree $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_segtree_print$SUFFIX$()\nsize: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", leaves: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)tree->size, (SP_SIZE_T)tree->elem_size, (SP_SIZE_T)tree->cap);
+	for (i = 0; i < tree->size; i++) {
+		const $TYPE$ elem = sp_segtree_get$SUFFIX$(tree, i);
+		printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)i, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
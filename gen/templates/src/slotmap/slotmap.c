@@ -0,0 +1,278 @@
+#include "../sp_slotmap.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_slotmap *sp_slotmap_create(size_t elem_size, size_t capacity)
+{
+	struct sp_slotmap *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(elem_size, sizeof(struct sp_slotmap_slot))
+			|| capacity > SP_SLOTMAP_MAX) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = 0;
+	ret->count     = 0;
+	ret->capacity  = capacity;
+	ret->head      = 0;
+	ret->tail      = 0;
+	ret->nfree     = 0;
+	ret->data      = malloc(capacity * elem_size);
+	ret->owner     = malloc(capacity * sizeof(size_t));
+	ret->slots     = malloc(capacity * sizeof(struct sp_slotmap_slot));
+	if (ret->data == NULL || ret->owner == NULL || ret->slots == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret->data);
+		free(ret->owner);
+		free(ret->slots);
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_slotmap_clear(struct sp_slotmap *sm, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+#endif
+	if (dtor != NULL) {
+		size_t i;
+		for (i = 0; i < sm->size; i++) {
+			int err;
+			if ((err = dtor(SP_SLOTMAP_ELEM(sm, i)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+
+	/* Releasing from the back moves no elements */
+	while (sm->size > 0)
+		sp_slotmap_release(sm, sm->size - 1);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_slotmap_destroy(struct sp_slotmap *sm, int (*dtor)(void*))
+{
+	int error;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+#endif
+	if ((error = sp_slotmap_clear(sm, dtor)))
+		return SP_ECALLBK;
+	free(sm->data);
+	free(sm->owner);
+	free(sm->slots);
+	free(sm);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_slotmap_map(struct sp_slotmap *sm, int (*func)(void*, size_t))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	for (i = 0; i < sm->size; i++) {
+		int err;
+		if ((err = func(SP_SLOTMAP_ELEM(sm, i), i))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_slotmap_insert(struct sp_slotmap *sm, const void *elem, struct sp_slotmap_handle *handle)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((err = sp_slotmap_acquire(sm, handle)))
+		return err;
+	memcpy(SP_SLOTMAP_ELEM(sm, sm->size - 1), elem, sm->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_slotmap_insert$SUFFIX$(struct sp_slotmap *sm, $TYPE$ elem, struct sp_slotmap_handle *handle)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE sm elem SP_EILLEGAL */
+#endif
+	if ((err = sp_slotmap_acquire(sm, handle)))
+		return err;
+	(($TYPE$*)sm->data)[sm->size - 1] = elem;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+int sp_slotmap_contains(const struct sp_slotmap *sm, struct sp_slotmap_handle handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm 0 */
+#endif
+	return SP_SLOTMAP_LIVE(sm, handle);
+}
+/*F}*/
+
+/*F{*/
+void *sp_slotmap_get(const struct sp_slotmap *sm, struct sp_slotmap_handle handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm NULL */
+#endif
+	if (!SP_SLOTMAP_LIVE(sm, handle))
+		return NULL;
+	return SP_SLOTMAP_ELEM(sm, sm->slots[handle.idx].pos);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_slotmap_get$SUFFIX$(const struct sp_slotmap *sm, struct sp_slotmap_handle handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE sm $TYPE$ 0 */
+#endif
+	if (!SP_SLOTMAP_LIVE(sm, handle))
+		return 0;
+	return (($TYPE$*)sm->data)[sm->slots[handle.idx].pos];
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_slotmap_remove(struct sp_slotmap *sm, struct sp_slotmap_handle handle, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+#endif
+	if (!SP_SLOTMAP_LIVE(sm, handle))
+		return SP_ENOKEY;
+	if (dtor != NULL && (err = dtor(SP_SLOTMAP_ELEM(sm, sm->slots[handle.idx].pos)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_slotmap_release(sm, sm->slots[handle.idx].pos);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_slotmap_remove$SUFFIX$(struct sp_slotmap *sm, struct sp_slotmap_handle handle)
+{
+	$TYPE$ ret;
+	size_t pos;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE sm $TYPE$ 0 */
+#endif
+	if (!SP_SLOTMAP_LIVE(sm, handle))
+		return 0;
+	pos = sm->slots[handle.idx].pos;
+	ret = (($TYPE$*)sm->data)[pos];
+	sp_slotmap_release(sm, pos);
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+struct sp_slotmap_handle sp_slotmap_at(const struct sp_slotmap *sm, size_t idx)
+{
+	struct sp_slotmap_handle ret;
+	ret.idx = 0;
+	ret.gen = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm ret */
+	if (idx >= sm->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return ret;
+	}
+#endif
+	ret.idx = (unsigned long)sm->owner[idx];
+	ret.gen = sm->slots[sm->owner[idx]].gen;
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_slotmap_print(const struct sp_slotmap *sm, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+#endif
+	printf("sp_slotmap_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", slots: "SP_SIZE_FMT", free: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)sm->size, (SP_SIZE_T)sm->capacity, (SP_SIZE_T)sm->elem_size, (SP_SIZE_T)sm->count, (SP_SIZE_T)sm->nfree);
+	for (i = 0; i < sm->size; i++) {
+		const void *const elem = SP_SLOTMAP_ELEM(sm, i);
+		int err;
+		printf("["SP_SIZE_FMT"]\t#"SP_SIZE_FMT":%lu\t", (SP_SIZE_T)i, (SP_SIZE_T)sm->owner[i], sm->slots[sm->owner[i]].gen);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_slotmap_print$SUFFIX$(const struct sp_slotmap *sm)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sm SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE sm $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_slotmap_print$SUFFIX$()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", slots: "SP_SIZE_FMT", free: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)sm->size, (SP_SIZE_T)sm->capacity, (SP_SIZE_T)sm->elem_size, (SP_SIZE_T)sm->count, (SP_SIZE_T)sm->nfree);
+	for (i = 0; i < sm->size; i++) {
+		const $TYPE$ elem = (($TYPE$*)sm->data)[i];
+		printf("["SP_SIZE_FMT"]\t#"SP_SIZE_FMT":%lu\t"$FMT_STR$"\n", (SP_SIZE_T)i, (SP_SIZE_T)sm->owner[i], sm->slots[sm->owner[i]].gen, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
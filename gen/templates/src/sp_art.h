@@ -0,0 +1,87 @@
+/*H{ STAPLE_ART_H */
+/* The adaptive radix tree module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Node types, stored in the first byte of every node */
+#define SP_ART_LEAF    0
+#define SP_ART_NODE4   1
+#define SP_ART_NODE16  2
+#define SP_ART_NODE48  3
+#define SP_ART_NODE256 4
+
+/* Number of bytes of a compressed path stored in a node */
+#define SP_ART_PREFIX 10
+
+struct sp_art_leaf {
+	unsigned char type;
+	size_t len;
+};
+
+struct sp_art_node {
+	unsigned char  type;
+	unsigned char  prefix[SP_ART_PREFIX];
+	unsigned short count;
+	size_t         prefix_len;
+	struct sp_art_leaf *term;
+};
+
+struct sp_art_node4 {
+	struct sp_art_node node;
+	unsigned char keys[4];
+	void *children[4];
+};
+
+struct sp_art_node16 {
+	struct sp_art_node node;
+	unsigned char keys[16];
+	void *children[16];
+};
+
+struct sp_art_node48 {
+	struct sp_art_node node;
+	unsigned char index[256];
+	void *children[48];
+};
+
+struct sp_art_node256 {
+	struct sp_art_node node;
+	void *children[256];
+};
+
+struct sp_art {
+	void  *root;
+	size_t val_size;
+	size_t val_offset;
+	size_t size;
+};
+
+struct sp_art *sp_art_create(size_t val_size);
+int            sp_art_clear(struct sp_art *art, int (*dtor)(void*));
+int            sp_art_destroy(struct sp_art *art, int (*dtor)(void*));
+
+int sp_art_insert(struct sp_art *art, const void *key, size_t len, const void *val);
+int sp_art_insert$SUFFIX$(struct sp_art *art, $TYPE$ key, const void *val);
+int sp_art_insertstr(struct sp_art *art, const char *key, const void *val);
+
+void *sp_art_get(const struct sp_art *art, const void *key, size_t len);
+void *sp_art_get$SUFFIX$(const struct sp_art *art, $TYPE$ key);
+void *sp_art_getstr(const struct sp_art *art, const char *key);
+
+int sp_art_remove(struct sp_art *art, const void *key, size_t len, int (*dtor)(void*));
+int sp_art_remove$SUFFIX$(struct sp_art *art, $TYPE$ key, int (*dtor)(void*));
+int sp_art_removestr(struct sp_art *art, const char *key, int (*dtor)(void*));
+
+void *sp_art_longestprefix(const struct sp_art *art, const void *key, size_t len, size_t *match);
+void *sp_art_longestprefixstr(const struct sp_art *art, const char *key, size_t *match);
+
+int sp_art_scan(const struct sp_art *art, const void *prefix, size_t len, int (*func)(const void*, size_t, void*));
+int sp_art_scanstr(const struct sp_art *art, const char *prefix, int (*func)(const void*, size_t, void*));
+
+int sp_art_print(const struct sp_art *art, int (*func)(const void*, size_t, void*));
@@ -0,0 +1,68 @@
+/*H{ STAPLE_AVL_H */
+/* The AVL tree module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pool.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_avl_node {
+	struct sp_avl_node *left;
+	struct sp_avl_node *right;
+	struct sp_avl_node *parent;
+	size_t size;
+	int    height;
+};
+
+struct sp_avl {
+	struct sp_avl_node *root;
+	size_t key_size;
+	size_t val_size;
+	size_t key_offset;
+	size_t val_offset;
+	size_t size;
+	struct sp_pool pool;
+	int  (*cmp)(const void*, const void*);
+};
+
+struct sp_avl *sp_avl_create(size_t key_size, size_t val_size, size_t capacity, int (*cmp)(const void*, const void*));
+int            sp_avl_clear(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*));
+int            sp_avl_destroy(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_avl_insert(struct sp_avl *avl, const void *key, const void *val);
+int sp_avl_insert$SUFFIX$(struct sp_avl *avl, $TYPE$ key, const void *val);
+
+int sp_avl_build(struct sp_avl *avl, const void *keys, const void *vals, size_t n);
+int sp_avl_build$SUFFIX$(struct sp_avl *avl, const $TYPE$ *keys, const void *vals, size_t n);
+
+struct sp_avl_node *sp_avl_find(const struct sp_avl *avl, const void *key);
+struct sp_avl_node *sp_avl_find$SUFFIX$(const struct sp_avl *avl, $TYPE$ key);
+
+struct sp_avl_node *sp_avl_lowerbound(const struct sp_avl *avl, const void *key);
+struct sp_avl_node *sp_avl_lowerbound$SUFFIX$(const struct sp_avl *avl, $TYPE$ key);
+
+struct sp_avl_node *sp_avl_upperbound(const struct sp_avl *avl, const void *key);
+struct sp_avl_node *sp_avl_upperbound$SUFFIX$(const struct sp_avl *avl, $TYPE$ key);
+
+void *sp_avl_key(const struct sp_avl *avl, const struct sp_avl_node *node);
+void *sp_avl_val(const struct sp_avl *avl, const struct sp_avl_node *node);
+
+struct sp_avl_node *sp_avl_first(const struct sp_avl *avl);
+struct sp_avl_node *sp_avl_last(const struct sp_avl *avl);
+struct sp_avl_node *sp_avl_next(const struct sp_avl_node *node);
+struct sp_avl_node *sp_avl_prev(const struct sp_avl_node *node);
+
+size_t              sp_avl_rank(const struct sp_avl *avl, const void *key);
+size_t              sp_avl_rank$SUFFIX$(const struct sp_avl *avl, $TYPE$ key);
+struct sp_avl_node *sp_avl_select(const struct sp_avl *avl, size_t idx);
+
+int sp_avl_remove(struct sp_avl *avl, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_avl_remove$SUFFIX$(struct sp_avl *avl, $TYPE$ key, int (*dtor)(void*));
+int sp_avl_erase(struct sp_avl *avl, struct sp_avl_node *node, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_avl_print(const struct sp_avl *avl, int (*func)(const void*, const void*));
+int sp_avl_print$SUFFIX$(const struct sp_avl *avl);
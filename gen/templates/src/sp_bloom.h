@@ -0,0 +1,48 @@
+/*H{ STAPLE_BLOOM_H */
+/* The bloom filter module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_bitarray.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Number of bits of a block of a blocked filter, which is one cache line */
+#define SP_BLOOM_BLOCK 512
+
+/* Size of the header of a serialized filter, in bytes */
+#define SP_BLOOM_HEADER 28
+
+struct sp_bloom {
+	struct sp_bitarray *bits;
+	size_t nbits;
+	size_t nhashes;
+	size_t offset;
+	size_t size;
+	int    blocked;
+};
+
+struct sp_bloom *sp_bloom_create(size_t capacity, double fpr, int blocked);
+int              sp_bloom_clear(struct sp_bloom *bloom);
+int              sp_bloom_destroy(struct sp_bloom *bloom);
+
+int sp_bloom_insert(struct sp_bloom *bloom, const void *data, size_t len);
+int sp_bloom_insert$SUFFIX$(struct sp_bloom *bloom, $TYPE$ elem);
+int sp_bloom_insertstr(struct sp_bloom *bloom, const char *str);
+
+int sp_bloom_contains(const struct sp_bloom *bloom, const void *data, size_t len);
+int sp_bloom_contains$SUFFIX$(const struct sp_bloom *bloom, $TYPE$ elem);
+int sp_bloom_containsstr(const struct sp_bloom *bloom, const char *str);
+
+int sp_bloom_union(struct sp_bloom *dest, const struct sp_bloom *src);
+int sp_bloom_intersect(struct sp_bloom *dest, const struct sp_bloom *src);
+
+double sp_bloom_fpr(const struct sp_bloom *bloom);
+
+size_t           sp_bloom_serialize(const struct sp_bloom *bloom, void *buf, size_t size);
+struct sp_bloom *sp_bloom_deserialize(const void *buf, size_t size);
+
+int sp_bloom_print(const struct sp_bloom *bloom);
@@ -0,0 +1,73 @@
+/*H{ STAPLE_BPTREE_H */
+/* The B+tree module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Default size of a node in bytes, a few cache lines */
+#define SP_BPTREE_NODE_SIZE 512
+
+struct sp_bptree_node {
+	struct sp_bptree_node *prev;
+	struct sp_bptree_node *next;
+	size_t count;
+};
+
+struct sp_bptree {
+	struct sp_bptree_node *root;
+	struct sp_bptree_node *head;
+	struct sp_bptree_node *tail;
+	size_t key_size;
+	size_t val_size;
+	size_t key_offset;
+	size_t val_offset;
+	size_t child_offset;
+	size_t leaf_size;
+	size_t inner_size;
+	size_t leaf_cap;
+	size_t inner_cap;
+	size_t size;
+	size_t height;
+	int  (*cmp)(const void*, const void*);
+};
+
+struct sp_bptree_iter {
+	struct sp_bptree_node *node;
+	size_t idx;
+};
+
+struct sp_bptree *sp_bptree_create(size_t key_size, size_t val_size, size_t node_size, int (*cmp)(const void*, const void*));
+int               sp_bptree_clear(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*));
+int               sp_bptree_destroy(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_bptree_insert(struct sp_bptree *tree, const void *key, const void *val);
+int sp_bptree_insert$SUFFIX$(struct sp_bptree *tree, $TYPE$ key, const void *val);
+
+int sp_bptree_build(struct sp_bptree *tree, const void *keys, const void *vals, size_t n);
+int sp_bptree_build$SUFFIX$(struct sp_bptree *tree, const $TYPE$ *keys, const void *vals, size_t n);
+
+void *sp_bptree_get(const struct sp_bptree *tree, const void *key);
+void *sp_bptree_get$SUFFIX$(const struct sp_bptree *tree, $TYPE$ key);
+
+int sp_bptree_remove(struct sp_bptree *tree, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_bptree_remove$SUFFIX$(struct sp_bptree *tree, $TYPE$ key, int (*dtor)(void*));
+
+int sp_bptree_first(const struct sp_bptree *tree, struct sp_bptree_iter *it);
+int sp_bptree_last(const struct sp_bptree *tree, struct sp_bptree_iter *it);
+int sp_bptree_lowerbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it);
+int sp_bptree_lowerbound$SUFFIX$(const struct sp_bptree *tree, $TYPE$ key, struct sp_bptree_iter *it);
+int sp_bptree_upperbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it);
+int sp_bptree_upperbound$SUFFIX$(const struct sp_bptree *tree, $TYPE$ key, struct sp_bptree_iter *it);
+int sp_bptree_next(struct sp_bptree_iter *it);
+int sp_bptree_prev(struct sp_bptree_iter *it);
+
+void *sp_bptree_key(const struct sp_bptree *tree, const struct sp_bptree_iter *it);
+void *sp_bptree_val(const struct sp_bptree *tree, const struct sp_bptree_iter *it);
+
+int sp_bptree_print(const struct sp_bptree *tree, int (*func)(const void*, const void*));
+int sp_bptree_print$SUFFIX$(const struct sp_bptree *tree);
@@ -0,0 +1,54 @@
+/*H{ STAPLE_CHASHMAP_H */
+/* The chashmap module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_hashmap.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_chashmap_retired {
+	struct sp_hashmap *table;
+	unsigned long      epoch;
+};
+
+struct sp_chashmap_shard {
+	struct sp_hashmap          *table;
+	struct sp_chashmap_retired *retired;
+	size_t                      nretired;
+	unsigned long               epoch;
+	unsigned long               readers[2];
+	unsigned long               seq;
+	unsigned long               lock;
+	unsigned char               pad[64];
+};
+
+struct sp_chashmap {
+	struct sp_chashmap_shard *shards;
+	size_t   nshards;
+	unsigned shard_shift;
+	size_t   key_size;
+	size_t   val_size;
+	size_t (*hash)(const void*);
+	int    (*cmp)(const void*, const void*);
+};
+
+struct sp_chashmap *sp_chashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t nshards, size_t (*hash)(const void*), int (*cmp)(const void*, const void*));
+int                 sp_chashmap_clear(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+int                 sp_chashmap_destroy(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+size_t              sp_chashmap_size(const struct sp_chashmap *map);
+int                 sp_chashmap_map(struct sp_chashmap *map, int (*func)(const void*, void*));
+
+int sp_chashmap_insert(struct sp_chashmap *map, const void *key, const void *val);
+int sp_chashmap_insert$SUFFIX$(struct sp_chashmap *map, $TYPE$ key, const void *val);
+
+int sp_chashmap_get(const struct sp_chashmap *map, const void *key, void *val);
+int sp_chashmap_get$SUFFIX$(const struct sp_chashmap *map, $TYPE$ key, void *val);
+
+int sp_chashmap_remove(struct sp_chashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_chashmap_remove$SUFFIX$(struct sp_chashmap *map, $TYPE$ key, int (*dtor)(void*));
+
+int sp_chashmap_print(const struct sp_chashmap *map, int (*func)(const void*, const void*));
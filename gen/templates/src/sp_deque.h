@@ -0,0 +1,83 @@
+/*H{ STAPLE_DEQUE_H */
+/* The deque module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_deque {
+	void **blocks;
+	size_t nblocks;
+	size_t head;
+	size_t elem_size;
+	size_t size;
+	size_t block_size;
+};
+
+struct sp_deque *sp_deque_create(size_t elem_size, size_t block_size);
+int              sp_deque_clear(struct sp_deque *deque, int (*dtor)(void*));
+int              sp_deque_destroy(struct sp_deque *deque, int (*dtor)(void*));
+int              sp_deque_eq(const struct sp_deque *deque1, const struct sp_deque *deque2, int (*cmp)(const void*, const void*));
+int              sp_deque_copy(struct sp_deque *dest, const struct sp_deque *src, int (*cpy)(void*, const void*));
+int              sp_deque_map(struct sp_deque *deque, int (*func)(void*, size_t));
+
+int sp_deque_pushfront(struct sp_deque *deque, const void *elem);
+int sp_deque_pushfront$SUFFIX$(struct sp_deque *deque, $TYPE$ elem);
+int sp_deque_pushfrontstr(struct sp_deque *deque, const char *elem);
+int sp_deque_pushfrontstrn(struct sp_deque *deque, const char *elem, size_t len);
+
+int sp_deque_pushback(struct sp_deque *deque, const void *elem);
+int sp_deque_pushback$SUFFIX$(struct sp_deque *deque, $TYPE$ elem);
+int sp_deque_pushbackstr(struct sp_deque *deque, const char *elem);
+int sp_deque_pushbackstrn(struct sp_deque *deque, const char *elem, size_t len);
+
+int sp_deque_insert(struct sp_deque *deque, size_t idx, const void *elem);
+int sp_deque_insert$SUFFIX$(struct sp_deque *deque, size_t idx, $TYPE$ elem);
+int sp_deque_insertstr(struct sp_deque *deque, size_t idx, const char *elem);
+int sp_deque_insertstrn(struct sp_deque *deque, size_t idx, const char *elem, size_t len);
+
+int sp_deque_qinsert(struct sp_deque *deque, size_t idx, const void *elem);
+int sp_deque_qinsert$SUFFIX$(struct sp_deque *deque, size_t idx, $TYPE$ elem);
+int sp_deque_qinsertstr(struct sp_deque *deque, size_t idx, const char *elem);
+int sp_deque_qinsertstrn(struct sp_deque *deque, size_t idx, const char *elem, size_t len);
+
+void          *sp_deque_peekfront(const struct sp_deque *deque);
+$TYPE$         sp_deque_peekfront$SUFFIX$(const struct sp_deque *deque);
+char          *sp_deque_peekfrontstr(const struct sp_deque *deque);
+
+void          *sp_deque_peekback(const struct sp_deque *deque);
+$TYPE$         sp_deque_peekback$SUFFIX$(const struct sp_deque *deque);
+char          *sp_deque_peekbackstr(const struct sp_deque *deque);
+
+int            sp_deque_popfront(struct sp_deque *deque, int (*dtor)(void*));
+$TYPE$         sp_deque_popfront$SUFFIX$(struct sp_deque *deque);
+char          *sp_deque_popfrontstr(struct sp_deque *deque);
+
+int            sp_deque_popback(struct sp_deque *deque, int (*dtor)(void*));
+$TYPE$         sp_deque_popback$SUFFIX$(struct sp_deque *deque);
+char          *sp_deque_popbackstr(struct sp_deque *deque);
+
+int            sp_deque_remove(struct sp_deque *deque, size_t idx, int (*dtor)(void*));
+$TYPE$         sp_deque_remove$SUFFIX$(struct sp_deque *deque, size_t idx);
+char          *sp_deque_removestr(struct sp_deque *deque, size_t idx);
+
+int            sp_deque_qremove(struct sp_deque *deque, size_t idx, int (*dtor)(void*));
+$TYPE$         sp_deque_qremove$SUFFIX$(struct sp_deque *deque, size_t idx);
+char          *sp_deque_qremovestr(struct sp_deque *deque, size_t idx);
+
+void          *sp_deque_get(const struct sp_deque *deque, size_t idx);
+$TYPE$         sp_deque_get$SUFFIX$(const struct sp_deque *deque, size_t idx);
+char          *sp_deque_getstr(const struct sp_deque *deque, size_t idx);
+
+int sp_deque_set(struct sp_deque *deque, size_t idx, void *val);
+int sp_deque_set$SUFFIX$(struct sp_deque *deque, size_t idx, $TYPE$ val);
+int sp_deque_setstr(struct sp_deque *deque, size_t idx, const char *val);
+int sp_deque_setstrn(struct sp_deque *deque, size_t idx, const char *val, size_t len);
+
+int sp_deque_print(const struct sp_deque *deque, int (*func)(const void*));
+int sp_deque_print$SUFFIX$(const struct sp_deque *deque);
+int sp_deque_printstr(const struct sp_deque *deque);
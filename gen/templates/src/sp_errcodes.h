@@ -22,3 +22,6 @@
 
 /* Numerical range exceeded (underflow/overflow) */
 #define SP_ERANGE 6
+
+/* Key not found */
+#define SP_ENOKEY 7
@@ -0,0 +1,31 @@
+/*H{ STAPLE_FENWICK_H */
+/* The Fenwick tree module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_fenwick {
+	void  *data;
+	size_t elem_size;
+	size_t size;
+};
+
+struct sp_fenwick *sp_fenwick_create(size_t elem_size, size_t size);
+int                sp_fenwick_clear(struct sp_fenwick *fw);
+int                sp_fenwick_destroy(struct sp_fenwick *fw);
+
+int     sp_fenwick_build$SUFFIX$(struct sp_fenwick *fw, const $TYPE$ *vals);
+int     sp_fenwick_add$SUFFIX$(struct sp_fenwick *fw, size_t idx, $TYPE$ delta);
+int     sp_fenwick_set$SUFFIX$(struct sp_fenwick *fw, size_t idx, $TYPE$ val);
+$TYPE$  sp_fenwick_get$SUFFIX$(const struct sp_fenwick *fw, size_t idx);
+
+$TYPE$  sp_fenwick_prefix$SUFFIX$(const struct sp_fenwick *fw, size_t n);
+$TYPE$  sp_fenwick_sum$SUFFIX$(const struct sp_fenwick *fw, size_t idx, size_t n);
+size_t  sp_fenwick_lowerbound$SUFFIX$(const struct sp_fenwick *fw, $TYPE$ target);
+
+int sp_fenwick_print$SUFFIX$(const struct sp_fenwick *fw);
@@ -0,0 +1,43 @@
+/*H{ STAPLE_HASHMAP_H */
+/* The hashmap module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_hashmap {
+	unsigned char *ctrl;
+	void  *slots;
+	size_t key_size;
+	size_t val_size;
+	size_t val_offset;
+	size_t slot_size;
+	size_t size;
+	size_t capacity;
+	size_t growth_left;
+	size_t (*hash)(const void*);
+	int    (*cmp)(const void*, const void*);
+};
+
+struct sp_hashmap *sp_hashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t (*hash)(const void*), int (*cmp)(const void*, const void*));
+int                sp_hashmap_clear(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+int                sp_hashmap_destroy(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+int                sp_hashmap_reserve(struct sp_hashmap *map, size_t n);
+int                sp_hashmap_eq(const struct sp_hashmap *map1, const struct sp_hashmap *map2, int (*cmp)(const void*, const void*));
+int                sp_hashmap_copy(struct sp_hashmap *dest, const struct sp_hashmap *src, int (*kcpy)(void*, const void*), int (*vcpy)(void*, const void*));
+int                sp_hashmap_map(struct sp_hashmap *map, int (*func)(const void*, void*));
+
+int sp_hashmap_insert(struct sp_hashmap *map, const void *key, const void *val);
+int sp_hashmap_insert$SUFFIX$(struct sp_hashmap *map, $TYPE$ key, const void *val);
+
+void *sp_hashmap_get(const struct sp_hashmap *map, const void *key);
+void *sp_hashmap_get$SUFFIX$(const struct sp_hashmap *map, $TYPE$ key);
+
+int sp_hashmap_remove(struct sp_hashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_hashmap_remove$SUFFIX$(struct sp_hashmap *map, $TYPE$ key, int (*dtor)(void*));
+
+int sp_hashmap_print(const struct sp_hashmap *map, int (*func)(const void*, const void*));
@@ -0,0 +1,38 @@
+/*H{ STAPLE_INTERN_H */
+/* The intern module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_hashmap.h"
+
+struct sp_intern_str {
+	const char *str;
+	size_t      len;
+};
+
+struct sp_intern {
+	struct sp_hashmap    *index;
+	struct sp_intern_str *strs;
+	size_t size;
+	size_t capacity;
+	char **blocks;
+	size_t nblocks;
+	size_t block_size;
+	size_t block_left;
+};
+
+struct sp_intern *sp_intern_create(size_t capacity);
+int               sp_intern_clear(struct sp_intern *pool);
+int               sp_intern_destroy(struct sp_intern *pool);
+
+int sp_intern_add(struct sp_intern *pool, const char *str, size_t *id);
+int sp_intern_addn(struct sp_intern *pool, const char *str, size_t len, size_t *id);
+
+int sp_intern_find(const struct sp_intern *pool, const char *str, size_t *id);
+int sp_intern_findn(const struct sp_intern *pool, const char *str, size_t len, size_t *id);
+
+const char *sp_intern_get(const struct sp_intern *pool, size_t id);
+
+int sp_intern_print(const struct sp_intern *pool);
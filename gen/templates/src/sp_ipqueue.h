@@ -0,0 +1,51 @@
+/*H{ STAPLE_IPQUEUE_H */
+/* The indexed priority queue module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pqueue.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_ipqueue {
+	void   *data;
+	size_t *heap;
+	size_t *pos;
+	size_t  elem_size;
+	size_t  size;
+	size_t  count;
+	size_t  capacity;
+	size_t  arity;
+	int     order;
+	int   (*cmp)(const void*, const void*);
+};
+
+struct sp_ipqueue *sp_ipqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*));
+int                sp_ipqueue_clear(struct sp_ipqueue *ipq, int (*dtor)(void*));
+int                sp_ipqueue_destroy(struct sp_ipqueue *ipq, int (*dtor)(void*));
+
+int sp_ipqueue_push(struct sp_ipqueue *ipq, const void *elem, size_t *handle);
+int sp_ipqueue_push$SUFFIX$(struct sp_ipqueue *ipq, $TYPE$ elem, size_t *handle);
+
+void   *sp_ipqueue_peek(const struct sp_ipqueue *ipq);
+$TYPE$  sp_ipqueue_peek$SUFFIX$(const struct sp_ipqueue *ipq);
+size_t  sp_ipqueue_top(const struct sp_ipqueue *ipq);
+
+int     sp_ipqueue_pop(struct sp_ipqueue *ipq, int (*dtor)(void*));
+$TYPE$  sp_ipqueue_pop$SUFFIX$(struct sp_ipqueue *ipq);
+
+int     sp_ipqueue_contains(const struct sp_ipqueue *ipq, size_t handle);
+void   *sp_ipqueue_get(const struct sp_ipqueue *ipq, size_t handle);
+$TYPE$  sp_ipqueue_get$SUFFIX$(const struct sp_ipqueue *ipq, size_t handle);
+
+int sp_ipqueue_update(struct sp_ipqueue *ipq, size_t handle, const void *elem);
+int sp_ipqueue_update$SUFFIX$(struct sp_ipqueue *ipq, size_t handle, $TYPE$ elem);
+
+int     sp_ipqueue_remove(struct sp_ipqueue *ipq, size_t handle, int (*dtor)(void*));
+$TYPE$  sp_ipqueue_remove$SUFFIX$(struct sp_ipqueue *ipq, size_t handle);
+
+int sp_ipqueue_print(const struct sp_ipqueue *ipq, int (*func)(const void*));
+int sp_ipqueue_print$SUFFIX$(const struct sp_ipqueue *ipq);
@@ -0,0 +1,53 @@
+/*H{ STAPLE_LIST_H */
+/* The list module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pool.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_list_node {
+	struct sp_list_node *prev;
+	struct sp_list_node *next;
+};
+
+struct sp_list {
+	struct sp_list_node *head;
+	struct sp_list_node *tail;
+	size_t elem_size;
+	size_t size;
+	size_t data_offset;
+	struct sp_pool pool;
+};
+
+struct sp_list *sp_list_create(size_t elem_size, size_t capacity);
+int             sp_list_clear(struct sp_list *list, int (*dtor)(void*));
+int             sp_list_destroy(struct sp_list *list, int (*dtor)(void*));
+int             sp_list_eq(const struct sp_list *list1, const struct sp_list *list2, int (*cmp)(const void*, const void*));
+int             sp_list_copy(struct sp_list *dest, const struct sp_list *src, int (*cpy)(void*, const void*));
+int             sp_list_map(struct sp_list *list, int (*func)(void*, size_t));
+
+int sp_list_pushfront(struct sp_list *list, const void *elem);
+int sp_list_pushfront$SUFFIX$(struct sp_list *list, $TYPE$ elem);
+
+int sp_list_pushback(struct sp_list *list, const void *elem);
+int sp_list_pushback$SUFFIX$(struct sp_list *list, $TYPE$ elem);
+
+int sp_list_insertafter(struct sp_list *list, struct sp_list_node *node, const void *elem);
+int sp_list_insertbefore(struct sp_list *list, struct sp_list_node *node, const void *elem);
+
+int sp_list_popfront(struct sp_list *list, int (*dtor)(void*));
+int sp_list_popback(struct sp_list *list, int (*dtor)(void*));
+int sp_list_remove(struct sp_list *list, struct sp_list_node *node, int (*dtor)(void*));
+
+void *sp_list_elem(const struct sp_list *list, const struct sp_list_node *node);
+
+int sp_list_splice(struct sp_list *dest, struct sp_list_node *pos, struct sp_list *src);
+int sp_list_move(struct sp_list *list, struct sp_list_node *pos, struct sp_list_node *first, struct sp_list_node *last);
+
+int sp_list_print(const struct sp_list *list, int (*func)(const void*));
+int sp_list_print$SUFFIX$(const struct sp_list *list);
@@ -0,0 +1,55 @@
+/*H{ STAPLE_LRU_H */
+/* The LRU cache module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_hashmap.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_lru_entry {
+	size_t prev;
+	size_t next;
+	size_t weight;
+};
+
+struct sp_lru {
+	struct sp_hashmap   *index;
+	struct sp_lru_entry *entries;
+	void         *keys;
+	void         *vals;
+	size_t        key_size;
+	size_t        val_size;
+	size_t        size;
+	size_t        capacity;
+	size_t        weight;
+	size_t        max_weight;
+	size_t        head;
+	size_t        tail;
+	size_t        free;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+	int (*evict)(void*, void*);
+};
+
+struct sp_lru *sp_lru_create(size_t key_size, size_t val_size, size_t capacity, size_t max_weight, size_t (*hash)(const void*), int (*cmp)(const void*, const void*), int (*evict)(void*, void*));
+int            sp_lru_clear(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*));
+int            sp_lru_destroy(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_lru_insert(struct sp_lru *lru, const void *key, const void *val, size_t weight);
+int sp_lru_insert$SUFFIX$(struct sp_lru *lru, $TYPE$ key, const void *val, size_t weight);
+
+void *sp_lru_get(struct sp_lru *lru, const void *key);
+void *sp_lru_get$SUFFIX$(struct sp_lru *lru, $TYPE$ key);
+
+void *sp_lru_peek(const struct sp_lru *lru, const void *key);
+void *sp_lru_peek$SUFFIX$(const struct sp_lru *lru, $TYPE$ key);
+
+int sp_lru_remove(struct sp_lru *lru, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_lru_remove$SUFFIX$(struct sp_lru *lru, $TYPE$ key, int (*dtor)(void*));
+
+int sp_lru_print(const struct sp_lru *lru, int (*func)(const void*, const void*));
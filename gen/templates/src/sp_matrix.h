@@ -0,0 +1,59 @@
+/*H{ STAPLE_MATRIX_H */
+/* The matrix module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_matrix {
+	void  *data;
+	size_t elem_size;
+	size_t depth;
+	size_t rows;
+	size_t cols;
+	size_t size;
+	size_t align;
+	size_t pstride;
+	size_t rstride;
+	size_t cstride;
+};
+
+struct sp_matrix *sp_matrix_create(size_t elem_size, size_t depth, size_t rows, size_t cols, size_t align);
+int               sp_matrix_destroy(struct sp_matrix *matrix, int (*dtor)(void*));
+int               sp_matrix_eq(const struct sp_matrix *matrix1, const struct sp_matrix *matrix2, int (*cmp)(const void*, const void*));
+int               sp_matrix_copy(struct sp_matrix *dest, const struct sp_matrix *src, int (*cpy)(void*, const void*));
+int               sp_matrix_map(struct sp_matrix *matrix, int (*func)(void*, size_t));
+
+int sp_matrix_slice(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row, size_t col, size_t depth, size_t rows, size_t cols);
+int sp_matrix_row(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row);
+int sp_matrix_col(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t col);
+int sp_matrix_transposed(struct sp_matrix *view, const struct sp_matrix *src);
+int sp_matrix_reshape(struct sp_matrix *view, const struct sp_matrix *src, size_t depth, size_t rows, size_t cols);
+
+void  *sp_matrix_get(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+$TYPE$ sp_matrix_get$SUFFIX$(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+
+int sp_matrix_set(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, const void *val);
+int sp_matrix_set$SUFFIX$(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, $TYPE$ val);
+
+int sp_matrix_fill(struct sp_matrix *matrix, const void *val);
+int sp_matrix_fill$SUFFIX$(struct sp_matrix *matrix, $TYPE$ val);
+
+int sp_matrix_transpose(struct sp_matrix *dest, const struct sp_matrix *src);
+
+int sp_matrix_mul$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+
+int sp_matrix_add$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_sub$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emul$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_scale$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *src, $TYPE$ factor);
+
+int sp_matrix_rowsum$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsum$SUFFIX$(struct sp_matrix *dest, const struct sp_matrix *src);
+
+int sp_matrix_print(const struct sp_matrix *matrix, int (*func)(const void*));
+int sp_matrix_print$SUFFIX$(const struct sp_matrix *matrix);
@@ -0,0 +1,37 @@
+/*H{ STAPLE_POOL_H */
+/* The object pool module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+
+struct sp_pool_slab {
+	char  *data;
+	size_t size;
+};
+
+struct sp_pool {
+	struct sp_pool_slab *slabs;
+	void  *free;
+	void  *tail;
+	size_t block_size;
+	size_t stride;
+	size_t size;
+	size_t capacity;
+	size_t nslabs;
+	size_t used;
+	size_t left;
+	int (*ctor)(void*);
+	int (*dtor)(void*);
+};
+
+struct sp_pool *sp_pool_create(size_t block_size, size_t capacity, int (*ctor)(void*), int (*dtor)(void*));
+int             sp_pool_destroy(struct sp_pool *pool);
+int             sp_pool_reset(struct sp_pool *pool);
+int             sp_pool_reserve(struct sp_pool *pool, size_t n);
+
+void *sp_pool_alloc(struct sp_pool *pool);
+int   sp_pool_free(struct sp_pool *pool, void *block);
+
+int sp_pool_print(const struct sp_pool *pool);
@@ -0,0 +1,49 @@
+/*H{ STAPLE_PQUEUE_H */
+/* The priority queue module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Orders of struct sp_pqueue: which element is popped first */
+#define SP_PQUEUE_MIN 0
+#define SP_PQUEUE_MAX 1
+
+/* Number of children of every element, unless specified otherwise */
+#define SP_PQUEUE_ARITY 4
+
+struct sp_pqueue {
+	void  *data;
+	size_t elem_size;
+	size_t size;
+	size_t capacity;
+	size_t arity;
+	int    order;
+	int  (*cmp)(const void*, const void*);
+};
+
+struct sp_pqueue *sp_pqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*));
+int               sp_pqueue_clear(struct sp_pqueue *pq, int (*dtor)(void*));
+int               sp_pqueue_destroy(struct sp_pqueue *pq, int (*dtor)(void*));
+
+int sp_pqueue_push(struct sp_pqueue *pq, const void *elem);
+int sp_pqueue_push$SUFFIX$(struct sp_pqueue *pq, $TYPE$ elem);
+
+void   *sp_pqueue_peek(const struct sp_pqueue *pq);
+$TYPE$  sp_pqueue_peek$SUFFIX$(const struct sp_pqueue *pq);
+
+int     sp_pqueue_pop(struct sp_pqueue *pq, int (*dtor)(void*));
+$TYPE$  sp_pqueue_pop$SUFFIX$(struct sp_pqueue *pq);
+
+int sp_pqueue_heapify(struct sp_pqueue *pq, const void *arr, size_t n);
+int sp_pqueue_heapify$SUFFIX$(struct sp_pqueue *pq, const $TYPE$ *arr, size_t n);
+
+int sp_pqueue_merge(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_merge$SUFFIX$(struct sp_pqueue *dest, const struct sp_pqueue *src);
+
+int sp_pqueue_print(const struct sp_pqueue *pq, int (*func)(const void*));
+int sp_pqueue_print$SUFFIX$(const struct sp_pqueue *pq);
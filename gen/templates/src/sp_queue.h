@@ -9,6 +9,8 @@
 #include <stdint.h>
 #endif
 
+struct sp_intern;
+
 struct sp_queue {
 	void *data;
 	void *head;
@@ -29,6 +31,18 @@ int sp_queue_push(struct sp_queue *queue, const void *elem);
 int sp_queue_push$SUFFIX$(struct sp_queue *queue, $TYPE$ elem);
 int sp_queue_pushstr(struct sp_queue *queue, const char *elem);
 int sp_queue_pushstrn(struct sp_queue *queue, const char *elem, size_t len);
+int sp_queue_pushistr(struct sp_queue *queue, struct sp_intern *pool, const char *elem);
+
+int sp_queue_pushfront(struct sp_queue *queue, const void *elem);
+int sp_queue_pushfront$SUFFIX$(struct sp_queue *queue, $TYPE$ elem);
+int sp_queue_pushfrontstr(struct sp_queue *queue, const char *elem);
+int sp_queue_pushfrontstrn(struct sp_queue *queue, const char *elem, size_t len);
+
+int sp_queue_rpush(struct sp_queue *queue, const void *elem, int (*dtor)(void*));
+int sp_queue_rpush$SUFFIX$(struct sp_queue *queue, $TYPE$ elem);
+int sp_queue_rpushstr(struct sp_queue *queue, const char *elem);
+int sp_queue_rpushstrn(struct sp_queue *queue, const char *elem, size_t len);
+int sp_queue_rpushn(struct sp_queue *queue, const void *elems, size_t n, int (*dtor)(void*));
 
 int sp_queue_insert(struct sp_queue *queue, size_t idx, const void *elem);
 int sp_queue_insert$SUFFIX$(struct sp_queue *queue, size_t idx, $TYPE$ elem);
@@ -44,10 +58,18 @@ void          *sp_queue_peek(const struct sp_queue *queue);
 $TYPE$         sp_queue_peek$SUFFIX$(const struct sp_queue *queue);
 char          *sp_queue_peekstr(const struct sp_queue *queue);
 
+void          *sp_queue_peekback(const struct sp_queue *queue);
+$TYPE$         sp_queue_peekback$SUFFIX$(const struct sp_queue *queue);
+char          *sp_queue_peekbackstr(const struct sp_queue *queue);
+
 int            sp_queue_pop(struct sp_queue *queue, int (*dtor)(void*));
 $TYPE$         sp_queue_pop$SUFFIX$(struct sp_queue *queue);
 char          *sp_queue_popstr(struct sp_queue *queue);
 
+int            sp_queue_popback(struct sp_queue *queue, int (*dtor)(void*));
+$TYPE$         sp_queue_popback$SUFFIX$(struct sp_queue *queue);
+char          *sp_queue_popbackstr(struct sp_queue *queue);
+
 int            sp_queue_remove(struct sp_queue *queue, size_t idx, int (*dtor)(void*));
 $TYPE$         sp_queue_remove$SUFFIX$(struct sp_queue *queue, size_t idx);
 char          *sp_queue_removestr(struct sp_queue *queue, size_t idx);
@@ -56,6 +78,9 @@ int            sp_queue_qremove(struct sp_queue *queue, size_t idx, int (*dtor)(
 $TYPE$         sp_queue_qremove$SUFFIX$(struct sp_queue *queue, size_t idx);
 char          *sp_queue_qremovestr(struct sp_queue *queue, size_t idx);
 
+int            sp_queue_last(const struct sp_queue *queue, size_t n, void *dest);
+int            sp_queue_rotate(struct sp_queue *queue, size_t n);
+
 void          *sp_queue_get(const struct sp_queue *queue, size_t idx);
 $TYPE$         sp_queue_get$SUFFIX$(const struct sp_queue *queue, size_t idx);
 char          *sp_queue_getstr(const struct sp_queue *queue, size_t idx);
@@ -0,0 +1,36 @@
+/*H{ STAPLE_SEGTREE_H */
+/* The segment tree module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_segtree {
+	void          *data;
+	unsigned char *lazy;
+	size_t         elem_size;
+	size_t         size;
+	size_t         cap;
+	size_t         height;
+};
+
+struct sp_segtree *sp_segtree_create(size_t elem_size, size_t size);
+int                sp_segtree_clear(struct sp_segtree *tree);
+int                sp_segtree_destroy(struct sp_segtree *tree);
+
+int     sp_segtree_build$SUFFIX$(struct sp_segtree *tree, const $TYPE$ *vals);
+$TYPE$  sp_segtree_get$SUFFIX$(const struct sp_segtree *tree, size_t idx);
+int     sp_segtree_set$SUFFIX$(struct sp_segtree *tree, size_t idx, $TYPE$ val);
+
+int     sp_segtree_add$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n, $TYPE$ delta);
+int     sp_segtree_fill$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n, $TYPE$ val);
+
+$TYPE$  sp_segtree_sum$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n);
+$TYPE$  sp_segtree_min$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n);
+$TYPE$  sp_segtree_max$SUFFIX$(struct sp_segtree *tree, size_t idx, size_t n);
+
+int sp_segtree_print$SUFFIX$(const struct sp_segtree *tree);
@@ -0,0 +1,57 @@
+/*H{ STAPLE_SLOTMAP_H */
+/* The slot map module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Largest generation of a slot, and bound on the number of slots, so that
+ * both parts of a handle fit in 32 bits */
+#define SP_SLOTMAP_MAX 0xFFFFFFFFUL
+
+struct sp_slotmap_handle {
+	unsigned long idx;
+	unsigned long gen;
+};
+
+struct sp_slotmap_slot {
+	unsigned long gen;
+	size_t        pos;
+};
+
+struct sp_slotmap {
+	void   *data;
+	size_t *owner;
+	struct sp_slotmap_slot *slots;
+	size_t  elem_size;
+	size_t  size;
+	size_t  count;
+	size_t  capacity;
+	size_t  head;
+	size_t  tail;
+	size_t  nfree;
+};
+
+struct sp_slotmap *sp_slotmap_create(size_t elem_size, size_t capacity);
+int                sp_slotmap_clear(struct sp_slotmap *sm, int (*dtor)(void*));
+int                sp_slotmap_destroy(struct sp_slotmap *sm, int (*dtor)(void*));
+int                sp_slotmap_map(struct sp_slotmap *sm, int (*func)(void*, size_t));
+
+int sp_slotmap_insert(struct sp_slotmap *sm, const void *elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insert$SUFFIX$(struct sp_slotmap *sm, $TYPE$ elem, struct sp_slotmap_handle *handle);
+
+int     sp_slotmap_contains(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+void   *sp_slotmap_get(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+$TYPE$  sp_slotmap_get$SUFFIX$(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+
+int     sp_slotmap_remove(struct sp_slotmap *sm, struct sp_slotmap_handle handle, int (*dtor)(void*));
+$TYPE$  sp_slotmap_remove$SUFFIX$(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+
+struct sp_slotmap_handle sp_slotmap_at(const struct sp_slotmap *sm, size_t idx);
+
+int sp_slotmap_print(const struct sp_slotmap *sm, int (*func)(const void*));
+int sp_slotmap_print$SUFFIX$(const struct sp_slotmap *sm);
@@ -0,0 +1,61 @@
+/*H{ STAPLE_SPARSE_H */
+/* The sparse module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_matrix.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Storage formats of struct sp_sparse */
+#define SP_SPARSE_CSR 0
+#define SP_SPARSE_CSC 1
+
+struct sp_sparse_coo {
+	void   *vals;
+	size_t *row_idx;
+	size_t *col_idx;
+	size_t  elem_size;
+	size_t  rows;
+	size_t  cols;
+	size_t  size;
+	size_t  capacity;
+};
+
+struct sp_sparse {
+	void   *vals;
+	size_t *idx;
+	size_t *ptr;
+	size_t  elem_size;
+	size_t  rows;
+	size_t  cols;
+	size_t  nnz;
+	int     format;
+};
+
+struct sp_sparse_coo *sp_sparse_coo_create(size_t elem_size, size_t rows, size_t cols, size_t capacity);
+int                   sp_sparse_coo_clear(struct sp_sparse_coo *coo);
+int                   sp_sparse_coo_destroy(struct sp_sparse_coo *coo);
+
+int sp_sparse_coo_push(struct sp_sparse_coo *coo, size_t row, size_t col, const void *val);
+int sp_sparse_coo_push$SUFFIX$(struct sp_sparse_coo *coo, size_t row, size_t col, $TYPE$ val);
+
+struct sp_sparse *sp_sparse_csr(const struct sp_sparse_coo *coo);
+struct sp_sparse *sp_sparse_csc(const struct sp_sparse_coo *coo);
+int               sp_sparse_destroy(struct sp_sparse *sparse);
+
+void  *sp_sparse_get(const struct sp_sparse *sparse, size_t row, size_t col);
+$TYPE$ sp_sparse_get$SUFFIX$(const struct sp_sparse *sparse, size_t row, size_t col);
+
+int sp_sparse_split(const struct sp_sparse *sparse, size_t nparts, size_t *bounds);
+
+int sp_sparse_mulv$SUFFIX$($TYPE$ *y, const struct sp_sparse *a, const $TYPE$ *x);
+int sp_sparse_mulvrange$SUFFIX$($TYPE$ *y, const struct sp_sparse *a, const $TYPE$ *x, size_t begin, size_t end);
+int sp_sparse_mul$SUFFIX$(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulrange$SUFFIX$(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+
+int sp_sparse_print(const struct sp_sparse *sparse, int (*func)(const void*));
+int sp_sparse_print$SUFFIX$(const struct sp_sparse *sparse);
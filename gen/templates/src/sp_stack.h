@@ -9,6 +9,8 @@
 #include <stdint.h>
 #endif
 
+struct sp_intern;
+
 struct sp_stack {
 	void  *data;
 	size_t elem_size;
@@ -27,6 +29,7 @@ int sp_stack_push(struct sp_stack *stack, const void *elem);
 int sp_stack_push$SUFFIX$(struct sp_stack *stack, $TYPE$ elem);
 int sp_stack_pushstr(struct sp_stack *stack, const char *elem);
 int sp_stack_pushstrn(struct sp_stack *stack, const char *elem, size_t len);
+int sp_stack_pushistr(struct sp_stack *stack, struct sp_intern *pool, const char *elem);
 
 int sp_stack_insert(struct sp_stack *stack, size_t idx, const void *elem);
 int sp_stack_insert$SUFFIX$(struct sp_stack *stack, size_t idx, $TYPE$ elem);
@@ -0,0 +1,55 @@
+/*H{ STAPLE_ULIST_H */
+/* The ulist module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_ulist_node {
+	struct sp_ulist_node *prev;
+	struct sp_ulist_node *next;
+	size_t count;
+};
+
+struct sp_ulist {
+	struct sp_ulist_node *head;
+	struct sp_ulist_node *tail;
+	size_t elem_size;
+	size_t size;
+	size_t node_cap;
+	size_t nnodes;
+	size_t data_offset;
+	struct sp_ulist_node *spare;
+	struct sp_ulist_node *cursor;
+	size_t cursor_idx;
+};
+
+struct sp_ulist *sp_ulist_create(size_t elem_size, size_t node_cap);
+int              sp_ulist_clear(struct sp_ulist *ulist, int (*dtor)(void*));
+int              sp_ulist_destroy(struct sp_ulist *ulist, int (*dtor)(void*));
+int              sp_ulist_eq(const struct sp_ulist *ulist1, const struct sp_ulist *ulist2, int (*cmp)(const void*, const void*));
+int              sp_ulist_copy(struct sp_ulist *dest, const struct sp_ulist *src, int (*cpy)(void*, const void*));
+int              sp_ulist_map(struct sp_ulist *ulist, int (*func)(void*, size_t));
+
+int sp_ulist_pushfront(struct sp_ulist *ulist, const void *elem);
+int sp_ulist_pushfront$SUFFIX$(struct sp_ulist *ulist, $TYPE$ elem);
+
+int sp_ulist_pushback(struct sp_ulist *ulist, const void *elem);
+int sp_ulist_pushback$SUFFIX$(struct sp_ulist *ulist, $TYPE$ elem);
+
+int sp_ulist_insert(struct sp_ulist *ulist, size_t idx, const void *elem);
+int sp_ulist_insert$SUFFIX$(struct sp_ulist *ulist, size_t idx, $TYPE$ elem);
+
+int sp_ulist_popfront(struct sp_ulist *ulist, int (*dtor)(void*));
+int sp_ulist_popback(struct sp_ulist *ulist, int (*dtor)(void*));
+int sp_ulist_remove(struct sp_ulist *ulist, size_t idx, int (*dtor)(void*));
+
+void  *sp_ulist_get(struct sp_ulist *ulist, size_t idx);
+$TYPE$ sp_ulist_get$SUFFIX$(struct sp_ulist *ulist, size_t idx);
+
+int sp_ulist_print(const struct sp_ulist *ulist, int (*func)(const void*));
+int sp_ulist_print$SUFFIX$(const struct sp_ulist *ulist);
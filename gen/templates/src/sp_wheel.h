@@ -0,0 +1,61 @@
+/*H{ STAPLE_WHEEL_H */
+/* The timer wheel module of the staple library. */
+/*H}*/
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pool.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Every level of a timer wheel resolves SP_WHEEL_BITS bits of a tick, so the
+ * levels together cover delays of up to SP_WHEEL_MAX ticks */
+#define SP_WHEEL_BITS   8
+#define SP_WHEEL_SLOTS  (1 << SP_WHEEL_BITS)
+#define SP_WHEEL_LEVELS 4
+#define SP_WHEEL_MAX    0xFFFFFFFFUL
+
+struct sp_wheel_link {
+	struct sp_wheel_link *prev;
+	struct sp_wheel_link *next;
+};
+
+struct sp_wheel_node {
+	struct sp_wheel_link link;
+	unsigned long expiry;
+	unsigned long gen;
+};
+
+struct sp_wheel_handle {
+	struct sp_wheel_node *node;
+	unsigned long gen;
+};
+
+struct sp_wheel {
+	struct sp_wheel_link slots[SP_WHEEL_LEVELS * SP_WHEEL_SLOTS];
+	struct sp_wheel_link expired;
+	unsigned long        now;
+	size_t               elem_size;
+	size_t               size;
+	size_t               data_offset;
+	struct sp_pool       pool;
+};
+
+struct sp_wheel *sp_wheel_create(size_t elem_size, size_t capacity);
+int              sp_wheel_clear(struct sp_wheel *wheel, int (*dtor)(void*));
+int              sp_wheel_destroy(struct sp_wheel *wheel, int (*dtor)(void*));
+
+int sp_wheel_schedule(struct sp_wheel *wheel, unsigned long delay, const void *elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedule$SUFFIX$(struct sp_wheel *wheel, unsigned long delay, $TYPE$ elem, struct sp_wheel_handle *handle);
+int sp_wheel_reschedule(struct sp_wheel *wheel, struct sp_wheel_handle handle, unsigned long delay);
+
+int sp_wheel_cancel(struct sp_wheel *wheel, struct sp_wheel_handle handle, int (*dtor)(void*));
+
+void         *sp_wheel_get(const struct sp_wheel *wheel, struct sp_wheel_handle handle);
+unsigned long sp_wheel_remaining(const struct sp_wheel *wheel, struct sp_wheel_handle handle);
+
+int sp_wheel_advance(struct sp_wheel *wheel, unsigned long ticks, int (*func)(void*));
+
+int sp_wheel_print(const struct sp_wheel *wheel, int (*func)(const void*));
@@ -0,0 +1,473 @@
+#include "../sp_sparse.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_sparse_coo *sp_sparse_coo_create(size_t elem_size, size_t rows, size_t cols, size_t capacity)
+{
+	struct sp_sparse_coo *ret;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	if (rows == 0 || cols == 0) {
+		error(("matrix dimensions cannot be 0"));
+		return NULL;
+	}
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(elem_size, sizeof(size_t))) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+	ret->vals    = malloc(capacity * elem_size);
+	ret->row_idx = malloc(capacity * sizeof(size_t));
+	ret->col_idx = malloc(capacity * sizeof(size_t));
+	if (ret->vals == NULL || ret->row_idx == NULL || ret->col_idx == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		free(ret->vals);
+		free(ret->row_idx);
+		free(ret->col_idx);
+		free(ret);
+		return NULL;
+	}
+	ret->elem_size = elem_size;
+	ret->rows      = rows;
+	ret->cols      = cols;
+	ret->size      = 0;
+	ret->capacity  = capacity;
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_coo_clear(struct sp_sparse_coo *coo)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR coo SP_EINVAL */
+#endif
+	coo->size = 0;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_coo_destroy(struct sp_sparse_coo *coo)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR coo SP_EINVAL */
+#endif
+	free(coo->vals);
+	free(coo->row_idx);
+	free(coo->col_idx);
+	free(coo);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_sparse_coo_push(struct sp_sparse_coo *coo, size_t row, size_t col, const void *val)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR coo SP_EINVAL */
+	/*. C_ERR_NULLPTR val SP_EINVAL */
+	if (row >= coo->rows || col >= coo->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if ((err = sp_sparse_coo_fit(coo)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)coo->vals + coo->size * coo->elem_size, val, coo->elem_size);
+	coo->row_idx[coo->size] = row;
+	coo->col_idx[coo->size] = col;
+	++coo->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_coo_push$SUFFIX$(struct sp_sparse_coo *coo, size_t row, size_t col, $TYPE$ val)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR coo SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE coo val SP_EILLEGAL */
+	if (row >= coo->rows || col >= coo->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if ((err = sp_sparse_coo_fit(coo)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	(($TYPE$*)coo->vals)[coo->size] = val;
+	coo->row_idx[coo->size] = row;
+	coo->col_idx[coo->size] = col;
+	++coo->size;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+struct sp_sparse *sp_sparse_csr(const struct sp_sparse_coo *coo)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR coo NULL */
+#endif
+	return sp_sparse_compress(coo, SP_SPARSE_CSR);
+}
+/*F}*/
+
+/*F{*/
+struct sp_sparse *sp_sparse_csc(const struct sp_sparse_coo *coo)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR coo NULL */
+#endif
+	return sp_sparse_compress(coo, SP_SPARSE_CSC);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_destroy(struct sp_sparse *sparse)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sparse SP_EINVAL */
+#endif
+	free(sparse->vals);
+	free(sparse->idx);
+	free(sparse->ptr);
+	free(sparse);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_sparse_get(const struct sp_sparse *sparse, size_t row, size_t col)
+{
+	size_t lo, hi, key;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sparse NULL */
+	if (row >= sparse->rows || col >= sparse->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	/* Binary search for the first entry at the position among the entries
+	 * of its row (CSR) or column (CSC), which are sorted */
+	lo  = sparse->ptr[sparse->format == SP_SPARSE_CSR ? row : col];
+	hi  = sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1];
+	key = sparse->format == SP_SPARSE_CSR ? col : row;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (sparse->idx[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1] || sparse->idx[lo] != key)
+		return NULL;
+	return (char*)sparse->vals + lo * sparse->elem_size;
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_sparse_get$SUFFIX$(const struct sp_sparse *sparse, size_t row, size_t col)
+{
+	size_t lo, hi, key;
+	$TYPE$ sum = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sparse 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE sparse $TYPE$ 0 */
+	if (row >= sparse->rows || col >= sparse->cols) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	/* See sp_sparse_get(). Duplicate entries are adjacent, and add up. */
+	lo  = sparse->ptr[sparse->format == SP_SPARSE_CSR ? row : col];
+	hi  = sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1];
+	key = sparse->format == SP_SPARSE_CSR ? col : row;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (sparse->idx[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	hi = sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1];
+	for (; lo < hi && sparse->idx[lo] == key; lo++)
+		sum += (($TYPE$*)sparse->vals)[lo];
+	return sum;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_split(const struct sp_sparse *sparse, size_t nparts, size_t *bounds)
+{
+	size_t nmajor, p;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sparse SP_EINVAL */
+	/*. C_ERR_NULLPTR bounds SP_EINVAL */
+	if (nparts == 0) {
+		error(("nparts cannot be 0"));
+		return SP_EILLEGAL;
+	}
+#endif
+	nmajor = SP_SPARSE_NMAJOR(sparse);
+
+	/* Every bound is the first row (or column) at which the number of
+	 * preceding entries reaches its share of the total */
+	bounds[0] = 0;
+	for (p = 1; p < nparts; p++) {
+		const size_t target = sparse->nnz / nparts * p + sparse->nnz % nparts * p / nparts;
+		size_t lo = bounds[p - 1], hi = nmajor;
+		while (lo < hi) {
+			const size_t mid = lo + (hi - lo) / 2;
+			if (sparse->ptr[mid] < target)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		bounds[p] = lo;
+	}
+	bounds[nparts] = nmajor;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_mulv$SUFFIX$($TYPE$ *y, const struct sp_sparse *a, const $TYPE$ *x)
+{
+	const $TYPE$ *vals;
+	size_t i, j, q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR y SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR x SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+#endif
+	if (a->format == SP_SPARSE_CSR)
+		return sp_sparse_mulvrange$SUFFIX$(y, a, x, 0, a->rows);
+
+	/* Every column of a CSC matrix scatters its entries into y */
+	vals = a->vals;
+	for (i = 0; i < a->rows; i++)
+		y[i] = 0;
+	for (j = 0; j < a->cols; j++) {
+		const $TYPE$ xj = x[j];
+		for (q = a->ptr[j]; q < a->ptr[j + 1]; q++)
+			y[a->idx[q]] += vals[q] * xj;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_mulvrange$SUFFIX$($TYPE$ *y, const struct sp_sparse *a, const $TYPE$ *x, size_t begin, size_t end)
+{
+	const $TYPE$ *vals;
+	size_t i, q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR y SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR x SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	if (begin > end || end > a->rows) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (a->format != SP_SPARSE_CSR) {
+		error(("row ranges require a matrix in the CSR format"));
+		return SP_EILLEGAL;
+	}
+	/* Every row is a dot product which only writes its own element of y, so
+	 * disjoint ranges can be computed by different threads */
+	vals = a->vals;
+	for (i = begin; i < end; i++) {
+		$TYPE$ sum = 0;
+		for (q = a->ptr[i]; q < a->ptr[i + 1]; q++)
+			sum += vals[q] * x[a->idx[q]];
+		y[i] = sum;
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_mul$SUFFIX$(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b)
+{
+	const $TYPE$ *vals;
+	size_t k, i, j, l, q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR b SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE b $TYPE$ SP_EILLEGAL */
+	if (dest == b) {
+		error(("dest must be different from b"));
+		return SP_EILLEGAL;
+	}
+	if (dest->depth != b->depth || b->rows != a->cols || dest->rows != a->rows || dest->cols != b->cols) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (a->format == SP_SPARSE_CSR)
+		return sp_sparse_mulrange$SUFFIX$(dest, a, b, 0, a->rows);
+
+	/* Every entry (i, l) of a CSC matrix adds a multiple of row l of b to
+	 * row i of dest */
+	vals = a->vals;
+	for (k = 0; k < dest->depth; k++) {
+		const size_t bcs = b->cstride, ccs = dest->cstride;
+		for (i = 0; i < dest->rows; i++) {
+			$TYPE$ *const c = ($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0);
+			for (j = 0; j < dest->cols; j++)
+				c[j * ccs] = 0;
+		}
+		for (l = 0; l < a->cols; l++) {
+			const $TYPE$ *const br = ($TYPE$*)SP_MATRIX_ELEM(b, k, l, 0);
+			for (q = a->ptr[l]; q < a->ptr[l + 1]; q++) {
+				const $TYPE$ v = vals[q];
+				$TYPE$ *const c = ($TYPE$*)SP_MATRIX_ELEM(dest, k, a->idx[q], 0);
+				if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(b))
+					for (j = 0; j < dest->cols; j++)
+						c[j] += v * br[j];
+				else
+					for (j = 0; j < dest->cols; j++)
+						c[j * ccs] += v * br[j * bcs];
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_sparse_mulrange$SUFFIX$(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end)
+{
+	const $TYPE$ *vals;
+	size_t k, i, j, q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	/*. C_ERR_NULLPTR a SP_EINVAL */
+	/*. C_ERR_NULLPTR b SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE dest $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE a $TYPE$ SP_EILLEGAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE b $TYPE$ SP_EILLEGAL */
+	if (dest == b) {
+		error(("dest must be different from b"));
+		return SP_EILLEGAL;
+	}
+	if (dest->depth != b->depth || b->rows != a->cols || dest->rows != a->rows || dest->cols != b->cols) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+	if (begin > end || end > a->rows) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if (a->format != SP_SPARSE_CSR) {
+		error(("row ranges require a matrix in the CSR format"));
+		return SP_EILLEGAL;
+	}
+	/* Row i of dest is a combination of the rows of b selected by row i of
+	 * a. The innermost loop runs along rows of b and dest, so that it can be
+	 * vectorized, and every row of dest is only written by its own pass. */
+	vals = a->vals;
+	for (k = 0; k < dest->depth; k++)
+	for (i = begin; i < end; i++) {
+		$TYPE$ *const c = ($TYPE$*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t bcs = b->cstride, ccs = dest->cstride;
+		for (j = 0; j < dest->cols; j++)
+			c[j * ccs] = 0;
+		for (q = a->ptr[i]; q < a->ptr[i + 1]; q++) {
+			const $TYPE$ v = vals[q];
+			const $TYPE$ *const br = ($TYPE$*)SP_MATRIX_ELEM(b, k, a->idx[q], 0);
+			if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(b))
+				for (j = 0; j < dest->cols; j++)
+					c[j] += v * br[j];
+			else
+				for (j = 0; j < dest->cols; j++)
+					c[j * ccs] += v * br[j * bcs];
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_sparse_print(const struct sp_sparse *sparse, int (*func)(const void*))
+{
+	size_t m, q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sparse SP_EINVAL */
+#endif
+	printf("sp_sparse_print()\nrows: "SP_SIZE_FMT", cols: "SP_SIZE_FMT", nnz: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", format: %s\n",
+		(SP_SIZE_T)sparse->rows, (SP_SIZE_T)sparse->cols, (SP_SIZE_T)sparse->nnz, (SP_SIZE_T)sparse->elem_size,
+		sparse->format == SP_SPARSE_CSR ? "CSR" : "CSC");
+	for (m = 0; m < SP_SPARSE_NMAJOR(sparse); m++)
+	for (q = sparse->ptr[m]; q < sparse->ptr[m + 1]; q++) {
+		const void *const elem = (char*)sparse->vals + q * sparse->elem_size;
+		const size_t row = sparse->format == SP_SPARSE_CSR ? m : sparse->idx[q],
+		             col = sparse->format == SP_SPARSE_CSR ? sparse->idx[q] : m;
+		int err;
+		printf("["SP_SIZE_FMT", "SP_SIZE_FMT"]\t", (SP_SIZE_T)row, (SP_SIZE_T)col);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_sparse_print$SUFFIX$(const struct sp_sparse *sparse)
+{
+	size_t m, q;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR sparse SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE sparse $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_sparse_print$SUFFIX$()\nrows: "SP_SIZE_FMT", cols: "SP_SIZE_FMT", nnz: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", format: %s\n",
+		(SP_SIZE_T)sparse->rows, (SP_SIZE_T)sparse->cols, (SP_SIZE_T)sparse->nnz, (SP_SIZE_T)sparse->elem_size,
+		sparse->format == SP_SPARSE_CSR ? "CSR" : "CSC");
+	for (m = 0; m < SP_SPARSE_NMAJOR(sparse); m++)
+	for (q = sparse->ptr[m]; q < sparse->ptr[m + 1]; q++) {
+		const $TYPE$ elem = (($TYPE$*)sparse->vals)[q];
+		const size_t row = sparse->format == SP_SPARSE_CSR ? m : sparse->idx[q],
+		             col = sparse->format == SP_SPARSE_CSR ? sparse->idx[q] : m;
+		printf("["SP_SIZE_FMT", "SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)row, (SP_SIZE_T)col, $FMT_ARGS$);
+	}
+	return 0;
+}
+/*F}*/
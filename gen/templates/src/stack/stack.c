@@ -261,6 +261,30 @@ int sp_stack_pushstrn(struct sp_stack *stack, const char *elem, size_t len)
 }
 /*F}*/
 
+/*F{*/
+#include "../sp_errcodes.h"
+#include "../sp_intern.h"
+int sp_stack_pushistr(struct sp_stack *stack, struct sp_intern *pool, const char *elem)
+{
+	size_t id;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR stack SP_EINVAL */
+	/*. C_ERR_NULLPTR pool SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE stack elem SP_EILLEGAL */
+#endif
+	if (sp_size_try_add(stack->size * stack->elem_size, stack->elem_size))
+		return SP_ERANGE;
+	if (sp_buf_fit(&stack->data, stack->size, &stack->capacity, stack->elem_size))
+		return SP_ENOMEM;
+	if ((err = sp_intern_add(pool, elem, &id)))
+		return err;
+	((const char**)stack->data)[stack->size++] = pool->strs[id].str;
+	return 0;
+}
+/*F}*/
+
 
 /*F{*/
 #include "../sp_errcodes.h"
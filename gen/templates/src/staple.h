@@ -4,3 +4,25 @@
 
 #include "sp_stack.h"
 #include "sp_queue.h"
+#include "sp_deque.h"
+#include "sp_bitarray.h"
+#include "sp_hashmap.h"
+#include "sp_chashmap.h"
+#include "sp_intern.h"
+#include "sp_list.h"
+#include "sp_ulist.h"
+#include "sp_matrix.h"
+#include "sp_sparse.h"
+#include "sp_pqueue.h"
+#include "sp_ipqueue.h"
+#include "sp_avl.h"
+#include "sp_rbtree.h"
+#include "sp_bptree.h"
+#include "sp_art.h"
+#include "sp_bloom.h"
+#include "sp_slotmap.h"
+#include "sp_fenwick.h"
+#include "sp_segtree.h"
+#include "sp_lru.h"
+#include "sp_wheel.h"
+#include "sp_pool.h"
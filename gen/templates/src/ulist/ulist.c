@@ -0,0 +1,448 @@
+#include "../sp_ulist.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_ulist *sp_ulist_create(size_t elem_size, size_t node_cap)
+{
+	struct sp_ulist *ret;
+	size_t align;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	if (node_cap == 0) {
+		error(("node_cap cannot be 0"));
+		return NULL;
+	}
+#endif
+	/* Nodes must hold at least 2 elements to be split in half */
+	node_cap = MAX(node_cap, 2);
+	align = SP_ALIGNOF_SIZE(elem_size);
+	if (elem_size > (SP_SIZE_MAX - sizeof(struct sp_ulist_node) - align) / node_cap) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Each node holds its links and count, followed by an array of up to
+	 * node_cap elements, aligned for any type of their size. */
+	ret->head        = NULL;
+	ret->tail        = NULL;
+	ret->elem_size   = elem_size;
+	ret->size        = 0;
+	ret->node_cap    = node_cap;
+	ret->nnodes      = 0;
+	ret->data_offset = (sizeof(struct sp_ulist_node) + align - 1) / align * align;
+	ret->spare       = NULL;
+	ret->cursor      = NULL;
+	ret->cursor_idx  = 0;
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_clear(struct sp_ulist *ulist, int (*dtor)(void*))
+{
+	struct sp_ulist_node *node, *next;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+#endif
+	if (dtor != NULL) {
+		for (node = ulist->head; node != NULL; node = node->next) {
+			size_t i;
+			for (i = 0; i < node->count; i++) {
+				int err;
+				if ((err = dtor(SP_ULIST_ELEM(ulist, node, i)))) {
+					/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+					return SP_ECALLBK;
+				}
+			}
+		}
+	}
+	for (node = ulist->head; node != NULL; node = next) {
+		next = node->next;
+		if (ulist->spare == NULL)
+			ulist->spare = node;
+		else
+			free(node);
+	}
+	ulist->head   = NULL;
+	ulist->tail   = NULL;
+	ulist->size   = 0;
+	ulist->nnodes = 0;
+	ulist->cursor = NULL;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_destroy(struct sp_ulist *ulist, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+#endif
+	if (sp_ulist_clear(ulist, dtor))
+		return SP_ECALLBK;
+	free(ulist->spare);
+	free(ulist);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include <string.h>
+int sp_ulist_eq(const struct sp_ulist *ulist1, const struct sp_ulist *ulist2, int (*cmp)(const void*, const void*))
+{
+	const struct sp_ulist_node *p, *q;
+	size_t i, j, n;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist1 0 */
+	/*. C_ERR_NULLPTR ulist2 0 */
+#endif
+	if (ulist1->elem_size != ulist2->elem_size || ulist1->size != ulist2->size)
+		return 0;
+	p = ulist1->head;
+	q = ulist2->head;
+	for (i = j = n = 0; n < ulist1->size; n++, i++, j++) {
+		const void *a, *b;
+		if (i == p->count) {
+			p = p->next;
+			i = 0;
+		}
+		if (j == q->count) {
+			q = q->next;
+			j = 0;
+		}
+		a = SP_ULIST_ELEM(ulist1, p, i);
+		b = SP_ULIST_ELEM(ulist2, q, j);
+		if (cmp ? cmp(a, b) : memcmp(a, b, ulist1->elem_size))
+			return 0;
+	}
+	return 1;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_ulist_copy(struct sp_ulist *dest, const struct sp_ulist *src, int (*cpy)(void*, const void*))
+{
+	const struct sp_ulist_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR src SP_EINVAL */
+	/*. C_ERR_NULLPTR dest SP_EINVAL */
+	if (dest->elem_size != src->elem_size) {
+		error(("dest->elem_size does not match src->elem_size"));
+		return SP_EILLEGAL;
+	}
+#endif
+	sp_ulist_clear(dest, NULL);
+	for (node = src->head; node != NULL; node = node->next) {
+		size_t i;
+		for (i = 0; i < node->count; i++) {
+			void *const slot = sp_ulist_slot(dest, dest->size);
+			int err;
+			if (slot == NULL)
+				return SP_ENOMEM;
+			if (cpy == NULL) {
+				memcpy(slot, SP_ULIST_ELEM(src, node, i), src->elem_size);
+			} else if ((err = cpy(slot, SP_ULIST_ELEM(src, node, i)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO cpy err */
+				sp_ulist_erase(dest, dest->tail, dest->tail->count - 1, dest->size - dest->tail->count);
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_map(struct sp_ulist *ulist, int (*func)(void*, size_t))
+{
+	struct sp_ulist_node *node;
+	size_t idx = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_NULLPTR func SP_EINVAL */
+#endif
+	for (node = ulist->head; node != NULL; node = node->next) {
+		size_t i;
+		for (i = 0; i < node->count; i++) {
+			int err;
+			if ((err = func(SP_ULIST_ELEM(ulist, node, i), idx++))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_ulist_pushfront(struct sp_ulist *ulist, const void *elem)
+{
+	void *slot;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((slot = sp_ulist_slot(ulist, 0)) == NULL)
+		return SP_ENOMEM;
+	memcpy(slot, elem, ulist->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_pushfront$SUFFIX$(struct sp_ulist *ulist, $TYPE$ elem)
+{
+	void *slot;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ulist elem SP_EILLEGAL */
+#endif
+	if ((slot = sp_ulist_slot(ulist, 0)) == NULL)
+		return SP_ENOMEM;
+	*($TYPE$*)slot = elem;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_ulist_pushback(struct sp_ulist *ulist, const void *elem)
+{
+	void *slot;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if ((slot = sp_ulist_slot(ulist, ulist->size)) == NULL)
+		return SP_ENOMEM;
+	memcpy(slot, elem, ulist->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_pushback$SUFFIX$(struct sp_ulist *ulist, $TYPE$ elem)
+{
+	void *slot;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ulist elem SP_EILLEGAL */
+#endif
+	if ((slot = sp_ulist_slot(ulist, ulist->size)) == NULL)
+		return SP_ENOMEM;
+	*($TYPE$*)slot = elem;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_ulist_insert(struct sp_ulist *ulist, size_t idx, const void *elem)
+{
+	void *slot;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+	if (idx > ulist->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if ((slot = sp_ulist_slot(ulist, idx)) == NULL)
+		return SP_ENOMEM;
+	memcpy(slot, elem, ulist->elem_size);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_insert$SUFFIX$(struct sp_ulist *ulist, size_t idx, $TYPE$ elem)
+{
+	void *slot;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ulist elem SP_EILLEGAL */
+	if (idx > ulist->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	if ((slot = sp_ulist_slot(ulist, idx)) == NULL)
+		return SP_ENOMEM;
+	*($TYPE$*)slot = elem;
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_popfront(struct sp_ulist *ulist, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	if (ulist->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ulist */
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(SP_ULIST_ELEM(ulist, ulist->head, 0)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_ulist_erase(ulist, ulist->head, 0, 0);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_popback(struct sp_ulist *ulist, int (*dtor)(void*))
+{
+	struct sp_ulist_node *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	if (ulist->size == 0) {
+		/*. C_ERRMSG_IS_EMPTY ulist */
+		return SP_EILLEGAL;
+	}
+#endif
+	node = ulist->tail;
+	if (dtor != NULL && (err = dtor(SP_ULIST_ELEM(ulist, node, node->count - 1)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_ulist_erase(ulist, node, node->count - 1, ulist->size - node->count);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_remove(struct sp_ulist *ulist, size_t idx, int (*dtor)(void*))
+{
+	struct sp_ulist_node *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	if (idx >= ulist->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return SP_EINDEX;
+	}
+#endif
+	node = sp_ulist_seek(ulist, &idx);
+	if (dtor != NULL && (err = dtor(SP_ULIST_ELEM(ulist, node, idx)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	sp_ulist_erase(ulist, node, idx, ulist->cursor_idx);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_ulist_get(struct sp_ulist *ulist, size_t idx)
+{
+	struct sp_ulist_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist NULL */
+	if (idx >= ulist->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return NULL;
+	}
+#endif
+	node = sp_ulist_seek(ulist, &idx);
+	return SP_ULIST_ELEM(ulist, node, idx);
+}
+/*F}*/
+
+/*F{*/
+$TYPE$ sp_ulist_get$SUFFIX$(struct sp_ulist *ulist, size_t idx)
+{
+	struct sp_ulist_node *node;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist 0 */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ulist $TYPE$ 0 */
+	if (idx >= ulist->size) {
+		/*. C_ERRMSG_INDEX_OUT_OF_RANGE */
+		return 0;
+	}
+#endif
+	node = sp_ulist_seek(ulist, &idx);
+	return *($TYPE$*)SP_ULIST_ELEM(ulist, node, idx);
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_print(const struct sp_ulist *ulist, int (*func)(const void*))
+{
+	const struct sp_ulist_node *node;
+	size_t idx = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+#endif
+	printf("sp_ulist_print()\nsize: "SP_SIZE_FMT", nodes: "SP_SIZE_FMT", node_cap: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)ulist->size, (SP_SIZE_T)ulist->nnodes, (SP_SIZE_T)ulist->node_cap, (SP_SIZE_T)ulist->elem_size);
+	for (node = ulist->head; node != NULL; node = node->next) {
+		size_t i;
+		for (i = 0; i < node->count; i++) {
+			const void *const elem = SP_ULIST_ELEM(ulist, node, i);
+			int err;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)idx++);
+			if (func == NULL)
+				printf("%p\n", elem);
+			else if ((err = func(elem))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_ulist_print$SUFFIX$(const struct sp_ulist *ulist)
+{
+	const struct sp_ulist_node *node;
+	size_t idx = 0;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR ulist SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE ulist $TYPE$ SP_EILLEGAL */
+#endif
+	printf("sp_ulist_print$SUFFIX$()\nsize: "SP_SIZE_FMT", nodes: "SP_SIZE_FMT", node_cap: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)ulist->size, (SP_SIZE_T)ulist->nnodes, (SP_SIZE_T)ulist->node_cap, (SP_SIZE_T)ulist->elem_size);
+	for (node = ulist->head; node != NULL; node = node->next) {
+		size_t i;
+		for (i = 0; i < node->count; i++) {
+			const $TYPE$ elem = *(const $TYPE$*)SP_ULIST_ELEM(ulist, node, i);
+			printf("["SP_SIZE_FMT"]\t"$FMT_STR$"\n", (SP_SIZE_T)idx++, $FMT_ARGS$);
+		}
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,300 @@
+#include "../sp_wheel.h"
+#include "../internal.h"
+
+/*F{*/
+struct sp_wheel *sp_wheel_create(size_t elem_size, size_t capacity)
+{
+	struct sp_wheel *ret;
+	size_t align, i;
+
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_ELEM_SIZE_ZERO */
+	/*. C_ERR_CAPACITY_ZERO */
+#endif
+	if (elem_size > SP_SIZE_MAX / 2 - 32) {
+		/*. C_ERRMSG_SIZE_T_OVERFLOW */
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		/*. C_ERRMSG_MALLOC */
+		return NULL;
+	}
+
+	/* Every slot is the sentinel of a circular list, so that a timer can be
+	 * unlinked without knowing which slot it is in */
+	for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++)
+		ret->slots[i].prev = ret->slots[i].next = &ret->slots[i];
+	ret->expired.prev = ret->expired.next = &ret->expired;
+
+	/* Nodes are laid out like those of sp_list, with the element after the
+	 * header, padded to keep it aligned for any type of its size, and are
+	 * blocks of a pool embedded in the wheel */
+	align = MAX(SP_ALIGNOF_SIZE(elem_size), MAX(sizeof(struct sp_wheel_link*), sizeof(unsigned long)));
+	ret->now         = 0;
+	ret->elem_size   = elem_size;
+	ret->size        = 0;
+	ret->data_offset = (sizeof(struct sp_wheel_node) + SP_ALIGNOF_SIZE(elem_size) - 1) / SP_ALIGNOF_SIZE(elem_size) * SP_ALIGNOF_SIZE(elem_size);
+	if (sp_pool_init(&ret->pool, (ret->data_offset + elem_size + align - 1) / align * align, capacity, NULL, NULL)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_wheel_clear(struct sp_wheel *wheel, int (*dtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+#endif
+	if (dtor != NULL) {
+		for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++) {
+			const struct sp_wheel_link *const slot = &wheel->slots[i];
+			struct sp_wheel_link *link;
+			for (link = slot->next; link != slot; link = link->next) {
+				int err;
+				if ((err = dtor(SP_WHEEL_DATA(wheel, link)))) {
+					/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+					return SP_ECALLBK;
+				}
+			}
+		}
+	}
+	for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++) {
+		struct sp_wheel_link *const slot = &wheel->slots[i];
+		while (slot->next != slot) {
+			struct sp_wheel_node *const node = (struct sp_wheel_node*)slot->next;
+			SP_WHEEL_UNLINK(&node->link);
+			sp_wheel_release(wheel, node);
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_wheel_destroy(struct sp_wheel *wheel, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+#endif
+	if (sp_wheel_clear(wheel, dtor))
+		return SP_ECALLBK;
+	sp_pool_fini(&wheel->pool);
+	free(wheel);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <string.h>
+int sp_wheel_schedule(struct sp_wheel *wheel, unsigned long delay, const void *elem, struct sp_wheel_handle *handle)
+{
+	struct sp_wheel_node *node;
+	void *block;
+	int err, fresh;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+	/*. C_ERR_NULLPTR elem SP_EINVAL */
+#endif
+	if (delay > SP_WHEEL_MAX)
+		return SP_ERANGE;
+	/* Nodes carved for the first time start at generation 0, while reused
+	 * ones keep theirs, so that their old handles stay stale */
+	fresh = wheel->pool.free == NULL;
+	if ((err = sp_pool_take(&wheel->pool, &block)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	node = block;
+	if (fresh)
+		node->gen = 0;
+	memcpy(SP_WHEEL_DATA(wheel, node), elem, wheel->elem_size);
+	sp_wheel_arm(wheel, node, delay, handle);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_wheel_schedule$SUFFIX$(struct sp_wheel *wheel, unsigned long delay, $TYPE$ elem, struct sp_wheel_handle *handle)
+{
+	struct sp_wheel_node *node;
+	void *block;
+	int err, fresh;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+	/*. C_ERR_INCOMPAT_ELEM_TYPE wheel elem SP_EILLEGAL */
+#endif
+	if (delay > SP_WHEEL_MAX)
+		return SP_ERANGE;
+	/* Nodes carved for the first time start at generation 0, while reused
+	 * ones keep theirs, so that their old handles stay stale */
+	fresh = wheel->pool.free == NULL;
+	if ((err = sp_pool_take(&wheel->pool, &block)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	node = block;
+	if (fresh)
+		node->gen = 0;
+	*($TYPE$*)SP_WHEEL_DATA(wheel, node) = elem;
+	sp_wheel_arm(wheel, node, delay, handle);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_wheel_reschedule(struct sp_wheel *wheel, struct sp_wheel_handle handle, unsigned long delay)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+#endif
+	if (!SP_WHEEL_PENDING(handle))
+		return SP_ENOKEY;
+	if (delay > SP_WHEEL_MAX)
+		return SP_ERANGE;
+	SP_WHEEL_UNLINK(&handle.node->link);
+	handle.node->expiry = wheel->now + (delay == 0 ? 1 : delay);
+	sp_wheel_place(wheel, handle.node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_wheel_cancel(struct sp_wheel *wheel, struct sp_wheel_handle handle, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+#endif
+	if (!SP_WHEEL_PENDING(handle))
+		return SP_ENOKEY;
+	if (dtor != NULL && (err = dtor(SP_WHEEL_DATA(wheel, handle.node)))) {
+		/*. C_ERRMSG_CALLBACK_NON_ZERO dtor err */
+		return SP_ECALLBK;
+	}
+	SP_WHEEL_UNLINK(&handle.node->link);
+	sp_wheel_release(wheel, handle.node);
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+void *sp_wheel_get(const struct sp_wheel *wheel, struct sp_wheel_handle handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel NULL */
+#endif
+	return SP_WHEEL_PENDING(handle) ? SP_WHEEL_DATA(wheel, handle.node) : NULL;
+}
+/*F}*/
+
+/*F{*/
+unsigned long sp_wheel_remaining(const struct sp_wheel *wheel, struct sp_wheel_handle handle)
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel 0 */
+#endif
+	return SP_WHEEL_PENDING(handle) ? handle.node->expiry - wheel->now : 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+int sp_wheel_advance(struct sp_wheel *wheel, unsigned long ticks, int (*func)(void*))
+{
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+#endif
+	for (; ticks != 0; --ticks) {
+		const unsigned long tick = wheel->now + 1;
+		struct sp_wheel_link *const slot = &wheel->slots[tick & (SP_WHEEL_SLOTS - 1)];
+		struct sp_wheel_link *const batch = &wheel->expired;
+		int level;
+
+		/* With no timers, every slot is empty and there is nothing to
+		 * cascade, so time can jump ahead */
+		if (wheel->size == 0) {
+			wheel->now += ticks;
+			break;
+		}
+
+		/* A level above the first comes down whenever all the levels below
+		 * it wrap around, lowest first */
+		for (level = 1; level < SP_WHEEL_LEVELS && (tick & ((1UL << (level * SP_WHEEL_BITS)) - 1)) == 0; level++)
+			sp_wheel_cascade(wheel, level);
+		wheel->now = tick;
+		if (slot->next == slot)
+			continue;
+
+		/* The whole slot is moved out at once, so that func can cancel and
+		 * reschedule timers, including those of the same batch */
+		batch->next = slot->next;
+		batch->prev = slot->prev;
+		batch->next->prev = batch;
+		batch->prev->next = batch;
+		slot->next = slot->prev = slot;
+		while (batch->next != batch) {
+			struct sp_wheel_node *const node = (struct sp_wheel_node*)batch->next;
+			int err;
+			/* The timer stops being pending before func is invoked, but its
+			 * node is only recycled afterwards, so the element stays put.
+			 * Like in sp_wheel_release, a wrapped generation retires it. */
+			SP_WHEEL_UNLINK(&node->link);
+			++node->gen;
+			--wheel->size;
+			err = func != NULL ? func(SP_WHEEL_DATA(wheel, node)) : 0;
+			if (node->gen != 0)
+				sp_pool_give(&wheel->pool, node);
+			if (err) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				while (batch->next != batch) {
+					struct sp_wheel_node *const rest = (struct sp_wheel_node*)batch->next;
+					SP_WHEEL_UNLINK(&rest->link);
+					rest->expiry = tick + 1;
+					sp_wheel_place(wheel, rest);
+				}
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
+
+/*F{*/
+#include "../sp_errcodes.h"
+#include <stdio.h>
+int sp_wheel_print(const struct sp_wheel *wheel, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	/*. C_ERR_NULLPTR wheel SP_EINVAL */
+#endif
+	printf("sp_wheel_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", now: %lu\n",
+		(SP_SIZE_T)wheel->size, (SP_SIZE_T)wheel->pool.capacity, wheel->now);
+	for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++) {
+		const struct sp_wheel_link *const slot = &wheel->slots[i];
+		const struct sp_wheel_link *link;
+		for (link = slot->next; link != slot; link = link->next) {
+			const struct sp_wheel_node *const node = (const struct sp_wheel_node*)link;
+			int err;
+			printf("[%d][%d]\t%lu\t", (int)(i / SP_WHEEL_SLOTS), (int)(i % SP_WHEEL_SLOTS), node->expiry - wheel->now);
+			if (func == NULL)
+				printf("%p\n", (const void*)SP_WHEEL_DATA(wheel, node));
+			else if ((err = func(SP_WHEEL_DATA(wheel, node)))) {
+				/*. C_ERRMSG_CALLBACK_NON_ZERO func err */
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
+/*F}*/
@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+
+struct sp_art *sp_art_create(size_t val_size)
+{
+	struct sp_art *ret;
+	size_t va;
+
+	if (val_size > SP_SIZE_MAX / 2) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* Leaves hold their header, followed by the value, which is aligned for
+	 * any type of its size, and by the bytes of the key */
+	va = val_size != 0 ? SP_ALIGNOF_SIZE(val_size) : 1;
+	ret->val_offset = (sizeof(struct sp_art_leaf) + va - 1) / va * va;
+	ret->val_size   = val_size;
+	ret->root       = NULL;
+	ret->size       = 0;
+	return ret;
+}
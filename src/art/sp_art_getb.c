@@ -0,0 +1,35 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_art.h"
+#include "../internal.h"
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+void *sp_art_getb(const struct sp_art *art, _Bool key)
+{
+	unsigned char buf[sizeof(key) + 1];
+	size_t len;
+	SP_KEY_ENCODE(_Bool, key, buf, len);
+	return sp_art_get(art, buf, len);
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
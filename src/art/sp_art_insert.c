@@ -0,0 +1,148 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_art_insert(struct sp_art *art, const void *key, size_t len, const void *val)
+{
+	const unsigned char *const k = key;
+	struct sp_art_leaf *leaf;
+	void **ref, **child;
+	size_t depth = 0, p;
+#ifdef STAPLE_DEBUG
+	if (art == NULL) {
+		error(("art is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL && art->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (len > SP_SIZE_MAX - art->val_offset - art->val_size) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return SP_ERANGE;
+	}
+
+	for (ref = &art->root;;) {
+		struct sp_art_node *const node = *ref, *split;
+
+		if (node == NULL) {
+			if ((*ref = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			break;
+		}
+
+		if (node->type == SP_ART_LEAF) {
+			struct sp_art_leaf *const old = *ref;
+			const unsigned char *const ok = SP_ART_KEY(art, old);
+			const size_t max = MIN(old->len, len);
+			if (old->len == len && memcmp(ok + depth, k + depth, len - depth) == 0) {
+				if (art->val_size != 0)
+					memcpy(SP_ART_VAL(art, old), val, art->val_size);
+				return 0;
+			}
+			/* Both keys go below a new node, whose path is the rest of
+			 * their common prefix, and a key ending there is its terminal
+			 * leaf */
+			for (p = depth; p < max && ok[p] == k[p]; p++)
+				;
+			if ((leaf = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			if ((split = sp_art_newnode(SP_ART_NODE4)) == NULL) {
+				free(leaf);
+				return SP_ENOMEM;
+			}
+			split->prefix_len = p - depth;
+			memcpy(split->prefix, k + depth, MIN(p - depth, SP_ART_PREFIX));
+			*ref = split;
+			if (old->len == p)
+				split->term = old;
+			else
+				sp_art_addchild(ref, ok[p], old);
+			if (len == p)
+				split->term = leaf;
+			else
+				sp_art_addchild(ref, k[p], leaf);
+			break;
+		}
+
+		p = sp_art_mismatch(art, node, k, len, depth);
+		if (p < node->prefix_len) {
+			/* The key leaves the path of the node, which is split where
+			 * they differ, the rest of it going below a new node */
+			unsigned char c;
+			if ((leaf = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			if ((split = sp_art_newnode(SP_ART_NODE4)) == NULL) {
+				free(leaf);
+				return SP_ENOMEM;
+			}
+			split->prefix_len = p;
+			memcpy(split->prefix, node->prefix, MIN(p, SP_ART_PREFIX));
+			if (node->prefix_len <= SP_ART_PREFIX) {
+				c = node->prefix[p];
+				node->prefix_len -= p + 1;
+				memmove(node->prefix, node->prefix + p + 1, node->prefix_len);
+			} else {
+				const unsigned char *const mk = SP_ART_KEY(art, sp_art_minleaf(node));
+				c = mk[depth + p];
+				node->prefix_len -= p + 1;
+				memcpy(node->prefix, mk + depth + p + 1, MIN(node->prefix_len, SP_ART_PREFIX));
+			}
+			*ref = split;
+			sp_art_addchild(ref, c, node);
+			if (len == depth + p)
+				split->term = leaf;
+			else
+				sp_art_addchild(ref, k[depth + p], leaf);
+			break;
+		}
+
+		depth += node->prefix_len;
+		if (depth == len) {
+			if (node->term != NULL) {
+				if (art->val_size != 0)
+					memcpy(SP_ART_VAL(art, node->term), val, art->val_size);
+				return 0;
+			}
+			if ((node->term = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			break;
+		}
+		if ((child = sp_art_child(node, k[depth])) == NULL) {
+			if ((leaf = sp_art_newleaf(art, key, len, val)) == NULL)
+				return SP_ENOMEM;
+			if (sp_art_addchild(ref, k[depth], leaf)) {
+				free(leaf);
+				return SP_ENOMEM;
+			}
+			break;
+		}
+		ref = child;
+		++depth;
+	}
+	++art->size;
+	return 0;
+}
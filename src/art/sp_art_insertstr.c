@@ -0,0 +1,32 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_art_insertstr(struct sp_art *art, const char *key, const void *val)
+{
+#ifdef STAPLE_DEBUG
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	return sp_art_insert(art, key, strlen(key), val);
+}
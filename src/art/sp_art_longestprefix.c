@@ -0,0 +1,71 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+#include <string.h>
+
+void *sp_art_longestprefix(const struct sp_art *art, const void *key, size_t len, size_t *match)
+{
+	const unsigned char *const k = key;
+	const struct sp_art_leaf *best = NULL;
+	const void *node;
+	size_t depth = 0;
+	int verified = 1;
+#ifdef STAPLE_DEBUG
+	if (art == NULL) {
+		error(("art is NULL"));
+		return NULL;
+	}
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return NULL;
+	}
+#endif
+	/* The path down is known to match the key as long as all of its bytes
+	 * were stored in the nodes passed, and is otherwise verified with the
+	 * first terminal leaf found */
+	for (node = art->root; node != NULL; ) {
+		const struct sp_art_node *const n = node;
+		void **child;
+		if (SP_ART_TYPE(node) == SP_ART_LEAF) {
+			const struct sp_art_leaf *const leaf = node;
+			if (leaf->len <= len && (leaf->len == 0 || memcmp(SP_ART_KEY(art, leaf), k, leaf->len) == 0))
+				best = leaf;
+			break;
+		}
+		if (n->prefix_len != 0 && (n->prefix_len > len - depth
+				|| memcmp(n->prefix, k + depth, MIN(n->prefix_len, SP_ART_PREFIX)) != 0))
+			break;
+		if (n->prefix_len > SP_ART_PREFIX)
+			verified = 0;
+		depth += n->prefix_len;
+		if (n->term != NULL) {
+			if (!verified && memcmp(SP_ART_KEY(art, n->term), k, depth) != 0)
+				break;
+			best     = n->term;
+			verified = 1;
+		}
+		if (depth == len || (child = sp_art_child(n, k[depth])) == NULL)
+			break;
+		node = *child;
+		++depth;
+	}
+	if (match != NULL)
+		*match = best != NULL ? best->len : 0;
+	return best != NULL ? SP_ART_VAL(art, best) : NULL;
+}
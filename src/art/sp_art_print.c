@@ -0,0 +1,40 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_art_print(const struct sp_art *art, int (*func)(const void*, size_t, void*))
+{
+	size_t idx = 0;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (art == NULL) {
+		error(("art is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_art_print()\nsize: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)art->size, (SP_SIZE_T)art->val_size);
+	if (art->root != NULL && (err = sp_art_walk(art, art->root, func, &idx))) {
+		error(("callback function func returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	return 0;
+}
@@ -0,0 +1,83 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_art_remove(struct sp_art *art, const void *key, size_t len, int (*dtor)(void*))
+{
+	const unsigned char *const k = key;
+	struct sp_art_leaf *leaf;
+	void **ref, **parent = NULL;
+	size_t depth = 0;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (art == NULL) {
+		error(("art is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL && len != 0) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (ref = &art->root;;) {
+		struct sp_art_node *const n = *ref;
+		void **child;
+		if (n == NULL)
+			return SP_ENOKEY;
+		if (n->type == SP_ART_LEAF) {
+			leaf = *ref;
+			break;
+		}
+		if (n->prefix_len != 0 && (n->prefix_len > len - depth
+				|| memcmp(n->prefix, k + depth, MIN(n->prefix_len, SP_ART_PREFIX)) != 0))
+			return SP_ENOKEY;
+		depth += n->prefix_len;
+		if (depth == len) {
+			leaf = n->term;
+			break;
+		}
+		if ((child = sp_art_child(n, k[depth])) == NULL)
+			return SP_ENOKEY;
+		parent = ref;
+		ref    = child;
+		++depth;
+	}
+	if (leaf == NULL || leaf->len != len || (len != 0 && memcmp(SP_ART_KEY(art, leaf), k, len) != 0))
+		return SP_ENOKEY;
+	if (dtor != NULL && (err = dtor(SP_ART_VAL(art, leaf)))) {
+		error(("callback function dtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+
+	/* A terminal leaf is detached from the node reached, and any other leaf
+	 * from the node above it */
+	if (leaf != *ref) {
+		((struct sp_art_node*)*ref)->term = NULL;
+		sp_art_shrink(ref);
+	} else if (parent != NULL) {
+		sp_art_delchild(parent, k[depth - 1]);
+	} else {
+		*ref = NULL;
+	}
+	free(leaf);
+	--art->size;
+	return 0;
+}
@@ -0,0 +1,71 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_art.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_art_scan(const struct sp_art *art, const void *prefix, size_t len, int (*func)(const void*, size_t, void*))
+{
+	const unsigned char *const k = prefix;
+	const struct sp_art_leaf *leaf;
+	const void *node;
+	size_t depth = 0;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (art == NULL) {
+		error(("art is NULL"));
+		return SP_EINVAL;
+	}
+	if (func == NULL) {
+		error(("func is NULL"));
+		return SP_EINVAL;
+	}
+	if (prefix == NULL && len != 0) {
+		error(("prefix is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	node = art->root;
+	/* The walk goes down until the prefix ends, within or at the end of the
+	 * path of a node, all of whose keys then share the same first len bytes,
+	 * so that the prefix only needs to be verified against one of them */
+	while (node != NULL && depth < len && SP_ART_TYPE(node) != SP_ART_LEAF) {
+		const struct sp_art_node *const n = node;
+		void **child;
+		if (memcmp(n->prefix, k + depth, MIN(MIN(n->prefix_len, len - depth), SP_ART_PREFIX)) != 0)
+			return 0;
+		if (n->prefix_len >= len - depth)
+			break;
+		depth += n->prefix_len;
+		if ((child = sp_art_child(n, k[depth])) == NULL)
+			return 0;
+		node = *child;
+		++depth;
+	}
+	if (node == NULL)
+		return 0;
+	leaf = sp_art_minleaf(node);
+	if (leaf->len < len || (len != 0 && memcmp(SP_ART_KEY(art, leaf), k, len) != 0))
+		return 0;
+	if ((err = sp_art_walk(art, node, func, NULL))) {
+		error(("callback function func returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	return 0;
+}
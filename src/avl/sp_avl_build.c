@@ -0,0 +1,60 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_avl_build(struct sp_avl *avl, const void *keys, const void *vals, size_t n)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	size_t i;
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return SP_EINVAL;
+	}
+	if (keys == NULL) {
+		error(("keys is NULL"));
+		return SP_EINVAL;
+	}
+	if (vals == NULL && avl->val_size != 0) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+	if (avl->size != 0) {
+		error(("avl is not empty"));
+		return SP_EILLEGAL;
+	}
+	for (i = 1; i < n; i++) {
+		if (avl->cmp((char*)keys + (i - 1) * avl->key_size, (char*)keys + i * avl->key_size) >= 0) {
+			error(("keys are not sorted in strictly increasing order"));
+			return SP_EILLEGAL;
+		}
+	}
+#endif
+	/* All nodes are set aside up front, so that building cannot fail */
+	if ((err = sp_pool_reserve(&avl->pool, n)))
+		return err;
+	avl->root = sp_avl_build_range(avl, keys, avl->val_size != 0 ? vals : NULL, n, NULL);
+	avl->size = n;
+	return 0;
+}
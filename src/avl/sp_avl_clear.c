@@ -0,0 +1,51 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_avl_clear(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (kdtor != NULL || vdtor != NULL) {
+		for (node = sp_avl_first(avl); node != NULL; node = sp_avl_next(node)) {
+			int err;
+			if (kdtor != NULL && (err = kdtor(SP_AVL_KEY(avl, node)))) {
+				error(("callback function kdtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+			if (vdtor != NULL && (err = vdtor(SP_AVL_VAL(avl, node)))) {
+				error(("callback function vdtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	}
+
+	/* Every node is free again, so the pool can carve them from the start,
+	 * without visiting the tree */
+	sp_pool_reset(&avl->pool);
+	avl->root = NULL;
+	avl->size = 0;
+	return 0;
+}
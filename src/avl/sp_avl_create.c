@@ -0,0 +1,70 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+
+struct sp_avl *sp_avl_create(size_t key_size, size_t val_size, size_t capacity, int (*cmp)(const void*, const void*))
+{
+	struct sp_avl *ret;
+	size_t align;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (key_size > SP_SIZE_MAX / 2 - 64 || val_size > SP_SIZE_MAX / 2 - 64) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* Each node holds its links, followed by the key and the value, which are
+	 * padded to keep them aligned for any type of their size. Sets have no
+	 * value at all. Nodes are blocks of a pool embedded in the tree. Their
+	 * size is rounded up here, as a pool derives the alignment of its blocks
+	 * from their size alone, which misses a key more aligned than the value. */
+	align = MAX(SP_ALIGNOF_SIZE(key_size), sizeof(struct sp_avl_node*));
+	ret->root       = NULL;
+	ret->key_size   = key_size;
+	ret->val_size   = val_size;
+	ret->key_offset = (sizeof(struct sp_avl_node) + SP_ALIGNOF_SIZE(key_size) - 1) / SP_ALIGNOF_SIZE(key_size) * SP_ALIGNOF_SIZE(key_size);
+	ret->val_offset = ret->key_offset + key_size;
+	if (val_size != 0) {
+		ret->val_offset = (ret->val_offset + SP_ALIGNOF_SIZE(val_size) - 1) / SP_ALIGNOF_SIZE(val_size) * SP_ALIGNOF_SIZE(val_size);
+		align = MAX(align, SP_ALIGNOF_SIZE(val_size));
+	}
+	ret->size       = 0;
+	ret->cmp        = cmp;
+	if (sp_pool_init(&ret->pool, (ret->val_offset + val_size + align - 1) / align * align, capacity, NULL, NULL)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+
+struct sp_avl_node *sp_avl_find(const struct sp_avl *avl, const void *key)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return NULL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return NULL;
+	}
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return NULL;
+	}
+#endif
+	node = avl->root;
+	while (node != NULL) {
+		const int c = avl->cmp(key, SP_AVL_KEY(avl, node));
+		if (c == 0)
+			break;
+		node = c < 0 ? node->left : node->right;
+	}
+	return node;
+}
@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+
+struct sp_avl_node *sp_avl_findd(const struct sp_avl *avl, double key)
+{
+	struct sp_avl_node *node;
+#ifdef STAPLE_DEBUG
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return NULL;
+	}
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return NULL;
+	}
+#endif
+	node = avl->root;
+	while (node != NULL) {
+		const double k = *(double*)SP_AVL_KEY(avl, node);
+		if (key < k)
+			node = node->left;
+		else if (k < key)
+			node = node->right;
+		else
+			break;
+	}
+	return node;
+}
@@ -0,0 +1,64 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_avl_insertc(struct sp_avl *avl, char key, const void *val)
+{
+	struct sp_avl_node *parent = NULL, **link;
+	void *node;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL && avl->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->key_size != sizeof(key)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	link = &avl->root;
+	while (*link != NULL) {
+		const char k = *(char*)SP_AVL_KEY(avl, *link);
+		parent = *link;
+		if (key < k)
+			link = &parent->left;
+		else if (k < key)
+			link = &parent->right;
+		else {
+			if (avl->val_size != 0)
+				memcpy(SP_AVL_VAL(avl, parent), val, avl->val_size);
+			return 0;
+		}
+	}
+	if ((err = sp_pool_take(&avl->pool, &node)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	*(char*)SP_AVL_KEY(avl, node) = key;
+	if (avl->val_size != 0)
+		memcpy(SP_AVL_VAL(avl, node), val, avl->val_size);
+	sp_avl_link(avl, parent, link, node);
+	return 0;
+}
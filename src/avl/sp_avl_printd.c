@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_avl_printd(const struct sp_avl *avl)
+{
+	const struct sp_avl_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return SP_EINVAL;
+	}
+	if (avl->key_size != sizeof(double)) {
+		error(("avl->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)avl->key_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_avl_printd()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT", height: %d\n",
+		(SP_SIZE_T)avl->size, (SP_SIZE_T)avl->pool.capacity, (SP_SIZE_T)avl->key_size, (SP_SIZE_T)avl->val_size,
+		SP_AVL_HEIGHT(avl->root));
+	for (node = sp_avl_first(avl); node != NULL; node = sp_avl_next(node), i++) {
+		const double elem = *(double*)SP_AVL_KEY(avl, node);
+		printf("["SP_SIZE_FMT"]\t""%g""\n", (SP_SIZE_T)i, elem);
+	}
+	return 0;
+}
@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_avl.h"
+#include "../internal.h"
+
+size_t sp_avl_rank(const struct sp_avl *avl, const void *key)
+{
+	const struct sp_avl_node *node;
+	size_t ret = 0;
+#ifdef STAPLE_DEBUG
+	if (avl == NULL) {
+		error(("avl is NULL"));
+		return 0;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return 0;
+	}
+	if (avl->cmp == NULL) {
+		error(("avl->cmp is NULL"));
+		return 0;
+	}
+#endif
+	/* Every time the search goes right, the node and its left subtree are
+	 * known to hold smaller keys */
+	for (node = avl->root; node != NULL;) {
+		if (avl->cmp(SP_AVL_KEY(avl, node), key) < 0) {
+			ret += SP_AVL_SIZE(node->left) + 1;
+			node = node->right;
+		} else {
+			node = node->left;
+		}
+	}
+	return ret;
+}
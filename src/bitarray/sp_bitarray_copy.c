@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_bitarray_copy(struct sp_bitarray *dest, const struct sp_bitarray *src)
+{
+	size_t words;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if ((err = sp_bitbuf_fit(&dest->data, &dest->capacity, src->size)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	words = SP_WORDS(src->size);
+	memcpy(dest->data, src->data, words * sizeof(*dest->data));
+	if (dest->size > src->size)
+		memset(dest->data + words, 0, (SP_WORDS(dest->size) - words) * sizeof(*dest->data));
+	dest->size = src->size;
+	return 0;
+}
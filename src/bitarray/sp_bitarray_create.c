@@ -0,0 +1,52 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+
+struct sp_bitarray *sp_bitarray_create(size_t capacity)
+{
+	struct sp_bitarray *ret;
+
+#ifdef STAPLE_DEBUG
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / SP_WORD_BIT * SP_WORD_BIT) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	ret->size     = 0;
+	ret->capacity = SP_WORDS(capacity) * SP_WORD_BIT;
+	ret->data     = calloc(SP_WORDS(capacity), sizeof(*ret->data));
+	if (ret->data == NULL) {
+		error(("malloc"));
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
@@ -0,0 +1,37 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+#include <string.h>
+
+int sp_bitarray_eq(const struct sp_bitarray *bitarray1, const struct sp_bitarray *bitarray2)
+{
+#ifdef STAPLE_DEBUG
+	if (bitarray1 == NULL) {
+		error(("bitarray1 is NULL"));
+		return 0;
+	}
+	if (bitarray2 == NULL) {
+		error(("bitarray2 is NULL"));
+		return 0;
+	}
+#endif
+	/* Bits past size are always 0, so whole words can be compared */
+	return bitarray1->size == bitarray2->size
+		&& !memcmp(bitarray1->data, bitarray2->data, SP_WORDS(bitarray1->size) * sizeof(*bitarray1->data));
+}
@@ -0,0 +1,57 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_bitarray_fill(struct sp_bitarray *bitarray, size_t idx, size_t n, int bit)
+{
+	size_t first, last;
+	unsigned long head, tail;
+#ifdef STAPLE_DEBUG
+	if (bitarray == NULL) {
+		error(("bitarray is NULL"));
+		return SP_EINVAL;
+	}
+	if (idx > bitarray->size || n > bitarray->size - idx) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	if (n == 0)
+		return 0;
+	first = idx / SP_WORD_BIT;
+	last  = (idx + n - 1) / SP_WORD_BIT;
+	head  = ~0UL << idx % SP_WORD_BIT;
+	tail  = ~0UL >> (SP_WORD_BIT - 1 - (idx + n - 1) % SP_WORD_BIT);
+	if (first == last)
+		head = tail = head & tail;
+	/* Partial words on both ends are masked, everything in between is
+	 * filled with a single memset */
+	if (bit) {
+		bitarray->data[first] |= head;
+		bitarray->data[last]  |= tail;
+	} else {
+		bitarray->data[first] &= ~head;
+		bitarray->data[last]  &= ~tail;
+	}
+	if (last - first > 1)
+		memset(bitarray->data + first + 1, bit ? 0xff : 0, (last - first - 1) * sizeof(*bitarray->data));
+	return 0;
+}
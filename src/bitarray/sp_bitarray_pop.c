@@ -0,0 +1,41 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+
+int sp_bitarray_pop(struct sp_bitarray *bitarray)
+{
+	unsigned long *word, mask;
+	int ret;
+#ifdef STAPLE_DEBUG
+	if (bitarray == NULL) {
+		error(("bitarray is NULL"));
+		return 0;
+	}
+	if (bitarray->size == 0) {
+		error(("bitarray is empty"));
+		return 0;
+	}
+#endif
+	--bitarray->size;
+	word  = bitarray->data + bitarray->size / SP_WORD_BIT;
+	mask  = 1UL << bitarray->size % SP_WORD_BIT;
+	ret   = (*word & mask) != 0;
+	*word &= ~mask;
+	return ret;
+}
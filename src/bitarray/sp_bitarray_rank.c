@@ -0,0 +1,39 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+
+size_t sp_bitarray_rank(const struct sp_bitarray *bitarray, size_t idx)
+{
+	size_t i, ret = 0;
+#ifdef STAPLE_DEBUG
+	if (bitarray == NULL) {
+		error(("bitarray is NULL"));
+		return 0;
+	}
+	if (idx > bitarray->size) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	for (i = 0; i < idx / SP_WORD_BIT; i++)
+		ret += SP_POPCOUNT(bitarray->data[i]);
+	if (idx % SP_WORD_BIT != 0)
+		ret += SP_POPCOUNT(bitarray->data[i] & ~(~0UL << idx % SP_WORD_BIT));
+	return ret;
+}
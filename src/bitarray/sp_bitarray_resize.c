@@ -0,0 +1,43 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_bitarray_resize(struct sp_bitarray *bitarray, size_t size)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	if (bitarray == NULL) {
+		error(("bitarray is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (size < bitarray->size) {
+		/* Keep the bits past size zeroed */
+		const size_t words = SP_WORDS(size);
+		if (size % SP_WORD_BIT != 0)
+			bitarray->data[words - 1] &= ~(~0UL << size % SP_WORD_BIT);
+		memset(bitarray->data + words, 0, (SP_WORDS(bitarray->size) - words) * sizeof(*bitarray->data));
+	} else if ((err = sp_bitbuf_fit(&bitarray->data, &bitarray->capacity, size))) {
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	}
+	bitarray->size = size;
+	return 0;
+}
@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bitarray.h"
+#include "../internal.h"
+
+size_t sp_bitarray_select(const struct sp_bitarray *bitarray, size_t n)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (bitarray == NULL) {
+		error(("bitarray is NULL"));
+		return 0;
+	}
+#endif
+	for (i = 0; i < SP_WORDS(bitarray->size); i++) {
+		unsigned long word = bitarray->data[i];
+		const size_t count = SP_POPCOUNT(word);
+		if (n < count) {
+			/* Drop the n lowest set bits of the word */
+			while (n != 0) {
+				word &= word - 1;
+				--n;
+			}
+			return i * SP_WORD_BIT + SP_CTZ(word);
+		}
+		n -= count;
+	}
+	return bitarray->size;
+}
@@ -0,0 +1,34 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+
+int sp_bloom_contains(const struct sp_bloom *bloom, const void *data, size_t len)
+{
+#ifdef STAPLE_DEBUG
+	if (bloom == NULL) {
+		error(("bloom is NULL"));
+		return 0;
+	}
+	if (data == NULL && len != 0) {
+		error(("data is NULL"));
+		return 0;
+	}
+#endif
+	return sp_bloom_probe(bloom, data, len, 0);
+}
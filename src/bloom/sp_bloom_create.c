@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+
+struct sp_bloom *sp_bloom_create(size_t capacity, double fpr, int blocked)
+{
+	const double ln2 = 0.69314718055994530942;
+	const size_t align = blocked ? SP_BLOOM_BLOCK : 64;
+	double bits;
+	size_t nhashes;
+
+#ifdef STAPLE_DEBUG
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (!(fpr > 0 && fpr < 1)) {
+		error(("fpr must lie between 0 and 1"));
+		return NULL;
+	}
+
+	/* The filter of capacity elements with the lowest false positive rate
+	 * for its size has -capacity * ln fpr / ln^2 2 bits, rounded up to a
+	 * multiple of 64, or of a block, and -ln fpr / ln 2 hashes */
+	bits = -(double)MAX(capacity, 1) * sp_log(fpr) / (ln2 * ln2);
+	if (bits > (double)(SP_SIZE_MAX - 2 * SP_BLOOM_BLOCK)) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+	nhashes = (size_t)(-sp_log(fpr) / ln2 + 0.5);
+	return sp_bloom_alloc(((size_t)bits / align + 1) * align, MAX(nhashes, 1), blocked);
+}
@@ -0,0 +1,66 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+#include <string.h>
+
+struct sp_bloom *sp_bloom_deserialize(const void *buf, size_t size)
+{
+	const unsigned char *const in = buf;
+	struct sp_bloom *ret;
+	unsigned long *words;
+	size_t i, nhashes = 0, nbits = 0, count = 0;
+#ifdef STAPLE_DEBUG
+	if (buf == NULL) {
+		error(("buf is NULL"));
+		return NULL;
+	}
+#endif
+	if (size < SP_BLOOM_HEADER || memcmp(in, "SPBF", 4) != 0 || in[4] != 1 || in[5] > 1) {
+		error(("buf does not hold a serialized bloom filter"));
+		return NULL;
+	}
+	for (i = 0; i < 4; i++)
+		nhashes = nhashes << 8 | in[8 + i];
+	for (i = 0; i < 8; i++) {
+		if (nbits > SP_SIZE_MAX >> 8 || count > SP_SIZE_MAX >> 8) {
+			error(("size_t overflow detected, maximum size exceeded"));
+			return NULL;
+		}
+		nbits = nbits << 8 | in[12 + i];
+		count = count << 8 | in[20 + i];
+	}
+	if (nhashes == 0 || nbits == 0 || nbits % (in[5] ? SP_BLOOM_BLOCK : 64) != 0
+			|| nbits > SP_SIZE_MAX - SP_BLOOM_BLOCK) {
+		error(("buf holds invalid filter parameters"));
+		return NULL;
+	}
+	if (size - SP_BLOOM_HEADER < nbits / 8) {
+		error(("buf is too short for the filter (%lu < %lu)",
+					(unsigned long)size, (unsigned long)(SP_BLOOM_HEADER + nbits / 8)));
+		return NULL;
+	}
+
+	if ((ret = sp_bloom_alloc(nbits, nhashes, in[5])) == NULL)
+		return NULL;
+	words = ret->bits->data + ret->offset;
+	for (i = 0; i < nbits / 8; i++)
+		words[i * 8 / SP_WORD_BIT] |= (unsigned long)in[SP_BLOOM_HEADER + i] << i * 8 % SP_WORD_BIT;
+	ret->size = count;
+	return ret;
+}
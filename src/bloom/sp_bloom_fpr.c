@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+
+double sp_bloom_fpr(const struct sp_bloom *bloom)
+{
+	const unsigned long *words;
+	size_t span, i, j, x;
+	double ret = 0, p;
+#ifdef STAPLE_DEBUG
+	if (bloom == NULL) {
+		error(("bloom is NULL"));
+		return 0;
+	}
+#endif
+	/* A query looks at bits of a single region, which is a block or the
+	 * whole filter, and each of them is set with a probability equal to the
+	 * fill of the region */
+	words = bloom->bits->data + bloom->offset;
+	span  = bloom->blocked ? SP_BLOOM_BLOCK : bloom->nbits;
+	for (i = 0; i < bloom->nbits / SP_WORD_BIT; i += span / SP_WORD_BIT) {
+		for (j = 0, x = 0; j < span / SP_WORD_BIT; j++)
+			x += SP_POPCOUNT(words[i + j]);
+		for (j = 0, p = 1; j < bloom->nhashes; j++)
+			p *= (double)x / (double)span;
+		ret += p;
+	}
+	return ret / (double)(bloom->nbits / span);
+}
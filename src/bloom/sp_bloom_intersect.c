@@ -0,0 +1,43 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_bloom_intersect(struct sp_bloom *dest, const struct sp_bloom *src)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->nbits != src->nbits || dest->nhashes != src->nhashes || dest->blocked != src->blocked) {
+		error(("filters have different parameters"));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (i = 0; i < dest->nbits / SP_WORD_BIT; i++)
+		dest->bits->data[dest->offset + i] &= src->bits->data[src->offset + i];
+	dest->size = sp_bloom_estimate(dest);
+	return 0;
+}
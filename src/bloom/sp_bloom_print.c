@@ -0,0 +1,36 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_bloom_print(const struct sp_bloom *bloom)
+{
+#ifdef STAPLE_DEBUG
+	if (bloom == NULL) {
+		error(("bloom is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_bloom_print()\nsize: "SP_SIZE_FMT", nbits: "SP_SIZE_FMT", nhashes: "SP_SIZE_FMT", blocked: %d\n",
+		(SP_SIZE_T)bloom->size, (SP_SIZE_T)bloom->nbits, (SP_SIZE_T)bloom->nhashes, bloom->blocked);
+	printf("set bits: "SP_SIZE_FMT", false positive rate: %g\n",
+		(SP_SIZE_T)sp_bitarray_count(bloom->bits), sp_bloom_fpr(bloom));
+	return 0;
+}
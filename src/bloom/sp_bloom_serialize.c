@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bloom.h"
+#include "../internal.h"
+#include <string.h>
+
+size_t sp_bloom_serialize(const struct sp_bloom *bloom, void *buf, size_t size)
+{
+	unsigned char *const out = buf;
+	const unsigned long *words;
+	size_t i, ret, x;
+#ifdef STAPLE_DEBUG
+	if (bloom == NULL) {
+		error(("bloom is NULL"));
+		return 0;
+	}
+#endif
+	ret = SP_BLOOM_HEADER + bloom->nbits / 8;
+	if (buf == NULL || size < ret)
+		return ret;
+
+	/* The header holds a magic number, a version, the flags, 2 bytes of
+	 * padding, and the numbers of hashes, bits and elements in big-endian
+	 * order, followed by the bits, 8 per byte from the lowest one */
+	memcpy(out, "SPBF", 4);
+	out[4] = 1;
+	out[5] = (unsigned char)bloom->blocked;
+	out[6] = 0;
+	out[7] = 0;
+	for (i = 0, x = bloom->nhashes; i < 4; i++, x = x >> 4 >> 4)
+		out[11 - i] = (unsigned char)(x & 0xFF);
+	for (i = 0, x = bloom->nbits; i < 8; i++, x = x >> 4 >> 4)
+		out[19 - i] = (unsigned char)(x & 0xFF);
+	for (i = 0, x = bloom->size; i < 8; i++, x = x >> 4 >> 4)
+		out[27 - i] = (unsigned char)(x & 0xFF);
+	words = bloom->bits->data + bloom->offset;
+	for (i = 0; i < bloom->nbits / 8; i++)
+		out[SP_BLOOM_HEADER + i] = (unsigned char)(words[i * 8 / SP_WORD_BIT] >> i * 8 % SP_WORD_BIT & 0xFF);
+	return ret;
+}
@@ -0,0 +1,57 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_bptree_buildd(struct sp_bptree *tree, const double *keys, const void *vals, size_t n)
+{
+#ifdef STAPLE_DEBUG
+	size_t i;
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (keys == NULL) {
+		error(("keys is NULL"));
+		return SP_EINVAL;
+	}
+	if (vals == NULL && tree->val_size != 0) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->key_size != sizeof(*keys)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(*keys)));
+		return SP_EILLEGAL;
+	}
+	if (tree->size != 0) {
+		error(("tree is not empty"));
+		return SP_EILLEGAL;
+	}
+	for (i = 1; i < n; i++) {
+		if (!(keys[i - 1] < keys[i])) {
+			error(("keys are not sorted in strictly increasing order"));
+			return SP_EILLEGAL;
+		}
+	}
+#endif
+	if (n != 0 && sp_bptree_bulkload(tree, (const char*)keys, vals, n))
+		return SP_ENOMEM;
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_bptree_clear(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_bptree_node *node;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (kdtor != NULL || vdtor != NULL) {
+		for (node = tree->head; node != NULL; node = node->next) {
+			for (i = 0; i < node->count; i++) {
+				int err;
+				if (kdtor != NULL && (err = kdtor(SP_BPTREE_KEY(tree, node, i)))) {
+					error(("callback function kdtor returned %d (non-0)", err));
+					return SP_ECALLBK;
+				}
+				if (vdtor != NULL && (err = vdtor(SP_BPTREE_VAL(tree, node, i)))) {
+					error(("callback function vdtor returned %d (non-0)", err));
+					return SP_ECALLBK;
+				}
+			}
+		}
+	}
+	if (tree->root != NULL)
+		sp_bptree_free(tree, tree->root, tree->height);
+	tree->root   = NULL;
+	tree->head   = NULL;
+	tree->tail   = NULL;
+	tree->size   = 0;
+	tree->height = 0;
+	return 0;
+}
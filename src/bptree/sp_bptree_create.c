@@ -0,0 +1,78 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+
+struct sp_bptree *sp_bptree_create(size_t key_size, size_t val_size, size_t node_size, int (*cmp)(const void*, const void*))
+{
+	struct sp_bptree *ret;
+	const size_t ps = sizeof(struct sp_bptree_node*);
+	size_t ka, va;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (key_size > SP_SIZE_MAX / 16 || val_size > SP_SIZE_MAX / 16) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+	if (node_size == 0)
+		node_size = SP_BPTREE_NODE_SIZE;
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* Leaves hold the node header, followed by an array of keys and an array
+	 * of values, while inner nodes hold the header, an array of keys and an
+	 * array of one child more. Each array is aligned for any type of the size
+	 * of its items, and as many items as fit into node_size are held, but no
+	 * less than 3. */
+	ka = key_size != 0 ? SP_ALIGNOF_SIZE(key_size) : 1;
+	va = val_size != 0 ? SP_ALIGNOF_SIZE(val_size) : 1;
+	ret->key_offset = (sizeof(struct sp_bptree_node) + ka - 1) / ka * ka;
+
+	ret->leaf_cap = 0;
+	if (node_size > ret->key_offset + va)
+		ret->leaf_cap = (node_size - ret->key_offset - (va - 1)) / MAX(key_size + val_size, 1);
+	ret->leaf_cap   = MAX(ret->leaf_cap, 3);
+	ret->val_offset = (ret->key_offset + ret->leaf_cap * key_size + va - 1) / va * va;
+	ret->leaf_size  = ret->val_offset + ret->leaf_cap * val_size;
+
+	ret->inner_cap = 0;
+	if (node_size > ret->key_offset + 2 * ps)
+		ret->inner_cap = (node_size - ret->key_offset - (ps - 1) - ps) / (key_size + ps);
+	ret->inner_cap    = MAX(ret->inner_cap, 3);
+	ret->child_offset = (ret->key_offset + ret->inner_cap * key_size + ps - 1) / ps * ps;
+	ret->inner_size   = ret->child_offset + (ret->inner_cap + 1) * ps;
+
+	ret->root     = NULL;
+	ret->head     = NULL;
+	ret->tail     = NULL;
+	ret->key_size = key_size;
+	ret->val_size = val_size;
+	ret->size     = 0;
+	ret->height   = 0;
+	ret->cmp      = cmp;
+	return ret;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+
+void *sp_bptree_get(const struct sp_bptree *tree, const void *key)
+{
+	const struct sp_bptree_node *node;
+	size_t l, pos;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return NULL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return NULL;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return NULL;
+	}
+#endif
+	if ((node = tree->root) == NULL)
+		return NULL;
+	for (l = 1; l < tree->height; l++)
+		node = SP_BPTREE_CHILD(tree, node)[sp_bptree_rank(tree, node, key, 1)];
+	pos = sp_bptree_rank(tree, node, key, 0);
+	if (pos < node->count && tree->cmp(SP_BPTREE_KEY(tree, node, pos), key) == 0)
+		return SP_BPTREE_VAL(tree, node, pos);
+	return NULL;
+}
@@ -0,0 +1,66 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_bptree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_bptree_insertb(struct sp_bptree *tree, _Bool key, const void *val)
+{
+	struct sp_bptree_node *path[SP_BPTREE_MAX_HEIGHT], *node;
+	size_t slot[SP_BPTREE_MAX_HEIGHT], l;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL && tree->val_size != 0) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->key_size != sizeof(key)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (l = 0, node = tree->root; l + 1 < tree->height; l++) {
+		path[l] = node;
+		SP_BPTREE_RANK(tree, node, _Bool, key, <=, slot[l]);
+		node = SP_BPTREE_CHILD(tree, node)[slot[l]];
+	}
+	if (node != NULL) {
+		path[l] = node;
+		SP_BPTREE_RANK(tree, node, _Bool, key, <, slot[l]);
+		if (slot[l] < node->count && !(key < *(_Bool*)SP_BPTREE_KEY(tree, node, slot[l]))) {
+			if (tree->val_size != 0)
+				memcpy(SP_BPTREE_VAL(tree, node, slot[l]), val, tree->val_size);
+			return 0;
+		}
+	}
+	if (sp_bptree_insert_at(tree, path, slot, &key, val))
+		return SP_ENOMEM;
+	return 0;
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
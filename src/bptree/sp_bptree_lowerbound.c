@@ -0,0 +1,57 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+
+int sp_bptree_lowerbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it)
+{
+	struct sp_bptree_node *node;
+	size_t l;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return 0;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return 0;
+	}
+	if (it == NULL) {
+		error(("it is NULL"));
+		return 0;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return 0;
+	}
+#endif
+	it->node = NULL;
+	it->idx  = 0;
+	if ((node = tree->root) == NULL)
+		return 0;
+	for (l = 1; l < tree->height; l++)
+		node = SP_BPTREE_CHILD(tree, node)[sp_bptree_rank(tree, node, key, 1)];
+	it->node = node;
+	it->idx  = sp_bptree_rank(tree, node, key, 0);
+	/* The bound may be the first key of the next leaf */
+	if (it->idx == node->count) {
+		it->node = node->next;
+		it->idx  = 0;
+	}
+	return it->node != NULL;
+}
@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_bptree_printd(const struct sp_bptree *tree)
+{
+	const struct sp_bptree_node *node;
+	size_t i, j = 0;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->key_size != sizeof(double)) {
+		error(("tree->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)tree->key_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_bptree_printd()\nsize: "SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT", leaf_cap: "SP_SIZE_FMT", inner_cap: "SP_SIZE_FMT", height: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)tree->size, (SP_SIZE_T)tree->key_size, (SP_SIZE_T)tree->val_size,
+		(SP_SIZE_T)tree->leaf_cap, (SP_SIZE_T)tree->inner_cap, (SP_SIZE_T)tree->height);
+	for (node = tree->head; node != NULL; node = node->next) {
+		for (i = 0; i < node->count; i++, j++) {
+			const double elem = *(double*)SP_BPTREE_KEY(tree, node, i);
+			printf("["SP_SIZE_FMT"]\t""%g""\n", (SP_SIZE_T)j, elem);
+		}
+	}
+	return 0;
+}
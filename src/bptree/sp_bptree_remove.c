@@ -0,0 +1,62 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_bptree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_bptree_remove(struct sp_bptree *tree, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_bptree_node *path[SP_BPTREE_MAX_HEIGHT], *node;
+	size_t slot[SP_BPTREE_MAX_HEIGHT], l;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((node = tree->root) == NULL)
+		return SP_ENOKEY;
+	for (l = 0; l + 1 < tree->height; l++) {
+		path[l] = node;
+		slot[l] = sp_bptree_rank(tree, node, key, 1);
+		node = SP_BPTREE_CHILD(tree, node)[slot[l]];
+	}
+	path[l] = node;
+	slot[l] = sp_bptree_rank(tree, node, key, 0);
+	if (slot[l] == node->count || tree->cmp(SP_BPTREE_KEY(tree, node, slot[l]), key) != 0)
+		return SP_ENOKEY;
+	if (kdtor != NULL && (err = kdtor(SP_BPTREE_KEY(tree, node, slot[l])))) {
+		error(("callback function kdtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_BPTREE_VAL(tree, node, slot[l])))) {
+		error(("callback function vdtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	sp_bptree_erase_at(tree, path, slot);
+	return 0;
+}
@@ -0,0 +1,43 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_chashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_chashmap_clear(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		int err;
+		SP_LOCK(&shard->lock);
+		SP_SEQ_BEGIN(&shard->seq);
+		err = sp_hashmap_clear(shard->table, kdtor, vdtor);
+		SP_SEQ_END(&shard->seq);
+		SP_UNLOCK(&shard->lock);
+		if (err)
+			return err;
+	}
+	return 0;
+}
@@ -0,0 +1,95 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_chashmap.h"
+#include "../internal.h"
+
+struct sp_chashmap *sp_chashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t nshards, size_t (*hash)(const void*), int (*cmp)(const void*, const void*))
+{
+	struct sp_chashmap *ret;
+	size_t n, i;
+	unsigned bits;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (val_size == 0) {
+		error(("val_size cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+	if (nshards == 0) {
+		error(("nshards cannot be 0"));
+		return NULL;
+	}
+#endif
+#ifndef SP_ATOMICS
+	error(("atomic operations are not supported by this compiler"));
+	return NULL;
+#endif
+	if (nshards > SP_SIZE_MAX / 2 / sizeof(*ret->shards)) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+	for (n = 1, bits = 0; n < nshards; n *= 2, bits++);
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	ret->shards = malloc(n * sizeof(*ret->shards));
+	if (ret->shards == NULL) {
+		error(("malloc"));
+		free(ret);
+		return NULL;
+	}
+
+	/* The capacity is spread evenly across all shards */
+	capacity = capacity / n + (capacity % n != 0);
+	for (i = 0; i < n; i++) {
+		struct sp_chashmap_shard *const shard = ret->shards + i;
+		shard->table = sp_hashmap_create(key_size, val_size, capacity, hash, cmp);
+		if (shard->table == NULL) {
+			while (i-- > 0)
+				sp_hashmap_destroy(ret->shards[i].table, NULL, NULL);
+			free(ret->shards);
+			free(ret);
+			return NULL;
+		}
+		shard->retired    = NULL;
+		shard->nretired   = 0;
+		shard->epoch      = 0;
+		shard->readers[0] = 0;
+		shard->readers[1] = 0;
+		shard->seq        = 0;
+		shard->lock       = 0;
+	}
+	ret->nshards     = n;
+	ret->shard_shift = bits ? SP_WORD_BIT - bits : SP_WORD_BIT - 1;
+	ret->key_size    = key_size;
+	ret->val_size    = val_size;
+	ret->hash        = hash;
+	ret->cmp         = cmp;
+
+	return ret;
+}
@@ -0,0 +1,63 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_chashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_chashmap_get(const struct sp_chashmap *map, const void *key, void *val)
+{
+	struct sp_chashmap_shard *shard;
+	unsigned long epoch;
+	size_t hash;
+	int ret;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	hash  = SP_HASH(map, key);
+	shard = SP_CHASHMAP_SHARD(map, hash);
+
+	/* Readers never write to the shard's table. Instead, they retry if a
+	 * writer has modified the shard in the meantime. */
+	SP_EPOCH_ENTER(shard, epoch);
+	for (;;) {
+		const unsigned long seq = SP_LOAD_ACQUIRE(&shard->seq);
+		const struct sp_hashmap *tab;
+		size_t idx;
+		if (seq & 1)
+			continue;
+		tab = SP_LOAD_ACQUIRE(&shard->table);
+		idx = sp_hashtab_find(tab, key, hash);
+		if (idx != tab->capacity && val != NULL)
+			memcpy(val, SP_HASHTAB_VAL(tab, idx), map->val_size);
+		SP_FENCE_ACQUIRE();
+		if (SP_LOAD_RELAXED(&shard->seq) == seq) {
+			ret = idx == tab->capacity ? SP_ENOKEY : 0;
+			break;
+		}
+	}
+	SP_EPOCH_LEAVE(shard, epoch);
+	return ret;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_chashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_chashmap_getb(const struct sp_chashmap *map, _Bool key, void *val)
+{
+	_Bool k;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (map->key_size != sizeof(key)) {
+		error(("map->key_size is incompatible with key type (%lu != %lu)",
+					(unsigned long)map->key_size, sizeof(key)));
+		return SP_EILLEGAL;
+	}
+#endif
+	memset(&k, 0, sizeof(k));
+	k = key;
+	return sp_chashmap_get(map, &k, val);
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
@@ -0,0 +1,72 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_chashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_chashmap_map(struct sp_chashmap *map, int (*func)(const void*, void*))
+{
+	size_t i, j;
+	void *tmp;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (func == NULL) {
+		error(("func is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	tmp = malloc(map->val_size);
+	if (tmp == NULL) {
+		error(("malloc"));
+		return SP_ENOMEM;
+	}
+	/* func works on a copy of each value, so that readers only have to wait
+	 * while a value which has actually changed is written back */
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		struct sp_hashmap *tab;
+		SP_LOCK(&shard->lock);
+		tab = shard->table;
+		for (j = 0; j < tab->capacity; j++) {
+			void *const val = SP_HASHTAB_VAL(tab, j);
+			int err;
+			if (tab->ctrl[j] & 0x80)
+				continue;
+			memcpy(tmp, val, map->val_size);
+			err = func(SP_HASHTAB_KEY(tab, j), tmp);
+			if (memcmp(tmp, val, map->val_size)) {
+				SP_SEQ_BEGIN(&shard->seq);
+				memcpy(val, tmp, map->val_size);
+				SP_SEQ_END(&shard->seq);
+			}
+			if (err) {
+				error(("callback function func returned %d (non-0)", err));
+				SP_UNLOCK(&shard->lock);
+				free(tmp);
+				return SP_ECALLBK;
+			}
+		}
+		SP_UNLOCK(&shard->lock);
+	}
+	free(tmp);
+	return 0;
+}
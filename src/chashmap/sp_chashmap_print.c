@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_chashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_chashmap_print(const struct sp_chashmap *map, int (*func)(const void*, const void*))
+{
+	size_t i, j;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_chashmap_print()\nshards: "SP_SIZE_FMT", key_size: "SP_SIZE_FMT", val_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)map->nshards, (SP_SIZE_T)map->key_size, (SP_SIZE_T)map->val_size);
+	for (i = 0; i < map->nshards; i++) {
+		struct sp_chashmap_shard *const shard = map->shards + i;
+		const struct sp_hashmap *tab;
+		SP_LOCK(&shard->lock);
+		tab = shard->table;
+		printf("shard "SP_SIZE_FMT", size/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT"\n",
+			(SP_SIZE_T)i, (SP_SIZE_T)tab->size, (SP_SIZE_T)tab->capacity);
+		for (j = 0; j < tab->capacity; j++) {
+			const void *const key = SP_HASHTAB_KEY(tab, j),
+			           *const val = SP_HASHTAB_VAL(tab, j);
+			int err;
+			if (tab->ctrl[j] & 0x80)
+				continue;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)j);
+			if (func == NULL)
+				printf("%p\t%p\n", key, val);
+			else if ((err = func(key, val))) {
+				error(("callback function func returned %d (non-0)", err));
+				SP_UNLOCK(&shard->lock);
+				return SP_ECALLBK;
+			}
+		}
+		SP_UNLOCK(&shard->lock);
+	}
+	return 0;
+}
@@ -0,0 +1,64 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_chashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_chashmap_remove(struct sp_chashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	struct sp_chashmap_shard *shard;
+	struct sp_hashmap *tab;
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	hash  = SP_HASH(map, key);
+	shard = SP_CHASHMAP_SHARD(map, hash);
+	SP_LOCK(&shard->lock);
+	tab = shard->table;
+	idx = sp_hashtab_find(tab, key, hash);
+	if (idx == tab->capacity) {
+		SP_UNLOCK(&shard->lock);
+		return SP_ENOKEY;
+	}
+	if (kdtor != NULL && (err = kdtor(SP_HASHTAB_KEY(tab, idx)))) {
+		error(("callback function kdtor returned %d (non-0)", err));
+		SP_UNLOCK(&shard->lock);
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_HASHTAB_VAL(tab, idx)))) {
+		error(("callback function vdtor returned %d (non-0)", err));
+		SP_UNLOCK(&shard->lock);
+		return SP_ECALLBK;
+	}
+	SP_SEQ_BEGIN(&shard->seq);
+	sp_hashtab_erase(tab, idx);
+	SP_SEQ_END(&shard->seq);
+	if (shard->nretired != 0)
+		sp_chashtab_reclaim(shard);
+	SP_UNLOCK(&shard->lock);
+	return 0;
+}
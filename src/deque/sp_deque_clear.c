@@ -0,0 +1,42 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_deque.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_deque_clear(struct sp_deque *deque, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	if (deque == NULL) {
+		error(("deque is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (dtor != NULL)
+		while (deque->size != 0) {
+			int err;
+			if ((err = dtor(sp_blockbuf_get(0, deque->blocks, deque->head, deque->block_size, deque->elem_size)))) {
+				error(("callback function dtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+			++deque->head;
+			--deque->size;
+		}
+	deque->size = 0;
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_deque.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_deque_copy(struct sp_deque *dest, const struct sp_deque *src, int (*cpy)(void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	/* Spare blocks of dest are too small to be reused for larger elements */
+	if (dest->elem_size < src->elem_size)
+		for (i = 0; i < dest->nblocks; i++) {
+			free(dest->blocks[i]);
+			dest->blocks[i] = NULL;
+		}
+	dest->elem_size = src->elem_size;
+	dest->size      = 0;
+	for (i = 0; i < src->size; i++) {
+		const void *const s = sp_blockbuf_get(i, src->blocks, src->head, src->block_size, src->elem_size);
+		void *d;
+		if (sp_blockbuf_fit(&dest->blocks, &dest->nblocks, &dest->head, dest->size, dest->block_size, dest->elem_size, 0))
+			return SP_ENOMEM;
+		d = sp_blockbuf_get(dest->size, dest->blocks, dest->head, dest->block_size, dest->elem_size);
+		if (cpy == NULL) {
+			memcpy(d, s, src->elem_size);
+		} else {
+			int err;
+			if ((err = cpy(d, s))) {
+				error(("callback function cpy returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+		++dest->size;
+	}
+	return 0;
+}
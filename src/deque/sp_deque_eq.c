@@ -0,0 +1,59 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_deque.h"
+#include "../internal.h"
+#include <string.h>
+
+int sp_deque_eq(const struct sp_deque *deque1, const struct sp_deque *deque2, int (*cmp)(const void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (deque1 == NULL) {
+		error(("deque1 is NULL"));
+		return 0;
+	}
+	if (deque2 == NULL) {
+		error(("deque2 is NULL"));
+		return 0;
+	}
+#endif
+	if (deque1->elem_size != deque2->elem_size || deque1->size != deque2->size)
+		return 0;
+	if (cmp) {
+		for (i = 0; i < deque1->size; i++) {
+			const void *const p = sp_blockbuf_get(i, deque1->blocks, deque1->head, deque1->block_size, deque1->elem_size),
+			           *const q = sp_blockbuf_get(i, deque2->blocks, deque2->head, deque2->block_size, deque2->elem_size);
+			if (cmp(p, q))
+				return 0;
+		}
+		return 1;
+	}
+	/* Compare the largest slices of memory contiguous in both deques */
+	i = 0;
+	while (i != deque1->size) {
+		const size_t left1 = deque1->block_size - (deque1->head + i) % deque1->block_size,
+		             left2 = deque2->block_size - (deque2->head + i) % deque2->block_size,
+		             len   = MIN(MIN(left1, left2), deque1->size - i);
+		const void *const p = sp_blockbuf_get(i, deque1->blocks, deque1->head, deque1->block_size, deque1->elem_size),
+		           *const q = sp_blockbuf_get(i, deque2->blocks, deque2->head, deque2->block_size, deque2->elem_size);
+		if (memcmp(p, q, len * deque1->elem_size))
+			return 0;
+		i += len;
+	}
+	return 1;
+}
@@ -0,0 +1,39 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_deque.h"
+#include "../internal.h"
+
+float sp_deque_getf(const struct sp_deque *deque, size_t idx)
+{
+#ifdef STAPLE_DEBUG
+	if (deque == NULL) {
+		error(("deque is NULL"));
+		return 0;
+	}
+	if (deque->elem_size != sizeof(float)) {
+		error(("deque->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)deque->elem_size, sizeof(float)));
+		return 0;
+	}
+	if (idx >= deque->size) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	return *(float*)sp_blockbuf_get(idx, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+}
@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_deque.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_deque_insertd(struct sp_deque *deque, size_t idx, double elem)
+{
+#ifdef STAPLE_DEBUG
+	if (deque == NULL) {
+		error(("deque is NULL"));
+		return SP_EINVAL;
+	}
+	if (deque->elem_size != sizeof(elem)) {
+		error(("deque->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)deque->elem_size, sizeof(elem)));
+		return SP_EILLEGAL;
+	}
+	if (idx > deque->size) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	if (sp_size_try_add(deque->size * deque->elem_size, deque->elem_size))
+		return SP_ERANGE;
+	if (sp_blockbuf_fit(&deque->blocks, &deque->nblocks, &deque->head, deque->size, deque->block_size, deque->elem_size, idx < deque->size / 2))
+		return SP_ENOMEM;
+	sp_blockbuf_insert(&elem, idx, deque->blocks, &deque->head, &deque->size, deque->block_size, deque->elem_size);
+	return 0;
+}
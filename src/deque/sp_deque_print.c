@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_deque.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_deque_print(const struct sp_deque *deque, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (deque == NULL) {
+		error(("deque is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_deque_print()\nsize: "SP_SIZE_FMT", block_size: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)deque->size, (SP_SIZE_T)deque->block_size, (SP_SIZE_T)deque->elem_size);
+	if (func == NULL)
+		for (i = 0; i < deque->size; i++) {
+			const void *const elem = sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+			printf("["SP_SIZE_FMT"]\t%p\n", (SP_SIZE_T)i, elem);
+		}
+	else
+		for (i = 0; i < deque->size; i++) {
+			const void *const elem = sp_blockbuf_get(i, deque->blocks, deque->head, deque->block_size, deque->elem_size);
+			int err;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+			if ((err = func(elem)) != 0) {
+				error(("callback function func returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	return 0;
+}
@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_fenwick.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_fenwick_addd(struct sp_fenwick *fw, size_t idx, double delta)
+{
+	double *t;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (fw == NULL) {
+		error(("fw is NULL"));
+		return SP_EINVAL;
+	}
+	if (fw->elem_size != sizeof(delta)) {
+		error(("fw->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)fw->elem_size, sizeof(delta)));
+		return SP_EILLEGAL;
+	}
+	if (idx >= fw->size) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	t = fw->data;
+	for (i = idx + 1; i <= fw->size; i += SP_FENWICK_LOWBIT(i))
+		t[i - 1] += delta;
+	return 0;
+}
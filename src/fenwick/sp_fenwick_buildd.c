@@ -0,0 +1,51 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_fenwick.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_fenwick_buildd(struct sp_fenwick *fw, const double *vals)
+{
+	double *t;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (fw == NULL) {
+		error(("fw is NULL"));
+		return SP_EINVAL;
+	}
+	if (vals == NULL) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (fw->elem_size != sizeof(double)) {
+		error(("fw->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)fw->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+#endif
+	t = fw->data;
+	for (i = 0; i < fw->size; i++)
+		t[i] = vals[i];
+	/* Every node passes its total on to its parent, in one sweep */
+	for (i = 1; i <= fw->size; i++) {
+		const size_t j = i + SP_FENWICK_LOWBIT(i);
+		if (j <= fw->size)
+			t[j - 1] += t[i - 1];
+	}
+	return 0;
+}
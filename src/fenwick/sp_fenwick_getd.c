@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_fenwick.h"
+#include "../internal.h"
+
+double sp_fenwick_getd(const struct sp_fenwick *fw, size_t idx)
+{
+	const double *t;
+	double ret;
+	size_t i, stop;
+#ifdef STAPLE_DEBUG
+	if (fw == NULL) {
+		error(("fw is NULL"));
+		return 0;
+	}
+	if (fw->elem_size != sizeof(double)) {
+		error(("fw->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)fw->elem_size, sizeof(double)));
+		return 0;
+	}
+	if (idx >= fw->size) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	t = fw->data;
+	/* Node idx + 1 covers (stop, idx + 1], so take away everything in
+	 * (stop, idx], which its children cover */
+	ret  = t[idx];
+	stop = idx + 1 - SP_FENWICK_LOWBIT(idx + 1);
+	for (i = idx; i > stop; i -= SP_FENWICK_LOWBIT(i))
+		ret -= t[i - 1];
+	return ret;
+}
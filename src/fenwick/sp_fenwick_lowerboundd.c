@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_fenwick.h"
+#include "../internal.h"
+
+size_t sp_fenwick_lowerboundd(const struct sp_fenwick *fw, double target)
+{
+	const double *t;
+	size_t pos = 0, step = 1;
+#ifdef STAPLE_DEBUG
+	if (fw == NULL) {
+		error(("fw is NULL"));
+		return 0;
+	}
+	if (fw->elem_size != sizeof(target)) {
+		error(("fw->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)fw->elem_size, sizeof(target)));
+		return 0;
+	}
+#endif
+	t = fw->data;
+	while (step <= fw->size / 2)
+		step *= 2;
+	/* Descend from the largest node, keeping pos at the longest prefix
+	 * whose sum is still below target */
+	for (; step > 0; step /= 2) {
+		if (pos + step <= fw->size && t[pos + step - 1] < target) {
+			pos   += step;
+			target = (double)(target - t[pos - 1]);
+		}
+	}
+	return pos;
+}
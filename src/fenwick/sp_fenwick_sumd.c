@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_fenwick.h"
+#include "../internal.h"
+
+double sp_fenwick_sumd(const struct sp_fenwick *fw, size_t idx, size_t n)
+{
+	const double *t;
+	double ret = 0;
+	size_t hi, lo;
+#ifdef STAPLE_DEBUG
+	if (fw == NULL) {
+		error(("fw is NULL"));
+		return 0;
+	}
+	if (fw->elem_size != sizeof(double)) {
+		error(("fw->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)fw->elem_size, sizeof(double)));
+		return 0;
+	}
+	if (idx > fw->size || n > fw->size - idx) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	t = fw->data;
+	/* Both prefixes share the nodes above their common ancestor, which
+	 * are skipped rather than added and taken away again */
+	hi = idx + n;
+	lo = idx;
+	while (hi > lo) {
+		ret += t[hi - 1];
+		hi  -= SP_FENWICK_LOWBIT(hi);
+	}
+	while (lo > hi) {
+		ret -= t[lo - 1];
+		lo  -= SP_FENWICK_LOWBIT(lo);
+	}
+	return ret;
+}
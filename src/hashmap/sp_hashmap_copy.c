@@ -0,0 +1,97 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_hashmap_copy(struct sp_hashmap *dest, const struct sp_hashmap *src, int (*kcpy)(void*, const void*), int (*vcpy)(void*, const void*))
+{
+	unsigned char *ctrl;
+	void *slots;
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	ctrl  = malloc(src->capacity);
+	slots = malloc(src->capacity * src->slot_size);
+	if (ctrl == NULL || slots == NULL) {
+		error(("malloc"));
+		free(ctrl);
+		free(slots);
+		return SP_ENOMEM;
+	}
+	free(dest->ctrl);
+	free(dest->slots);
+	dest->ctrl        = ctrl;
+	dest->slots       = slots;
+	dest->key_size    = src->key_size;
+	dest->val_size    = src->val_size;
+	dest->val_offset  = src->val_offset;
+	dest->slot_size   = src->slot_size;
+	dest->size        = src->size;
+	dest->capacity    = src->capacity;
+	dest->growth_left = src->growth_left;
+	dest->hash        = src->hash;
+	dest->cmp         = src->cmp;
+
+	/* Same capacity and hash function, so every element keeps its slot */
+	memcpy(dest->ctrl, src->ctrl, src->capacity);
+	if (kcpy == NULL && vcpy == NULL) {
+		memcpy(dest->slots, src->slots, src->capacity * src->slot_size);
+		return 0;
+	}
+	for (i = 0; i < src->capacity; i++) {
+		char *const dk = SP_HASHTAB_KEY(dest, i),
+		     *const dv = SP_HASHTAB_VAL(dest, i);
+		const char *const sk = SP_HASHTAB_KEY(src, i),
+		           *const sv = SP_HASHTAB_VAL(src, i);
+		int err = 0;
+		if (src->ctrl[i] & 0x80)
+			continue;
+		if (kcpy == NULL)
+			memcpy(dk, sk, src->key_size);
+		else if ((err = kcpy(dk, sk))) {
+			error(("callback function kcpy returned %d (non-0)", err));
+		}
+		if (err == 0) {
+			if (vcpy == NULL)
+				memcpy(dv, sv, src->val_size);
+			else if ((err = vcpy(dv, sv))) {
+				error(("callback function vcpy returned %d (non-0)", err));
+			}
+		}
+		if (err) {
+			/* Turn all slots which were not copied into tombstones */
+			for (; i < dest->capacity; i++)
+				if (!(dest->ctrl[i] & 0x80)) {
+					dest->ctrl[i] = SP_CTRL_DELETED;
+					--dest->size;
+				}
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,70 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+
+struct sp_hashmap *sp_hashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t (*hash)(const void*), int (*cmp)(const void*, const void*))
+{
+	struct sp_hashmap *ret;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (val_size == 0) {
+		error(("val_size cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (key_size > SP_SIZE_MAX / 2 - 16 || val_size > SP_SIZE_MAX / 2 - 16) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* Keys and values are stored next to each other in a single slot. Both
+	 * are padded to keep them aligned for any type of their size. */
+	ret->ctrl        = NULL;
+	ret->slots       = NULL;
+	ret->key_size    = key_size;
+	ret->val_size    = val_size;
+	ret->val_offset  = (key_size + SP_ALIGNOF_SIZE(val_size) - 1) / SP_ALIGNOF_SIZE(val_size) * SP_ALIGNOF_SIZE(val_size);
+	ret->slot_size   = MAX(SP_ALIGNOF_SIZE(key_size), SP_ALIGNOF_SIZE(val_size));
+	ret->slot_size   = (ret->val_offset + val_size + ret->slot_size - 1) / ret->slot_size * ret->slot_size;
+	ret->size        = 0;
+	ret->capacity    = 0;
+	ret->growth_left = 0;
+	ret->hash        = hash;
+	ret->cmp         = cmp;
+	if (sp_hashtab_fit(ret, capacity)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
@@ -0,0 +1,37 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_hashmap_destroy(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	int error;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if ((error = sp_hashmap_clear(map, kdtor, vdtor)))
+		return error;
+	free(map->ctrl);
+	free(map->slots);
+	free(map);
+	return 0;
+}
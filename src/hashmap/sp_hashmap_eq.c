@@ -0,0 +1,52 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+#include <string.h>
+
+int sp_hashmap_eq(const struct sp_hashmap *map1, const struct sp_hashmap *map2, int (*cmp)(const void*, const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (map1 == NULL) {
+		error(("map1 is NULL"));
+		return 0;
+	}
+	if (map2 == NULL) {
+		error(("map2 is NULL"));
+		return 0;
+	}
+#endif
+	if (map1->key_size != map2->key_size || map1->val_size != map2->val_size || map1->size != map2->size)
+		return 0;
+	for (i = 0; i < map1->capacity; i++) {
+		const char *const key = SP_HASHTAB_KEY(map1, i),
+		           *const v1  = SP_HASHTAB_VAL(map1, i);
+		const char *v2;
+		size_t j;
+		if (map1->ctrl[i] & 0x80)
+			continue;
+		j = sp_hashtab_find(map2, key, SP_HASH(map2, key));
+		if (j == map2->capacity)
+			return 0;
+		v2 = SP_HASHTAB_VAL(map2, j);
+		if (cmp ? cmp(v1, v2) : memcmp(v1, v2, map1->val_size))
+			return 0;
+	}
+	return 1;
+}
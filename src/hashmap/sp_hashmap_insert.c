@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_hashmap_insert(struct sp_hashmap *map, const void *key, const void *val)
+{
+	size_t hash, idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	hash = SP_HASH(map, key);
+	idx  = sp_hashtab_find(map, key, hash);
+	if (idx == map->capacity) {
+		if ((err = sp_hashtab_claim(map, hash, &idx)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		memcpy(SP_HASHTAB_KEY(map, idx), key, map->key_size);
+	}
+	memcpy(SP_HASHTAB_VAL(map, idx), val, map->val_size);
+	return 0;
+}
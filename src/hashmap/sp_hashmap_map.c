@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_hashmap_map(struct sp_hashmap *map, int (*func)(const void*, void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (func == NULL) {
+		error(("func is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (i = 0; i < map->capacity; i++) {
+		int err;
+		if (map->ctrl[i] & 0x80)
+			continue;
+		if ((err = func(SP_HASHTAB_KEY(map, i), SP_HASHTAB_VAL(map, i)))) {
+			error(("callback function func returned %d (non-0)", err));
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
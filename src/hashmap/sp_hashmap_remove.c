@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_hashmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_hashmap_remove(struct sp_hashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t idx;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (map == NULL) {
+		error(("map is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	idx = sp_hashtab_find(map, key, SP_HASH(map, key));
+	if (idx == map->capacity)
+		return SP_ENOKEY;
+	if (kdtor != NULL && (err = kdtor(SP_HASHTAB_KEY(map, idx)))) {
+		error(("callback function kdtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	if (vdtor != NULL && (err = vdtor(SP_HASHTAB_VAL(map, idx)))) {
+		error(("callback function vdtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	sp_hashtab_erase(map, idx);
+	return 0;
+}
@@ -0,0 +1,79 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_intern.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_intern_addn(struct sp_intern *pool, const char *str, size_t len, size_t *id)
+{
+	struct sp_intern_str key;
+	size_t hash, i;
+	char *buf;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (pool == NULL) {
+		error(("pool is NULL"));
+		return SP_EINVAL;
+	}
+	if (str == NULL) {
+		error(("str is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (sp_size_try_add(len, 1))
+		return SP_ERANGE;
+	key.str = str;
+	key.len = len;
+	hash = sp_hash(str, len);
+	i = sp_hashtab_find(pool->index, &key, hash);
+	if (i != pool->index->capacity) {
+		if (id != NULL)
+			*id = *(size_t*)SP_HASHTAB_VAL(pool->index, i);
+		return 0;
+	}
+
+	/* Make room everywhere first, so that a failure leaves the pool as it
+	 * was (save for a new arena block, which is only freed on clear) */
+	if (len + 1 > pool->block_left && (err = sp_intern_grow(pool, len + 1)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	if (sp_size_try_add(pool->size * sizeof(*pool->strs), sizeof(*pool->strs)))
+		return SP_ERANGE;
+	if (sp_buf_fit((void**)&pool->strs, pool->size, &pool->capacity, sizeof(*pool->strs)))
+		return SP_ENOMEM;
+	if ((err = sp_hashtab_claim(pool->index, hash, &i)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+
+	if (len + 1 > pool->block_left) {
+		/* The string got a block of its own, see sp_intern_grow */
+		buf = pool->blocks[pool->nblocks - 2];
+	} else {
+		buf = pool->blocks[pool->nblocks - 1] + (pool->block_size - pool->block_left);
+		pool->block_left -= len + 1;
+	}
+	memcpy(buf, str, len);
+	buf[len] = '\0';
+	key.str = buf;
+	memcpy(SP_HASHTAB_KEY(pool->index, i), &key, sizeof(key));
+	memcpy(SP_HASHTAB_VAL(pool->index, i), &pool->size, sizeof(pool->size));
+	pool->strs[pool->size] = key;
+	if (id != NULL)
+		*id = pool->size;
+	++pool->size;
+	return 0;
+}
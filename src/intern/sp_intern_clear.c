@@ -0,0 +1,41 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_intern.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_intern_clear(struct sp_intern *pool)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (pool == NULL) {
+		error(("pool is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (i = 0; i < pool->nblocks; i++)
+		free(pool->blocks[i]);
+	free(pool->blocks);
+	sp_hashmap_clear(pool->index, NULL, NULL);
+	pool->blocks     = NULL;
+	pool->nblocks    = 0;
+	pool->block_size = 0;
+	pool->block_left = 0;
+	pool->size       = 0;
+	return 0;
+}
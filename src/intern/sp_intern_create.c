@@ -0,0 +1,64 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_intern.h"
+#include "../internal.h"
+
+struct sp_intern *sp_intern_create(size_t capacity)
+{
+	struct sp_intern *ret;
+
+#ifdef STAPLE_DEBUG
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / sizeof(*ret->strs)) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* The index maps each string to its id. Its keys point into the arena,
+	 * so the strings themselves are never stored twice. */
+	ret->index = sp_hashmap_create(sizeof(struct sp_intern_str), sizeof(size_t), MAX(capacity, 1), sp_intern_hash, sp_intern_cmp);
+	if (ret->index == NULL) {
+		free(ret);
+		return NULL;
+	}
+	ret->size       = 0;
+	ret->capacity   = MAX(capacity, 1);
+	ret->blocks     = NULL;
+	ret->nblocks    = 0;
+	ret->block_size = 0;
+	ret->block_left = 0;
+	ret->strs       = malloc(ret->capacity * sizeof(*ret->strs));
+	if (ret->strs == NULL) {
+		error(("malloc"));
+		sp_hashmap_destroy(ret->index, NULL, NULL);
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
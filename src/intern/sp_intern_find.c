@@ -0,0 +1,35 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_intern.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_intern_find(const struct sp_intern *pool, const char *str, size_t *id)
+{
+#ifdef STAPLE_DEBUG
+	if (pool == NULL) {
+		error(("pool is NULL"));
+		return SP_EINVAL;
+	}
+	if (str == NULL) {
+		error(("str is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	return sp_intern_findn(pool, str, sp_strnlen(str, SP_SIZE_MAX), id);
+}
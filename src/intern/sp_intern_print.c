@@ -0,0 +1,39 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_intern.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_intern_print(const struct sp_intern *pool)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (pool == NULL) {
+		error(("pool is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_intern_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", blocks: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)pool->size, (SP_SIZE_T)pool->capacity, (SP_SIZE_T)pool->nblocks);
+	for (i = 0; i < pool->size; i++) {
+		printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)i);
+		fwrite(pool->strs[i].str, 1, pool->strs[i].len, stdout);
+		putchar('\n');
+	}
+	return 0;
+}
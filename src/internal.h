@@ -25,6 +25,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <limits.h>
 
 #define MIN(X,Y) ((X) < (Y) ? (X) : (Y))
 #define MAX(X,Y) ((X) > (Y) ? (X) : (Y))
@@ -32,6 +33,621 @@
 #define SP_SIZE_MAX ((size_t)(-1))
 #endif
 
+/* Word-level bit operations, used by the bitarray module. Compilers which are
+ * known to provide builtins get them, everything else falls back to portable
+ * (but slower) implementations in internal.c.
+ */
+#define SP_WORD_BIT  (sizeof(unsigned long) * CHAR_BIT)
+#define SP_WORDS(N)  ((N) / SP_WORD_BIT + ((N) % SP_WORD_BIT != 0))
+#if defined(__GNUC__)
+#define SP_POPCOUNT(X) ((size_t)__builtin_popcountl(X))
+#define SP_CTZ(X)      ((size_t)__builtin_ctzl(X))
+#else
+#define SP_POPCOUNT(X) sp_popcount(X)
+#define SP_CTZ(X)      sp_ctz(X)
+#endif
+
+/* Open-addressing hash table internals, used by the hashmap module.
+ * Every slot has a control byte: EMPTY, DELETED, or (for full slots) the 7 low
+ * bits of the hash of its key (H2). The table is split into groups of
+ * SP_GROUP slots, whose control bytes are loaded and matched all at once. The
+ * remaining bits of the hash (H1) select the first group to probe.
+ * Each SP_CTRL_MATCH* macro yields a bit mask of matching slots, and
+ * SP_CTRL_INDEX turns its lowest set bit into a slot index within the group.
+ * Assumes 8-bit bytes.
+ */
+#define SP_CTRL_EMPTY   0x80
+#define SP_CTRL_DELETED 0xFE
+#define SP_H1(H)        ((H) >> 7)
+#define SP_H2(H)        ((unsigned char)((H) & 0x7F))
+#define SP_HASHTAB_FILL(C) ((C) - (C) / 8)
+#if ULONG_MAX > 0xFFFFFFFFUL
+#define SP_HASH_MULT 0x9E3779B97F4A7C15UL
+#else
+#define SP_HASH_MULT 0x9E3779B9UL
+#endif
+#define SP_HASH(MAP, KEY) ((MAP)->hash ? (MAP)->hash(KEY) : sp_hash((KEY), (MAP)->key_size))
+/* Sets RET to SP_HASH(MAP, KEY) for a key whose SIZE is known at compile time.
+ * Keys no longer than a word are mixed inline, the same way sp_hash does. */
+#define SP_HASH_FIXED(RET, MAP, KEY, SIZE) do { \
+	if ((MAP)->hash != NULL) { \
+		(RET) = (MAP)->hash(KEY); \
+	} else if ((SIZE) <= sizeof(unsigned long)) { \
+		unsigned long h_ = (SIZE), w_ = 0; \
+		memcpy(&w_, (KEY), MIN((SIZE), sizeof(w_))); \
+		h_ = (h_ ^ w_) * SP_HASH_MULT; \
+		h_ ^= h_ >> SP_WORD_BIT / 2; \
+		h_ *= SP_HASH_MULT; \
+		h_ ^= h_ >> SP_WORD_BIT / 2; \
+		(RET) = (size_t)h_; \
+	} else { \
+		(RET) = sp_hash((KEY), (SIZE)); \
+	} \
+} while (0)
+#define SP_HASHTAB_KEY(MAP, I) ((char*)(MAP)->slots + (I) * (MAP)->slot_size)
+#define SP_HASHTAB_VAL(MAP, I) (SP_HASHTAB_KEY(MAP, I) + (MAP)->val_offset)
+/* Alignment requirement of an object of size N: its lowest set bit, capped at
+ * the strictest alignment of any fundamental type on common platforms */
+#define SP_ALIGNOF_SIZE(N) MIN((N) & (~(N) + 1), 16)
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/* With SSE2, a group is 16 control bytes compared in a single instruction,
+ * and the match masks hold one bit per slot. Only full slots have the high
+ * bit clear, so the free slots of a group are just its byte sign mask. */
+#include <emmintrin.h>
+#define SP_GROUP                 16
+#define SP_CTRL_GROUP            __m128i
+#define SP_CTRL_LOAD(W, P)       ((W) = _mm_loadu_si128((const __m128i*)(const void*)(P)))
+#define SP_CTRL_MATCH(W, H2)     ((unsigned long)_mm_movemask_epi8(_mm_cmpeq_epi8((W), _mm_set1_epi8((char)(H2)))))
+#define SP_CTRL_MATCH_EMPTY(W)   ((unsigned long)_mm_movemask_epi8(_mm_cmpeq_epi8((W), _mm_set1_epi8((char)SP_CTRL_EMPTY))))
+#define SP_CTRL_MATCH_FREE(W)    ((unsigned long)_mm_movemask_epi8(W))
+#define SP_CTRL_INDEX(M)         SP_CTZ(M)
+#else
+/* Otherwise a group is as many control bytes as fit in an unsigned long,
+ * matched with SWAR bit tricks, and the match masks have the high bit set in
+ * every matching byte. SP_CTRL_MATCH may produce false positives, which are
+ * filtered out by the subsequent key comparison. */
+#define SP_GROUP                 sizeof(unsigned long)
+#define SP_CTRL_GROUP            unsigned long
+#define SP_CTRL_LSB              (~0UL / 0xFF)
+#define SP_CTRL_MSB              (SP_CTRL_LSB << 7)
+#define SP_CTRL_MATCH(W, H2)     ((((W) ^ SP_CTRL_LSB * (H2)) - SP_CTRL_LSB) & ~((W) ^ SP_CTRL_LSB * (H2)) & SP_CTRL_MSB)
+#define SP_CTRL_MATCH_EMPTY(W)   ((W) & ~((W) << 6) & SP_CTRL_MSB)
+#define SP_CTRL_MATCH_FREE(W)    ((W) & ~((W) << 7) & SP_CTRL_MSB)
+#define SP_CTRL_INDEX(M)         (SP_CTZ(M) / 8)
+/* The i-th control byte of a group always lands in the i-th byte of the word
+ * (counting from the least significant one), regardless of endianness. On
+ * little-endian targets this is a plain load. */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SP_CTRL_LOAD(W, P) memcpy(&(W), (P), SP_GROUP)
+#else
+#define SP_CTRL_LOAD(W, P) do { \
+	size_t j_; \
+	(W) = 0; \
+	for (j_ = SP_GROUP; j_-- > 0;) \
+		(W) = (W) << 8 | (P)[j_]; \
+} while (0)
+#endif
+#endif
+
+/* Sets RET to the index of the slot holding KEY, or to MAP->capacity if there
+ * is none. This is a macro, so that callers which know KEY_SIZE at compile
+ * time get an inlined memcmp. The probe gives up after visiting every group
+ * once, which only matters to lock-free readers of the chashmap module, whose
+ * view of the control bytes may be inconsistent. */
+#define SP_HASHTAB_PROBE(RET, MAP, KEY, KEY_SIZE, HASH) do { \
+	const size_t hash_ = (HASH), mask_ = (MAP)->capacity / SP_GROUP - 1; \
+	const unsigned char h2_ = SP_H2(hash_); \
+	size_t g_ = SP_H1(hash_) & mask_, step_ = 0; \
+	(RET) = (MAP)->capacity; \
+	for (;;) { \
+		SP_CTRL_GROUP w_; \
+		unsigned long m_; \
+		SP_CTRL_LOAD(w_, (MAP)->ctrl + g_ * SP_GROUP); \
+		for (m_ = SP_CTRL_MATCH(w_, h2_); m_ != 0; m_ &= m_ - 1) { \
+			const size_t i_ = g_ * SP_GROUP + SP_CTRL_INDEX(m_); \
+			const void *const k_ = SP_HASHTAB_KEY(MAP, i_); \
+			if ((MAP)->ctrl[i_] == h2_ && ((MAP)->cmp ? !(MAP)->cmp(k_, (KEY)) : !memcmp(k_, (KEY), (KEY_SIZE)))) { \
+				(RET) = i_; \
+				break; \
+			} \
+		} \
+		if ((RET) != (MAP)->capacity || SP_CTRL_MATCH_EMPTY(w_) || step_ == mask_) \
+			break; \
+		g_ = (g_ + ++step_) & mask_; \
+	} \
+} while (0)
+
+/* Atomic operations, used by the chashmap module. Only compilers providing the
+ * __atomic builtins (GCC 4.7+, Clang and compatible) are supported; elsewhere
+ * SP_ATOMICS stays undefined and sp_chashmap_create refuses to work.
+ */
+#if defined(__GNUC__) && defined(__ATOMIC_ACQUIRE)
+#define SP_ATOMICS
+#define SP_LOAD_RELAXED(P)     __atomic_load_n((P), __ATOMIC_RELAXED)
+#define SP_LOAD_ACQUIRE(P)     __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define SP_STORE_RELAXED(P, V) __atomic_store_n((P), (V), __ATOMIC_RELAXED)
+#define SP_STORE_RELEASE(P, V) __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+#define SP_FENCE_ACQUIRE()     __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define SP_FENCE_RELEASE()     __atomic_thread_fence(__ATOMIC_RELEASE)
+#define SP_TRYLOCK(P)          (!__atomic_exchange_n((P), 1UL, __ATOMIC_ACQUIRE))
+#define SP_INCR_RELAXED(P)     __atomic_add_fetch((P), 1UL, __ATOMIC_RELAXED)
+#define SP_DECR_RELEASE(P)     __atomic_sub_fetch((P), 1UL, __ATOMIC_RELEASE)
+#define SP_FENCE_SEQ_CST()     __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define SP_LOAD_RELAXED(P)     (*(P))
+#define SP_LOAD_ACQUIRE(P)     (*(P))
+#define SP_STORE_RELAXED(P, V) (*(P) = (V))
+#define SP_STORE_RELEASE(P, V) (*(P) = (V))
+#define SP_FENCE_ACQUIRE()     ((void)0)
+#define SP_FENCE_RELEASE()     ((void)0)
+#define SP_TRYLOCK(P)          (*(P) ? 0 : (*(P) = 1UL))
+#define SP_INCR_RELAXED(P)     (++*(P))
+#define SP_DECR_RELEASE(P)     (--*(P))
+#define SP_FENCE_SEQ_CST()     ((void)0)
+#endif
+/* Test-and-test-and-set spinlock. Writers of a shard hold it only for the
+ * duration of a single operation. */
+#define SP_LOCK(P) do { \
+	while (!SP_TRYLOCK(P)) \
+		while (SP_LOAD_RELAXED(P)) \
+			; \
+} while (0)
+#define SP_UNLOCK(P) SP_STORE_RELEASE((P), 0UL)
+/* Seqlock write side. The counter is odd while a write is in progress; readers
+ * retry whenever it was odd or has changed during their read. */
+#define SP_SEQ_BEGIN(P) do { \
+	SP_STORE_RELAXED((P), SP_LOAD_RELAXED(P) + 1); \
+	SP_FENCE_RELEASE(); \
+} while (0)
+#define SP_SEQ_END(P) SP_STORE_RELEASE((P), SP_LOAD_RELAXED(P) + 1)
+/* Epoch-based reclamation of the tables a shard has retired. For the duration
+ * of a lookup, a reader counts itself among the readers of the shard's current
+ * epoch, and starts over if the epoch has moved on in the meantime. Writers
+ * only advance the epoch once no reader of the previous one is left, so a table
+ * retired during epoch E can be freed as soon as the epoch reaches E + 2, see
+ * sp_chashtab_reclaim. */
+#define SP_EPOCH_ENTER(SHARD, E) do { \
+	for (;;) { \
+		(E) = SP_LOAD_ACQUIRE(&(SHARD)->epoch); \
+		SP_INCR_RELAXED(&(SHARD)->readers[(E) & 1]); \
+		SP_FENCE_SEQ_CST(); \
+		if (SP_LOAD_ACQUIRE(&(SHARD)->epoch) == (E)) \
+			break; \
+		SP_DECR_RELEASE(&(SHARD)->readers[(E) & 1]); \
+	} \
+} while (0)
+#define SP_EPOCH_LEAVE(SHARD, E) SP_DECR_RELEASE(&(SHARD)->readers[(E) & 1])
+/* Shards are selected by the high bits of the scrambled hash, which are
+ * independent of the low bits used for probing within a shard. */
+#define SP_CHASHMAP_SHARD(MAP, HASH) \
+	((MAP)->shards + ((unsigned long)(HASH) * SP_HASH_MULT >> (MAP)->shard_shift & ((MAP)->nshards - 1)))
+
+/* Arena blocks of the intern module start at SP_INTERN_BLOCK bytes and double
+ * in size up to SP_INTERN_BLOCK_MAX bytes */
+#define SP_INTERN_BLOCK     4096
+#define SP_INTERN_BLOCK_MAX (1UL << 20)
+
+/* Addresses of the key and the value stored in a node of an AVL tree, and the
+ * augmented fields of a possibly null subtree */
+#define SP_AVL_KEY(AVL, NODE)  ((char*)(NODE) + (AVL)->key_offset)
+#define SP_AVL_VAL(AVL, NODE)  ((char*)(NODE) + (AVL)->val_offset)
+#define SP_AVL_HEIGHT(NODE)    ((NODE) == NULL ? 0 : (NODE)->height)
+#define SP_AVL_SIZE(NODE)      ((NODE) == NULL ? 0 : (NODE)->size)
+
+/* Recomputes the height and the size of a node from its children */
+#define SP_AVL_UPDATE(NODE) do { \
+	const int lh_ = SP_AVL_HEIGHT((NODE)->left), rh_ = SP_AVL_HEIGHT((NODE)->right); \
+	(NODE)->height = (lh_ > rh_ ? lh_ : rh_) + 1; \
+	(NODE)->size   = SP_AVL_SIZE((NODE)->left) + SP_AVL_SIZE((NODE)->right) + 1; \
+} while (0)
+
+/* Whether a possibly null node of a red-black tree is black */
+#define SP_RBTREE_IS_BLACK(NODE) ((NODE) == NULL || (NODE)->color == SP_RBTREE_BLACK)
+
+/* Addresses of the I-th key, value and child of a node of a B+tree */
+#define SP_BPTREE_KEY(TREE, NODE, I) ((char*)(NODE) + (TREE)->key_offset + (I) * (TREE)->key_size)
+#define SP_BPTREE_VAL(TREE, NODE, I) ((char*)(NODE) + (TREE)->val_offset + (I) * (TREE)->val_size)
+#define SP_BPTREE_CHILD(TREE, NODE)  ((struct sp_bptree_node**)((char*)(NODE) + (TREE)->child_offset))
+
+/* A B+tree at least halves its number of nodes with every level, so that it
+ * cannot be higher than the number of bits of a size_t */
+#define SP_BPTREE_MAX_HEIGHT (sizeof(size_t) * CHAR_BIT)
+
+/* Number of keys of a B+tree node which compare OP (< or <=) to KEY of
+ * primitive type TYPE, stored in RET. Binary search narrows the range down to
+ * SP_BPTREE_SCAN keys, which are then counted in a loop without branches, over
+ * contiguous memory, which compilers turn into SIMD instructions. */
+#define SP_BPTREE_SCAN 16
+#define SP_BPTREE_RANK(TREE, NODE, TYPE, KEY, OP, RET) do { \
+	const TYPE *const k_ = (const TYPE*)SP_BPTREE_KEY(TREE, NODE, 0); \
+	size_t n_ = (NODE)->count, b_, i_; \
+	(RET) = 0; \
+	while (n_ > SP_BPTREE_SCAN) { \
+		const size_t h_ = n_ / 2; \
+		if (k_[(RET) + h_] OP (KEY)) { \
+			(RET) += h_ + 1; \
+			n_    -= h_ + 1; \
+		} else { \
+			n_ = h_; \
+		} \
+	} \
+	for (b_ = (RET), i_ = 0; i_ < n_; i_++) \
+		(RET) += k_[b_ + i_] OP (KEY); \
+} while (0)
+
+/* Type of an adaptive radix tree node, whether a leaf or an inner node */
+#define SP_ART_TYPE(NODE) (*(const unsigned char*)(NODE))
+
+/* Addresses of the value and of the key stored in an adaptive radix tree leaf */
+#define SP_ART_VAL(ART, LEAF) ((char*)(LEAF) + (ART)->val_offset)
+#define SP_ART_KEY(ART, LEAF) ((unsigned char*)(LEAF) + (ART)->val_offset + (ART)->val_size)
+
+/* Encodes KEY of primitive type TYPE into BUF, an array of sizeof(TYPE) + 1
+ * unsigned chars, and stores the length of the encoding in LEN. Encodings
+ * compare byte by byte like the keys do, which orders the keys of the art
+ * module, and do not depend on the byte order of the machine, which keeps the
+ * hashes of the bloom module portable: integers are stored in big-endian
+ * order, with the sign bit flipped if they are signed, and floating-point
+ * numbers follow a byte which is 0 if they are negative, in which case all of
+ * their bits are flipped. Comparisons are made against z_ rather than the
+ * constant 0, which compilers would flag for unsigned types. */
+#define SP_KEY_ENCODE(TYPE, KEY, BUF, LEN) do { \
+	const unsigned int one_ = 1; \
+	const int little_ = *(const unsigned char*)&one_ == 1; \
+	const int float_ = (TYPE)0.5 != (TYPE)0 && (TYPE)0.5 != (TYPE)1; \
+	TYPE k_, z_; \
+	size_t i_; \
+	memset(&k_, 0, sizeof(k_)); \
+	k_ = (KEY); \
+	z_ = 0; \
+	(LEN) = 0; \
+	if (float_) { \
+		if (k_ == z_) \
+			k_ = 0; \
+		(BUF)[(LEN)++] = !(k_ < z_); \
+	} \
+	for (i_ = 0; i_ < sizeof(k_); i_++) \
+		(BUF)[(LEN) + i_] = ((const unsigned char*)&k_)[little_ ? sizeof(k_) - 1 - i_ : i_]; \
+	if (float_) { \
+		if (k_ < z_) \
+			for (i_ = 0; i_ < sizeof(k_); i_++) \
+				(BUF)[(LEN) + i_] = (unsigned char)~(BUF)[(LEN) + i_]; \
+	} else if ((TYPE)-1 < (TYPE)1) { \
+		(BUF)[(LEN)] ^= 0x80; \
+	} \
+	(LEN) += sizeof(k_); \
+} while (0)
+
+/* Final mixing step of the 32-bit MurmurHash3, on the low 32 bits of an
+ * unsigned long, which hashes elements of the bloom module alike on all
+ * machines */
+#define SP_BLOOM_MIX(H) do { \
+	(H) &= 0xFFFFFFFFUL; \
+	(H) ^= (H) >> 16; \
+	(H) = (H) * 0x85EBCA6BUL & 0xFFFFFFFFUL; \
+	(H) ^= (H) >> 13; \
+	(H) = (H) * 0xC2B2AE35UL & 0xFFFFFFFFUL; \
+	(H) ^= (H) >> 16; \
+} while (0)
+
+/* Address of the I-th element stored in a node of an unrolled list */
+#define SP_ULIST_ELEM(ULIST, NODE, I) \
+	((char*)(NODE) + (ULIST)->data_offset + (I) * (ULIST)->elem_size)
+
+/* Address of the element at (K, I, J) of a matrix */
+#define SP_MATRIX_ELEM(MATRIX, K, I, J) \
+	((char*)(MATRIX)->data + ((K) * (MATRIX)->pstride + (I) * (MATRIX)->rstride + (J) * (MATRIX)->cstride) * (MATRIX)->elem_size)
+
+/* Whether consecutive elements of every row are adjacent in memory */
+#define SP_MATRIX_UNIT_ROWS(MATRIX) \
+	((MATRIX)->cols == 1 || (MATRIX)->cstride == 1)
+
+/* Whether all elements are adjacent in memory, in row-major order. Strides
+ * along dimensions of length 1 never take part in addressing, and so can be
+ * anything. */
+#define SP_MATRIX_PACKED(MATRIX) \
+	(SP_MATRIX_UNIT_ROWS(MATRIX) \
+	 && ((MATRIX)->rows  == 1 || (MATRIX)->rstride == (MATRIX)->cols) \
+	 && ((MATRIX)->depth == 1 || (MATRIX)->pstride == (MATRIX)->rows * (MATRIX)->cols))
+
+/* Whether two matrices have equal dimensions */
+#define SP_MATRIX_SAME_SHAPE(A, B) \
+	((A)->depth == (B)->depth && (A)->rows == (B)->rows && (A)->cols == (B)->cols)
+
+/* Tile sizes (in elements) of the cache-blocked matrix kernels. Transposition
+ * moves square tiles of SP_MATRIX_BLOCK, multiplication streams panels of
+ * SP_MATRIX_TILE_K rows by SP_MATRIX_TILE_J columns of the right operand */
+#define SP_MATRIX_BLOCK  32
+#define SP_MATRIX_TILE_K 128
+#define SP_MATRIX_TILE_J 256
+
+/* Number of rows (CSR) or columns (CSC) indexed by a sparse matrix */
+#define SP_SPARSE_NMAJOR(SPARSE) \
+	((SPARSE)->format == SP_SPARSE_CSR ? (SPARSE)->rows : (SPARSE)->cols)
+
+/* Priority queues are implicit d-ary heaps: the children of the element at I
+ * are at (I * ARITY + 1) up to (I * ARITY + ARITY), and its parent is at
+ * ((I - 1) / ARITY). SP_PQUEUE_BEFORE tells whether the element at A should be
+ * popped before the one at B, according to the comparison function. */
+#define SP_PQUEUE_ELEM(PQ, I) ((char*)(PQ)->data + (I) * (PQ)->elem_size)
+#define SP_PQUEUE_BEFORE(PQ, A, B) \
+	(((PQ)->order == SP_PQUEUE_MIN ? (PQ)->cmp((A), (B)) : (PQ)->cmp((B), (A))) < 0)
+
+/* Typed heap operations for the suffixed functions, which compare elements
+ * with BEFORE (SP_PQUEUE_LT or SP_PQUEUE_GT) instead of calling a function.
+ * Both move a hole instead of swapping, so every step is a single copy. */
+#define SP_PQUEUE_LT(A, B) ((A) < (B))
+#define SP_PQUEUE_GT(A, B) ((A) > (B))
+#define SP_PQUEUE_SIFTUP(TYPE, DATA, IDX, ARITY, BEFORE) do { \
+	TYPE *const d_ = (DATA); \
+	const size_t a_ = (ARITY); \
+	size_t i_ = (IDX); \
+	const TYPE x_ = d_[i_]; \
+	while (i_ > 0) { \
+		const size_t p_ = (i_ - 1) / a_; \
+		if (!BEFORE(x_, d_[p_])) \
+			break; \
+		d_[i_] = d_[p_]; \
+		i_ = p_; \
+	} \
+	d_[i_] = x_; \
+} while (0)
+#define SP_PQUEUE_SIFTDOWN(TYPE, DATA, SIZE, IDX, ARITY, BEFORE) do { \
+	TYPE *const d_ = (DATA); \
+	const size_t n_ = (SIZE), a_ = (ARITY); \
+	size_t i_ = (IDX); \
+	const TYPE x_ = d_[i_]; \
+	while (n_ >= 2 && i_ <= (n_ - 2) / a_) { \
+		size_t c_ = i_ * a_ + 1, b_ = c_; \
+		const size_t e_ = n_ - c_ > a_ ? c_ + a_ : n_; \
+		for (++c_; c_ < e_; c_++) \
+			if (BEFORE(d_[c_], d_[b_])) \
+				b_ = c_; \
+		if (!BEFORE(d_[b_], x_)) \
+			break; \
+		d_[i_] = d_[b_]; \
+		i_ = b_; \
+	} \
+	d_[i_] = x_; \
+} while (0)
+#define SP_PQUEUE_HEAPIFY(TYPE, DATA, SIZE, ARITY, BEFORE) do { \
+	const size_t hn_ = (SIZE); \
+	size_t hi_; \
+	if (hn_ >= 2) \
+		for (hi_ = (hn_ - 2) / (ARITY) + 1; hi_-- > 0;) \
+			SP_PQUEUE_SIFTDOWN(TYPE, DATA, hn_, hi_, ARITY, BEFORE); \
+} while (0)
+
+/* Indexed priority queues keep every element in place, at the slot of its
+ * handle, and build the heap out of handles instead. pos maps every handle
+ * back to its index in heap, so that it can be found without searching.
+ * heap[size] up to heap[count - 1] hold the handles which are free for reuse,
+ * which is how SP_IPQUEUE_LIVE tells them apart. */
+#define SP_IPQUEUE_ELEM(IPQ, H) ((char*)(IPQ)->data + (H) * (IPQ)->elem_size)
+#define SP_IPQUEUE_LIVE(IPQ, H) ((H) < (IPQ)->count && (IPQ)->pos[H] < (IPQ)->size)
+
+/* Typed counterparts of sp_ipqueue_siftup and sp_ipqueue_siftdown, see
+ * SP_PQUEUE_SIFTUP. Only handles are moved, and the key is read once. */
+#define SP_IPQUEUE_SIFTUP(TYPE, IPQ, IDX, BEFORE) do { \
+	const TYPE *const d_ = (IPQ)->data; \
+	size_t *const h_ = (IPQ)->heap, *const p_ = (IPQ)->pos; \
+	const size_t a_ = (IPQ)->arity; \
+	size_t i_ = (IDX); \
+	const size_t x_ = h_[i_]; \
+	const TYPE k_ = d_[x_]; \
+	while (i_ > 0) { \
+		const size_t u_ = (i_ - 1) / a_; \
+		if (!BEFORE(k_, d_[h_[u_]])) \
+			break; \
+		h_[i_] = h_[u_]; \
+		p_[h_[i_]] = i_; \
+		i_ = u_; \
+	} \
+	h_[i_] = x_; \
+	p_[x_] = i_; \
+} while (0)
+#define SP_IPQUEUE_SIFTDOWN(TYPE, IPQ, IDX, BEFORE) do { \
+	const TYPE *const d_ = (IPQ)->data; \
+	size_t *const h_ = (IPQ)->heap, *const p_ = (IPQ)->pos; \
+	const size_t n_ = (IPQ)->size, a_ = (IPQ)->arity; \
+	size_t i_ = (IDX); \
+	const size_t x_ = h_[i_]; \
+	const TYPE k_ = d_[x_]; \
+	while (n_ >= 2 && i_ <= (n_ - 2) / a_) { \
+		size_t c_ = i_ * a_ + 1, b_ = c_; \
+		const size_t e_ = n_ - c_ > a_ ? c_ + a_ : n_; \
+		for (++c_; c_ < e_; c_++) \
+			if (BEFORE(d_[h_[c_]], d_[h_[b_]])) \
+				b_ = c_; \
+		if (!BEFORE(d_[h_[b_]], k_)) \
+			break; \
+		h_[i_] = h_[b_]; \
+		p_[h_[i_]] = i_; \
+		i_ = b_; \
+	} \
+	h_[i_] = x_; \
+	p_[x_] = i_; \
+} while (0)
+
+/* Slot maps keep elements packed at the front of data, and owner maps every
+ * element back to its slot. A slot holds the position of its element while
+ * it is live, and the next free slot otherwise. Live slots have odd
+ * generations, so that no handle matches a free slot. */
+#define SP_SLOTMAP_ELEM(SM, I) ((char*)(SM)->data + (I) * (SM)->elem_size)
+#define SP_SLOTMAP_LIVE(SM, H) ((H).idx < (SM)->count && ((H).gen & 1) \
+		&& (SM)->slots[(H).idx].gen == (H).gen)
+
+/* Fenwick trees are 1-based in these macros, node i covering the
+ * SP_FENWICK_LOWBIT(i) elements up to and including i - 1 */
+#define SP_FENWICK_LOWBIT(I) ((I) & (~(I) + 1))
+
+/* Segment trees keep 2 * cap nodes of SP_SEGTREE_FIELDS values, where node k
+ * has children 2k and 2k + 1 and the leaves start at cap. A node holds the
+ * sum, minimum and maximum of its leaves, and nodes above the leaves also the
+ * addition or assignment owed to their children, which lazy tells apart.
+ * Leaves past size are padding, which has no minimum nor maximum, so a node
+ * at height H is only ever updated or combined by its count of real leaves.
+ * The pending updates on the way from a leaf to the root are newer the
+ * higher they are. */
+#define SP_SEGTREE_FIELDS 5
+#define SP_SEGTREE_SUM    0
+#define SP_SEGTREE_MIN    1
+#define SP_SEGTREE_MAX    2
+#define SP_SEGTREE_DELTA  3
+#define SP_SEGTREE_VALUE  4
+#define SP_SEGTREE_ADD    1
+#define SP_SEGTREE_SET    2
+#define SP_SEGTREE_NODE(TYPE, TREE, K) ((TYPE*)(TREE)->data + (K) * SP_SEGTREE_FIELDS)
+#define SP_SEGTREE_COUNT(TREE, K, H) \
+	(((K) << (H)) - (TREE)->cap >= (TREE)->size ? 0 \
+	 : MIN((TREE)->size - (((K) << (H)) - (TREE)->cap), (size_t)1 << (H)))
+
+#define SP_SEGTREE_APPLY(TYPE, TREE, K, H, OP, V) do { \
+	const size_t ak_ = (K), ac_ = SP_SEGTREE_COUNT(TREE, ak_, H); \
+	TYPE *const an_ = SP_SEGTREE_NODE(TYPE, TREE, ak_); \
+	const TYPE av_ = (V); \
+	if (ac_ == 0) \
+		break; \
+	if ((OP) == SP_SEGTREE_SET) { \
+		an_[SP_SEGTREE_SUM] = 0; \
+		an_[SP_SEGTREE_SUM] += av_ * (TYPE)ac_; \
+		an_[SP_SEGTREE_MIN] = an_[SP_SEGTREE_MAX] = av_; \
+		if (ak_ < (TREE)->cap) { \
+			an_[SP_SEGTREE_VALUE] = av_; \
+			(TREE)->lazy[ak_] = SP_SEGTREE_SET; \
+		} \
+		break; \
+	} \
+	an_[SP_SEGTREE_SUM] += av_ * (TYPE)ac_; \
+	an_[SP_SEGTREE_MIN] += av_; \
+	an_[SP_SEGTREE_MAX] += av_; \
+	if (ak_ >= (TREE)->cap) \
+		break; \
+	if ((TREE)->lazy[ak_] == SP_SEGTREE_SET) { \
+		an_[SP_SEGTREE_VALUE] += av_; \
+	} else if ((TREE)->lazy[ak_] == SP_SEGTREE_ADD) { \
+		an_[SP_SEGTREE_DELTA] += av_; \
+	} else { \
+		an_[SP_SEGTREE_DELTA] = av_; \
+		(TREE)->lazy[ak_] = SP_SEGTREE_ADD; \
+	} \
+} while (0)
+
+#define SP_SEGTREE_PUSH(TYPE, TREE, K, H) do { \
+	const size_t pk_ = (K); \
+	const int pl_ = (TREE)->lazy[pk_]; \
+	if (pl_ != 0) { \
+		const TYPE pv_ = SP_SEGTREE_NODE(TYPE, TREE, pk_)[pl_ == SP_SEGTREE_SET \
+				? SP_SEGTREE_VALUE : SP_SEGTREE_DELTA]; \
+		SP_SEGTREE_APPLY(TYPE, TREE, 2 * pk_, (H) - 1, pl_, pv_); \
+		SP_SEGTREE_APPLY(TYPE, TREE, 2 * pk_ + 1, (H) - 1, pl_, pv_); \
+		(TREE)->lazy[pk_] = 0; \
+	} \
+} while (0)
+
+#define SP_SEGTREE_PULL(TYPE, TREE, K, H) do { \
+	const size_t uk_ = (K); \
+	TYPE *const un_ = SP_SEGTREE_NODE(TYPE, TREE, uk_); \
+	const TYPE *const ul_ = SP_SEGTREE_NODE(TYPE, TREE, 2 * uk_); \
+	const TYPE *const ur_ = ul_ + SP_SEGTREE_FIELDS; \
+	un_[SP_SEGTREE_SUM] = ul_[SP_SEGTREE_SUM] + ur_[SP_SEGTREE_SUM]; \
+	un_[SP_SEGTREE_MIN] = ul_[SP_SEGTREE_MIN]; \
+	un_[SP_SEGTREE_MAX] = ul_[SP_SEGTREE_MAX]; \
+	if (SP_SEGTREE_COUNT(TREE, 2 * uk_ + 1, (H) - 1) != 0) { \
+		if (ur_[SP_SEGTREE_MIN] < un_[SP_SEGTREE_MIN]) \
+			un_[SP_SEGTREE_MIN] = ur_[SP_SEGTREE_MIN]; \
+		if (ur_[SP_SEGTREE_MAX] > un_[SP_SEGTREE_MAX]) \
+			un_[SP_SEGTREE_MAX] = ur_[SP_SEGTREE_MAX]; \
+	} \
+} while (0)
+
+/* Pushes the pending updates down to the nodes which make up the leaves
+ * [L, R), so that their values are current */
+#define SP_SEGTREE_PUSH_RANGE(TYPE, TREE, L, R) do { \
+	size_t h_; \
+	for (h_ = (TREE)->height; h_ >= 1; h_--) { \
+		if ((((L) >> h_) << h_) != (L)) \
+			SP_SEGTREE_PUSH(TYPE, TREE, (L) >> h_, h_); \
+		if ((((R) >> h_) << h_) != (R)) \
+			SP_SEGTREE_PUSH(TYPE, TREE, ((R) - 1) >> h_, h_); \
+	} \
+} while (0)
+
+/* Applies OP with V to the elements [IDX, IDX + N), see SP_SEGTREE_APPLY */
+#define SP_SEGTREE_UPDATE(TYPE, TREE, IDX, N, OP, V) do { \
+	const size_t l0_ = (IDX) + (TREE)->cap, r0_ = l0_ + (N); \
+	size_t l_ = l0_, r_ = r0_, i_, lv_; \
+	SP_SEGTREE_PUSH_RANGE(TYPE, TREE, l0_, r0_); \
+	for (lv_ = 0; l_ < r_; lv_++, l_ >>= 1, r_ >>= 1) { \
+		if (l_ & 1) { \
+			SP_SEGTREE_APPLY(TYPE, TREE, l_, lv_, OP, V); \
+			l_++; \
+		} \
+		if (r_ & 1) { \
+			r_--; \
+			SP_SEGTREE_APPLY(TYPE, TREE, r_, lv_, OP, V); \
+		} \
+	} \
+	for (i_ = 1; i_ <= (TREE)->height; i_++) { \
+		if (((l0_ >> i_) << i_) != l0_) \
+			SP_SEGTREE_PULL(TYPE, TREE, l0_ >> i_, i_); \
+		if (((r0_ >> i_) << i_) != r0_) \
+			SP_SEGTREE_PULL(TYPE, TREE, (r0_ - 1) >> i_, i_); \
+	} \
+} while (0)
+
+/* Folds FIELD of the elements [IDX, IDX + N) into RET, which N must not be 0
+ * for unless FIELD is SP_SEGTREE_SUM */
+#define SP_SEGTREE_QUERY(TYPE, TREE, IDX, N, FIELD, RET) do { \
+	size_t l_ = (IDX) + (TREE)->cap, r_ = l_ + (N); \
+	int first_ = 1; \
+	SP_SEGTREE_PUSH_RANGE(TYPE, TREE, l_, r_); \
+	(RET) = 0; \
+	for (; l_ < r_; l_ >>= 1, r_ >>= 1) { \
+		size_t k_[2], j_, m_ = 0; \
+		if (l_ & 1) \
+			k_[m_++] = l_++; \
+		if (r_ & 1) \
+			k_[m_++] = --r_; \
+		for (j_ = 0; j_ < m_; j_++) { \
+			const TYPE v_ = SP_SEGTREE_NODE(TYPE, TREE, k_[j_])[FIELD]; \
+			if (first_ || ((FIELD) == SP_SEGTREE_SUM ? 0 \
+					: (FIELD) == SP_SEGTREE_MIN ? v_ < (RET) : v_ > (RET))) \
+				(RET) = v_; \
+			else if ((FIELD) == SP_SEGTREE_SUM) \
+				(RET) += v_; \
+			first_ = 0; \
+		} \
+	} \
+} while (0)
+
+/* LRU caches keep a copy of every key next to its value, so that evicted
+ * entries can be found in the index. Entries are linked from the most to the
+ * least recently used, unused entries are linked through next from free, and
+ * capacity stands for no entry. */
+#define SP_LRU_KEY(LRU, I) ((char*)(LRU)->keys + (I) * (LRU)->key_size)
+#define SP_LRU_VAL(LRU, I) ((char*)(LRU)->vals + (I) * (LRU)->val_size)
+
+/* Timer wheels link every pending timer into the slot of its expiry. Nodes are
+ * blocks of the wheel's pool, whose free list link only overwrites link.prev.
+ * A timer is pending exactly while its node has an odd generation, so that no
+ * handle matches a free node. */
+#define SP_WHEEL_DATA(WHEEL, NODE) ((char*)(NODE) + (WHEEL)->data_offset)
+#define SP_WHEEL_PENDING(H) ((H).node != NULL && ((H).gen & 1) && (H).node->gen == (H).gen)
+#define SP_WHEEL_UNLINK(LINK) do { \
+	(LINK)->prev->next = (LINK)->next; \
+	(LINK)->next->prev = (LINK)->prev; \
+} while (0)
+
+/* Object pools carve blocks out of their slabs in order. used counts the
+ * slabs carving has reached, and left the blocks yet to be carved out of the
+ * last of them. Free blocks are linked through their first bytes, and tail is
+ * the last of them, so that two free lists can be joined in constant time. It
+ * is only meaningful while free is not NULL. */
+#define SP_POOL_CARVE(POOL) \
+	((void*)((POOL)->slabs[(POOL)->used - 1].data + ((POOL)->slabs[(POOL)->used - 1].size - (POOL)->left--) * (POOL)->stride))
+
 /* These macros are only used for printf format strings and casts */
 #if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
 #define SP_SIZE_FMT "%zu"
@@ -86,9 +702,131 @@ int sp_foomap(void *buf, size_t size, size_t elem_size, int (*foo)(void*));
 int sp_size_try_add(size_t size, size_t amount);
 void  sp_ringbuf_incr(void **ptr, void *buf, size_t capacity, size_t elem_size);
 void  sp_ringbuf_decr(void **ptr, void *buf, size_t capacity, size_t elem_size);
+void  sp_ringbuf_shl(void *buf, size_t capacity, size_t elem_size, size_t start, size_t n);
+void  sp_ringbuf_shr(void *buf, size_t capacity, size_t elem_size, size_t start, size_t n);
+void  sp_ringbuf_move(void *buf, size_t capacity, size_t elem_size, size_t to, size_t from, size_t n);
 void *sp_ringbuf_get(size_t idx, const void *buf, size_t capacity, size_t elem_size, const void *head);
 void  sp_ringbuf_insert(const void *elem, size_t idx, void *buf, size_t *size, size_t capacity, size_t elem_size, void **head, void **tail);
 void  sp_ringbuf_remove(size_t idx, void *buf, size_t *size, size_t capacity, size_t elem_size, void **head, void **tail);
+int   sp_blockbuf_fit(void ***blocks, size_t *nblocks, size_t *head, size_t size, size_t block_size, size_t elem_size, int front);
+void *sp_blockbuf_get(size_t idx, void *const *blocks, size_t head, size_t block_size, size_t elem_size);
+void  sp_blockbuf_shl(void *const *blocks, size_t block_size, size_t elem_size, size_t start, size_t n);
+void  sp_blockbuf_shr(void *const *blocks, size_t block_size, size_t elem_size, size_t start, size_t n);
+void  sp_blockbuf_insert(const void *elem, size_t idx, void *const *blocks, size_t *head, size_t *size, size_t block_size, size_t elem_size);
+void  sp_blockbuf_remove(size_t idx, void *const *blocks, size_t *head, size_t *size, size_t block_size, size_t elem_size);
+int   sp_bitbuf_fit(unsigned long **buf, size_t *capacity, size_t size);
+size_t sp_popcount(unsigned long x);
+size_t sp_ctz(unsigned long x);
+struct sp_hashmap;
+size_t sp_hash(const void *data, size_t size);
+size_t sp_hashtab_find(const struct sp_hashmap *map, const void *key, size_t hash);
+size_t sp_hashtab_slot(const struct sp_hashmap *map, size_t hash);
+int    sp_hashtab_claim(struct sp_hashmap *map, size_t hash, size_t *idx);
+void   sp_hashtab_erase(struct sp_hashmap *map, size_t idx);
+int    sp_hashtab_fit(struct sp_hashmap *map, size_t n);
+int    sp_hashtab_rehash(struct sp_hashmap *map, size_t capacity);
+void   sp_hashtab_reinsert(struct sp_hashmap *dest, const struct sp_hashmap *src);
+struct sp_chashmap_shard;
+int    sp_chashtab_reserve(struct sp_chashmap_shard *shard, size_t hash);
+void   sp_chashtab_reclaim(struct sp_chashmap_shard *shard);
+struct sp_intern;
+size_t sp_intern_hash(const void *key);
+int    sp_intern_cmp(const void *key1, const void *key2);
+int    sp_intern_grow(struct sp_intern *pool, size_t n);
+struct sp_list;
+struct sp_list_node;
+void   sp_list_link(struct sp_list *list, struct sp_list_node *pos, struct sp_list_node *first, struct sp_list_node *last);
+void   sp_list_unlink(struct sp_list *list, struct sp_list_node *first, struct sp_list_node *last);
+struct sp_ulist;
+struct sp_ulist_node;
+struct sp_ulist_node *sp_ulist_alloc(struct sp_ulist *ulist);
+void   sp_ulist_release(struct sp_ulist *ulist, struct sp_ulist_node *node);
+struct sp_ulist_node *sp_ulist_seek(struct sp_ulist *ulist, size_t *idx);
+void  *sp_ulist_slot(struct sp_ulist *ulist, size_t idx);
+void   sp_ulist_erase(struct sp_ulist *ulist, struct sp_ulist_node *node, size_t idx, size_t start);
+struct sp_sparse_coo;
+struct sp_sparse;
+int    sp_sparse_coo_fit(struct sp_sparse_coo *coo);
+struct sp_sparse *sp_sparse_compress(const struct sp_sparse_coo *coo, int format);
+struct sp_pqueue;
+void   sp_pqueue_siftup(struct sp_pqueue *pq, size_t idx);
+void   sp_pqueue_siftdown(struct sp_pqueue *pq, size_t idx);
+void   sp_pqueue_heapify_all(struct sp_pqueue *pq);
+int    sp_pqueue_reserve(struct sp_pqueue *pq, size_t n);
+void   sp_memswap(void *a, void *b, size_t n);
+struct sp_ipqueue;
+void   sp_ipqueue_siftup(struct sp_ipqueue *ipq, size_t idx);
+void   sp_ipqueue_siftdown(struct sp_ipqueue *ipq, size_t idx);
+size_t sp_ipqueue_detach(struct sp_ipqueue *ipq, size_t idx);
+int    sp_ipqueue_reserve(struct sp_ipqueue *ipq);
+struct sp_avl;
+struct sp_avl_node;
+void   sp_avl_link(struct sp_avl *avl, struct sp_avl_node *parent, struct sp_avl_node **link, struct sp_avl_node *node);
+void   sp_avl_unlink(struct sp_avl *avl, struct sp_avl_node *node);
+struct sp_avl_node *sp_avl_rotate(struct sp_avl_node *node, int right);
+void   sp_avl_fixup(struct sp_avl *avl, struct sp_avl_node *node);
+struct sp_avl_node *sp_avl_build_range(struct sp_avl *avl, const char *keys, const char *vals, size_t n, struct sp_avl_node *parent);
+struct sp_rbtree;
+struct sp_rbnode;
+void   sp_rbtree_rotate(struct sp_rbtree *tree, struct sp_rbnode *node, int right);
+void   sp_rbtree_link(struct sp_rbtree *tree, struct sp_rbnode *parent, struct sp_rbnode **link, struct sp_rbnode *node);
+void   sp_rbtree_unlink(struct sp_rbtree *tree, struct sp_rbnode *node);
+struct sp_bptree;
+struct sp_bptree_node;
+size_t sp_bptree_rank(const struct sp_bptree *tree, const struct sp_bptree_node *node, const void *key, int upper);
+void   sp_bptree_split(char *src, char *dst, size_t n, size_t left, size_t pos, const void *item, size_t size);
+int    sp_bptree_insert_at(struct sp_bptree *tree, struct sp_bptree_node **path, const size_t *slot, const void *key, const void *val);
+int    sp_bptree_rebalance(struct sp_bptree *tree, struct sp_bptree_node *parent, size_t idx, int leaf);
+void   sp_bptree_erase_at(struct sp_bptree *tree, struct sp_bptree_node **path, const size_t *slot);
+int    sp_bptree_bulkload(struct sp_bptree *tree, const char *keys, const char *vals, size_t n);
+void   sp_bptree_free(struct sp_bptree *tree, struct sp_bptree_node *node, size_t height);
+struct sp_art;
+struct sp_art_node;
+struct sp_art_leaf;
+struct sp_art_leaf *sp_art_newleaf(const struct sp_art *art, const void *key, size_t len, const void *val);
+void  *sp_art_newnode(int type);
+void **sp_art_child(const struct sp_art_node *node, unsigned char c);
+int    sp_art_addchild(void **ref, unsigned char c, void *child);
+void   sp_art_delchild(void **ref, unsigned char c);
+void   sp_art_shrink(void **ref);
+void  *sp_art_next(const struct sp_art_node *node, size_t *pos);
+size_t sp_art_mismatch(const struct sp_art *art, const struct sp_art_node *node, const unsigned char *key, size_t len, size_t depth);
+struct sp_art_leaf *sp_art_minleaf(const void *node);
+int    sp_art_walk(const struct sp_art *art, const void *node, int (*func)(const void*, size_t, void*), size_t *idx);
+int    sp_art_dtor(const struct sp_art *art, const void *node, int (*dtor)(void*));
+void   sp_art_free(void *node);
+struct sp_bloom;
+unsigned long    sp_bloom_hash(const void *data, size_t len);
+int              sp_bloom_probe(const struct sp_bloom *bloom, const void *data, size_t len, int set);
+struct sp_bloom *sp_bloom_alloc(size_t nbits, size_t nhashes, int blocked);
+size_t           sp_bloom_estimate(const struct sp_bloom *bloom);
+double           sp_log(double x);
+struct sp_slotmap;
+struct sp_slotmap_handle;
+int    sp_slotmap_reserve(struct sp_slotmap *sm);
+int    sp_slotmap_acquire(struct sp_slotmap *sm, struct sp_slotmap_handle *handle);
+void   sp_slotmap_release(struct sp_slotmap *sm, size_t pos);
+struct sp_lru;
+void   sp_lru_reset(struct sp_lru *lru);
+void   sp_lru_link(struct sp_lru *lru, size_t idx);
+void   sp_lru_unlink(struct sp_lru *lru, size_t idx);
+void   sp_lru_drop(struct sp_lru *lru, size_t idx, size_t slot);
+int    sp_lru_evict(struct sp_lru *lru);
+struct sp_wheel;
+struct sp_wheel_node;
+struct sp_wheel_handle;
+void   sp_wheel_arm(struct sp_wheel *wheel, struct sp_wheel_node *node, unsigned long delay, struct sp_wheel_handle *handle);
+void   sp_wheel_place(struct sp_wheel *wheel, struct sp_wheel_node *node);
+void   sp_wheel_release(struct sp_wheel *wheel, struct sp_wheel_node *node);
+void   sp_wheel_cascade(struct sp_wheel *wheel, int level);
+struct sp_pool;
+int    sp_pool_init(struct sp_pool *pool, size_t block_size, size_t capacity, int (*ctor)(void*), int (*dtor)(void*));
+void   sp_pool_fini(struct sp_pool *pool);
+int    sp_pool_grow(struct sp_pool *pool, size_t n);
+int    sp_pool_take(struct sp_pool *pool, void **block);
+void   sp_pool_give(struct sp_pool *pool, void *block);
+int    sp_pool_merge(struct sp_pool *dest, struct sp_pool *src);
+
 size_t sp_strnlen(const char *s, size_t maxlen);
 
 #endif /* STAPLE_INTERNAL_H */
@@ -0,0 +1,88 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+#include <string.h>
+
+/* Adds a child for the byte c to the inner node pointed to by *ref, which is
+ * replaced by a node of the next larger type if it is full. Returns 1 on
+ * allocation failure, leaving the node unchanged, and 0 otherwise. */
+int sp_art_addchild(void **ref, unsigned char c, void *child)
+{
+	struct sp_art_node *const node = *ref, *grown;
+	size_t i, pos;
+
+	if (node->type == SP_ART_NODE4 || node->type == SP_ART_NODE16) {
+		const size_t cap = node->type == SP_ART_NODE4 ? 4 : 16;
+		unsigned char *const keys = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->keys : ((struct sp_art_node16*)node)->keys;
+		void **const children = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->children : ((struct sp_art_node16*)node)->children;
+		if (node->count < cap) {
+			for (pos = 0; pos < node->count && keys[pos] < c; pos++)
+				;
+			memmove(keys + pos + 1, keys + pos, node->count - pos);
+			memmove(children + pos + 1, children + pos, (node->count - pos) * sizeof(*children));
+			keys[pos]     = c;
+			children[pos] = child;
+			++node->count;
+			return 0;
+		}
+		if ((grown = sp_art_newnode(node->type + 1)) == NULL)
+			return 1;
+		memcpy(grown, node, sizeof(*node));
+		grown->type = node->type + 1;
+		if (node->type == SP_ART_NODE4) {
+			struct sp_art_node16 *const n = (struct sp_art_node16*)grown;
+			memcpy(n->keys, keys, 4);
+			memcpy(n->children, children, 4 * sizeof(*children));
+		} else {
+			struct sp_art_node48 *const n = (struct sp_art_node48*)grown;
+			for (i = 0; i < 16; i++) {
+				n->index[keys[i]] = i + 1;
+				n->children[i]    = children[i];
+			}
+		}
+	} else if (node->type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)node;
+		if (node->count < 48) {
+			for (i = 0; n->children[i] != NULL; i++)
+				;
+			n->children[i] = child;
+			n->index[c]    = i + 1;
+			++node->count;
+			return 0;
+		}
+		if ((grown = sp_art_newnode(SP_ART_NODE256)) == NULL)
+			return 1;
+		memcpy(grown, node, sizeof(*node));
+		grown->type = SP_ART_NODE256;
+		for (i = 0; i < 256; i++)
+			if (n->index[i] != 0)
+				((struct sp_art_node256*)grown)->children[i] = n->children[n->index[i] - 1];
+	} else {
+		((struct sp_art_node256*)node)->children[c] = child;
+		++node->count;
+		return 0;
+	}
+
+	free(node);
+	*ref = grown;
+	return sp_art_addchild(ref, c, child);
+}
@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+
+/* Looks up the child of an inner node of an adaptive radix tree for the byte
+ * c, returning the address of the pointer to it, or NULL if there is none */
+void **sp_art_child(const struct sp_art_node *node, unsigned char c)
+{
+	size_t i, pos;
+	if (node->type == SP_ART_NODE4) {
+		struct sp_art_node4 *const n = (struct sp_art_node4*)node;
+		for (i = 0; i < node->count; i++)
+			if (n->keys[i] == c)
+				return &n->children[i];
+		return NULL;
+	}
+	if (node->type == SP_ART_NODE16) {
+		/* The keys are sorted, so that the position of c is the number of
+		 * keys below it, counted without branches over all 16 slots, in a
+		 * loop which compilers turn into SIMD instructions */
+		struct sp_art_node16 *const n = (struct sp_art_node16*)node;
+		for (i = 0, pos = 0; i < 16; i++)
+			pos += (n->keys[i] < c) & (i < node->count);
+		return pos < node->count && n->keys[pos] == c ? &n->children[pos] : NULL;
+	}
+	if (node->type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)node;
+		return n->index[c] != 0 ? &n->children[n->index[c] - 1] : NULL;
+	} else {
+		struct sp_art_node256 *const n = (struct sp_art_node256*)node;
+		return n->children[c] != NULL ? &n->children[c] : NULL;
+	}
+}
@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+#include <string.h>
+
+/* Removes the child for the byte c from the inner node pointed to by *ref,
+ * which is then shrunk if needed */
+void sp_art_delchild(void **ref, unsigned char c)
+{
+	struct sp_art_node *const node = *ref;
+	size_t i;
+
+	if (node->type == SP_ART_NODE4 || node->type == SP_ART_NODE16) {
+		unsigned char *const keys = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->keys : ((struct sp_art_node16*)node)->keys;
+		void **const children = node->type == SP_ART_NODE4 ?
+			((struct sp_art_node4*)node)->children : ((struct sp_art_node16*)node)->children;
+		for (i = 0; keys[i] != c; i++)
+			;
+		memmove(keys + i, keys + i + 1, node->count - i - 1);
+		memmove(children + i, children + i + 1, (node->count - i - 1) * sizeof(*children));
+	} else if (node->type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)node;
+		n->children[n->index[c] - 1] = NULL;
+		n->index[c] = 0;
+	} else {
+		((struct sp_art_node256*)node)->children[c] = NULL;
+	}
+	--node->count;
+	sp_art_shrink(ref);
+}
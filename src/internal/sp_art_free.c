@@ -0,0 +1,34 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+
+/* Frees a subtree of an adaptive radix tree */
+void sp_art_free(void *node)
+{
+	struct sp_art_node *const n = node;
+	void *child;
+	size_t pos = 0;
+	if (SP_ART_TYPE(node) != SP_ART_LEAF) {
+		free(n->term);
+		while ((child = sp_art_next(n, &pos)) != NULL)
+			sp_art_free(child);
+	}
+	free(node);
+}
@@ -0,0 +1,35 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+
+/* Returns the leaf with the smallest key under a node of an adaptive radix
+ * tree. A terminal leaf is a prefix of all other keys below its node. */
+struct sp_art_leaf *sp_art_minleaf(const void *node)
+{
+	size_t pos;
+	while (SP_ART_TYPE(node) != SP_ART_LEAF) {
+		const struct sp_art_node *const n = node;
+		if (n->term != NULL)
+			return n->term;
+		pos  = 0;
+		node = sp_art_next(n, &pos);
+	}
+	return (struct sp_art_leaf*)node;
+}
@@ -0,0 +1,40 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+
+/* Returns the number of bytes of the compressed path of an inner node, which
+ * starts at depth, that match a key of len bytes. Only the first SP_ART_PREFIX
+ * bytes of the path are stored in the node, and the rest is read from the key
+ * of any leaf below it. */
+size_t sp_art_mismatch(const struct sp_art *art, const struct sp_art_node *node, const unsigned char *key, size_t len, size_t depth)
+{
+	const size_t max = MIN(node->prefix_len, len - depth);
+	size_t i;
+	for (i = 0; i < max && i < SP_ART_PREFIX; i++)
+		if (node->prefix[i] != key[depth + i])
+			return i;
+	if (i < max) {
+		const unsigned char *const k = SP_ART_KEY(art, sp_art_minleaf(node));
+		for (; i < max; i++)
+			if (k[depth + i] != key[depth + i])
+				return i;
+	}
+	return max;
+}
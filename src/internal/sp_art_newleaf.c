@@ -0,0 +1,39 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+#include <string.h>
+
+/* Allocates an adaptive radix tree leaf holding copies of a key of len bytes
+ * and of its value */
+struct sp_art_leaf *sp_art_newleaf(const struct sp_art *art, const void *key, size_t len, const void *val)
+{
+	struct sp_art_leaf *ret;
+	if ((ret = malloc(art->val_offset + art->val_size + len)) == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	ret->type = SP_ART_LEAF;
+	ret->len  = len;
+	if (art->val_size != 0)
+		memcpy(SP_ART_VAL(art, ret), val, art->val_size);
+	if (len != 0)
+		memcpy(SP_ART_KEY(art, ret), key, len);
+	return ret;
+}
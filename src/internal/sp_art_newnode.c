@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+#include <string.h>
+
+/* Allocates an empty inner node of an adaptive radix tree */
+void *sp_art_newnode(int type)
+{
+	static const size_t sizes[] = {
+		0,
+		sizeof(struct sp_art_node4),
+		sizeof(struct sp_art_node16),
+		sizeof(struct sp_art_node48),
+		sizeof(struct sp_art_node256),
+	};
+	struct sp_art_node *ret;
+	size_t i;
+
+	if ((ret = malloc(sizes[type])) == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	ret->type       = type;
+	ret->count      = 0;
+	ret->prefix_len = 0;
+	ret->term       = NULL;
+	if (type == SP_ART_NODE48) {
+		struct sp_art_node48 *const n = (struct sp_art_node48*)ret;
+		memset(n->index, 0, sizeof(n->index));
+		for (i = 0; i < 48; i++)
+			n->children[i] = NULL;
+	} else if (type == SP_ART_NODE256) {
+		struct sp_art_node256 *const n = (struct sp_art_node256*)ret;
+		for (i = 0; i < 256; i++)
+			n->children[i] = NULL;
+	}
+	return ret;
+}
@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+
+/* Returns the first child of an inner node of an adaptive radix tree at or
+ * after position *pos, in ascending order of bytes, and moves *pos past it.
+ * Returns NULL if there are no more children. */
+void *sp_art_next(const struct sp_art_node *node, size_t *pos)
+{
+	if (node->type == SP_ART_NODE4 || node->type == SP_ART_NODE16) {
+		void *const *const children = node->type == SP_ART_NODE4 ?
+			((const struct sp_art_node4*)node)->children : ((const struct sp_art_node16*)node)->children;
+		return *pos < node->count ? children[(*pos)++] : NULL;
+	}
+	if (node->type == SP_ART_NODE48) {
+		const struct sp_art_node48 *const n = (const struct sp_art_node48*)node;
+		for (; *pos < 256; ++*pos)
+			if (n->index[*pos] != 0)
+				return n->children[n->index[(*pos)++] - 1];
+	} else {
+		const struct sp_art_node256 *const n = (const struct sp_art_node256*)node;
+		for (; *pos < 256; ++*pos)
+			if (n->children[*pos] != NULL)
+				return n->children[(*pos)++];
+	}
+	return NULL;
+}
@@ -0,0 +1,104 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+#include <string.h>
+
+/* Replaces the inner node pointed to by *ref, which has just lost a child or
+ * its terminal leaf, by its only remaining child or leaf, or by a node of a
+ * smaller type once few enough children are left. A node is only shrunk well
+ * below the capacity of the smaller type, so that alternating insertions and
+ * removals do not resize it every time. Shrinking is skipped if allocation
+ * fails, as the node stays valid. */
+void sp_art_shrink(void **ref)
+{
+	struct sp_art_node *const node = *ref;
+	struct sp_art_node *shrunk;
+	size_t i, j;
+
+	if (node->count + (node->term != NULL) == 1) {
+		void *child;
+		i = 0;
+		if (node->term != NULL) {
+			*ref = node->term;
+		} else if (SP_ART_TYPE(child = sp_art_next(node, &i)) == SP_ART_LEAF) {
+			*ref = child;
+		} else {
+			/* The only child takes over the path of the node, followed by
+			 * the byte leading to the child and the path of the child */
+			struct sp_art_node *const next = child;
+			unsigned char prefix[SP_ART_PREFIX];
+			size_t n = MIN(node->prefix_len, SP_ART_PREFIX);
+			memcpy(prefix, node->prefix, n);
+			if (n < SP_ART_PREFIX) {
+				for (j = 0; j < 256 && sp_art_child(node, (unsigned char)j) == NULL; j++)
+					;
+				prefix[n++] = (unsigned char)j;
+			}
+			if (n < SP_ART_PREFIX)
+				memcpy(prefix + n, next->prefix, MIN(next->prefix_len, SP_ART_PREFIX - n));
+			next->prefix_len += node->prefix_len + 1;
+			memcpy(next->prefix, prefix, MIN(next->prefix_len, SP_ART_PREFIX));
+			*ref = next;
+		}
+		free(node);
+		return;
+	}
+
+	if (node->type == SP_ART_NODE256 && node->count <= 37) {
+		const struct sp_art_node256 *const n = (const struct sp_art_node256*)node;
+		struct sp_art_node48 *s;
+		if ((shrunk = sp_art_newnode(SP_ART_NODE48)) == NULL)
+			return;
+		s = (struct sp_art_node48*)shrunk;
+		for (i = 0, j = 0; i < 256; i++) {
+			if (n->children[i] != NULL) {
+				s->index[i]      = j + 1;
+				s->children[j++] = n->children[i];
+			}
+		}
+	} else if (node->type == SP_ART_NODE48 && node->count <= 12) {
+		const struct sp_art_node48 *const n = (const struct sp_art_node48*)node;
+		struct sp_art_node16 *s;
+		if ((shrunk = sp_art_newnode(SP_ART_NODE16)) == NULL)
+			return;
+		s = (struct sp_art_node16*)shrunk;
+		for (i = 0, j = 0; i < 256; i++) {
+			if (n->index[i] != 0) {
+				s->keys[j]       = i;
+				s->children[j++] = n->children[n->index[i] - 1];
+			}
+		}
+	} else if (node->type == SP_ART_NODE16 && node->count <= 3) {
+		const struct sp_art_node16 *const n = (const struct sp_art_node16*)node;
+		struct sp_art_node4 *s;
+		if ((shrunk = sp_art_newnode(SP_ART_NODE4)) == NULL)
+			return;
+		s = (struct sp_art_node4*)shrunk;
+		memcpy(s->keys, n->keys, node->count);
+		memcpy(s->children, n->children, node->count * sizeof(*s->children));
+	} else {
+		return;
+	}
+	i = shrunk->type;
+	memcpy(shrunk, node, sizeof(*node));
+	shrunk->type = i;
+	free(node);
+	*ref = shrunk;
+}
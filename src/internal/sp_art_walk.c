@@ -0,0 +1,60 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_art.h"
+#include <stdio.h>
+
+/* Calls func on the key, key length and value of every element under a node
+ * of an adaptive radix tree, in lexicographic order of keys, stopping at the
+ * first non-0 return value, which is returned. If idx is not NULL, every
+ * element is printed after its index, which is counted in *idx, and func may
+ * then be NULL to print the key and the address of the value instead. */
+int sp_art_walk(const struct sp_art *art, const void *node, int (*func)(const void*, size_t, void*), size_t *idx)
+{
+	const struct sp_art_node *const n = node;
+	const void *child;
+	size_t pos = 0;
+	int err;
+
+	if (SP_ART_TYPE(node) == SP_ART_LEAF) {
+		const struct sp_art_leaf *const leaf = node;
+		if (idx != NULL) {
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)(*idx)++);
+			if (func == NULL) {
+				const unsigned char *const key = SP_ART_KEY(art, leaf);
+				size_t i;
+				for (i = 0; i < leaf->len; i++) {
+					if (key[i] >= 0x20 && key[i] < 0x7f && key[i] != '\\')
+						putchar(key[i]);
+					else
+						printf("\\x%02x", key[i]);
+				}
+				printf("\t%p\n", (void*)SP_ART_VAL(art, leaf));
+				return 0;
+			}
+		}
+		return func(SP_ART_KEY(art, leaf), leaf->len, SP_ART_VAL(art, leaf));
+	}
+	if (n->term != NULL && (err = sp_art_walk(art, n->term, func, idx)))
+		return err;
+	while ((child = sp_art_next(n, &pos)) != NULL)
+		if ((err = sp_art_walk(art, child, func, idx)))
+			return err;
+	return 0;
+}
@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_avl.h"
+#include <string.h>
+
+/* Builds a perfectly balanced subtree out of n sorted keys and their values,
+ * taking the middle one as the root, and returns it. The caller must make sure
+ * that n nodes can be allocated. */
+struct sp_avl_node *sp_avl_build_range(struct sp_avl *avl, const char *keys, const char *vals, size_t n, struct sp_avl_node *parent)
+{
+	struct sp_avl_node *node;
+	void *block;
+	const size_t mid = n / 2;
+
+	if (n == 0)
+		return NULL;
+	sp_pool_take(&avl->pool, &block);
+	node = block;
+	memcpy(SP_AVL_KEY(avl, node), keys + mid * avl->key_size, avl->key_size);
+	if (vals != NULL)
+		memcpy(SP_AVL_VAL(avl, node), vals + mid * avl->val_size, avl->val_size);
+	node->parent = parent;
+	node->left   = sp_avl_build_range(avl, keys, vals, mid, node);
+	node->right  = sp_avl_build_range(avl, keys + (mid + 1) * avl->key_size,
+		vals == NULL ? NULL : vals + (mid + 1) * avl->val_size, n - mid - 1, node);
+	SP_AVL_UPDATE(node);
+	return node;
+}
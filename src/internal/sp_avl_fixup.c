@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_avl.h"
+
+/* Walks up from node to the root, restoring the balance of every subtree on
+ * the way and the sizes they hold. The walk cannot stop early, because every
+ * ancestor of a changed node has changed in size. */
+void sp_avl_fixup(struct sp_avl *avl, struct sp_avl_node *node)
+{
+	while (node != NULL) {
+		struct sp_avl_node *const parent = node->parent;
+		struct sp_avl_node **const link = parent == NULL ? &avl->root
+			: parent->left == node ? &parent->left : &parent->right;
+		const int balance = SP_AVL_HEIGHT(node->left) - SP_AVL_HEIGHT(node->right);
+		if (balance > 1) {
+			if (SP_AVL_HEIGHT(node->left->left) < SP_AVL_HEIGHT(node->left->right))
+				node->left = sp_avl_rotate(node->left, 0);
+			node = sp_avl_rotate(node, 1);
+		} else if (balance < -1) {
+			if (SP_AVL_HEIGHT(node->right->right) < SP_AVL_HEIGHT(node->right->left))
+				node->right = sp_avl_rotate(node->right, 1);
+			node = sp_avl_rotate(node, 0);
+		} else {
+			SP_AVL_UPDATE(node);
+		}
+		*link = node;
+		node = parent;
+	}
+}
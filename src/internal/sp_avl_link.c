@@ -0,0 +1,34 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_avl.h"
+
+/* Attaches a new leaf at link, which is a child pointer of parent (or the root
+ * pointer), and rebalances the tree */
+void sp_avl_link(struct sp_avl *avl, struct sp_avl_node *parent, struct sp_avl_node **link, struct sp_avl_node *node)
+{
+	node->left   = NULL;
+	node->right  = NULL;
+	node->parent = parent;
+	node->size   = 1;
+	node->height = 1;
+	*link = node;
+	++avl->size;
+	sp_avl_fixup(avl, parent);
+}
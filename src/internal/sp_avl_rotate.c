@@ -0,0 +1,42 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_avl.h"
+
+/* Rotates the subtree of node to the right (or left), and returns its new
+ * root. The parent of the subtree is left for the caller to relink. */
+struct sp_avl_node *sp_avl_rotate(struct sp_avl_node *node, int right)
+{
+	struct sp_avl_node *const pivot = right ? node->left : node->right,
+	                   *const inner = right ? pivot->right : pivot->left;
+	if (right) {
+		node->left   = inner;
+		pivot->right = node;
+	} else {
+		node->right  = inner;
+		pivot->left  = node;
+	}
+	if (inner != NULL)
+		inner->parent = node;
+	pivot->parent = node->parent;
+	node->parent  = pivot;
+	SP_AVL_UPDATE(node);
+	SP_AVL_UPDATE(pivot);
+	return pivot;
+}
@@ -0,0 +1,61 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_avl.h"
+
+/* Detaches a node from an AVL tree, rebalances the tree and gives the node
+ * back to the pool. A node with two children is replaced by its successor,
+ * which is relinked instead of copied, so that no other node changes its
+ * address. */
+void sp_avl_unlink(struct sp_avl *avl, struct sp_avl_node *node)
+{
+	struct sp_avl_node *const parent = node->parent;
+	struct sp_avl_node **const link = parent == NULL ? &avl->root
+		: parent->left == node ? &parent->left : &parent->right;
+	struct sp_avl_node *fix;
+
+	if (node->left != NULL && node->right != NULL) {
+		struct sp_avl_node *succ = node->right;
+		while (succ->left != NULL)
+			succ = succ->left;
+		if (succ->parent == node) {
+			fix = succ;
+		} else {
+			fix = succ->parent;
+			fix->left = succ->right;
+			if (succ->right != NULL)
+				succ->right->parent = fix;
+			succ->right = node->right;
+			succ->right->parent = succ;
+		}
+		succ->left = node->left;
+		succ->left->parent = succ;
+		succ->parent = parent;
+		*link = succ;
+	} else {
+		struct sp_avl_node *const child = node->left != NULL ? node->left : node->right;
+		if (child != NULL)
+			child->parent = parent;
+		*link = child;
+		fix = parent;
+	}
+	sp_avl_fixup(avl, fix);
+	sp_pool_give(&avl->pool, node);
+	--avl->size;
+}
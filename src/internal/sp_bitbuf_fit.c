@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Same as sp_buf_fit, but for packed bit buffers. capacity and size are
+ * expressed in bits, capacity is always a multiple of SP_WORD_BIT. The buffer
+ * is enlarged (doubled, just like in sp_buf_fit) until size bits fit in it.
+ * Newly allocated words are zeroed.
+ */
+int sp_bitbuf_fit(unsigned long **buf, size_t *capacity, size_t size)
+{
+	if (size > *capacity) {
+		const size_t max   = SP_SIZE_MAX / SP_WORD_BIT,
+		             need  = SP_WORDS(size),
+		             words = *capacity / SP_WORD_BIT;
+		size_t n = MAX(words, 1);
+		if (need > max) {
+			error(("size_t overflow detected, bitarray size limit reached"));
+			return 2;
+		}
+		while (n < need)
+			n = (n > max / 2) ? max : 2 * n;
+		*buf = realloc(*buf, n * sizeof(**buf));
+		if (*buf == NULL) {
+			error(("realloc"));
+			return 1;
+		}
+		memset(*buf + words, 0, (n - words) * sizeof(**buf));
+		*capacity = n * SP_WORD_BIT;
+	}
+	return 0;
+}
@@ -0,0 +1,86 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Block buffers store elements in fixed-size blocks, referenced by a "map" of
+ * block pointers. Positions are counted from the beginning of the first block
+ * in the map, so element idx resides at position (head + idx). Blocks are never
+ * moved or reallocated (only the map is), which keeps element addresses stable.
+ *
+ * This function ensures there is room for one more element at the front (if
+ * front is non-0) or at the back of the buffer. If the map runs out of room,
+ * the used block pointers are re-centered in a new map, twice as long if more
+ * than half of the old one was in use. Blocks which fall out of use are kept
+ * for later reuse, so in a steady state no allocations take place at all.
+ * Return values are identical to sp_buf_fit.
+ */
+int sp_blockbuf_fit(void ***blocks, size_t *nblocks, size_t *head, size_t size, size_t block_size, size_t elem_size, int front)
+{
+	size_t b;
+	if (front ? *head == 0 : *head + size == *nblocks * block_size) {
+		const size_t first = *head / block_size,
+		             used  = size ? (*head + size - 1) / block_size - first + 1 : 0;
+		const size_t limit = MIN(SP_SIZE_MAX / block_size, SP_SIZE_MAX / sizeof(void*));
+		size_t n = *nblocks, i, j, k;
+		void **map;
+		/* Leave at least one free block on both ends after re-centering */
+		while (n < 2 * (used + 1)) {
+			if (n > limit / 2) {
+				n = limit;
+				break;
+			}
+			n *= 2;
+		}
+		if (n < used + 2) {
+			error(("size_t overflow detected, deque size limit reached"));
+			return 2;
+		}
+		map = malloc(n * sizeof(*map));
+		if (map == NULL) {
+			error(("malloc"));
+			return 1;
+		}
+		k = (n - used) / 2;
+		memcpy(map + k, *blocks + first, used * sizeof(*map));
+		j = (k == 0) ? used : 0;
+		for (i = 0; i < *nblocks; i++) {
+			if (i >= first && i < first + used)
+				continue;
+			map[j++] = (*blocks)[i];
+			if (j == k)
+				j += used;
+		}
+		while (j < n) {
+			map[j++] = NULL;
+			if (j == k)
+				j += used;
+		}
+		free(*blocks);
+		*blocks  = map;
+		*nblocks = n;
+		*head    = k * block_size + *head % block_size;
+	}
+	b = front ? (*head - 1) / block_size : (*head + size) / block_size;
+	if ((*blocks)[b] == NULL && ((*blocks)[b] = malloc(block_size * elem_size)) == NULL) {
+		error(("malloc"));
+		return 1;
+	}
+	return 0;
+}
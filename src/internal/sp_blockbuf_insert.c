@@ -0,0 +1,36 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Insert an element into a block buffer. Similarly to sp_ringbuf_insert, the
+ * smaller of the 2 sub-buffers split by idx is shifted to make room, so the
+ * caller must have called sp_blockbuf_fit with front set to (idx < size / 2).
+ */
+void sp_blockbuf_insert(const void *elem, size_t idx, void *const *blocks, size_t *head, size_t *size, size_t block_size, size_t elem_size)
+{
+	if (idx < *size / 2) {
+		sp_blockbuf_shl(blocks, block_size, elem_size, *head, idx);
+		--(*head);
+	} else {
+		sp_blockbuf_shr(blocks, block_size, elem_size, *head + idx, *size - idx);
+	}
+	memcpy(sp_blockbuf_get(idx, blocks, *head, block_size, elem_size), elem, elem_size);
+	++(*size);
+}
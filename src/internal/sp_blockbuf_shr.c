@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Shift n consecutive block buffer elements, starting at position start, one
+ * position to the right. The position following the last element must be
+ * unoccupied, but its block must be allocated. This is the mirror image of
+ * sp_blockbuf_shl, elements are processed from the back.
+ */
+void sp_blockbuf_shr(void *const *blocks, size_t block_size, size_t elem_size, size_t start, size_t n)
+{
+	size_t end = start + n;
+	while (n != 0) {
+		char *const blk = blocks[(end - 1) / block_size];
+		const size_t off = (end - 1) % block_size;
+		size_t len;
+		if (off == block_size - 1) {
+			memcpy(blocks[(end - 1) / block_size + 1], blk + off * elem_size, elem_size);
+			--end;
+			--n;
+			continue;
+		}
+		len = MIN(n, off + 1);
+		memmove(blk + (off + 2 - len) * elem_size, blk + (off + 1 - len) * elem_size, len * elem_size);
+		end -= len;
+		n   -= len;
+	}
+}
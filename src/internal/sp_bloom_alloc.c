@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bloom.h"
+
+/* Allocates an empty bloom filter of nbits bits, which must be a multiple of
+ * 64, or of SP_BLOOM_BLOCK if it is blocked */
+struct sp_bloom *sp_bloom_alloc(size_t nbits, size_t nhashes, int blocked)
+{
+	struct sp_bloom *ret;
+	const size_t total = nbits + (blocked ? SP_BLOOM_BLOCK : 0);
+
+	if ((ret = malloc(sizeof(*ret))) == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	if ((ret->bits = sp_bitarray_create(total)) == NULL) {
+		free(ret);
+		return NULL;
+	}
+	if (sp_bitarray_resize(ret->bits, total)) {
+		sp_bitarray_destroy(ret->bits);
+		free(ret);
+		return NULL;
+	}
+
+	/* Blocked filters get one spare block, so that they can start at the
+	 * first word aligned to a cache line, and every block fits in one */
+	ret->offset = 0;
+	if (blocked) {
+		const size_t line = SP_BLOOM_BLOCK / CHAR_BIT;
+		ret->offset = (line - (size_t)ret->bits->data % line) % line / sizeof(*ret->bits->data);
+	}
+	ret->nbits   = nbits;
+	ret->nhashes = nhashes;
+	ret->size    = 0;
+	ret->blocked = blocked != 0;
+	return ret;
+}
@@ -0,0 +1,33 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bloom.h"
+
+/* Estimates the number of elements in a bloom filter of m bits and k hashes
+ * from the number x of its bits which are set, as -m / k * ln (1 - x / m), a
+ * full filter being counted as one bit short of full */
+size_t sp_bloom_estimate(const struct sp_bloom *bloom)
+{
+	const double m = (double)bloom->nbits;
+	double x = (double)sp_bitarray_count(bloom->bits), n;
+	if (x >= m)
+		x = m - 1;
+	n = -m / (double)bloom->nhashes * sp_log(1 - x / m);
+	return n >= (double)SP_SIZE_MAX ? SP_SIZE_MAX : (size_t)(n + 0.5);
+}
@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+
+/* Hashes data with the 32-bit MurmurHash3, reading it byte by byte, so that
+ * the hash, which is returned in the low 32 bits, is the same on all machines
+ * and serialized bloom filters can be shared between them */
+unsigned long sp_bloom_hash(const void *data, size_t len)
+{
+	const unsigned char *const p = data;
+	unsigned long h = 0, k;
+	size_t i, j;
+	for (i = 0; i + 4 <= len; i += 4) {
+		k = (unsigned long)p[i] | (unsigned long)p[i + 1] << 8
+			| (unsigned long)p[i + 2] << 16 | (unsigned long)p[i + 3] << 24;
+		k = k * 0xCC9E2D51UL & 0xFFFFFFFFUL;
+		k = (k << 15 | k >> 17) & 0xFFFFFFFFUL;
+		k = k * 0x1B873593UL & 0xFFFFFFFFUL;
+		h ^= k;
+		h = (h << 13 | h >> 19) & 0xFFFFFFFFUL;
+		h = (h * 5 + 0xE6546B64UL) & 0xFFFFFFFFUL;
+	}
+	if (len % 4 != 0) {
+		for (k = 0, j = len % 4; j > 0; j--)
+			k = k << 8 | p[i + j - 1];
+		k = k * 0xCC9E2D51UL & 0xFFFFFFFFUL;
+		k = (k << 15 | k >> 17) & 0xFFFFFFFFUL;
+		k = k * 0x1B873593UL & 0xFFFFFFFFUL;
+		h ^= k;
+	}
+	h ^= (unsigned long)len & 0xFFFFFFFFUL;
+	SP_BLOOM_MIX(h);
+	return h;
+}
@@ -0,0 +1,71 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bloom.h"
+
+/* Visits the bits of an element in a bloom filter, setting them if set is
+ * non-0. Returns 1 if all of them were already set, and 0 otherwise. The bits
+ * are picked by double hashing: the i-th one is h1 + i * h2 modulo the number
+ * of bits, where h2 is derived from the hash h1 of the element. */
+int sp_bloom_probe(const struct sp_bloom *bloom, const void *data, size_t len, int set)
+{
+	unsigned long *const words = bloom->bits->data + bloom->offset;
+	unsigned long h1 = sp_bloom_hash(data, len), h2 = h1 ^ 0x5BD1E995UL, delta;
+	size_t i, m, bit, pos, step, base = 0;
+	int ret = 1;
+
+	SP_BLOOM_MIX(h2);
+	if (bloom->blocked) {
+		/* All bits of an element lie in one block, picked by h1. h2 walks
+		 * the 32-bit space in steps of delta and is remixed after every
+		 * step, and the bits are taken from its top 9 bits, so that they
+		 * do not form a progression which other elements of the block
+		 * would repeat */
+		base  = h1 % (bloom->nbits / SP_BLOOM_BLOCK) * SP_BLOOM_BLOCK;
+		delta = ((h2 >> 15 | h2 << 17) & 0xFFFFFFFFUL) | 1;
+		m = pos = step = 0;
+	} else {
+		/* Filters of more than 2^32 bits take h2 as the high half of a
+		 * 64-bit starting position */
+		m     = bloom->nbits;
+		pos   = (m >> 16 >> 16 != 0 ? (size_t)h2 << 16 << 16 | h1 : h1) % m;
+		step  = h2 % m != 0 ? h2 % m : 1;
+		delta = 0;
+	}
+	for (i = 0; i < bloom->nhashes; i++) {
+		unsigned long mask;
+		if (bloom->blocked) {
+			bit = base + (size_t)(h2 >> 23);
+			h2  = (h2 + delta) * 0x9E3779B9UL & 0xFFFFFFFFUL;
+		} else {
+			bit  = pos;
+			pos += step;
+			if (pos >= m)
+				pos -= m;
+		}
+		mask = 1UL << bit % SP_WORD_BIT;
+		if (!(words[bit / SP_WORD_BIT] & mask)) {
+			if (!set)
+				return 0;
+			words[bit / SP_WORD_BIT] |= mask;
+			ret = 0;
+		}
+	}
+	return ret;
+}
@@ -0,0 +1,110 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bptree.h"
+#include <string.h>
+
+/* Fills an empty B+tree with n sorted keys and their values, level by level
+ * from the leaves up. Nodes are filled as evenly as possible, which leaves all
+ * of them at least half full. Nodes of each level are chained through their
+ * next pointers while the level above is built. Returns 1 on allocation
+ * failure, leaving the tree empty, and 0 otherwise. */
+int sp_bptree_bulkload(struct sp_bptree *tree, const char *keys, const char *vals, size_t n)
+{
+	struct sp_bptree_node *level[SP_BPTREE_MAX_HEIGHT], *node, *prev, *child;
+	const size_t ks = tree->key_size, vs = tree->val_size;
+	size_t h = 0, m, parts, i, j;
+
+	parts = (n + tree->leaf_cap - 1) / tree->leaf_cap;
+	level[0] = NULL;
+	for (i = 0, prev = NULL; i < parts; i++, prev = node) {
+		const size_t count = n / parts + (i < n % parts);
+		if ((node = malloc(tree->leaf_size)) == NULL)
+			goto fail;
+		node->prev  = prev;
+		node->next  = NULL;
+		node->count = count;
+		if (prev != NULL)
+			prev->next = node;
+		else
+			level[0] = node;
+		memcpy(SP_BPTREE_KEY(tree, node, 0), keys, count * ks);
+		keys += count * ks;
+		if (vs != 0) {
+			memcpy(SP_BPTREE_VAL(tree, node, 0), vals, count * vs);
+			vals += count * vs;
+		}
+	}
+	tree->tail = prev;
+
+	while (parts > 1) {
+		m     = parts;
+		parts = (m + tree->inner_cap) / (tree->inner_cap + 1);
+		child = level[h];
+		level[++h] = NULL;
+		for (i = 0, prev = NULL; i < parts; i++, prev = node) {
+			const size_t count = m / parts + (i < m % parts);
+			if ((node = malloc(tree->inner_size)) == NULL)
+				goto fail;
+			node->prev  = prev;
+			node->next  = NULL;
+			node->count = count - 1;
+			if (prev != NULL)
+				prev->next = node;
+			else
+				level[h] = node;
+			for (j = 0; j < count; j++, child = child->next) {
+				SP_BPTREE_CHILD(tree, node)[j] = child;
+				if (j > 0) {
+					/* The separator is the smallest key under the child */
+					const struct sp_bptree_node *min = child;
+					size_t d;
+					for (d = 1; d < h; d++)
+						min = SP_BPTREE_CHILD(tree, min)[0];
+					memcpy(SP_BPTREE_KEY(tree, node, j - 1), SP_BPTREE_KEY(tree, min, 0), ks);
+				}
+			}
+		}
+	}
+
+	/* Inner nodes are not chained */
+	for (i = 1; i <= h; i++) {
+		for (node = level[i]; node != NULL; node = prev) {
+			prev = node->next;
+			node->prev = NULL;
+			node->next = NULL;
+		}
+	}
+	tree->root   = level[h];
+	tree->head   = level[0];
+	tree->height = h + 1;
+	tree->size   = n;
+	return 0;
+
+fail:
+	error(("malloc"));
+	for (i = 0; i <= h; i++) {
+		for (node = level[i]; node != NULL; node = prev) {
+			prev = node->next;
+			free(node);
+		}
+	}
+	tree->tail = NULL;
+	return 1;
+}
@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bptree.h"
+#include <string.h>
+
+/* Removes the key at index slot[height - 1] of the leaf at the end of path,
+ * with path and slot as for insertion, and its value, and rebalances the tree
+ * from the leaf upwards */
+void sp_bptree_erase_at(struct sp_bptree *tree, struct sp_bptree_node **path, const size_t *slot)
+{
+	const size_t h = tree->height, pos = slot[h - 1];
+	struct sp_bptree_node *node = path[h - 1];
+	size_t l;
+
+	memmove(SP_BPTREE_KEY(tree, node, pos), SP_BPTREE_KEY(tree, node, pos + 1), (node->count - pos - 1) * tree->key_size);
+	if (tree->val_size != 0)
+		memmove(SP_BPTREE_VAL(tree, node, pos), SP_BPTREE_VAL(tree, node, pos + 1), (node->count - pos - 1) * tree->val_size);
+	--node->count;
+	--tree->size;
+
+	for (l = h - 1; l > 0; l--) {
+		if (path[l]->count >= (l == h - 1 ? tree->leaf_cap : tree->inner_cap) / 2)
+			return;
+		if (!sp_bptree_rebalance(tree, path[l - 1], slot[l - 1], l == h - 1))
+			return;
+	}
+
+	/* An empty root is dropped, with the tree losing a level */
+	node = tree->root;
+	if (node->count != 0)
+		return;
+	if (h == 1) {
+		tree->root = NULL;
+		tree->head = NULL;
+		tree->tail = NULL;
+	} else {
+		tree->root = SP_BPTREE_CHILD(tree, node)[0];
+	}
+	free(node);
+	--tree->height;
+}
@@ -0,0 +1,30 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bptree.h"
+
+/* Frees a subtree of the given height of a B+tree */
+void sp_bptree_free(struct sp_bptree *tree, struct sp_bptree_node *node, size_t height)
+{
+	size_t i;
+	if (height > 1)
+		for (i = 0; i <= node->count; i++)
+			sp_bptree_free(tree, SP_BPTREE_CHILD(tree, node)[i], height - 1);
+	free(node);
+}
@@ -0,0 +1,140 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bptree.h"
+#include <string.h>
+
+/* Inserts a new key and its value into a B+tree, at index slot[height - 1] of
+ * the leaf at the end of path. path holds the nodes on the way from the root,
+ * and slot the index of the child taken at each of them. Full nodes are split
+ * from the leaf upwards, and all the nodes needed for that are allocated
+ * first, so that the tree is left unchanged on failure. Returns 1 on
+ * allocation failure and 0 otherwise. */
+int sp_bptree_insert_at(struct sp_bptree *tree, struct sp_bptree_node **path, const size_t *slot, const void *key, const void *val)
+{
+	struct sp_bptree_node *fresh[SP_BPTREE_MAX_HEIGHT + 1], *node, *right, *child;
+	const size_t h = tree->height, ks = tree->key_size, vs = tree->val_size;
+	size_t need = 0, pos, left, l, k;
+	const void *sep;
+
+	if (h == 0) {
+		if ((node = malloc(tree->leaf_size)) == NULL) {
+			error(("malloc"));
+			return 1;
+		}
+		node->prev  = NULL;
+		node->next  = NULL;
+		node->count = 1;
+		memcpy(SP_BPTREE_KEY(tree, node, 0), key, ks);
+		if (vs != 0)
+			memcpy(SP_BPTREE_VAL(tree, node, 0), val, vs);
+		tree->root   = node;
+		tree->head   = node;
+		tree->tail   = node;
+		tree->height = 1;
+		tree->size   = 1;
+		return 0;
+	}
+
+	/* A full leaf takes a new leaf, every full ancestor above it a new inner
+	 * node, and a full root a new root */
+	if (path[h - 1]->count == tree->leaf_cap) {
+		for (need = 1, l = h - 1; l > 0 && path[l - 1]->count == tree->inner_cap; l--)
+			need++;
+		need += l == 0;
+	}
+	for (k = 0; k < need; k++) {
+		if ((fresh[k] = malloc(k == 0 ? tree->leaf_size : tree->inner_size)) == NULL) {
+			error(("malloc"));
+			while (k > 0)
+				free(fresh[--k]);
+			return 1;
+		}
+	}
+
+	node = path[h - 1];
+	pos  = slot[h - 1];
+	++tree->size;
+	if (need == 0) {
+		memmove(SP_BPTREE_KEY(tree, node, pos + 1), SP_BPTREE_KEY(tree, node, pos), (node->count - pos) * ks);
+		memcpy(SP_BPTREE_KEY(tree, node, pos), key, ks);
+		if (vs != 0) {
+			memmove(SP_BPTREE_VAL(tree, node, pos + 1), SP_BPTREE_VAL(tree, node, pos), (node->count - pos) * vs);
+			memcpy(SP_BPTREE_VAL(tree, node, pos), val, vs);
+		}
+		++node->count;
+		return 0;
+	}
+
+	/* Split the leaf, keeping the larger half on the left */
+	right = fresh[0];
+	left  = (tree->leaf_cap + 2) / 2;
+	sp_bptree_split(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, right, 0), tree->leaf_cap, left, pos, key, ks);
+	if (vs != 0)
+		sp_bptree_split(SP_BPTREE_VAL(tree, node, 0), SP_BPTREE_VAL(tree, right, 0), tree->leaf_cap, left, pos, val, vs);
+	right->count = tree->leaf_cap + 1 - left;
+	node->count  = left;
+	right->prev  = node;
+	right->next  = node->next;
+	if (node->next != NULL)
+		node->next->prev = right;
+	else
+		tree->tail = right;
+	node->next = right;
+
+	/* Insert the first key of the new node and the node itself into the
+	 * parent, splitting it around its middle key if it is full, which is then
+	 * moved up instead */
+	sep   = SP_BPTREE_KEY(tree, right, 0);
+	child = right;
+	for (l = h - 1, k = 1; l > 0; l--) {
+		node = path[l - 1];
+		pos  = slot[l - 1];
+		if (node->count < tree->inner_cap) {
+			memmove(SP_BPTREE_KEY(tree, node, pos + 1), SP_BPTREE_KEY(tree, node, pos), (node->count - pos) * ks);
+			memcpy(SP_BPTREE_KEY(tree, node, pos), sep, ks);
+			memmove(SP_BPTREE_CHILD(tree, node) + pos + 2, SP_BPTREE_CHILD(tree, node) + pos + 1, (node->count - pos) * sizeof(child));
+			SP_BPTREE_CHILD(tree, node)[pos + 1] = child;
+			++node->count;
+			return 0;
+		}
+		right = fresh[k++];
+		right->prev = NULL;
+		right->next = NULL;
+		left = tree->inner_cap / 2;
+		sp_bptree_split(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, right, 0), tree->inner_cap, left + 1, pos, sep, ks);
+		sp_bptree_split((char*)SP_BPTREE_CHILD(tree, node), (char*)SP_BPTREE_CHILD(tree, right), tree->inner_cap + 1, left + 1, pos + 1, &child, sizeof(child));
+		right->count = tree->inner_cap - left;
+		node->count  = left;
+		sep   = SP_BPTREE_KEY(tree, node, left);
+		child = right;
+	}
+
+	/* The root was split */
+	node = fresh[k];
+	node->prev  = NULL;
+	node->next  = NULL;
+	node->count = 1;
+	memcpy(SP_BPTREE_KEY(tree, node, 0), sep, ks);
+	SP_BPTREE_CHILD(tree, node)[0] = tree->root;
+	SP_BPTREE_CHILD(tree, node)[1] = child;
+	tree->root = node;
+	++tree->height;
+	return 0;
+}
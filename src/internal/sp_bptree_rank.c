@@ -0,0 +1,38 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bptree.h"
+
+/* Binary search for the number of keys of a B+tree node which compare less
+ * than (or, if upper is set, not greater than) key */
+size_t sp_bptree_rank(const struct sp_bptree *tree, const struct sp_bptree_node *node, const void *key, int upper)
+{
+	size_t lo = 0, n = node->count;
+	while (n > 0) {
+		const size_t half = n / 2;
+		const int c = tree->cmp(SP_BPTREE_KEY(tree, node, lo + half), key);
+		if (c < 0 || (upper && c == 0)) {
+			lo += half + 1;
+			n  -= half + 1;
+		} else {
+			n = half;
+		}
+	}
+	return lo;
+}
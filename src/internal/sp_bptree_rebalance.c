@@ -0,0 +1,102 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_bptree.h"
+#include <string.h>
+
+/* Refills the child at idx of parent, which has one key less than the minimum,
+ * with a key of a sibling which can spare one, or else merges it with a
+ * sibling. leaf tells whether the child is a leaf. Returns 1 if the children
+ * were merged, in which case the parent has lost a key, and 0 otherwise. */
+int sp_bptree_rebalance(struct sp_bptree *tree, struct sp_bptree_node *parent, size_t idx, int leaf)
+{
+	struct sp_bptree_node **const children = SP_BPTREE_CHILD(tree, parent);
+	struct sp_bptree_node *const node = children[idx], *left, *right;
+	const size_t min = (leaf ? tree->leaf_cap : tree->inner_cap) / 2,
+	             ks = tree->key_size, vs = tree->val_size;
+	size_t s;
+
+	if (idx > 0 && (left = children[idx - 1])->count > min) {
+		const size_t n = --left->count;
+		memmove(SP_BPTREE_KEY(tree, node, 1), SP_BPTREE_KEY(tree, node, 0), node->count * ks);
+		if (leaf) {
+			memcpy(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, left, n), ks);
+			if (vs != 0) {
+				memmove(SP_BPTREE_VAL(tree, node, 1), SP_BPTREE_VAL(tree, node, 0), node->count * vs);
+				memcpy(SP_BPTREE_VAL(tree, node, 0), SP_BPTREE_VAL(tree, left, n), vs);
+			}
+			memcpy(SP_BPTREE_KEY(tree, parent, idx - 1), SP_BPTREE_KEY(tree, node, 0), ks);
+		} else {
+			memmove(SP_BPTREE_CHILD(tree, node) + 1, SP_BPTREE_CHILD(tree, node), (node->count + 1) * sizeof(node));
+			memcpy(SP_BPTREE_KEY(tree, node, 0), SP_BPTREE_KEY(tree, parent, idx - 1), ks);
+			SP_BPTREE_CHILD(tree, node)[0] = SP_BPTREE_CHILD(tree, left)[n + 1];
+			memcpy(SP_BPTREE_KEY(tree, parent, idx - 1), SP_BPTREE_KEY(tree, left, n), ks);
+		}
+		++node->count;
+		return 0;
+	}
+
+	if (idx < parent->count && (right = children[idx + 1])->count > min) {
+		const size_t n = --right->count;
+		if (leaf) {
+			memcpy(SP_BPTREE_KEY(tree, node, node->count), SP_BPTREE_KEY(tree, right, 0), ks);
+			memmove(SP_BPTREE_KEY(tree, right, 0), SP_BPTREE_KEY(tree, right, 1), n * ks);
+			if (vs != 0) {
+				memcpy(SP_BPTREE_VAL(tree, node, node->count), SP_BPTREE_VAL(tree, right, 0), vs);
+				memmove(SP_BPTREE_VAL(tree, right, 0), SP_BPTREE_VAL(tree, right, 1), n * vs);
+			}
+			memcpy(SP_BPTREE_KEY(tree, parent, idx), SP_BPTREE_KEY(tree, right, 0), ks);
+		} else {
+			memcpy(SP_BPTREE_KEY(tree, node, node->count), SP_BPTREE_KEY(tree, parent, idx), ks);
+			SP_BPTREE_CHILD(tree, node)[node->count + 1] = SP_BPTREE_CHILD(tree, right)[0];
+			memcpy(SP_BPTREE_KEY(tree, parent, idx), SP_BPTREE_KEY(tree, right, 0), ks);
+			memmove(SP_BPTREE_KEY(tree, right, 0), SP_BPTREE_KEY(tree, right, 1), n * ks);
+			memmove(SP_BPTREE_CHILD(tree, right), SP_BPTREE_CHILD(tree, right) + 1, (n + 1) * sizeof(node));
+		}
+		++node->count;
+		return 0;
+	}
+
+	/* Neither sibling can spare a key, so the node and one of them fit
+	 * together into the left one of the pair */
+	s = idx > 0 ? idx - 1 : idx;
+	left  = children[s];
+	right = children[s + 1];
+	if (leaf) {
+		memcpy(SP_BPTREE_KEY(tree, left, left->count), SP_BPTREE_KEY(tree, right, 0), right->count * ks);
+		if (vs != 0)
+			memcpy(SP_BPTREE_VAL(tree, left, left->count), SP_BPTREE_VAL(tree, right, 0), right->count * vs);
+		left->count += right->count;
+		left->next = right->next;
+		if (right->next != NULL)
+			right->next->prev = left;
+		else
+			tree->tail = left;
+	} else {
+		memcpy(SP_BPTREE_KEY(tree, left, left->count), SP_BPTREE_KEY(tree, parent, s), ks);
+		memcpy(SP_BPTREE_KEY(tree, left, left->count + 1), SP_BPTREE_KEY(tree, right, 0), right->count * ks);
+		memcpy(SP_BPTREE_CHILD(tree, left) + left->count + 1, SP_BPTREE_CHILD(tree, right), (right->count + 1) * sizeof(node));
+		left->count += right->count + 1;
+	}
+	free(right);
+	memmove(SP_BPTREE_KEY(tree, parent, s), SP_BPTREE_KEY(tree, parent, s + 1), (parent->count - s - 1) * ks);
+	memmove(children + s + 1, children + s + 2, (parent->count - s - 1) * sizeof(*children));
+	--parent->count;
+	return 1;
+}
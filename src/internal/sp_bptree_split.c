@@ -0,0 +1,35 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Inserts item at pos into the array src of n items of the given size, and
+ * moves all but the first left items of the result to the array dst */
+void sp_bptree_split(char *src, char *dst, size_t n, size_t left, size_t pos, const void *item, size_t size)
+{
+	if (pos < left) {
+		memcpy(dst, src + (left - 1) * size, (n - left + 1) * size);
+		memmove(src + (pos + 1) * size, src + pos * size, (left - 1 - pos) * size);
+		memcpy(src + pos * size, item, size);
+	} else {
+		memcpy(dst, src + left * size, (pos - left) * size);
+		memcpy(dst + (pos - left) * size, item, size);
+		memcpy(dst + (pos - left + 1) * size, src + pos * size, (n - pos) * size);
+	}
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_chashmap.h"
+
+/* Frees the retired tables of a shard which no reader can be inside of anymore,
+ * see SP_EPOCH_ENTER. The epoch is advanced at most twice, each time only if no
+ * reader of the previous epoch is left. The shard's lock must be held.
+ */
+void sp_chashtab_reclaim(struct sp_chashmap_shard *shard)
+{
+	unsigned long epoch = SP_LOAD_RELAXED(&shard->epoch);
+	size_t i, n;
+	for (i = 0; i < 2; i++) {
+		SP_FENCE_SEQ_CST();
+		if (SP_LOAD_ACQUIRE(&shard->readers[(epoch + 1) & 1]) != 0)
+			break;
+		SP_STORE_RELEASE(&shard->epoch, ++epoch);
+	}
+	for (i = n = 0; i < shard->nretired; i++) {
+		if (epoch - shard->retired[i].epoch >= 2)
+			sp_hashmap_destroy(shard->retired[i].table, NULL, NULL);
+		else
+			shard->retired[n++] = shard->retired[i];
+	}
+	shard->nretired = n;
+	if (n == 0) {
+		free(shard->retired);
+		shard->retired = NULL;
+	}
+}
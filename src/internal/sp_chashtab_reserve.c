@@ -0,0 +1,65 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_chashmap.h"
+#include <string.h>
+
+/* Makes sure that sp_hashtab_claim can reserve a slot for the given hash in the
+ * shard's table without rehashing it, which lock-free readers could not
+ * survive. The shard's lock must be held.
+ * A full table is replaced by a copy, twice its size, or of the same size if
+ * most of its used slots are tombstones. The copy is published atomically, so
+ * readers never wait for it, and the old table is retired until no reader can
+ * be inside it anymore.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_chashtab_reserve(struct sp_chashmap_shard *shard, size_t hash)
+{
+	struct sp_hashmap *const tab = shard->table, *tmp;
+	struct sp_chashmap_retired *retired;
+	const size_t fill = SP_HASHTAB_FILL(tab->capacity);
+	int err;
+
+	if (tab->growth_left != 0 || tab->ctrl[sp_hashtab_slot(tab, hash)] == SP_CTRL_DELETED)
+		return 0;
+	if (tab->size >= fill / 2 && sp_size_try_add(fill, 1))
+		return 2;
+	tmp = sp_hashmap_create(tab->key_size, tab->val_size, 1, tab->hash, tab->cmp);
+	if (tmp == NULL)
+		return 1;
+	if ((err = sp_hashtab_fit(tmp, tab->size < fill / 2 ? fill : fill + 1))) {
+		sp_hashmap_destroy(tmp, NULL, NULL);
+		return err;
+	}
+	sp_hashtab_reinsert(tmp, tab);
+
+	retired = realloc(shard->retired, (shard->nretired + 1) * sizeof(*retired));
+	if (retired == NULL) {
+		error(("realloc"));
+		sp_hashmap_destroy(tmp, NULL, NULL);
+		return 1;
+	}
+	retired[shard->nretired].table = tab;
+	retired[shard->nretired].epoch = SP_LOAD_RELAXED(&shard->epoch);
+	++shard->nretired;
+	shard->retired = retired;
+	SP_STORE_RELEASE(&shard->table, tmp);
+	sp_chashtab_reclaim(shard);
+	return 0;
+}
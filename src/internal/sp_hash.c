@@ -0,0 +1,43 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Default hash function for hashmap keys. Keys no longer than a word are mixed
+ * in a single round, which is the fast path for integer keys.
+ */
+size_t sp_hash(const void *data, size_t size)
+{
+	const unsigned char *p = data;
+	unsigned long h = (unsigned long)size, w;
+	while (size > sizeof(w)) {
+		memcpy(&w, p, sizeof(w));
+		h = (h ^ w) * SP_HASH_MULT;
+		h ^= h >> SP_WORD_BIT / 2;
+		p    += sizeof(w);
+		size -= sizeof(w);
+	}
+	w = 0;
+	memcpy(&w, p, size);
+	h = (h ^ w) * SP_HASH_MULT;
+	h ^= h >> SP_WORD_BIT / 2;
+	h *= SP_HASH_MULT;
+	h ^= h >> SP_WORD_BIT / 2;
+	return (size_t)h;
+}
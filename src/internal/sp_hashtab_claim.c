@@ -0,0 +1,51 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_hashmap.h"
+#include <string.h>
+
+/* Reserves a slot for a new key with the given hash and stores its index in
+ * idx. The caller is responsible for filling in the key and value. If the table
+ * runs out of empty slots, it is either rehashed in place (when most of the
+ * used slots are tombstones), or doubled.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_hashtab_claim(struct sp_hashmap *map, size_t hash, size_t *idx)
+{
+	size_t i = sp_hashtab_slot(map, hash);
+	if (map->growth_left == 0 && map->ctrl[i] != SP_CTRL_DELETED) {
+		const size_t fill = SP_HASHTAB_FILL(map->capacity);
+		int err;
+		if (map->size < fill / 2)
+			err = sp_hashtab_rehash(map, map->capacity);
+		else if (sp_size_try_add(fill, 1))
+			err = 2;
+		else
+			err = sp_hashtab_fit(map, fill + 1);
+		if (err)
+			return err;
+		i = sp_hashtab_slot(map, hash);
+	}
+	if (map->ctrl[i] == SP_CTRL_EMPTY)
+		--map->growth_left;
+	map->ctrl[i] = SP_H2(hash);
+	++map->size;
+	*idx = i;
+	return 0;
+}
@@ -0,0 +1,38 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_hashmap.h"
+#include <string.h>
+
+/* Frees up a slot. If its group still has an empty slot, no probe sequence can
+ * have passed through the group, so the slot can be made empty again instead of
+ * leaving a tombstone behind.
+ */
+void sp_hashtab_erase(struct sp_hashmap *map, size_t idx)
+{
+	SP_CTRL_GROUP w;
+	SP_CTRL_LOAD(w, map->ctrl + idx / SP_GROUP * SP_GROUP);
+	if (SP_CTRL_MATCH_EMPTY(w)) {
+		map->ctrl[idx] = SP_CTRL_EMPTY;
+		++map->growth_left;
+	} else {
+		map->ctrl[idx] = SP_CTRL_DELETED;
+	}
+	--map->size;
+}
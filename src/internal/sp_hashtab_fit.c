@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_hashmap.h"
+
+/* Makes room for n elements without further rehashing. The capacity is a power
+ * of 2 with at least 8 slots, to guarantee that 1/8 of the slots stay empty.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_hashtab_fit(struct sp_hashmap *map, size_t n)
+{
+	const size_t limit = SP_SIZE_MAX / map->slot_size;
+	size_t capacity = MAX(8, SP_GROUP);
+	while (SP_HASHTAB_FILL(capacity) < n) {
+		if (capacity > limit / 2) {
+			error(("size_t overflow detected, hashmap size limit reached"));
+			return 2;
+		}
+		capacity *= 2;
+	}
+	if (capacity > limit) {
+		error(("size_t overflow detected, hashmap size limit reached"));
+		return 2;
+	}
+	if (capacity > map->capacity)
+		return sp_hashtab_rehash(map, capacity);
+	if (n > map->size + map->growth_left)
+		return sp_hashtab_rehash(map, map->capacity);
+	return 0;
+}
@@ -0,0 +1,70 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_hashmap.h"
+#include <string.h>
+
+/* Moves all elements into a freshly allocated table with the given capacity,
+ * which also gets rid of all tombstones. Returns 1 on allocation failure and 0
+ * otherwise, in which case the map is left untouched.
+ */
+int sp_hashtab_rehash(struct sp_hashmap *map, size_t capacity)
+{
+	const size_t mask = capacity / SP_GROUP - 1;
+	unsigned char *ctrl;
+	char *slots;
+	size_t i;
+
+	ctrl  = malloc(capacity);
+	slots = malloc(capacity * map->slot_size);
+	if (ctrl == NULL || slots == NULL) {
+		error(("malloc"));
+		free(ctrl);
+		free(slots);
+		return 1;
+	}
+	memset(ctrl, SP_CTRL_EMPTY, capacity);
+	for (i = 0; i < map->capacity; i++) {
+		const char *const key = SP_HASHTAB_KEY(map, i);
+		size_t hash, g, step = 0, j;
+		if (map->ctrl[i] & 0x80)
+			continue;
+		hash = SP_HASH(map, key);
+		g = SP_H1(hash) & mask;
+		for (;;) {
+			SP_CTRL_GROUP w;
+			unsigned long m;
+			SP_CTRL_LOAD(w, ctrl + g * SP_GROUP);
+			if ((m = SP_CTRL_MATCH_EMPTY(w)) != 0) {
+				j = g * SP_GROUP + SP_CTRL_INDEX(m);
+				break;
+			}
+			g = (g + ++step) & mask;
+		}
+		ctrl[j] = SP_H2(hash);
+		memcpy(slots + j * map->slot_size, key, map->slot_size);
+	}
+	free(map->ctrl);
+	free(map->slots);
+	map->ctrl        = ctrl;
+	map->slots       = slots;
+	map->capacity    = capacity;
+	map->growth_left = SP_HASHTAB_FILL(capacity) - map->size;
+	return 0;
+}
@@ -0,0 +1,42 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_hashmap.h"
+#include <string.h>
+
+/* Inserts every element of src into dest, which must have the same key and
+ * value sizes, enough room, and none of the keys of src. src is left untouched.
+ */
+void sp_hashtab_reinsert(struct sp_hashmap *dest, const struct sp_hashmap *src)
+{
+	size_t i;
+	for (i = 0; i < src->capacity; i++) {
+		const char *const key = SP_HASHTAB_KEY(src, i);
+		size_t hash, j;
+		if (src->ctrl[i] & 0x80)
+			continue;
+		hash = SP_HASH(src, key);
+		j    = sp_hashtab_slot(dest, hash);
+		if (dest->ctrl[j] == SP_CTRL_EMPTY)
+			--dest->growth_left;
+		dest->ctrl[j] = SP_H2(hash);
+		memcpy(SP_HASHTAB_KEY(dest, j), key, src->slot_size);
+		++dest->size;
+	}
+}
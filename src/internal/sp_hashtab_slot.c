@@ -0,0 +1,36 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_hashmap.h"
+#include <string.h>
+
+/* Returns the first empty or deleted slot in the probe sequence of hash */
+size_t sp_hashtab_slot(const struct sp_hashmap *map, size_t hash)
+{
+	const size_t mask = map->capacity / SP_GROUP - 1;
+	size_t g = SP_H1(hash) & mask, step = 0;
+	for (;;) {
+		SP_CTRL_GROUP w;
+		unsigned long m;
+		SP_CTRL_LOAD(w, map->ctrl + g * SP_GROUP);
+		if ((m = SP_CTRL_MATCH_FREE(w)) != 0)
+			return g * SP_GROUP + SP_CTRL_INDEX(m);
+		g = (g + ++step) & mask;
+	}
+}
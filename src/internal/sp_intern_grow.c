@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_intern.h"
+
+/* Adds a block of at least n bytes to the arena of an intern pool. A string
+ * too long for a regular block gets one of its own, which is slotted in before
+ * the current block, so that the room left in the current block is not lost.
+ * Returns 2 on size_t overflow, 1 on allocation failure and 0 otherwise.
+ */
+int sp_intern_grow(struct sp_intern *pool, size_t n)
+{
+	const size_t size = pool->block_size > SP_INTERN_BLOCK_MAX / 2
+		? SP_INTERN_BLOCK_MAX : MAX(pool->block_size * 2, SP_INTERN_BLOCK);
+	char **blocks, *block;
+
+	if (pool->nblocks >= SP_SIZE_MAX / sizeof(*blocks)) {
+		error(("size_t overflow detected, intern pool size limit reached"));
+		return 2;
+	}
+	blocks = realloc(pool->blocks, (pool->nblocks + 1) * sizeof(*blocks));
+	if (blocks == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	pool->blocks = blocks;
+	block = malloc(MAX(size, n));
+	if (block == NULL) {
+		error(("malloc"));
+		return 1;
+	}
+	if (n > size && pool->nblocks != 0) {
+		blocks[pool->nblocks] = blocks[pool->nblocks - 1];
+		blocks[pool->nblocks - 1] = block;
+	} else {
+		blocks[pool->nblocks] = block;
+		pool->block_size = MAX(size, n);
+		pool->block_left = pool->block_size;
+	}
+	++pool->nblocks;
+	return 0;
+}
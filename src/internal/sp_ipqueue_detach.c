@@ -0,0 +1,33 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ipqueue.h"
+
+/* Takes the handle at idx out of the heap by swapping it with the last one,
+ * and returns it. The handle lands among the free ones, and the heap must then
+ * be repaired at idx, unless idx was the last index. */
+size_t sp_ipqueue_detach(struct sp_ipqueue *ipq, size_t idx)
+{
+	const size_t h = ipq->heap[idx], last = ipq->heap[--ipq->size];
+	ipq->heap[idx]       = last;
+	ipq->pos[last]       = idx;
+	ipq->heap[ipq->size] = h;
+	ipq->pos[h]          = ipq->size;
+	return h;
+}
@@ -0,0 +1,56 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ipqueue.h"
+
+/* Makes room for one more handle, doubling the capacity. Return values are
+ * identical to sp_buf_fit. */
+int sp_ipqueue_reserve(struct sp_ipqueue *ipq)
+{
+	const size_t max = SP_SIZE_MAX / MAX(ipq->elem_size, sizeof(size_t));
+	size_t capacity;
+	void *p;
+
+	if (ipq->count < ipq->capacity)
+		return 0;
+	if (ipq->capacity == max) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return 2;
+	}
+	capacity = ipq->capacity <= max / 2 ? ipq->capacity * 2 : max;
+
+	/* A failure leaves the larger buffers in place, which is harmless */
+	if ((p = realloc(ipq->data, capacity * ipq->elem_size)) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	ipq->data = p;
+	if ((p = realloc(ipq->heap, capacity * sizeof(size_t))) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	ipq->heap = p;
+	if ((p = realloc(ipq->pos, capacity * sizeof(size_t))) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	ipq->pos      = p;
+	ipq->capacity = capacity;
+	return 0;
+}
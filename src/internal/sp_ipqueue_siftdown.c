@@ -0,0 +1,42 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ipqueue.h"
+
+/* Moves the handle at idx towards the leaves, until it comes before all of
+ * its children */
+void sp_ipqueue_siftdown(struct sp_ipqueue *ipq, size_t idx)
+{
+	const size_t h = ipq->heap[idx];
+	const void *const elem = SP_IPQUEUE_ELEM(ipq, h);
+	while (ipq->size >= 2 && idx <= (ipq->size - 2) / ipq->arity) {
+		size_t child = idx * ipq->arity + 1, best = child;
+		const size_t end = ipq->size - child > ipq->arity ? child + ipq->arity : ipq->size;
+		for (++child; child < end; child++)
+			if (SP_PQUEUE_BEFORE(ipq, SP_IPQUEUE_ELEM(ipq, ipq->heap[child]), SP_IPQUEUE_ELEM(ipq, ipq->heap[best])))
+				best = child;
+		if (!SP_PQUEUE_BEFORE(ipq, SP_IPQUEUE_ELEM(ipq, ipq->heap[best]), elem))
+			break;
+		ipq->heap[idx] = ipq->heap[best];
+		ipq->pos[ipq->heap[idx]] = idx;
+		idx = best;
+	}
+	ipq->heap[idx] = h;
+	ipq->pos[h]    = idx;
+}
@@ -0,0 +1,37 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ipqueue.h"
+
+/* Moves the handle at idx towards the root, until its parent comes before it */
+void sp_ipqueue_siftup(struct sp_ipqueue *ipq, size_t idx)
+{
+	const size_t h = ipq->heap[idx];
+	const void *const elem = SP_IPQUEUE_ELEM(ipq, h);
+	while (idx > 0) {
+		const size_t parent = (idx - 1) / ipq->arity;
+		if (!SP_PQUEUE_BEFORE(ipq, elem, SP_IPQUEUE_ELEM(ipq, ipq->heap[parent])))
+			break;
+		ipq->heap[idx] = ipq->heap[parent];
+		ipq->pos[ipq->heap[idx]] = idx;
+		idx = parent;
+	}
+	ipq->heap[idx] = h;
+	ipq->pos[h]    = idx;
+}
@@ -0,0 +1,39 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_list.h"
+
+/* Links the chain of nodes from first to last into a list, before pos, or at
+ * the end if pos is NULL. The size of the list is left for the caller to
+ * update.
+ */
+void sp_list_link(struct sp_list *list, struct sp_list_node *pos, struct sp_list_node *first, struct sp_list_node *last)
+{
+	struct sp_list_node *const prev = pos == NULL ? list->tail : pos->prev;
+	first->prev = prev;
+	last->next  = pos;
+	if (prev == NULL)
+		list->head = first;
+	else
+		prev->next = first;
+	if (pos == NULL)
+		list->tail = last;
+	else
+		pos->prev = last;
+}
@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+
+/* Natural logarithm of a positive number, which spares the library a
+ * dependency on the math library. The number x is scaled by powers of 2 into
+ * [1, 2), where ln x = 2 atanh z with z = (x - 1) / (x + 1), whose series
+ * converges to double precision within 20 terms. */
+double sp_log(double x)
+{
+	const double ln2 = 0.69314718055994530942;
+	double z, z2, term, ret = 0;
+	int e = 0, i;
+	while (x >= 2) {
+		x /= 2;
+		e++;
+	}
+	while (x < 1) {
+		x *= 2;
+		e--;
+	}
+	z    = (x - 1) / (x + 1);
+	z2   = z * z;
+	term = z;
+	for (i = 1; i < 40; i += 2) {
+		ret  += term / i;
+		term *= z2;
+	}
+	return 2 * ret + e * ln2;
+}
@@ -0,0 +1,38 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_lru.h"
+#include "../sp_errcodes.h"
+
+/* Evicts the least recently used entry of a non-empty LRU cache. Returns 0,
+ * or SP_ECALLBK if the eviction callback failed, in which case the entry
+ * stays. */
+int sp_lru_evict(struct sp_lru *lru)
+{
+	const size_t idx = lru->tail;
+	const size_t slot = sp_hashtab_find(lru->index, SP_LRU_KEY(lru, idx), SP_HASH(lru->index, SP_LRU_KEY(lru, idx)));
+	int err;
+	if (lru->evict != NULL && (err = lru->evict(SP_LRU_KEY(lru, idx), SP_LRU_VAL(lru, idx)))) {
+		error(("callback function evict returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	sp_lru_drop(lru, idx, slot);
+	++lru->evictions;
+	return 0;
+}
@@ -0,0 +1,34 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_lru.h"
+
+/* Takes an entry of an LRU cache out of the recency list */
+void sp_lru_unlink(struct sp_lru *lru, size_t idx)
+{
+	const struct sp_lru_entry *const e = lru->entries + idx;
+	if (e->prev != lru->capacity)
+		lru->entries[e->prev].next = e->next;
+	else
+		lru->head = e->next;
+	if (e->next != lru->capacity)
+		lru->entries[e->next].prev = e->prev;
+	else
+		lru->tail = e->prev;
+}
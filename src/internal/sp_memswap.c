@@ -0,0 +1,35 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Swaps two non-overlapping objects of n bytes, through a buffer on the stack */
+void sp_memswap(void *a, void *b, size_t n)
+{
+	char tmp[64], *p = a, *q = b;
+	while (n > 0) {
+		const size_t k = MIN(n, sizeof(tmp));
+		memcpy(tmp, p, k);
+		memcpy(p, q, k);
+		memcpy(q, tmp, k);
+		p += k;
+		q += k;
+		n -= k;
+	}
+}
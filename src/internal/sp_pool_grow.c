@@ -0,0 +1,53 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pool.h"
+
+/* Appends a slab of at least n blocks to a pool, and twice as many as the last
+ * slab otherwise. Blocks are only carved out of it once the slabs before it are
+ * used up. Returns 2 on size_t overflow, 1 on allocation failure and 0
+ * otherwise.
+ */
+int sp_pool_grow(struct sp_pool *pool, size_t n)
+{
+	const size_t limit = SP_SIZE_MAX / pool->stride;
+	struct sp_pool_slab *slabs;
+	size_t size = pool->nslabs == 0 ? 0 : pool->slabs[pool->nslabs - 1].size;
+
+	size = size == 0 ? n : size > limit / 2 ? limit : MAX(size * 2, n);
+	if (n > limit || sp_size_try_add(pool->capacity, size) || pool->nslabs >= SP_SIZE_MAX / sizeof(*slabs)) {
+		error(("size_t overflow detected, pool size limit reached"));
+		return 2;
+	}
+	slabs = realloc(pool->slabs, (pool->nslabs + 1) * sizeof(*slabs));
+	if (slabs == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	pool->slabs = slabs;
+	slabs[pool->nslabs].data = malloc(size * pool->stride);
+	if (slabs[pool->nslabs].data == NULL) {
+		error(("malloc"));
+		return 1;
+	}
+	slabs[pool->nslabs].size = size;
+	++pool->nslabs;
+	pool->capacity += size;
+	return 0;
+}
@@ -0,0 +1,54 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pool.h"
+
+/* Initializes an object pool in place, with a first slab of capacity blocks,
+ * so that other modules can embed a pool as their node allocator. Every block
+ * is large enough to hold the free list link, and padded to keep the next one
+ * aligned. Returns 2 on size_t overflow, 1 on allocation failure and 0
+ * otherwise.
+ */
+int sp_pool_init(struct sp_pool *pool, size_t block_size, size_t capacity, int (*ctor)(void*), int (*dtor)(void*))
+{
+	const size_t align = MAX(SP_ALIGNOF_SIZE(block_size), sizeof(void*));
+	int err;
+
+	if (block_size > SP_SIZE_MAX / 2 - 16) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return 2;
+	}
+	pool->slabs      = NULL;
+	pool->free       = NULL;
+	pool->tail       = NULL;
+	pool->block_size = block_size;
+	pool->stride     = (MAX(block_size, sizeof(void*)) + align - 1) / align * align;
+	pool->size       = 0;
+	pool->capacity   = 0;
+	pool->nslabs     = 0;
+	pool->used       = 0;
+	pool->left       = 0;
+	pool->ctor       = ctor;
+	pool->dtor       = dtor;
+	if (capacity != 0 && (err = sp_pool_grow(pool, capacity))) {
+		free(pool->slabs);
+		return err;
+	}
+	return 0;
+}
@@ -0,0 +1,90 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pool.h"
+#include <string.h>
+
+/* Hands every slab of src over to dest, which must have the same stride. The
+ * blocks in use stay where they are. Slabs which src has carved blocks out of
+ * go before the slab dest is carving, so that carving goes on where it was,
+ * and the others go right after it. The free list of src is appended to that
+ * of dest, and if dest is carving a slab as well, what is left of the slab src
+ * was carving goes on the free list too, so that no block is lost. src is left
+ * without slabs. Returns 2 on size_t overflow, 1 on allocation failure and 0
+ * otherwise.
+ */
+int sp_pool_merge(struct sp_pool *dest, struct sp_pool *src)
+{
+	struct sp_pool_slab *slabs;
+	const size_t pos = dest->used == 0 ? 0 : dest->used - 1, cur = dest->used != 0;
+
+	if (src->nslabs == 0)
+		return 0;
+	if (src->nslabs > SP_SIZE_MAX / sizeof(*slabs) - dest->nslabs || sp_size_try_add(dest->capacity, src->capacity)) {
+		error(("size_t overflow detected, pool size limit reached"));
+		return 2;
+	}
+	slabs = realloc(dest->slabs, (dest->nslabs + src->nslabs) * sizeof(*slabs));
+	if (slabs == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	memmove(slabs + pos + cur + src->nslabs, slabs + pos + cur, (dest->nslabs - pos - cur) * sizeof(*slabs));
+	if (cur)
+		slabs[pos + src->used] = slabs[pos];
+	memcpy(slabs + pos, src->slabs, src->used * sizeof(*slabs));
+	memcpy(slabs + pos + src->used + cur, src->slabs + src->used, (src->nslabs - src->used) * sizeof(*slabs));
+
+	dest->slabs = slabs;
+	if (src->free != NULL) {
+		if (dest->free == NULL)
+			dest->free = src->free;
+		else
+			*(void**)dest->tail = src->free;
+		dest->tail = src->tail;
+	}
+	if (cur) {
+		/* The slab src was carving now lies among the used up ones */
+		while (src->left != 0) {
+			void *const block = SP_POOL_CARVE(src);
+			if (dest->free == NULL)
+				dest->tail = block;
+			*(void**)block = dest->free;
+			dest->free = block;
+		}
+		dest->used += src->used;
+	} else {
+		dest->used = src->used;
+		dest->left = src->left;
+	}
+	dest->nslabs   += src->nslabs;
+	dest->size     += src->size;
+	dest->capacity += src->capacity;
+
+	free(src->slabs);
+	src->slabs    = NULL;
+	src->free     = NULL;
+	src->tail     = NULL;
+	src->size     = 0;
+	src->capacity = 0;
+	src->nslabs   = 0;
+	src->used     = 0;
+	src->left     = 0;
+	return 0;
+}
@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pool.h"
+
+/* Takes a block from the free list of a pool, or carves it out of the slabs,
+ * moving on to the next slab once the current one is used up and appending a
+ * new one if there is none left. No hooks are invoked, which lets modules that
+ * embed a pool keep their own error handling. Returns 2 on size_t overflow, 1
+ * on allocation failure and 0 otherwise.
+ */
+int sp_pool_take(struct sp_pool *pool, void **block)
+{
+	int err;
+	if (pool->free != NULL) {
+		*block = pool->free;
+		pool->free = *(void**)pool->free;
+	} else {
+		if (pool->left == 0) {
+			if (pool->used == pool->nslabs && (err = sp_pool_grow(pool, 1)))
+				return err;
+			pool->left = pool->slabs[pool->used++].size;
+		}
+		*block = SP_POOL_CARVE(pool);
+	}
+	++pool->size;
+	return 0;
+}
@@ -0,0 +1,29 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+
+/* Portable population count, see SP_POPCOUNT. Works for any width of unsigned
+ * long up to 255 bits. */
+size_t sp_popcount(unsigned long x)
+{
+	x = x - ((x >> 1) & (~0UL / 3));
+	x = (x & (~0UL / 15 * 3)) + ((x >> 2) & (~0UL / 15 * 3));
+	x = (x + (x >> 4)) & (~0UL / 255 * 15);
+	return (size_t)((x * (~0UL / 255)) >> (sizeof(x) - 1) * CHAR_BIT);
+}
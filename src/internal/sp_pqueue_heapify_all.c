@@ -0,0 +1,31 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pqueue.h"
+
+/* Restores the heap property of the whole queue in linear time, by sifting
+ * down every element which has children, from the last one to the root */
+void sp_pqueue_heapify_all(struct sp_pqueue *pq)
+{
+	size_t i;
+	if (pq->size < 2)
+		return;
+	for (i = (pq->size - 2) / pq->arity + 1; i-- > 0;)
+		sp_pqueue_siftdown(pq, i);
+}
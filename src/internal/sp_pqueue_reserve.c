@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pqueue.h"
+
+/* Makes room for n more elements, at least doubling the capacity. Return
+ * values are identical to sp_buf_fit. */
+int sp_pqueue_reserve(struct sp_pqueue *pq, size_t n)
+{
+	const size_t max = SP_SIZE_MAX / pq->elem_size;
+	size_t capacity;
+	void *p;
+
+	if (n <= pq->capacity - pq->size)
+		return 0;
+	if (n > max - pq->size) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return 2;
+	}
+	capacity = pq->capacity <= max / 2 ? pq->capacity * 2 : max;
+	capacity = MAX(capacity, pq->size + n);
+	if ((p = realloc(pq->data, capacity * pq->elem_size)) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	pq->data     = p;
+	pq->capacity = capacity;
+	return 0;
+}
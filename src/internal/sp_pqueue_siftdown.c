@@ -0,0 +1,37 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_pqueue.h"
+
+/* Moves the element at idx towards the leaves, until it comes before all of
+ * its children */
+void sp_pqueue_siftdown(struct sp_pqueue *pq, size_t idx)
+{
+	while (pq->size >= 2 && idx <= (pq->size - 2) / pq->arity) {
+		size_t child = idx * pq->arity + 1, best = child;
+		const size_t end = pq->size - child > pq->arity ? child + pq->arity : pq->size;
+		for (++child; child < end; child++)
+			if (SP_PQUEUE_BEFORE(pq, SP_PQUEUE_ELEM(pq, child), SP_PQUEUE_ELEM(pq, best)))
+				best = child;
+		if (!SP_PQUEUE_BEFORE(pq, SP_PQUEUE_ELEM(pq, best), SP_PQUEUE_ELEM(pq, idx)))
+			break;
+		sp_memswap(SP_PQUEUE_ELEM(pq, idx), SP_PQUEUE_ELEM(pq, best), pq->elem_size);
+		idx = best;
+	}
+}
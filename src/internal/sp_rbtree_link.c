@@ -0,0 +1,56 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_rbtree.h"
+
+/* Attaches a new red leaf at link, which is a child pointer of parent (or the
+ * root pointer), and restores the red-black properties. At most two rotations
+ * are made, and recoloring goes up the tree in amortized constant time. */
+void sp_rbtree_link(struct sp_rbtree *tree, struct sp_rbnode *parent, struct sp_rbnode **link, struct sp_rbnode *node)
+{
+	node->left   = NULL;
+	node->right  = NULL;
+	node->parent = parent;
+	node->color  = SP_RBTREE_RED;
+	*link = node;
+	++tree->size;
+
+	while ((parent = node->parent) != NULL && parent->color == SP_RBTREE_RED) {
+		/* A red parent is never the root, so the grandparent exists */
+		struct sp_rbnode *const gparent = parent->parent;
+		const int left = parent == gparent->left;
+		struct sp_rbnode *const uncle = left ? gparent->right : gparent->left;
+		if (!SP_RBTREE_IS_BLACK(uncle)) {
+			parent->color  = SP_RBTREE_BLACK;
+			uncle->color   = SP_RBTREE_BLACK;
+			gparent->color = SP_RBTREE_RED;
+			node = gparent;
+			continue;
+		}
+		if (node == (left ? parent->right : parent->left)) {
+			sp_rbtree_rotate(tree, parent, !left);
+			parent = node;
+		}
+		parent->color  = SP_RBTREE_BLACK;
+		gparent->color = SP_RBTREE_RED;
+		sp_rbtree_rotate(tree, gparent, left);
+		break;
+	}
+	tree->root->color = SP_RBTREE_BLACK;
+}
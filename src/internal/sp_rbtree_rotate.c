@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_rbtree.h"
+
+/* Rotates the subtree of node to the right (or left), and puts the new root
+ * of the subtree in place of node */
+void sp_rbtree_rotate(struct sp_rbtree *tree, struct sp_rbnode *node, int right)
+{
+	struct sp_rbnode *const pivot  = right ? node->left : node->right,
+	                 *const inner  = right ? pivot->right : pivot->left,
+	                 *const parent = node->parent;
+	if (right) {
+		node->left   = inner;
+		pivot->right = node;
+	} else {
+		node->right  = inner;
+		pivot->left  = node;
+	}
+	if (inner != NULL)
+		inner->parent = node;
+	pivot->parent = parent;
+	node->parent  = pivot;
+	if (parent == NULL)
+		tree->root = pivot;
+	else if (parent->left == node)
+		parent->left = pivot;
+	else
+		parent->right = pivot;
+}
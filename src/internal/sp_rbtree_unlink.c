@@ -0,0 +1,100 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_rbtree.h"
+
+/* Detaches a node from a red-black tree and restores the red-black properties.
+ * A node with two children is replaced by its successor, which is relinked
+ * instead of copied, because nodes belong to the user. */
+void sp_rbtree_unlink(struct sp_rbtree *tree, struct sp_rbnode *node)
+{
+	struct sp_rbnode *const nparent = node->parent;
+	struct sp_rbnode **const link = nparent == NULL ? &tree->root
+		: nparent->left == node ? &nparent->left : &nparent->right;
+	struct sp_rbnode *child, *parent;
+	int color;
+
+	if (node->left == NULL || node->right == NULL) {
+		child  = node->left != NULL ? node->left : node->right;
+		parent = nparent;
+		color  = node->color;
+		if (child != NULL)
+			child->parent = parent;
+		*link = child;
+	} else {
+		struct sp_rbnode *succ = node->right;
+		while (succ->left != NULL)
+			succ = succ->left;
+		child = succ->right;
+		color = succ->color;
+		if (succ->parent == node) {
+			parent = succ;
+		} else {
+			parent = succ->parent;
+			parent->left = child;
+			if (child != NULL)
+				child->parent = parent;
+			succ->right = node->right;
+			succ->right->parent = succ;
+		}
+		succ->left = node->left;
+		succ->left->parent = succ;
+		succ->parent = nparent;
+		succ->color  = node->color;
+		*link = succ;
+	}
+	--tree->size;
+	if (color == SP_RBTREE_RED)
+		return;
+
+	/* A black node is gone, so the path through child lacks one black node.
+	 * Since it did have one, child has a sibling. */
+	while (child != tree->root && SP_RBTREE_IS_BLACK(child)) {
+		const int left = child == parent->left;
+		struct sp_rbnode *sib = left ? parent->right : parent->left, *near, *far;
+		if (sib->color == SP_RBTREE_RED) {
+			sib->color    = SP_RBTREE_BLACK;
+			parent->color = SP_RBTREE_RED;
+			sp_rbtree_rotate(tree, parent, !left);
+			sib = left ? parent->right : parent->left;
+		}
+		near = left ? sib->left : sib->right;
+		far  = left ? sib->right : sib->left;
+		if (SP_RBTREE_IS_BLACK(near) && SP_RBTREE_IS_BLACK(far)) {
+			sib->color = SP_RBTREE_RED;
+			child  = parent;
+			parent = child->parent;
+			continue;
+		}
+		if (SP_RBTREE_IS_BLACK(far)) {
+			near->color = SP_RBTREE_BLACK;
+			sib->color  = SP_RBTREE_RED;
+			sp_rbtree_rotate(tree, sib, left);
+			far = sib;
+			sib = near;
+		}
+		sib->color    = parent->color;
+		parent->color = SP_RBTREE_BLACK;
+		far->color    = SP_RBTREE_BLACK;
+		sp_rbtree_rotate(tree, parent, !left);
+		child = tree->root;
+	}
+	if (child != NULL)
+		child->color = SP_RBTREE_BLACK;
+}
@@ -24,36 +24,22 @@
  * <0;size>. */
 void sp_ringbuf_insert(const void *elem, size_t idx, void *buf, size_t *size, size_t capacity, size_t elem_size, void **head, void **tail)
 {
-	void *s, *d;
-	size_t i;
+	void *d;
 	/* The new element splits the original buffer into 2 sub-buffers. Since
 	 * the entire buffer is circular, we can choose which of the 2
 	 * sub-buffers to shift away to make room. We pick the smaller one to
-	 * minimize the number of shifts.
+	 * minimize the number of bytes moved.
 	 */
 	if (*size != 0) {
 		if (idx < *size / 2) {
-			s = *head;
+			const size_t h = ((char*)*head - (char*)buf) / elem_size;
+			sp_ringbuf_shl(buf, capacity, elem_size, h, idx);
 			sp_ringbuf_decr(head, buf, capacity, elem_size);
-			d = *head;
-			i = 0;
-			while (i != idx) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_incr(&s, buf, capacity, elem_size);
-				++i;
-			}
+			d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
 		} else {
-			s = *tail;
+			d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
+			sp_ringbuf_shr(buf, capacity, elem_size, ((char*)d - (char*)buf) / elem_size, *size - idx);
 			sp_ringbuf_incr(tail, buf, capacity, elem_size);
-			d = *tail;
-			i = *size;
-			while (i != idx) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_decr(&s, buf, capacity, elem_size);
-				--i;
-			}
 		}
 	} else {
 		d = *tail;
@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Move n consecutive ring buffer elements from physical index from to physical
+ * index to, with the semantics of memmove. Both ranges may wrap around, so the
+ * copy is split into at most 3 contiguous spans at the points where either of
+ * them reaches the end of the buffer. When the destination starts at least n
+ * slots ahead of the source the spans are copied front to back, otherwise back
+ * to front, so no element is overwritten before it has been read. The
+ * destination may overlap the beginning or the end of the source, not both.
+ */
+void sp_ringbuf_move(void *buf, size_t capacity, size_t elem_size, size_t to, size_t from, size_t n)
+{
+	char *const p = buf;
+	size_t len;
+	if (n == 0 || to == from)
+		return;
+	if ((to < from ? to + (capacity - from) : to - from) >= n) {
+		while (n != 0) {
+			len = MIN(n, MIN(capacity - from, capacity - to));
+			memmove(p + to * elem_size, p + from * elem_size, len * elem_size);
+			from = from + len == capacity ? 0 : from + len;
+			to   = to + len == capacity ? 0 : to + len;
+			n -= len;
+		}
+	} else {
+		/* Work from one past the last element of either range */
+		from = n > capacity - from ? n - (capacity - from) : from + n;
+		to   = n > capacity - to ? n - (capacity - to) : to + n;
+		while (n != 0) {
+			len = MIN(n, MIN(from, to));
+			from -= len;
+			to   -= len;
+			memmove(p + to * elem_size, p + from * elem_size, len * elem_size);
+			from = from == 0 ? capacity : from;
+			to   = to == 0 ? capacity : to;
+			n -= len;
+		}
+	}
+}
@@ -17,39 +17,26 @@
  */
 #include "../internal.h"
 #include <stdlib.h>
-#include <string.h>
 
 /* Remove an element from a ring buffer. Indexing starts from left to right,
  * valid index values are in range <0;size>.
  */
 void sp_ringbuf_remove(size_t idx, void *buf, size_t *size, size_t capacity, size_t elem_size, void **head, void **tail)
 {
-	void *s, *d;
 	/* The gap from the removed element splits the original buffer into 2
 	 * sub-buffers.  Since the entire buffer is circular, we can choose
 	 * which of the 2 sub-buffers to shift to cover the gap. We pick the
-	 * smaller one to minimize the number of shifts.
+	 * smaller one to minimize the number of bytes moved.
 	 */
 	if (*size != 1) {
 		if (idx < *size / 2) {
-			s = d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
-			sp_ringbuf_decr(&s, buf, capacity, elem_size);
-			while (idx != 0) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_decr(&s, buf, capacity, elem_size);
-				--idx;
-			}
+			const size_t h = ((char*)*head - (char*)buf) / elem_size;
+			sp_ringbuf_shr(buf, capacity, elem_size, h, idx);
 			sp_ringbuf_incr(head, buf, capacity, elem_size);
 		} else {
-			s = d = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
+			void *s = sp_ringbuf_get(idx, buf, capacity, elem_size, *head);
 			sp_ringbuf_incr(&s, buf, capacity, elem_size);
-			while (idx != *size - 1) {
-				memcpy(d, s, elem_size);
-				d = s;
-				sp_ringbuf_incr(&s, buf, capacity, elem_size);
-				++idx;
-			}
+			sp_ringbuf_shl(buf, capacity, elem_size, ((char*)s - (char*)buf) / elem_size, *size - idx - 1);
 			sp_ringbuf_decr(tail, buf, capacity, elem_size);
 		}
 	}
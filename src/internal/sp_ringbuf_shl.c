@@ -0,0 +1,43 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Shift n consecutive ring buffer elements, the first of which resides at
+ * physical index start, one slot to the left. The slot preceding start must be
+ * unoccupied. Rather than moving the elements one at a time, the range is split
+ * into at most 3 contiguous spans:
+ * 	(1)	_ _ _ _ _ 1 2 3	the elements up to the end of the buffer,
+ * 	(2)	4 _ _ _ _ _ _ _	the element that wraps from index 0 to the end,
+ * 	(3)	_ 5 6 7 _ _ _ _	the remaining elements after index 0.
+ */
+void sp_ringbuf_shl(void *buf, size_t capacity, size_t elem_size, size_t start, size_t n)
+{
+	char *const p = buf;
+	if (n == 0)
+		return;
+	if (start != 0) {
+		const size_t len = MIN(n, capacity - start);
+		memmove(p + (start - 1) * elem_size, p + start * elem_size, len * elem_size);
+		if ((n -= len) == 0)
+			return;
+	}
+	memcpy(p + (capacity - 1) * elem_size, p, elem_size);
+	memmove(p, p + elem_size, (n - 1) * elem_size);
+}
@@ -0,0 +1,42 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Shift n consecutive ring buffer elements, the first of which resides at
+ * physical index start, one slot to the right. The slot following the last
+ * element must be unoccupied. This is the mirror image of sp_ringbuf_shl, the
+ * spans are processed in reverse order.
+ */
+void sp_ringbuf_shr(void *buf, size_t capacity, size_t elem_size, size_t start, size_t n)
+{
+	char *const p = buf;
+	if (n == 0)
+		return;
+	if (n > capacity - start) {
+		const size_t len = n - (capacity - start);
+		memmove(p + elem_size, p, len * elem_size);
+		n -= len;
+	}
+	if (n == capacity - start) {
+		memcpy(p, p + (capacity - 1) * elem_size, elem_size);
+		--n;
+	}
+	memmove(p + (start + 1) * elem_size, p + start * elem_size, n * elem_size);
+}
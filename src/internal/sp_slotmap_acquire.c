@@ -0,0 +1,52 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_slotmap.h"
+
+/* Appends an uninitialized element to a slot map, which the caller has to
+ * fill in at position size - 1, and gives it a slot. Returns 0, or SP_ERANGE
+ * or SP_ENOMEM if the map could not grow. */
+int sp_slotmap_acquire(struct sp_slotmap *sm, struct sp_slotmap_handle *handle)
+{
+	struct sp_slotmap_slot *slot;
+	size_t idx;
+	int err;
+
+	/* Slots are reused in the order they were freed, so that generations
+	 * of any single slot advance as slowly as possible */
+	if (sm->nfree == 0) {
+		if (sm->count == sm->capacity && (err = sp_slotmap_reserve(sm)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		idx = sm->count++;
+		sm->slots[idx].gen = 0;
+	} else {
+		idx = sm->head;
+		sm->head = sm->slots[idx].pos;
+		--sm->nfree;
+	}
+	slot = sm->slots + idx;
+	++slot->gen;
+	slot->pos = sm->size;
+	sm->owner[sm->size++] = idx;
+	if (handle != NULL) {
+		handle->idx = (unsigned long)idx;
+		handle->gen = slot->gen;
+	}
+	return 0;
+}
@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_slotmap.h"
+#include <string.h>
+
+/* Removes the element at position pos of a slot map, and frees its slot */
+void sp_slotmap_release(struct sp_slotmap *sm, size_t pos)
+{
+	const size_t idx = sm->owner[pos], last = --sm->size;
+	struct sp_slotmap_slot *const slot = sm->slots + idx;
+
+	/* The last element fills the hole, and its slot follows it */
+	if (pos != last) {
+		memcpy(SP_SLOTMAP_ELEM(sm, pos), SP_SLOTMAP_ELEM(sm, last), sm->elem_size);
+		sm->owner[pos] = sm->owner[last];
+		sm->slots[sm->owner[pos]].pos = pos;
+	}
+
+	/* A slot whose generation wraps around is never used again, as its
+	 * old handles would become valid */
+	slot->gen = (slot->gen + 1) & SP_SLOTMAP_MAX;
+	if (slot->gen == 0)
+		return;
+	if (sm->nfree++ == 0)
+		sm->head = idx;
+	else
+		sm->slots[sm->tail].pos = idx;
+	sm->tail = idx;
+}
@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_slotmap.h"
+
+/* Doubles the capacity of all buffers of a slot map. Return values are
+ * identical to sp_buf_fit. */
+int sp_slotmap_reserve(struct sp_slotmap *sm)
+{
+	const size_t max = MIN(SP_SIZE_MAX / MAX(sm->elem_size, sizeof(struct sp_slotmap_slot)),
+			(size_t)SP_SLOTMAP_MAX);
+	size_t capacity;
+	void *p;
+
+	if (sm->capacity >= max) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return 2;
+	}
+	capacity = sm->capacity <= max / 2 ? sm->capacity * 2 : max;
+
+	/* A failure leaves the larger buffers in place, which is harmless */
+	if ((p = realloc(sm->data, capacity * sm->elem_size)) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	sm->data = p;
+	if ((p = realloc(sm->owner, capacity * sizeof(size_t))) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	sm->owner = p;
+	if ((p = realloc(sm->slots, capacity * sizeof(struct sp_slotmap_slot))) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	sm->slots    = p;
+	sm->capacity = capacity;
+	return 0;
+}
@@ -0,0 +1,96 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_sparse.h"
+#include <string.h>
+
+/* Builds a CSR or CSC matrix out of the entries of a COO builder, with two
+ * passes of a stable counting sort: first by the minor index (column for CSR),
+ * then by the major index. Entries thus end up sorted by both, and duplicate
+ * entries end up adjacent, in order of insertion. */
+struct sp_sparse *sp_sparse_compress(const struct sp_sparse_coo *coo, int format)
+{
+	const size_t nnz       = coo->size,
+	             elem_size = coo->elem_size,
+	             nmajor    = format == SP_SPARSE_CSR ? coo->rows : coo->cols,
+	             nminor    = format == SP_SPARSE_CSR ? coo->cols : coo->rows;
+	const size_t *const major = format == SP_SPARSE_CSR ? coo->row_idx : coo->col_idx,
+	             *const minor = format == SP_SPARSE_CSR ? coo->col_idx : coo->row_idx;
+	struct sp_sparse *ret;
+	size_t *count, *perm, i;
+
+	if (nmajor >= SP_SIZE_MAX / sizeof(size_t) || nminor >= SP_SIZE_MAX / sizeof(size_t)) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	ret->ptr  = malloc((nmajor + 1) * sizeof(size_t));
+	ret->idx  = malloc(MAX(nnz, 1) * sizeof(size_t));
+	ret->vals = malloc(MAX(nnz, 1) * elem_size);
+	count     = malloc((nminor + 1) * sizeof(size_t));
+	perm      = malloc(MAX(nnz, 1) * sizeof(size_t));
+	if (ret->ptr == NULL || ret->idx == NULL || ret->vals == NULL || count == NULL || perm == NULL) {
+		error(("malloc"));
+		free(ret->ptr);
+		free(ret->idx);
+		free(ret->vals);
+		free(count);
+		free(perm);
+		free(ret);
+		return NULL;
+	}
+
+	/* perm lists the entries ordered by minor index */
+	memset(count, 0, (nminor + 1) * sizeof(size_t));
+	for (i = 0; i < nnz; i++)
+		++count[minor[i] + 1];
+	for (i = 1; i < nminor; i++)
+		count[i] += count[i - 1];
+	for (i = 0; i < nnz; i++)
+		perm[count[minor[i]]++] = i;
+
+	/* Scatter them by major index, using ptr as the insertion cursor of
+	 * every major index, and shift it back into place afterwards */
+	memset(ret->ptr, 0, (nmajor + 1) * sizeof(size_t));
+	for (i = 0; i < nnz; i++)
+		++ret->ptr[major[i] + 1];
+	for (i = 1; i < nmajor; i++)
+		ret->ptr[i] += ret->ptr[i - 1];
+	for (i = 0; i < nnz; i++) {
+		const size_t q = perm[i], dst = ret->ptr[major[q]]++;
+		ret->idx[dst] = minor[q];
+		memcpy((char*)ret->vals + dst * elem_size, (char*)coo->vals + q * elem_size, elem_size);
+	}
+	for (i = nmajor; i > 0; i--)
+		ret->ptr[i] = ret->ptr[i - 1];
+	ret->ptr[0] = 0;
+	free(count);
+	free(perm);
+
+	ret->elem_size = elem_size;
+	ret->rows      = coo->rows;
+	ret->cols      = coo->cols;
+	ret->nnz       = nnz;
+	ret->format    = format;
+	return ret;
+}
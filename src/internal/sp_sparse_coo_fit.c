@@ -0,0 +1,57 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_sparse.h"
+
+/* Makes room for one more entry in a COO builder, doubling the capacity of all
+ * three of its arrays. Each array is only replaced once it has been grown, so
+ * a failure leaves the builder intact. Returns 1 if memory allocation failed,
+ * or 2 if the capacity cannot grow any further. */
+int sp_sparse_coo_fit(struct sp_sparse_coo *coo)
+{
+	const size_t max = SP_SIZE_MAX / MAX(coo->elem_size, sizeof(size_t));
+	size_t capacity;
+	void *p;
+
+	if (coo->size < coo->capacity)
+		return 0;
+	if (coo->capacity >= max) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return 2;
+	}
+	capacity = coo->capacity <= max / 2 ? coo->capacity * 2 : max;
+
+	if ((p = realloc(coo->vals, capacity * coo->elem_size)) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	coo->vals = p;
+	if ((p = realloc(coo->row_idx, capacity * sizeof(size_t))) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	coo->row_idx = p;
+	if ((p = realloc(coo->col_idx, capacity * sizeof(size_t))) == NULL) {
+		error(("realloc"));
+		return 1;
+	}
+	coo->col_idx = p;
+	coo->capacity = capacity;
+	return 0;
+}
@@ -0,0 +1,37 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ulist.h"
+
+/* Takes the spare node of an unrolled list, or allocates a new one. The node
+ * is empty and not linked yet. Returns NULL on allocation failure.
+ */
+struct sp_ulist_node *sp_ulist_alloc(struct sp_ulist *ulist)
+{
+	struct sp_ulist_node *node = ulist->spare;
+	if (node != NULL) {
+		ulist->spare = NULL;
+	} else if ((node = malloc(ulist->data_offset + ulist->node_cap * ulist->elem_size)) == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	node->count = 0;
+	++ulist->nnodes;
+	return node;
+}
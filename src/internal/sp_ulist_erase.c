@@ -0,0 +1,68 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ulist.h"
+#include <string.h>
+
+/* Removes the idx-th element of a node of an unrolled list, where start is the
+ * position of the first element of the node within the list. A node left less
+ * than half full is merged with a neighbour, or takes elements over from it if
+ * they do not fit in a single node together, so that every node other than
+ * the head and the tail stays at least half full.
+ */
+void sp_ulist_erase(struct sp_ulist *ulist, struct sp_ulist_node *node, size_t idx, size_t start)
+{
+	const size_t elem_size = ulist->elem_size;
+	struct sp_ulist_node *const prev = node->prev, *const next = node->next;
+
+	memmove(SP_ULIST_ELEM(ulist, node, idx), SP_ULIST_ELEM(ulist, node, idx + 1), (node->count - idx - 1) * elem_size);
+	--node->count;
+	--ulist->size;
+	ulist->cursor     = node;
+	ulist->cursor_idx = start;
+	if (node->count >= ulist->node_cap / 2)
+		return;
+
+	if (next != NULL && node->count + next->count <= ulist->node_cap) {
+		memcpy(SP_ULIST_ELEM(ulist, node, node->count), SP_ULIST_ELEM(ulist, next, 0), next->count * elem_size);
+		node->count += next->count;
+		sp_ulist_release(ulist, next);
+	} else if (prev != NULL && prev->count + node->count <= ulist->node_cap) {
+		memcpy(SP_ULIST_ELEM(ulist, prev, prev->count), SP_ULIST_ELEM(ulist, node, 0), node->count * elem_size);
+		ulist->cursor_idx = start - prev->count;
+		prev->count += node->count;
+		sp_ulist_release(ulist, node);
+		ulist->cursor = prev;
+	} else if (next != NULL) {
+		const size_t n = (next->count - node->count) / 2;
+		memcpy(SP_ULIST_ELEM(ulist, node, node->count), SP_ULIST_ELEM(ulist, next, 0), n * elem_size);
+		memmove(SP_ULIST_ELEM(ulist, next, 0), SP_ULIST_ELEM(ulist, next, n), (next->count - n) * elem_size);
+		node->count += n;
+		next->count -= n;
+	} else if (prev != NULL) {
+		const size_t n = (prev->count - node->count) / 2;
+		memmove(SP_ULIST_ELEM(ulist, node, n), SP_ULIST_ELEM(ulist, node, 0), node->count * elem_size);
+		memcpy(SP_ULIST_ELEM(ulist, node, 0), SP_ULIST_ELEM(ulist, prev, prev->count - n), n * elem_size);
+		prev->count -= n;
+		node->count += n;
+		ulist->cursor_idx = start - n;
+	} else if (node->count == 0) {
+		sp_ulist_release(ulist, node);
+	}
+}
@@ -0,0 +1,43 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ulist.h"
+
+/* Unlinks a node from an unrolled list. One node is kept aside for reuse, so
+ * that splitting and merging the same nodes back and forth does not keep
+ * calling malloc.
+ */
+void sp_ulist_release(struct sp_ulist *ulist, struct sp_ulist_node *node)
+{
+	if (node->prev == NULL)
+		ulist->head = node->next;
+	else
+		node->prev->next = node->next;
+	if (node->next == NULL)
+		ulist->tail = node->prev;
+	else
+		node->next->prev = node->prev;
+	if (ulist->cursor == node)
+		ulist->cursor = NULL;
+	--ulist->nnodes;
+	if (ulist->spare == NULL)
+		ulist->spare = node;
+	else
+		free(node);
+}
@@ -0,0 +1,54 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ulist.h"
+
+/* Finds the node holding the idx-th element of an unrolled list, and turns idx
+ * into the index of the element within that node. The walk starts from the
+ * head, the tail or the node found by the previous lookup, whichever is
+ * closest, and skips whole nodes by their counts. The node found becomes the
+ * new cursor. idx must be smaller than the size of the list.
+ */
+struct sp_ulist_node *sp_ulist_seek(struct sp_ulist *ulist, size_t *idx)
+{
+	struct sp_ulist_node *node = ulist->head;
+	size_t start = 0, dist = *idx;
+
+	if (ulist->size - *idx < dist) {
+		node  = ulist->tail;
+		start = ulist->size - node->count;
+		dist  = ulist->size - *idx;
+	}
+	if (ulist->cursor != NULL && (*idx > ulist->cursor_idx ? *idx - ulist->cursor_idx : ulist->cursor_idx - *idx) < dist) {
+		node  = ulist->cursor;
+		start = ulist->cursor_idx;
+	}
+	while (*idx < start) {
+		node   = node->prev;
+		start -= node->count;
+	}
+	while (*idx - start >= node->count) {
+		start += node->count;
+		node   = node->next;
+	}
+	ulist->cursor     = node;
+	ulist->cursor_idx = start;
+	*idx -= start;
+	return node;
+}
@@ -0,0 +1,94 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_ulist.h"
+#include <string.h>
+
+/* Opens a gap for a new element at position idx of an unrolled list, where idx
+ * may be equal to the size of the list, and returns its address. A full node
+ * is split in half, except at either end of the list, where a new node is
+ * started instead, so that pushing elements fills the nodes completely.
+ * Returns NULL on allocation failure.
+ */
+void *sp_ulist_slot(struct sp_ulist *ulist, size_t idx)
+{
+	const size_t elem_size = ulist->elem_size;
+	struct sp_ulist_node *node;
+	size_t start;
+
+	if (ulist->head == NULL) {
+		if ((node = sp_ulist_alloc(ulist)) == NULL)
+			return NULL;
+		node->prev  = NULL;
+		node->next  = NULL;
+		ulist->head = node;
+		ulist->tail = node;
+		start = 0;
+	} else if (idx == ulist->size) {
+		node  = ulist->tail;
+		start = ulist->size - node->count;
+		idx   = node->count;
+	} else {
+		node  = sp_ulist_seek(ulist, &idx);
+		start = ulist->cursor_idx;
+	}
+
+	if (node->count == ulist->node_cap) {
+		struct sp_ulist_node *const fresh = sp_ulist_alloc(ulist);
+		if (fresh == NULL)
+			return NULL;
+		if (idx == 0 && node->prev == NULL) {
+			fresh->prev = NULL;
+			fresh->next = node;
+			node->prev  = fresh;
+			ulist->head = fresh;
+			node = fresh;
+		} else {
+			const size_t half = node->count / 2;
+			fresh->prev = node;
+			fresh->next = node->next;
+			if (node->next == NULL)
+				ulist->tail = fresh;
+			else
+				node->next->prev = fresh;
+			node->next = fresh;
+			if (idx == node->count && fresh->next == NULL) {
+				start += node->count;
+				node = fresh;
+				idx  = 0;
+			} else {
+				memcpy(SP_ULIST_ELEM(ulist, fresh, 0), SP_ULIST_ELEM(ulist, node, half), (node->count - half) * elem_size);
+				fresh->count = node->count - half;
+				node->count  = half;
+				if (idx > half) {
+					start += half;
+					node = fresh;
+					idx -= half;
+				}
+			}
+		}
+	}
+
+	memmove(SP_ULIST_ELEM(ulist, node, idx + 1), SP_ULIST_ELEM(ulist, node, idx), (node->count - idx) * elem_size);
+	++node->count;
+	++ulist->size;
+	ulist->cursor     = node;
+	ulist->cursor_idx = start;
+	return SP_ULIST_ELEM(ulist, node, idx);
+}
@@ -0,0 +1,36 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_wheel.h"
+
+/* Empties the slot which the next tick selects on a level above the first, and
+ * places its timers again, on the levels below.
+ */
+void sp_wheel_cascade(struct sp_wheel *wheel, int level)
+{
+	struct sp_wheel_link *const slot = &wheel->slots[level * SP_WHEEL_SLOTS + (((wheel->now + 1) >> (level * SP_WHEEL_BITS)) & (SP_WHEEL_SLOTS - 1))];
+	struct sp_wheel_link *link = slot->next;
+
+	slot->next = slot->prev = slot;
+	while (link != slot) {
+		struct sp_wheel_node *const node = (struct sp_wheel_node*)link;
+		link = link->next;
+		sp_wheel_place(wheel, node);
+	}
+}
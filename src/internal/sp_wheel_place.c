@@ -0,0 +1,41 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_wheel.h"
+
+/* Links a pending timer at the back of the slot of its expiry. Counting from
+ * the next tick to be processed, a timer goes on the lowest level whose slots
+ * span its delay, where the slot is picked by the bits of the expiry which
+ * that level resolves. Timers on higher levels are cascaded down when their
+ * slot comes up, which is never before the tick they are due on.
+ */
+void sp_wheel_place(struct sp_wheel *wheel, struct sp_wheel_node *node)
+{
+	const unsigned long delta = node->expiry - (wheel->now + 1);
+	struct sp_wheel_link *slot;
+	int level = 0;
+
+	while (level < SP_WHEEL_LEVELS - 1 && (delta >> ((level + 1) * SP_WHEEL_BITS)) != 0)
+		++level;
+	slot = &wheel->slots[level * SP_WHEEL_SLOTS + ((node->expiry >> (level * SP_WHEEL_BITS)) & (SP_WHEEL_SLOTS - 1))];
+	node->link.prev  = slot->prev;
+	node->link.next  = slot;
+	slot->prev->next = &node->link;
+	slot->prev       = &node->link;
+}
@@ -0,0 +1,30 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../internal.h"
+#include <stdlib.h>
+#include "../sp_wheel.h"
+
+/* Gives an unlinked timer back to the pool of its wheel. Bumping the
+ * generation invalidates every handle to it. A node whose generation wraps
+ * around is never used again, as its old handles would become valid. */
+void sp_wheel_release(struct sp_wheel *wheel, struct sp_wheel_node *node)
+{
+	if (++node->gen != 0)
+		sp_pool_give(&wheel->pool, node);
+	--wheel->size;
+}
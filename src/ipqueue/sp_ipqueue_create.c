@@ -0,0 +1,74 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+
+struct sp_ipqueue *sp_ipqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*))
+{
+	struct sp_ipqueue *ret;
+
+#ifdef STAPLE_DEBUG
+	if (elem_size == 0) {
+		error(("elem_size cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+	if (arity == 1) {
+		error(("arity must be at least 2"));
+		return NULL;
+	}
+	if (order != SP_PQUEUE_MIN && order != SP_PQUEUE_MAX) {
+		error(("order must be SP_PQUEUE_MIN or SP_PQUEUE_MAX"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(elem_size, sizeof(size_t))) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = 0;
+	ret->count     = 0;
+	ret->capacity  = capacity;
+	ret->arity     = arity ? arity : SP_PQUEUE_ARITY;
+	ret->order     = order;
+	ret->cmp       = cmp;
+	ret->data      = malloc(capacity * elem_size);
+	ret->heap      = malloc(capacity * sizeof(size_t));
+	ret->pos       = malloc(capacity * sizeof(size_t));
+	if (ret->data == NULL || ret->heap == NULL || ret->pos == NULL) {
+		error(("malloc"));
+		free(ret->data);
+		free(ret->heap);
+		free(ret->pos);
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_ipqueue_pop(struct sp_ipqueue *ipq, int (*dtor)(void*))
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return SP_EINVAL;
+	}
+	if (ipq->size == 0) {
+		error(("ipq is empty"));
+		return SP_EILLEGAL;
+	}
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL && (err = dtor(SP_IPQUEUE_ELEM(ipq, ipq->heap[0])))) {
+		error(("callback function dtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	sp_ipqueue_detach(ipq, 0);
+	if (ipq->size > 0)
+		sp_ipqueue_siftdown(ipq, 0);
+	return 0;
+}
@@ -0,0 +1,52 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_ipqueue_printb(const struct sp_ipqueue *ipq)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return SP_EINVAL;
+	}
+	if (ipq->elem_size != sizeof(_Bool)) {
+		error(("ipq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)ipq->elem_size, sizeof(_Bool)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_ipqueue_printb()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", arity: "SP_SIZE_FMT", order: %s\n",
+		(SP_SIZE_T)ipq->size, (SP_SIZE_T)ipq->capacity, (SP_SIZE_T)ipq->elem_size, (SP_SIZE_T)ipq->arity,
+		ipq->order == SP_PQUEUE_MIN ? "min" : "max");
+	for (i = 0; i < ipq->size; i++) {
+		const _Bool elem = ((_Bool*)ipq->data)[ipq->heap[i]];
+		printf("["SP_SIZE_FMT"]\t#"SP_SIZE_FMT"\t""%d""\n", (SP_SIZE_T)i, (SP_SIZE_T)ipq->heap[i], elem);
+	}
+	return 0;
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_ipqueue_push(struct sp_ipqueue *ipq, const void *elem, size_t *handle)
+{
+	size_t h;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return SP_EINVAL;
+	}
+	if (elem == NULL) {
+		error(("elem is NULL"));
+		return SP_EINVAL;
+	}
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Reuse the most recently freed handle, if there is one */
+	if (ipq->size == ipq->count) {
+		if ((err = sp_ipqueue_reserve(ipq)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		ipq->heap[ipq->size] = ipq->count;
+		ipq->pos[ipq->count] = ipq->size;
+		++ipq->count;
+	}
+	h = ipq->heap[ipq->size];
+	memcpy(SP_IPQUEUE_ELEM(ipq, h), elem, ipq->elem_size);
+	sp_ipqueue_siftup(ipq, ipq->size++);
+	if (handle != NULL)
+		*handle = h;
+	return 0;
+}
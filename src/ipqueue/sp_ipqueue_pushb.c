@@ -0,0 +1,62 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_ipqueue_pushb(struct sp_ipqueue *ipq, _Bool elem, size_t *handle)
+{
+	size_t h;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return SP_EINVAL;
+	}
+	if (ipq->elem_size != sizeof(elem)) {
+		error(("ipq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)ipq->elem_size, sizeof(elem)));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* See sp_ipqueue_push() */
+	if (ipq->size == ipq->count) {
+		if ((err = sp_ipqueue_reserve(ipq)))
+			return err == 2 ? SP_ERANGE : SP_ENOMEM;
+		ipq->heap[ipq->size] = ipq->count;
+		ipq->pos[ipq->count] = ipq->size;
+		++ipq->count;
+	}
+	h = ipq->heap[ipq->size];
+	((_Bool*)ipq->data)[h] = elem;
+	if (ipq->order == SP_PQUEUE_MIN)
+		SP_IPQUEUE_SIFTUP(_Bool, ipq, ipq->size, SP_PQUEUE_LT);
+	else
+		SP_IPQUEUE_SIFTUP(_Bool, ipq, ipq->size, SP_PQUEUE_GT);
+	++ipq->size;
+	if (handle != NULL)
+		*handle = h;
+	return 0;
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
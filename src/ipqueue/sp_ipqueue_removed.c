@@ -0,0 +1,53 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+
+double sp_ipqueue_removed(struct sp_ipqueue *ipq, size_t handle)
+{
+	size_t idx;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return 0;
+	}
+	if (ipq->elem_size != sizeof(double)) {
+		error(("ipq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)ipq->elem_size, sizeof(double)));
+		return 0;
+	}
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return 0;
+	}
+#endif
+	/* See sp_ipqueue_remove() */
+	idx = ipq->pos[handle];
+	sp_ipqueue_detach(ipq, idx);
+	if (idx < ipq->size) {
+		const size_t moved = ipq->heap[idx];
+		if (ipq->order == SP_PQUEUE_MIN) {
+			SP_IPQUEUE_SIFTUP(double, ipq, idx, SP_PQUEUE_LT);
+			SP_IPQUEUE_SIFTDOWN(double, ipq, ipq->pos[moved], SP_PQUEUE_LT);
+		} else {
+			SP_IPQUEUE_SIFTUP(double, ipq, idx, SP_PQUEUE_GT);
+			SP_IPQUEUE_SIFTDOWN(double, ipq, ipq->pos[moved], SP_PQUEUE_GT);
+		}
+	}
+	return ((double*)ipq->data)[handle];
+}
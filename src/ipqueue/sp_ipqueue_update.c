@@ -0,0 +1,52 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_ipqueue_update(struct sp_ipqueue *ipq, size_t handle, const void *elem)
+{
+	int up;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return SP_EINVAL;
+	}
+	if (elem == NULL) {
+		error(("elem is NULL"));
+		return SP_EINVAL;
+	}
+	if (ipq->cmp == NULL) {
+		error(("ipq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return SP_EINDEX;
+	}
+#endif
+	/* A key which moved towards the top can only go up, and vice versa */
+	up = SP_PQUEUE_BEFORE(ipq, elem, SP_IPQUEUE_ELEM(ipq, handle));
+	memcpy(SP_IPQUEUE_ELEM(ipq, handle), elem, ipq->elem_size);
+	if (up)
+		sp_ipqueue_siftup(ipq, ipq->pos[handle]);
+	else
+		sp_ipqueue_siftdown(ipq, ipq->pos[handle]);
+	return 0;
+}
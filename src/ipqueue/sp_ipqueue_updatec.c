@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ipqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_ipqueue_updatec(struct sp_ipqueue *ipq, size_t handle, char elem)
+{
+	char *p;
+#ifdef STAPLE_DEBUG
+	if (ipq == NULL) {
+		error(("ipq is NULL"));
+		return SP_EINVAL;
+	}
+	if (ipq->elem_size != sizeof(elem)) {
+		error(("ipq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)ipq->elem_size, sizeof(elem)));
+		return SP_EILLEGAL;
+	}
+	if (!SP_IPQUEUE_LIVE(ipq, handle)) {
+		error(("invalid handle"));
+		return SP_EINDEX;
+	}
+#endif
+	/* See sp_ipqueue_update() */
+	p = (char*)ipq->data + handle;
+	if (ipq->order == SP_PQUEUE_MIN) {
+		const int up = SP_PQUEUE_LT(elem, *p);
+		*p = elem;
+		if (up)
+			SP_IPQUEUE_SIFTUP(char, ipq, ipq->pos[handle], SP_PQUEUE_LT);
+		else
+			SP_IPQUEUE_SIFTDOWN(char, ipq, ipq->pos[handle], SP_PQUEUE_LT);
+	} else {
+		const int up = SP_PQUEUE_GT(elem, *p);
+		*p = elem;
+		if (up)
+			SP_IPQUEUE_SIFTUP(char, ipq, ipq->pos[handle], SP_PQUEUE_GT);
+		else
+			SP_IPQUEUE_SIFTDOWN(char, ipq, ipq->pos[handle], SP_PQUEUE_GT);
+	}
+	return 0;
+}
@@ -0,0 +1,60 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_list.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_list_copy(struct sp_list *dest, const struct sp_list *src, int (*cpy)(void*, const void*))
+{
+	const struct sp_list_node *s;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != src->elem_size) {
+		error(("dest->elem_size does not match src->elem_size"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Once cleared, every node of dest is free. Reserve the rest up front,
+	 * so that running out of memory leaves dest empty, not half-copied. */
+	sp_list_clear(dest, NULL);
+	if ((err = sp_pool_reserve(&dest->pool, src->size)))
+		return err;
+	for (s = src->head; s != NULL; s = s->next) {
+		void *d;
+		sp_pool_take(&dest->pool, &d);
+		if (cpy == NULL) {
+			memcpy((char*)d + dest->data_offset, (const char*)s + src->data_offset, src->elem_size);
+		} else if ((err = cpy((char*)d + dest->data_offset, (const char*)s + src->data_offset))) {
+			error(("callback function cpy returned %d (non-0)", err));
+			sp_pool_give(&dest->pool, d);
+			return SP_ECALLBK;
+		}
+		sp_list_link(dest, NULL, d, d);
+		++dest->size;
+	}
+	return 0;
+}
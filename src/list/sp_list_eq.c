@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_list.h"
+#include "../internal.h"
+#include <string.h>
+
+int sp_list_eq(const struct sp_list *list1, const struct sp_list *list2, int (*cmp)(const void*, const void*))
+{
+	const struct sp_list_node *p, *q;
+#ifdef STAPLE_DEBUG
+	if (list1 == NULL) {
+		error(("list1 is NULL"));
+		return 0;
+	}
+	if (list2 == NULL) {
+		error(("list2 is NULL"));
+		return 0;
+	}
+#endif
+	if (list1->elem_size != list2->elem_size || list1->size != list2->size)
+		return 0;
+	for (p = list1->head, q = list2->head; p != NULL; p = p->next, q = q->next) {
+		const void *const a = (const char*)p + list1->data_offset,
+		           *const b = (const char*)q + list2->data_offset;
+		if (cmp ? cmp(a, b) : memcmp(a, b, list1->elem_size))
+			return 0;
+	}
+	return 1;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_list.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_list_insertafter(struct sp_list *list, struct sp_list_node *node, const void *elem)
+{
+	void *new;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (list == NULL) {
+		error(("list is NULL"));
+		return SP_EINVAL;
+	}
+	if (node == NULL) {
+		error(("node is NULL"));
+		return SP_EINVAL;
+	}
+	if (elem == NULL) {
+		error(("elem is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if ((err = sp_pool_take(&list->pool, &new)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)new + list->data_offset, elem, list->elem_size);
+	sp_list_link(list, node->next, new, new);
+	++list->size;
+	return 0;
+}
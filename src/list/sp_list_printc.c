@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_list.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_list_printc(const struct sp_list *list)
+{
+	const struct sp_list_node *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	if (list == NULL) {
+		error(("list is NULL"));
+		return SP_EINVAL;
+	}
+	if (list->elem_size != sizeof(char)) {
+		error(("list->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)list->elem_size, sizeof(char)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_list_printc()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)list->size, (SP_SIZE_T)list->pool.capacity, (SP_SIZE_T)list->elem_size);
+	for (node = list->head; node != NULL; node = node->next) {
+		const char elem = *(const char*)((const char*)node + list->data_offset);
+		printf("["SP_SIZE_FMT"]\t""%hd\t'%c'""\n", (SP_SIZE_T)i++, elem, elem);
+	}
+	return 0;
+}
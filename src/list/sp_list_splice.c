@@ -0,0 +1,54 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_list.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_list_splice(struct sp_list *dest, struct sp_list_node *pos, struct sp_list *src)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == src) {
+		error(("dest and src are the same list"));
+		return SP_EILLEGAL;
+	}
+	if (dest->elem_size != src->elem_size) {
+		error(("dest->elem_size does not match src->elem_size"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* The nodes stay where they are, so dest takes over the pool of src */
+	if ((err = sp_pool_merge(&dest->pool, &src->pool)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	if (src->head != NULL)
+		sp_list_link(dest, pos, src->head, src->tail);
+	dest->size += src->size;
+
+	src->head = NULL;
+	src->tail = NULL;
+	src->size = 0;
+	return 0;
+}
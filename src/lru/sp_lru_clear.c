@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_lru.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_lru_clear(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (lru == NULL) {
+		error(("lru is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (i = lru->head; i != lru->capacity; i = lru->entries[i].next) {
+		int err;
+		if (kdtor != NULL && (err = kdtor(SP_LRU_KEY(lru, i)))) {
+			error(("callback function kdtor returned %d (non-0)", err));
+			return SP_ECALLBK;
+		}
+		if (vdtor != NULL && (err = vdtor(SP_LRU_VAL(lru, i)))) {
+			error(("callback function vdtor returned %d (non-0)", err));
+			return SP_ECALLBK;
+		}
+	}
+	sp_hashmap_clear(lru->index, NULL, NULL);
+	sp_lru_reset(lru);
+	return 0;
+}
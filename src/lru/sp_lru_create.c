@@ -0,0 +1,76 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_lru.h"
+#include "../internal.h"
+
+struct sp_lru *sp_lru_create(size_t key_size, size_t val_size, size_t capacity, size_t max_weight, size_t (*hash)(const void*), int (*cmp)(const void*, const void*), int (*evict)(void*, void*))
+{
+	struct sp_lru *ret;
+
+#ifdef STAPLE_DEBUG
+	if (key_size == 0) {
+		error(("key_size cannot be 0"));
+		return NULL;
+	}
+	if (val_size == 0) {
+		error(("val_size cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(MAX(key_size, val_size), sizeof(struct sp_lru_entry))) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* The index is sized for capacity up front, and never holds more */
+	ret->index      = sp_hashmap_create(key_size, sizeof(size_t), capacity, hash, cmp);
+	ret->entries    = malloc(capacity * sizeof(struct sp_lru_entry));
+	ret->keys       = malloc(capacity * key_size);
+	ret->vals       = malloc(capacity * val_size);
+	if (ret->index == NULL || ret->entries == NULL || ret->keys == NULL || ret->vals == NULL) {
+		error(("malloc"));
+		if (ret->index != NULL)
+			sp_hashmap_destroy(ret->index, NULL, NULL);
+		free(ret->entries);
+		free(ret->keys);
+		free(ret->vals);
+		free(ret);
+		return NULL;
+	}
+	ret->key_size   = key_size;
+	ret->val_size   = val_size;
+	ret->capacity   = capacity;
+	ret->max_weight = max_weight;
+	ret->hits       = 0;
+	ret->misses     = 0;
+	ret->evictions  = 0;
+	ret->evict      = evict;
+	sp_lru_reset(ret);
+
+	return ret;
+}
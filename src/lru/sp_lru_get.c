@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_lru.h"
+#include "../internal.h"
+
+void *sp_lru_get(struct sp_lru *lru, const void *key)
+{
+	const size_t *pos;
+#ifdef STAPLE_DEBUG
+	if (lru == NULL) {
+		error(("lru is NULL"));
+		return NULL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return NULL;
+	}
+#endif
+	if ((pos = sp_hashmap_get(lru->index, key)) == NULL) {
+		++lru->misses;
+		return NULL;
+	}
+	++lru->hits;
+	if (lru->head != *pos) {
+		sp_lru_unlink(lru, *pos);
+		sp_lru_link(lru, *pos);
+	}
+	return SP_LRU_VAL(lru, *pos);
+}
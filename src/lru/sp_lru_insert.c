@@ -0,0 +1,74 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_lru.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_lru_insert(struct sp_lru *lru, const void *key, const void *val, size_t weight)
+{
+	const size_t *pos;
+	size_t idx, old;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (lru == NULL) {
+		error(("lru is NULL"));
+		return SP_EINVAL;
+	}
+	if (key == NULL) {
+		error(("key is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (lru->max_weight != 0 && weight > lru->max_weight)
+		return SP_ERANGE;
+
+	/* An existing entry moves to the front first, so that making room
+	 * never evicts it */
+	pos = sp_hashmap_get(lru->index, key);
+	idx = pos != NULL ? *pos : lru->capacity;
+	old = 0;
+	if (idx != lru->capacity) {
+		sp_lru_unlink(lru, idx);
+		sp_lru_link(lru, idx);
+		old = lru->entries[idx].weight;
+	}
+	while ((idx == lru->capacity && lru->size == lru->capacity)
+			|| (lru->max_weight != 0 && lru->weight - old > lru->max_weight - weight)) {
+		if ((err = sp_lru_evict(lru)))
+			return err;
+	}
+
+	if (idx == lru->capacity) {
+		idx = lru->free;
+		if ((err = sp_hashmap_insert(lru->index, key, &idx)))
+			return err;
+		lru->free = lru->entries[idx].next;
+		memcpy(SP_LRU_KEY(lru, idx), key, lru->key_size);
+		sp_lru_link(lru, idx);
+		++lru->size;
+	}
+	memcpy(SP_LRU_VAL(lru, idx), val, lru->val_size);
+	lru->weight = lru->weight - old + weight;
+	lru->entries[idx].weight = weight;
+	return 0;
+}
@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_lru.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_lru_print(const struct sp_lru *lru, int (*func)(const void*, const void*))
+{
+	size_t i, n = 0;
+#ifdef STAPLE_DEBUG
+	if (lru == NULL) {
+		error(("lru is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_lru_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", weight/max_weight: "SP_SIZE_FMT"/"SP_SIZE_FMT", hits: %lu, misses: %lu, evictions: %lu\n",
+		(SP_SIZE_T)lru->size, (SP_SIZE_T)lru->capacity, (SP_SIZE_T)lru->weight, (SP_SIZE_T)lru->max_weight,
+		lru->hits, lru->misses, lru->evictions);
+	for (i = lru->head; i != lru->capacity; i = lru->entries[i].next) {
+		const void *const key = SP_LRU_KEY(lru, i),
+		           *const val = SP_LRU_VAL(lru, i);
+		int err;
+		printf("["SP_SIZE_FMT"]\t"SP_SIZE_FMT"\t", (SP_SIZE_T)n++, (SP_SIZE_T)lru->entries[i].weight);
+		if (func == NULL)
+			printf("%p\t%p\n", key, val);
+		else if ((err = func(key, val))) {
+			error(("callback function func returned %d (non-0)", err));
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
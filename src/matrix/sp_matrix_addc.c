@@ -0,0 +1,79 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_addc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (a == NULL) {
+		error(("a is NULL"));
+		return SP_EINVAL;
+	}
+	if (b == NULL) {
+		error(("b is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(char)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(char)));
+		return SP_EILLEGAL;
+	}
+	if (a->elem_size != sizeof(char)) {
+		error(("a->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)a->elem_size, sizeof(char)));
+		return SP_EILLEGAL;
+	}
+	if (b->elem_size != sizeof(char)) {
+		error(("b->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)b->elem_size, sizeof(char)));
+		return SP_EILLEGAL;
+	}
+	if (!SP_MATRIX_SAME_SHAPE(dest, a) || !SP_MATRIX_SAME_SHAPE(dest, b)) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(a) && SP_MATRIX_PACKED(b)) {
+		const char *const pa = a->data, *const pb = b->data;
+		char *const pc = dest->data;
+		for (i = 0; i < dest->size; i++)
+			pc[i] = pa[i] + pb[i];
+		return 0;
+	}
+	for (k = 0; k < dest->depth; k++)
+	for (i = 0; i < dest->rows; i++) {
+		const char *const pa = (char*)SP_MATRIX_ELEM(a, k, i, 0),
+		             *const pb = (char*)SP_MATRIX_ELEM(b, k, i, 0);
+		char *const pc = (char*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t acs = a->cstride, bcs = b->cstride, ccs = dest->cstride;
+		if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(a) && SP_MATRIX_UNIT_ROWS(b))
+			for (j = 0; j < dest->cols; j++)
+				pc[j] = pa[j] + pb[j];
+		else
+			for (j = 0; j < dest->cols; j++)
+				pc[j * ccs] = pa[j * acs] + pb[j * bcs];
+	}
+	return 0;
+}
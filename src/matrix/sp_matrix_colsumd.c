@@ -0,0 +1,69 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_colsumd(struct sp_matrix *dest, const struct sp_matrix *src)
+{
+	size_t k;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(double)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (src->elem_size != sizeof(double)) {
+		error(("src->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)src->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (dest->depth != src->depth || dest->rows != 1 || dest->cols != src->cols) {
+		error(("dest dimensions do not match column sums of src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Accumulate whole rows instead of walking down columns, so that
+	 * memory is read sequentially */
+	for (k = 0; k < src->depth; k++) {
+		double *const pd = (double*)SP_MATRIX_ELEM(dest, k, 0, 0);
+		const size_t cols = src->cols, scs = src->cstride, dcs = dest->cstride;
+		size_t i, j;
+		for (i = 0; i < src->rows; i++) {
+			const double *const ps = (double*)SP_MATRIX_ELEM(src, k, i, 0);
+			if (i == 0)
+				for (j = 0; j < cols; j++)
+					pd[j * dcs] = ps[j * scs];
+			else if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(src))
+				for (j = 0; j < cols; j++)
+					pd[j] += ps[j];
+			else
+				for (j = 0; j < cols; j++)
+					pd[j * dcs] += ps[j * scs];
+		}
+	}
+	return 0;
+}
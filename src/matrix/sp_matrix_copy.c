@@ -0,0 +1,64 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_matrix_copy(struct sp_matrix *dest, const struct sp_matrix *src, int (*cpy)(void*, const void*))
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != src->elem_size || dest->depth != src->depth
+			|| dest->rows != src->rows || dest->cols != src->cols) {
+		error(("dest and src dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (cpy == NULL && SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(src)) {
+		memcpy(dest->data, src->data, src->size * src->elem_size);
+		return 0;
+	}
+	for (k = 0; k < src->depth; k++)
+	for (i = 0; i < src->rows; i++) {
+		if (cpy == NULL && SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(src)) {
+			memcpy(SP_MATRIX_ELEM(dest, k, i, 0), SP_MATRIX_ELEM(src, k, i, 0), src->cols * src->elem_size);
+			continue;
+		}
+		for (j = 0; j < src->cols; j++) {
+			int err;
+			void *const p = SP_MATRIX_ELEM(dest, k, i, j);
+			const void *const q = SP_MATRIX_ELEM(src, k, i, j);
+			if (cpy == NULL)
+				memcpy(p, q, src->elem_size);
+			else if ((err = cpy(p, q))) {
+				error(("callback function cpy returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,71 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+
+struct sp_matrix *sp_matrix_create(size_t elem_size, size_t depth, size_t rows, size_t cols, size_t align)
+{
+	struct sp_matrix *ret;
+	size_t size, offset;
+
+#ifdef STAPLE_DEBUG
+	if (elem_size == 0) {
+		error(("elem_size cannot be 0"));
+		return NULL;
+	}
+	if (depth == 0 || rows == 0 || cols == 0) {
+		error(("matrix dimensions cannot be 0"));
+		return NULL;
+	}
+	if (align & (align - 1)) {
+		error(("align must be a power of 2"));
+		return NULL;
+	}
+#endif
+	align = MAX(align, SP_ALIGNOF_SIZE(elem_size));
+	size  = depth * rows * cols;
+	if ((rows != 0 && depth > SP_SIZE_MAX / rows)
+			|| (cols != 0 && depth * rows > SP_SIZE_MAX / cols)
+			|| align > SP_SIZE_MAX - sizeof(*ret)
+			|| (elem_size != 0 && size > (SP_SIZE_MAX - sizeof(*ret) - align) / elem_size)) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	/* The elements follow the structure in the same block of memory,
+	 * starting at the first address aligned to align bytes */
+	ret = malloc(sizeof(*ret) + align - 1 + size * elem_size);
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	offset = (size_t)((char*)ret + sizeof(*ret)) % align;
+
+	ret->data      = (char*)ret + sizeof(*ret) + (align - offset) % align;
+	ret->elem_size = elem_size;
+	ret->depth     = depth;
+	ret->rows      = rows;
+	ret->cols      = cols;
+	ret->size      = size;
+	ret->align     = align;
+	ret->pstride   = rows * cols;
+	ret->rstride   = cols;
+	ret->cstride   = 1;
+
+	return ret;
+}
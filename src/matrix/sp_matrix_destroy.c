@@ -0,0 +1,46 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_destroy(struct sp_matrix *matrix, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	if (matrix == NULL) {
+		error(("matrix is NULL"));
+		return SP_EINVAL;
+	}
+	if (matrix->align == 0) {
+		error(("cannot destroy a matrix view"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (dtor != NULL) {
+		size_t i;
+		for (i = 0; i < matrix->size; i++) {
+			int err;
+			if ((err = dtor((char*)matrix->data + i * matrix->elem_size))) {
+				error(("callback function dtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	}
+	free(matrix);
+	return 0;
+}
@@ -0,0 +1,51 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include <string.h>
+
+int sp_matrix_eq(const struct sp_matrix *matrix1, const struct sp_matrix *matrix2, int (*cmp)(const void*, const void*))
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (matrix1 == NULL) {
+		error(("matrix1 is NULL"));
+		return 0;
+	}
+	if (matrix2 == NULL) {
+		error(("matrix2 is NULL"));
+		return 0;
+	}
+#endif
+	if (matrix1->elem_size != matrix2->elem_size
+			|| matrix1->depth != matrix2->depth
+			|| matrix1->rows  != matrix2->rows
+			|| matrix1->cols  != matrix2->cols)
+		return 0;
+	if (cmp == NULL && SP_MATRIX_PACKED(matrix1) && SP_MATRIX_PACKED(matrix2))
+		return !memcmp(matrix1->data, matrix2->data, matrix1->size * matrix1->elem_size);
+	for (k = 0; k < matrix1->depth; k++)
+	for (i = 0; i < matrix1->rows; i++)
+	for (j = 0; j < matrix1->cols; j++) {
+		const void *const p = SP_MATRIX_ELEM(matrix1, k, i, j),
+		           *const q = SP_MATRIX_ELEM(matrix2, k, i, j);
+		if (cmp == NULL ? memcmp(p, q, matrix1->elem_size) : cmp(p, q))
+			return 0;
+	}
+	return 1;
+}
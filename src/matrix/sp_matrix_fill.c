@@ -0,0 +1,51 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_matrix_fill(struct sp_matrix *matrix, const void *val)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (matrix == NULL) {
+		error(("matrix is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (SP_MATRIX_PACKED(matrix)) {
+		/* Copy the first element, then keep doubling the filled region */
+		size_t done;
+		memcpy(matrix->data, val, matrix->elem_size);
+		for (done = 1; done < matrix->size; done *= 2) {
+			const size_t len = MIN(done, matrix->size - done);
+			memcpy((char*)matrix->data + done * matrix->elem_size, matrix->data, len * matrix->elem_size);
+		}
+		return 0;
+	}
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++)
+	for (j = 0; j < matrix->cols; j++)
+		memcpy(SP_MATRIX_ELEM(matrix, k, i, j), val, matrix->elem_size);
+	return 0;
+}
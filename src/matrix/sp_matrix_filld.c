@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_filld(struct sp_matrix *matrix, double val)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (matrix == NULL) {
+		error(("matrix is NULL"));
+		return SP_EINVAL;
+	}
+	if (matrix->elem_size != sizeof(val)) {
+		error(("matrix->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)matrix->elem_size, sizeof(val)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (SP_MATRIX_PACKED(matrix)) {
+		double *const p = matrix->data;
+		for (i = 0; i < matrix->size; i++)
+			p[i] = val;
+		return 0;
+	}
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++) {
+		double *const p = (double*)SP_MATRIX_ELEM(matrix, k, i, 0);
+		const size_t cs = matrix->cstride;
+		for (j = 0; j < matrix->cols; j++)
+			p[j * cs] = val;
+	}
+	return 0;
+}
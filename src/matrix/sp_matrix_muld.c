@@ -0,0 +1,132 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_muld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b)
+{
+	size_t m, n, p, k;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (a == NULL) {
+		error(("a is NULL"));
+		return SP_EINVAL;
+	}
+	if (b == NULL) {
+		error(("b is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(double)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (a->elem_size != sizeof(double)) {
+		error(("a->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)a->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (b->elem_size != sizeof(double)) {
+		error(("b->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)b->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (dest == a || dest == b) {
+		error(("dest must be different from both operands"));
+		return SP_EILLEGAL;
+	}
+	if (a->depth != b->depth || dest->depth != a->depth || b->rows != a->cols
+			|| dest->rows != a->rows || dest->cols != b->cols) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	m = a->rows;
+	n = a->cols;
+	p = b->cols;
+
+	for (k = 0; k < a->depth; k++) {
+		const double *const pa = (double*)SP_MATRIX_ELEM(a, k, 0, 0),
+		             *const pb = (double*)SP_MATRIX_ELEM(b, k, 0, 0);
+		double *const pc = (double*)SP_MATRIX_ELEM(dest, k, 0, 0);
+		const size_t ars = a->rstride, acs = a->cstride,
+		             brs = b->rstride, bcs = b->cstride,
+		             crs = dest->rstride, ccs = dest->cstride;
+		size_t i, j, l, jj, ll;
+
+		/* Without unit-stride rows in b and dest (e.g. when b is a
+		 * transposed view), fall back to one dot product per element,
+		 * which then walks the columns of b sequentially instead */
+		if (!SP_MATRIX_UNIT_ROWS(b) || !SP_MATRIX_UNIT_ROWS(dest)) {
+			for (i = 0; i < m; i++)
+			for (j = 0; j < p; j++) {
+				double sum = 0;
+				for (l = 0; l < n; l++)
+					sum += pa[i * ars + l * acs] * pb[l * brs + j * bcs];
+				pc[i * crs + j * ccs] = sum;
+			}
+			continue;
+		}
+
+		/* The loops run in i-k-j order, so that the innermost loop walks
+		 * rows of b and dest with unit stride and can be vectorized by the
+		 * compiler. Each pass covers a panel of b small enough to stay in
+		 * cache, and updates 4 rows of dest at once, so that every element
+		 * loaded from b is used 4 times. */
+		for (i = 0; i < m; i++)
+			for (j = 0; j < p; j++)
+				pc[i * crs + j] = 0;
+		for (jj = 0; jj < p; jj += SP_MATRIX_TILE_J)
+		for (ll = 0; ll < n; ll += SP_MATRIX_TILE_K) {
+			const size_t jend = MIN(jj + SP_MATRIX_TILE_J, p),
+			             lend = MIN(ll + SP_MATRIX_TILE_K, n);
+			for (i = 0; i + 4 <= m; i += 4) {
+				double *const c0 = pc + i * crs, *const c1 = c0 + crs,
+				       *const c2 = c1 + crs,     *const c3 = c2 + crs;
+				const double *const a0 = pa + i * ars, *const a1 = a0 + ars,
+				             *const a2 = a1 + ars,     *const a3 = a2 + ars;
+				for (l = ll; l < lend; l++) {
+					const double x0 = a0[l * acs], x1 = a1[l * acs],
+					             x2 = a2[l * acs], x3 = a3[l * acs];
+					const double *const br = pb + l * brs;
+					for (j = jj; j < jend; j++) {
+						const double y = br[j];
+						c0[j] += x0 * y;
+						c1[j] += x1 * y;
+						c2[j] += x2 * y;
+						c3[j] += x3 * y;
+					}
+				}
+			}
+			for (; i < m; i++) {
+				double *const cr = pc + i * crs;
+				for (l = ll; l < lend; l++) {
+					const double x = pa[i * ars + l * acs];
+					const double *const br = pb + l * brs;
+					for (j = jj; j < jend; j++)
+						cr[j] += x * br[j];
+				}
+			}
+		}
+	}
+	return 0;
+}
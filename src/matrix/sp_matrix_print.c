@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_matrix_print(const struct sp_matrix *matrix, int (*func)(const void*))
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (matrix == NULL) {
+		error(("matrix is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_matrix_print()\ndepth: "SP_SIZE_FMT", rows: "SP_SIZE_FMT", cols: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)matrix->depth, (SP_SIZE_T)matrix->rows, (SP_SIZE_T)matrix->cols, (SP_SIZE_T)matrix->elem_size);
+	for (k = 0; k < matrix->depth; k++)
+	for (i = 0; i < matrix->rows; i++)
+	for (j = 0; j < matrix->cols; j++) {
+		const void *const elem = SP_MATRIX_ELEM(matrix, k, i, j);
+		int err;
+		printf("["SP_SIZE_FMT", "SP_SIZE_FMT", "SP_SIZE_FMT"]\t", (SP_SIZE_T)k, (SP_SIZE_T)i, (SP_SIZE_T)j);
+		if (func == NULL)
+			printf("%p\n", elem);
+		else if ((err = func(elem))) {
+			error(("callback function func returned %d (non-0)", err));
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
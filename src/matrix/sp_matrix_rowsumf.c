@@ -0,0 +1,59 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_rowsumf(struct sp_matrix *dest, const struct sp_matrix *src)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(float)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(float)));
+		return SP_EILLEGAL;
+	}
+	if (src->elem_size != sizeof(float)) {
+		error(("src->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)src->elem_size, sizeof(float)));
+		return SP_EILLEGAL;
+	}
+	if (dest->depth != src->depth || dest->rows != src->rows || dest->cols != 1) {
+		error(("dest dimensions do not match row sums of src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	for (k = 0; k < src->depth; k++)
+	for (i = 0; i < src->rows; i++) {
+		const float *const ps = (float*)SP_MATRIX_ELEM(src, k, i, 0);
+		const size_t scs = src->cstride;
+		float sum = 0;
+		for (j = 0; j < src->cols; j++)
+			sum += ps[j * scs];
+		*(float*)SP_MATRIX_ELEM(dest, k, i, 0) = sum;
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_scaled(struct sp_matrix *dest, const struct sp_matrix *src, double factor)
+{
+	size_t k, i, j;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(double)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (src->elem_size != sizeof(double)) {
+		error(("src->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)src->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+	if (!SP_MATRIX_SAME_SHAPE(dest, src)) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* See sp_matrix_emul() */
+	if (SP_MATRIX_PACKED(dest) && SP_MATRIX_PACKED(src)) {
+		const double *const ps = src->data;
+		double *const pd = dest->data;
+		for (i = 0; i < dest->size; i++) {
+			double x = -(double)0;
+			x += ps[i] * factor;
+			pd[i] = x;
+		}
+		return 0;
+	}
+	for (k = 0; k < dest->depth; k++)
+	for (i = 0; i < dest->rows; i++) {
+		const double *const ps = (double*)SP_MATRIX_ELEM(src, k, i, 0);
+		double *const pd = (double*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t scs = src->cstride, dcs = dest->cstride;
+		if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(src))
+			for (j = 0; j < dest->cols; j++) {
+				double x = -(double)0;
+				x += ps[j] * factor;
+				pd[j] = x;
+			}
+		else
+			for (j = 0; j < dest->cols; j++) {
+				double x = -(double)0;
+				x += ps[j * scs] * factor;
+				pd[j * dcs] = x;
+			}
+	}
+	return 0;
+}
@@ -0,0 +1,56 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_slice(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row, size_t col, size_t depth, size_t rows, size_t cols)
+{
+#ifdef STAPLE_DEBUG
+	if (view == NULL) {
+		error(("view is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (depth == 0 || rows == 0 || cols == 0) {
+		error(("view dimensions cannot be 0"));
+		return SP_EILLEGAL;
+	}
+	if (plane >= src->depth || depth > src->depth - plane
+			|| row >= src->rows || rows > src->rows - row
+			|| col >= src->cols || cols > src->cols - col) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	/* The strides of src carry over unchanged, only the origin moves */
+	view->data      = SP_MATRIX_ELEM(src, plane, row, col);
+	view->elem_size = src->elem_size;
+	view->depth     = depth;
+	view->rows      = rows;
+	view->cols      = cols;
+	view->size      = depth * rows * cols;
+	view->align     = 0;
+	view->pstride   = src->pstride;
+	view->rstride   = src->rstride;
+	view->cstride   = src->cstride;
+	return 0;
+}
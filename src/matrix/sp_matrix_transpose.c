@@ -0,0 +1,78 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_matrix_transpose(struct sp_matrix *dest, const struct sp_matrix *src)
+{
+	size_t rows, cols, elem_size, k;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == src) {
+		error(("dest and src must be different matrices"));
+		return SP_EILLEGAL;
+	}
+	if (dest->elem_size != src->elem_size || dest->depth != src->depth
+			|| dest->rows != src->cols || dest->cols != src->rows) {
+		error(("dest dimensions do not match transposed src"));
+		return SP_EILLEGAL;
+	}
+#endif
+	rows      = src->rows;
+	cols      = src->cols;
+	elem_size = src->elem_size;
+
+	/* Swap square tiles small enough for both the rows read from src and
+	 * the rows written to dest to stay in cache. Common element sizes are
+	 * copied with a constant size, so that the copy compiles to a move. */
+	for (k = 0; k < src->depth; k++) {
+		const char *const s = SP_MATRIX_ELEM(src, k, 0, 0);
+		char *const       d = SP_MATRIX_ELEM(dest, k, 0, 0);
+		const size_t srs = src->rstride,  scs = src->cstride,
+		             drs = dest->rstride, dcs = dest->cstride;
+		size_t ii, jj;
+		for (ii = 0; ii < rows; ii += SP_MATRIX_BLOCK)
+		for (jj = 0; jj < cols; jj += SP_MATRIX_BLOCK) {
+			const size_t iend = MIN(ii + SP_MATRIX_BLOCK, rows),
+			             jend = MIN(jj + SP_MATRIX_BLOCK, cols);
+			size_t i, j;
+#define SP_MATRIX_TRANSPOSE_TILE(N) \
+			for (i = ii; i < iend; i++) \
+				for (j = jj; j < jend; j++) \
+					memcpy(d + (j * drs + i * dcs) * (N), s + (i * srs + j * scs) * (N), (N))
+			switch (elem_size) {
+			case 1:  SP_MATRIX_TRANSPOSE_TILE(1);         break;
+			case 2:  SP_MATRIX_TRANSPOSE_TILE(2);         break;
+			case 4:  SP_MATRIX_TRANSPOSE_TILE(4);         break;
+			case 8:  SP_MATRIX_TRANSPOSE_TILE(8);         break;
+			default: SP_MATRIX_TRANSPOSE_TILE(elem_size); break;
+			}
+#undef SP_MATRIX_TRANSPOSE_TILE
+		}
+	}
+	return 0;
+}
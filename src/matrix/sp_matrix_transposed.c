@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_matrix.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_matrix_transposed(struct sp_matrix *view, const struct sp_matrix *src)
+{
+	size_t rows, rstride;
+#ifdef STAPLE_DEBUG
+	if (view == NULL) {
+		error(("view is NULL"));
+		return SP_EINVAL;
+	}
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	/* Saved first, in case view and src are the same structure */
+	rows    = src->rows;
+	rstride = src->rstride;
+
+	view->data      = src->data;
+	view->elem_size = src->elem_size;
+	view->depth     = src->depth;
+	view->rows      = src->cols;
+	view->cols      = rows;
+	view->size      = src->size;
+	view->align     = 0;
+	view->pstride   = src->pstride;
+	view->rstride   = src->cstride;
+	view->cstride   = rstride;
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_pool.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_pool_free(struct sp_pool *pool, void *block)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	size_t i;
+	if (pool == NULL) {
+		error(("pool is NULL"));
+		return SP_EINVAL;
+	}
+	if (block == NULL) {
+		error(("block is NULL"));
+		return SP_EINVAL;
+	}
+	for (i = 0; i < pool->nslabs; i++) {
+		const struct sp_pool_slab *const slab = &pool->slabs[i];
+		if ((char*)block >= slab->data && (char*)block < slab->data + slab->size * pool->stride)
+			break;
+	}
+	if (i == pool->nslabs || ((char*)block - pool->slabs[i].data) % pool->stride != 0) {
+		error(("block was not allocated from this pool"));
+		return SP_EILLEGAL;
+	}
+	if (pool->size == 0) {
+		error(("pool has no blocks in use"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (pool->dtor != NULL && (err = pool->dtor(block))) {
+		error(("callback function dtor returned %d (non-0)", err));
+		return SP_ECALLBK;
+	}
+	sp_pool_give(pool, block);
+	return 0;
+}
@@ -0,0 +1,41 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_pool.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_pool_print(const struct sp_pool *pool)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (pool == NULL) {
+		error(("pool is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_pool_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", block_size: "SP_SIZE_FMT", stride: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)pool->size, (SP_SIZE_T)pool->capacity, (SP_SIZE_T)pool->block_size, (SP_SIZE_T)pool->stride);
+	for (i = 0; i < pool->nslabs; i++) {
+		const size_t carved = i + 1 < pool->used ? pool->slabs[i].size
+			: i + 1 == pool->used ? pool->slabs[i].size - pool->left : 0;
+		printf("["SP_SIZE_FMT"]\t"SP_SIZE_FMT"/"SP_SIZE_FMT"\t%p\n", (SP_SIZE_T)i,
+			(SP_SIZE_T)carved, (SP_SIZE_T)pool->slabs[i].size, (void*)pool->slabs[i].data);
+	}
+	return 0;
+}
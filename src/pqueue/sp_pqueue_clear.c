@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_pqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_pqueue_clear(struct sp_pqueue *pq, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	if (pq == NULL) {
+		error(("pq is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (dtor != NULL) {
+		const void *const end = (char*)pq->data + pq->size * pq->elem_size;
+		char *p = pq->data;
+		while (p != end) {
+			int err;
+			if ((err = dtor(p))) {
+				error(("callback function dtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+			p += pq->elem_size;
+		}
+	}
+	pq->size = 0;
+	return 0;
+}
@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_pqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_pqueue_heapify(struct sp_pqueue *pq, const void *arr, size_t n)
+{
+	size_t i;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (pq == NULL) {
+		error(("pq is NULL"));
+		return SP_EINVAL;
+	}
+	if (arr == NULL) {
+		error(("arr is NULL"));
+		return SP_EINVAL;
+	}
+	if (pq->cmp == NULL) {
+		error(("pq->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((err = sp_pqueue_reserve(pq, n)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy(SP_PQUEUE_ELEM(pq, pq->size), arr, n * pq->elem_size);
+
+	/* A few elements added to a large queue are cheaper to sift up one by
+	 * one, otherwise the whole queue is rebuilt in linear time */
+	if (n < pq->size / 8) {
+		for (i = 0; i < n; i++)
+			sp_pqueue_siftup(pq, pq->size++);
+	} else {
+		pq->size += n;
+		sp_pqueue_heapify_all(pq);
+	}
+	return 0;
+}
@@ -0,0 +1,61 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_pqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_pqueue_heapifyf(struct sp_pqueue *pq, const float *arr, size_t n)
+{
+	size_t i;
+	int err;
+#ifdef STAPLE_DEBUG
+	if (pq == NULL) {
+		error(("pq is NULL"));
+		return SP_EINVAL;
+	}
+	if (arr == NULL) {
+		error(("arr is NULL"));
+		return SP_EINVAL;
+	}
+	if (pq->elem_size != sizeof(float)) {
+		error(("pq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)pq->elem_size, sizeof(float)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if ((err = sp_pqueue_reserve(pq, n)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((float*)pq->data + pq->size, arr, n * sizeof(float));
+
+	/* See sp_pqueue_heapify() */
+	if (n < pq->size / 8) {
+		for (i = 0; i < n; i++, pq->size++)
+			if (pq->order == SP_PQUEUE_MIN)
+				SP_PQUEUE_SIFTUP(float, pq->data, pq->size, pq->arity, SP_PQUEUE_LT);
+			else
+				SP_PQUEUE_SIFTUP(float, pq->data, pq->size, pq->arity, SP_PQUEUE_GT);
+	} else {
+		pq->size += n;
+		if (pq->order == SP_PQUEUE_MIN)
+			SP_PQUEUE_HEAPIFY(float, pq->data, pq->size, pq->arity, SP_PQUEUE_LT);
+		else
+			SP_PQUEUE_HEAPIFY(float, pq->data, pq->size, pq->arity, SP_PQUEUE_GT);
+	}
+	return 0;
+}
@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_pqueue.h"
+#include "../internal.h"
+
+char sp_pqueue_popc(struct sp_pqueue *pq)
+{
+	char ret;
+#ifdef STAPLE_DEBUG
+	if (pq == NULL) {
+		error(("pq is NULL"));
+		return 0;
+	}
+	if (pq->size == 0) {
+		error(("pq is empty"));
+		return 0;
+	}
+	if (pq->elem_size != sizeof(char)) {
+		error(("pq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)pq->elem_size, sizeof(char)));
+		return 0;
+	}
+#endif
+	ret = *(char*)pq->data;
+	if (--pq->size > 0) {
+		((char*)pq->data)[0] = ((char*)pq->data)[pq->size];
+		if (pq->order == SP_PQUEUE_MIN)
+			SP_PQUEUE_SIFTDOWN(char, pq->data, pq->size, 0, pq->arity, SP_PQUEUE_LT);
+		else
+			SP_PQUEUE_SIFTDOWN(char, pq->data, pq->size, 0, pq->arity, SP_PQUEUE_GT);
+	}
+	return ret;
+}
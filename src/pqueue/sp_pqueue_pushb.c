@@ -0,0 +1,53 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_pqueue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_pqueue_pushb(struct sp_pqueue *pq, _Bool elem)
+{
+#ifdef STAPLE_DEBUG
+	if (pq == NULL) {
+		error(("pq is NULL"));
+		return SP_EINVAL;
+	}
+	if (pq->elem_size != sizeof(elem)) {
+		error(("pq->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)pq->elem_size, sizeof(elem)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (sp_size_try_add(pq->size * pq->elem_size, pq->elem_size))
+		return SP_ERANGE;
+	if (sp_buf_fit(&pq->data, pq->size, &pq->capacity, pq->elem_size))
+		return SP_ENOMEM;
+	((_Bool*)pq->data)[pq->size] = elem;
+	if (pq->order == SP_PQUEUE_MIN)
+		SP_PQUEUE_SIFTUP(_Bool, pq->data, pq->size, pq->arity, SP_PQUEUE_LT);
+	else
+		SP_PQUEUE_SIFTUP(_Bool, pq->data, pq->size, pq->arity, SP_PQUEUE_GT);
+	++pq->size;
+	return 0;
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
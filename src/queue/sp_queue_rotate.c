@@ -0,0 +1,60 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_queue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_queue_rotate(struct sp_queue *queue, size_t n)
+{
+#ifdef STAPLE_DEBUG
+	if (queue == NULL) {
+		error(("queue is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (queue->size == 0)
+		return 0;
+	n %= queue->size;
+	if (n == 0)
+		return 0;
+	if (queue->size == queue->capacity) {
+		/* The ring is full, so only its ends need to change */
+		queue->head = sp_ringbuf_get(n, queue->data, queue->capacity, queue->elem_size, queue->head);
+		queue->tail = sp_ringbuf_get(queue->size - 1, queue->data, queue->capacity, queue->elem_size, queue->head);
+	} else {
+		const size_t capacity = queue->capacity;
+		size_t head = ((char*)queue->head - (char*)queue->data) / queue->elem_size;
+		size_t tail = ((char*)queue->tail - (char*)queue->data) / queue->elem_size;
+		if (n <= queue->size / 2) {
+			/* Move n elements from the front to the back */
+			sp_ringbuf_move(queue->data, capacity, queue->elem_size, tail == capacity - 1 ? 0 : tail + 1, head, n);
+			head = n < capacity - head ? head + n : n - (capacity - head);
+			tail = n < capacity - tail ? tail + n : n - (capacity - tail);
+		} else {
+			/* Move (size - n) elements from the back to the front */
+			n = queue->size - n;
+			head = head >= n ? head - n : head + (capacity - n);
+			tail = tail >= n ? tail - n : tail + (capacity - n);
+			sp_ringbuf_move(queue->data, capacity, queue->elem_size, head, tail == capacity - 1 ? 0 : tail + 1, n);
+		}
+		queue->head = (char*)queue->data + head * queue->elem_size;
+		queue->tail = (char*)queue->data + tail * queue->elem_size;
+	}
+	return 0;
+}
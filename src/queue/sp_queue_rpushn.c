@@ -0,0 +1,76 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_queue.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_queue_rpushn(struct sp_queue *queue, const void *elems, size_t n, int (*dtor)(void*))
+{
+	size_t drop, start, len;
+#ifdef STAPLE_DEBUG
+	if (queue == NULL) {
+		error(("queue is NULL"));
+		return SP_EINVAL;
+	}
+	if (elems == NULL) {
+		error(("elems is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (n == 0)
+		return 0;
+
+	/* Elements which would be overwritten within this very call are
+	 * skipped altogether, only the newest capacity elements are copied. */
+	if (n > queue->capacity) {
+		elems = (const char*)elems + (n - queue->capacity) * queue->elem_size;
+		n = queue->capacity;
+	}
+
+	/* Discard the oldest elements to make room */
+	drop = (n > queue->capacity - queue->size) ? n - (queue->capacity - queue->size) : 0;
+	if (dtor != NULL) {
+		while (drop != 0) {
+			int err;
+			if ((err = dtor(queue->head))) {
+				error(("callback function dtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+			sp_ringbuf_incr(&queue->head, queue->data, queue->capacity, queue->elem_size);
+			--queue->size;
+			--drop;
+		}
+	} else if (drop != 0) {
+		queue->head  = sp_ringbuf_get(drop, queue->data, queue->capacity, queue->elem_size, queue->head);
+		queue->size -= drop;
+	}
+	if (queue->size == 0)
+		queue->tail = queue->head;
+	else
+		sp_ringbuf_incr(&queue->tail, queue->data, queue->capacity, queue->elem_size);
+
+	/* Copy the new elements in at most 2 contiguous spans */
+	start = ((char*)queue->tail - (char*)queue->data) / queue->elem_size;
+	len   = MIN(n, queue->capacity - start);
+	memcpy(queue->tail, elems, len * queue->elem_size);
+	memcpy(queue->data, (const char*)elems + len * queue->elem_size, (n - len) * queue->elem_size);
+	queue->tail  = sp_ringbuf_get(n - 1, queue->data, queue->capacity, queue->elem_size, queue->tail);
+	queue->size += n;
+	return 0;
+}
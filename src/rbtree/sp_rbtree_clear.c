@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_rbtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_rbtree_clear(struct sp_rbtree *tree, int (*dtor)(struct sp_rbnode*))
+{
+	struct sp_rbnode *node;
+	int ret = 0;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	node = tree->root;
+	tree->root = NULL;
+	tree->size = 0;
+	if (dtor == NULL)
+		return 0;
+
+	/* Nodes are visited in post-order, so that each one can be freed by dtor
+	 * right after the next one has been looked up. As the nodes already left
+	 * the tree, dtor is called on all of them even if it fails. */
+	while (node != NULL && (node->left != NULL || node->right != NULL))
+		node = node->left != NULL ? node->left : node->right;
+	while (node != NULL) {
+		struct sp_rbnode *next = node->parent;
+		int err;
+		if (next != NULL && next->left == node && next->right != NULL) {
+			next = next->right;
+			while (next->left != NULL || next->right != NULL)
+				next = next->left != NULL ? next->left : next->right;
+		}
+		if ((err = dtor(node))) {
+			error(("callback function dtor returned %d (non-0)", err));
+			ret = SP_ECALLBK;
+		}
+		node = next;
+	}
+	return ret;
+}
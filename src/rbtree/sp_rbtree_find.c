@@ -0,0 +1,37 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_rbtree.h"
+#include "../internal.h"
+
+struct sp_rbnode *sp_rbtree_find(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*))
+{
+	struct sp_rbnode *node;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return NULL;
+	}
+	if (cmp == NULL) {
+		error(("cmp is NULL"));
+		return NULL;
+	}
+#endif
+	/* Of several equal nodes, the first one is found */
+	node = sp_rbtree_lowerbound(tree, key, cmp);
+	return node != NULL && cmp(key, node) == 0 ? node : NULL;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_rbtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_rbtree_insert(struct sp_rbtree *tree, struct sp_rbnode *node)
+{
+	struct sp_rbnode *parent = NULL, **link;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (node == NULL) {
+		error(("node is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* Equal nodes go right, to keep them in insertion order */
+	link = &tree->root;
+	while (*link != NULL) {
+		parent = *link;
+		link = tree->cmp(node, parent) < 0 ? &parent->left : &parent->right;
+	}
+	sp_rbtree_link(tree, parent, link, node);
+	return 0;
+}
@@ -0,0 +1,52 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_rbtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_rbtree_inserthint(struct sp_rbtree *tree, struct sp_rbnode *hint, struct sp_rbnode *node)
+{
+	struct sp_rbnode *prev;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (node == NULL) {
+		error(("node is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->cmp == NULL) {
+		error(("tree->cmp is NULL"));
+		return SP_EILLEGAL;
+	}
+#endif
+	/* The node fits right before hint (or at the end of the tree) if it is
+	 * ordered between hint and its predecessor. The free child pointer next
+	 * to them is then found without a single comparison. */
+	prev = hint == NULL ? sp_rbtree_last(tree) : sp_rbtree_prev(hint);
+	if ((hint != NULL && tree->cmp(node, hint) > 0) || (prev != NULL && tree->cmp(node, prev) < 0))
+		return sp_rbtree_insert(tree, node);
+	if (hint != NULL && hint->left == NULL)
+		sp_rbtree_link(tree, hint, &hint->left, node);
+	else if (prev != NULL)
+		sp_rbtree_link(tree, prev, &prev->right, node);
+	else
+		sp_rbtree_link(tree, NULL, &tree->root, node);
+	return 0;
+}
@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_rbtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_rbtree_print(const struct sp_rbtree *tree, int (*func)(const struct sp_rbnode*))
+{
+	const struct sp_rbnode *node;
+	size_t i = 0;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_rbtree_print()\nsize: "SP_SIZE_FMT"\n", (SP_SIZE_T)tree->size);
+	for (node = sp_rbtree_first(tree); node != NULL; node = sp_rbtree_next(node), i++) {
+		int err;
+		printf("["SP_SIZE_FMT"]\t%c\t", (SP_SIZE_T)i, node->color == SP_RBTREE_RED ? 'R' : 'B');
+		if (func == NULL)
+			printf("%p\n", (const void*)node);
+		else if ((err = func(node))) {
+			error(("callback function func returned %d (non-0)", err));
+			return SP_ECALLBK;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,41 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_segtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_segtree_addd(struct sp_segtree *tree, size_t idx, size_t n, double delta)
+{
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->elem_size != sizeof(delta)) {
+		error(("tree->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)tree->elem_size, sizeof(delta)));
+		return SP_EILLEGAL;
+	}
+	if (idx > tree->size || n > tree->size - idx) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	SP_SEGTREE_UPDATE(double, tree, idx, n, SP_SEGTREE_ADD, delta);
+	return 0;
+}
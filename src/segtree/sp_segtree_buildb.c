@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_segtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_segtree_buildb(struct sp_segtree *tree, const _Bool *vals)
+{
+	size_t i, h;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (vals == NULL) {
+		error(("vals is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->elem_size != sizeof(_Bool)) {
+		error(("tree->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)tree->elem_size, sizeof(_Bool)));
+		return SP_EILLEGAL;
+	}
+#endif
+	sp_segtree_clear(tree);
+	for (i = 0; i < tree->size; i++) {
+		_Bool *const leaf = SP_SEGTREE_NODE(_Bool, tree, tree->cap + i);
+		leaf[SP_SEGTREE_SUM] = leaf[SP_SEGTREE_MIN] = leaf[SP_SEGTREE_MAX] = vals[i];
+	}
+	for (h = 1; h <= tree->height; h++) {
+		for (i = tree->cap >> h; i < tree->cap >> (h - 1); i++)
+			SP_SEGTREE_PULL(_Bool, tree, i, h);
+	}
+	return 0;
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
@@ -0,0 +1,69 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_segtree.h"
+#include "../internal.h"
+#include <string.h>
+
+struct sp_segtree *sp_segtree_create(size_t elem_size, size_t size)
+{
+	struct sp_segtree *ret;
+	size_t cap = 1, height = 0;
+
+#ifdef STAPLE_DEBUG
+	if (elem_size == 0) {
+		error(("elem_size cannot be 0"));
+		return NULL;
+	}
+	if (size == 0) {
+		error(("size cannot be 0"));
+		return NULL;
+	}
+#endif
+	while (cap < size && cap <= SP_SIZE_MAX / 4) {
+		cap *= 2;
+		height++;
+	}
+	if (cap < size || cap > SP_SIZE_MAX / 2 / SP_SEGTREE_FIELDS / elem_size) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	ret->elem_size = elem_size;
+	ret->size      = size;
+	ret->cap       = cap;
+	ret->height    = height;
+	ret->data      = malloc(2 * cap * SP_SEGTREE_FIELDS * elem_size);
+	ret->lazy      = malloc(cap);
+	if (ret->data == NULL || ret->lazy == NULL) {
+		error(("malloc"));
+		free(ret->data);
+		free(ret->lazy);
+		free(ret);
+		return NULL;
+	}
+	memset(ret->data, 0, 2 * cap * SP_SEGTREE_FIELDS * elem_size);
+	memset(ret->lazy, 0, cap);
+
+	return ret;
+}
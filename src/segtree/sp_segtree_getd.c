@@ -0,0 +1,53 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_segtree.h"
+#include "../internal.h"
+
+double sp_segtree_getd(const struct sp_segtree *tree, size_t idx)
+{
+	size_t leaf;
+	double ret;
+	size_t h;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return 0;
+	}
+	if (tree->elem_size != sizeof(double)) {
+		error(("tree->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)tree->elem_size, sizeof(double)));
+		return 0;
+	}
+	if (idx >= tree->size) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	leaf = tree->cap + idx;
+	/* Replaying the pending updates above the leaf, oldest first, leaves
+	 * the tree as it is */
+	ret = SP_SEGTREE_NODE(double, tree, leaf)[SP_SEGTREE_SUM];
+	for (h = 1; h <= tree->height; h++) {
+		const double *const node = SP_SEGTREE_NODE(double, tree, leaf >> h);
+		if (tree->lazy[leaf >> h] == SP_SEGTREE_SET)
+			ret = node[SP_SEGTREE_VALUE];
+		else if (tree->lazy[leaf >> h] == SP_SEGTREE_ADD)
+			ret += node[SP_SEGTREE_DELTA];
+	}
+	return ret;
+}
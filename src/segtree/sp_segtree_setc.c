@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_segtree.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_segtree_setc(struct sp_segtree *tree, size_t idx, char val)
+{
+	size_t leaf;
+	char *node;
+	size_t h;
+#ifdef STAPLE_DEBUG
+	if (tree == NULL) {
+		error(("tree is NULL"));
+		return SP_EINVAL;
+	}
+	if (tree->elem_size != sizeof(val)) {
+		error(("tree->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)tree->elem_size, sizeof(val)));
+		return SP_EILLEGAL;
+	}
+	if (idx >= tree->size) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	leaf = tree->cap + idx;
+	for (h = tree->height; h >= 1; h--)
+		SP_SEGTREE_PUSH(char, tree, leaf >> h, h);
+	node = SP_SEGTREE_NODE(char, tree, leaf);
+	node[SP_SEGTREE_SUM] = node[SP_SEGTREE_MIN] = node[SP_SEGTREE_MAX] = val;
+	for (h = 1; h <= tree->height; h++)
+		SP_SEGTREE_PULL(char, tree, leaf >> h, h);
+	return 0;
+}
@@ -0,0 +1,39 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_slotmap.h"
+#include "../internal.h"
+
+struct sp_slotmap_handle sp_slotmap_at(const struct sp_slotmap *sm, size_t idx)
+{
+	struct sp_slotmap_handle ret;
+	ret.idx = 0;
+	ret.gen = 0;
+#ifdef STAPLE_DEBUG
+	if (sm == NULL) {
+		error(("sm is NULL"));
+		return ret;
+	}
+	if (idx >= sm->size) {
+		error(("index out of range"));
+		return ret;
+	}
+#endif
+	ret.idx = (unsigned long)sm->owner[idx];
+	ret.gen = sm->slots[sm->owner[idx]].gen;
+	return ret;
+}
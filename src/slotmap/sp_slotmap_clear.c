@@ -0,0 +1,45 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_slotmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_slotmap_clear(struct sp_slotmap *sm, int (*dtor)(void*))
+{
+#ifdef STAPLE_DEBUG
+	if (sm == NULL) {
+		error(("sm is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (dtor != NULL) {
+		size_t i;
+		for (i = 0; i < sm->size; i++) {
+			int err;
+			if ((err = dtor(SP_SLOTMAP_ELEM(sm, i)))) {
+				error(("callback function dtor returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	}
+
+	/* Releasing from the back moves no elements */
+	while (sm->size > 0)
+		sp_slotmap_release(sm, sm->size - 1);
+	return 0;
+}
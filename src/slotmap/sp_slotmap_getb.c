@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_slotmap.h"
+#include "../internal.h"
+#include <stdint.h>
+#include <inttypes.h>
+
+_Bool sp_slotmap_getb(const struct sp_slotmap *sm, struct sp_slotmap_handle handle)
+{
+#ifdef STAPLE_DEBUG
+	if (sm == NULL) {
+		error(("sm is NULL"));
+		return 0;
+	}
+	if (sm->elem_size != sizeof(_Bool)) {
+		error(("sm->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)sm->elem_size, sizeof(_Bool)));
+		return 0;
+	}
+#endif
+	if (!SP_SLOTMAP_LIVE(sm, handle))
+		return 0;
+	return ((_Bool*)sm->data)[sm->slots[handle.idx].pos];
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
@@ -0,0 +1,44 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_slotmap.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_slotmap_printc(const struct sp_slotmap *sm)
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (sm == NULL) {
+		error(("sm is NULL"));
+		return SP_EINVAL;
+	}
+	if (sm->elem_size != sizeof(char)) {
+		error(("sm->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)sm->elem_size, sizeof(char)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_slotmap_printc()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", slots: "SP_SIZE_FMT", free: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)sm->size, (SP_SIZE_T)sm->capacity, (SP_SIZE_T)sm->elem_size, (SP_SIZE_T)sm->count, (SP_SIZE_T)sm->nfree);
+	for (i = 0; i < sm->size; i++) {
+		const char elem = ((char*)sm->data)[i];
+		printf("["SP_SIZE_FMT"]\t#"SP_SIZE_FMT":%lu\t""%hd\t'%c'""\n", (SP_SIZE_T)i, (SP_SIZE_T)sm->owner[i], sm->slots[sm->owner[i]].gen, elem, elem);
+	}
+	return 0;
+}
@@ -0,0 +1,179 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_ART_H
+#define STAPLE_ART_H
+
+/* The adaptive radix tree module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Node types, stored in the first byte of every node */
+#define SP_ART_LEAF    0
+#define SP_ART_NODE4   1
+#define SP_ART_NODE16  2
+#define SP_ART_NODE48  3
+#define SP_ART_NODE256 4
+
+/* Number of bytes of a compressed path stored in a node */
+#define SP_ART_PREFIX 10
+
+struct sp_art_leaf {
+	unsigned char type;
+	size_t len;
+};
+
+struct sp_art_node {
+	unsigned char  type;
+	unsigned char  prefix[SP_ART_PREFIX];
+	unsigned short count;
+	size_t         prefix_len;
+	struct sp_art_leaf *term;
+};
+
+struct sp_art_node4 {
+	struct sp_art_node node;
+	unsigned char keys[4];
+	void *children[4];
+};
+
+struct sp_art_node16 {
+	struct sp_art_node node;
+	unsigned char keys[16];
+	void *children[16];
+};
+
+struct sp_art_node48 {
+	struct sp_art_node node;
+	unsigned char index[256];
+	void *children[48];
+};
+
+struct sp_art_node256 {
+	struct sp_art_node node;
+	void *children[256];
+};
+
+struct sp_art {
+	void  *root;
+	size_t val_size;
+	size_t val_offset;
+	size_t size;
+};
+
+struct sp_art *sp_art_create(size_t val_size);
+int            sp_art_clear(struct sp_art *art, int (*dtor)(void*));
+int            sp_art_destroy(struct sp_art *art, int (*dtor)(void*));
+
+int sp_art_insert(struct sp_art *art, const void *key, size_t len, const void *val);
+int sp_art_insertc(struct sp_art *art, char key, const void *val);
+int sp_art_inserts(struct sp_art *art, short key, const void *val);
+int sp_art_inserti(struct sp_art *art, int key, const void *val);
+int sp_art_insertl(struct sp_art *art, long key, const void *val);
+int sp_art_insertsc(struct sp_art *art, signed char key, const void *val);
+int sp_art_insertuc(struct sp_art *art, unsigned char key, const void *val);
+int sp_art_insertus(struct sp_art *art, unsigned short key, const void *val);
+int sp_art_insertui(struct sp_art *art, unsigned int key, const void *val);
+int sp_art_insertul(struct sp_art *art, unsigned long key, const void *val);
+int sp_art_insertf(struct sp_art *art, float key, const void *val);
+int sp_art_insertd(struct sp_art *art, double key, const void *val);
+int sp_art_insertld(struct sp_art *art, long double key, const void *val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_art_insertb(struct sp_art *art, _Bool key, const void *val);
+int sp_art_insertll(struct sp_art *art, long long key, const void *val);
+int sp_art_insertull(struct sp_art *art, unsigned long long key, const void *val);
+int sp_art_insertu8(struct sp_art *art, uint8_t key, const void *val);
+int sp_art_insertu16(struct sp_art *art, uint16_t key, const void *val);
+int sp_art_insertu32(struct sp_art *art, uint32_t key, const void *val);
+int sp_art_insertu64(struct sp_art *art, uint64_t key, const void *val);
+int sp_art_inserti8(struct sp_art *art, int8_t key, const void *val);
+int sp_art_inserti16(struct sp_art *art, int16_t key, const void *val);
+int sp_art_inserti32(struct sp_art *art, int32_t key, const void *val);
+int sp_art_inserti64(struct sp_art *art, int64_t key, const void *val);
+#endif
+int sp_art_insertstr(struct sp_art *art, const char *key, const void *val);
+
+void *sp_art_get(const struct sp_art *art, const void *key, size_t len);
+void *sp_art_getc(const struct sp_art *art, char key);
+void *sp_art_gets(const struct sp_art *art, short key);
+void *sp_art_geti(const struct sp_art *art, int key);
+void *sp_art_getl(const struct sp_art *art, long key);
+void *sp_art_getsc(const struct sp_art *art, signed char key);
+void *sp_art_getuc(const struct sp_art *art, unsigned char key);
+void *sp_art_getus(const struct sp_art *art, unsigned short key);
+void *sp_art_getui(const struct sp_art *art, unsigned int key);
+void *sp_art_getul(const struct sp_art *art, unsigned long key);
+void *sp_art_getf(const struct sp_art *art, float key);
+void *sp_art_getd(const struct sp_art *art, double key);
+void *sp_art_getld(const struct sp_art *art, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+void *sp_art_getb(const struct sp_art *art, _Bool key);
+void *sp_art_getll(const struct sp_art *art, long long key);
+void *sp_art_getull(const struct sp_art *art, unsigned long long key);
+void *sp_art_getu8(const struct sp_art *art, uint8_t key);
+void *sp_art_getu16(const struct sp_art *art, uint16_t key);
+void *sp_art_getu32(const struct sp_art *art, uint32_t key);
+void *sp_art_getu64(const struct sp_art *art, uint64_t key);
+void *sp_art_geti8(const struct sp_art *art, int8_t key);
+void *sp_art_geti16(const struct sp_art *art, int16_t key);
+void *sp_art_geti32(const struct sp_art *art, int32_t key);
+void *sp_art_geti64(const struct sp_art *art, int64_t key);
+#endif
+void *sp_art_getstr(const struct sp_art *art, const char *key);
+
+int sp_art_remove(struct sp_art *art, const void *key, size_t len, int (*dtor)(void*));
+int sp_art_removec(struct sp_art *art, char key, int (*dtor)(void*));
+int sp_art_removes(struct sp_art *art, short key, int (*dtor)(void*));
+int sp_art_removei(struct sp_art *art, int key, int (*dtor)(void*));
+int sp_art_removel(struct sp_art *art, long key, int (*dtor)(void*));
+int sp_art_removesc(struct sp_art *art, signed char key, int (*dtor)(void*));
+int sp_art_removeuc(struct sp_art *art, unsigned char key, int (*dtor)(void*));
+int sp_art_removeus(struct sp_art *art, unsigned short key, int (*dtor)(void*));
+int sp_art_removeui(struct sp_art *art, unsigned int key, int (*dtor)(void*));
+int sp_art_removeul(struct sp_art *art, unsigned long key, int (*dtor)(void*));
+int sp_art_removef(struct sp_art *art, float key, int (*dtor)(void*));
+int sp_art_removed(struct sp_art *art, double key, int (*dtor)(void*));
+int sp_art_removeld(struct sp_art *art, long double key, int (*dtor)(void*));
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_art_removeb(struct sp_art *art, _Bool key, int (*dtor)(void*));
+int sp_art_removell(struct sp_art *art, long long key, int (*dtor)(void*));
+int sp_art_removeull(struct sp_art *art, unsigned long long key, int (*dtor)(void*));
+int sp_art_removeu8(struct sp_art *art, uint8_t key, int (*dtor)(void*));
+int sp_art_removeu16(struct sp_art *art, uint16_t key, int (*dtor)(void*));
+int sp_art_removeu32(struct sp_art *art, uint32_t key, int (*dtor)(void*));
+int sp_art_removeu64(struct sp_art *art, uint64_t key, int (*dtor)(void*));
+int sp_art_removei8(struct sp_art *art, int8_t key, int (*dtor)(void*));
+int sp_art_removei16(struct sp_art *art, int16_t key, int (*dtor)(void*));
+int sp_art_removei32(struct sp_art *art, int32_t key, int (*dtor)(void*));
+int sp_art_removei64(struct sp_art *art, int64_t key, int (*dtor)(void*));
+#endif
+int sp_art_removestr(struct sp_art *art, const char *key, int (*dtor)(void*));
+
+void *sp_art_longestprefix(const struct sp_art *art, const void *key, size_t len, size_t *match);
+void *sp_art_longestprefixstr(const struct sp_art *art, const char *key, size_t *match);
+
+int sp_art_scan(const struct sp_art *art, const void *prefix, size_t len, int (*func)(const void*, size_t, void*));
+int sp_art_scanstr(const struct sp_art *art, const char *prefix, int (*func)(const void*, size_t, void*));
+
+int sp_art_print(const struct sp_art *art, int (*func)(const void*, size_t, void*));
+
+#endif /* STAPLE_ART_H */
@@ -0,0 +1,280 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_AVL_H
+#define STAPLE_AVL_H
+
+/* The AVL tree module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pool.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_avl_node {
+	struct sp_avl_node *left;
+	struct sp_avl_node *right;
+	struct sp_avl_node *parent;
+	size_t size;
+	int    height;
+};
+
+struct sp_avl {
+	struct sp_avl_node *root;
+	size_t key_size;
+	size_t val_size;
+	size_t key_offset;
+	size_t val_offset;
+	size_t size;
+	struct sp_pool pool;
+	int  (*cmp)(const void*, const void*);
+};
+
+struct sp_avl *sp_avl_create(size_t key_size, size_t val_size, size_t capacity, int (*cmp)(const void*, const void*));
+int            sp_avl_clear(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*));
+int            sp_avl_destroy(struct sp_avl *avl, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_avl_insert(struct sp_avl *avl, const void *key, const void *val);
+int sp_avl_insertc(struct sp_avl *avl, char key, const void *val);
+int sp_avl_inserts(struct sp_avl *avl, short key, const void *val);
+int sp_avl_inserti(struct sp_avl *avl, int key, const void *val);
+int sp_avl_insertl(struct sp_avl *avl, long key, const void *val);
+int sp_avl_insertsc(struct sp_avl *avl, signed char key, const void *val);
+int sp_avl_insertuc(struct sp_avl *avl, unsigned char key, const void *val);
+int sp_avl_insertus(struct sp_avl *avl, unsigned short key, const void *val);
+int sp_avl_insertui(struct sp_avl *avl, unsigned int key, const void *val);
+int sp_avl_insertul(struct sp_avl *avl, unsigned long key, const void *val);
+int sp_avl_insertf(struct sp_avl *avl, float key, const void *val);
+int sp_avl_insertd(struct sp_avl *avl, double key, const void *val);
+int sp_avl_insertld(struct sp_avl *avl, long double key, const void *val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_avl_insertb(struct sp_avl *avl, _Bool key, const void *val);
+int sp_avl_insertll(struct sp_avl *avl, long long key, const void *val);
+int sp_avl_insertull(struct sp_avl *avl, unsigned long long key, const void *val);
+int sp_avl_insertu8(struct sp_avl *avl, uint8_t key, const void *val);
+int sp_avl_insertu16(struct sp_avl *avl, uint16_t key, const void *val);
+int sp_avl_insertu32(struct sp_avl *avl, uint32_t key, const void *val);
+int sp_avl_insertu64(struct sp_avl *avl, uint64_t key, const void *val);
+int sp_avl_inserti8(struct sp_avl *avl, int8_t key, const void *val);
+int sp_avl_inserti16(struct sp_avl *avl, int16_t key, const void *val);
+int sp_avl_inserti32(struct sp_avl *avl, int32_t key, const void *val);
+int sp_avl_inserti64(struct sp_avl *avl, int64_t key, const void *val);
+#endif
+
+int sp_avl_build(struct sp_avl *avl, const void *keys, const void *vals, size_t n);
+int sp_avl_buildc(struct sp_avl *avl, const char *keys, const void *vals, size_t n);
+int sp_avl_builds(struct sp_avl *avl, const short *keys, const void *vals, size_t n);
+int sp_avl_buildi(struct sp_avl *avl, const int *keys, const void *vals, size_t n);
+int sp_avl_buildl(struct sp_avl *avl, const long *keys, const void *vals, size_t n);
+int sp_avl_buildsc(struct sp_avl *avl, const signed char *keys, const void *vals, size_t n);
+int sp_avl_builduc(struct sp_avl *avl, const unsigned char *keys, const void *vals, size_t n);
+int sp_avl_buildus(struct sp_avl *avl, const unsigned short *keys, const void *vals, size_t n);
+int sp_avl_buildui(struct sp_avl *avl, const unsigned int *keys, const void *vals, size_t n);
+int sp_avl_buildul(struct sp_avl *avl, const unsigned long *keys, const void *vals, size_t n);
+int sp_avl_buildf(struct sp_avl *avl, const float *keys, const void *vals, size_t n);
+int sp_avl_buildd(struct sp_avl *avl, const double *keys, const void *vals, size_t n);
+int sp_avl_buildld(struct sp_avl *avl, const long double *keys, const void *vals, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_avl_buildb(struct sp_avl *avl, const _Bool *keys, const void *vals, size_t n);
+int sp_avl_buildll(struct sp_avl *avl, const long long *keys, const void *vals, size_t n);
+int sp_avl_buildull(struct sp_avl *avl, const unsigned long long *keys, const void *vals, size_t n);
+int sp_avl_buildu8(struct sp_avl *avl, const uint8_t *keys, const void *vals, size_t n);
+int sp_avl_buildu16(struct sp_avl *avl, const uint16_t *keys, const void *vals, size_t n);
+int sp_avl_buildu32(struct sp_avl *avl, const uint32_t *keys, const void *vals, size_t n);
+int sp_avl_buildu64(struct sp_avl *avl, const uint64_t *keys, const void *vals, size_t n);
+int sp_avl_buildi8(struct sp_avl *avl, const int8_t *keys, const void *vals, size_t n);
+int sp_avl_buildi16(struct sp_avl *avl, const int16_t *keys, const void *vals, size_t n);
+int sp_avl_buildi32(struct sp_avl *avl, const int32_t *keys, const void *vals, size_t n);
+int sp_avl_buildi64(struct sp_avl *avl, const int64_t *keys, const void *vals, size_t n);
+#endif
+
+struct sp_avl_node *sp_avl_find(const struct sp_avl *avl, const void *key);
+struct sp_avl_node *sp_avl_findc(const struct sp_avl *avl, char key);
+struct sp_avl_node *sp_avl_finds(const struct sp_avl *avl, short key);
+struct sp_avl_node *sp_avl_findi(const struct sp_avl *avl, int key);
+struct sp_avl_node *sp_avl_findl(const struct sp_avl *avl, long key);
+struct sp_avl_node *sp_avl_findsc(const struct sp_avl *avl, signed char key);
+struct sp_avl_node *sp_avl_finduc(const struct sp_avl *avl, unsigned char key);
+struct sp_avl_node *sp_avl_findus(const struct sp_avl *avl, unsigned short key);
+struct sp_avl_node *sp_avl_findui(const struct sp_avl *avl, unsigned int key);
+struct sp_avl_node *sp_avl_findul(const struct sp_avl *avl, unsigned long key);
+struct sp_avl_node *sp_avl_findf(const struct sp_avl *avl, float key);
+struct sp_avl_node *sp_avl_findd(const struct sp_avl *avl, double key);
+struct sp_avl_node *sp_avl_findld(const struct sp_avl *avl, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+struct sp_avl_node *sp_avl_findb(const struct sp_avl *avl, _Bool key);
+struct sp_avl_node *sp_avl_findll(const struct sp_avl *avl, long long key);
+struct sp_avl_node *sp_avl_findull(const struct sp_avl *avl, unsigned long long key);
+struct sp_avl_node *sp_avl_findu8(const struct sp_avl *avl, uint8_t key);
+struct sp_avl_node *sp_avl_findu16(const struct sp_avl *avl, uint16_t key);
+struct sp_avl_node *sp_avl_findu32(const struct sp_avl *avl, uint32_t key);
+struct sp_avl_node *sp_avl_findu64(const struct sp_avl *avl, uint64_t key);
+struct sp_avl_node *sp_avl_findi8(const struct sp_avl *avl, int8_t key);
+struct sp_avl_node *sp_avl_findi16(const struct sp_avl *avl, int16_t key);
+struct sp_avl_node *sp_avl_findi32(const struct sp_avl *avl, int32_t key);
+struct sp_avl_node *sp_avl_findi64(const struct sp_avl *avl, int64_t key);
+#endif
+
+struct sp_avl_node *sp_avl_lowerbound(const struct sp_avl *avl, const void *key);
+struct sp_avl_node *sp_avl_lowerboundc(const struct sp_avl *avl, char key);
+struct sp_avl_node *sp_avl_lowerbounds(const struct sp_avl *avl, short key);
+struct sp_avl_node *sp_avl_lowerboundi(const struct sp_avl *avl, int key);
+struct sp_avl_node *sp_avl_lowerboundl(const struct sp_avl *avl, long key);
+struct sp_avl_node *sp_avl_lowerboundsc(const struct sp_avl *avl, signed char key);
+struct sp_avl_node *sp_avl_lowerbounduc(const struct sp_avl *avl, unsigned char key);
+struct sp_avl_node *sp_avl_lowerboundus(const struct sp_avl *avl, unsigned short key);
+struct sp_avl_node *sp_avl_lowerboundui(const struct sp_avl *avl, unsigned int key);
+struct sp_avl_node *sp_avl_lowerboundul(const struct sp_avl *avl, unsigned long key);
+struct sp_avl_node *sp_avl_lowerboundf(const struct sp_avl *avl, float key);
+struct sp_avl_node *sp_avl_lowerboundd(const struct sp_avl *avl, double key);
+struct sp_avl_node *sp_avl_lowerboundld(const struct sp_avl *avl, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+struct sp_avl_node *sp_avl_lowerboundb(const struct sp_avl *avl, _Bool key);
+struct sp_avl_node *sp_avl_lowerboundll(const struct sp_avl *avl, long long key);
+struct sp_avl_node *sp_avl_lowerboundull(const struct sp_avl *avl, unsigned long long key);
+struct sp_avl_node *sp_avl_lowerboundu8(const struct sp_avl *avl, uint8_t key);
+struct sp_avl_node *sp_avl_lowerboundu16(const struct sp_avl *avl, uint16_t key);
+struct sp_avl_node *sp_avl_lowerboundu32(const struct sp_avl *avl, uint32_t key);
+struct sp_avl_node *sp_avl_lowerboundu64(const struct sp_avl *avl, uint64_t key);
+struct sp_avl_node *sp_avl_lowerboundi8(const struct sp_avl *avl, int8_t key);
+struct sp_avl_node *sp_avl_lowerboundi16(const struct sp_avl *avl, int16_t key);
+struct sp_avl_node *sp_avl_lowerboundi32(const struct sp_avl *avl, int32_t key);
+struct sp_avl_node *sp_avl_lowerboundi64(const struct sp_avl *avl, int64_t key);
+#endif
+
+struct sp_avl_node *sp_avl_upperbound(const struct sp_avl *avl, const void *key);
+struct sp_avl_node *sp_avl_upperboundc(const struct sp_avl *avl, char key);
+struct sp_avl_node *sp_avl_upperbounds(const struct sp_avl *avl, short key);
+struct sp_avl_node *sp_avl_upperboundi(const struct sp_avl *avl, int key);
+struct sp_avl_node *sp_avl_upperboundl(const struct sp_avl *avl, long key);
+struct sp_avl_node *sp_avl_upperboundsc(const struct sp_avl *avl, signed char key);
+struct sp_avl_node *sp_avl_upperbounduc(const struct sp_avl *avl, unsigned char key);
+struct sp_avl_node *sp_avl_upperboundus(const struct sp_avl *avl, unsigned short key);
+struct sp_avl_node *sp_avl_upperboundui(const struct sp_avl *avl, unsigned int key);
+struct sp_avl_node *sp_avl_upperboundul(const struct sp_avl *avl, unsigned long key);
+struct sp_avl_node *sp_avl_upperboundf(const struct sp_avl *avl, float key);
+struct sp_avl_node *sp_avl_upperboundd(const struct sp_avl *avl, double key);
+struct sp_avl_node *sp_avl_upperboundld(const struct sp_avl *avl, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+struct sp_avl_node *sp_avl_upperboundb(const struct sp_avl *avl, _Bool key);
+struct sp_avl_node *sp_avl_upperboundll(const struct sp_avl *avl, long long key);
+struct sp_avl_node *sp_avl_upperboundull(const struct sp_avl *avl, unsigned long long key);
+struct sp_avl_node *sp_avl_upperboundu8(const struct sp_avl *avl, uint8_t key);
+struct sp_avl_node *sp_avl_upperboundu16(const struct sp_avl *avl, uint16_t key);
+struct sp_avl_node *sp_avl_upperboundu32(const struct sp_avl *avl, uint32_t key);
+struct sp_avl_node *sp_avl_upperboundu64(const struct sp_avl *avl, uint64_t key);
+struct sp_avl_node *sp_avl_upperboundi8(const struct sp_avl *avl, int8_t key);
+struct sp_avl_node *sp_avl_upperboundi16(const struct sp_avl *avl, int16_t key);
+struct sp_avl_node *sp_avl_upperboundi32(const struct sp_avl *avl, int32_t key);
+struct sp_avl_node *sp_avl_upperboundi64(const struct sp_avl *avl, int64_t key);
+#endif
+
+void *sp_avl_key(const struct sp_avl *avl, const struct sp_avl_node *node);
+void *sp_avl_val(const struct sp_avl *avl, const struct sp_avl_node *node);
+
+struct sp_avl_node *sp_avl_first(const struct sp_avl *avl);
+struct sp_avl_node *sp_avl_last(const struct sp_avl *avl);
+struct sp_avl_node *sp_avl_next(const struct sp_avl_node *node);
+struct sp_avl_node *sp_avl_prev(const struct sp_avl_node *node);
+
+size_t              sp_avl_rank(const struct sp_avl *avl, const void *key);
+size_t              sp_avl_rankc(const struct sp_avl *avl, char key);
+size_t              sp_avl_ranks(const struct sp_avl *avl, short key);
+size_t              sp_avl_ranki(const struct sp_avl *avl, int key);
+size_t              sp_avl_rankl(const struct sp_avl *avl, long key);
+size_t              sp_avl_ranksc(const struct sp_avl *avl, signed char key);
+size_t              sp_avl_rankuc(const struct sp_avl *avl, unsigned char key);
+size_t              sp_avl_rankus(const struct sp_avl *avl, unsigned short key);
+size_t              sp_avl_rankui(const struct sp_avl *avl, unsigned int key);
+size_t              sp_avl_rankul(const struct sp_avl *avl, unsigned long key);
+size_t              sp_avl_rankf(const struct sp_avl *avl, float key);
+size_t              sp_avl_rankd(const struct sp_avl *avl, double key);
+size_t              sp_avl_rankld(const struct sp_avl *avl, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+size_t              sp_avl_rankb(const struct sp_avl *avl, _Bool key);
+size_t              sp_avl_rankll(const struct sp_avl *avl, long long key);
+size_t              sp_avl_rankull(const struct sp_avl *avl, unsigned long long key);
+size_t              sp_avl_ranku8(const struct sp_avl *avl, uint8_t key);
+size_t              sp_avl_ranku16(const struct sp_avl *avl, uint16_t key);
+size_t              sp_avl_ranku32(const struct sp_avl *avl, uint32_t key);
+size_t              sp_avl_ranku64(const struct sp_avl *avl, uint64_t key);
+size_t              sp_avl_ranki8(const struct sp_avl *avl, int8_t key);
+size_t              sp_avl_ranki16(const struct sp_avl *avl, int16_t key);
+size_t              sp_avl_ranki32(const struct sp_avl *avl, int32_t key);
+size_t              sp_avl_ranki64(const struct sp_avl *avl, int64_t key);
+#endif
+struct sp_avl_node *sp_avl_select(const struct sp_avl *avl, size_t idx);
+
+int sp_avl_remove(struct sp_avl *avl, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_avl_removec(struct sp_avl *avl, char key, int (*dtor)(void*));
+int sp_avl_removes(struct sp_avl *avl, short key, int (*dtor)(void*));
+int sp_avl_removei(struct sp_avl *avl, int key, int (*dtor)(void*));
+int sp_avl_removel(struct sp_avl *avl, long key, int (*dtor)(void*));
+int sp_avl_removesc(struct sp_avl *avl, signed char key, int (*dtor)(void*));
+int sp_avl_removeuc(struct sp_avl *avl, unsigned char key, int (*dtor)(void*));
+int sp_avl_removeus(struct sp_avl *avl, unsigned short key, int (*dtor)(void*));
+int sp_avl_removeui(struct sp_avl *avl, unsigned int key, int (*dtor)(void*));
+int sp_avl_removeul(struct sp_avl *avl, unsigned long key, int (*dtor)(void*));
+int sp_avl_removef(struct sp_avl *avl, float key, int (*dtor)(void*));
+int sp_avl_removed(struct sp_avl *avl, double key, int (*dtor)(void*));
+int sp_avl_removeld(struct sp_avl *avl, long double key, int (*dtor)(void*));
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_avl_removeb(struct sp_avl *avl, _Bool key, int (*dtor)(void*));
+int sp_avl_removell(struct sp_avl *avl, long long key, int (*dtor)(void*));
+int sp_avl_removeull(struct sp_avl *avl, unsigned long long key, int (*dtor)(void*));
+int sp_avl_removeu8(struct sp_avl *avl, uint8_t key, int (*dtor)(void*));
+int sp_avl_removeu16(struct sp_avl *avl, uint16_t key, int (*dtor)(void*));
+int sp_avl_removeu32(struct sp_avl *avl, uint32_t key, int (*dtor)(void*));
+int sp_avl_removeu64(struct sp_avl *avl, uint64_t key, int (*dtor)(void*));
+int sp_avl_removei8(struct sp_avl *avl, int8_t key, int (*dtor)(void*));
+int sp_avl_removei16(struct sp_avl *avl, int16_t key, int (*dtor)(void*));
+int sp_avl_removei32(struct sp_avl *avl, int32_t key, int (*dtor)(void*));
+int sp_avl_removei64(struct sp_avl *avl, int64_t key, int (*dtor)(void*));
+#endif
+int sp_avl_erase(struct sp_avl *avl, struct sp_avl_node *node, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_avl_print(const struct sp_avl *avl, int (*func)(const void*, const void*));
+int sp_avl_printc(const struct sp_avl *avl);
+int sp_avl_prints(const struct sp_avl *avl);
+int sp_avl_printi(const struct sp_avl *avl);
+int sp_avl_printl(const struct sp_avl *avl);
+int sp_avl_printsc(const struct sp_avl *avl);
+int sp_avl_printuc(const struct sp_avl *avl);
+int sp_avl_printus(const struct sp_avl *avl);
+int sp_avl_printui(const struct sp_avl *avl);
+int sp_avl_printul(const struct sp_avl *avl);
+int sp_avl_printf(const struct sp_avl *avl);
+int sp_avl_printd(const struct sp_avl *avl);
+int sp_avl_printld(const struct sp_avl *avl);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_avl_printb(const struct sp_avl *avl);
+int sp_avl_printll(const struct sp_avl *avl);
+int sp_avl_printull(const struct sp_avl *avl);
+int sp_avl_printu8(const struct sp_avl *avl);
+int sp_avl_printu16(const struct sp_avl *avl);
+int sp_avl_printu32(const struct sp_avl *avl);
+int sp_avl_printu64(const struct sp_avl *avl);
+int sp_avl_printi8(const struct sp_avl *avl);
+int sp_avl_printi16(const struct sp_avl *avl);
+int sp_avl_printi32(const struct sp_avl *avl);
+int sp_avl_printi64(const struct sp_avl *avl);
+#endif
+
+#endif /* STAPLE_AVL_H */
@@ -0,0 +1,60 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_BITARRAY_H
+#define STAPLE_BITARRAY_H
+
+/* The bitarray module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+
+struct sp_bitarray {
+	unsigned long *data;
+	size_t size;
+	size_t capacity;
+};
+
+struct sp_bitarray *sp_bitarray_create(size_t capacity);
+int                 sp_bitarray_clear(struct sp_bitarray *bitarray);
+int                 sp_bitarray_destroy(struct sp_bitarray *bitarray);
+int                 sp_bitarray_eq(const struct sp_bitarray *bitarray1, const struct sp_bitarray *bitarray2);
+int                 sp_bitarray_copy(struct sp_bitarray *dest, const struct sp_bitarray *src);
+int                 sp_bitarray_resize(struct sp_bitarray *bitarray, size_t size);
+
+int sp_bitarray_push(struct sp_bitarray *bitarray, int bit);
+int sp_bitarray_pop(struct sp_bitarray *bitarray);
+
+int sp_bitarray_get(const struct sp_bitarray *bitarray, size_t idx);
+int sp_bitarray_set(struct sp_bitarray *bitarray, size_t idx, int bit);
+int sp_bitarray_flip(struct sp_bitarray *bitarray, size_t idx);
+int sp_bitarray_fill(struct sp_bitarray *bitarray, size_t idx, size_t n, int bit);
+
+int sp_bitarray_and(struct sp_bitarray *dest, const struct sp_bitarray *src);
+int sp_bitarray_or(struct sp_bitarray *dest, const struct sp_bitarray *src);
+int sp_bitarray_xor(struct sp_bitarray *dest, const struct sp_bitarray *src);
+int sp_bitarray_andnot(struct sp_bitarray *dest, const struct sp_bitarray *src);
+
+size_t sp_bitarray_count(const struct sp_bitarray *bitarray);
+size_t sp_bitarray_rank(const struct sp_bitarray *bitarray, size_t idx);
+size_t sp_bitarray_select(const struct sp_bitarray *bitarray, size_t n);
+size_t sp_bitarray_next(const struct sp_bitarray *bitarray, size_t idx);
+
+int sp_bitarray_print(const struct sp_bitarray *bitarray);
+
+#endif /* STAPLE_BITARRAY_H */
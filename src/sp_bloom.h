@@ -0,0 +1,116 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_BLOOM_H
+#define STAPLE_BLOOM_H
+
+/* The bloom filter module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_bitarray.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Number of bits of a block of a blocked filter, which is one cache line */
+#define SP_BLOOM_BLOCK 512
+
+/* Size of the header of a serialized filter, in bytes */
+#define SP_BLOOM_HEADER 28
+
+struct sp_bloom {
+	struct sp_bitarray *bits;
+	size_t nbits;
+	size_t nhashes;
+	size_t offset;
+	size_t size;
+	int    blocked;
+};
+
+struct sp_bloom *sp_bloom_create(size_t capacity, double fpr, int blocked);
+int              sp_bloom_clear(struct sp_bloom *bloom);
+int              sp_bloom_destroy(struct sp_bloom *bloom);
+
+int sp_bloom_insert(struct sp_bloom *bloom, const void *data, size_t len);
+int sp_bloom_insertc(struct sp_bloom *bloom, char elem);
+int sp_bloom_inserts(struct sp_bloom *bloom, short elem);
+int sp_bloom_inserti(struct sp_bloom *bloom, int elem);
+int sp_bloom_insertl(struct sp_bloom *bloom, long elem);
+int sp_bloom_insertsc(struct sp_bloom *bloom, signed char elem);
+int sp_bloom_insertuc(struct sp_bloom *bloom, unsigned char elem);
+int sp_bloom_insertus(struct sp_bloom *bloom, unsigned short elem);
+int sp_bloom_insertui(struct sp_bloom *bloom, unsigned int elem);
+int sp_bloom_insertul(struct sp_bloom *bloom, unsigned long elem);
+int sp_bloom_insertf(struct sp_bloom *bloom, float elem);
+int sp_bloom_insertd(struct sp_bloom *bloom, double elem);
+int sp_bloom_insertld(struct sp_bloom *bloom, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bloom_insertb(struct sp_bloom *bloom, _Bool elem);
+int sp_bloom_insertll(struct sp_bloom *bloom, long long elem);
+int sp_bloom_insertull(struct sp_bloom *bloom, unsigned long long elem);
+int sp_bloom_insertu8(struct sp_bloom *bloom, uint8_t elem);
+int sp_bloom_insertu16(struct sp_bloom *bloom, uint16_t elem);
+int sp_bloom_insertu32(struct sp_bloom *bloom, uint32_t elem);
+int sp_bloom_insertu64(struct sp_bloom *bloom, uint64_t elem);
+int sp_bloom_inserti8(struct sp_bloom *bloom, int8_t elem);
+int sp_bloom_inserti16(struct sp_bloom *bloom, int16_t elem);
+int sp_bloom_inserti32(struct sp_bloom *bloom, int32_t elem);
+int sp_bloom_inserti64(struct sp_bloom *bloom, int64_t elem);
+#endif
+int sp_bloom_insertstr(struct sp_bloom *bloom, const char *str);
+
+int sp_bloom_contains(const struct sp_bloom *bloom, const void *data, size_t len);
+int sp_bloom_containsc(const struct sp_bloom *bloom, char elem);
+int sp_bloom_containss(const struct sp_bloom *bloom, short elem);
+int sp_bloom_containsi(const struct sp_bloom *bloom, int elem);
+int sp_bloom_containsl(const struct sp_bloom *bloom, long elem);
+int sp_bloom_containssc(const struct sp_bloom *bloom, signed char elem);
+int sp_bloom_containsuc(const struct sp_bloom *bloom, unsigned char elem);
+int sp_bloom_containsus(const struct sp_bloom *bloom, unsigned short elem);
+int sp_bloom_containsui(const struct sp_bloom *bloom, unsigned int elem);
+int sp_bloom_containsul(const struct sp_bloom *bloom, unsigned long elem);
+int sp_bloom_containsf(const struct sp_bloom *bloom, float elem);
+int sp_bloom_containsd(const struct sp_bloom *bloom, double elem);
+int sp_bloom_containsld(const struct sp_bloom *bloom, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bloom_containsb(const struct sp_bloom *bloom, _Bool elem);
+int sp_bloom_containsll(const struct sp_bloom *bloom, long long elem);
+int sp_bloom_containsull(const struct sp_bloom *bloom, unsigned long long elem);
+int sp_bloom_containsu8(const struct sp_bloom *bloom, uint8_t elem);
+int sp_bloom_containsu16(const struct sp_bloom *bloom, uint16_t elem);
+int sp_bloom_containsu32(const struct sp_bloom *bloom, uint32_t elem);
+int sp_bloom_containsu64(const struct sp_bloom *bloom, uint64_t elem);
+int sp_bloom_containsi8(const struct sp_bloom *bloom, int8_t elem);
+int sp_bloom_containsi16(const struct sp_bloom *bloom, int16_t elem);
+int sp_bloom_containsi32(const struct sp_bloom *bloom, int32_t elem);
+int sp_bloom_containsi64(const struct sp_bloom *bloom, int64_t elem);
+#endif
+int sp_bloom_containsstr(const struct sp_bloom *bloom, const char *str);
+
+int sp_bloom_union(struct sp_bloom *dest, const struct sp_bloom *src);
+int sp_bloom_intersect(struct sp_bloom *dest, const struct sp_bloom *src);
+
+double sp_bloom_fpr(const struct sp_bloom *bloom);
+
+size_t           sp_bloom_serialize(const struct sp_bloom *bloom, void *buf, size_t size);
+struct sp_bloom *sp_bloom_deserialize(const void *buf, size_t size);
+
+int sp_bloom_print(const struct sp_bloom *bloom);
+
+#endif /* STAPLE_BLOOM_H */
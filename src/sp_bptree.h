@@ -0,0 +1,261 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_BPTREE_H
+#define STAPLE_BPTREE_H
+
+/* The B+tree module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Default size of a node in bytes, a few cache lines */
+#define SP_BPTREE_NODE_SIZE 512
+
+struct sp_bptree_node {
+	struct sp_bptree_node *prev;
+	struct sp_bptree_node *next;
+	size_t count;
+};
+
+struct sp_bptree {
+	struct sp_bptree_node *root;
+	struct sp_bptree_node *head;
+	struct sp_bptree_node *tail;
+	size_t key_size;
+	size_t val_size;
+	size_t key_offset;
+	size_t val_offset;
+	size_t child_offset;
+	size_t leaf_size;
+	size_t inner_size;
+	size_t leaf_cap;
+	size_t inner_cap;
+	size_t size;
+	size_t height;
+	int  (*cmp)(const void*, const void*);
+};
+
+struct sp_bptree_iter {
+	struct sp_bptree_node *node;
+	size_t idx;
+};
+
+struct sp_bptree *sp_bptree_create(size_t key_size, size_t val_size, size_t node_size, int (*cmp)(const void*, const void*));
+int               sp_bptree_clear(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*));
+int               sp_bptree_destroy(struct sp_bptree *tree, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_bptree_insert(struct sp_bptree *tree, const void *key, const void *val);
+int sp_bptree_insertc(struct sp_bptree *tree, char key, const void *val);
+int sp_bptree_inserts(struct sp_bptree *tree, short key, const void *val);
+int sp_bptree_inserti(struct sp_bptree *tree, int key, const void *val);
+int sp_bptree_insertl(struct sp_bptree *tree, long key, const void *val);
+int sp_bptree_insertsc(struct sp_bptree *tree, signed char key, const void *val);
+int sp_bptree_insertuc(struct sp_bptree *tree, unsigned char key, const void *val);
+int sp_bptree_insertus(struct sp_bptree *tree, unsigned short key, const void *val);
+int sp_bptree_insertui(struct sp_bptree *tree, unsigned int key, const void *val);
+int sp_bptree_insertul(struct sp_bptree *tree, unsigned long key, const void *val);
+int sp_bptree_insertf(struct sp_bptree *tree, float key, const void *val);
+int sp_bptree_insertd(struct sp_bptree *tree, double key, const void *val);
+int sp_bptree_insertld(struct sp_bptree *tree, long double key, const void *val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bptree_insertb(struct sp_bptree *tree, _Bool key, const void *val);
+int sp_bptree_insertll(struct sp_bptree *tree, long long key, const void *val);
+int sp_bptree_insertull(struct sp_bptree *tree, unsigned long long key, const void *val);
+int sp_bptree_insertu8(struct sp_bptree *tree, uint8_t key, const void *val);
+int sp_bptree_insertu16(struct sp_bptree *tree, uint16_t key, const void *val);
+int sp_bptree_insertu32(struct sp_bptree *tree, uint32_t key, const void *val);
+int sp_bptree_insertu64(struct sp_bptree *tree, uint64_t key, const void *val);
+int sp_bptree_inserti8(struct sp_bptree *tree, int8_t key, const void *val);
+int sp_bptree_inserti16(struct sp_bptree *tree, int16_t key, const void *val);
+int sp_bptree_inserti32(struct sp_bptree *tree, int32_t key, const void *val);
+int sp_bptree_inserti64(struct sp_bptree *tree, int64_t key, const void *val);
+#endif
+
+int sp_bptree_build(struct sp_bptree *tree, const void *keys, const void *vals, size_t n);
+int sp_bptree_buildc(struct sp_bptree *tree, const char *keys, const void *vals, size_t n);
+int sp_bptree_builds(struct sp_bptree *tree, const short *keys, const void *vals, size_t n);
+int sp_bptree_buildi(struct sp_bptree *tree, const int *keys, const void *vals, size_t n);
+int sp_bptree_buildl(struct sp_bptree *tree, const long *keys, const void *vals, size_t n);
+int sp_bptree_buildsc(struct sp_bptree *tree, const signed char *keys, const void *vals, size_t n);
+int sp_bptree_builduc(struct sp_bptree *tree, const unsigned char *keys, const void *vals, size_t n);
+int sp_bptree_buildus(struct sp_bptree *tree, const unsigned short *keys, const void *vals, size_t n);
+int sp_bptree_buildui(struct sp_bptree *tree, const unsigned int *keys, const void *vals, size_t n);
+int sp_bptree_buildul(struct sp_bptree *tree, const unsigned long *keys, const void *vals, size_t n);
+int sp_bptree_buildf(struct sp_bptree *tree, const float *keys, const void *vals, size_t n);
+int sp_bptree_buildd(struct sp_bptree *tree, const double *keys, const void *vals, size_t n);
+int sp_bptree_buildld(struct sp_bptree *tree, const long double *keys, const void *vals, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bptree_buildb(struct sp_bptree *tree, const _Bool *keys, const void *vals, size_t n);
+int sp_bptree_buildll(struct sp_bptree *tree, const long long *keys, const void *vals, size_t n);
+int sp_bptree_buildull(struct sp_bptree *tree, const unsigned long long *keys, const void *vals, size_t n);
+int sp_bptree_buildu8(struct sp_bptree *tree, const uint8_t *keys, const void *vals, size_t n);
+int sp_bptree_buildu16(struct sp_bptree *tree, const uint16_t *keys, const void *vals, size_t n);
+int sp_bptree_buildu32(struct sp_bptree *tree, const uint32_t *keys, const void *vals, size_t n);
+int sp_bptree_buildu64(struct sp_bptree *tree, const uint64_t *keys, const void *vals, size_t n);
+int sp_bptree_buildi8(struct sp_bptree *tree, const int8_t *keys, const void *vals, size_t n);
+int sp_bptree_buildi16(struct sp_bptree *tree, const int16_t *keys, const void *vals, size_t n);
+int sp_bptree_buildi32(struct sp_bptree *tree, const int32_t *keys, const void *vals, size_t n);
+int sp_bptree_buildi64(struct sp_bptree *tree, const int64_t *keys, const void *vals, size_t n);
+#endif
+
+void *sp_bptree_get(const struct sp_bptree *tree, const void *key);
+void *sp_bptree_getc(const struct sp_bptree *tree, char key);
+void *sp_bptree_gets(const struct sp_bptree *tree, short key);
+void *sp_bptree_geti(const struct sp_bptree *tree, int key);
+void *sp_bptree_getl(const struct sp_bptree *tree, long key);
+void *sp_bptree_getsc(const struct sp_bptree *tree, signed char key);
+void *sp_bptree_getuc(const struct sp_bptree *tree, unsigned char key);
+void *sp_bptree_getus(const struct sp_bptree *tree, unsigned short key);
+void *sp_bptree_getui(const struct sp_bptree *tree, unsigned int key);
+void *sp_bptree_getul(const struct sp_bptree *tree, unsigned long key);
+void *sp_bptree_getf(const struct sp_bptree *tree, float key);
+void *sp_bptree_getd(const struct sp_bptree *tree, double key);
+void *sp_bptree_getld(const struct sp_bptree *tree, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+void *sp_bptree_getb(const struct sp_bptree *tree, _Bool key);
+void *sp_bptree_getll(const struct sp_bptree *tree, long long key);
+void *sp_bptree_getull(const struct sp_bptree *tree, unsigned long long key);
+void *sp_bptree_getu8(const struct sp_bptree *tree, uint8_t key);
+void *sp_bptree_getu16(const struct sp_bptree *tree, uint16_t key);
+void *sp_bptree_getu32(const struct sp_bptree *tree, uint32_t key);
+void *sp_bptree_getu64(const struct sp_bptree *tree, uint64_t key);
+void *sp_bptree_geti8(const struct sp_bptree *tree, int8_t key);
+void *sp_bptree_geti16(const struct sp_bptree *tree, int16_t key);
+void *sp_bptree_geti32(const struct sp_bptree *tree, int32_t key);
+void *sp_bptree_geti64(const struct sp_bptree *tree, int64_t key);
+#endif
+
+int sp_bptree_remove(struct sp_bptree *tree, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_bptree_removec(struct sp_bptree *tree, char key, int (*dtor)(void*));
+int sp_bptree_removes(struct sp_bptree *tree, short key, int (*dtor)(void*));
+int sp_bptree_removei(struct sp_bptree *tree, int key, int (*dtor)(void*));
+int sp_bptree_removel(struct sp_bptree *tree, long key, int (*dtor)(void*));
+int sp_bptree_removesc(struct sp_bptree *tree, signed char key, int (*dtor)(void*));
+int sp_bptree_removeuc(struct sp_bptree *tree, unsigned char key, int (*dtor)(void*));
+int sp_bptree_removeus(struct sp_bptree *tree, unsigned short key, int (*dtor)(void*));
+int sp_bptree_removeui(struct sp_bptree *tree, unsigned int key, int (*dtor)(void*));
+int sp_bptree_removeul(struct sp_bptree *tree, unsigned long key, int (*dtor)(void*));
+int sp_bptree_removef(struct sp_bptree *tree, float key, int (*dtor)(void*));
+int sp_bptree_removed(struct sp_bptree *tree, double key, int (*dtor)(void*));
+int sp_bptree_removeld(struct sp_bptree *tree, long double key, int (*dtor)(void*));
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bptree_removeb(struct sp_bptree *tree, _Bool key, int (*dtor)(void*));
+int sp_bptree_removell(struct sp_bptree *tree, long long key, int (*dtor)(void*));
+int sp_bptree_removeull(struct sp_bptree *tree, unsigned long long key, int (*dtor)(void*));
+int sp_bptree_removeu8(struct sp_bptree *tree, uint8_t key, int (*dtor)(void*));
+int sp_bptree_removeu16(struct sp_bptree *tree, uint16_t key, int (*dtor)(void*));
+int sp_bptree_removeu32(struct sp_bptree *tree, uint32_t key, int (*dtor)(void*));
+int sp_bptree_removeu64(struct sp_bptree *tree, uint64_t key, int (*dtor)(void*));
+int sp_bptree_removei8(struct sp_bptree *tree, int8_t key, int (*dtor)(void*));
+int sp_bptree_removei16(struct sp_bptree *tree, int16_t key, int (*dtor)(void*));
+int sp_bptree_removei32(struct sp_bptree *tree, int32_t key, int (*dtor)(void*));
+int sp_bptree_removei64(struct sp_bptree *tree, int64_t key, int (*dtor)(void*));
+#endif
+
+int sp_bptree_first(const struct sp_bptree *tree, struct sp_bptree_iter *it);
+int sp_bptree_last(const struct sp_bptree *tree, struct sp_bptree_iter *it);
+int sp_bptree_lowerbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundc(const struct sp_bptree *tree, char key, struct sp_bptree_iter *it);
+int sp_bptree_lowerbounds(const struct sp_bptree *tree, short key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundi(const struct sp_bptree *tree, int key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundl(const struct sp_bptree *tree, long key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundsc(const struct sp_bptree *tree, signed char key, struct sp_bptree_iter *it);
+int sp_bptree_lowerbounduc(const struct sp_bptree *tree, unsigned char key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundus(const struct sp_bptree *tree, unsigned short key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundui(const struct sp_bptree *tree, unsigned int key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundul(const struct sp_bptree *tree, unsigned long key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundf(const struct sp_bptree *tree, float key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundd(const struct sp_bptree *tree, double key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundld(const struct sp_bptree *tree, long double key, struct sp_bptree_iter *it);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bptree_lowerboundb(const struct sp_bptree *tree, _Bool key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundll(const struct sp_bptree *tree, long long key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundull(const struct sp_bptree *tree, unsigned long long key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundu8(const struct sp_bptree *tree, uint8_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundu16(const struct sp_bptree *tree, uint16_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundu32(const struct sp_bptree *tree, uint32_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundu64(const struct sp_bptree *tree, uint64_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundi8(const struct sp_bptree *tree, int8_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundi16(const struct sp_bptree *tree, int16_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundi32(const struct sp_bptree *tree, int32_t key, struct sp_bptree_iter *it);
+int sp_bptree_lowerboundi64(const struct sp_bptree *tree, int64_t key, struct sp_bptree_iter *it);
+#endif
+int sp_bptree_upperbound(const struct sp_bptree *tree, const void *key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundc(const struct sp_bptree *tree, char key, struct sp_bptree_iter *it);
+int sp_bptree_upperbounds(const struct sp_bptree *tree, short key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundi(const struct sp_bptree *tree, int key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundl(const struct sp_bptree *tree, long key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundsc(const struct sp_bptree *tree, signed char key, struct sp_bptree_iter *it);
+int sp_bptree_upperbounduc(const struct sp_bptree *tree, unsigned char key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundus(const struct sp_bptree *tree, unsigned short key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundui(const struct sp_bptree *tree, unsigned int key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundul(const struct sp_bptree *tree, unsigned long key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundf(const struct sp_bptree *tree, float key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundd(const struct sp_bptree *tree, double key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundld(const struct sp_bptree *tree, long double key, struct sp_bptree_iter *it);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bptree_upperboundb(const struct sp_bptree *tree, _Bool key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundll(const struct sp_bptree *tree, long long key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundull(const struct sp_bptree *tree, unsigned long long key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundu8(const struct sp_bptree *tree, uint8_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundu16(const struct sp_bptree *tree, uint16_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundu32(const struct sp_bptree *tree, uint32_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundu64(const struct sp_bptree *tree, uint64_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundi8(const struct sp_bptree *tree, int8_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundi16(const struct sp_bptree *tree, int16_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundi32(const struct sp_bptree *tree, int32_t key, struct sp_bptree_iter *it);
+int sp_bptree_upperboundi64(const struct sp_bptree *tree, int64_t key, struct sp_bptree_iter *it);
+#endif
+int sp_bptree_next(struct sp_bptree_iter *it);
+int sp_bptree_prev(struct sp_bptree_iter *it);
+
+void *sp_bptree_key(const struct sp_bptree *tree, const struct sp_bptree_iter *it);
+void *sp_bptree_val(const struct sp_bptree *tree, const struct sp_bptree_iter *it);
+
+int sp_bptree_print(const struct sp_bptree *tree, int (*func)(const void*, const void*));
+int sp_bptree_printc(const struct sp_bptree *tree);
+int sp_bptree_prints(const struct sp_bptree *tree);
+int sp_bptree_printi(const struct sp_bptree *tree);
+int sp_bptree_printl(const struct sp_bptree *tree);
+int sp_bptree_printsc(const struct sp_bptree *tree);
+int sp_bptree_printuc(const struct sp_bptree *tree);
+int sp_bptree_printus(const struct sp_bptree *tree);
+int sp_bptree_printui(const struct sp_bptree *tree);
+int sp_bptree_printul(const struct sp_bptree *tree);
+int sp_bptree_printf(const struct sp_bptree *tree);
+int sp_bptree_printd(const struct sp_bptree *tree);
+int sp_bptree_printld(const struct sp_bptree *tree);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_bptree_printb(const struct sp_bptree *tree);
+int sp_bptree_printll(const struct sp_bptree *tree);
+int sp_bptree_printull(const struct sp_bptree *tree);
+int sp_bptree_printu8(const struct sp_bptree *tree);
+int sp_bptree_printu16(const struct sp_bptree *tree);
+int sp_bptree_printu32(const struct sp_bptree *tree);
+int sp_bptree_printu64(const struct sp_bptree *tree);
+int sp_bptree_printi8(const struct sp_bptree *tree);
+int sp_bptree_printi16(const struct sp_bptree *tree);
+int sp_bptree_printi32(const struct sp_bptree *tree);
+int sp_bptree_printi64(const struct sp_bptree *tree);
+#endif
+
+#endif /* STAPLE_BPTREE_H */
@@ -0,0 +1,146 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_CHASHMAP_H
+#define STAPLE_CHASHMAP_H
+
+/* The chashmap module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_hashmap.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_chashmap_retired {
+	struct sp_hashmap *table;
+	unsigned long      epoch;
+};
+
+struct sp_chashmap_shard {
+	struct sp_hashmap          *table;
+	struct sp_chashmap_retired *retired;
+	size_t                      nretired;
+	unsigned long               epoch;
+	unsigned long               readers[2];
+	unsigned long               seq;
+	unsigned long               lock;
+	unsigned char               pad[64];
+};
+
+struct sp_chashmap {
+	struct sp_chashmap_shard *shards;
+	size_t   nshards;
+	unsigned shard_shift;
+	size_t   key_size;
+	size_t   val_size;
+	size_t (*hash)(const void*);
+	int    (*cmp)(const void*, const void*);
+};
+
+struct sp_chashmap *sp_chashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t nshards, size_t (*hash)(const void*), int (*cmp)(const void*, const void*));
+int                 sp_chashmap_clear(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+int                 sp_chashmap_destroy(struct sp_chashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+size_t              sp_chashmap_size(const struct sp_chashmap *map);
+int                 sp_chashmap_map(struct sp_chashmap *map, int (*func)(const void*, void*));
+
+int sp_chashmap_insert(struct sp_chashmap *map, const void *key, const void *val);
+int sp_chashmap_insertc(struct sp_chashmap *map, char key, const void *val);
+int sp_chashmap_inserts(struct sp_chashmap *map, short key, const void *val);
+int sp_chashmap_inserti(struct sp_chashmap *map, int key, const void *val);
+int sp_chashmap_insertl(struct sp_chashmap *map, long key, const void *val);
+int sp_chashmap_insertsc(struct sp_chashmap *map, signed char key, const void *val);
+int sp_chashmap_insertuc(struct sp_chashmap *map, unsigned char key, const void *val);
+int sp_chashmap_insertus(struct sp_chashmap *map, unsigned short key, const void *val);
+int sp_chashmap_insertui(struct sp_chashmap *map, unsigned int key, const void *val);
+int sp_chashmap_insertul(struct sp_chashmap *map, unsigned long key, const void *val);
+int sp_chashmap_insertf(struct sp_chashmap *map, float key, const void *val);
+int sp_chashmap_insertd(struct sp_chashmap *map, double key, const void *val);
+int sp_chashmap_insertld(struct sp_chashmap *map, long double key, const void *val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_chashmap_insertb(struct sp_chashmap *map, _Bool key, const void *val);
+int sp_chashmap_insertll(struct sp_chashmap *map, long long key, const void *val);
+int sp_chashmap_insertull(struct sp_chashmap *map, unsigned long long key, const void *val);
+int sp_chashmap_insertu8(struct sp_chashmap *map, uint8_t key, const void *val);
+int sp_chashmap_insertu16(struct sp_chashmap *map, uint16_t key, const void *val);
+int sp_chashmap_insertu32(struct sp_chashmap *map, uint32_t key, const void *val);
+int sp_chashmap_insertu64(struct sp_chashmap *map, uint64_t key, const void *val);
+int sp_chashmap_inserti8(struct sp_chashmap *map, int8_t key, const void *val);
+int sp_chashmap_inserti16(struct sp_chashmap *map, int16_t key, const void *val);
+int sp_chashmap_inserti32(struct sp_chashmap *map, int32_t key, const void *val);
+int sp_chashmap_inserti64(struct sp_chashmap *map, int64_t key, const void *val);
+#endif
+
+int sp_chashmap_get(const struct sp_chashmap *map, const void *key, void *val);
+int sp_chashmap_getc(const struct sp_chashmap *map, char key, void *val);
+int sp_chashmap_gets(const struct sp_chashmap *map, short key, void *val);
+int sp_chashmap_geti(const struct sp_chashmap *map, int key, void *val);
+int sp_chashmap_getl(const struct sp_chashmap *map, long key, void *val);
+int sp_chashmap_getsc(const struct sp_chashmap *map, signed char key, void *val);
+int sp_chashmap_getuc(const struct sp_chashmap *map, unsigned char key, void *val);
+int sp_chashmap_getus(const struct sp_chashmap *map, unsigned short key, void *val);
+int sp_chashmap_getui(const struct sp_chashmap *map, unsigned int key, void *val);
+int sp_chashmap_getul(const struct sp_chashmap *map, unsigned long key, void *val);
+int sp_chashmap_getf(const struct sp_chashmap *map, float key, void *val);
+int sp_chashmap_getd(const struct sp_chashmap *map, double key, void *val);
+int sp_chashmap_getld(const struct sp_chashmap *map, long double key, void *val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_chashmap_getb(const struct sp_chashmap *map, _Bool key, void *val);
+int sp_chashmap_getll(const struct sp_chashmap *map, long long key, void *val);
+int sp_chashmap_getull(const struct sp_chashmap *map, unsigned long long key, void *val);
+int sp_chashmap_getu8(const struct sp_chashmap *map, uint8_t key, void *val);
+int sp_chashmap_getu16(const struct sp_chashmap *map, uint16_t key, void *val);
+int sp_chashmap_getu32(const struct sp_chashmap *map, uint32_t key, void *val);
+int sp_chashmap_getu64(const struct sp_chashmap *map, uint64_t key, void *val);
+int sp_chashmap_geti8(const struct sp_chashmap *map, int8_t key, void *val);
+int sp_chashmap_geti16(const struct sp_chashmap *map, int16_t key, void *val);
+int sp_chashmap_geti32(const struct sp_chashmap *map, int32_t key, void *val);
+int sp_chashmap_geti64(const struct sp_chashmap *map, int64_t key, void *val);
+#endif
+
+int sp_chashmap_remove(struct sp_chashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_chashmap_removec(struct sp_chashmap *map, char key, int (*dtor)(void*));
+int sp_chashmap_removes(struct sp_chashmap *map, short key, int (*dtor)(void*));
+int sp_chashmap_removei(struct sp_chashmap *map, int key, int (*dtor)(void*));
+int sp_chashmap_removel(struct sp_chashmap *map, long key, int (*dtor)(void*));
+int sp_chashmap_removesc(struct sp_chashmap *map, signed char key, int (*dtor)(void*));
+int sp_chashmap_removeuc(struct sp_chashmap *map, unsigned char key, int (*dtor)(void*));
+int sp_chashmap_removeus(struct sp_chashmap *map, unsigned short key, int (*dtor)(void*));
+int sp_chashmap_removeui(struct sp_chashmap *map, unsigned int key, int (*dtor)(void*));
+int sp_chashmap_removeul(struct sp_chashmap *map, unsigned long key, int (*dtor)(void*));
+int sp_chashmap_removef(struct sp_chashmap *map, float key, int (*dtor)(void*));
+int sp_chashmap_removed(struct sp_chashmap *map, double key, int (*dtor)(void*));
+int sp_chashmap_removeld(struct sp_chashmap *map, long double key, int (*dtor)(void*));
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_chashmap_removeb(struct sp_chashmap *map, _Bool key, int (*dtor)(void*));
+int sp_chashmap_removell(struct sp_chashmap *map, long long key, int (*dtor)(void*));
+int sp_chashmap_removeull(struct sp_chashmap *map, unsigned long long key, int (*dtor)(void*));
+int sp_chashmap_removeu8(struct sp_chashmap *map, uint8_t key, int (*dtor)(void*));
+int sp_chashmap_removeu16(struct sp_chashmap *map, uint16_t key, int (*dtor)(void*));
+int sp_chashmap_removeu32(struct sp_chashmap *map, uint32_t key, int (*dtor)(void*));
+int sp_chashmap_removeu64(struct sp_chashmap *map, uint64_t key, int (*dtor)(void*));
+int sp_chashmap_removei8(struct sp_chashmap *map, int8_t key, int (*dtor)(void*));
+int sp_chashmap_removei16(struct sp_chashmap *map, int16_t key, int (*dtor)(void*));
+int sp_chashmap_removei32(struct sp_chashmap *map, int32_t key, int (*dtor)(void*));
+int sp_chashmap_removei64(struct sp_chashmap *map, int64_t key, int (*dtor)(void*));
+#endif
+
+int sp_chashmap_print(const struct sp_chashmap *map, int (*func)(const void*, const void*));
+
+#endif /* STAPLE_CHASHMAP_H */
@@ -0,0 +1,415 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_DEQUE_H
+#define STAPLE_DEQUE_H
+
+/* The deque module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_deque {
+	void **blocks;
+	size_t nblocks;
+	size_t head;
+	size_t elem_size;
+	size_t size;
+	size_t block_size;
+};
+
+struct sp_deque *sp_deque_create(size_t elem_size, size_t block_size);
+int              sp_deque_clear(struct sp_deque *deque, int (*dtor)(void*));
+int              sp_deque_destroy(struct sp_deque *deque, int (*dtor)(void*));
+int              sp_deque_eq(const struct sp_deque *deque1, const struct sp_deque *deque2, int (*cmp)(const void*, const void*));
+int              sp_deque_copy(struct sp_deque *dest, const struct sp_deque *src, int (*cpy)(void*, const void*));
+int              sp_deque_map(struct sp_deque *deque, int (*func)(void*, size_t));
+
+int sp_deque_pushfront(struct sp_deque *deque, const void *elem);
+int sp_deque_pushfrontc(struct sp_deque *deque, char elem);
+int sp_deque_pushfronts(struct sp_deque *deque, short elem);
+int sp_deque_pushfronti(struct sp_deque *deque, int elem);
+int sp_deque_pushfrontl(struct sp_deque *deque, long elem);
+int sp_deque_pushfrontsc(struct sp_deque *deque, signed char elem);
+int sp_deque_pushfrontuc(struct sp_deque *deque, unsigned char elem);
+int sp_deque_pushfrontus(struct sp_deque *deque, unsigned short elem);
+int sp_deque_pushfrontui(struct sp_deque *deque, unsigned int elem);
+int sp_deque_pushfrontul(struct sp_deque *deque, unsigned long elem);
+int sp_deque_pushfrontf(struct sp_deque *deque, float elem);
+int sp_deque_pushfrontd(struct sp_deque *deque, double elem);
+int sp_deque_pushfrontld(struct sp_deque *deque, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_deque_pushfrontb(struct sp_deque *deque, _Bool elem);
+int sp_deque_pushfrontll(struct sp_deque *deque, long long elem);
+int sp_deque_pushfrontull(struct sp_deque *deque, unsigned long long elem);
+int sp_deque_pushfrontu8(struct sp_deque *deque, uint8_t elem);
+int sp_deque_pushfrontu16(struct sp_deque *deque, uint16_t elem);
+int sp_deque_pushfrontu32(struct sp_deque *deque, uint32_t elem);
+int sp_deque_pushfrontu64(struct sp_deque *deque, uint64_t elem);
+int sp_deque_pushfronti8(struct sp_deque *deque, int8_t elem);
+int sp_deque_pushfronti16(struct sp_deque *deque, int16_t elem);
+int sp_deque_pushfronti32(struct sp_deque *deque, int32_t elem);
+int sp_deque_pushfronti64(struct sp_deque *deque, int64_t elem);
+#endif
+int sp_deque_pushfrontstr(struct sp_deque *deque, const char *elem);
+int sp_deque_pushfrontstrn(struct sp_deque *deque, const char *elem, size_t len);
+
+int sp_deque_pushback(struct sp_deque *deque, const void *elem);
+int sp_deque_pushbackc(struct sp_deque *deque, char elem);
+int sp_deque_pushbacks(struct sp_deque *deque, short elem);
+int sp_deque_pushbacki(struct sp_deque *deque, int elem);
+int sp_deque_pushbackl(struct sp_deque *deque, long elem);
+int sp_deque_pushbacksc(struct sp_deque *deque, signed char elem);
+int sp_deque_pushbackuc(struct sp_deque *deque, unsigned char elem);
+int sp_deque_pushbackus(struct sp_deque *deque, unsigned short elem);
+int sp_deque_pushbackui(struct sp_deque *deque, unsigned int elem);
+int sp_deque_pushbackul(struct sp_deque *deque, unsigned long elem);
+int sp_deque_pushbackf(struct sp_deque *deque, float elem);
+int sp_deque_pushbackd(struct sp_deque *deque, double elem);
+int sp_deque_pushbackld(struct sp_deque *deque, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_deque_pushbackb(struct sp_deque *deque, _Bool elem);
+int sp_deque_pushbackll(struct sp_deque *deque, long long elem);
+int sp_deque_pushbackull(struct sp_deque *deque, unsigned long long elem);
+int sp_deque_pushbacku8(struct sp_deque *deque, uint8_t elem);
+int sp_deque_pushbacku16(struct sp_deque *deque, uint16_t elem);
+int sp_deque_pushbacku32(struct sp_deque *deque, uint32_t elem);
+int sp_deque_pushbacku64(struct sp_deque *deque, uint64_t elem);
+int sp_deque_pushbacki8(struct sp_deque *deque, int8_t elem);
+int sp_deque_pushbacki16(struct sp_deque *deque, int16_t elem);
+int sp_deque_pushbacki32(struct sp_deque *deque, int32_t elem);
+int sp_deque_pushbacki64(struct sp_deque *deque, int64_t elem);
+#endif
+int sp_deque_pushbackstr(struct sp_deque *deque, const char *elem);
+int sp_deque_pushbackstrn(struct sp_deque *deque, const char *elem, size_t len);
+
+int sp_deque_insert(struct sp_deque *deque, size_t idx, const void *elem);
+int sp_deque_insertc(struct sp_deque *deque, size_t idx, char elem);
+int sp_deque_inserts(struct sp_deque *deque, size_t idx, short elem);
+int sp_deque_inserti(struct sp_deque *deque, size_t idx, int elem);
+int sp_deque_insertl(struct sp_deque *deque, size_t idx, long elem);
+int sp_deque_insertsc(struct sp_deque *deque, size_t idx, signed char elem);
+int sp_deque_insertuc(struct sp_deque *deque, size_t idx, unsigned char elem);
+int sp_deque_insertus(struct sp_deque *deque, size_t idx, unsigned short elem);
+int sp_deque_insertui(struct sp_deque *deque, size_t idx, unsigned int elem);
+int sp_deque_insertul(struct sp_deque *deque, size_t idx, unsigned long elem);
+int sp_deque_insertf(struct sp_deque *deque, size_t idx, float elem);
+int sp_deque_insertd(struct sp_deque *deque, size_t idx, double elem);
+int sp_deque_insertld(struct sp_deque *deque, size_t idx, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_deque_insertb(struct sp_deque *deque, size_t idx, _Bool elem);
+int sp_deque_insertll(struct sp_deque *deque, size_t idx, long long elem);
+int sp_deque_insertull(struct sp_deque *deque, size_t idx, unsigned long long elem);
+int sp_deque_insertu8(struct sp_deque *deque, size_t idx, uint8_t elem);
+int sp_deque_insertu16(struct sp_deque *deque, size_t idx, uint16_t elem);
+int sp_deque_insertu32(struct sp_deque *deque, size_t idx, uint32_t elem);
+int sp_deque_insertu64(struct sp_deque *deque, size_t idx, uint64_t elem);
+int sp_deque_inserti8(struct sp_deque *deque, size_t idx, int8_t elem);
+int sp_deque_inserti16(struct sp_deque *deque, size_t idx, int16_t elem);
+int sp_deque_inserti32(struct sp_deque *deque, size_t idx, int32_t elem);
+int sp_deque_inserti64(struct sp_deque *deque, size_t idx, int64_t elem);
+#endif
+int sp_deque_insertstr(struct sp_deque *deque, size_t idx, const char *elem);
+int sp_deque_insertstrn(struct sp_deque *deque, size_t idx, const char *elem, size_t len);
+
+int sp_deque_qinsert(struct sp_deque *deque, size_t idx, const void *elem);
+int sp_deque_qinsertc(struct sp_deque *deque, size_t idx, char elem);
+int sp_deque_qinserts(struct sp_deque *deque, size_t idx, short elem);
+int sp_deque_qinserti(struct sp_deque *deque, size_t idx, int elem);
+int sp_deque_qinsertl(struct sp_deque *deque, size_t idx, long elem);
+int sp_deque_qinsertsc(struct sp_deque *deque, size_t idx, signed char elem);
+int sp_deque_qinsertuc(struct sp_deque *deque, size_t idx, unsigned char elem);
+int sp_deque_qinsertus(struct sp_deque *deque, size_t idx, unsigned short elem);
+int sp_deque_qinsertui(struct sp_deque *deque, size_t idx, unsigned int elem);
+int sp_deque_qinsertul(struct sp_deque *deque, size_t idx, unsigned long elem);
+int sp_deque_qinsertf(struct sp_deque *deque, size_t idx, float elem);
+int sp_deque_qinsertd(struct sp_deque *deque, size_t idx, double elem);
+int sp_deque_qinsertld(struct sp_deque *deque, size_t idx, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_deque_qinsertb(struct sp_deque *deque, size_t idx, _Bool elem);
+int sp_deque_qinsertll(struct sp_deque *deque, size_t idx, long long elem);
+int sp_deque_qinsertull(struct sp_deque *deque, size_t idx, unsigned long long elem);
+int sp_deque_qinsertu8(struct sp_deque *deque, size_t idx, uint8_t elem);
+int sp_deque_qinsertu16(struct sp_deque *deque, size_t idx, uint16_t elem);
+int sp_deque_qinsertu32(struct sp_deque *deque, size_t idx, uint32_t elem);
+int sp_deque_qinsertu64(struct sp_deque *deque, size_t idx, uint64_t elem);
+int sp_deque_qinserti8(struct sp_deque *deque, size_t idx, int8_t elem);
+int sp_deque_qinserti16(struct sp_deque *deque, size_t idx, int16_t elem);
+int sp_deque_qinserti32(struct sp_deque *deque, size_t idx, int32_t elem);
+int sp_deque_qinserti64(struct sp_deque *deque, size_t idx, int64_t elem);
+#endif
+int sp_deque_qinsertstr(struct sp_deque *deque, size_t idx, const char *elem);
+int sp_deque_qinsertstrn(struct sp_deque *deque, size_t idx, const char *elem, size_t len);
+
+void          *sp_deque_peekfront(const struct sp_deque *deque);
+char         sp_deque_peekfrontc(const struct sp_deque *deque);
+short         sp_deque_peekfronts(const struct sp_deque *deque);
+int         sp_deque_peekfronti(const struct sp_deque *deque);
+long         sp_deque_peekfrontl(const struct sp_deque *deque);
+signed char         sp_deque_peekfrontsc(const struct sp_deque *deque);
+unsigned char         sp_deque_peekfrontuc(const struct sp_deque *deque);
+unsigned short         sp_deque_peekfrontus(const struct sp_deque *deque);
+unsigned int         sp_deque_peekfrontui(const struct sp_deque *deque);
+unsigned long         sp_deque_peekfrontul(const struct sp_deque *deque);
+float         sp_deque_peekfrontf(const struct sp_deque *deque);
+double         sp_deque_peekfrontd(const struct sp_deque *deque);
+long double         sp_deque_peekfrontld(const struct sp_deque *deque);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_peekfrontb(const struct sp_deque *deque);
+long long         sp_deque_peekfrontll(const struct sp_deque *deque);
+unsigned long long         sp_deque_peekfrontull(const struct sp_deque *deque);
+uint8_t         sp_deque_peekfrontu8(const struct sp_deque *deque);
+uint16_t         sp_deque_peekfrontu16(const struct sp_deque *deque);
+uint32_t         sp_deque_peekfrontu32(const struct sp_deque *deque);
+uint64_t         sp_deque_peekfrontu64(const struct sp_deque *deque);
+int8_t         sp_deque_peekfronti8(const struct sp_deque *deque);
+int16_t         sp_deque_peekfronti16(const struct sp_deque *deque);
+int32_t         sp_deque_peekfronti32(const struct sp_deque *deque);
+int64_t         sp_deque_peekfronti64(const struct sp_deque *deque);
+#endif
+char          *sp_deque_peekfrontstr(const struct sp_deque *deque);
+
+void          *sp_deque_peekback(const struct sp_deque *deque);
+char         sp_deque_peekbackc(const struct sp_deque *deque);
+short         sp_deque_peekbacks(const struct sp_deque *deque);
+int         sp_deque_peekbacki(const struct sp_deque *deque);
+long         sp_deque_peekbackl(const struct sp_deque *deque);
+signed char         sp_deque_peekbacksc(const struct sp_deque *deque);
+unsigned char         sp_deque_peekbackuc(const struct sp_deque *deque);
+unsigned short         sp_deque_peekbackus(const struct sp_deque *deque);
+unsigned int         sp_deque_peekbackui(const struct sp_deque *deque);
+unsigned long         sp_deque_peekbackul(const struct sp_deque *deque);
+float         sp_deque_peekbackf(const struct sp_deque *deque);
+double         sp_deque_peekbackd(const struct sp_deque *deque);
+long double         sp_deque_peekbackld(const struct sp_deque *deque);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_peekbackb(const struct sp_deque *deque);
+long long         sp_deque_peekbackll(const struct sp_deque *deque);
+unsigned long long         sp_deque_peekbackull(const struct sp_deque *deque);
+uint8_t         sp_deque_peekbacku8(const struct sp_deque *deque);
+uint16_t         sp_deque_peekbacku16(const struct sp_deque *deque);
+uint32_t         sp_deque_peekbacku32(const struct sp_deque *deque);
+uint64_t         sp_deque_peekbacku64(const struct sp_deque *deque);
+int8_t         sp_deque_peekbacki8(const struct sp_deque *deque);
+int16_t         sp_deque_peekbacki16(const struct sp_deque *deque);
+int32_t         sp_deque_peekbacki32(const struct sp_deque *deque);
+int64_t         sp_deque_peekbacki64(const struct sp_deque *deque);
+#endif
+char          *sp_deque_peekbackstr(const struct sp_deque *deque);
+
+int            sp_deque_popfront(struct sp_deque *deque, int (*dtor)(void*));
+char         sp_deque_popfrontc(struct sp_deque *deque);
+short         sp_deque_popfronts(struct sp_deque *deque);
+int         sp_deque_popfronti(struct sp_deque *deque);
+long         sp_deque_popfrontl(struct sp_deque *deque);
+signed char         sp_deque_popfrontsc(struct sp_deque *deque);
+unsigned char         sp_deque_popfrontuc(struct sp_deque *deque);
+unsigned short         sp_deque_popfrontus(struct sp_deque *deque);
+unsigned int         sp_deque_popfrontui(struct sp_deque *deque);
+unsigned long         sp_deque_popfrontul(struct sp_deque *deque);
+float         sp_deque_popfrontf(struct sp_deque *deque);
+double         sp_deque_popfrontd(struct sp_deque *deque);
+long double         sp_deque_popfrontld(struct sp_deque *deque);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_popfrontb(struct sp_deque *deque);
+long long         sp_deque_popfrontll(struct sp_deque *deque);
+unsigned long long         sp_deque_popfrontull(struct sp_deque *deque);
+uint8_t         sp_deque_popfrontu8(struct sp_deque *deque);
+uint16_t         sp_deque_popfrontu16(struct sp_deque *deque);
+uint32_t         sp_deque_popfrontu32(struct sp_deque *deque);
+uint64_t         sp_deque_popfrontu64(struct sp_deque *deque);
+int8_t         sp_deque_popfronti8(struct sp_deque *deque);
+int16_t         sp_deque_popfronti16(struct sp_deque *deque);
+int32_t         sp_deque_popfronti32(struct sp_deque *deque);
+int64_t         sp_deque_popfronti64(struct sp_deque *deque);
+#endif
+char          *sp_deque_popfrontstr(struct sp_deque *deque);
+
+int            sp_deque_popback(struct sp_deque *deque, int (*dtor)(void*));
+char         sp_deque_popbackc(struct sp_deque *deque);
+short         sp_deque_popbacks(struct sp_deque *deque);
+int         sp_deque_popbacki(struct sp_deque *deque);
+long         sp_deque_popbackl(struct sp_deque *deque);
+signed char         sp_deque_popbacksc(struct sp_deque *deque);
+unsigned char         sp_deque_popbackuc(struct sp_deque *deque);
+unsigned short         sp_deque_popbackus(struct sp_deque *deque);
+unsigned int         sp_deque_popbackui(struct sp_deque *deque);
+unsigned long         sp_deque_popbackul(struct sp_deque *deque);
+float         sp_deque_popbackf(struct sp_deque *deque);
+double         sp_deque_popbackd(struct sp_deque *deque);
+long double         sp_deque_popbackld(struct sp_deque *deque);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_popbackb(struct sp_deque *deque);
+long long         sp_deque_popbackll(struct sp_deque *deque);
+unsigned long long         sp_deque_popbackull(struct sp_deque *deque);
+uint8_t         sp_deque_popbacku8(struct sp_deque *deque);
+uint16_t         sp_deque_popbacku16(struct sp_deque *deque);
+uint32_t         sp_deque_popbacku32(struct sp_deque *deque);
+uint64_t         sp_deque_popbacku64(struct sp_deque *deque);
+int8_t         sp_deque_popbacki8(struct sp_deque *deque);
+int16_t         sp_deque_popbacki16(struct sp_deque *deque);
+int32_t         sp_deque_popbacki32(struct sp_deque *deque);
+int64_t         sp_deque_popbacki64(struct sp_deque *deque);
+#endif
+char          *sp_deque_popbackstr(struct sp_deque *deque);
+
+int            sp_deque_remove(struct sp_deque *deque, size_t idx, int (*dtor)(void*));
+char         sp_deque_removec(struct sp_deque *deque, size_t idx);
+short         sp_deque_removes(struct sp_deque *deque, size_t idx);
+int         sp_deque_removei(struct sp_deque *deque, size_t idx);
+long         sp_deque_removel(struct sp_deque *deque, size_t idx);
+signed char         sp_deque_removesc(struct sp_deque *deque, size_t idx);
+unsigned char         sp_deque_removeuc(struct sp_deque *deque, size_t idx);
+unsigned short         sp_deque_removeus(struct sp_deque *deque, size_t idx);
+unsigned int         sp_deque_removeui(struct sp_deque *deque, size_t idx);
+unsigned long         sp_deque_removeul(struct sp_deque *deque, size_t idx);
+float         sp_deque_removef(struct sp_deque *deque, size_t idx);
+double         sp_deque_removed(struct sp_deque *deque, size_t idx);
+long double         sp_deque_removeld(struct sp_deque *deque, size_t idx);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_removeb(struct sp_deque *deque, size_t idx);
+long long         sp_deque_removell(struct sp_deque *deque, size_t idx);
+unsigned long long         sp_deque_removeull(struct sp_deque *deque, size_t idx);
+uint8_t         sp_deque_removeu8(struct sp_deque *deque, size_t idx);
+uint16_t         sp_deque_removeu16(struct sp_deque *deque, size_t idx);
+uint32_t         sp_deque_removeu32(struct sp_deque *deque, size_t idx);
+uint64_t         sp_deque_removeu64(struct sp_deque *deque, size_t idx);
+int8_t         sp_deque_removei8(struct sp_deque *deque, size_t idx);
+int16_t         sp_deque_removei16(struct sp_deque *deque, size_t idx);
+int32_t         sp_deque_removei32(struct sp_deque *deque, size_t idx);
+int64_t         sp_deque_removei64(struct sp_deque *deque, size_t idx);
+#endif
+char          *sp_deque_removestr(struct sp_deque *deque, size_t idx);
+
+int            sp_deque_qremove(struct sp_deque *deque, size_t idx, int (*dtor)(void*));
+char         sp_deque_qremovec(struct sp_deque *deque, size_t idx);
+short         sp_deque_qremoves(struct sp_deque *deque, size_t idx);
+int         sp_deque_qremovei(struct sp_deque *deque, size_t idx);
+long         sp_deque_qremovel(struct sp_deque *deque, size_t idx);
+signed char         sp_deque_qremovesc(struct sp_deque *deque, size_t idx);
+unsigned char         sp_deque_qremoveuc(struct sp_deque *deque, size_t idx);
+unsigned short         sp_deque_qremoveus(struct sp_deque *deque, size_t idx);
+unsigned int         sp_deque_qremoveui(struct sp_deque *deque, size_t idx);
+unsigned long         sp_deque_qremoveul(struct sp_deque *deque, size_t idx);
+float         sp_deque_qremovef(struct sp_deque *deque, size_t idx);
+double         sp_deque_qremoved(struct sp_deque *deque, size_t idx);
+long double         sp_deque_qremoveld(struct sp_deque *deque, size_t idx);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_qremoveb(struct sp_deque *deque, size_t idx);
+long long         sp_deque_qremovell(struct sp_deque *deque, size_t idx);
+unsigned long long         sp_deque_qremoveull(struct sp_deque *deque, size_t idx);
+uint8_t         sp_deque_qremoveu8(struct sp_deque *deque, size_t idx);
+uint16_t         sp_deque_qremoveu16(struct sp_deque *deque, size_t idx);
+uint32_t         sp_deque_qremoveu32(struct sp_deque *deque, size_t idx);
+uint64_t         sp_deque_qremoveu64(struct sp_deque *deque, size_t idx);
+int8_t         sp_deque_qremovei8(struct sp_deque *deque, size_t idx);
+int16_t         sp_deque_qremovei16(struct sp_deque *deque, size_t idx);
+int32_t         sp_deque_qremovei32(struct sp_deque *deque, size_t idx);
+int64_t         sp_deque_qremovei64(struct sp_deque *deque, size_t idx);
+#endif
+char          *sp_deque_qremovestr(struct sp_deque *deque, size_t idx);
+
+void          *sp_deque_get(const struct sp_deque *deque, size_t idx);
+char         sp_deque_getc(const struct sp_deque *deque, size_t idx);
+short         sp_deque_gets(const struct sp_deque *deque, size_t idx);
+int         sp_deque_geti(const struct sp_deque *deque, size_t idx);
+long         sp_deque_getl(const struct sp_deque *deque, size_t idx);
+signed char         sp_deque_getsc(const struct sp_deque *deque, size_t idx);
+unsigned char         sp_deque_getuc(const struct sp_deque *deque, size_t idx);
+unsigned short         sp_deque_getus(const struct sp_deque *deque, size_t idx);
+unsigned int         sp_deque_getui(const struct sp_deque *deque, size_t idx);
+unsigned long         sp_deque_getul(const struct sp_deque *deque, size_t idx);
+float         sp_deque_getf(const struct sp_deque *deque, size_t idx);
+double         sp_deque_getd(const struct sp_deque *deque, size_t idx);
+long double         sp_deque_getld(const struct sp_deque *deque, size_t idx);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_deque_getb(const struct sp_deque *deque, size_t idx);
+long long         sp_deque_getll(const struct sp_deque *deque, size_t idx);
+unsigned long long         sp_deque_getull(const struct sp_deque *deque, size_t idx);
+uint8_t         sp_deque_getu8(const struct sp_deque *deque, size_t idx);
+uint16_t         sp_deque_getu16(const struct sp_deque *deque, size_t idx);
+uint32_t         sp_deque_getu32(const struct sp_deque *deque, size_t idx);
+uint64_t         sp_deque_getu64(const struct sp_deque *deque, size_t idx);
+int8_t         sp_deque_geti8(const struct sp_deque *deque, size_t idx);
+int16_t         sp_deque_geti16(const struct sp_deque *deque, size_t idx);
+int32_t         sp_deque_geti32(const struct sp_deque *deque, size_t idx);
+int64_t         sp_deque_geti64(const struct sp_deque *deque, size_t idx);
+#endif
+char          *sp_deque_getstr(const struct sp_deque *deque, size_t idx);
+
+int sp_deque_set(struct sp_deque *deque, size_t idx, void *val);
+int sp_deque_setc(struct sp_deque *deque, size_t idx, char val);
+int sp_deque_sets(struct sp_deque *deque, size_t idx, short val);
+int sp_deque_seti(struct sp_deque *deque, size_t idx, int val);
+int sp_deque_setl(struct sp_deque *deque, size_t idx, long val);
+int sp_deque_setsc(struct sp_deque *deque, size_t idx, signed char val);
+int sp_deque_setuc(struct sp_deque *deque, size_t idx, unsigned char val);
+int sp_deque_setus(struct sp_deque *deque, size_t idx, unsigned short val);
+int sp_deque_setui(struct sp_deque *deque, size_t idx, unsigned int val);
+int sp_deque_setul(struct sp_deque *deque, size_t idx, unsigned long val);
+int sp_deque_setf(struct sp_deque *deque, size_t idx, float val);
+int sp_deque_setd(struct sp_deque *deque, size_t idx, double val);
+int sp_deque_setld(struct sp_deque *deque, size_t idx, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_deque_setb(struct sp_deque *deque, size_t idx, _Bool val);
+int sp_deque_setll(struct sp_deque *deque, size_t idx, long long val);
+int sp_deque_setull(struct sp_deque *deque, size_t idx, unsigned long long val);
+int sp_deque_setu8(struct sp_deque *deque, size_t idx, uint8_t val);
+int sp_deque_setu16(struct sp_deque *deque, size_t idx, uint16_t val);
+int sp_deque_setu32(struct sp_deque *deque, size_t idx, uint32_t val);
+int sp_deque_setu64(struct sp_deque *deque, size_t idx, uint64_t val);
+int sp_deque_seti8(struct sp_deque *deque, size_t idx, int8_t val);
+int sp_deque_seti16(struct sp_deque *deque, size_t idx, int16_t val);
+int sp_deque_seti32(struct sp_deque *deque, size_t idx, int32_t val);
+int sp_deque_seti64(struct sp_deque *deque, size_t idx, int64_t val);
+#endif
+int sp_deque_setstr(struct sp_deque *deque, size_t idx, const char *val);
+int sp_deque_setstrn(struct sp_deque *deque, size_t idx, const char *val, size_t len);
+
+int sp_deque_print(const struct sp_deque *deque, int (*func)(const void*));
+int sp_deque_printc(const struct sp_deque *deque);
+int sp_deque_prints(const struct sp_deque *deque);
+int sp_deque_printi(const struct sp_deque *deque);
+int sp_deque_printl(const struct sp_deque *deque);
+int sp_deque_printsc(const struct sp_deque *deque);
+int sp_deque_printuc(const struct sp_deque *deque);
+int sp_deque_printus(const struct sp_deque *deque);
+int sp_deque_printui(const struct sp_deque *deque);
+int sp_deque_printul(const struct sp_deque *deque);
+int sp_deque_printf(const struct sp_deque *deque);
+int sp_deque_printd(const struct sp_deque *deque);
+int sp_deque_printld(const struct sp_deque *deque);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_deque_printb(const struct sp_deque *deque);
+int sp_deque_printll(const struct sp_deque *deque);
+int sp_deque_printull(const struct sp_deque *deque);
+int sp_deque_printu8(const struct sp_deque *deque);
+int sp_deque_printu16(const struct sp_deque *deque);
+int sp_deque_printu32(const struct sp_deque *deque);
+int sp_deque_printu64(const struct sp_deque *deque);
+int sp_deque_printi8(const struct sp_deque *deque);
+int sp_deque_printi16(const struct sp_deque *deque);
+int sp_deque_printi32(const struct sp_deque *deque);
+int sp_deque_printi64(const struct sp_deque *deque);
+#endif
+int sp_deque_printstr(const struct sp_deque *deque);
+
+#endif /* STAPLE_DEQUE_H */
@@ -41,4 +41,7 @@
 /* Numerical range exceeded (underflow/overflow) */
 #define SP_ERANGE 6
 
+/* Key not found */
+#define SP_ENOKEY 7
+
 #endif /* STAPLE_ERRCODES_H */
@@ -0,0 +1,243 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_FENWICK_H
+#define STAPLE_FENWICK_H
+
+/* The Fenwick tree module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_fenwick {
+	void  *data;
+	size_t elem_size;
+	size_t size;
+};
+
+struct sp_fenwick *sp_fenwick_create(size_t elem_size, size_t size);
+int                sp_fenwick_clear(struct sp_fenwick *fw);
+int                sp_fenwick_destroy(struct sp_fenwick *fw);
+
+int     sp_fenwick_buildc(struct sp_fenwick *fw, const char *vals);
+int     sp_fenwick_builds(struct sp_fenwick *fw, const short *vals);
+int     sp_fenwick_buildi(struct sp_fenwick *fw, const int *vals);
+int     sp_fenwick_buildl(struct sp_fenwick *fw, const long *vals);
+int     sp_fenwick_buildsc(struct sp_fenwick *fw, const signed char *vals);
+int     sp_fenwick_builduc(struct sp_fenwick *fw, const unsigned char *vals);
+int     sp_fenwick_buildus(struct sp_fenwick *fw, const unsigned short *vals);
+int     sp_fenwick_buildui(struct sp_fenwick *fw, const unsigned int *vals);
+int     sp_fenwick_buildul(struct sp_fenwick *fw, const unsigned long *vals);
+int     sp_fenwick_buildf(struct sp_fenwick *fw, const float *vals);
+int     sp_fenwick_buildd(struct sp_fenwick *fw, const double *vals);
+int     sp_fenwick_buildld(struct sp_fenwick *fw, const long double *vals);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_fenwick_buildb(struct sp_fenwick *fw, const _Bool *vals);
+int     sp_fenwick_buildll(struct sp_fenwick *fw, const long long *vals);
+int     sp_fenwick_buildull(struct sp_fenwick *fw, const unsigned long long *vals);
+int     sp_fenwick_buildu8(struct sp_fenwick *fw, const uint8_t *vals);
+int     sp_fenwick_buildu16(struct sp_fenwick *fw, const uint16_t *vals);
+int     sp_fenwick_buildu32(struct sp_fenwick *fw, const uint32_t *vals);
+int     sp_fenwick_buildu64(struct sp_fenwick *fw, const uint64_t *vals);
+int     sp_fenwick_buildi8(struct sp_fenwick *fw, const int8_t *vals);
+int     sp_fenwick_buildi16(struct sp_fenwick *fw, const int16_t *vals);
+int     sp_fenwick_buildi32(struct sp_fenwick *fw, const int32_t *vals);
+int     sp_fenwick_buildi64(struct sp_fenwick *fw, const int64_t *vals);
+#endif
+int     sp_fenwick_addc(struct sp_fenwick *fw, size_t idx, char delta);
+int     sp_fenwick_adds(struct sp_fenwick *fw, size_t idx, short delta);
+int     sp_fenwick_addi(struct sp_fenwick *fw, size_t idx, int delta);
+int     sp_fenwick_addl(struct sp_fenwick *fw, size_t idx, long delta);
+int     sp_fenwick_addsc(struct sp_fenwick *fw, size_t idx, signed char delta);
+int     sp_fenwick_adduc(struct sp_fenwick *fw, size_t idx, unsigned char delta);
+int     sp_fenwick_addus(struct sp_fenwick *fw, size_t idx, unsigned short delta);
+int     sp_fenwick_addui(struct sp_fenwick *fw, size_t idx, unsigned int delta);
+int     sp_fenwick_addul(struct sp_fenwick *fw, size_t idx, unsigned long delta);
+int     sp_fenwick_addf(struct sp_fenwick *fw, size_t idx, float delta);
+int     sp_fenwick_addd(struct sp_fenwick *fw, size_t idx, double delta);
+int     sp_fenwick_addld(struct sp_fenwick *fw, size_t idx, long double delta);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_fenwick_addb(struct sp_fenwick *fw, size_t idx, _Bool delta);
+int     sp_fenwick_addll(struct sp_fenwick *fw, size_t idx, long long delta);
+int     sp_fenwick_addull(struct sp_fenwick *fw, size_t idx, unsigned long long delta);
+int     sp_fenwick_addu8(struct sp_fenwick *fw, size_t idx, uint8_t delta);
+int     sp_fenwick_addu16(struct sp_fenwick *fw, size_t idx, uint16_t delta);
+int     sp_fenwick_addu32(struct sp_fenwick *fw, size_t idx, uint32_t delta);
+int     sp_fenwick_addu64(struct sp_fenwick *fw, size_t idx, uint64_t delta);
+int     sp_fenwick_addi8(struct sp_fenwick *fw, size_t idx, int8_t delta);
+int     sp_fenwick_addi16(struct sp_fenwick *fw, size_t idx, int16_t delta);
+int     sp_fenwick_addi32(struct sp_fenwick *fw, size_t idx, int32_t delta);
+int     sp_fenwick_addi64(struct sp_fenwick *fw, size_t idx, int64_t delta);
+#endif
+int     sp_fenwick_setc(struct sp_fenwick *fw, size_t idx, char val);
+int     sp_fenwick_sets(struct sp_fenwick *fw, size_t idx, short val);
+int     sp_fenwick_seti(struct sp_fenwick *fw, size_t idx, int val);
+int     sp_fenwick_setl(struct sp_fenwick *fw, size_t idx, long val);
+int     sp_fenwick_setsc(struct sp_fenwick *fw, size_t idx, signed char val);
+int     sp_fenwick_setuc(struct sp_fenwick *fw, size_t idx, unsigned char val);
+int     sp_fenwick_setus(struct sp_fenwick *fw, size_t idx, unsigned short val);
+int     sp_fenwick_setui(struct sp_fenwick *fw, size_t idx, unsigned int val);
+int     sp_fenwick_setul(struct sp_fenwick *fw, size_t idx, unsigned long val);
+int     sp_fenwick_setf(struct sp_fenwick *fw, size_t idx, float val);
+int     sp_fenwick_setd(struct sp_fenwick *fw, size_t idx, double val);
+int     sp_fenwick_setld(struct sp_fenwick *fw, size_t idx, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_fenwick_setb(struct sp_fenwick *fw, size_t idx, _Bool val);
+int     sp_fenwick_setll(struct sp_fenwick *fw, size_t idx, long long val);
+int     sp_fenwick_setull(struct sp_fenwick *fw, size_t idx, unsigned long long val);
+int     sp_fenwick_setu8(struct sp_fenwick *fw, size_t idx, uint8_t val);
+int     sp_fenwick_setu16(struct sp_fenwick *fw, size_t idx, uint16_t val);
+int     sp_fenwick_setu32(struct sp_fenwick *fw, size_t idx, uint32_t val);
+int     sp_fenwick_setu64(struct sp_fenwick *fw, size_t idx, uint64_t val);
+int     sp_fenwick_seti8(struct sp_fenwick *fw, size_t idx, int8_t val);
+int     sp_fenwick_seti16(struct sp_fenwick *fw, size_t idx, int16_t val);
+int     sp_fenwick_seti32(struct sp_fenwick *fw, size_t idx, int32_t val);
+int     sp_fenwick_seti64(struct sp_fenwick *fw, size_t idx, int64_t val);
+#endif
+char  sp_fenwick_getc(const struct sp_fenwick *fw, size_t idx);
+short  sp_fenwick_gets(const struct sp_fenwick *fw, size_t idx);
+int  sp_fenwick_geti(const struct sp_fenwick *fw, size_t idx);
+long  sp_fenwick_getl(const struct sp_fenwick *fw, size_t idx);
+signed char  sp_fenwick_getsc(const struct sp_fenwick *fw, size_t idx);
+unsigned char  sp_fenwick_getuc(const struct sp_fenwick *fw, size_t idx);
+unsigned short  sp_fenwick_getus(const struct sp_fenwick *fw, size_t idx);
+unsigned int  sp_fenwick_getui(const struct sp_fenwick *fw, size_t idx);
+unsigned long  sp_fenwick_getul(const struct sp_fenwick *fw, size_t idx);
+float  sp_fenwick_getf(const struct sp_fenwick *fw, size_t idx);
+double  sp_fenwick_getd(const struct sp_fenwick *fw, size_t idx);
+long double  sp_fenwick_getld(const struct sp_fenwick *fw, size_t idx);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_fenwick_getb(const struct sp_fenwick *fw, size_t idx);
+long long  sp_fenwick_getll(const struct sp_fenwick *fw, size_t idx);
+unsigned long long  sp_fenwick_getull(const struct sp_fenwick *fw, size_t idx);
+uint8_t  sp_fenwick_getu8(const struct sp_fenwick *fw, size_t idx);
+uint16_t  sp_fenwick_getu16(const struct sp_fenwick *fw, size_t idx);
+uint32_t  sp_fenwick_getu32(const struct sp_fenwick *fw, size_t idx);
+uint64_t  sp_fenwick_getu64(const struct sp_fenwick *fw, size_t idx);
+int8_t  sp_fenwick_geti8(const struct sp_fenwick *fw, size_t idx);
+int16_t  sp_fenwick_geti16(const struct sp_fenwick *fw, size_t idx);
+int32_t  sp_fenwick_geti32(const struct sp_fenwick *fw, size_t idx);
+int64_t  sp_fenwick_geti64(const struct sp_fenwick *fw, size_t idx);
+#endif
+
+char  sp_fenwick_prefixc(const struct sp_fenwick *fw, size_t n);
+short  sp_fenwick_prefixs(const struct sp_fenwick *fw, size_t n);
+int  sp_fenwick_prefixi(const struct sp_fenwick *fw, size_t n);
+long  sp_fenwick_prefixl(const struct sp_fenwick *fw, size_t n);
+signed char  sp_fenwick_prefixsc(const struct sp_fenwick *fw, size_t n);
+unsigned char  sp_fenwick_prefixuc(const struct sp_fenwick *fw, size_t n);
+unsigned short  sp_fenwick_prefixus(const struct sp_fenwick *fw, size_t n);
+unsigned int  sp_fenwick_prefixui(const struct sp_fenwick *fw, size_t n);
+unsigned long  sp_fenwick_prefixul(const struct sp_fenwick *fw, size_t n);
+float  sp_fenwick_prefixf(const struct sp_fenwick *fw, size_t n);
+double  sp_fenwick_prefixd(const struct sp_fenwick *fw, size_t n);
+long double  sp_fenwick_prefixld(const struct sp_fenwick *fw, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_fenwick_prefixb(const struct sp_fenwick *fw, size_t n);
+long long  sp_fenwick_prefixll(const struct sp_fenwick *fw, size_t n);
+unsigned long long  sp_fenwick_prefixull(const struct sp_fenwick *fw, size_t n);
+uint8_t  sp_fenwick_prefixu8(const struct sp_fenwick *fw, size_t n);
+uint16_t  sp_fenwick_prefixu16(const struct sp_fenwick *fw, size_t n);
+uint32_t  sp_fenwick_prefixu32(const struct sp_fenwick *fw, size_t n);
+uint64_t  sp_fenwick_prefixu64(const struct sp_fenwick *fw, size_t n);
+int8_t  sp_fenwick_prefixi8(const struct sp_fenwick *fw, size_t n);
+int16_t  sp_fenwick_prefixi16(const struct sp_fenwick *fw, size_t n);
+int32_t  sp_fenwick_prefixi32(const struct sp_fenwick *fw, size_t n);
+int64_t  sp_fenwick_prefixi64(const struct sp_fenwick *fw, size_t n);
+#endif
+char  sp_fenwick_sumc(const struct sp_fenwick *fw, size_t idx, size_t n);
+short  sp_fenwick_sums(const struct sp_fenwick *fw, size_t idx, size_t n);
+int  sp_fenwick_sumi(const struct sp_fenwick *fw, size_t idx, size_t n);
+long  sp_fenwick_suml(const struct sp_fenwick *fw, size_t idx, size_t n);
+signed char  sp_fenwick_sumsc(const struct sp_fenwick *fw, size_t idx, size_t n);
+unsigned char  sp_fenwick_sumuc(const struct sp_fenwick *fw, size_t idx, size_t n);
+unsigned short  sp_fenwick_sumus(const struct sp_fenwick *fw, size_t idx, size_t n);
+unsigned int  sp_fenwick_sumui(const struct sp_fenwick *fw, size_t idx, size_t n);
+unsigned long  sp_fenwick_sumul(const struct sp_fenwick *fw, size_t idx, size_t n);
+float  sp_fenwick_sumf(const struct sp_fenwick *fw, size_t idx, size_t n);
+double  sp_fenwick_sumd(const struct sp_fenwick *fw, size_t idx, size_t n);
+long double  sp_fenwick_sumld(const struct sp_fenwick *fw, size_t idx, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_fenwick_sumb(const struct sp_fenwick *fw, size_t idx, size_t n);
+long long  sp_fenwick_sumll(const struct sp_fenwick *fw, size_t idx, size_t n);
+unsigned long long  sp_fenwick_sumull(const struct sp_fenwick *fw, size_t idx, size_t n);
+uint8_t  sp_fenwick_sumu8(const struct sp_fenwick *fw, size_t idx, size_t n);
+uint16_t  sp_fenwick_sumu16(const struct sp_fenwick *fw, size_t idx, size_t n);
+uint32_t  sp_fenwick_sumu32(const struct sp_fenwick *fw, size_t idx, size_t n);
+uint64_t  sp_fenwick_sumu64(const struct sp_fenwick *fw, size_t idx, size_t n);
+int8_t  sp_fenwick_sumi8(const struct sp_fenwick *fw, size_t idx, size_t n);
+int16_t  sp_fenwick_sumi16(const struct sp_fenwick *fw, size_t idx, size_t n);
+int32_t  sp_fenwick_sumi32(const struct sp_fenwick *fw, size_t idx, size_t n);
+int64_t  sp_fenwick_sumi64(const struct sp_fenwick *fw, size_t idx, size_t n);
+#endif
+size_t  sp_fenwick_lowerboundc(const struct sp_fenwick *fw, char target);
+size_t  sp_fenwick_lowerbounds(const struct sp_fenwick *fw, short target);
+size_t  sp_fenwick_lowerboundi(const struct sp_fenwick *fw, int target);
+size_t  sp_fenwick_lowerboundl(const struct sp_fenwick *fw, long target);
+size_t  sp_fenwick_lowerboundsc(const struct sp_fenwick *fw, signed char target);
+size_t  sp_fenwick_lowerbounduc(const struct sp_fenwick *fw, unsigned char target);
+size_t  sp_fenwick_lowerboundus(const struct sp_fenwick *fw, unsigned short target);
+size_t  sp_fenwick_lowerboundui(const struct sp_fenwick *fw, unsigned int target);
+size_t  sp_fenwick_lowerboundul(const struct sp_fenwick *fw, unsigned long target);
+size_t  sp_fenwick_lowerboundf(const struct sp_fenwick *fw, float target);
+size_t  sp_fenwick_lowerboundd(const struct sp_fenwick *fw, double target);
+size_t  sp_fenwick_lowerboundld(const struct sp_fenwick *fw, long double target);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+size_t  sp_fenwick_lowerboundb(const struct sp_fenwick *fw, _Bool target);
+size_t  sp_fenwick_lowerboundll(const struct sp_fenwick *fw, long long target);
+size_t  sp_fenwick_lowerboundull(const struct sp_fenwick *fw, unsigned long long target);
+size_t  sp_fenwick_lowerboundu8(const struct sp_fenwick *fw, uint8_t target);
+size_t  sp_fenwick_lowerboundu16(const struct sp_fenwick *fw, uint16_t target);
+size_t  sp_fenwick_lowerboundu32(const struct sp_fenwick *fw, uint32_t target);
+size_t  sp_fenwick_lowerboundu64(const struct sp_fenwick *fw, uint64_t target);
+size_t  sp_fenwick_lowerboundi8(const struct sp_fenwick *fw, int8_t target);
+size_t  sp_fenwick_lowerboundi16(const struct sp_fenwick *fw, int16_t target);
+size_t  sp_fenwick_lowerboundi32(const struct sp_fenwick *fw, int32_t target);
+size_t  sp_fenwick_lowerboundi64(const struct sp_fenwick *fw, int64_t target);
+#endif
+
+int sp_fenwick_printc(const struct sp_fenwick *fw);
+int sp_fenwick_prints(const struct sp_fenwick *fw);
+int sp_fenwick_printi(const struct sp_fenwick *fw);
+int sp_fenwick_printl(const struct sp_fenwick *fw);
+int sp_fenwick_printsc(const struct sp_fenwick *fw);
+int sp_fenwick_printuc(const struct sp_fenwick *fw);
+int sp_fenwick_printus(const struct sp_fenwick *fw);
+int sp_fenwick_printui(const struct sp_fenwick *fw);
+int sp_fenwick_printul(const struct sp_fenwick *fw);
+int sp_fenwick_printf(const struct sp_fenwick *fw);
+int sp_fenwick_printd(const struct sp_fenwick *fw);
+int sp_fenwick_printld(const struct sp_fenwick *fw);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_fenwick_printb(const struct sp_fenwick *fw);
+int sp_fenwick_printll(const struct sp_fenwick *fw);
+int sp_fenwick_printull(const struct sp_fenwick *fw);
+int sp_fenwick_printu8(const struct sp_fenwick *fw);
+int sp_fenwick_printu16(const struct sp_fenwick *fw);
+int sp_fenwick_printu32(const struct sp_fenwick *fw);
+int sp_fenwick_printu64(const struct sp_fenwick *fw);
+int sp_fenwick_printi8(const struct sp_fenwick *fw);
+int sp_fenwick_printi16(const struct sp_fenwick *fw);
+int sp_fenwick_printi32(const struct sp_fenwick *fw);
+int sp_fenwick_printi64(const struct sp_fenwick *fw);
+#endif
+
+#endif /* STAPLE_FENWICK_H */
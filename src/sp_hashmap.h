@@ -0,0 +1,135 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_HASHMAP_H
+#define STAPLE_HASHMAP_H
+
+/* The hashmap module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_hashmap {
+	unsigned char *ctrl;
+	void  *slots;
+	size_t key_size;
+	size_t val_size;
+	size_t val_offset;
+	size_t slot_size;
+	size_t size;
+	size_t capacity;
+	size_t growth_left;
+	size_t (*hash)(const void*);
+	int    (*cmp)(const void*, const void*);
+};
+
+struct sp_hashmap *sp_hashmap_create(size_t key_size, size_t val_size, size_t capacity, size_t (*hash)(const void*), int (*cmp)(const void*, const void*));
+int                sp_hashmap_clear(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+int                sp_hashmap_destroy(struct sp_hashmap *map, int (*kdtor)(void*), int (*vdtor)(void*));
+int                sp_hashmap_reserve(struct sp_hashmap *map, size_t n);
+int                sp_hashmap_eq(const struct sp_hashmap *map1, const struct sp_hashmap *map2, int (*cmp)(const void*, const void*));
+int                sp_hashmap_copy(struct sp_hashmap *dest, const struct sp_hashmap *src, int (*kcpy)(void*, const void*), int (*vcpy)(void*, const void*));
+int                sp_hashmap_map(struct sp_hashmap *map, int (*func)(const void*, void*));
+
+int sp_hashmap_insert(struct sp_hashmap *map, const void *key, const void *val);
+int sp_hashmap_insertc(struct sp_hashmap *map, char key, const void *val);
+int sp_hashmap_inserts(struct sp_hashmap *map, short key, const void *val);
+int sp_hashmap_inserti(struct sp_hashmap *map, int key, const void *val);
+int sp_hashmap_insertl(struct sp_hashmap *map, long key, const void *val);
+int sp_hashmap_insertsc(struct sp_hashmap *map, signed char key, const void *val);
+int sp_hashmap_insertuc(struct sp_hashmap *map, unsigned char key, const void *val);
+int sp_hashmap_insertus(struct sp_hashmap *map, unsigned short key, const void *val);
+int sp_hashmap_insertui(struct sp_hashmap *map, unsigned int key, const void *val);
+int sp_hashmap_insertul(struct sp_hashmap *map, unsigned long key, const void *val);
+int sp_hashmap_insertf(struct sp_hashmap *map, float key, const void *val);
+int sp_hashmap_insertd(struct sp_hashmap *map, double key, const void *val);
+int sp_hashmap_insertld(struct sp_hashmap *map, long double key, const void *val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_hashmap_insertb(struct sp_hashmap *map, _Bool key, const void *val);
+int sp_hashmap_insertll(struct sp_hashmap *map, long long key, const void *val);
+int sp_hashmap_insertull(struct sp_hashmap *map, unsigned long long key, const void *val);
+int sp_hashmap_insertu8(struct sp_hashmap *map, uint8_t key, const void *val);
+int sp_hashmap_insertu16(struct sp_hashmap *map, uint16_t key, const void *val);
+int sp_hashmap_insertu32(struct sp_hashmap *map, uint32_t key, const void *val);
+int sp_hashmap_insertu64(struct sp_hashmap *map, uint64_t key, const void *val);
+int sp_hashmap_inserti8(struct sp_hashmap *map, int8_t key, const void *val);
+int sp_hashmap_inserti16(struct sp_hashmap *map, int16_t key, const void *val);
+int sp_hashmap_inserti32(struct sp_hashmap *map, int32_t key, const void *val);
+int sp_hashmap_inserti64(struct sp_hashmap *map, int64_t key, const void *val);
+#endif
+
+void *sp_hashmap_get(const struct sp_hashmap *map, const void *key);
+void *sp_hashmap_getc(const struct sp_hashmap *map, char key);
+void *sp_hashmap_gets(const struct sp_hashmap *map, short key);
+void *sp_hashmap_geti(const struct sp_hashmap *map, int key);
+void *sp_hashmap_getl(const struct sp_hashmap *map, long key);
+void *sp_hashmap_getsc(const struct sp_hashmap *map, signed char key);
+void *sp_hashmap_getuc(const struct sp_hashmap *map, unsigned char key);
+void *sp_hashmap_getus(const struct sp_hashmap *map, unsigned short key);
+void *sp_hashmap_getui(const struct sp_hashmap *map, unsigned int key);
+void *sp_hashmap_getul(const struct sp_hashmap *map, unsigned long key);
+void *sp_hashmap_getf(const struct sp_hashmap *map, float key);
+void *sp_hashmap_getd(const struct sp_hashmap *map, double key);
+void *sp_hashmap_getld(const struct sp_hashmap *map, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+void *sp_hashmap_getb(const struct sp_hashmap *map, _Bool key);
+void *sp_hashmap_getll(const struct sp_hashmap *map, long long key);
+void *sp_hashmap_getull(const struct sp_hashmap *map, unsigned long long key);
+void *sp_hashmap_getu8(const struct sp_hashmap *map, uint8_t key);
+void *sp_hashmap_getu16(const struct sp_hashmap *map, uint16_t key);
+void *sp_hashmap_getu32(const struct sp_hashmap *map, uint32_t key);
+void *sp_hashmap_getu64(const struct sp_hashmap *map, uint64_t key);
+void *sp_hashmap_geti8(const struct sp_hashmap *map, int8_t key);
+void *sp_hashmap_geti16(const struct sp_hashmap *map, int16_t key);
+void *sp_hashmap_geti32(const struct sp_hashmap *map, int32_t key);
+void *sp_hashmap_geti64(const struct sp_hashmap *map, int64_t key);
+#endif
+
+int sp_hashmap_remove(struct sp_hashmap *map, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_hashmap_removec(struct sp_hashmap *map, char key, int (*dtor)(void*));
+int sp_hashmap_removes(struct sp_hashmap *map, short key, int (*dtor)(void*));
+int sp_hashmap_removei(struct sp_hashmap *map, int key, int (*dtor)(void*));
+int sp_hashmap_removel(struct sp_hashmap *map, long key, int (*dtor)(void*));
+int sp_hashmap_removesc(struct sp_hashmap *map, signed char key, int (*dtor)(void*));
+int sp_hashmap_removeuc(struct sp_hashmap *map, unsigned char key, int (*dtor)(void*));
+int sp_hashmap_removeus(struct sp_hashmap *map, unsigned short key, int (*dtor)(void*));
+int sp_hashmap_removeui(struct sp_hashmap *map, unsigned int key, int (*dtor)(void*));
+int sp_hashmap_removeul(struct sp_hashmap *map, unsigned long key, int (*dtor)(void*));
+int sp_hashmap_removef(struct sp_hashmap *map, float key, int (*dtor)(void*));
+int sp_hashmap_removed(struct sp_hashmap *map, double key, int (*dtor)(void*));
+int sp_hashmap_removeld(struct sp_hashmap *map, long double key, int (*dtor)(void*));
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_hashmap_removeb(struct sp_hashmap *map, _Bool key, int (*dtor)(void*));
+int sp_hashmap_removell(struct sp_hashmap *map, long long key, int (*dtor)(void*));
+int sp_hashmap_removeull(struct sp_hashmap *map, unsigned long long key, int (*dtor)(void*));
+int sp_hashmap_removeu8(struct sp_hashmap *map, uint8_t key, int (*dtor)(void*));
+int sp_hashmap_removeu16(struct sp_hashmap *map, uint16_t key, int (*dtor)(void*));
+int sp_hashmap_removeu32(struct sp_hashmap *map, uint32_t key, int (*dtor)(void*));
+int sp_hashmap_removeu64(struct sp_hashmap *map, uint64_t key, int (*dtor)(void*));
+int sp_hashmap_removei8(struct sp_hashmap *map, int8_t key, int (*dtor)(void*));
+int sp_hashmap_removei16(struct sp_hashmap *map, int16_t key, int (*dtor)(void*));
+int sp_hashmap_removei32(struct sp_hashmap *map, int32_t key, int (*dtor)(void*));
+int sp_hashmap_removei64(struct sp_hashmap *map, int64_t key, int (*dtor)(void*));
+#endif
+
+int sp_hashmap_print(const struct sp_hashmap *map, int (*func)(const void*, const void*));
+
+#endif /* STAPLE_HASHMAP_H */
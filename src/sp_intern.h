@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_INTERN_H
+#define STAPLE_INTERN_H
+
+/* The intern module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_hashmap.h"
+
+struct sp_intern_str {
+	const char *str;
+	size_t      len;
+};
+
+struct sp_intern {
+	struct sp_hashmap    *index;
+	struct sp_intern_str *strs;
+	size_t size;
+	size_t capacity;
+	char **blocks;
+	size_t nblocks;
+	size_t block_size;
+	size_t block_left;
+};
+
+struct sp_intern *sp_intern_create(size_t capacity);
+int               sp_intern_clear(struct sp_intern *pool);
+int               sp_intern_destroy(struct sp_intern *pool);
+
+int sp_intern_add(struct sp_intern *pool, const char *str, size_t *id);
+int sp_intern_addn(struct sp_intern *pool, const char *str, size_t len, size_t *id);
+
+int sp_intern_find(const struct sp_intern *pool, const char *str, size_t *id);
+int sp_intern_findn(const struct sp_intern *pool, const char *str, size_t len, size_t *id);
+
+const char *sp_intern_get(const struct sp_intern *pool, size_t id);
+
+int sp_intern_print(const struct sp_intern *pool);
+
+#endif /* STAPLE_INTERN_H */
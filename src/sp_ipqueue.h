@@ -0,0 +1,239 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_IPQUEUE_H
+#define STAPLE_IPQUEUE_H
+
+/* The indexed priority queue module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pqueue.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_ipqueue {
+	void   *data;
+	size_t *heap;
+	size_t *pos;
+	size_t  elem_size;
+	size_t  size;
+	size_t  count;
+	size_t  capacity;
+	size_t  arity;
+	int     order;
+	int   (*cmp)(const void*, const void*);
+};
+
+struct sp_ipqueue *sp_ipqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*));
+int                sp_ipqueue_clear(struct sp_ipqueue *ipq, int (*dtor)(void*));
+int                sp_ipqueue_destroy(struct sp_ipqueue *ipq, int (*dtor)(void*));
+
+int sp_ipqueue_push(struct sp_ipqueue *ipq, const void *elem, size_t *handle);
+int sp_ipqueue_pushc(struct sp_ipqueue *ipq, char elem, size_t *handle);
+int sp_ipqueue_pushs(struct sp_ipqueue *ipq, short elem, size_t *handle);
+int sp_ipqueue_pushi(struct sp_ipqueue *ipq, int elem, size_t *handle);
+int sp_ipqueue_pushl(struct sp_ipqueue *ipq, long elem, size_t *handle);
+int sp_ipqueue_pushsc(struct sp_ipqueue *ipq, signed char elem, size_t *handle);
+int sp_ipqueue_pushuc(struct sp_ipqueue *ipq, unsigned char elem, size_t *handle);
+int sp_ipqueue_pushus(struct sp_ipqueue *ipq, unsigned short elem, size_t *handle);
+int sp_ipqueue_pushui(struct sp_ipqueue *ipq, unsigned int elem, size_t *handle);
+int sp_ipqueue_pushul(struct sp_ipqueue *ipq, unsigned long elem, size_t *handle);
+int sp_ipqueue_pushf(struct sp_ipqueue *ipq, float elem, size_t *handle);
+int sp_ipqueue_pushd(struct sp_ipqueue *ipq, double elem, size_t *handle);
+int sp_ipqueue_pushld(struct sp_ipqueue *ipq, long double elem, size_t *handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ipqueue_pushb(struct sp_ipqueue *ipq, _Bool elem, size_t *handle);
+int sp_ipqueue_pushll(struct sp_ipqueue *ipq, long long elem, size_t *handle);
+int sp_ipqueue_pushull(struct sp_ipqueue *ipq, unsigned long long elem, size_t *handle);
+int sp_ipqueue_pushu8(struct sp_ipqueue *ipq, uint8_t elem, size_t *handle);
+int sp_ipqueue_pushu16(struct sp_ipqueue *ipq, uint16_t elem, size_t *handle);
+int sp_ipqueue_pushu32(struct sp_ipqueue *ipq, uint32_t elem, size_t *handle);
+int sp_ipqueue_pushu64(struct sp_ipqueue *ipq, uint64_t elem, size_t *handle);
+int sp_ipqueue_pushi8(struct sp_ipqueue *ipq, int8_t elem, size_t *handle);
+int sp_ipqueue_pushi16(struct sp_ipqueue *ipq, int16_t elem, size_t *handle);
+int sp_ipqueue_pushi32(struct sp_ipqueue *ipq, int32_t elem, size_t *handle);
+int sp_ipqueue_pushi64(struct sp_ipqueue *ipq, int64_t elem, size_t *handle);
+#endif
+
+void   *sp_ipqueue_peek(const struct sp_ipqueue *ipq);
+char  sp_ipqueue_peekc(const struct sp_ipqueue *ipq);
+short  sp_ipqueue_peeks(const struct sp_ipqueue *ipq);
+int  sp_ipqueue_peeki(const struct sp_ipqueue *ipq);
+long  sp_ipqueue_peekl(const struct sp_ipqueue *ipq);
+signed char  sp_ipqueue_peeksc(const struct sp_ipqueue *ipq);
+unsigned char  sp_ipqueue_peekuc(const struct sp_ipqueue *ipq);
+unsigned short  sp_ipqueue_peekus(const struct sp_ipqueue *ipq);
+unsigned int  sp_ipqueue_peekui(const struct sp_ipqueue *ipq);
+unsigned long  sp_ipqueue_peekul(const struct sp_ipqueue *ipq);
+float  sp_ipqueue_peekf(const struct sp_ipqueue *ipq);
+double  sp_ipqueue_peekd(const struct sp_ipqueue *ipq);
+long double  sp_ipqueue_peekld(const struct sp_ipqueue *ipq);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_ipqueue_peekb(const struct sp_ipqueue *ipq);
+long long  sp_ipqueue_peekll(const struct sp_ipqueue *ipq);
+unsigned long long  sp_ipqueue_peekull(const struct sp_ipqueue *ipq);
+uint8_t  sp_ipqueue_peeku8(const struct sp_ipqueue *ipq);
+uint16_t  sp_ipqueue_peeku16(const struct sp_ipqueue *ipq);
+uint32_t  sp_ipqueue_peeku32(const struct sp_ipqueue *ipq);
+uint64_t  sp_ipqueue_peeku64(const struct sp_ipqueue *ipq);
+int8_t  sp_ipqueue_peeki8(const struct sp_ipqueue *ipq);
+int16_t  sp_ipqueue_peeki16(const struct sp_ipqueue *ipq);
+int32_t  sp_ipqueue_peeki32(const struct sp_ipqueue *ipq);
+int64_t  sp_ipqueue_peeki64(const struct sp_ipqueue *ipq);
+#endif
+size_t  sp_ipqueue_top(const struct sp_ipqueue *ipq);
+
+int     sp_ipqueue_pop(struct sp_ipqueue *ipq, int (*dtor)(void*));
+char  sp_ipqueue_popc(struct sp_ipqueue *ipq);
+short  sp_ipqueue_pops(struct sp_ipqueue *ipq);
+int  sp_ipqueue_popi(struct sp_ipqueue *ipq);
+long  sp_ipqueue_popl(struct sp_ipqueue *ipq);
+signed char  sp_ipqueue_popsc(struct sp_ipqueue *ipq);
+unsigned char  sp_ipqueue_popuc(struct sp_ipqueue *ipq);
+unsigned short  sp_ipqueue_popus(struct sp_ipqueue *ipq);
+unsigned int  sp_ipqueue_popui(struct sp_ipqueue *ipq);
+unsigned long  sp_ipqueue_popul(struct sp_ipqueue *ipq);
+float  sp_ipqueue_popf(struct sp_ipqueue *ipq);
+double  sp_ipqueue_popd(struct sp_ipqueue *ipq);
+long double  sp_ipqueue_popld(struct sp_ipqueue *ipq);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_ipqueue_popb(struct sp_ipqueue *ipq);
+long long  sp_ipqueue_popll(struct sp_ipqueue *ipq);
+unsigned long long  sp_ipqueue_popull(struct sp_ipqueue *ipq);
+uint8_t  sp_ipqueue_popu8(struct sp_ipqueue *ipq);
+uint16_t  sp_ipqueue_popu16(struct sp_ipqueue *ipq);
+uint32_t  sp_ipqueue_popu32(struct sp_ipqueue *ipq);
+uint64_t  sp_ipqueue_popu64(struct sp_ipqueue *ipq);
+int8_t  sp_ipqueue_popi8(struct sp_ipqueue *ipq);
+int16_t  sp_ipqueue_popi16(struct sp_ipqueue *ipq);
+int32_t  sp_ipqueue_popi32(struct sp_ipqueue *ipq);
+int64_t  sp_ipqueue_popi64(struct sp_ipqueue *ipq);
+#endif
+
+int     sp_ipqueue_contains(const struct sp_ipqueue *ipq, size_t handle);
+void   *sp_ipqueue_get(const struct sp_ipqueue *ipq, size_t handle);
+char  sp_ipqueue_getc(const struct sp_ipqueue *ipq, size_t handle);
+short  sp_ipqueue_gets(const struct sp_ipqueue *ipq, size_t handle);
+int  sp_ipqueue_geti(const struct sp_ipqueue *ipq, size_t handle);
+long  sp_ipqueue_getl(const struct sp_ipqueue *ipq, size_t handle);
+signed char  sp_ipqueue_getsc(const struct sp_ipqueue *ipq, size_t handle);
+unsigned char  sp_ipqueue_getuc(const struct sp_ipqueue *ipq, size_t handle);
+unsigned short  sp_ipqueue_getus(const struct sp_ipqueue *ipq, size_t handle);
+unsigned int  sp_ipqueue_getui(const struct sp_ipqueue *ipq, size_t handle);
+unsigned long  sp_ipqueue_getul(const struct sp_ipqueue *ipq, size_t handle);
+float  sp_ipqueue_getf(const struct sp_ipqueue *ipq, size_t handle);
+double  sp_ipqueue_getd(const struct sp_ipqueue *ipq, size_t handle);
+long double  sp_ipqueue_getld(const struct sp_ipqueue *ipq, size_t handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_ipqueue_getb(const struct sp_ipqueue *ipq, size_t handle);
+long long  sp_ipqueue_getll(const struct sp_ipqueue *ipq, size_t handle);
+unsigned long long  sp_ipqueue_getull(const struct sp_ipqueue *ipq, size_t handle);
+uint8_t  sp_ipqueue_getu8(const struct sp_ipqueue *ipq, size_t handle);
+uint16_t  sp_ipqueue_getu16(const struct sp_ipqueue *ipq, size_t handle);
+uint32_t  sp_ipqueue_getu32(const struct sp_ipqueue *ipq, size_t handle);
+uint64_t  sp_ipqueue_getu64(const struct sp_ipqueue *ipq, size_t handle);
+int8_t  sp_ipqueue_geti8(const struct sp_ipqueue *ipq, size_t handle);
+int16_t  sp_ipqueue_geti16(const struct sp_ipqueue *ipq, size_t handle);
+int32_t  sp_ipqueue_geti32(const struct sp_ipqueue *ipq, size_t handle);
+int64_t  sp_ipqueue_geti64(const struct sp_ipqueue *ipq, size_t handle);
+#endif
+
+int sp_ipqueue_update(struct sp_ipqueue *ipq, size_t handle, const void *elem);
+int sp_ipqueue_updatec(struct sp_ipqueue *ipq, size_t handle, char elem);
+int sp_ipqueue_updates(struct sp_ipqueue *ipq, size_t handle, short elem);
+int sp_ipqueue_updatei(struct sp_ipqueue *ipq, size_t handle, int elem);
+int sp_ipqueue_updatel(struct sp_ipqueue *ipq, size_t handle, long elem);
+int sp_ipqueue_updatesc(struct sp_ipqueue *ipq, size_t handle, signed char elem);
+int sp_ipqueue_updateuc(struct sp_ipqueue *ipq, size_t handle, unsigned char elem);
+int sp_ipqueue_updateus(struct sp_ipqueue *ipq, size_t handle, unsigned short elem);
+int sp_ipqueue_updateui(struct sp_ipqueue *ipq, size_t handle, unsigned int elem);
+int sp_ipqueue_updateul(struct sp_ipqueue *ipq, size_t handle, unsigned long elem);
+int sp_ipqueue_updatef(struct sp_ipqueue *ipq, size_t handle, float elem);
+int sp_ipqueue_updated(struct sp_ipqueue *ipq, size_t handle, double elem);
+int sp_ipqueue_updateld(struct sp_ipqueue *ipq, size_t handle, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ipqueue_updateb(struct sp_ipqueue *ipq, size_t handle, _Bool elem);
+int sp_ipqueue_updatell(struct sp_ipqueue *ipq, size_t handle, long long elem);
+int sp_ipqueue_updateull(struct sp_ipqueue *ipq, size_t handle, unsigned long long elem);
+int sp_ipqueue_updateu8(struct sp_ipqueue *ipq, size_t handle, uint8_t elem);
+int sp_ipqueue_updateu16(struct sp_ipqueue *ipq, size_t handle, uint16_t elem);
+int sp_ipqueue_updateu32(struct sp_ipqueue *ipq, size_t handle, uint32_t elem);
+int sp_ipqueue_updateu64(struct sp_ipqueue *ipq, size_t handle, uint64_t elem);
+int sp_ipqueue_updatei8(struct sp_ipqueue *ipq, size_t handle, int8_t elem);
+int sp_ipqueue_updatei16(struct sp_ipqueue *ipq, size_t handle, int16_t elem);
+int sp_ipqueue_updatei32(struct sp_ipqueue *ipq, size_t handle, int32_t elem);
+int sp_ipqueue_updatei64(struct sp_ipqueue *ipq, size_t handle, int64_t elem);
+#endif
+
+int     sp_ipqueue_remove(struct sp_ipqueue *ipq, size_t handle, int (*dtor)(void*));
+char  sp_ipqueue_removec(struct sp_ipqueue *ipq, size_t handle);
+short  sp_ipqueue_removes(struct sp_ipqueue *ipq, size_t handle);
+int  sp_ipqueue_removei(struct sp_ipqueue *ipq, size_t handle);
+long  sp_ipqueue_removel(struct sp_ipqueue *ipq, size_t handle);
+signed char  sp_ipqueue_removesc(struct sp_ipqueue *ipq, size_t handle);
+unsigned char  sp_ipqueue_removeuc(struct sp_ipqueue *ipq, size_t handle);
+unsigned short  sp_ipqueue_removeus(struct sp_ipqueue *ipq, size_t handle);
+unsigned int  sp_ipqueue_removeui(struct sp_ipqueue *ipq, size_t handle);
+unsigned long  sp_ipqueue_removeul(struct sp_ipqueue *ipq, size_t handle);
+float  sp_ipqueue_removef(struct sp_ipqueue *ipq, size_t handle);
+double  sp_ipqueue_removed(struct sp_ipqueue *ipq, size_t handle);
+long double  sp_ipqueue_removeld(struct sp_ipqueue *ipq, size_t handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_ipqueue_removeb(struct sp_ipqueue *ipq, size_t handle);
+long long  sp_ipqueue_removell(struct sp_ipqueue *ipq, size_t handle);
+unsigned long long  sp_ipqueue_removeull(struct sp_ipqueue *ipq, size_t handle);
+uint8_t  sp_ipqueue_removeu8(struct sp_ipqueue *ipq, size_t handle);
+uint16_t  sp_ipqueue_removeu16(struct sp_ipqueue *ipq, size_t handle);
+uint32_t  sp_ipqueue_removeu32(struct sp_ipqueue *ipq, size_t handle);
+uint64_t  sp_ipqueue_removeu64(struct sp_ipqueue *ipq, size_t handle);
+int8_t  sp_ipqueue_removei8(struct sp_ipqueue *ipq, size_t handle);
+int16_t  sp_ipqueue_removei16(struct sp_ipqueue *ipq, size_t handle);
+int32_t  sp_ipqueue_removei32(struct sp_ipqueue *ipq, size_t handle);
+int64_t  sp_ipqueue_removei64(struct sp_ipqueue *ipq, size_t handle);
+#endif
+
+int sp_ipqueue_print(const struct sp_ipqueue *ipq, int (*func)(const void*));
+int sp_ipqueue_printc(const struct sp_ipqueue *ipq);
+int sp_ipqueue_prints(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printi(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printl(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printsc(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printuc(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printus(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printui(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printul(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printf(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printd(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printld(const struct sp_ipqueue *ipq);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ipqueue_printb(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printll(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printull(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printu8(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printu16(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printu32(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printu64(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printi8(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printi16(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printi32(const struct sp_ipqueue *ipq);
+int sp_ipqueue_printi64(const struct sp_ipqueue *ipq);
+#endif
+
+#endif /* STAPLE_IPQUEUE_H */
@@ -0,0 +1,145 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_LIST_H
+#define STAPLE_LIST_H
+
+/* The list module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pool.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_list_node {
+	struct sp_list_node *prev;
+	struct sp_list_node *next;
+};
+
+struct sp_list {
+	struct sp_list_node *head;
+	struct sp_list_node *tail;
+	size_t elem_size;
+	size_t size;
+	size_t data_offset;
+	struct sp_pool pool;
+};
+
+struct sp_list *sp_list_create(size_t elem_size, size_t capacity);
+int             sp_list_clear(struct sp_list *list, int (*dtor)(void*));
+int             sp_list_destroy(struct sp_list *list, int (*dtor)(void*));
+int             sp_list_eq(const struct sp_list *list1, const struct sp_list *list2, int (*cmp)(const void*, const void*));
+int             sp_list_copy(struct sp_list *dest, const struct sp_list *src, int (*cpy)(void*, const void*));
+int             sp_list_map(struct sp_list *list, int (*func)(void*, size_t));
+
+int sp_list_pushfront(struct sp_list *list, const void *elem);
+int sp_list_pushfrontc(struct sp_list *list, char elem);
+int sp_list_pushfronts(struct sp_list *list, short elem);
+int sp_list_pushfronti(struct sp_list *list, int elem);
+int sp_list_pushfrontl(struct sp_list *list, long elem);
+int sp_list_pushfrontsc(struct sp_list *list, signed char elem);
+int sp_list_pushfrontuc(struct sp_list *list, unsigned char elem);
+int sp_list_pushfrontus(struct sp_list *list, unsigned short elem);
+int sp_list_pushfrontui(struct sp_list *list, unsigned int elem);
+int sp_list_pushfrontul(struct sp_list *list, unsigned long elem);
+int sp_list_pushfrontf(struct sp_list *list, float elem);
+int sp_list_pushfrontd(struct sp_list *list, double elem);
+int sp_list_pushfrontld(struct sp_list *list, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_list_pushfrontb(struct sp_list *list, _Bool elem);
+int sp_list_pushfrontll(struct sp_list *list, long long elem);
+int sp_list_pushfrontull(struct sp_list *list, unsigned long long elem);
+int sp_list_pushfrontu8(struct sp_list *list, uint8_t elem);
+int sp_list_pushfrontu16(struct sp_list *list, uint16_t elem);
+int sp_list_pushfrontu32(struct sp_list *list, uint32_t elem);
+int sp_list_pushfrontu64(struct sp_list *list, uint64_t elem);
+int sp_list_pushfronti8(struct sp_list *list, int8_t elem);
+int sp_list_pushfronti16(struct sp_list *list, int16_t elem);
+int sp_list_pushfronti32(struct sp_list *list, int32_t elem);
+int sp_list_pushfronti64(struct sp_list *list, int64_t elem);
+#endif
+
+int sp_list_pushback(struct sp_list *list, const void *elem);
+int sp_list_pushbackc(struct sp_list *list, char elem);
+int sp_list_pushbacks(struct sp_list *list, short elem);
+int sp_list_pushbacki(struct sp_list *list, int elem);
+int sp_list_pushbackl(struct sp_list *list, long elem);
+int sp_list_pushbacksc(struct sp_list *list, signed char elem);
+int sp_list_pushbackuc(struct sp_list *list, unsigned char elem);
+int sp_list_pushbackus(struct sp_list *list, unsigned short elem);
+int sp_list_pushbackui(struct sp_list *list, unsigned int elem);
+int sp_list_pushbackul(struct sp_list *list, unsigned long elem);
+int sp_list_pushbackf(struct sp_list *list, float elem);
+int sp_list_pushbackd(struct sp_list *list, double elem);
+int sp_list_pushbackld(struct sp_list *list, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_list_pushbackb(struct sp_list *list, _Bool elem);
+int sp_list_pushbackll(struct sp_list *list, long long elem);
+int sp_list_pushbackull(struct sp_list *list, unsigned long long elem);
+int sp_list_pushbacku8(struct sp_list *list, uint8_t elem);
+int sp_list_pushbacku16(struct sp_list *list, uint16_t elem);
+int sp_list_pushbacku32(struct sp_list *list, uint32_t elem);
+int sp_list_pushbacku64(struct sp_list *list, uint64_t elem);
+int sp_list_pushbacki8(struct sp_list *list, int8_t elem);
+int sp_list_pushbacki16(struct sp_list *list, int16_t elem);
+int sp_list_pushbacki32(struct sp_list *list, int32_t elem);
+int sp_list_pushbacki64(struct sp_list *list, int64_t elem);
+#endif
+
+int sp_list_insertafter(struct sp_list *list, struct sp_list_node *node, const void *elem);
+int sp_list_insertbefore(struct sp_list *list, struct sp_list_node *node, const void *elem);
+
+int sp_list_popfront(struct sp_list *list, int (*dtor)(void*));
+int sp_list_popback(struct sp_list *list, int (*dtor)(void*));
+int sp_list_remove(struct sp_list *list, struct sp_list_node *node, int (*dtor)(void*));
+
+void *sp_list_elem(const struct sp_list *list, const struct sp_list_node *node);
+
+int sp_list_splice(struct sp_list *dest, struct sp_list_node *pos, struct sp_list *src);
+int sp_list_move(struct sp_list *list, struct sp_list_node *pos, struct sp_list_node *first, struct sp_list_node *last);
+
+int sp_list_print(const struct sp_list *list, int (*func)(const void*));
+int sp_list_printc(const struct sp_list *list);
+int sp_list_prints(const struct sp_list *list);
+int sp_list_printi(const struct sp_list *list);
+int sp_list_printl(const struct sp_list *list);
+int sp_list_printsc(const struct sp_list *list);
+int sp_list_printuc(const struct sp_list *list);
+int sp_list_printus(const struct sp_list *list);
+int sp_list_printui(const struct sp_list *list);
+int sp_list_printul(const struct sp_list *list);
+int sp_list_printf(const struct sp_list *list);
+int sp_list_printd(const struct sp_list *list);
+int sp_list_printld(const struct sp_list *list);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_list_printb(const struct sp_list *list);
+int sp_list_printll(const struct sp_list *list);
+int sp_list_printull(const struct sp_list *list);
+int sp_list_printu8(const struct sp_list *list);
+int sp_list_printu16(const struct sp_list *list);
+int sp_list_printu32(const struct sp_list *list);
+int sp_list_printu64(const struct sp_list *list);
+int sp_list_printi8(const struct sp_list *list);
+int sp_list_printi16(const struct sp_list *list);
+int sp_list_printi32(const struct sp_list *list);
+int sp_list_printi64(const struct sp_list *list);
+#endif
+
+#endif /* STAPLE_LIST_H */
@@ -0,0 +1,171 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_LRU_H
+#define STAPLE_LRU_H
+
+/* The LRU cache module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_hashmap.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_lru_entry {
+	size_t prev;
+	size_t next;
+	size_t weight;
+};
+
+struct sp_lru {
+	struct sp_hashmap   *index;
+	struct sp_lru_entry *entries;
+	void         *keys;
+	void         *vals;
+	size_t        key_size;
+	size_t        val_size;
+	size_t        size;
+	size_t        capacity;
+	size_t        weight;
+	size_t        max_weight;
+	size_t        head;
+	size_t        tail;
+	size_t        free;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+	int (*evict)(void*, void*);
+};
+
+struct sp_lru *sp_lru_create(size_t key_size, size_t val_size, size_t capacity, size_t max_weight, size_t (*hash)(const void*), int (*cmp)(const void*, const void*), int (*evict)(void*, void*));
+int            sp_lru_clear(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*));
+int            sp_lru_destroy(struct sp_lru *lru, int (*kdtor)(void*), int (*vdtor)(void*));
+
+int sp_lru_insert(struct sp_lru *lru, const void *key, const void *val, size_t weight);
+int sp_lru_insertc(struct sp_lru *lru, char key, const void *val, size_t weight);
+int sp_lru_inserts(struct sp_lru *lru, short key, const void *val, size_t weight);
+int sp_lru_inserti(struct sp_lru *lru, int key, const void *val, size_t weight);
+int sp_lru_insertl(struct sp_lru *lru, long key, const void *val, size_t weight);
+int sp_lru_insertsc(struct sp_lru *lru, signed char key, const void *val, size_t weight);
+int sp_lru_insertuc(struct sp_lru *lru, unsigned char key, const void *val, size_t weight);
+int sp_lru_insertus(struct sp_lru *lru, unsigned short key, const void *val, size_t weight);
+int sp_lru_insertui(struct sp_lru *lru, unsigned int key, const void *val, size_t weight);
+int sp_lru_insertul(struct sp_lru *lru, unsigned long key, const void *val, size_t weight);
+int sp_lru_insertf(struct sp_lru *lru, float key, const void *val, size_t weight);
+int sp_lru_insertd(struct sp_lru *lru, double key, const void *val, size_t weight);
+int sp_lru_insertld(struct sp_lru *lru, long double key, const void *val, size_t weight);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_lru_insertb(struct sp_lru *lru, _Bool key, const void *val, size_t weight);
+int sp_lru_insertll(struct sp_lru *lru, long long key, const void *val, size_t weight);
+int sp_lru_insertull(struct sp_lru *lru, unsigned long long key, const void *val, size_t weight);
+int sp_lru_insertu8(struct sp_lru *lru, uint8_t key, const void *val, size_t weight);
+int sp_lru_insertu16(struct sp_lru *lru, uint16_t key, const void *val, size_t weight);
+int sp_lru_insertu32(struct sp_lru *lru, uint32_t key, const void *val, size_t weight);
+int sp_lru_insertu64(struct sp_lru *lru, uint64_t key, const void *val, size_t weight);
+int sp_lru_inserti8(struct sp_lru *lru, int8_t key, const void *val, size_t weight);
+int sp_lru_inserti16(struct sp_lru *lru, int16_t key, const void *val, size_t weight);
+int sp_lru_inserti32(struct sp_lru *lru, int32_t key, const void *val, size_t weight);
+int sp_lru_inserti64(struct sp_lru *lru, int64_t key, const void *val, size_t weight);
+#endif
+
+void *sp_lru_get(struct sp_lru *lru, const void *key);
+void *sp_lru_getc(struct sp_lru *lru, char key);
+void *sp_lru_gets(struct sp_lru *lru, short key);
+void *sp_lru_geti(struct sp_lru *lru, int key);
+void *sp_lru_getl(struct sp_lru *lru, long key);
+void *sp_lru_getsc(struct sp_lru *lru, signed char key);
+void *sp_lru_getuc(struct sp_lru *lru, unsigned char key);
+void *sp_lru_getus(struct sp_lru *lru, unsigned short key);
+void *sp_lru_getui(struct sp_lru *lru, unsigned int key);
+void *sp_lru_getul(struct sp_lru *lru, unsigned long key);
+void *sp_lru_getf(struct sp_lru *lru, float key);
+void *sp_lru_getd(struct sp_lru *lru, double key);
+void *sp_lru_getld(struct sp_lru *lru, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+void *sp_lru_getb(struct sp_lru *lru, _Bool key);
+void *sp_lru_getll(struct sp_lru *lru, long long key);
+void *sp_lru_getull(struct sp_lru *lru, unsigned long long key);
+void *sp_lru_getu8(struct sp_lru *lru, uint8_t key);
+void *sp_lru_getu16(struct sp_lru *lru, uint16_t key);
+void *sp_lru_getu32(struct sp_lru *lru, uint32_t key);
+void *sp_lru_getu64(struct sp_lru *lru, uint64_t key);
+void *sp_lru_geti8(struct sp_lru *lru, int8_t key);
+void *sp_lru_geti16(struct sp_lru *lru, int16_t key);
+void *sp_lru_geti32(struct sp_lru *lru, int32_t key);
+void *sp_lru_geti64(struct sp_lru *lru, int64_t key);
+#endif
+
+void *sp_lru_peek(const struct sp_lru *lru, const void *key);
+void *sp_lru_peekc(const struct sp_lru *lru, char key);
+void *sp_lru_peeks(const struct sp_lru *lru, short key);
+void *sp_lru_peeki(const struct sp_lru *lru, int key);
+void *sp_lru_peekl(const struct sp_lru *lru, long key);
+void *sp_lru_peeksc(const struct sp_lru *lru, signed char key);
+void *sp_lru_peekuc(const struct sp_lru *lru, unsigned char key);
+void *sp_lru_peekus(const struct sp_lru *lru, unsigned short key);
+void *sp_lru_peekui(const struct sp_lru *lru, unsigned int key);
+void *sp_lru_peekul(const struct sp_lru *lru, unsigned long key);
+void *sp_lru_peekf(const struct sp_lru *lru, float key);
+void *sp_lru_peekd(const struct sp_lru *lru, double key);
+void *sp_lru_peekld(const struct sp_lru *lru, long double key);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+void *sp_lru_peekb(const struct sp_lru *lru, _Bool key);
+void *sp_lru_peekll(const struct sp_lru *lru, long long key);
+void *sp_lru_peekull(const struct sp_lru *lru, unsigned long long key);
+void *sp_lru_peeku8(const struct sp_lru *lru, uint8_t key);
+void *sp_lru_peeku16(const struct sp_lru *lru, uint16_t key);
+void *sp_lru_peeku32(const struct sp_lru *lru, uint32_t key);
+void *sp_lru_peeku64(const struct sp_lru *lru, uint64_t key);
+void *sp_lru_peeki8(const struct sp_lru *lru, int8_t key);
+void *sp_lru_peeki16(const struct sp_lru *lru, int16_t key);
+void *sp_lru_peeki32(const struct sp_lru *lru, int32_t key);
+void *sp_lru_peeki64(const struct sp_lru *lru, int64_t key);
+#endif
+
+int sp_lru_remove(struct sp_lru *lru, const void *key, int (*kdtor)(void*), int (*vdtor)(void*));
+int sp_lru_removec(struct sp_lru *lru, char key, int (*dtor)(void*));
+int sp_lru_removes(struct sp_lru *lru, short key, int (*dtor)(void*));
+int sp_lru_removei(struct sp_lru *lru, int key, int (*dtor)(void*));
+int sp_lru_removel(struct sp_lru *lru, long key, int (*dtor)(void*));
+int sp_lru_removesc(struct sp_lru *lru, signed char key, int (*dtor)(void*));
+int sp_lru_removeuc(struct sp_lru *lru, unsigned char key, int (*dtor)(void*));
+int sp_lru_removeus(struct sp_lru *lru, unsigned short key, int (*dtor)(void*));
+int sp_lru_removeui(struct sp_lru *lru, unsigned int key, int (*dtor)(void*));
+int sp_lru_removeul(struct sp_lru *lru, unsigned long key, int (*dtor)(void*));
+int sp_lru_removef(struct sp_lru *lru, float key, int (*dtor)(void*));
+int sp_lru_removed(struct sp_lru *lru, double key, int (*dtor)(void*));
+int sp_lru_removeld(struct sp_lru *lru, long double key, int (*dtor)(void*));
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_lru_removeb(struct sp_lru *lru, _Bool key, int (*dtor)(void*));
+int sp_lru_removell(struct sp_lru *lru, long long key, int (*dtor)(void*));
+int sp_lru_removeull(struct sp_lru *lru, unsigned long long key, int (*dtor)(void*));
+int sp_lru_removeu8(struct sp_lru *lru, uint8_t key, int (*dtor)(void*));
+int sp_lru_removeu16(struct sp_lru *lru, uint16_t key, int (*dtor)(void*));
+int sp_lru_removeu32(struct sp_lru *lru, uint32_t key, int (*dtor)(void*));
+int sp_lru_removeu64(struct sp_lru *lru, uint64_t key, int (*dtor)(void*));
+int sp_lru_removei8(struct sp_lru *lru, int8_t key, int (*dtor)(void*));
+int sp_lru_removei16(struct sp_lru *lru, int16_t key, int (*dtor)(void*));
+int sp_lru_removei32(struct sp_lru *lru, int32_t key, int (*dtor)(void*));
+int sp_lru_removei64(struct sp_lru *lru, int64_t key, int (*dtor)(void*));
+#endif
+
+int sp_lru_print(const struct sp_lru *lru, int (*func)(const void*, const void*));
+
+#endif /* STAPLE_LRU_H */
@@ -0,0 +1,343 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_MATRIX_H
+#define STAPLE_MATRIX_H
+
+/* The matrix module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_matrix {
+	void  *data;
+	size_t elem_size;
+	size_t depth;
+	size_t rows;
+	size_t cols;
+	size_t size;
+	size_t align;
+	size_t pstride;
+	size_t rstride;
+	size_t cstride;
+};
+
+struct sp_matrix *sp_matrix_create(size_t elem_size, size_t depth, size_t rows, size_t cols, size_t align);
+int               sp_matrix_destroy(struct sp_matrix *matrix, int (*dtor)(void*));
+int               sp_matrix_eq(const struct sp_matrix *matrix1, const struct sp_matrix *matrix2, int (*cmp)(const void*, const void*));
+int               sp_matrix_copy(struct sp_matrix *dest, const struct sp_matrix *src, int (*cpy)(void*, const void*));
+int               sp_matrix_map(struct sp_matrix *matrix, int (*func)(void*, size_t));
+
+int sp_matrix_slice(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row, size_t col, size_t depth, size_t rows, size_t cols);
+int sp_matrix_row(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t row);
+int sp_matrix_col(struct sp_matrix *view, const struct sp_matrix *src, size_t plane, size_t col);
+int sp_matrix_transposed(struct sp_matrix *view, const struct sp_matrix *src);
+int sp_matrix_reshape(struct sp_matrix *view, const struct sp_matrix *src, size_t depth, size_t rows, size_t cols);
+
+void  *sp_matrix_get(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+char sp_matrix_getc(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+short sp_matrix_gets(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+int sp_matrix_geti(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+long sp_matrix_getl(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+signed char sp_matrix_getsc(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+unsigned char sp_matrix_getuc(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+unsigned short sp_matrix_getus(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+unsigned int sp_matrix_getui(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+unsigned long sp_matrix_getul(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+float sp_matrix_getf(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+double sp_matrix_getd(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+long double sp_matrix_getld(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool sp_matrix_getb(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+long long sp_matrix_getll(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+unsigned long long sp_matrix_getull(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+uint8_t sp_matrix_getu8(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+uint16_t sp_matrix_getu16(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+uint32_t sp_matrix_getu32(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+uint64_t sp_matrix_getu64(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+int8_t sp_matrix_geti8(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+int16_t sp_matrix_geti16(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+int32_t sp_matrix_geti32(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+int64_t sp_matrix_geti64(const struct sp_matrix *matrix, size_t plane, size_t row, size_t col);
+#endif
+
+int sp_matrix_set(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, const void *val);
+int sp_matrix_setc(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, char val);
+int sp_matrix_sets(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, short val);
+int sp_matrix_seti(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, int val);
+int sp_matrix_setl(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, long val);
+int sp_matrix_setsc(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, signed char val);
+int sp_matrix_setuc(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, unsigned char val);
+int sp_matrix_setus(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, unsigned short val);
+int sp_matrix_setui(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, unsigned int val);
+int sp_matrix_setul(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, unsigned long val);
+int sp_matrix_setf(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, float val);
+int sp_matrix_setd(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, double val);
+int sp_matrix_setld(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_setb(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, _Bool val);
+int sp_matrix_setll(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, long long val);
+int sp_matrix_setull(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, unsigned long long val);
+int sp_matrix_setu8(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, uint8_t val);
+int sp_matrix_setu16(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, uint16_t val);
+int sp_matrix_setu32(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, uint32_t val);
+int sp_matrix_setu64(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, uint64_t val);
+int sp_matrix_seti8(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, int8_t val);
+int sp_matrix_seti16(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, int16_t val);
+int sp_matrix_seti32(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, int32_t val);
+int sp_matrix_seti64(struct sp_matrix *matrix, size_t plane, size_t row, size_t col, int64_t val);
+#endif
+
+int sp_matrix_fill(struct sp_matrix *matrix, const void *val);
+int sp_matrix_fillc(struct sp_matrix *matrix, char val);
+int sp_matrix_fills(struct sp_matrix *matrix, short val);
+int sp_matrix_filli(struct sp_matrix *matrix, int val);
+int sp_matrix_filll(struct sp_matrix *matrix, long val);
+int sp_matrix_fillsc(struct sp_matrix *matrix, signed char val);
+int sp_matrix_filluc(struct sp_matrix *matrix, unsigned char val);
+int sp_matrix_fillus(struct sp_matrix *matrix, unsigned short val);
+int sp_matrix_fillui(struct sp_matrix *matrix, unsigned int val);
+int sp_matrix_fillul(struct sp_matrix *matrix, unsigned long val);
+int sp_matrix_fillf(struct sp_matrix *matrix, float val);
+int sp_matrix_filld(struct sp_matrix *matrix, double val);
+int sp_matrix_fillld(struct sp_matrix *matrix, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_fillb(struct sp_matrix *matrix, _Bool val);
+int sp_matrix_fillll(struct sp_matrix *matrix, long long val);
+int sp_matrix_fillull(struct sp_matrix *matrix, unsigned long long val);
+int sp_matrix_fillu8(struct sp_matrix *matrix, uint8_t val);
+int sp_matrix_fillu16(struct sp_matrix *matrix, uint16_t val);
+int sp_matrix_fillu32(struct sp_matrix *matrix, uint32_t val);
+int sp_matrix_fillu64(struct sp_matrix *matrix, uint64_t val);
+int sp_matrix_filli8(struct sp_matrix *matrix, int8_t val);
+int sp_matrix_filli16(struct sp_matrix *matrix, int16_t val);
+int sp_matrix_filli32(struct sp_matrix *matrix, int32_t val);
+int sp_matrix_filli64(struct sp_matrix *matrix, int64_t val);
+#endif
+
+int sp_matrix_transpose(struct sp_matrix *dest, const struct sp_matrix *src);
+
+int sp_matrix_mulc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muls(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muli(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mull(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulsc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muluc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulus(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mului(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulul(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulf(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_mulb(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulll(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulull(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulu8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulu16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulu32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_mulu64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muli8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muli16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muli32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_muli64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#endif
+
+int sp_matrix_addc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_adds(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addi(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addl(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addsc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_adduc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addus(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addui(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addul(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addf(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addd(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_addb(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addll(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addull(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addu8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addu16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addu32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addu64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addi8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addi16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addi32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_addi64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#endif
+int sp_matrix_subc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subs(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subi(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subl(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subsc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subuc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subus(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subui(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subul(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subf(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subd(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_subb(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subll(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subull(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subu8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subu16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subu32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subu64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subi8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subi16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subi32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_subi64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#endif
+int sp_matrix_emulc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuls(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuli(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emull(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulsc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuluc(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulus(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emului(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulul(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulf(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulld(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_emulb(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulll(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulull(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulu8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulu16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulu32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emulu64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuli8(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuli16(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuli32(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+int sp_matrix_emuli64(struct sp_matrix *dest, const struct sp_matrix *a, const struct sp_matrix *b);
+#endif
+int sp_matrix_scalec(struct sp_matrix *dest, const struct sp_matrix *src, char factor);
+int sp_matrix_scales(struct sp_matrix *dest, const struct sp_matrix *src, short factor);
+int sp_matrix_scalei(struct sp_matrix *dest, const struct sp_matrix *src, int factor);
+int sp_matrix_scalel(struct sp_matrix *dest, const struct sp_matrix *src, long factor);
+int sp_matrix_scalesc(struct sp_matrix *dest, const struct sp_matrix *src, signed char factor);
+int sp_matrix_scaleuc(struct sp_matrix *dest, const struct sp_matrix *src, unsigned char factor);
+int sp_matrix_scaleus(struct sp_matrix *dest, const struct sp_matrix *src, unsigned short factor);
+int sp_matrix_scaleui(struct sp_matrix *dest, const struct sp_matrix *src, unsigned int factor);
+int sp_matrix_scaleul(struct sp_matrix *dest, const struct sp_matrix *src, unsigned long factor);
+int sp_matrix_scalef(struct sp_matrix *dest, const struct sp_matrix *src, float factor);
+int sp_matrix_scaled(struct sp_matrix *dest, const struct sp_matrix *src, double factor);
+int sp_matrix_scaleld(struct sp_matrix *dest, const struct sp_matrix *src, long double factor);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_scaleb(struct sp_matrix *dest, const struct sp_matrix *src, _Bool factor);
+int sp_matrix_scalell(struct sp_matrix *dest, const struct sp_matrix *src, long long factor);
+int sp_matrix_scaleull(struct sp_matrix *dest, const struct sp_matrix *src, unsigned long long factor);
+int sp_matrix_scaleu8(struct sp_matrix *dest, const struct sp_matrix *src, uint8_t factor);
+int sp_matrix_scaleu16(struct sp_matrix *dest, const struct sp_matrix *src, uint16_t factor);
+int sp_matrix_scaleu32(struct sp_matrix *dest, const struct sp_matrix *src, uint32_t factor);
+int sp_matrix_scaleu64(struct sp_matrix *dest, const struct sp_matrix *src, uint64_t factor);
+int sp_matrix_scalei8(struct sp_matrix *dest, const struct sp_matrix *src, int8_t factor);
+int sp_matrix_scalei16(struct sp_matrix *dest, const struct sp_matrix *src, int16_t factor);
+int sp_matrix_scalei32(struct sp_matrix *dest, const struct sp_matrix *src, int32_t factor);
+int sp_matrix_scalei64(struct sp_matrix *dest, const struct sp_matrix *src, int64_t factor);
+#endif
+
+int sp_matrix_rowsumc(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsums(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumi(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsuml(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumsc(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumuc(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumus(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumui(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumul(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumf(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumd(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumld(struct sp_matrix *dest, const struct sp_matrix *src);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_rowsumb(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumll(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumull(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumu8(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumu16(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumu32(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumu64(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumi8(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumi16(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumi32(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_rowsumi64(struct sp_matrix *dest, const struct sp_matrix *src);
+#endif
+int sp_matrix_colsumc(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsums(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumi(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsuml(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumsc(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumuc(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumus(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumui(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumul(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumf(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumd(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumld(struct sp_matrix *dest, const struct sp_matrix *src);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_colsumb(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumll(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumull(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumu8(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumu16(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumu32(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumu64(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumi8(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumi16(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumi32(struct sp_matrix *dest, const struct sp_matrix *src);
+int sp_matrix_colsumi64(struct sp_matrix *dest, const struct sp_matrix *src);
+#endif
+
+int sp_matrix_print(const struct sp_matrix *matrix, int (*func)(const void*));
+int sp_matrix_printc(const struct sp_matrix *matrix);
+int sp_matrix_prints(const struct sp_matrix *matrix);
+int sp_matrix_printi(const struct sp_matrix *matrix);
+int sp_matrix_printl(const struct sp_matrix *matrix);
+int sp_matrix_printsc(const struct sp_matrix *matrix);
+int sp_matrix_printuc(const struct sp_matrix *matrix);
+int sp_matrix_printus(const struct sp_matrix *matrix);
+int sp_matrix_printui(const struct sp_matrix *matrix);
+int sp_matrix_printul(const struct sp_matrix *matrix);
+int sp_matrix_printf(const struct sp_matrix *matrix);
+int sp_matrix_printd(const struct sp_matrix *matrix);
+int sp_matrix_printld(const struct sp_matrix *matrix);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_matrix_printb(const struct sp_matrix *matrix);
+int sp_matrix_printll(const struct sp_matrix *matrix);
+int sp_matrix_printull(const struct sp_matrix *matrix);
+int sp_matrix_printu8(const struct sp_matrix *matrix);
+int sp_matrix_printu16(const struct sp_matrix *matrix);
+int sp_matrix_printu32(const struct sp_matrix *matrix);
+int sp_matrix_printu64(const struct sp_matrix *matrix);
+int sp_matrix_printi8(const struct sp_matrix *matrix);
+int sp_matrix_printi16(const struct sp_matrix *matrix);
+int sp_matrix_printi32(const struct sp_matrix *matrix);
+int sp_matrix_printi64(const struct sp_matrix *matrix);
+#endif
+
+#endif /* STAPLE_MATRIX_H */
@@ -0,0 +1,57 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_POOL_H
+#define STAPLE_POOL_H
+
+/* The object pool module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+
+struct sp_pool_slab {
+	char  *data;
+	size_t size;
+};
+
+struct sp_pool {
+	struct sp_pool_slab *slabs;
+	void  *free;
+	void  *tail;
+	size_t block_size;
+	size_t stride;
+	size_t size;
+	size_t capacity;
+	size_t nslabs;
+	size_t used;
+	size_t left;
+	int (*ctor)(void*);
+	int (*dtor)(void*);
+};
+
+struct sp_pool *sp_pool_create(size_t block_size, size_t capacity, int (*ctor)(void*), int (*dtor)(void*));
+int             sp_pool_destroy(struct sp_pool *pool);
+int             sp_pool_reset(struct sp_pool *pool);
+int             sp_pool_reserve(struct sp_pool *pool, size_t n);
+
+void *sp_pool_alloc(struct sp_pool *pool);
+int   sp_pool_free(struct sp_pool *pool, void *block);
+
+int sp_pool_print(const struct sp_pool *pool);
+
+#endif /* STAPLE_POOL_H */
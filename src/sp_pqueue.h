@@ -0,0 +1,213 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_PQUEUE_H
+#define STAPLE_PQUEUE_H
+
+/* The priority queue module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Orders of struct sp_pqueue: which element is popped first */
+#define SP_PQUEUE_MIN 0
+#define SP_PQUEUE_MAX 1
+
+/* Number of children of every element, unless specified otherwise */
+#define SP_PQUEUE_ARITY 4
+
+struct sp_pqueue {
+	void  *data;
+	size_t elem_size;
+	size_t size;
+	size_t capacity;
+	size_t arity;
+	int    order;
+	int  (*cmp)(const void*, const void*);
+};
+
+struct sp_pqueue *sp_pqueue_create(size_t elem_size, size_t capacity, size_t arity, int order, int (*cmp)(const void*, const void*));
+int               sp_pqueue_clear(struct sp_pqueue *pq, int (*dtor)(void*));
+int               sp_pqueue_destroy(struct sp_pqueue *pq, int (*dtor)(void*));
+
+int sp_pqueue_push(struct sp_pqueue *pq, const void *elem);
+int sp_pqueue_pushc(struct sp_pqueue *pq, char elem);
+int sp_pqueue_pushs(struct sp_pqueue *pq, short elem);
+int sp_pqueue_pushi(struct sp_pqueue *pq, int elem);
+int sp_pqueue_pushl(struct sp_pqueue *pq, long elem);
+int sp_pqueue_pushsc(struct sp_pqueue *pq, signed char elem);
+int sp_pqueue_pushuc(struct sp_pqueue *pq, unsigned char elem);
+int sp_pqueue_pushus(struct sp_pqueue *pq, unsigned short elem);
+int sp_pqueue_pushui(struct sp_pqueue *pq, unsigned int elem);
+int sp_pqueue_pushul(struct sp_pqueue *pq, unsigned long elem);
+int sp_pqueue_pushf(struct sp_pqueue *pq, float elem);
+int sp_pqueue_pushd(struct sp_pqueue *pq, double elem);
+int sp_pqueue_pushld(struct sp_pqueue *pq, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_pqueue_pushb(struct sp_pqueue *pq, _Bool elem);
+int sp_pqueue_pushll(struct sp_pqueue *pq, long long elem);
+int sp_pqueue_pushull(struct sp_pqueue *pq, unsigned long long elem);
+int sp_pqueue_pushu8(struct sp_pqueue *pq, uint8_t elem);
+int sp_pqueue_pushu16(struct sp_pqueue *pq, uint16_t elem);
+int sp_pqueue_pushu32(struct sp_pqueue *pq, uint32_t elem);
+int sp_pqueue_pushu64(struct sp_pqueue *pq, uint64_t elem);
+int sp_pqueue_pushi8(struct sp_pqueue *pq, int8_t elem);
+int sp_pqueue_pushi16(struct sp_pqueue *pq, int16_t elem);
+int sp_pqueue_pushi32(struct sp_pqueue *pq, int32_t elem);
+int sp_pqueue_pushi64(struct sp_pqueue *pq, int64_t elem);
+#endif
+
+void   *sp_pqueue_peek(const struct sp_pqueue *pq);
+char  sp_pqueue_peekc(const struct sp_pqueue *pq);
+short  sp_pqueue_peeks(const struct sp_pqueue *pq);
+int  sp_pqueue_peeki(const struct sp_pqueue *pq);
+long  sp_pqueue_peekl(const struct sp_pqueue *pq);
+signed char  sp_pqueue_peeksc(const struct sp_pqueue *pq);
+unsigned char  sp_pqueue_peekuc(const struct sp_pqueue *pq);
+unsigned short  sp_pqueue_peekus(const struct sp_pqueue *pq);
+unsigned int  sp_pqueue_peekui(const struct sp_pqueue *pq);
+unsigned long  sp_pqueue_peekul(const struct sp_pqueue *pq);
+float  sp_pqueue_peekf(const struct sp_pqueue *pq);
+double  sp_pqueue_peekd(const struct sp_pqueue *pq);
+long double  sp_pqueue_peekld(const struct sp_pqueue *pq);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_pqueue_peekb(const struct sp_pqueue *pq);
+long long  sp_pqueue_peekll(const struct sp_pqueue *pq);
+unsigned long long  sp_pqueue_peekull(const struct sp_pqueue *pq);
+uint8_t  sp_pqueue_peeku8(const struct sp_pqueue *pq);
+uint16_t  sp_pqueue_peeku16(const struct sp_pqueue *pq);
+uint32_t  sp_pqueue_peeku32(const struct sp_pqueue *pq);
+uint64_t  sp_pqueue_peeku64(const struct sp_pqueue *pq);
+int8_t  sp_pqueue_peeki8(const struct sp_pqueue *pq);
+int16_t  sp_pqueue_peeki16(const struct sp_pqueue *pq);
+int32_t  sp_pqueue_peeki32(const struct sp_pqueue *pq);
+int64_t  sp_pqueue_peeki64(const struct sp_pqueue *pq);
+#endif
+
+int     sp_pqueue_pop(struct sp_pqueue *pq, int (*dtor)(void*));
+char  sp_pqueue_popc(struct sp_pqueue *pq);
+short  sp_pqueue_pops(struct sp_pqueue *pq);
+int  sp_pqueue_popi(struct sp_pqueue *pq);
+long  sp_pqueue_popl(struct sp_pqueue *pq);
+signed char  sp_pqueue_popsc(struct sp_pqueue *pq);
+unsigned char  sp_pqueue_popuc(struct sp_pqueue *pq);
+unsigned short  sp_pqueue_popus(struct sp_pqueue *pq);
+unsigned int  sp_pqueue_popui(struct sp_pqueue *pq);
+unsigned long  sp_pqueue_popul(struct sp_pqueue *pq);
+float  sp_pqueue_popf(struct sp_pqueue *pq);
+double  sp_pqueue_popd(struct sp_pqueue *pq);
+long double  sp_pqueue_popld(struct sp_pqueue *pq);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_pqueue_popb(struct sp_pqueue *pq);
+long long  sp_pqueue_popll(struct sp_pqueue *pq);
+unsigned long long  sp_pqueue_popull(struct sp_pqueue *pq);
+uint8_t  sp_pqueue_popu8(struct sp_pqueue *pq);
+uint16_t  sp_pqueue_popu16(struct sp_pqueue *pq);
+uint32_t  sp_pqueue_popu32(struct sp_pqueue *pq);
+uint64_t  sp_pqueue_popu64(struct sp_pqueue *pq);
+int8_t  sp_pqueue_popi8(struct sp_pqueue *pq);
+int16_t  sp_pqueue_popi16(struct sp_pqueue *pq);
+int32_t  sp_pqueue_popi32(struct sp_pqueue *pq);
+int64_t  sp_pqueue_popi64(struct sp_pqueue *pq);
+#endif
+
+int sp_pqueue_heapify(struct sp_pqueue *pq, const void *arr, size_t n);
+int sp_pqueue_heapifyc(struct sp_pqueue *pq, const char *arr, size_t n);
+int sp_pqueue_heapifys(struct sp_pqueue *pq, const short *arr, size_t n);
+int sp_pqueue_heapifyi(struct sp_pqueue *pq, const int *arr, size_t n);
+int sp_pqueue_heapifyl(struct sp_pqueue *pq, const long *arr, size_t n);
+int sp_pqueue_heapifysc(struct sp_pqueue *pq, const signed char *arr, size_t n);
+int sp_pqueue_heapifyuc(struct sp_pqueue *pq, const unsigned char *arr, size_t n);
+int sp_pqueue_heapifyus(struct sp_pqueue *pq, const unsigned short *arr, size_t n);
+int sp_pqueue_heapifyui(struct sp_pqueue *pq, const unsigned int *arr, size_t n);
+int sp_pqueue_heapifyul(struct sp_pqueue *pq, const unsigned long *arr, size_t n);
+int sp_pqueue_heapifyf(struct sp_pqueue *pq, const float *arr, size_t n);
+int sp_pqueue_heapifyd(struct sp_pqueue *pq, const double *arr, size_t n);
+int sp_pqueue_heapifyld(struct sp_pqueue *pq, const long double *arr, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_pqueue_heapifyb(struct sp_pqueue *pq, const _Bool *arr, size_t n);
+int sp_pqueue_heapifyll(struct sp_pqueue *pq, const long long *arr, size_t n);
+int sp_pqueue_heapifyull(struct sp_pqueue *pq, const unsigned long long *arr, size_t n);
+int sp_pqueue_heapifyu8(struct sp_pqueue *pq, const uint8_t *arr, size_t n);
+int sp_pqueue_heapifyu16(struct sp_pqueue *pq, const uint16_t *arr, size_t n);
+int sp_pqueue_heapifyu32(struct sp_pqueue *pq, const uint32_t *arr, size_t n);
+int sp_pqueue_heapifyu64(struct sp_pqueue *pq, const uint64_t *arr, size_t n);
+int sp_pqueue_heapifyi8(struct sp_pqueue *pq, const int8_t *arr, size_t n);
+int sp_pqueue_heapifyi16(struct sp_pqueue *pq, const int16_t *arr, size_t n);
+int sp_pqueue_heapifyi32(struct sp_pqueue *pq, const int32_t *arr, size_t n);
+int sp_pqueue_heapifyi64(struct sp_pqueue *pq, const int64_t *arr, size_t n);
+#endif
+
+int sp_pqueue_merge(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergec(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_merges(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergei(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergel(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergesc(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeuc(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeus(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeui(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeul(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergef(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_merged(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeld(struct sp_pqueue *dest, const struct sp_pqueue *src);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_pqueue_mergeb(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergell(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeull(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeu8(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeu16(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeu32(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergeu64(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergei8(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergei16(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergei32(struct sp_pqueue *dest, const struct sp_pqueue *src);
+int sp_pqueue_mergei64(struct sp_pqueue *dest, const struct sp_pqueue *src);
+#endif
+
+int sp_pqueue_print(const struct sp_pqueue *pq, int (*func)(const void*));
+int sp_pqueue_printc(const struct sp_pqueue *pq);
+int sp_pqueue_prints(const struct sp_pqueue *pq);
+int sp_pqueue_printi(const struct sp_pqueue *pq);
+int sp_pqueue_printl(const struct sp_pqueue *pq);
+int sp_pqueue_printsc(const struct sp_pqueue *pq);
+int sp_pqueue_printuc(const struct sp_pqueue *pq);
+int sp_pqueue_printus(const struct sp_pqueue *pq);
+int sp_pqueue_printui(const struct sp_pqueue *pq);
+int sp_pqueue_printul(const struct sp_pqueue *pq);
+int sp_pqueue_printf(const struct sp_pqueue *pq);
+int sp_pqueue_printd(const struct sp_pqueue *pq);
+int sp_pqueue_printld(const struct sp_pqueue *pq);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_pqueue_printb(const struct sp_pqueue *pq);
+int sp_pqueue_printll(const struct sp_pqueue *pq);
+int sp_pqueue_printull(const struct sp_pqueue *pq);
+int sp_pqueue_printu8(const struct sp_pqueue *pq);
+int sp_pqueue_printu16(const struct sp_pqueue *pq);
+int sp_pqueue_printu32(const struct sp_pqueue *pq);
+int sp_pqueue_printu64(const struct sp_pqueue *pq);
+int sp_pqueue_printi8(const struct sp_pqueue *pq);
+int sp_pqueue_printi16(const struct sp_pqueue *pq);
+int sp_pqueue_printi32(const struct sp_pqueue *pq);
+int sp_pqueue_printi64(const struct sp_pqueue *pq);
+#endif
+
+#endif /* STAPLE_PQUEUE_H */
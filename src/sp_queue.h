@@ -27,6 +27,8 @@
 #include <stdint.h>
 #endif
 
+struct sp_intern;
+
 struct sp_queue {
 	void *data;
 	void *head;
@@ -71,6 +73,66 @@ int sp_queue_pushi64(struct sp_queue *queue, int64_t elem);
 #endif
 int sp_queue_pushstr(struct sp_queue *queue, const char *elem);
 int sp_queue_pushstrn(struct sp_queue *queue, const char *elem, size_t len);
+int sp_queue_pushistr(struct sp_queue *queue, struct sp_intern *pool, const char *elem);
+
+int sp_queue_pushfront(struct sp_queue *queue, const void *elem);
+int sp_queue_pushfrontc(struct sp_queue *queue, char elem);
+int sp_queue_pushfronts(struct sp_queue *queue, short elem);
+int sp_queue_pushfronti(struct sp_queue *queue, int elem);
+int sp_queue_pushfrontl(struct sp_queue *queue, long elem);
+int sp_queue_pushfrontsc(struct sp_queue *queue, signed char elem);
+int sp_queue_pushfrontuc(struct sp_queue *queue, unsigned char elem);
+int sp_queue_pushfrontus(struct sp_queue *queue, unsigned short elem);
+int sp_queue_pushfrontui(struct sp_queue *queue, unsigned int elem);
+int sp_queue_pushfrontul(struct sp_queue *queue, unsigned long elem);
+int sp_queue_pushfrontf(struct sp_queue *queue, float elem);
+int sp_queue_pushfrontd(struct sp_queue *queue, double elem);
+int sp_queue_pushfrontld(struct sp_queue *queue, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_queue_pushfrontb(struct sp_queue *queue, _Bool elem);
+int sp_queue_pushfrontll(struct sp_queue *queue, long long elem);
+int sp_queue_pushfrontull(struct sp_queue *queue, unsigned long long elem);
+int sp_queue_pushfrontu8(struct sp_queue *queue, uint8_t elem);
+int sp_queue_pushfrontu16(struct sp_queue *queue, uint16_t elem);
+int sp_queue_pushfrontu32(struct sp_queue *queue, uint32_t elem);
+int sp_queue_pushfrontu64(struct sp_queue *queue, uint64_t elem);
+int sp_queue_pushfronti8(struct sp_queue *queue, int8_t elem);
+int sp_queue_pushfronti16(struct sp_queue *queue, int16_t elem);
+int sp_queue_pushfronti32(struct sp_queue *queue, int32_t elem);
+int sp_queue_pushfronti64(struct sp_queue *queue, int64_t elem);
+#endif
+int sp_queue_pushfrontstr(struct sp_queue *queue, const char *elem);
+int sp_queue_pushfrontstrn(struct sp_queue *queue, const char *elem, size_t len);
+
+int sp_queue_rpush(struct sp_queue *queue, const void *elem, int (*dtor)(void*));
+int sp_queue_rpushc(struct sp_queue *queue, char elem);
+int sp_queue_rpushs(struct sp_queue *queue, short elem);
+int sp_queue_rpushi(struct sp_queue *queue, int elem);
+int sp_queue_rpushl(struct sp_queue *queue, long elem);
+int sp_queue_rpushsc(struct sp_queue *queue, signed char elem);
+int sp_queue_rpushuc(struct sp_queue *queue, unsigned char elem);
+int sp_queue_rpushus(struct sp_queue *queue, unsigned short elem);
+int sp_queue_rpushui(struct sp_queue *queue, unsigned int elem);
+int sp_queue_rpushul(struct sp_queue *queue, unsigned long elem);
+int sp_queue_rpushf(struct sp_queue *queue, float elem);
+int sp_queue_rpushd(struct sp_queue *queue, double elem);
+int sp_queue_rpushld(struct sp_queue *queue, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_queue_rpushb(struct sp_queue *queue, _Bool elem);
+int sp_queue_rpushll(struct sp_queue *queue, long long elem);
+int sp_queue_rpushull(struct sp_queue *queue, unsigned long long elem);
+int sp_queue_rpushu8(struct sp_queue *queue, uint8_t elem);
+int sp_queue_rpushu16(struct sp_queue *queue, uint16_t elem);
+int sp_queue_rpushu32(struct sp_queue *queue, uint32_t elem);
+int sp_queue_rpushu64(struct sp_queue *queue, uint64_t elem);
+int sp_queue_rpushi8(struct sp_queue *queue, int8_t elem);
+int sp_queue_rpushi16(struct sp_queue *queue, int16_t elem);
+int sp_queue_rpushi32(struct sp_queue *queue, int32_t elem);
+int sp_queue_rpushi64(struct sp_queue *queue, int64_t elem);
+#endif
+int sp_queue_rpushstr(struct sp_queue *queue, const char *elem);
+int sp_queue_rpushstrn(struct sp_queue *queue, const char *elem, size_t len);
+int sp_queue_rpushn(struct sp_queue *queue, const void *elems, size_t n, int (*dtor)(void*));
 
 int sp_queue_insert(struct sp_queue *queue, size_t idx, const void *elem);
 int sp_queue_insertc(struct sp_queue *queue, size_t idx, char elem);
@@ -158,6 +220,34 @@ int64_t         sp_queue_peeki64(const struct sp_queue *queue);
 #endif
 char          *sp_queue_peekstr(const struct sp_queue *queue);
 
+void          *sp_queue_peekback(const struct sp_queue *queue);
+char         sp_queue_peekbackc(const struct sp_queue *queue);
+short         sp_queue_peekbacks(const struct sp_queue *queue);
+int         sp_queue_peekbacki(const struct sp_queue *queue);
+long         sp_queue_peekbackl(const struct sp_queue *queue);
+signed char         sp_queue_peekbacksc(const struct sp_queue *queue);
+unsigned char         sp_queue_peekbackuc(const struct sp_queue *queue);
+unsigned short         sp_queue_peekbackus(const struct sp_queue *queue);
+unsigned int         sp_queue_peekbackui(const struct sp_queue *queue);
+unsigned long         sp_queue_peekbackul(const struct sp_queue *queue);
+float         sp_queue_peekbackf(const struct sp_queue *queue);
+double         sp_queue_peekbackd(const struct sp_queue *queue);
+long double         sp_queue_peekbackld(const struct sp_queue *queue);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_queue_peekbackb(const struct sp_queue *queue);
+long long         sp_queue_peekbackll(const struct sp_queue *queue);
+unsigned long long         sp_queue_peekbackull(const struct sp_queue *queue);
+uint8_t         sp_queue_peekbacku8(const struct sp_queue *queue);
+uint16_t         sp_queue_peekbacku16(const struct sp_queue *queue);
+uint32_t         sp_queue_peekbacku32(const struct sp_queue *queue);
+uint64_t         sp_queue_peekbacku64(const struct sp_queue *queue);
+int8_t         sp_queue_peekbacki8(const struct sp_queue *queue);
+int16_t         sp_queue_peekbacki16(const struct sp_queue *queue);
+int32_t         sp_queue_peekbacki32(const struct sp_queue *queue);
+int64_t         sp_queue_peekbacki64(const struct sp_queue *queue);
+#endif
+char          *sp_queue_peekbackstr(const struct sp_queue *queue);
+
 int            sp_queue_pop(struct sp_queue *queue, int (*dtor)(void*));
 char         sp_queue_popc(struct sp_queue *queue);
 short         sp_queue_pops(struct sp_queue *queue);
@@ -186,6 +276,34 @@ int64_t         sp_queue_popi64(struct sp_queue *queue);
 #endif
 char          *sp_queue_popstr(struct sp_queue *queue);
 
+int            sp_queue_popback(struct sp_queue *queue, int (*dtor)(void*));
+char         sp_queue_popbackc(struct sp_queue *queue);
+short         sp_queue_popbacks(struct sp_queue *queue);
+int         sp_queue_popbacki(struct sp_queue *queue);
+long         sp_queue_popbackl(struct sp_queue *queue);
+signed char         sp_queue_popbacksc(struct sp_queue *queue);
+unsigned char         sp_queue_popbackuc(struct sp_queue *queue);
+unsigned short         sp_queue_popbackus(struct sp_queue *queue);
+unsigned int         sp_queue_popbackui(struct sp_queue *queue);
+unsigned long         sp_queue_popbackul(struct sp_queue *queue);
+float         sp_queue_popbackf(struct sp_queue *queue);
+double         sp_queue_popbackd(struct sp_queue *queue);
+long double         sp_queue_popbackld(struct sp_queue *queue);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool         sp_queue_popbackb(struct sp_queue *queue);
+long long         sp_queue_popbackll(struct sp_queue *queue);
+unsigned long long         sp_queue_popbackull(struct sp_queue *queue);
+uint8_t         sp_queue_popbacku8(struct sp_queue *queue);
+uint16_t         sp_queue_popbacku16(struct sp_queue *queue);
+uint32_t         sp_queue_popbacku32(struct sp_queue *queue);
+uint64_t         sp_queue_popbacku64(struct sp_queue *queue);
+int8_t         sp_queue_popbacki8(struct sp_queue *queue);
+int16_t         sp_queue_popbacki16(struct sp_queue *queue);
+int32_t         sp_queue_popbacki32(struct sp_queue *queue);
+int64_t         sp_queue_popbacki64(struct sp_queue *queue);
+#endif
+char          *sp_queue_popbackstr(struct sp_queue *queue);
+
 int            sp_queue_remove(struct sp_queue *queue, size_t idx, int (*dtor)(void*));
 char         sp_queue_removec(struct sp_queue *queue, size_t idx);
 short         sp_queue_removes(struct sp_queue *queue, size_t idx);
@@ -242,6 +360,9 @@ int64_t         sp_queue_qremovei64(struct sp_queue *queue, size_t idx);
 #endif
 char          *sp_queue_qremovestr(struct sp_queue *queue, size_t idx);
 
+int            sp_queue_last(const struct sp_queue *queue, size_t n, void *dest);
+int            sp_queue_rotate(struct sp_queue *queue, size_t n);
+
 void          *sp_queue_get(const struct sp_queue *queue, size_t idx);
 char         sp_queue_getc(const struct sp_queue *queue, size_t idx);
 short         sp_queue_gets(const struct sp_queue *queue, size_t idx);
@@ -0,0 +1,67 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_RBTREE_H
+#define STAPLE_RBTREE_H
+
+/* The red-black tree module of the staple library. */
+
+#include <stdlib.h>
+#include <stddef.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+
+#define SP_RBTREE_BLACK 0
+#define SP_RBTREE_RED   1
+
+/* Address of the structure of type TYPE which embeds NODE as its MEMBER */
+#define SP_RBTREE_ENTRY(NODE, TYPE, MEMBER) \
+	((TYPE*)((char*)(NODE) - offsetof(TYPE, MEMBER)))
+
+struct sp_rbnode {
+	struct sp_rbnode *left;
+	struct sp_rbnode *right;
+	struct sp_rbnode *parent;
+	int color;
+};
+
+struct sp_rbtree {
+	struct sp_rbnode *root;
+	size_t size;
+	int  (*cmp)(const struct sp_rbnode*, const struct sp_rbnode*);
+};
+
+struct sp_rbtree *sp_rbtree_create(int (*cmp)(const struct sp_rbnode*, const struct sp_rbnode*));
+int               sp_rbtree_clear(struct sp_rbtree *tree, int (*dtor)(struct sp_rbnode*));
+int               sp_rbtree_destroy(struct sp_rbtree *tree, int (*dtor)(struct sp_rbnode*));
+
+int sp_rbtree_insert(struct sp_rbtree *tree, struct sp_rbnode *node);
+int sp_rbtree_inserthint(struct sp_rbtree *tree, struct sp_rbnode *hint, struct sp_rbnode *node);
+int sp_rbtree_remove(struct sp_rbtree *tree, struct sp_rbnode *node);
+
+struct sp_rbnode *sp_rbtree_find(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*));
+struct sp_rbnode *sp_rbtree_lowerbound(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*));
+struct sp_rbnode *sp_rbtree_upperbound(const struct sp_rbtree *tree, const void *key, int (*cmp)(const void*, const struct sp_rbnode*));
+
+struct sp_rbnode *sp_rbtree_first(const struct sp_rbtree *tree);
+struct sp_rbnode *sp_rbtree_last(const struct sp_rbtree *tree);
+struct sp_rbnode *sp_rbtree_next(const struct sp_rbnode *node);
+struct sp_rbnode *sp_rbtree_prev(const struct sp_rbnode *node);
+
+int sp_rbtree_print(const struct sp_rbtree *tree, int (*func)(const struct sp_rbnode*));
+
+#endif /* STAPLE_RBTREE_H */
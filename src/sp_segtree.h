@@ -0,0 +1,272 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_SEGTREE_H
+#define STAPLE_SEGTREE_H
+
+/* The segment tree module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_segtree {
+	void          *data;
+	unsigned char *lazy;
+	size_t         elem_size;
+	size_t         size;
+	size_t         cap;
+	size_t         height;
+};
+
+struct sp_segtree *sp_segtree_create(size_t elem_size, size_t size);
+int                sp_segtree_clear(struct sp_segtree *tree);
+int                sp_segtree_destroy(struct sp_segtree *tree);
+
+int     sp_segtree_buildc(struct sp_segtree *tree, const char *vals);
+int     sp_segtree_builds(struct sp_segtree *tree, const short *vals);
+int     sp_segtree_buildi(struct sp_segtree *tree, const int *vals);
+int     sp_segtree_buildl(struct sp_segtree *tree, const long *vals);
+int     sp_segtree_buildsc(struct sp_segtree *tree, const signed char *vals);
+int     sp_segtree_builduc(struct sp_segtree *tree, const unsigned char *vals);
+int     sp_segtree_buildus(struct sp_segtree *tree, const unsigned short *vals);
+int     sp_segtree_buildui(struct sp_segtree *tree, const unsigned int *vals);
+int     sp_segtree_buildul(struct sp_segtree *tree, const unsigned long *vals);
+int     sp_segtree_buildf(struct sp_segtree *tree, const float *vals);
+int     sp_segtree_buildd(struct sp_segtree *tree, const double *vals);
+int     sp_segtree_buildld(struct sp_segtree *tree, const long double *vals);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_segtree_buildb(struct sp_segtree *tree, const _Bool *vals);
+int     sp_segtree_buildll(struct sp_segtree *tree, const long long *vals);
+int     sp_segtree_buildull(struct sp_segtree *tree, const unsigned long long *vals);
+int     sp_segtree_buildu8(struct sp_segtree *tree, const uint8_t *vals);
+int     sp_segtree_buildu16(struct sp_segtree *tree, const uint16_t *vals);
+int     sp_segtree_buildu32(struct sp_segtree *tree, const uint32_t *vals);
+int     sp_segtree_buildu64(struct sp_segtree *tree, const uint64_t *vals);
+int     sp_segtree_buildi8(struct sp_segtree *tree, const int8_t *vals);
+int     sp_segtree_buildi16(struct sp_segtree *tree, const int16_t *vals);
+int     sp_segtree_buildi32(struct sp_segtree *tree, const int32_t *vals);
+int     sp_segtree_buildi64(struct sp_segtree *tree, const int64_t *vals);
+#endif
+char  sp_segtree_getc(const struct sp_segtree *tree, size_t idx);
+short  sp_segtree_gets(const struct sp_segtree *tree, size_t idx);
+int  sp_segtree_geti(const struct sp_segtree *tree, size_t idx);
+long  sp_segtree_getl(const struct sp_segtree *tree, size_t idx);
+signed char  sp_segtree_getsc(const struct sp_segtree *tree, size_t idx);
+unsigned char  sp_segtree_getuc(const struct sp_segtree *tree, size_t idx);
+unsigned short  sp_segtree_getus(const struct sp_segtree *tree, size_t idx);
+unsigned int  sp_segtree_getui(const struct sp_segtree *tree, size_t idx);
+unsigned long  sp_segtree_getul(const struct sp_segtree *tree, size_t idx);
+float  sp_segtree_getf(const struct sp_segtree *tree, size_t idx);
+double  sp_segtree_getd(const struct sp_segtree *tree, size_t idx);
+long double  sp_segtree_getld(const struct sp_segtree *tree, size_t idx);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_segtree_getb(const struct sp_segtree *tree, size_t idx);
+long long  sp_segtree_getll(const struct sp_segtree *tree, size_t idx);
+unsigned long long  sp_segtree_getull(const struct sp_segtree *tree, size_t idx);
+uint8_t  sp_segtree_getu8(const struct sp_segtree *tree, size_t idx);
+uint16_t  sp_segtree_getu16(const struct sp_segtree *tree, size_t idx);
+uint32_t  sp_segtree_getu32(const struct sp_segtree *tree, size_t idx);
+uint64_t  sp_segtree_getu64(const struct sp_segtree *tree, size_t idx);
+int8_t  sp_segtree_geti8(const struct sp_segtree *tree, size_t idx);
+int16_t  sp_segtree_geti16(const struct sp_segtree *tree, size_t idx);
+int32_t  sp_segtree_geti32(const struct sp_segtree *tree, size_t idx);
+int64_t  sp_segtree_geti64(const struct sp_segtree *tree, size_t idx);
+#endif
+int     sp_segtree_setc(struct sp_segtree *tree, size_t idx, char val);
+int     sp_segtree_sets(struct sp_segtree *tree, size_t idx, short val);
+int     sp_segtree_seti(struct sp_segtree *tree, size_t idx, int val);
+int     sp_segtree_setl(struct sp_segtree *tree, size_t idx, long val);
+int     sp_segtree_setsc(struct sp_segtree *tree, size_t idx, signed char val);
+int     sp_segtree_setuc(struct sp_segtree *tree, size_t idx, unsigned char val);
+int     sp_segtree_setus(struct sp_segtree *tree, size_t idx, unsigned short val);
+int     sp_segtree_setui(struct sp_segtree *tree, size_t idx, unsigned int val);
+int     sp_segtree_setul(struct sp_segtree *tree, size_t idx, unsigned long val);
+int     sp_segtree_setf(struct sp_segtree *tree, size_t idx, float val);
+int     sp_segtree_setd(struct sp_segtree *tree, size_t idx, double val);
+int     sp_segtree_setld(struct sp_segtree *tree, size_t idx, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_segtree_setb(struct sp_segtree *tree, size_t idx, _Bool val);
+int     sp_segtree_setll(struct sp_segtree *tree, size_t idx, long long val);
+int     sp_segtree_setull(struct sp_segtree *tree, size_t idx, unsigned long long val);
+int     sp_segtree_setu8(struct sp_segtree *tree, size_t idx, uint8_t val);
+int     sp_segtree_setu16(struct sp_segtree *tree, size_t idx, uint16_t val);
+int     sp_segtree_setu32(struct sp_segtree *tree, size_t idx, uint32_t val);
+int     sp_segtree_setu64(struct sp_segtree *tree, size_t idx, uint64_t val);
+int     sp_segtree_seti8(struct sp_segtree *tree, size_t idx, int8_t val);
+int     sp_segtree_seti16(struct sp_segtree *tree, size_t idx, int16_t val);
+int     sp_segtree_seti32(struct sp_segtree *tree, size_t idx, int32_t val);
+int     sp_segtree_seti64(struct sp_segtree *tree, size_t idx, int64_t val);
+#endif
+
+int     sp_segtree_addc(struct sp_segtree *tree, size_t idx, size_t n, char delta);
+int     sp_segtree_adds(struct sp_segtree *tree, size_t idx, size_t n, short delta);
+int     sp_segtree_addi(struct sp_segtree *tree, size_t idx, size_t n, int delta);
+int     sp_segtree_addl(struct sp_segtree *tree, size_t idx, size_t n, long delta);
+int     sp_segtree_addsc(struct sp_segtree *tree, size_t idx, size_t n, signed char delta);
+int     sp_segtree_adduc(struct sp_segtree *tree, size_t idx, size_t n, unsigned char delta);
+int     sp_segtree_addus(struct sp_segtree *tree, size_t idx, size_t n, unsigned short delta);
+int     sp_segtree_addui(struct sp_segtree *tree, size_t idx, size_t n, unsigned int delta);
+int     sp_segtree_addul(struct sp_segtree *tree, size_t idx, size_t n, unsigned long delta);
+int     sp_segtree_addf(struct sp_segtree *tree, size_t idx, size_t n, float delta);
+int     sp_segtree_addd(struct sp_segtree *tree, size_t idx, size_t n, double delta);
+int     sp_segtree_addld(struct sp_segtree *tree, size_t idx, size_t n, long double delta);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_segtree_addb(struct sp_segtree *tree, size_t idx, size_t n, _Bool delta);
+int     sp_segtree_addll(struct sp_segtree *tree, size_t idx, size_t n, long long delta);
+int     sp_segtree_addull(struct sp_segtree *tree, size_t idx, size_t n, unsigned long long delta);
+int     sp_segtree_addu8(struct sp_segtree *tree, size_t idx, size_t n, uint8_t delta);
+int     sp_segtree_addu16(struct sp_segtree *tree, size_t idx, size_t n, uint16_t delta);
+int     sp_segtree_addu32(struct sp_segtree *tree, size_t idx, size_t n, uint32_t delta);
+int     sp_segtree_addu64(struct sp_segtree *tree, size_t idx, size_t n, uint64_t delta);
+int     sp_segtree_addi8(struct sp_segtree *tree, size_t idx, size_t n, int8_t delta);
+int     sp_segtree_addi16(struct sp_segtree *tree, size_t idx, size_t n, int16_t delta);
+int     sp_segtree_addi32(struct sp_segtree *tree, size_t idx, size_t n, int32_t delta);
+int     sp_segtree_addi64(struct sp_segtree *tree, size_t idx, size_t n, int64_t delta);
+#endif
+int     sp_segtree_fillc(struct sp_segtree *tree, size_t idx, size_t n, char val);
+int     sp_segtree_fills(struct sp_segtree *tree, size_t idx, size_t n, short val);
+int     sp_segtree_filli(struct sp_segtree *tree, size_t idx, size_t n, int val);
+int     sp_segtree_filll(struct sp_segtree *tree, size_t idx, size_t n, long val);
+int     sp_segtree_fillsc(struct sp_segtree *tree, size_t idx, size_t n, signed char val);
+int     sp_segtree_filluc(struct sp_segtree *tree, size_t idx, size_t n, unsigned char val);
+int     sp_segtree_fillus(struct sp_segtree *tree, size_t idx, size_t n, unsigned short val);
+int     sp_segtree_fillui(struct sp_segtree *tree, size_t idx, size_t n, unsigned int val);
+int     sp_segtree_fillul(struct sp_segtree *tree, size_t idx, size_t n, unsigned long val);
+int     sp_segtree_fillf(struct sp_segtree *tree, size_t idx, size_t n, float val);
+int     sp_segtree_filld(struct sp_segtree *tree, size_t idx, size_t n, double val);
+int     sp_segtree_fillld(struct sp_segtree *tree, size_t idx, size_t n, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int     sp_segtree_fillb(struct sp_segtree *tree, size_t idx, size_t n, _Bool val);
+int     sp_segtree_fillll(struct sp_segtree *tree, size_t idx, size_t n, long long val);
+int     sp_segtree_fillull(struct sp_segtree *tree, size_t idx, size_t n, unsigned long long val);
+int     sp_segtree_fillu8(struct sp_segtree *tree, size_t idx, size_t n, uint8_t val);
+int     sp_segtree_fillu16(struct sp_segtree *tree, size_t idx, size_t n, uint16_t val);
+int     sp_segtree_fillu32(struct sp_segtree *tree, size_t idx, size_t n, uint32_t val);
+int     sp_segtree_fillu64(struct sp_segtree *tree, size_t idx, size_t n, uint64_t val);
+int     sp_segtree_filli8(struct sp_segtree *tree, size_t idx, size_t n, int8_t val);
+int     sp_segtree_filli16(struct sp_segtree *tree, size_t idx, size_t n, int16_t val);
+int     sp_segtree_filli32(struct sp_segtree *tree, size_t idx, size_t n, int32_t val);
+int     sp_segtree_filli64(struct sp_segtree *tree, size_t idx, size_t n, int64_t val);
+#endif
+
+char  sp_segtree_sumc(struct sp_segtree *tree, size_t idx, size_t n);
+short  sp_segtree_sums(struct sp_segtree *tree, size_t idx, size_t n);
+int  sp_segtree_sumi(struct sp_segtree *tree, size_t idx, size_t n);
+long  sp_segtree_suml(struct sp_segtree *tree, size_t idx, size_t n);
+signed char  sp_segtree_sumsc(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned char  sp_segtree_sumuc(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned short  sp_segtree_sumus(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned int  sp_segtree_sumui(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned long  sp_segtree_sumul(struct sp_segtree *tree, size_t idx, size_t n);
+float  sp_segtree_sumf(struct sp_segtree *tree, size_t idx, size_t n);
+double  sp_segtree_sumd(struct sp_segtree *tree, size_t idx, size_t n);
+long double  sp_segtree_sumld(struct sp_segtree *tree, size_t idx, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_segtree_sumb(struct sp_segtree *tree, size_t idx, size_t n);
+long long  sp_segtree_sumll(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned long long  sp_segtree_sumull(struct sp_segtree *tree, size_t idx, size_t n);
+uint8_t  sp_segtree_sumu8(struct sp_segtree *tree, size_t idx, size_t n);
+uint16_t  sp_segtree_sumu16(struct sp_segtree *tree, size_t idx, size_t n);
+uint32_t  sp_segtree_sumu32(struct sp_segtree *tree, size_t idx, size_t n);
+uint64_t  sp_segtree_sumu64(struct sp_segtree *tree, size_t idx, size_t n);
+int8_t  sp_segtree_sumi8(struct sp_segtree *tree, size_t idx, size_t n);
+int16_t  sp_segtree_sumi16(struct sp_segtree *tree, size_t idx, size_t n);
+int32_t  sp_segtree_sumi32(struct sp_segtree *tree, size_t idx, size_t n);
+int64_t  sp_segtree_sumi64(struct sp_segtree *tree, size_t idx, size_t n);
+#endif
+char  sp_segtree_minc(struct sp_segtree *tree, size_t idx, size_t n);
+short  sp_segtree_mins(struct sp_segtree *tree, size_t idx, size_t n);
+int  sp_segtree_mini(struct sp_segtree *tree, size_t idx, size_t n);
+long  sp_segtree_minl(struct sp_segtree *tree, size_t idx, size_t n);
+signed char  sp_segtree_minsc(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned char  sp_segtree_minuc(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned short  sp_segtree_minus(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned int  sp_segtree_minui(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned long  sp_segtree_minul(struct sp_segtree *tree, size_t idx, size_t n);
+float  sp_segtree_minf(struct sp_segtree *tree, size_t idx, size_t n);
+double  sp_segtree_mind(struct sp_segtree *tree, size_t idx, size_t n);
+long double  sp_segtree_minld(struct sp_segtree *tree, size_t idx, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_segtree_minb(struct sp_segtree *tree, size_t idx, size_t n);
+long long  sp_segtree_minll(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned long long  sp_segtree_minull(struct sp_segtree *tree, size_t idx, size_t n);
+uint8_t  sp_segtree_minu8(struct sp_segtree *tree, size_t idx, size_t n);
+uint16_t  sp_segtree_minu16(struct sp_segtree *tree, size_t idx, size_t n);
+uint32_t  sp_segtree_minu32(struct sp_segtree *tree, size_t idx, size_t n);
+uint64_t  sp_segtree_minu64(struct sp_segtree *tree, size_t idx, size_t n);
+int8_t  sp_segtree_mini8(struct sp_segtree *tree, size_t idx, size_t n);
+int16_t  sp_segtree_mini16(struct sp_segtree *tree, size_t idx, size_t n);
+int32_t  sp_segtree_mini32(struct sp_segtree *tree, size_t idx, size_t n);
+int64_t  sp_segtree_mini64(struct sp_segtree *tree, size_t idx, size_t n);
+#endif
+char  sp_segtree_maxc(struct sp_segtree *tree, size_t idx, size_t n);
+short  sp_segtree_maxs(struct sp_segtree *tree, size_t idx, size_t n);
+int  sp_segtree_maxi(struct sp_segtree *tree, size_t idx, size_t n);
+long  sp_segtree_maxl(struct sp_segtree *tree, size_t idx, size_t n);
+signed char  sp_segtree_maxsc(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned char  sp_segtree_maxuc(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned short  sp_segtree_maxus(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned int  sp_segtree_maxui(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned long  sp_segtree_maxul(struct sp_segtree *tree, size_t idx, size_t n);
+float  sp_segtree_maxf(struct sp_segtree *tree, size_t idx, size_t n);
+double  sp_segtree_maxd(struct sp_segtree *tree, size_t idx, size_t n);
+long double  sp_segtree_maxld(struct sp_segtree *tree, size_t idx, size_t n);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_segtree_maxb(struct sp_segtree *tree, size_t idx, size_t n);
+long long  sp_segtree_maxll(struct sp_segtree *tree, size_t idx, size_t n);
+unsigned long long  sp_segtree_maxull(struct sp_segtree *tree, size_t idx, size_t n);
+uint8_t  sp_segtree_maxu8(struct sp_segtree *tree, size_t idx, size_t n);
+uint16_t  sp_segtree_maxu16(struct sp_segtree *tree, size_t idx, size_t n);
+uint32_t  sp_segtree_maxu32(struct sp_segtree *tree, size_t idx, size_t n);
+uint64_t  sp_segtree_maxu64(struct sp_segtree *tree, size_t idx, size_t n);
+int8_t  sp_segtree_maxi8(struct sp_segtree *tree, size_t idx, size_t n);
+int16_t  sp_segtree_maxi16(struct sp_segtree *tree, size_t idx, size_t n);
+int32_t  sp_segtree_maxi32(struct sp_segtree *tree, size_t idx, size_t n);
+int64_t  sp_segtree_maxi64(struct sp_segtree *tree, size_t idx, size_t n);
+#endif
+
+int sp_segtree_printc(const struct sp_segtree *tree);
+int sp_segtree_prints(const struct sp_segtree *tree);
+int sp_segtree_printi(const struct sp_segtree *tree);
+int sp_segtree_printl(const struct sp_segtree *tree);
+int sp_segtree_printsc(const struct sp_segtree *tree);
+int sp_segtree_printuc(const struct sp_segtree *tree);
+int sp_segtree_printus(const struct sp_segtree *tree);
+int sp_segtree_printui(const struct sp_segtree *tree);
+int sp_segtree_printul(const struct sp_segtree *tree);
+int sp_segtree_printf(const struct sp_segtree *tree);
+int sp_segtree_printd(const struct sp_segtree *tree);
+int sp_segtree_printld(const struct sp_segtree *tree);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_segtree_printb(const struct sp_segtree *tree);
+int sp_segtree_printll(const struct sp_segtree *tree);
+int sp_segtree_printull(const struct sp_segtree *tree);
+int sp_segtree_printu8(const struct sp_segtree *tree);
+int sp_segtree_printu16(const struct sp_segtree *tree);
+int sp_segtree_printu32(const struct sp_segtree *tree);
+int sp_segtree_printu64(const struct sp_segtree *tree);
+int sp_segtree_printi8(const struct sp_segtree *tree);
+int sp_segtree_printi16(const struct sp_segtree *tree);
+int sp_segtree_printi32(const struct sp_segtree *tree);
+int sp_segtree_printi64(const struct sp_segtree *tree);
+#endif
+
+#endif /* STAPLE_SEGTREE_H */
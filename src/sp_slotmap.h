@@ -0,0 +1,173 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_SLOTMAP_H
+#define STAPLE_SLOTMAP_H
+
+/* The slot map module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Largest generation of a slot, and bound on the number of slots, so that
+ * both parts of a handle fit in 32 bits */
+#define SP_SLOTMAP_MAX 0xFFFFFFFFUL
+
+struct sp_slotmap_handle {
+	unsigned long idx;
+	unsigned long gen;
+};
+
+struct sp_slotmap_slot {
+	unsigned long gen;
+	size_t        pos;
+};
+
+struct sp_slotmap {
+	void   *data;
+	size_t *owner;
+	struct sp_slotmap_slot *slots;
+	size_t  elem_size;
+	size_t  size;
+	size_t  count;
+	size_t  capacity;
+	size_t  head;
+	size_t  tail;
+	size_t  nfree;
+};
+
+struct sp_slotmap *sp_slotmap_create(size_t elem_size, size_t capacity);
+int                sp_slotmap_clear(struct sp_slotmap *sm, int (*dtor)(void*));
+int                sp_slotmap_destroy(struct sp_slotmap *sm, int (*dtor)(void*));
+int                sp_slotmap_map(struct sp_slotmap *sm, int (*func)(void*, size_t));
+
+int sp_slotmap_insert(struct sp_slotmap *sm, const void *elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertc(struct sp_slotmap *sm, char elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_inserts(struct sp_slotmap *sm, short elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_inserti(struct sp_slotmap *sm, int elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertl(struct sp_slotmap *sm, long elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertsc(struct sp_slotmap *sm, signed char elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertuc(struct sp_slotmap *sm, unsigned char elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertus(struct sp_slotmap *sm, unsigned short elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertui(struct sp_slotmap *sm, unsigned int elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertul(struct sp_slotmap *sm, unsigned long elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertf(struct sp_slotmap *sm, float elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertd(struct sp_slotmap *sm, double elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertld(struct sp_slotmap *sm, long double elem, struct sp_slotmap_handle *handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_slotmap_insertb(struct sp_slotmap *sm, _Bool elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertll(struct sp_slotmap *sm, long long elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertull(struct sp_slotmap *sm, unsigned long long elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertu8(struct sp_slotmap *sm, uint8_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertu16(struct sp_slotmap *sm, uint16_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertu32(struct sp_slotmap *sm, uint32_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_insertu64(struct sp_slotmap *sm, uint64_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_inserti8(struct sp_slotmap *sm, int8_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_inserti16(struct sp_slotmap *sm, int16_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_inserti32(struct sp_slotmap *sm, int32_t elem, struct sp_slotmap_handle *handle);
+int sp_slotmap_inserti64(struct sp_slotmap *sm, int64_t elem, struct sp_slotmap_handle *handle);
+#endif
+
+int     sp_slotmap_contains(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+void   *sp_slotmap_get(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+char  sp_slotmap_getc(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+short  sp_slotmap_gets(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int  sp_slotmap_geti(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+long  sp_slotmap_getl(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+signed char  sp_slotmap_getsc(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned char  sp_slotmap_getuc(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned short  sp_slotmap_getus(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned int  sp_slotmap_getui(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned long  sp_slotmap_getul(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+float  sp_slotmap_getf(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+double  sp_slotmap_getd(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+long double  sp_slotmap_getld(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_slotmap_getb(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+long long  sp_slotmap_getll(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned long long  sp_slotmap_getull(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint8_t  sp_slotmap_getu8(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint16_t  sp_slotmap_getu16(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint32_t  sp_slotmap_getu32(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint64_t  sp_slotmap_getu64(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int8_t  sp_slotmap_geti8(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int16_t  sp_slotmap_geti16(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int32_t  sp_slotmap_geti32(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int64_t  sp_slotmap_geti64(const struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+#endif
+
+int     sp_slotmap_remove(struct sp_slotmap *sm, struct sp_slotmap_handle handle, int (*dtor)(void*));
+char  sp_slotmap_removec(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+short  sp_slotmap_removes(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int  sp_slotmap_removei(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+long  sp_slotmap_removel(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+signed char  sp_slotmap_removesc(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned char  sp_slotmap_removeuc(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned short  sp_slotmap_removeus(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned int  sp_slotmap_removeui(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned long  sp_slotmap_removeul(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+float  sp_slotmap_removef(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+double  sp_slotmap_removed(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+long double  sp_slotmap_removeld(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool  sp_slotmap_removeb(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+long long  sp_slotmap_removell(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+unsigned long long  sp_slotmap_removeull(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint8_t  sp_slotmap_removeu8(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint16_t  sp_slotmap_removeu16(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint32_t  sp_slotmap_removeu32(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+uint64_t  sp_slotmap_removeu64(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int8_t  sp_slotmap_removei8(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int16_t  sp_slotmap_removei16(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int32_t  sp_slotmap_removei32(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+int64_t  sp_slotmap_removei64(struct sp_slotmap *sm, struct sp_slotmap_handle handle);
+#endif
+
+struct sp_slotmap_handle sp_slotmap_at(const struct sp_slotmap *sm, size_t idx);
+
+int sp_slotmap_print(const struct sp_slotmap *sm, int (*func)(const void*));
+int sp_slotmap_printc(const struct sp_slotmap *sm);
+int sp_slotmap_prints(const struct sp_slotmap *sm);
+int sp_slotmap_printi(const struct sp_slotmap *sm);
+int sp_slotmap_printl(const struct sp_slotmap *sm);
+int sp_slotmap_printsc(const struct sp_slotmap *sm);
+int sp_slotmap_printuc(const struct sp_slotmap *sm);
+int sp_slotmap_printus(const struct sp_slotmap *sm);
+int sp_slotmap_printui(const struct sp_slotmap *sm);
+int sp_slotmap_printul(const struct sp_slotmap *sm);
+int sp_slotmap_printf(const struct sp_slotmap *sm);
+int sp_slotmap_printd(const struct sp_slotmap *sm);
+int sp_slotmap_printld(const struct sp_slotmap *sm);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_slotmap_printb(const struct sp_slotmap *sm);
+int sp_slotmap_printll(const struct sp_slotmap *sm);
+int sp_slotmap_printull(const struct sp_slotmap *sm);
+int sp_slotmap_printu8(const struct sp_slotmap *sm);
+int sp_slotmap_printu16(const struct sp_slotmap *sm);
+int sp_slotmap_printu32(const struct sp_slotmap *sm);
+int sp_slotmap_printu64(const struct sp_slotmap *sm);
+int sp_slotmap_printi8(const struct sp_slotmap *sm);
+int sp_slotmap_printi16(const struct sp_slotmap *sm);
+int sp_slotmap_printi32(const struct sp_slotmap *sm);
+int sp_slotmap_printi64(const struct sp_slotmap *sm);
+#endif
+
+#endif /* STAPLE_SLOTMAP_H */
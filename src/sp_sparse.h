@@ -0,0 +1,249 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_SPARSE_H
+#define STAPLE_SPARSE_H
+
+/* The sparse module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_matrix.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Storage formats of struct sp_sparse */
+#define SP_SPARSE_CSR 0
+#define SP_SPARSE_CSC 1
+
+struct sp_sparse_coo {
+	void   *vals;
+	size_t *row_idx;
+	size_t *col_idx;
+	size_t  elem_size;
+	size_t  rows;
+	size_t  cols;
+	size_t  size;
+	size_t  capacity;
+};
+
+struct sp_sparse {
+	void   *vals;
+	size_t *idx;
+	size_t *ptr;
+	size_t  elem_size;
+	size_t  rows;
+	size_t  cols;
+	size_t  nnz;
+	int     format;
+};
+
+struct sp_sparse_coo *sp_sparse_coo_create(size_t elem_size, size_t rows, size_t cols, size_t capacity);
+int                   sp_sparse_coo_clear(struct sp_sparse_coo *coo);
+int                   sp_sparse_coo_destroy(struct sp_sparse_coo *coo);
+
+int sp_sparse_coo_push(struct sp_sparse_coo *coo, size_t row, size_t col, const void *val);
+int sp_sparse_coo_pushc(struct sp_sparse_coo *coo, size_t row, size_t col, char val);
+int sp_sparse_coo_pushs(struct sp_sparse_coo *coo, size_t row, size_t col, short val);
+int sp_sparse_coo_pushi(struct sp_sparse_coo *coo, size_t row, size_t col, int val);
+int sp_sparse_coo_pushl(struct sp_sparse_coo *coo, size_t row, size_t col, long val);
+int sp_sparse_coo_pushsc(struct sp_sparse_coo *coo, size_t row, size_t col, signed char val);
+int sp_sparse_coo_pushuc(struct sp_sparse_coo *coo, size_t row, size_t col, unsigned char val);
+int sp_sparse_coo_pushus(struct sp_sparse_coo *coo, size_t row, size_t col, unsigned short val);
+int sp_sparse_coo_pushui(struct sp_sparse_coo *coo, size_t row, size_t col, unsigned int val);
+int sp_sparse_coo_pushul(struct sp_sparse_coo *coo, size_t row, size_t col, unsigned long val);
+int sp_sparse_coo_pushf(struct sp_sparse_coo *coo, size_t row, size_t col, float val);
+int sp_sparse_coo_pushd(struct sp_sparse_coo *coo, size_t row, size_t col, double val);
+int sp_sparse_coo_pushld(struct sp_sparse_coo *coo, size_t row, size_t col, long double val);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_sparse_coo_pushb(struct sp_sparse_coo *coo, size_t row, size_t col, _Bool val);
+int sp_sparse_coo_pushll(struct sp_sparse_coo *coo, size_t row, size_t col, long long val);
+int sp_sparse_coo_pushull(struct sp_sparse_coo *coo, size_t row, size_t col, unsigned long long val);
+int sp_sparse_coo_pushu8(struct sp_sparse_coo *coo, size_t row, size_t col, uint8_t val);
+int sp_sparse_coo_pushu16(struct sp_sparse_coo *coo, size_t row, size_t col, uint16_t val);
+int sp_sparse_coo_pushu32(struct sp_sparse_coo *coo, size_t row, size_t col, uint32_t val);
+int sp_sparse_coo_pushu64(struct sp_sparse_coo *coo, size_t row, size_t col, uint64_t val);
+int sp_sparse_coo_pushi8(struct sp_sparse_coo *coo, size_t row, size_t col, int8_t val);
+int sp_sparse_coo_pushi16(struct sp_sparse_coo *coo, size_t row, size_t col, int16_t val);
+int sp_sparse_coo_pushi32(struct sp_sparse_coo *coo, size_t row, size_t col, int32_t val);
+int sp_sparse_coo_pushi64(struct sp_sparse_coo *coo, size_t row, size_t col, int64_t val);
+#endif
+
+struct sp_sparse *sp_sparse_csr(const struct sp_sparse_coo *coo);
+struct sp_sparse *sp_sparse_csc(const struct sp_sparse_coo *coo);
+int               sp_sparse_destroy(struct sp_sparse *sparse);
+
+void  *sp_sparse_get(const struct sp_sparse *sparse, size_t row, size_t col);
+char sp_sparse_getc(const struct sp_sparse *sparse, size_t row, size_t col);
+short sp_sparse_gets(const struct sp_sparse *sparse, size_t row, size_t col);
+int sp_sparse_geti(const struct sp_sparse *sparse, size_t row, size_t col);
+long sp_sparse_getl(const struct sp_sparse *sparse, size_t row, size_t col);
+signed char sp_sparse_getsc(const struct sp_sparse *sparse, size_t row, size_t col);
+unsigned char sp_sparse_getuc(const struct sp_sparse *sparse, size_t row, size_t col);
+unsigned short sp_sparse_getus(const struct sp_sparse *sparse, size_t row, size_t col);
+unsigned int sp_sparse_getui(const struct sp_sparse *sparse, size_t row, size_t col);
+unsigned long sp_sparse_getul(const struct sp_sparse *sparse, size_t row, size_t col);
+float sp_sparse_getf(const struct sp_sparse *sparse, size_t row, size_t col);
+double sp_sparse_getd(const struct sp_sparse *sparse, size_t row, size_t col);
+long double sp_sparse_getld(const struct sp_sparse *sparse, size_t row, size_t col);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool sp_sparse_getb(const struct sp_sparse *sparse, size_t row, size_t col);
+long long sp_sparse_getll(const struct sp_sparse *sparse, size_t row, size_t col);
+unsigned long long sp_sparse_getull(const struct sp_sparse *sparse, size_t row, size_t col);
+uint8_t sp_sparse_getu8(const struct sp_sparse *sparse, size_t row, size_t col);
+uint16_t sp_sparse_getu16(const struct sp_sparse *sparse, size_t row, size_t col);
+uint32_t sp_sparse_getu32(const struct sp_sparse *sparse, size_t row, size_t col);
+uint64_t sp_sparse_getu64(const struct sp_sparse *sparse, size_t row, size_t col);
+int8_t sp_sparse_geti8(const struct sp_sparse *sparse, size_t row, size_t col);
+int16_t sp_sparse_geti16(const struct sp_sparse *sparse, size_t row, size_t col);
+int32_t sp_sparse_geti32(const struct sp_sparse *sparse, size_t row, size_t col);
+int64_t sp_sparse_geti64(const struct sp_sparse *sparse, size_t row, size_t col);
+#endif
+
+int sp_sparse_split(const struct sp_sparse *sparse, size_t nparts, size_t *bounds);
+
+int sp_sparse_mulvc(char *y, const struct sp_sparse *a, const char *x);
+int sp_sparse_mulvs(short *y, const struct sp_sparse *a, const short *x);
+int sp_sparse_mulvi(int *y, const struct sp_sparse *a, const int *x);
+int sp_sparse_mulvl(long *y, const struct sp_sparse *a, const long *x);
+int sp_sparse_mulvsc(signed char *y, const struct sp_sparse *a, const signed char *x);
+int sp_sparse_mulvuc(unsigned char *y, const struct sp_sparse *a, const unsigned char *x);
+int sp_sparse_mulvus(unsigned short *y, const struct sp_sparse *a, const unsigned short *x);
+int sp_sparse_mulvui(unsigned int *y, const struct sp_sparse *a, const unsigned int *x);
+int sp_sparse_mulvul(unsigned long *y, const struct sp_sparse *a, const unsigned long *x);
+int sp_sparse_mulvf(float *y, const struct sp_sparse *a, const float *x);
+int sp_sparse_mulvd(double *y, const struct sp_sparse *a, const double *x);
+int sp_sparse_mulvld(long double *y, const struct sp_sparse *a, const long double *x);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_sparse_mulvb(_Bool *y, const struct sp_sparse *a, const _Bool *x);
+int sp_sparse_mulvll(long long *y, const struct sp_sparse *a, const long long *x);
+int sp_sparse_mulvull(unsigned long long *y, const struct sp_sparse *a, const unsigned long long *x);
+int sp_sparse_mulvu8(uint8_t *y, const struct sp_sparse *a, const uint8_t *x);
+int sp_sparse_mulvu16(uint16_t *y, const struct sp_sparse *a, const uint16_t *x);
+int sp_sparse_mulvu32(uint32_t *y, const struct sp_sparse *a, const uint32_t *x);
+int sp_sparse_mulvu64(uint64_t *y, const struct sp_sparse *a, const uint64_t *x);
+int sp_sparse_mulvi8(int8_t *y, const struct sp_sparse *a, const int8_t *x);
+int sp_sparse_mulvi16(int16_t *y, const struct sp_sparse *a, const int16_t *x);
+int sp_sparse_mulvi32(int32_t *y, const struct sp_sparse *a, const int32_t *x);
+int sp_sparse_mulvi64(int64_t *y, const struct sp_sparse *a, const int64_t *x);
+#endif
+int sp_sparse_mulvrangec(char *y, const struct sp_sparse *a, const char *x, size_t begin, size_t end);
+int sp_sparse_mulvranges(short *y, const struct sp_sparse *a, const short *x, size_t begin, size_t end);
+int sp_sparse_mulvrangei(int *y, const struct sp_sparse *a, const int *x, size_t begin, size_t end);
+int sp_sparse_mulvrangel(long *y, const struct sp_sparse *a, const long *x, size_t begin, size_t end);
+int sp_sparse_mulvrangesc(signed char *y, const struct sp_sparse *a, const signed char *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeuc(unsigned char *y, const struct sp_sparse *a, const unsigned char *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeus(unsigned short *y, const struct sp_sparse *a, const unsigned short *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeui(unsigned int *y, const struct sp_sparse *a, const unsigned int *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeul(unsigned long *y, const struct sp_sparse *a, const unsigned long *x, size_t begin, size_t end);
+int sp_sparse_mulvrangef(float *y, const struct sp_sparse *a, const float *x, size_t begin, size_t end);
+int sp_sparse_mulvranged(double *y, const struct sp_sparse *a, const double *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeld(long double *y, const struct sp_sparse *a, const long double *x, size_t begin, size_t end);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_sparse_mulvrangeb(_Bool *y, const struct sp_sparse *a, const _Bool *x, size_t begin, size_t end);
+int sp_sparse_mulvrangell(long long *y, const struct sp_sparse *a, const long long *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeull(unsigned long long *y, const struct sp_sparse *a, const unsigned long long *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeu8(uint8_t *y, const struct sp_sparse *a, const uint8_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeu16(uint16_t *y, const struct sp_sparse *a, const uint16_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeu32(uint32_t *y, const struct sp_sparse *a, const uint32_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangeu64(uint64_t *y, const struct sp_sparse *a, const uint64_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangei8(int8_t *y, const struct sp_sparse *a, const int8_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangei16(int16_t *y, const struct sp_sparse *a, const int16_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangei32(int32_t *y, const struct sp_sparse *a, const int32_t *x, size_t begin, size_t end);
+int sp_sparse_mulvrangei64(int64_t *y, const struct sp_sparse *a, const int64_t *x, size_t begin, size_t end);
+#endif
+int sp_sparse_mulc(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muls(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muli(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mull(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulsc(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muluc(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulus(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mului(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulul(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulf(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muld(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulld(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_sparse_mulb(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulll(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulull(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulu8(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulu16(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulu32(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_mulu64(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muli8(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muli16(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muli32(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+int sp_sparse_muli64(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b);
+#endif
+int sp_sparse_mulrangec(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulranges(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangei(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangel(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangesc(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeuc(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeus(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeui(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeul(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangef(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulranged(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeld(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_sparse_mulrangeb(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangell(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeull(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeu8(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeu16(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeu32(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangeu64(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangei8(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangei16(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangei32(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+int sp_sparse_mulrangei64(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end);
+#endif
+
+int sp_sparse_print(const struct sp_sparse *sparse, int (*func)(const void*));
+int sp_sparse_printc(const struct sp_sparse *sparse);
+int sp_sparse_prints(const struct sp_sparse *sparse);
+int sp_sparse_printi(const struct sp_sparse *sparse);
+int sp_sparse_printl(const struct sp_sparse *sparse);
+int sp_sparse_printsc(const struct sp_sparse *sparse);
+int sp_sparse_printuc(const struct sp_sparse *sparse);
+int sp_sparse_printus(const struct sp_sparse *sparse);
+int sp_sparse_printui(const struct sp_sparse *sparse);
+int sp_sparse_printul(const struct sp_sparse *sparse);
+int sp_sparse_printf(const struct sp_sparse *sparse);
+int sp_sparse_printd(const struct sp_sparse *sparse);
+int sp_sparse_printld(const struct sp_sparse *sparse);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_sparse_printb(const struct sp_sparse *sparse);
+int sp_sparse_printll(const struct sp_sparse *sparse);
+int sp_sparse_printull(const struct sp_sparse *sparse);
+int sp_sparse_printu8(const struct sp_sparse *sparse);
+int sp_sparse_printu16(const struct sp_sparse *sparse);
+int sp_sparse_printu32(const struct sp_sparse *sparse);
+int sp_sparse_printu64(const struct sp_sparse *sparse);
+int sp_sparse_printi8(const struct sp_sparse *sparse);
+int sp_sparse_printi16(const struct sp_sparse *sparse);
+int sp_sparse_printi32(const struct sp_sparse *sparse);
+int sp_sparse_printi64(const struct sp_sparse *sparse);
+#endif
+
+#endif /* STAPLE_SPARSE_H */
@@ -27,6 +27,8 @@
 #include <stdint.h>
 #endif
 
+struct sp_intern;
+
 struct sp_stack {
 	void  *data;
 	size_t elem_size;
@@ -69,6 +71,7 @@ int sp_stack_pushi64(struct sp_stack *stack, int64_t elem);
 #endif
 int sp_stack_pushstr(struct sp_stack *stack, const char *elem);
 int sp_stack_pushstrn(struct sp_stack *stack, const char *elem, size_t len);
+int sp_stack_pushistr(struct sp_stack *stack, struct sp_intern *pool, const char *elem);
 
 int sp_stack_insert(struct sp_stack *stack, size_t idx, const void *elem);
 int sp_stack_insertc(struct sp_stack *stack, size_t idx, char elem);
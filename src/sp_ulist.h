@@ -0,0 +1,195 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_ULIST_H
+#define STAPLE_ULIST_H
+
+/* The ulist module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+struct sp_ulist_node {
+	struct sp_ulist_node *prev;
+	struct sp_ulist_node *next;
+	size_t count;
+};
+
+struct sp_ulist {
+	struct sp_ulist_node *head;
+	struct sp_ulist_node *tail;
+	size_t elem_size;
+	size_t size;
+	size_t node_cap;
+	size_t nnodes;
+	size_t data_offset;
+	struct sp_ulist_node *spare;
+	struct sp_ulist_node *cursor;
+	size_t cursor_idx;
+};
+
+struct sp_ulist *sp_ulist_create(size_t elem_size, size_t node_cap);
+int              sp_ulist_clear(struct sp_ulist *ulist, int (*dtor)(void*));
+int              sp_ulist_destroy(struct sp_ulist *ulist, int (*dtor)(void*));
+int              sp_ulist_eq(const struct sp_ulist *ulist1, const struct sp_ulist *ulist2, int (*cmp)(const void*, const void*));
+int              sp_ulist_copy(struct sp_ulist *dest, const struct sp_ulist *src, int (*cpy)(void*, const void*));
+int              sp_ulist_map(struct sp_ulist *ulist, int (*func)(void*, size_t));
+
+int sp_ulist_pushfront(struct sp_ulist *ulist, const void *elem);
+int sp_ulist_pushfrontc(struct sp_ulist *ulist, char elem);
+int sp_ulist_pushfronts(struct sp_ulist *ulist, short elem);
+int sp_ulist_pushfronti(struct sp_ulist *ulist, int elem);
+int sp_ulist_pushfrontl(struct sp_ulist *ulist, long elem);
+int sp_ulist_pushfrontsc(struct sp_ulist *ulist, signed char elem);
+int sp_ulist_pushfrontuc(struct sp_ulist *ulist, unsigned char elem);
+int sp_ulist_pushfrontus(struct sp_ulist *ulist, unsigned short elem);
+int sp_ulist_pushfrontui(struct sp_ulist *ulist, unsigned int elem);
+int sp_ulist_pushfrontul(struct sp_ulist *ulist, unsigned long elem);
+int sp_ulist_pushfrontf(struct sp_ulist *ulist, float elem);
+int sp_ulist_pushfrontd(struct sp_ulist *ulist, double elem);
+int sp_ulist_pushfrontld(struct sp_ulist *ulist, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ulist_pushfrontb(struct sp_ulist *ulist, _Bool elem);
+int sp_ulist_pushfrontll(struct sp_ulist *ulist, long long elem);
+int sp_ulist_pushfrontull(struct sp_ulist *ulist, unsigned long long elem);
+int sp_ulist_pushfrontu8(struct sp_ulist *ulist, uint8_t elem);
+int sp_ulist_pushfrontu16(struct sp_ulist *ulist, uint16_t elem);
+int sp_ulist_pushfrontu32(struct sp_ulist *ulist, uint32_t elem);
+int sp_ulist_pushfrontu64(struct sp_ulist *ulist, uint64_t elem);
+int sp_ulist_pushfronti8(struct sp_ulist *ulist, int8_t elem);
+int sp_ulist_pushfronti16(struct sp_ulist *ulist, int16_t elem);
+int sp_ulist_pushfronti32(struct sp_ulist *ulist, int32_t elem);
+int sp_ulist_pushfronti64(struct sp_ulist *ulist, int64_t elem);
+#endif
+
+int sp_ulist_pushback(struct sp_ulist *ulist, const void *elem);
+int sp_ulist_pushbackc(struct sp_ulist *ulist, char elem);
+int sp_ulist_pushbacks(struct sp_ulist *ulist, short elem);
+int sp_ulist_pushbacki(struct sp_ulist *ulist, int elem);
+int sp_ulist_pushbackl(struct sp_ulist *ulist, long elem);
+int sp_ulist_pushbacksc(struct sp_ulist *ulist, signed char elem);
+int sp_ulist_pushbackuc(struct sp_ulist *ulist, unsigned char elem);
+int sp_ulist_pushbackus(struct sp_ulist *ulist, unsigned short elem);
+int sp_ulist_pushbackui(struct sp_ulist *ulist, unsigned int elem);
+int sp_ulist_pushbackul(struct sp_ulist *ulist, unsigned long elem);
+int sp_ulist_pushbackf(struct sp_ulist *ulist, float elem);
+int sp_ulist_pushbackd(struct sp_ulist *ulist, double elem);
+int sp_ulist_pushbackld(struct sp_ulist *ulist, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ulist_pushbackb(struct sp_ulist *ulist, _Bool elem);
+int sp_ulist_pushbackll(struct sp_ulist *ulist, long long elem);
+int sp_ulist_pushbackull(struct sp_ulist *ulist, unsigned long long elem);
+int sp_ulist_pushbacku8(struct sp_ulist *ulist, uint8_t elem);
+int sp_ulist_pushbacku16(struct sp_ulist *ulist, uint16_t elem);
+int sp_ulist_pushbacku32(struct sp_ulist *ulist, uint32_t elem);
+int sp_ulist_pushbacku64(struct sp_ulist *ulist, uint64_t elem);
+int sp_ulist_pushbacki8(struct sp_ulist *ulist, int8_t elem);
+int sp_ulist_pushbacki16(struct sp_ulist *ulist, int16_t elem);
+int sp_ulist_pushbacki32(struct sp_ulist *ulist, int32_t elem);
+int sp_ulist_pushbacki64(struct sp_ulist *ulist, int64_t elem);
+#endif
+
+int sp_ulist_insert(struct sp_ulist *ulist, size_t idx, const void *elem);
+int sp_ulist_insertc(struct sp_ulist *ulist, size_t idx, char elem);
+int sp_ulist_inserts(struct sp_ulist *ulist, size_t idx, short elem);
+int sp_ulist_inserti(struct sp_ulist *ulist, size_t idx, int elem);
+int sp_ulist_insertl(struct sp_ulist *ulist, size_t idx, long elem);
+int sp_ulist_insertsc(struct sp_ulist *ulist, size_t idx, signed char elem);
+int sp_ulist_insertuc(struct sp_ulist *ulist, size_t idx, unsigned char elem);
+int sp_ulist_insertus(struct sp_ulist *ulist, size_t idx, unsigned short elem);
+int sp_ulist_insertui(struct sp_ulist *ulist, size_t idx, unsigned int elem);
+int sp_ulist_insertul(struct sp_ulist *ulist, size_t idx, unsigned long elem);
+int sp_ulist_insertf(struct sp_ulist *ulist, size_t idx, float elem);
+int sp_ulist_insertd(struct sp_ulist *ulist, size_t idx, double elem);
+int sp_ulist_insertld(struct sp_ulist *ulist, size_t idx, long double elem);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ulist_insertb(struct sp_ulist *ulist, size_t idx, _Bool elem);
+int sp_ulist_insertll(struct sp_ulist *ulist, size_t idx, long long elem);
+int sp_ulist_insertull(struct sp_ulist *ulist, size_t idx, unsigned long long elem);
+int sp_ulist_insertu8(struct sp_ulist *ulist, size_t idx, uint8_t elem);
+int sp_ulist_insertu16(struct sp_ulist *ulist, size_t idx, uint16_t elem);
+int sp_ulist_insertu32(struct sp_ulist *ulist, size_t idx, uint32_t elem);
+int sp_ulist_insertu64(struct sp_ulist *ulist, size_t idx, uint64_t elem);
+int sp_ulist_inserti8(struct sp_ulist *ulist, size_t idx, int8_t elem);
+int sp_ulist_inserti16(struct sp_ulist *ulist, size_t idx, int16_t elem);
+int sp_ulist_inserti32(struct sp_ulist *ulist, size_t idx, int32_t elem);
+int sp_ulist_inserti64(struct sp_ulist *ulist, size_t idx, int64_t elem);
+#endif
+
+int sp_ulist_popfront(struct sp_ulist *ulist, int (*dtor)(void*));
+int sp_ulist_popback(struct sp_ulist *ulist, int (*dtor)(void*));
+int sp_ulist_remove(struct sp_ulist *ulist, size_t idx, int (*dtor)(void*));
+
+void  *sp_ulist_get(struct sp_ulist *ulist, size_t idx);
+char sp_ulist_getc(struct sp_ulist *ulist, size_t idx);
+short sp_ulist_gets(struct sp_ulist *ulist, size_t idx);
+int sp_ulist_geti(struct sp_ulist *ulist, size_t idx);
+long sp_ulist_getl(struct sp_ulist *ulist, size_t idx);
+signed char sp_ulist_getsc(struct sp_ulist *ulist, size_t idx);
+unsigned char sp_ulist_getuc(struct sp_ulist *ulist, size_t idx);
+unsigned short sp_ulist_getus(struct sp_ulist *ulist, size_t idx);
+unsigned int sp_ulist_getui(struct sp_ulist *ulist, size_t idx);
+unsigned long sp_ulist_getul(struct sp_ulist *ulist, size_t idx);
+float sp_ulist_getf(struct sp_ulist *ulist, size_t idx);
+double sp_ulist_getd(struct sp_ulist *ulist, size_t idx);
+long double sp_ulist_getld(struct sp_ulist *ulist, size_t idx);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+_Bool sp_ulist_getb(struct sp_ulist *ulist, size_t idx);
+long long sp_ulist_getll(struct sp_ulist *ulist, size_t idx);
+unsigned long long sp_ulist_getull(struct sp_ulist *ulist, size_t idx);
+uint8_t sp_ulist_getu8(struct sp_ulist *ulist, size_t idx);
+uint16_t sp_ulist_getu16(struct sp_ulist *ulist, size_t idx);
+uint32_t sp_ulist_getu32(struct sp_ulist *ulist, size_t idx);
+uint64_t sp_ulist_getu64(struct sp_ulist *ulist, size_t idx);
+int8_t sp_ulist_geti8(struct sp_ulist *ulist, size_t idx);
+int16_t sp_ulist_geti16(struct sp_ulist *ulist, size_t idx);
+int32_t sp_ulist_geti32(struct sp_ulist *ulist, size_t idx);
+int64_t sp_ulist_geti64(struct sp_ulist *ulist, size_t idx);
+#endif
+
+int sp_ulist_print(const struct sp_ulist *ulist, int (*func)(const void*));
+int sp_ulist_printc(const struct sp_ulist *ulist);
+int sp_ulist_prints(const struct sp_ulist *ulist);
+int sp_ulist_printi(const struct sp_ulist *ulist);
+int sp_ulist_printl(const struct sp_ulist *ulist);
+int sp_ulist_printsc(const struct sp_ulist *ulist);
+int sp_ulist_printuc(const struct sp_ulist *ulist);
+int sp_ulist_printus(const struct sp_ulist *ulist);
+int sp_ulist_printui(const struct sp_ulist *ulist);
+int sp_ulist_printul(const struct sp_ulist *ulist);
+int sp_ulist_printf(const struct sp_ulist *ulist);
+int sp_ulist_printd(const struct sp_ulist *ulist);
+int sp_ulist_printld(const struct sp_ulist *ulist);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_ulist_printb(const struct sp_ulist *ulist);
+int sp_ulist_printll(const struct sp_ulist *ulist);
+int sp_ulist_printull(const struct sp_ulist *ulist);
+int sp_ulist_printu8(const struct sp_ulist *ulist);
+int sp_ulist_printu16(const struct sp_ulist *ulist);
+int sp_ulist_printu32(const struct sp_ulist *ulist);
+int sp_ulist_printu64(const struct sp_ulist *ulist);
+int sp_ulist_printi8(const struct sp_ulist *ulist);
+int sp_ulist_printi16(const struct sp_ulist *ulist);
+int sp_ulist_printi32(const struct sp_ulist *ulist);
+int sp_ulist_printi64(const struct sp_ulist *ulist);
+#endif
+
+#endif /* STAPLE_ULIST_H */
@@ -0,0 +1,105 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#ifndef STAPLE_WHEEL_H
+#define STAPLE_WHEEL_H
+
+/* The timer wheel module of the staple library. */
+
+#include <stdlib.h>
+#include "sp_errcodes.h"
+#include "sp_utils.h"
+#include "sp_pool.h"
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
+
+/* Every level of a timer wheel resolves SP_WHEEL_BITS bits of a tick, so the
+ * levels together cover delays of up to SP_WHEEL_MAX ticks */
+#define SP_WHEEL_BITS   8
+#define SP_WHEEL_SLOTS  (1 << SP_WHEEL_BITS)
+#define SP_WHEEL_LEVELS 4
+#define SP_WHEEL_MAX    0xFFFFFFFFUL
+
+struct sp_wheel_link {
+	struct sp_wheel_link *prev;
+	struct sp_wheel_link *next;
+};
+
+struct sp_wheel_node {
+	struct sp_wheel_link link;
+	unsigned long expiry;
+	unsigned long gen;
+};
+
+struct sp_wheel_handle {
+	struct sp_wheel_node *node;
+	unsigned long gen;
+};
+
+struct sp_wheel {
+	struct sp_wheel_link slots[SP_WHEEL_LEVELS * SP_WHEEL_SLOTS];
+	struct sp_wheel_link expired;
+	unsigned long        now;
+	size_t               elem_size;
+	size_t               size;
+	size_t               data_offset;
+	struct sp_pool       pool;
+};
+
+struct sp_wheel *sp_wheel_create(size_t elem_size, size_t capacity);
+int              sp_wheel_clear(struct sp_wheel *wheel, int (*dtor)(void*));
+int              sp_wheel_destroy(struct sp_wheel *wheel, int (*dtor)(void*));
+
+int sp_wheel_schedule(struct sp_wheel *wheel, unsigned long delay, const void *elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulec(struct sp_wheel *wheel, unsigned long delay, char elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedules(struct sp_wheel *wheel, unsigned long delay, short elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulei(struct sp_wheel *wheel, unsigned long delay, int elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulel(struct sp_wheel *wheel, unsigned long delay, long elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulesc(struct sp_wheel *wheel, unsigned long delay, signed char elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleuc(struct sp_wheel *wheel, unsigned long delay, unsigned char elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleus(struct sp_wheel *wheel, unsigned long delay, unsigned short elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleui(struct sp_wheel *wheel, unsigned long delay, unsigned int elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleul(struct sp_wheel *wheel, unsigned long delay, unsigned long elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulef(struct sp_wheel *wheel, unsigned long delay, float elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduled(struct sp_wheel *wheel, unsigned long delay, double elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleld(struct sp_wheel *wheel, unsigned long delay, long double elem, struct sp_wheel_handle *handle);
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+int sp_wheel_scheduleb(struct sp_wheel *wheel, unsigned long delay, _Bool elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulell(struct sp_wheel *wheel, unsigned long delay, long long elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleull(struct sp_wheel *wheel, unsigned long delay, unsigned long long elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleu8(struct sp_wheel *wheel, unsigned long delay, uint8_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleu16(struct sp_wheel *wheel, unsigned long delay, uint16_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleu32(struct sp_wheel *wheel, unsigned long delay, uint32_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_scheduleu64(struct sp_wheel *wheel, unsigned long delay, uint64_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulei8(struct sp_wheel *wheel, unsigned long delay, int8_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulei16(struct sp_wheel *wheel, unsigned long delay, int16_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulei32(struct sp_wheel *wheel, unsigned long delay, int32_t elem, struct sp_wheel_handle *handle);
+int sp_wheel_schedulei64(struct sp_wheel *wheel, unsigned long delay, int64_t elem, struct sp_wheel_handle *handle);
+#endif
+int sp_wheel_reschedule(struct sp_wheel *wheel, struct sp_wheel_handle handle, unsigned long delay);
+
+int sp_wheel_cancel(struct sp_wheel *wheel, struct sp_wheel_handle handle, int (*dtor)(void*));
+
+void         *sp_wheel_get(const struct sp_wheel *wheel, struct sp_wheel_handle handle);
+unsigned long sp_wheel_remaining(const struct sp_wheel *wheel, struct sp_wheel_handle handle);
+
+int sp_wheel_advance(struct sp_wheel *wheel, unsigned long ticks, int (*func)(void*));
+
+int sp_wheel_print(const struct sp_wheel *wheel, int (*func)(const void*));
+
+#endif /* STAPLE_WHEEL_H */
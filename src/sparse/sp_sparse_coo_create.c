@@ -0,0 +1,67 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+
+struct sp_sparse_coo *sp_sparse_coo_create(size_t elem_size, size_t rows, size_t cols, size_t capacity)
+{
+	struct sp_sparse_coo *ret;
+
+#ifdef STAPLE_DEBUG
+	if (elem_size == 0) {
+		error(("elem_size cannot be 0"));
+		return NULL;
+	}
+	if (rows == 0 || cols == 0) {
+		error(("matrix dimensions cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (capacity > SP_SIZE_MAX / MAX(elem_size, sizeof(size_t))) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+	ret->vals    = malloc(capacity * elem_size);
+	ret->row_idx = malloc(capacity * sizeof(size_t));
+	ret->col_idx = malloc(capacity * sizeof(size_t));
+	if (ret->vals == NULL || ret->row_idx == NULL || ret->col_idx == NULL) {
+		error(("malloc"));
+		free(ret->vals);
+		free(ret->row_idx);
+		free(ret->col_idx);
+		free(ret);
+		return NULL;
+	}
+	ret->elem_size = elem_size;
+	ret->rows      = rows;
+	ret->cols      = cols;
+	ret->size      = 0;
+	ret->capacity  = capacity;
+
+	return ret;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_sparse_coo_push(struct sp_sparse_coo *coo, size_t row, size_t col, const void *val)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	if (coo == NULL) {
+		error(("coo is NULL"));
+		return SP_EINVAL;
+	}
+	if (val == NULL) {
+		error(("val is NULL"));
+		return SP_EINVAL;
+	}
+	if (row >= coo->rows || col >= coo->cols) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	if ((err = sp_sparse_coo_fit(coo)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	memcpy((char*)coo->vals + coo->size * coo->elem_size, val, coo->elem_size);
+	coo->row_idx[coo->size] = row;
+	coo->col_idx[coo->size] = col;
+	++coo->size;
+	return 0;
+}
@@ -0,0 +1,47 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_sparse_coo_pushd(struct sp_sparse_coo *coo, size_t row, size_t col, double val)
+{
+	int err;
+#ifdef STAPLE_DEBUG
+	if (coo == NULL) {
+		error(("coo is NULL"));
+		return SP_EINVAL;
+	}
+	if (coo->elem_size != sizeof(val)) {
+		error(("coo->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)coo->elem_size, sizeof(val)));
+		return SP_EILLEGAL;
+	}
+	if (row >= coo->rows || col >= coo->cols) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	if ((err = sp_sparse_coo_fit(coo)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	((double*)coo->vals)[coo->size] = val;
+	coo->row_idx[coo->size] = row;
+	coo->col_idx[coo->size] = col;
+	++coo->size;
+	return 0;
+}
@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+
+void *sp_sparse_get(const struct sp_sparse *sparse, size_t row, size_t col)
+{
+	size_t lo, hi, key;
+#ifdef STAPLE_DEBUG
+	if (sparse == NULL) {
+		error(("sparse is NULL"));
+		return NULL;
+	}
+	if (row >= sparse->rows || col >= sparse->cols) {
+		error(("index out of range"));
+		return NULL;
+	}
+#endif
+	/* Binary search for the first entry at the position among the entries
+	 * of its row (CSR) or column (CSC), which are sorted */
+	lo  = sparse->ptr[sparse->format == SP_SPARSE_CSR ? row : col];
+	hi  = sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1];
+	key = sparse->format == SP_SPARSE_CSR ? col : row;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (sparse->idx[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1] || sparse->idx[lo] != key)
+		return NULL;
+	return (char*)sparse->vals + lo * sparse->elem_size;
+}
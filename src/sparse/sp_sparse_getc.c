@@ -0,0 +1,55 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+
+char sp_sparse_getc(const struct sp_sparse *sparse, size_t row, size_t col)
+{
+	size_t lo, hi, key;
+	char sum = 0;
+#ifdef STAPLE_DEBUG
+	if (sparse == NULL) {
+		error(("sparse is NULL"));
+		return 0;
+	}
+	if (sparse->elem_size != sizeof(char)) {
+		error(("sparse->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)sparse->elem_size, sizeof(char)));
+		return 0;
+	}
+	if (row >= sparse->rows || col >= sparse->cols) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	/* See sp_sparse_get(). Duplicate entries are adjacent, and add up. */
+	lo  = sparse->ptr[sparse->format == SP_SPARSE_CSR ? row : col];
+	hi  = sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1];
+	key = sparse->format == SP_SPARSE_CSR ? col : row;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo) / 2;
+		if (sparse->idx[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	hi = sparse->ptr[(sparse->format == SP_SPARSE_CSR ? row : col) + 1];
+	for (; lo < hi && sparse->idx[lo] == key; lo++)
+		sum += ((char*)sparse->vals)[lo];
+	return sum;
+}
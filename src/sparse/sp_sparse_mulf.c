@@ -0,0 +1,91 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_sparse_mulf(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b)
+{
+	const float *vals;
+	size_t k, i, j, l, q;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (a == NULL) {
+		error(("a is NULL"));
+		return SP_EINVAL;
+	}
+	if (b == NULL) {
+		error(("b is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(float)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(float)));
+		return SP_EILLEGAL;
+	}
+	if (a->elem_size != sizeof(float)) {
+		error(("a->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)a->elem_size, sizeof(float)));
+		return SP_EILLEGAL;
+	}
+	if (b->elem_size != sizeof(float)) {
+		error(("b->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)b->elem_size, sizeof(float)));
+		return SP_EILLEGAL;
+	}
+	if (dest == b) {
+		error(("dest must be different from b"));
+		return SP_EILLEGAL;
+	}
+	if (dest->depth != b->depth || b->rows != a->cols || dest->rows != a->rows || dest->cols != b->cols) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (a->format == SP_SPARSE_CSR)
+		return sp_sparse_mulrangef(dest, a, b, 0, a->rows);
+
+	/* Every entry (i, l) of a CSC matrix adds a multiple of row l of b to
+	 * row i of dest */
+	vals = a->vals;
+	for (k = 0; k < dest->depth; k++) {
+		const size_t bcs = b->cstride, ccs = dest->cstride;
+		for (i = 0; i < dest->rows; i++) {
+			float *const c = (float*)SP_MATRIX_ELEM(dest, k, i, 0);
+			for (j = 0; j < dest->cols; j++)
+				c[j * ccs] = 0;
+		}
+		for (l = 0; l < a->cols; l++) {
+			const float *const br = (float*)SP_MATRIX_ELEM(b, k, l, 0);
+			for (q = a->ptr[l]; q < a->ptr[l + 1]; q++) {
+				const float v = vals[q];
+				float *const c = (float*)SP_MATRIX_ELEM(dest, k, a->idx[q], 0);
+				if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(b))
+					for (j = 0; j < dest->cols; j++)
+						c[j] += v * br[j];
+				else
+					for (j = 0; j < dest->cols; j++)
+						c[j * ccs] += v * br[j * bcs];
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdint.h>
+#include <inttypes.h>
+
+int sp_sparse_mulrangeb(struct sp_matrix *dest, const struct sp_sparse *a, const struct sp_matrix *b, size_t begin, size_t end)
+{
+	const _Bool *vals;
+	size_t k, i, j, q;
+#ifdef STAPLE_DEBUG
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (a == NULL) {
+		error(("a is NULL"));
+		return SP_EINVAL;
+	}
+	if (b == NULL) {
+		error(("b is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != sizeof(_Bool)) {
+		error(("dest->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)dest->elem_size, sizeof(_Bool)));
+		return SP_EILLEGAL;
+	}
+	if (a->elem_size != sizeof(_Bool)) {
+		error(("a->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)a->elem_size, sizeof(_Bool)));
+		return SP_EILLEGAL;
+	}
+	if (b->elem_size != sizeof(_Bool)) {
+		error(("b->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)b->elem_size, sizeof(_Bool)));
+		return SP_EILLEGAL;
+	}
+	if (dest == b) {
+		error(("dest must be different from b"));
+		return SP_EILLEGAL;
+	}
+	if (dest->depth != b->depth || b->rows != a->cols || dest->rows != a->rows || dest->cols != b->cols) {
+		error(("matrix dimensions do not match"));
+		return SP_EILLEGAL;
+	}
+	if (begin > end || end > a->rows) {
+		error(("index out of range"));
+		return SP_EINDEX;
+	}
+#endif
+	if (a->format != SP_SPARSE_CSR) {
+		error(("row ranges require a matrix in the CSR format"));
+		return SP_EILLEGAL;
+	}
+	/* Row i of dest is a combination of the rows of b selected by row i of
+	 * a. The innermost loop runs along rows of b and dest, so that it can be
+	 * vectorized, and every row of dest is only written by its own pass. */
+	vals = a->vals;
+	for (k = 0; k < dest->depth; k++)
+	for (i = begin; i < end; i++) {
+		_Bool *const c = (_Bool*)SP_MATRIX_ELEM(dest, k, i, 0);
+		const size_t bcs = b->cstride, ccs = dest->cstride;
+		for (j = 0; j < dest->cols; j++)
+			c[j * ccs] = 0;
+		for (q = a->ptr[i]; q < a->ptr[i + 1]; q++) {
+			const _Bool v = vals[q];
+			const _Bool *const br = (_Bool*)SP_MATRIX_ELEM(b, k, a->idx[q], 0);
+			if (SP_MATRIX_UNIT_ROWS(dest) && SP_MATRIX_UNIT_ROWS(b))
+				for (j = 0; j < dest->cols; j++)
+					c[j] += v * br[j];
+			else
+				for (j = 0; j < dest->cols; j++)
+					c[j * ccs] += v * br[j * bcs];
+		}
+	}
+	return 0;
+}
+
+#else
+typedef int prevent_empty_translation_unit;
+#endif
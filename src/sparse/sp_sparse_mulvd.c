@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_sparse_mulvd(double *y, const struct sp_sparse *a, const double *x)
+{
+	const double *vals;
+	size_t i, j, q;
+#ifdef STAPLE_DEBUG
+	if (y == NULL) {
+		error(("y is NULL"));
+		return SP_EINVAL;
+	}
+	if (a == NULL) {
+		error(("a is NULL"));
+		return SP_EINVAL;
+	}
+	if (x == NULL) {
+		error(("x is NULL"));
+		return SP_EINVAL;
+	}
+	if (a->elem_size != sizeof(double)) {
+		error(("a->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)a->elem_size, sizeof(double)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (a->format == SP_SPARSE_CSR)
+		return sp_sparse_mulvranged(y, a, x, 0, a->rows);
+
+	/* Every column of a CSC matrix scatters its entries into y */
+	vals = a->vals;
+	for (i = 0; i < a->rows; i++)
+		y[i] = 0;
+	for (j = 0; j < a->cols; j++) {
+		const double xj = x[j];
+		for (q = a->ptr[j]; q < a->ptr[j + 1]; q++)
+			y[a->idx[q]] += vals[q] * xj;
+	}
+	return 0;
+}
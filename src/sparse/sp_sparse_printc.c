@@ -0,0 +1,48 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_sparse_printc(const struct sp_sparse *sparse)
+{
+	size_t m, q;
+#ifdef STAPLE_DEBUG
+	if (sparse == NULL) {
+		error(("sparse is NULL"));
+		return SP_EINVAL;
+	}
+	if (sparse->elem_size != sizeof(char)) {
+		error(("sparse->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)sparse->elem_size, sizeof(char)));
+		return SP_EILLEGAL;
+	}
+#endif
+	printf("sp_sparse_printc()\nrows: "SP_SIZE_FMT", cols: "SP_SIZE_FMT", nnz: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT", format: %s\n",
+		(SP_SIZE_T)sparse->rows, (SP_SIZE_T)sparse->cols, (SP_SIZE_T)sparse->nnz, (SP_SIZE_T)sparse->elem_size,
+		sparse->format == SP_SPARSE_CSR ? "CSR" : "CSC");
+	for (m = 0; m < SP_SPARSE_NMAJOR(sparse); m++)
+	for (q = sparse->ptr[m]; q < sparse->ptr[m + 1]; q++) {
+		const char elem = ((char*)sparse->vals)[q];
+		const size_t row = sparse->format == SP_SPARSE_CSR ? m : sparse->idx[q],
+		             col = sparse->format == SP_SPARSE_CSR ? sparse->idx[q] : m;
+		printf("["SP_SIZE_FMT", "SP_SIZE_FMT"]\t""%hd\t'%c'""\n", (SP_SIZE_T)row, (SP_SIZE_T)col, elem, elem);
+	}
+	return 0;
+}
@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_sparse.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_sparse_split(const struct sp_sparse *sparse, size_t nparts, size_t *bounds)
+{
+	size_t nmajor, p;
+#ifdef STAPLE_DEBUG
+	if (sparse == NULL) {
+		error(("sparse is NULL"));
+		return SP_EINVAL;
+	}
+	if (bounds == NULL) {
+		error(("bounds is NULL"));
+		return SP_EINVAL;
+	}
+	if (nparts == 0) {
+		error(("nparts cannot be 0"));
+		return SP_EILLEGAL;
+	}
+#endif
+	nmajor = SP_SPARSE_NMAJOR(sparse);
+
+	/* Every bound is the first row (or column) at which the number of
+	 * preceding entries reaches its share of the total */
+	bounds[0] = 0;
+	for (p = 1; p < nparts; p++) {
+		const size_t target = sparse->nnz / nparts * p + sparse->nnz % nparts * p / nparts;
+		size_t lo = bounds[p - 1], hi = nmajor;
+		while (lo < hi) {
+			const size_t mid = lo + (hi - lo) / 2;
+			if (sparse->ptr[mid] < target)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		bounds[p] = lo;
+	}
+	bounds[nparts] = nmajor;
+	return 0;
+}
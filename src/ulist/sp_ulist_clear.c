@@ -0,0 +1,56 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ulist.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_ulist_clear(struct sp_ulist *ulist, int (*dtor)(void*))
+{
+	struct sp_ulist_node *node, *next;
+#ifdef STAPLE_DEBUG
+	if (ulist == NULL) {
+		error(("ulist is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (dtor != NULL) {
+		for (node = ulist->head; node != NULL; node = node->next) {
+			size_t i;
+			for (i = 0; i < node->count; i++) {
+				int err;
+				if ((err = dtor(SP_ULIST_ELEM(ulist, node, i)))) {
+					error(("callback function dtor returned %d (non-0)", err));
+					return SP_ECALLBK;
+				}
+			}
+		}
+	}
+	for (node = ulist->head; node != NULL; node = next) {
+		next = node->next;
+		if (ulist->spare == NULL)
+			ulist->spare = node;
+		else
+			free(node);
+	}
+	ulist->head   = NULL;
+	ulist->tail   = NULL;
+	ulist->size   = 0;
+	ulist->nnodes = 0;
+	ulist->cursor = NULL;
+	return 0;
+}
@@ -0,0 +1,58 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ulist.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <string.h>
+
+int sp_ulist_copy(struct sp_ulist *dest, const struct sp_ulist *src, int (*cpy)(void*, const void*))
+{
+	const struct sp_ulist_node *node;
+#ifdef STAPLE_DEBUG
+	if (src == NULL) {
+		error(("src is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest == NULL) {
+		error(("dest is NULL"));
+		return SP_EINVAL;
+	}
+	if (dest->elem_size != src->elem_size) {
+		error(("dest->elem_size does not match src->elem_size"));
+		return SP_EILLEGAL;
+	}
+#endif
+	sp_ulist_clear(dest, NULL);
+	for (node = src->head; node != NULL; node = node->next) {
+		size_t i;
+		for (i = 0; i < node->count; i++) {
+			void *const slot = sp_ulist_slot(dest, dest->size);
+			int err;
+			if (slot == NULL)
+				return SP_ENOMEM;
+			if (cpy == NULL) {
+				memcpy(slot, SP_ULIST_ELEM(src, node, i), src->elem_size);
+			} else if ((err = cpy(slot, SP_ULIST_ELEM(src, node, i)))) {
+				error(("callback function cpy returned %d (non-0)", err));
+				sp_ulist_erase(dest, dest->tail, dest->tail->count - 1, dest->size - dest->tail->count);
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,64 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ulist.h"
+#include "../internal.h"
+
+struct sp_ulist *sp_ulist_create(size_t elem_size, size_t node_cap)
+{
+	struct sp_ulist *ret;
+	size_t align;
+
+#ifdef STAPLE_DEBUG
+	if (elem_size == 0) {
+		error(("elem_size cannot be 0"));
+		return NULL;
+	}
+	if (node_cap == 0) {
+		error(("node_cap cannot be 0"));
+		return NULL;
+	}
+#endif
+	/* Nodes must hold at least 2 elements to be split in half */
+	node_cap = MAX(node_cap, 2);
+	align = SP_ALIGNOF_SIZE(elem_size);
+	if (elem_size > (SP_SIZE_MAX - sizeof(struct sp_ulist_node) - align) / node_cap) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* Each node holds its links and count, followed by an array of up to
+	 * node_cap elements, aligned for any type of their size. */
+	ret->head        = NULL;
+	ret->tail        = NULL;
+	ret->elem_size   = elem_size;
+	ret->size        = 0;
+	ret->node_cap    = node_cap;
+	ret->nnodes      = 0;
+	ret->data_offset = (sizeof(struct sp_ulist_node) + align - 1) / align * align;
+	ret->spare       = NULL;
+	ret->cursor      = NULL;
+	ret->cursor_idx  = 0;
+
+	return ret;
+}
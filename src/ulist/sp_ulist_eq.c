@@ -0,0 +1,56 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ulist.h"
+#include "../internal.h"
+#include <string.h>
+
+int sp_ulist_eq(const struct sp_ulist *ulist1, const struct sp_ulist *ulist2, int (*cmp)(const void*, const void*))
+{
+	const struct sp_ulist_node *p, *q;
+	size_t i, j, n;
+#ifdef STAPLE_DEBUG
+	if (ulist1 == NULL) {
+		error(("ulist1 is NULL"));
+		return 0;
+	}
+	if (ulist2 == NULL) {
+		error(("ulist2 is NULL"));
+		return 0;
+	}
+#endif
+	if (ulist1->elem_size != ulist2->elem_size || ulist1->size != ulist2->size)
+		return 0;
+	p = ulist1->head;
+	q = ulist2->head;
+	for (i = j = n = 0; n < ulist1->size; n++, i++, j++) {
+		const void *a, *b;
+		if (i == p->count) {
+			p = p->next;
+			i = 0;
+		}
+		if (j == q->count) {
+			q = q->next;
+			j = 0;
+		}
+		a = SP_ULIST_ELEM(ulist1, p, i);
+		b = SP_ULIST_ELEM(ulist2, q, j);
+		if (cmp ? cmp(a, b) : memcmp(a, b, ulist1->elem_size))
+			return 0;
+	}
+	return 1;
+}
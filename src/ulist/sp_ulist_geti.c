@@ -0,0 +1,41 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ulist.h"
+#include "../internal.h"
+
+int sp_ulist_geti(struct sp_ulist *ulist, size_t idx)
+{
+	struct sp_ulist_node *node;
+#ifdef STAPLE_DEBUG
+	if (ulist == NULL) {
+		error(("ulist is NULL"));
+		return 0;
+	}
+	if (ulist->elem_size != sizeof(int)) {
+		error(("ulist->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)ulist->elem_size, sizeof(int)));
+		return 0;
+	}
+	if (idx >= ulist->size) {
+		error(("index out of range"));
+		return 0;
+	}
+#endif
+	node = sp_ulist_seek(ulist, &idx);
+	return *(int*)SP_ULIST_ELEM(ulist, node, idx);
+}
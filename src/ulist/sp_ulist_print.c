@@ -0,0 +1,49 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_ulist.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_ulist_print(const struct sp_ulist *ulist, int (*func)(const void*))
+{
+	const struct sp_ulist_node *node;
+	size_t idx = 0;
+#ifdef STAPLE_DEBUG
+	if (ulist == NULL) {
+		error(("ulist is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_ulist_print()\nsize: "SP_SIZE_FMT", nodes: "SP_SIZE_FMT", node_cap: "SP_SIZE_FMT", elem_size: "SP_SIZE_FMT"\n",
+		(SP_SIZE_T)ulist->size, (SP_SIZE_T)ulist->nnodes, (SP_SIZE_T)ulist->node_cap, (SP_SIZE_T)ulist->elem_size);
+	for (node = ulist->head; node != NULL; node = node->next) {
+		size_t i;
+		for (i = 0; i < node->count; i++) {
+			const void *const elem = SP_ULIST_ELEM(ulist, node, i);
+			int err;
+			printf("["SP_SIZE_FMT"]\t", (SP_SIZE_T)idx++);
+			if (func == NULL)
+				printf("%p\n", elem);
+			else if ((err = func(elem))) {
+				error(("callback function func returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
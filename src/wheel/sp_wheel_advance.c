@@ -0,0 +1,83 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_wheel.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_wheel_advance(struct sp_wheel *wheel, unsigned long ticks, int (*func)(void*))
+{
+#ifdef STAPLE_DEBUG
+	if (wheel == NULL) {
+		error(("wheel is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	for (; ticks != 0; --ticks) {
+		const unsigned long tick = wheel->now + 1;
+		struct sp_wheel_link *const slot = &wheel->slots[tick & (SP_WHEEL_SLOTS - 1)];
+		struct sp_wheel_link *const batch = &wheel->expired;
+		int level;
+
+		/* With no timers, every slot is empty and there is nothing to
+		 * cascade, so time can jump ahead */
+		if (wheel->size == 0) {
+			wheel->now += ticks;
+			break;
+		}
+
+		/* A level above the first comes down whenever all the levels below
+		 * it wrap around, lowest first */
+		for (level = 1; level < SP_WHEEL_LEVELS && (tick & ((1UL << (level * SP_WHEEL_BITS)) - 1)) == 0; level++)
+			sp_wheel_cascade(wheel, level);
+		wheel->now = tick;
+		if (slot->next == slot)
+			continue;
+
+		/* The whole slot is moved out at once, so that func can cancel and
+		 * reschedule timers, including those of the same batch */
+		batch->next = slot->next;
+		batch->prev = slot->prev;
+		batch->next->prev = batch;
+		batch->prev->next = batch;
+		slot->next = slot->prev = slot;
+		while (batch->next != batch) {
+			struct sp_wheel_node *const node = (struct sp_wheel_node*)batch->next;
+			int err;
+			/* The timer stops being pending before func is invoked, but its
+			 * node is only recycled afterwards, so the element stays put.
+			 * Like in sp_wheel_release, a wrapped generation retires it. */
+			SP_WHEEL_UNLINK(&node->link);
+			++node->gen;
+			--wheel->size;
+			err = func != NULL ? func(SP_WHEEL_DATA(wheel, node)) : 0;
+			if (node->gen != 0)
+				sp_pool_give(&wheel->pool, node);
+			if (err) {
+				error(("callback function func returned %d (non-0)", err));
+				while (batch->next != batch) {
+					struct sp_wheel_node *const rest = (struct sp_wheel_node*)batch->next;
+					SP_WHEEL_UNLINK(&rest->link);
+					rest->expiry = tick + 1;
+					sp_wheel_place(wheel, rest);
+				}
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
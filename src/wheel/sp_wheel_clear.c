@@ -0,0 +1,53 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_wheel.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_wheel_clear(struct sp_wheel *wheel, int (*dtor)(void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (wheel == NULL) {
+		error(("wheel is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (dtor != NULL) {
+		for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++) {
+			const struct sp_wheel_link *const slot = &wheel->slots[i];
+			struct sp_wheel_link *link;
+			for (link = slot->next; link != slot; link = link->next) {
+				int err;
+				if ((err = dtor(SP_WHEEL_DATA(wheel, link)))) {
+					error(("callback function dtor returned %d (non-0)", err));
+					return SP_ECALLBK;
+				}
+			}
+		}
+	}
+	for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++) {
+		struct sp_wheel_link *const slot = &wheel->slots[i];
+		while (slot->next != slot) {
+			struct sp_wheel_node *const node = (struct sp_wheel_node*)slot->next;
+			SP_WHEEL_UNLINK(&node->link);
+			sp_wheel_release(wheel, node);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_wheel.h"
+#include "../internal.h"
+
+struct sp_wheel *sp_wheel_create(size_t elem_size, size_t capacity)
+{
+	struct sp_wheel *ret;
+	size_t align, i;
+
+#ifdef STAPLE_DEBUG
+	if (elem_size == 0) {
+		error(("elem_size cannot be 0"));
+		return NULL;
+	}
+	if (capacity == 0) {
+		error(("capacity cannot be 0"));
+		return NULL;
+	}
+#endif
+	if (elem_size > SP_SIZE_MAX / 2 - 32) {
+		error(("size_t overflow detected, maximum size exceeded"));
+		return NULL;
+	}
+
+	ret = malloc(sizeof(*ret));
+	if (ret == NULL) {
+		error(("malloc"));
+		return NULL;
+	}
+
+	/* Every slot is the sentinel of a circular list, so that a timer can be
+	 * unlinked without knowing which slot it is in */
+	for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++)
+		ret->slots[i].prev = ret->slots[i].next = &ret->slots[i];
+	ret->expired.prev = ret->expired.next = &ret->expired;
+
+	/* Nodes are laid out like those of sp_list, with the element after the
+	 * header, padded to keep it aligned for any type of its size, and are
+	 * blocks of a pool embedded in the wheel */
+	align = MAX(SP_ALIGNOF_SIZE(elem_size), MAX(sizeof(struct sp_wheel_link*), sizeof(unsigned long)));
+	ret->now         = 0;
+	ret->elem_size   = elem_size;
+	ret->size        = 0;
+	ret->data_offset = (sizeof(struct sp_wheel_node) + SP_ALIGNOF_SIZE(elem_size) - 1) / SP_ALIGNOF_SIZE(elem_size) * SP_ALIGNOF_SIZE(elem_size);
+	if (sp_pool_init(&ret->pool, (ret->data_offset + elem_size + align - 1) / align * align, capacity, NULL, NULL)) {
+		free(ret);
+		return NULL;
+	}
+
+	return ret;
+}
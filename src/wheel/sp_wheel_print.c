@@ -0,0 +1,50 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_wheel.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+#include <stdio.h>
+
+int sp_wheel_print(const struct sp_wheel *wheel, int (*func)(const void*))
+{
+	size_t i;
+#ifdef STAPLE_DEBUG
+	if (wheel == NULL) {
+		error(("wheel is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	printf("sp_wheel_print()\nsize/capacity: "SP_SIZE_FMT"/"SP_SIZE_FMT", now: %lu\n",
+		(SP_SIZE_T)wheel->size, (SP_SIZE_T)wheel->pool.capacity, wheel->now);
+	for (i = 0; i < SP_WHEEL_LEVELS * SP_WHEEL_SLOTS; i++) {
+		const struct sp_wheel_link *const slot = &wheel->slots[i];
+		const struct sp_wheel_link *link;
+		for (link = slot->next; link != slot; link = link->next) {
+			const struct sp_wheel_node *const node = (const struct sp_wheel_node*)link;
+			int err;
+			printf("[%d][%d]\t%lu\t", (int)(i / SP_WHEEL_SLOTS), (int)(i % SP_WHEEL_SLOTS), node->expiry - wheel->now);
+			if (func == NULL)
+				printf("%p\n", (const void*)SP_WHEEL_DATA(wheel, node));
+			else if ((err = func(SP_WHEEL_DATA(wheel, node)))) {
+				error(("callback function func returned %d (non-0)", err));
+				return SP_ECALLBK;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,38 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_wheel.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_wheel_reschedule(struct sp_wheel *wheel, struct sp_wheel_handle handle, unsigned long delay)
+{
+#ifdef STAPLE_DEBUG
+	if (wheel == NULL) {
+		error(("wheel is NULL"));
+		return SP_EINVAL;
+	}
+#endif
+	if (!SP_WHEEL_PENDING(handle))
+		return SP_ENOKEY;
+	if (delay > SP_WHEEL_MAX)
+		return SP_ERANGE;
+	SP_WHEEL_UNLINK(&handle.node->link);
+	handle.node->expiry = wheel->now + (delay == 0 ? 1 : delay);
+	sp_wheel_place(wheel, handle.node);
+	return 0;
+}
@@ -0,0 +1,51 @@
+/*  Staple - A general-purpose data structure library in pure C89.
+ *  Copyright (C) 2021  Randoragon
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation;
+ *  version 2.1 of the License.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+#include "../sp_wheel.h"
+#include "../internal.h"
+#include "../sp_errcodes.h"
+
+int sp_wheel_schedulec(struct sp_wheel *wheel, unsigned long delay, char elem, struct sp_wheel_handle *handle)
+{
+	struct sp_wheel_node *node;
+	void *block;
+	int err, fresh;
+#ifdef STAPLE_DEBUG
+	if (wheel == NULL) {
+		error(("wheel is NULL"));
+		return SP_EINVAL;
+	}
+	if (wheel->elem_size != sizeof(elem)) {
+		error(("wheel->elem_size is incompatible with elem type (%lu != %lu)",
+					(unsigned long)wheel->elem_size, sizeof(elem)));
+		return SP_EILLEGAL;
+	}
+#endif
+	if (delay > SP_WHEEL_MAX)
+		return SP_ERANGE;
+	/* Nodes carved for the first time start at generation 0, while reused
+	 * ones keep theirs, so that their old handles stay stale */
+	fresh = wheel->pool.free == NULL;
+	if ((err = sp_pool_take(&wheel->pool, &block)))
+		return err == 2 ? SP_ERANGE : SP_ENOMEM;
+	node = block;
+	if (fresh)
+		node->gen = 0;
+	*(char*)SP_WHEEL_DATA(wheel, node) = elem;
+	sp_wheel_arm(wheel, node, delay, handle);
+	return 0;
+}
@@ -0,0 +1,217 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_art.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Longest key used by any test */
+#define MAX_KEY 256
+
+#define ART_KEY(ART, LEAF) \
+	((const unsigned char*)(LEAF) + (ART)->val_offset + (ART)->val_size)
+
+/* Returns the child of an inner node for the byte c, or NULL */
+static const void *art_child(const void *node, int c)
+{
+	const struct sp_art_node *const n = node;
+	int i;
+	switch (n->type) {
+	case SP_ART_NODE4:
+		for (i = 0; i < n->count; i++)
+			if (((const struct sp_art_node4*)node)->keys[i] == c)
+				return ((const struct sp_art_node4*)node)->children[i];
+		return NULL;
+	case SP_ART_NODE16:
+		for (i = 0; i < n->count; i++)
+			if (((const struct sp_art_node16*)node)->keys[i] == c)
+				return ((const struct sp_art_node16*)node)->children[i];
+		return NULL;
+	case SP_ART_NODE48:
+		i = ((const struct sp_art_node48*)node)->index[c];
+		return i != 0 ? ((const struct sp_art_node48*)node)->children[i - 1] : NULL;
+	default:
+		ck_assert_int_eq(SP_ART_NODE256, n->type);
+		return ((const struct sp_art_node256*)node)->children[c];
+	}
+}
+
+/* Returns any leaf of a subtree */
+static const struct sp_art_leaf *art_anyleaf(const void *node)
+{
+	const struct sp_art_node *const n = node;
+	int c;
+	if (n->type == SP_ART_LEAF)
+		return node;
+	if (n->term != NULL)
+		return n->term;
+	for (c = 0; art_child(node, c) == NULL; c++)
+		;
+	return art_anyleaf(art_child(node, c));
+}
+
+/* Checks the layout of a subtree reached through the first depth bytes of
+ * path, and that all of its keys start with them. Returns the number of
+ * elements of the subtree. */
+static size_t art_check_node(const struct sp_art *art, const void *node, unsigned char *path, size_t depth)
+{
+	static const int min[] = {0, 1, 4, 13, 38}, max[] = {0, 4, 16, 48, 256};
+	const struct sp_art_node *const n = node;
+	const unsigned char *key;
+	size_t i, ret = 0, count = 0;
+	int c;
+
+	if (n->type == SP_ART_LEAF) {
+		const struct sp_art_leaf *const leaf = node;
+		ck_assert_uint_ge(leaf->len, depth);
+		ck_assert_int_eq(0, memcmp(ART_KEY(art, leaf), path, depth));
+		return 1;
+	}
+	ck_assert_int_ge(n->type, SP_ART_NODE4);
+	ck_assert_int_le(n->type, SP_ART_NODE256);
+	ck_assert_int_ge(n->count, min[n->type]);
+	ck_assert_int_le(n->count, max[n->type]);
+	ck_assert_uint_ge(n->count + (n->term != NULL), 2);
+
+	/* The stored bytes of the path must match the keys below the node */
+	key = ART_KEY(art, art_anyleaf(node));
+	ck_assert_uint_le(depth + n->prefix_len, MAX_KEY);
+	memcpy(path + depth, key + depth, n->prefix_len);
+	ck_assert_int_eq(0, memcmp(n->prefix, path + depth, n->prefix_len < SP_ART_PREFIX ? n->prefix_len : SP_ART_PREFIX));
+	depth += n->prefix_len;
+
+	if (n->term != NULL) {
+		ck_assert_int_eq(SP_ART_LEAF, n->term->type);
+		ck_assert_uint_eq(depth, n->term->len);
+		ret += art_check_node(art, n->term, path, depth);
+	}
+	if (n->type == SP_ART_NODE4 || n->type == SP_ART_NODE16) {
+		const unsigned char *const keys = n->type == SP_ART_NODE4 ?
+			((const struct sp_art_node4*)node)->keys : ((const struct sp_art_node16*)node)->keys;
+		for (i = 1; i < n->count; i++)
+			ck_assert_int_lt(keys[i - 1], keys[i]);
+	}
+	for (c = 0; c < 256; c++) {
+		const void *const child = art_child(node, c);
+		if (child != NULL) {
+			count++;
+			path[depth] = c;
+			ret += art_check_node(art, child, path, depth + 1);
+		}
+	}
+	ck_assert_uint_eq(n->count, count);
+	return ret;
+}
+
+static void art_check(const struct sp_art *art)
+{
+	unsigned char path[MAX_KEY + 1];
+	if (art->root == NULL) {
+		ck_assert_uint_eq(0, art->size);
+		return;
+	}
+	ck_assert_uint_eq(art->size, art_check_node(art, art->root, path, 0));
+}
+
+/* Type of the node at the end of a path, or -1 if there is none */
+static int art_type_at(const struct sp_art *art, const char *key)
+{
+	const void *node = art->root;
+	size_t depth = 0;
+	while (node != NULL && ((const struct sp_art_node*)node)->type != SP_ART_LEAF) {
+		const struct sp_art_node *const n = node;
+		depth += n->prefix_len;
+		if (depth >= strlen(key))
+			return n->type;
+		node = art_child(node, (unsigned char)key[depth++]);
+	}
+	return node == NULL ? -1 : SP_ART_LEAF;
+}
+
+/* Collects keys visited by sp_art_scan(), checking that they are in order */
+static unsigned char scan_last[MAX_KEY];
+static size_t scan_last_len, scan_count;
+
+static int scan_collect(const void *key, size_t len, void *val)
+{
+	(void)val;
+	if (scan_count > 0) {
+		const size_t min = len < scan_last_len ? len : scan_last_len;
+		const int cmp = memcmp(scan_last, key, min);
+		ck_assert(cmp < 0 || (cmp == 0 && scan_last_len < len));
+	}
+	ck_assert_uint_le(len, MAX_KEY);
+	memcpy(scan_last, key, len);
+	scan_last_len = len;
+	scan_count++;
+	return 0;
+}
+
+static void scan_reset(void)
+{
+	scan_last_len = 0;
+	scan_count    = 0;
+}
+
+/* Writes a random string of up to max characters over a small alphabet, so
+ * that many keys are prefixes of others */
+static void random_key(char *buf, size_t max)
+{
+	size_t i, len = IRANGE(0, (int)max);
+	for (i = 0; i < len; i++)
+		buf[i] = "abc"[rand() % 3];
+	buf[len] = '\0';
+}
+
+#include "art/create.c"
+#include "art/insert.c"
+#include "art/remove.c"
+#include "art/prefix.c"
+#include "art/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_insert = tcase_create("insert"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_prefix = tcase_create("prefix"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("art");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(remove);
+	init_and_add(prefix);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
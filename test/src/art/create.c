@@ -0,0 +1,64 @@
+START_TEST(create_ok)
+{
+	struct sp_art *art;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(double)));
+	ck_assert_ptr_null(art->root);
+	ck_assert_uint_eq(sizeof(double), art->val_size);
+	ck_assert_uint_eq(0, art->val_offset % sizeof(double));
+	ck_assert_uint_ge(art->val_offset, sizeof(struct sp_art_leaf));
+	ck_assert_uint_eq(0, art->size);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	ck_assert_uint_eq(0, art->val_size);
+	ck_assert_uint_eq(sizeof(struct sp_art_leaf), art->val_offset);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_art_create(SIZE_MAX));
+	ck_assert_ptr_null(sp_art_create(SIZE_MAX / 2 + 1));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_art *art;
+	struct data d;
+	char key[16];
+	int i;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(struct data)));
+	for (i = 0; i < 100; i++) {
+		sprintf(key, "key%d", i);
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_art_insertstr(art, key, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_art_clear(art, data_dtor_bad));
+	ck_assert_uint_eq(100, art->size);
+	art_check(art);
+	ck_assert_int_eq(0, sp_art_clear(art, data_dtor));
+	art_check(art);
+	ck_assert_ptr_null(art->root);
+	ck_assert_int_eq(0, sp_art_clear(art, data_dtor));
+
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_art_inserti(art, -i, &d));
+	}
+	art_check(art);
+	ck_assert_int_eq(SP_ECALLBK, sp_art_destroy(art, data_dtor_bad));
+	ck_assert_int_eq(0, sp_art_destroy(art, data_dtor));
+	ck_assert_int_eq(SP_EINVAL, sp_art_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_destroy(NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,248 @@
+START_TEST(insert_random)
+{
+	struct sp_art *art;
+	char keys[400][16];
+	size_t distinct = 0;
+	int i, j;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	for (i = 0; i < 400; i++) {
+		random_key(keys[i], 10);
+		ck_assert_int_eq(0, sp_art_insertstr(art, keys[i], &i));
+		if (i % 50 == 0)
+			art_check(art);
+	}
+	art_check(art);
+
+	/* Every key maps to the value of its last insertion */
+	for (i = 0; i < 400; i++) {
+		const int *val = sp_art_getstr(art, keys[i]);
+		for (j = 399; strcmp(keys[i], keys[j]) != 0; j--)
+			;
+		distinct += i == j;
+		ck_assert_ptr_nonnull(val);
+		ck_assert_int_eq(j, *val);
+	}
+	ck_assert_uint_eq(distinct, art->size);
+	ck_assert_ptr_null(sp_art_getstr(art, "abcabcabcabc"));
+	ck_assert_ptr_null(sp_art_get(art, "a\0", 2));
+
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scan(art, NULL, 0, scan_collect));
+	ck_assert_uint_eq(distinct, scan_count);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(insert_overwrite)
+{
+	struct sp_art *art;
+	int v1 = 1, v2 = 2;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "abc", &v1));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "abc", &v2));
+	ck_assert_uint_eq(1, art->size);
+	ck_assert_int_eq(2, *(int*)sp_art_getstr(art, "abc"));
+
+	/* Empty keys and keys ending at inner nodes */
+	ck_assert_int_eq(0, sp_art_insert(art, "", 0, &v1));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "ab", &v1));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "abd", &v1));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "ab", &v2));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "", &v2));
+	ck_assert_uint_eq(4, art->size);
+	art_check(art);
+	ck_assert_int_eq(2, *(int*)sp_art_get(art, "", 0));
+	ck_assert_int_eq(2, *(int*)sp_art_getstr(art, "ab"));
+	ck_assert_int_eq(1, *(int*)sp_art_getstr(art, "abd"));
+	ck_assert_ptr_null(sp_art_getstr(art, "a"));
+	ck_assert_ptr_null(sp_art_getstr(art, "abcd"));
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(insert_long_prefix)
+{
+	struct sp_art *art;
+	char base[64], keys[300][72];
+	int i, j;
+	for (i = 0; i < 63; i++)
+		base[i] = 'a' + i % 7;
+	base[63] = '\0';
+
+	/* Prefixes of a long string, some with a diverging last character, which
+	 * split compressed paths beyond their stored bytes */
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	for (i = 0; i < 300; i++) {
+		const int len = IRANGE(0, 63);
+		memcpy(keys[i], base, len);
+		keys[i][len] = '\0';
+		if (rand() % 2)
+			strcat(keys[i], "z");
+		ck_assert_int_eq(0, sp_art_insertstr(art, keys[i], &i));
+		if (i % 20 == 0)
+			art_check(art);
+	}
+	art_check(art);
+	for (i = 0; i < 300; i++) {
+		const int *val = sp_art_getstr(art, keys[i]);
+		for (j = 299; strcmp(keys[i], keys[j]) != 0; j--)
+			;
+		ck_assert_ptr_nonnull(val);
+		ck_assert_int_eq(j, *val);
+	}
+	base[40] = 'z';
+	base[41] = 'z';
+	base[42] = '\0';
+	ck_assert_ptr_null(sp_art_getstr(art, base));
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(insert_grow)
+{
+	struct sp_art *art;
+	unsigned char key[2], bytes[256];
+	int i;
+	for (i = 0; i < 256; i++)
+		bytes[i] = i;
+	for (i = 255; i > 0; i--) {
+		const int j = IRANGE(0, i);
+		const unsigned char tmp = bytes[i];
+		bytes[i] = bytes[j];
+		bytes[j] = tmp;
+	}
+
+	/* All children of one node, inserted in random order */
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	key[0] = 'k';
+	for (i = 0; i < 256; i++) {
+		key[1] = bytes[i];
+		ck_assert_int_eq(0, sp_art_insert(art, key, 2, &i));
+		if (i >= 1)
+			ck_assert_int_eq(i < 4 ? SP_ART_NODE4 : i < 16 ? SP_ART_NODE16 : i < 48 ? SP_ART_NODE48 : SP_ART_NODE256,
+					art_type_at(art, "k"));
+		art_check(art);
+	}
+	for (i = 0; i < 256; i++) {
+		key[1] = bytes[i];
+		ck_assert_int_eq(i, *(int*)sp_art_get(art, key, 2));
+	}
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scanstr(art, "k", scan_collect));
+	ck_assert_uint_eq(256, scan_count);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+static int scan_last_int, scan_last_double_set;
+static double scan_last_double;
+
+static int scan_int(const void *key, size_t len, void *val)
+{
+	ck_assert_uint_eq(sizeof(int), len);
+	if (scan_count++ > 0)
+		ck_assert_int_lt(scan_last_int, *(int*)val);
+	scan_last_int = *(int*)val;
+	(void)key;
+	return 0;
+}
+
+static int scan_double(const void *key, size_t len, void *val)
+{
+	ck_assert_uint_eq(sizeof(double) + 1, len);
+	if (scan_last_double_set)
+		ck_assert(scan_last_double < *(double*)val);
+	scan_last_double     = *(double*)val;
+	scan_last_double_set = 1;
+	scan_count++;
+	(void)key;
+	return 0;
+}
+
+START_TEST(insert_typed)
+{
+	struct sp_art *art;
+	int i;
+
+	/* Signed keys are visited in ascending order */
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	for (i = 0; i < 500; i++) {
+		const int key = IRANGE(-100000, 100000);
+		ck_assert_int_eq(0, sp_art_inserti(art, key, &key));
+	}
+	for (i = -3; i <= 3; i++)
+		ck_assert_int_eq(0, sp_art_inserti(art, i, &i));
+	art_check(art);
+	for (i = -3; i <= 3; i++)
+		ck_assert_int_eq(i, *(int*)sp_art_geti(art, i));
+	ck_assert_ptr_null(sp_art_getui(art, 0));
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scan(art, NULL, 0, scan_int));
+	ck_assert_uint_eq(art->size, scan_count);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(double)));
+	for (i = 0; i < 500; i++) {
+		const double key = FRANGE(-1e6, 1e6) * (rand() % 2 ? 1e-6 : 1);
+		ck_assert_int_eq(0, sp_art_insertd(art, key, &key));
+	}
+	scan_last_double = 0.0;
+	ck_assert_int_eq(0, sp_art_insertd(art, scan_last_double, &scan_last_double));
+	ck_assert_ptr_nonnull(sp_art_getd(art, -0.0));
+	art_check(art);
+	scan_reset();
+	scan_last_double_set = 0;
+	ck_assert_int_eq(0, sp_art_scan(art, NULL, 0, scan_double));
+	ck_assert_uint_eq(art->size, scan_count);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+
+	/* Keys of other types map to their own values */
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	for (i = -50; i < 50; i++) {
+		ck_assert_int_eq(0, sp_art_insertsc(art, (signed char)i, NULL));
+		ck_assert_int_eq(0, sp_art_insertul(art, (unsigned long)i * 1000, NULL));
+		ck_assert_int_eq(0, sp_art_insertf(art, i / 4.0f, NULL));
+		ck_assert_int_eq(0, sp_art_insertld(art, i / 8.0L, NULL));
+	}
+	for (i = -50; i < 50; i++) {
+		ck_assert_ptr_nonnull(sp_art_getsc(art, (signed char)i));
+		ck_assert_ptr_nonnull(sp_art_getul(art, (unsigned long)i * 1000));
+		ck_assert_ptr_nonnull(sp_art_getf(art, i / 4.0f));
+		ck_assert_ptr_nonnull(sp_art_getld(art, i / 8.0L));
+	}
+	ck_assert_ptr_null(sp_art_getf(art, 0.1f));
+	art_check(art);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_art *art;
+	int val = 0;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	ck_assert_int_eq(SP_EINVAL, sp_art_insert(NULL, "a", 1, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_art_insert(art, NULL, 1, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_art_insert(art, "a", 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_inserti(NULL, 1, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_art_inserti(art, 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_insertstr(art, NULL, &val));
+	ck_assert_int_eq(SP_ERANGE, sp_art_insert(art, "a", SIZE_MAX, &val));
+	ck_assert_ptr_null(sp_art_get(NULL, "a", 1));
+	ck_assert_ptr_null(sp_art_get(art, NULL, 1));
+	ck_assert_ptr_null(sp_art_getstr(art, NULL));
+	ck_assert_uint_eq(0, art->size);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_random);
+	tcase_add_test(tc, insert_overwrite);
+	tcase_add_test(tc, insert_long_prefix);
+	tcase_add_test(tc, insert_grow);
+	tcase_add_test(tc, insert_typed);
+	tcase_add_test(tc, insert_bad_args);
+}
@@ -0,0 +1,234 @@
+START_TEST(longestprefix_paths)
+{
+	struct sp_art *art;
+	int v[4] = {0, 1, 2, 3};
+	size_t match;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	ck_assert_ptr_null(sp_art_longestprefixstr(art, "/usr", &match));
+	ck_assert_uint_eq(0, match);
+	ck_assert_int_eq(0, sp_art_insertstr(art, "/", &v[0]));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "/usr", &v[1]));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "/usr/lib", &v[2]));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "/usr/local/share/applications", &v[3]));
+
+	ck_assert_int_eq(2, *(int*)sp_art_longestprefixstr(art, "/usr/lib/libc.so", &match));
+	ck_assert_uint_eq(8, match);
+	ck_assert_int_eq(2, *(int*)sp_art_longestprefixstr(art, "/usr/lib", &match));
+	ck_assert_uint_eq(8, match);
+	ck_assert_int_eq(1, *(int*)sp_art_longestprefixstr(art, "/usr/local", &match));
+	ck_assert_uint_eq(4, match);
+	ck_assert_int_eq(1, *(int*)sp_art_longestprefixstr(art, "/usr/local/share/applicationz", &match));
+	ck_assert_uint_eq(4, match);
+	ck_assert_int_eq(3, *(int*)sp_art_longestprefixstr(art, "/usr/local/share/applications/x", &match));
+	ck_assert_uint_eq(29, match);
+	ck_assert_int_eq(0, *(int*)sp_art_longestprefixstr(art, "/etc", &match));
+	ck_assert_uint_eq(1, match);
+	ck_assert_int_eq(0, *(int*)sp_art_longestprefixstr(art, "/", NULL));
+	ck_assert_ptr_null(sp_art_longestprefixstr(art, "usr", &match));
+	ck_assert_uint_eq(0, match);
+	ck_assert_ptr_null(sp_art_longestprefixstr(art, "", &match));
+
+	/* The empty key is a prefix of every key */
+	ck_assert_int_eq(0, sp_art_insertstr(art, "", &v[3]));
+	ck_assert_int_eq(3, *(int*)sp_art_longestprefixstr(art, "usr", &match));
+	ck_assert_uint_eq(0, match);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(longestprefix_routes)
+{
+	/* IPv4 routes as prefixes of whole bytes of addresses */
+	static const unsigned char routes[][4] = {
+		{10}, {10, 1}, {10, 1, 2}, {192, 168}, {192, 168, 0, 1},
+	};
+	static const size_t lens[] = {1, 2, 3, 2, 4};
+	static const struct {
+		unsigned char addr[4];
+		int route;
+	} tests[] = {
+		{{10, 0, 0, 1}, 0}, {{10, 1, 0, 1}, 1}, {{10, 1, 2, 3}, 2},
+		{{192, 168, 0, 1}, 4}, {{192, 168, 0, 2}, 3}, {{192, 169, 0, 1}, -1},
+		{{11, 1, 2, 3}, -1},
+	};
+	struct sp_art *art;
+	size_t i, match;
+	int r;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	for (r = 0; r < (int)LEN(routes); r++)
+		ck_assert_int_eq(0, sp_art_insert(art, routes[r], lens[r], &r));
+	art_check(art);
+	for (i = 0; i < LEN(tests); i++) {
+		const int *val = sp_art_longestprefix(art, tests[i].addr, 4, &match);
+		if (tests[i].route < 0) {
+			ck_assert_ptr_null(val);
+		} else {
+			ck_assert_ptr_nonnull(val);
+			ck_assert_int_eq(tests[i].route, *val);
+			ck_assert_uint_eq(lens[tests[i].route], match);
+		}
+	}
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(longestprefix_random)
+{
+	struct sp_art *art;
+	char keys[100][8], query[12];
+	size_t match, best;
+	int i, j, found;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	for (i = 0; i < 100; i++) {
+		random_key(keys[i], 6);
+		ck_assert_int_eq(0, sp_art_insertstr(art, keys[i], &i));
+	}
+	for (i = 0; i < 500; i++) {
+		const int *val;
+		random_key(query, 10);
+		for (j = 0, found = -1, best = 0; j < 100; j++) {
+			const size_t len = strlen(keys[j]);
+			if (strncmp(keys[j], query, len) == 0 && (found < 0 || len >= best)) {
+				found = j;
+				best  = len;
+			}
+		}
+		val = sp_art_longestprefixstr(art, query, &match);
+		if (found < 0) {
+			ck_assert_ptr_null(val);
+		} else {
+			ck_assert_ptr_nonnull(val);
+			ck_assert_int_eq(found, *val);
+			ck_assert_uint_eq(best, match);
+		}
+	}
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(longestprefix_long)
+{
+	struct sp_art *art;
+	char key[64];
+	int v1 = 1, v2 = 2;
+	size_t match;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+	memset(key, 'a', 30);
+	memset(key + 30, 'b', 30);
+	ck_assert_int_eq(0, sp_art_insert(art, key, 30, &v1));
+	ck_assert_int_eq(0, sp_art_insert(art, key, 60, &v2));
+
+	ck_assert_int_eq(2, *(int*)sp_art_longestprefix(art, key, 60, &match));
+	ck_assert_uint_eq(60, match);
+	key[55] = 'c';
+	ck_assert_int_eq(1, *(int*)sp_art_longestprefix(art, key, 60, &match));
+	ck_assert_uint_eq(30, match);
+
+	/* Paths differing beyond their stored bytes */
+	key[20] = 'z';
+	ck_assert_ptr_null(sp_art_longestprefix(art, key, 60, &match));
+	ck_assert_ptr_null(sp_art_get(art, key, 30));
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+static int scan_stop(const void *key, size_t len, void *val)
+{
+	return ++scan_count == 3;
+}
+
+START_TEST(scan_prefix)
+{
+	struct sp_art *art;
+	char keys[300][12], prefix[8];
+	size_t expected;
+	int i, j;
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	for (i = 0; i < 300; i++) {
+		random_key(keys[i], 10);
+		ck_assert_int_eq(0, sp_art_insertstr(art, keys[i], NULL));
+	}
+	for (i = 0; i < 200; i++) {
+		random_key(prefix, i < 100 ? 3 : 7);
+		for (j = 0, expected = 0; j < 300; j++) {
+			int k;
+			for (k = 0; k < j && strcmp(keys[j], keys[k]) != 0; k++)
+				;
+			expected += k == j && strncmp(keys[j], prefix, strlen(prefix)) == 0;
+		}
+		scan_reset();
+		ck_assert_int_eq(0, sp_art_scanstr(art, prefix, scan_collect));
+		ck_assert_uint_eq(expected, scan_count);
+	}
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scanstr(art, "", scan_collect));
+	ck_assert_uint_eq(art->size, scan_count);
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scanstr(art, "d", scan_collect));
+	ck_assert_uint_eq(0, scan_count);
+
+	scan_reset();
+	ck_assert_int_eq(SP_ECALLBK, sp_art_scanstr(art, "", scan_stop));
+	ck_assert_uint_eq(3, scan_count);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(scan_long)
+{
+	struct sp_art *art;
+	char key[64];
+	int i;
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	memset(key, 'x', 40);
+	for (i = 0; i < 10; i++) {
+		key[40] = '0' + i;
+		ck_assert_int_eq(0, sp_art_insert(art, key, 41, NULL));
+	}
+	ck_assert_int_eq(0, sp_art_insert(art, key, 20, NULL));
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scan(art, key, 30, scan_collect));
+	ck_assert_uint_eq(10, scan_count);
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scan(art, key, 20, scan_collect));
+	ck_assert_uint_eq(11, scan_count);
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scan(art, key, 41, scan_collect));
+	ck_assert_uint_eq(1, scan_count);
+
+	/* Prefixes differing beyond the stored bytes of a path */
+	key[25] = 'y';
+	scan_reset();
+	ck_assert_int_eq(0, sp_art_scan(art, key, 30, scan_collect));
+	ck_assert_uint_eq(0, scan_count);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(prefix_bad_args)
+{
+	struct sp_art *art;
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	ck_assert_int_eq(0, sp_art_scanstr(art, "", scan_collect));
+	ck_assert_ptr_null(sp_art_longestprefix(NULL, "a", 1, NULL));
+	ck_assert_ptr_null(sp_art_longestprefix(art, NULL, 1, NULL));
+	ck_assert_ptr_null(sp_art_longestprefixstr(art, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_scan(NULL, "a", 1, scan_collect));
+	ck_assert_int_eq(SP_EINVAL, sp_art_scan(art, NULL, 1, scan_collect));
+	ck_assert_int_eq(SP_EINVAL, sp_art_scan(art, "a", 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_scanstr(art, NULL, scan_collect));
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+void init_prefix(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, longestprefix_paths);
+	tcase_add_test(tc, longestprefix_routes);
+	tcase_add_test(tc, longestprefix_random);
+	tcase_add_test(tc, longestprefix_long);
+	tcase_add_test(tc, scan_prefix);
+	tcase_add_test(tc, scan_long);
+	tcase_add_test(tc, prefix_bad_args);
+}
@@ -0,0 +1,54 @@
+static int kv_print(const void *key, size_t len, void *val)
+{
+	printf("%.*s\t", (int)len, (const char*)key);
+	return data_print(val);
+}
+
+static int kv_print_bad(const void *key, size_t len, void *val)
+{
+	return data_print_bad(val);
+}
+
+START_TEST(print_object)
+{
+	struct sp_art *art;
+	struct data d;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(struct data)));
+	ck_assert_int_eq(0, sp_art_print(art, kv_print_bad));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "first", &d));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "second", &d));
+	ck_assert_int_eq(0, sp_art_print(art, NULL));
+	ck_assert_int_eq(0, sp_art_print(art, kv_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_art_print(art, kv_print_bad));
+	ck_assert_int_eq(0, sp_art_destroy(art, data_dtor));
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	struct sp_art *art;
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	ck_assert_int_eq(0, sp_art_insert(art, "a\0\\\n", 4, NULL));
+	ck_assert_int_eq(0, sp_art_inserti(art, -1, NULL));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "", NULL));
+	ck_assert_int_eq(0, sp_art_print(art, NULL));
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_art_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_print(NULL, kv_print));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
@@ -0,0 +1,189 @@
+START_TEST(remove_random)
+{
+	struct sp_art *art;
+	char keys[200][16];
+	char present[200] = {0};
+	size_t count = 0;
+	int i, j;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(int)));
+
+	/* Distinct keys, half of which are inserted first */
+	for (i = 0; i < 200; i++) {
+		do {
+			random_key(keys[i], 8);
+			for (j = 0; j < i && strcmp(keys[i], keys[j]) != 0; j++)
+				;
+		} while (j < i);
+	}
+	for (i = 0; i < 200; i += 2) {
+		ck_assert_int_eq(0, sp_art_insertstr(art, keys[i], &i));
+		present[i] = 1;
+		count++;
+	}
+	for (i = 0; i < 3000; i++) {
+		const int k = IRANGE(0, 199);
+		if (rand() % 3 == 0) {
+			ck_assert_int_eq(0, sp_art_insertstr(art, keys[k], &k));
+			count += !present[k];
+			present[k] = 1;
+		} else if (rand() % 2) {
+			ck_assert_int_eq(present[k] ? 0 : SP_ENOKEY, sp_art_removestr(art, keys[k], NULL));
+			count -= present[k];
+			present[k] = 0;
+		} else {
+			ck_assert_int_eq(present[k] ? 0 : SP_ENOKEY, sp_art_remove(art, keys[k], strlen(keys[k]), NULL));
+			count -= present[k];
+			present[k] = 0;
+		}
+		ck_assert_uint_eq(count, art->size);
+		if (i % 100 == 0)
+			art_check(art);
+	}
+	art_check(art);
+	for (i = 0; i < 200; i++) {
+		const int *val = sp_art_getstr(art, keys[i]);
+		ck_assert_int_eq(present[i], val != NULL);
+		if (val != NULL)
+			ck_assert_int_eq(i, *val);
+	}
+	for (i = 0; i < 200; i++)
+		if (present[i])
+			ck_assert_int_eq(0, sp_art_removestr(art, keys[i], NULL));
+	ck_assert_ptr_null(art->root);
+	ck_assert_uint_eq(0, art->size);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(remove_shrink)
+{
+	struct sp_art *art;
+	unsigned char key[2];
+	int i, type;
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	key[0] = 'k';
+	for (i = 0; i < 256; i++) {
+		key[1] = i;
+		ck_assert_int_eq(0, sp_art_insert(art, key, 2, NULL));
+	}
+	ck_assert_int_eq(SP_ART_NODE256, art_type_at(art, "k"));
+
+	/* Nodes shrink well below the capacity of the smaller type, and the last
+	 * child replaces its parent */
+	type = SP_ART_NODE256;
+	for (i = 255; i >= 1; i--) {
+		key[1] = (i * 7) % 256;
+		ck_assert_int_eq(0, sp_art_remove(art, key, 2, NULL));
+		if (i == 37)
+			type = SP_ART_NODE48;
+		else if (i == 12)
+			type = SP_ART_NODE16;
+		else if (i == 3)
+			type = SP_ART_NODE4;
+		else if (i == 1)
+			type = SP_ART_LEAF;
+		ck_assert_int_eq(type, art_type_at(art, "k"));
+		art_check(art);
+	}
+	ck_assert_uint_eq(1, art->size);
+	ck_assert_int_eq(SP_ENOKEY, sp_art_remove(art, key, 2, NULL));
+	key[1] = 0;
+	ck_assert_int_eq(0, sp_art_remove(art, key, 2, NULL));
+	ck_assert_ptr_null(art->root);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(remove_merge)
+{
+	struct sp_art *art;
+	const char *a = "aaaaaaaaaaaa1bbbbbbbbbbbb2",
+	           *b = "aaaaaaaaaaaa1bbbbbbbbbbbb3",
+	           *c = "aaaaaaaaaaaa2",
+	           *d = "aaaaaaaaaaaa1bbbbbX";
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	ck_assert_int_eq(0, sp_art_insertstr(art, a, NULL));
+	ck_assert_int_eq(0, sp_art_insertstr(art, b, NULL));
+	ck_assert_int_eq(0, sp_art_insertstr(art, c, NULL));
+	art_check(art);
+
+	/* The inner child takes over the long path of its parent */
+	ck_assert_int_eq(0, sp_art_removestr(art, c, NULL));
+	art_check(art);
+	ck_assert_uint_eq(25, ((struct sp_art_node*)art->root)->prefix_len);
+	ck_assert_ptr_nonnull(sp_art_getstr(art, a));
+	ck_assert_ptr_nonnull(sp_art_getstr(art, b));
+	ck_assert_ptr_null(sp_art_getstr(art, c));
+
+	/* Which is then split beyond its stored bytes */
+	ck_assert_int_eq(0, sp_art_insertstr(art, d, NULL));
+	art_check(art);
+	ck_assert_uint_eq(18, ((struct sp_art_node*)art->root)->prefix_len);
+	ck_assert_ptr_nonnull(sp_art_getstr(art, d));
+
+	/* Removing terminal leaves */
+	ck_assert_int_eq(0, sp_art_insertstr(art, "aaaaaaaaaaaa1bbbbb", NULL));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "aaaaaaaaaaaa", NULL));
+	art_check(art);
+	ck_assert_int_eq(0, sp_art_removestr(art, "aaaaaaaaaaaa1bbbbb", NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_art_removestr(art, "aaaaaaaaaaaa1bbbbb", NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_art_removestr(art, "aaaaaaaaaaaa1", NULL));
+	ck_assert_int_eq(0, sp_art_removestr(art, d, NULL));
+	ck_assert_int_eq(0, sp_art_removestr(art, a, NULL));
+	art_check(art);
+	ck_assert_int_eq(SP_ART_NODE4, art_type_at(art, "aaaaaaaaaaaa"));
+	ck_assert_int_eq(0, sp_art_removestr(art, "aaaaaaaaaaaa", NULL));
+	art_check(art);
+	ck_assert_int_eq(SP_ART_LEAF, ((struct sp_art_node*)art->root)->type);
+	ck_assert_ptr_nonnull(sp_art_getstr(art, b));
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+START_TEST(remove_dtor)
+{
+	struct sp_art *art;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(art = sp_art_create(sizeof(struct data)));
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_art_inserti(art, i, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_art_removei(art, 5, data_dtor_bad));
+	ck_assert_uint_eq(100, art->size);
+	ck_assert_ptr_nonnull(sp_art_geti(art, 5));
+	for (i = 0; i < 50; i++)
+		ck_assert_int_eq(0, sp_art_removei(art, i * 2, data_dtor));
+	ck_assert_uint_eq(50, art->size);
+	art_check(art);
+	ck_assert_int_eq(0, sp_art_destroy(art, data_dtor));
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	struct sp_art *art;
+	ck_assert_ptr_nonnull(art = sp_art_create(0));
+	ck_assert_int_eq(SP_ENOKEY, sp_art_removestr(art, "a", NULL));
+	ck_assert_int_eq(0, sp_art_insertstr(art, "a", NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_art_removestr(art, "b", NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_art_removestr(art, "", NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_remove(NULL, "a", 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_remove(art, NULL, 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_removestr(art, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_art_removei(NULL, 1, NULL));
+	ck_assert_uint_eq(1, art->size);
+	ck_assert_int_eq(0, sp_art_destroy(art, NULL));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_random);
+	tcase_add_test(tc, remove_shrink);
+	tcase_add_test(tc, remove_merge);
+	tcase_add_test(tc, remove_dtor);
+	tcase_add_test(tc, remove_bad_args);
+}
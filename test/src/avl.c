@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_avl.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Ordering for the generic functions */
+static int int_cmp(const void *a, const void *b)
+{
+	const int x = *(const int*)a, y = *(const int*)b;
+	return (x > y) - (x < y);
+}
+
+/* Checks the balance, links and subtree sizes of a subtree with int keys, and
+ * returns its height */
+static int avl_check_node(const struct sp_avl *avl, const struct sp_avl_node *node, const struct sp_avl_node *parent)
+{
+	int lh, rh;
+	size_t size = 1;
+	if (node == NULL)
+		return 0;
+	ck_assert_ptr_eq(parent, node->parent);
+	lh = avl_check_node(avl, node->left, node);
+	rh = avl_check_node(avl, node->right, node);
+	ck_assert_int_le(lh - rh, 1);
+	ck_assert_int_ge(lh - rh, -1);
+	ck_assert_int_eq(node->height, (lh > rh ? lh : rh) + 1);
+	if (node->left != NULL) {
+		ck_assert_int_lt(*(int*)sp_avl_key(avl, node->left), *(int*)sp_avl_key(avl, node));
+		size += node->left->size;
+	}
+	if (node->right != NULL) {
+		ck_assert_int_gt(*(int*)sp_avl_key(avl, node->right), *(int*)sp_avl_key(avl, node));
+		size += node->right->size;
+	}
+	ck_assert_uint_eq(size, node->size);
+	return node->height;
+}
+
+static void avl_check(const struct sp_avl *avl)
+{
+	avl_check_node(avl, avl->root, NULL);
+	ck_assert_uint_eq(avl->root == NULL ? 0 : avl->root->size, avl->size);
+	ck_assert_uint_le(avl->size, avl->pool.capacity);
+}
+
+#include "avl/create.c"
+#include "avl/insert.c"
+#include "avl/build.c"
+#include "avl/order.c"
+#include "avl/remove.c"
+#include "avl/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_insert = tcase_create("insert"),
+	      *tc_build  = tcase_create("build"),
+	      *tc_order  = tcase_create("order"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("avl");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(build);
+	init_and_add(order);
+	init_and_add(remove);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
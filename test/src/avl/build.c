@@ -0,0 +1,76 @@
+START_TEST(build_ok)
+{
+	struct sp_avl *avl;
+	int keys[300], vals[300];
+	size_t n, i;
+	for (i = 0; i < LEN(keys); i++) {
+		keys[i] = 3 * i - 100;
+		vals[i] = i;
+	}
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(int), 1, NULL));
+	for (n = 0; n <= LEN(keys); n += 1 + n / 4) {
+		ck_assert_int_eq(0, sp_avl_buildi(avl, keys, vals, n));
+		ck_assert_uint_eq(n, avl->size);
+		avl_check(avl);
+		for (i = 0; i < n; i++) {
+			const struct sp_avl_node *node = sp_avl_select(avl, i);
+			ck_assert_ptr_eq(node, sp_avl_findi(avl, keys[i]));
+			ck_assert_int_eq(vals[i], *(int*)sp_avl_val(avl, node));
+		}
+		ck_assert_int_eq(0, sp_avl_clear(avl, NULL, NULL));
+	}
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(build_then_insert)
+{
+	struct sp_avl *avl;
+	int keys[100], i;
+	for (i = 0; i < 100; i++)
+		keys[i] = 2 * i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, int_cmp));
+	ck_assert_int_eq(0, sp_avl_build(avl, keys, NULL, 100));
+	ck_assert_uint_ge(avl->pool.capacity, 100);
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_avl_inserti(avl, 2 * i + 1, NULL));
+	avl_check(avl);
+	for (i = 0; i < 200; i++)
+		ck_assert_int_eq(i, *(int*)sp_avl_key(avl, sp_avl_select(avl, i)));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(build_bad_args)
+{
+	struct sp_avl *avl;
+	int keys[] = {1, 2, 2, 3}, vals[4] = {0};
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(int), 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_build(NULL, keys, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_build(avl, NULL, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_build(avl, keys, NULL, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_build(avl, keys, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_buildi(NULL, keys, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_buildi(avl, NULL, vals, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_buildc(avl, (char*)keys, vals, 1));
+
+	/* Keys must be strictly increasing */
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_buildi(avl, keys, vals, 3));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_buildi(avl, keys + 1, vals, 3));
+	ck_assert_uint_eq(0, avl->size);
+
+	/* The tree must be empty */
+	ck_assert_int_eq(0, sp_avl_buildi(avl, keys, vals, 2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_buildi(avl, keys + 2, vals, 2));
+	ck_assert_uint_eq(2, avl->size);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+void init_build(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, build_ok);
+	tcase_add_test(tc, build_then_insert);
+	tcase_add_test(tc, build_bad_args);
+}
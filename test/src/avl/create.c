@@ -0,0 +1,82 @@
+START_TEST(create_ok)
+{
+	struct sp_avl *avl;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(double), 10, int_cmp));
+	ck_assert_ptr_null(avl->root);
+	ck_assert_uint_eq(sizeof(int), avl->key_size);
+	ck_assert_uint_eq(sizeof(double), avl->val_size);
+	ck_assert_uint_eq(0, avl->key_offset % sizeof(int));
+	ck_assert_uint_ge(avl->key_offset, sizeof(struct sp_avl_node));
+	ck_assert_uint_eq(0, avl->val_offset % sizeof(double));
+	ck_assert_uint_ge(avl->val_offset, avl->key_offset + sizeof(int));
+	ck_assert_uint_ge(avl->pool.stride, avl->val_offset + sizeof(double));
+	ck_assert_uint_eq(0, avl->size);
+	ck_assert_uint_eq(10, avl->pool.capacity);
+	ck_assert_ptr_eq(int_cmp, avl->cmp);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+
+	/* Sets store no values */
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(char), 0, 1, NULL));
+	ck_assert_uint_eq(0, avl->val_size);
+	ck_assert_uint_eq(avl->key_offset + 1, avl->val_offset);
+	ck_assert_ptr_null(avl->cmp);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+
+	/* Keys stay aligned in every node, even behind a smaller value */
+	ck_assert_ptr_nonnull(avl = sp_avl_create(16, 1, 2, NULL));
+	ck_assert_uint_eq(0, avl->key_offset % 16);
+	ck_assert_uint_eq(0, avl->pool.stride % 16);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_avl_create(0, 1, 1, NULL));
+	ck_assert_ptr_null(sp_avl_create(1, 1, 0, NULL));
+	ck_assert_ptr_null(sp_avl_create(SIZE_MAX, 1, 1, NULL));
+	ck_assert_ptr_null(sp_avl_create(1, SIZE_MAX, 1, NULL));
+	ck_assert_ptr_null(sp_avl_create(1, 1, SIZE_MAX, NULL));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_avl *avl;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(struct data), 1, NULL));
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_avl_inserti(avl, i, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_avl_clear(avl, NULL, data_dtor_bad));
+	ck_assert_uint_eq(100, avl->size);
+	ck_assert_int_eq(0, sp_avl_clear(avl, NULL, data_dtor));
+	ck_assert_ptr_null(avl->root);
+	ck_assert_uint_eq(0, avl->size);
+	ck_assert_uint_ge(avl->pool.capacity, 100);
+	ck_assert_int_eq(0, sp_avl_clear(avl, NULL, data_dtor));
+
+	/* Cleared nodes are reused without growing the pool */
+	i = avl->pool.capacity;
+	while (avl->size < avl->pool.capacity) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_avl_inserti(avl, -(int)avl->size, &d));
+	}
+	ck_assert_uint_eq(i, avl->pool.capacity);
+	avl_check(avl);
+	ck_assert_int_eq(SP_ECALLBK, sp_avl_destroy(avl, NULL, data_dtor_bad));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, data_dtor));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_clear(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_destroy(NULL, NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,122 @@
+START_TEST(insert_random)
+{
+	struct sp_avl *avl;
+	char seen[1000] = {0};
+	size_t count = 0;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(int), 1, NULL));
+	for (i = 0; i < 500; i++) {
+		const int key = IRANGE(0, 999), val = -key;
+		count += !seen[key];
+		seen[key] = 1;
+		ck_assert_int_eq(0, sp_avl_inserti(avl, key, &val));
+		ck_assert_uint_eq(count, avl->size);
+	}
+	avl_check(avl);
+	for (i = 0; i < 1000; i++) {
+		const struct sp_avl_node *node = sp_avl_findi(avl, i);
+		if (!seen[i]) {
+			ck_assert_ptr_null(node);
+			continue;
+		}
+		ck_assert_ptr_nonnull(node);
+		ck_assert_int_eq(i, *(int*)sp_avl_key(avl, node));
+		ck_assert_int_eq(-i, *(int*)sp_avl_val(avl, node));
+	}
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_sorted)
+{
+	struct sp_avl *avl;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, NULL));
+	for (i = 0; i < 511; i++)
+		ck_assert_int_eq(0, sp_avl_inserti(avl, i, NULL));
+	avl_check(avl);
+	ck_assert_int_le(avl->root->height, 11);
+	for (i = 0; i < 511; i++)
+		ck_assert_int_eq(0, sp_avl_inserti(avl, -i - 1, NULL));
+	avl_check(avl);
+	ck_assert_uint_eq(1022, avl->size);
+	ck_assert_int_le(avl->root->height, 12);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_overwrite)
+{
+	struct sp_avl *avl;
+	double val = 1.5;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(long), sizeof(double), 1, NULL));
+	ck_assert_int_eq(0, sp_avl_insertl(avl, 7, &val));
+	val = 2.5;
+	ck_assert_int_eq(0, sp_avl_insertl(avl, 7, &val));
+	ck_assert_uint_eq(1, avl->size);
+	ck_assert(2.5 == *(double*)sp_avl_val(avl, sp_avl_findl(avl, 7)));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_generic)
+{
+	struct sp_avl *avl;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(struct data), 1, int_cmp));
+	for (i = 0; i < 200; i++) {
+		const int key = (i * 37) % 200;
+		ck_assert_int_eq(0, data_init(&d));
+		d.age = key;
+		ck_assert_int_eq(0, sp_avl_insert(avl, &key, &d));
+	}
+	avl_check(avl);
+	for (i = 0; i < 200; i++) {
+		const struct sp_avl_node *node = sp_avl_find(avl, &i);
+		ck_assert_ptr_nonnull(node);
+		ck_assert_uint_eq(i, ((struct data*)sp_avl_val(avl, node))->age);
+		ck_assert_ptr_eq(node, sp_avl_findi(avl, i));
+	}
+	i = 200;
+	ck_assert_ptr_null(sp_avl_find(avl, &i));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_avl *avl;
+	int key = 1;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(int), 1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_insert(NULL, &key, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_insert(avl, NULL, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_insert(avl, &key, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_insert(avl, &key, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_inserti(NULL, 1, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_inserti(avl, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_insertc(avl, 1, &key));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_insertd(avl, 1, &key));
+	ck_assert_ptr_null(sp_avl_find(NULL, &key));
+	ck_assert_ptr_null(sp_avl_find(avl, NULL));
+	ck_assert_ptr_null(sp_avl_find(avl, &key));
+	ck_assert_ptr_null(sp_avl_findi(NULL, 1));
+	ck_assert_ptr_null(sp_avl_findc(avl, 1));
+	ck_assert_ptr_null(sp_avl_key(NULL, avl->root));
+	ck_assert_ptr_null(sp_avl_key(avl, NULL));
+	ck_assert_ptr_null(sp_avl_val(NULL, avl->root));
+	ck_assert_ptr_null(sp_avl_val(avl, NULL));
+	ck_assert_uint_eq(0, avl->size);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_random);
+	tcase_add_test(tc, insert_sorted);
+	tcase_add_test(tc, insert_overwrite);
+	tcase_add_test(tc, insert_generic);
+	tcase_add_test(tc, insert_bad_args);
+}
@@ -0,0 +1,125 @@
+/* Fills a tree with random distinct even keys and writes them, sorted, to
+ * keys, returning their number */
+static size_t avl_fill(struct sp_avl *avl, int *keys, size_t n)
+{
+	size_t i, count = 0;
+	for (i = 0; i < n; i++)
+		ck_assert_int_eq(0, sp_avl_inserti(avl, 2 * IRANGE(0, (int)n), NULL));
+	for (i = 0; i <= 2 * n; i += 2)
+		if (sp_avl_findi(avl, i) != NULL)
+			keys[count++] = i;
+	ck_assert_uint_eq(count, avl->size);
+	return count;
+}
+
+START_TEST(order_rank_select)
+{
+	struct sp_avl *avl;
+	int keys[301];
+	size_t n, i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, int_cmp));
+	n = avl_fill(avl, keys, 300);
+	for (i = 0; i < n; i++) {
+		const int odd = keys[i] + 1;
+		ck_assert_int_eq(keys[i], *(int*)sp_avl_key(avl, sp_avl_select(avl, i)));
+		ck_assert_uint_eq(i, sp_avl_ranki(avl, keys[i]));
+		ck_assert_uint_eq(i, sp_avl_rank(avl, keys + i));
+		ck_assert_uint_eq(i + 1, sp_avl_ranki(avl, odd));
+		ck_assert_uint_eq(i + 1, sp_avl_rank(avl, &odd));
+	}
+	ck_assert_uint_eq(0, sp_avl_ranki(avl, -1));
+	ck_assert_ptr_null(sp_avl_select(avl, n));
+	ck_assert_ptr_null(sp_avl_select(NULL, 0));
+	ck_assert_uint_eq(0, sp_avl_rank(NULL, keys));
+	ck_assert_uint_eq(0, sp_avl_rank(avl, NULL));
+	ck_assert_uint_eq(0, sp_avl_rankc(avl, 1));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(order_bounds)
+{
+	struct sp_avl *avl;
+	int keys[301];
+	size_t n, i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, int_cmp));
+	n = avl_fill(avl, keys, 300);
+	for (i = 0; i < n; i++) {
+		const int below = keys[i] - 1;
+		ck_assert_ptr_eq(sp_avl_select(avl, i), sp_avl_lowerboundi(avl, keys[i]));
+		ck_assert_ptr_eq(sp_avl_select(avl, i), sp_avl_lowerbound(avl, keys + i));
+		ck_assert_ptr_eq(sp_avl_select(avl, i), sp_avl_lowerboundi(avl, below));
+		ck_assert_ptr_eq(sp_avl_select(avl, i), sp_avl_upperboundi(avl, below));
+		ck_assert_ptr_eq(sp_avl_select(avl, i), sp_avl_upperbound(avl, &below));
+		if (i + 1 < n)
+			ck_assert_ptr_eq(sp_avl_select(avl, i + 1), sp_avl_upperboundi(avl, keys[i]));
+	}
+	ck_assert_ptr_null(sp_avl_lowerboundi(avl, keys[n - 1] + 1));
+	ck_assert_ptr_null(sp_avl_upperboundi(avl, keys[n - 1]));
+	ck_assert_ptr_null(sp_avl_lowerbound(NULL, keys));
+	ck_assert_ptr_null(sp_avl_upperbound(avl, NULL));
+	ck_assert_ptr_null(sp_avl_lowerboundd(avl, 1.0));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(order_iterate)
+{
+	struct sp_avl *avl;
+	const struct sp_avl_node *node;
+	int keys[301];
+	size_t n, i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, NULL));
+	ck_assert_ptr_null(sp_avl_first(avl));
+	ck_assert_ptr_null(sp_avl_last(avl));
+	n = avl_fill(avl, keys, 300);
+	for (i = 0, node = sp_avl_first(avl); node != NULL; node = sp_avl_next(node), i++)
+		ck_assert_int_eq(keys[i], *(int*)sp_avl_key(avl, node));
+	ck_assert_uint_eq(n, i);
+	for (node = sp_avl_last(avl); node != NULL; node = sp_avl_prev(node))
+		ck_assert_int_eq(keys[--i], *(int*)sp_avl_key(avl, node));
+	ck_assert_uint_eq(0, i);
+
+	/* Range iteration over [100, 200) */
+	for (i = sp_avl_ranki(avl, 100), node = sp_avl_lowerboundi(avl, 100);
+			node != NULL && *(int*)sp_avl_key(avl, node) < 200; node = sp_avl_next(node), i++)
+		ck_assert_int_eq(keys[i], *(int*)sp_avl_key(avl, node));
+	ck_assert_uint_eq(sp_avl_ranki(avl, 200), i);
+
+	ck_assert_ptr_null(sp_avl_first(NULL));
+	ck_assert_ptr_null(sp_avl_last(NULL));
+	ck_assert_ptr_null(sp_avl_next(NULL));
+	ck_assert_ptr_null(sp_avl_prev(NULL));
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(order_percentile)
+{
+	struct sp_avl *avl;
+	int i;
+
+	/* A sliding window of the last 100 latencies, made unique by pairing
+	 * them with their sequence numbers */
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(long), 0, 100, NULL));
+	for (i = 0; i < 1000; i++) {
+		if (i >= 100)
+			ck_assert_int_eq(0, sp_avl_removel(avl, (long)((i - 100) % 100) << 16 | (i - 100), NULL));
+		ck_assert_int_eq(0, sp_avl_insertl(avl, (long)(i % 100) << 16 | i, NULL));
+	}
+	ck_assert_uint_eq(100, avl->size);
+	ck_assert_uint_eq(100, avl->pool.capacity);
+	ck_assert_int_eq(50, *(long*)sp_avl_key(avl, sp_avl_select(avl, 50)) >> 16);
+	ck_assert_int_eq(99, *(long*)sp_avl_key(avl, sp_avl_select(avl, 99)) >> 16);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+void init_order(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, order_rank_select);
+	tcase_add_test(tc, order_bounds);
+	tcase_add_test(tc, order_iterate);
+	tcase_add_test(tc, order_percentile);
+}
@@ -0,0 +1,118 @@
+START_TEST(remove_random)
+{
+	struct sp_avl *avl;
+	char present[500] = {0};
+	size_t count = 0, capacity;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(int), 1, int_cmp));
+	for (i = 0; i < 500; i += 2) {
+		ck_assert_int_eq(0, sp_avl_inserti(avl, i, &i));
+		present[i] = 1;
+		count++;
+	}
+	capacity = avl->pool.capacity;
+	for (i = 0; i < 2000; i++) {
+		const int key = IRANGE(0, 499);
+		if (rand() % 2) {
+			ck_assert_int_eq(present[key] ? 0 : SP_ENOKEY, sp_avl_removei(avl, key, NULL));
+			count -= present[key];
+			present[key] = 0;
+		} else if (present[key]) {
+			ck_assert_int_eq(0, sp_avl_remove(avl, &key, NULL, NULL));
+			present[key] = 0;
+			count--;
+		} else {
+			ck_assert_int_eq(SP_ENOKEY, sp_avl_remove(avl, &key, NULL, NULL));
+		}
+		ck_assert_uint_eq(count, avl->size);
+		if (i % 100 == 0)
+			avl_check(avl);
+	}
+	avl_check(avl);
+	for (i = 0; i < 500; i++)
+		ck_assert_int_eq(present[i], sp_avl_findi(avl, i) != NULL);
+
+	/* Removed nodes are reused */
+	for (i = 0; i < 500; i += 2)
+		ck_assert_int_eq(0, sp_avl_inserti(avl, i, &i));
+	ck_assert_uint_eq(capacity, avl->pool.capacity);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_erase)
+{
+	struct sp_avl *avl;
+	struct sp_avl_node *node;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, NULL));
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(0, sp_avl_inserti(avl, i, NULL));
+
+	/* Erase every key divisible by 3, while iterating */
+	for (node = sp_avl_first(avl); node != NULL;) {
+		struct sp_avl_node *const next = sp_avl_next(node);
+		if (*(int*)sp_avl_key(avl, node) % 3 == 0)
+			ck_assert_int_eq(0, sp_avl_erase(avl, node, NULL, NULL));
+		node = next;
+	}
+	avl_check(avl);
+	ck_assert_uint_eq(200, avl->size);
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(i % 3 != 0, sp_avl_findi(avl, i) != NULL);
+	while (avl->root != NULL)
+		ck_assert_int_eq(0, sp_avl_erase(avl, avl->root, NULL, NULL));
+	ck_assert_uint_eq(0, avl->size);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_dtor)
+{
+	struct sp_avl *avl;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), sizeof(struct data), 1, int_cmp));
+	for (i = 0; i < 10; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_avl_inserti(avl, i, &d));
+	}
+	i = 5;
+	ck_assert_int_eq(SP_ECALLBK, sp_avl_remove(avl, &i, NULL, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_avl_removei(avl, 5, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_avl_erase(avl, avl->root, data_dtor_bad, NULL));
+	ck_assert_uint_eq(10, avl->size);
+	ck_assert_int_eq(0, sp_avl_remove(avl, &i, NULL, data_dtor));
+	ck_assert_int_eq(0, sp_avl_removei(avl, 6, data_dtor));
+	ck_assert_int_eq(0, sp_avl_erase(avl, avl->root, NULL, data_dtor));
+	ck_assert_uint_eq(7, avl->size);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	struct sp_avl *avl;
+	int key = 1;
+	ck_assert_ptr_nonnull(avl = sp_avl_create(sizeof(int), 0, 1, NULL));
+	ck_assert_int_eq(0, sp_avl_inserti(avl, key, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_remove(NULL, &key, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_remove(avl, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_remove(avl, &key, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_removei(NULL, key, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_avl_removes(avl, key, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_erase(NULL, avl->root, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_avl_erase(avl, NULL, NULL, NULL));
+	ck_assert_uint_eq(1, avl->size);
+	ck_assert_int_eq(0, sp_avl_destroy(avl, NULL, NULL));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_random);
+	tcase_add_test(tc, remove_erase);
+	tcase_add_test(tc, remove_dtor);
+	tcase_add_test(tc, remove_bad_args);
+}
@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "../../src/sp_bitarray.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Number of bits in a single word of the bitarray */
+#define WORD_BIT (sizeof(unsigned long) * 8)
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Fills both a bitarray and a reference array with the same random bits */
+static void random_bits(struct sp_bitarray *ba, char *ref, size_t n)
+{
+	size_t i;
+	ck_assert_int_eq(0, sp_bitarray_clear(ba));
+	for (i = 0; i < n; i++) {
+		ref[i] = rand() % 3 == 0;
+		ck_assert_int_eq(0, sp_bitarray_push(ba, ref[i]));
+	}
+}
+
+#include "bitarray/create.c"
+#include "bitarray/destroy.c"
+#include "bitarray/eq.c"
+#include "bitarray/push.c"
+#include "bitarray/pop.c"
+#include "bitarray/clear.c"
+#include "bitarray/resize.c"
+#include "bitarray/get.c"
+#include "bitarray/set.c"
+#include "bitarray/fill.c"
+#include "bitarray/and.c"
+#include "bitarray/count.c"
+#include "bitarray/next.c"
+#include "bitarray/copy.c"
+#include "bitarray/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create  = tcase_create("create"),
+	      *tc_destroy = tcase_create("destroy"),
+	      *tc_eq      = tcase_create("eq"),
+	      *tc_push    = tcase_create("push"),
+	      *tc_pop     = tcase_create("pop"),
+	      *tc_clear   = tcase_create("clear"),
+	      *tc_resize  = tcase_create("resize"),
+	      *tc_get     = tcase_create("get"),
+	      *tc_set     = tcase_create("set"),
+	      *tc_fill    = tcase_create("fill"),
+	      *tc_and     = tcase_create("and"),
+	      *tc_count   = tcase_create("count"),
+	      *tc_next    = tcase_create("next"),
+	      *tc_copy    = tcase_create("copy"),
+	      *tc_print   = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("bitarray");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(eq);
+	init_and_add(push);
+	init_and_add(pop);
+	init_and_add(clear);
+	init_and_add(resize);
+	init_and_add(get);
+	init_and_add(set);
+	init_and_add(fill);
+	init_and_add(and);
+	init_and_add(count);
+	init_and_add(next);
+	init_and_add(copy);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,100 @@
+#define setup(X) \
+	struct sp_bitarray *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_bitarray_create(X)); \
+	ck_assert_ptr_nonnull(s2 = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s1)); \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s2));
+
+START_TEST(and_ops)
+{
+	char ref1[3 * 64 + 9], ref2[LEN(ref1)];
+	size_t i;
+	setup(10);
+
+	random_bits(s1, ref1, LEN(ref1));
+	random_bits(s2, ref2, LEN(ref2));
+	ck_assert_int_eq(0, sp_bitarray_and(s1, s2));
+	for (i = 0; i < LEN(ref1); i++)
+		ck_assert_int_eq(ref1[i] && ref2[i], sp_bitarray_get(s1, i));
+
+	random_bits(s1, ref1, LEN(ref1));
+	ck_assert_int_eq(0, sp_bitarray_or(s1, s2));
+	for (i = 0; i < LEN(ref1); i++)
+		ck_assert_int_eq(ref1[i] || ref2[i], sp_bitarray_get(s1, i));
+
+	random_bits(s1, ref1, LEN(ref1));
+	ck_assert_int_eq(0, sp_bitarray_xor(s1, s2));
+	for (i = 0; i < LEN(ref1); i++)
+		ck_assert_int_eq(ref1[i] != ref2[i], sp_bitarray_get(s1, i));
+
+	random_bits(s1, ref1, LEN(ref1));
+	ck_assert_int_eq(0, sp_bitarray_andnot(s1, s2));
+	for (i = 0; i < LEN(ref1); i++)
+		ck_assert_int_eq(ref1[i] && !ref2[i], sp_bitarray_get(s1, i));
+
+	/* src must be left untouched */
+	for (i = 0; i < LEN(ref2); i++)
+		ck_assert_int_eq(ref2[i], sp_bitarray_get(s2, i));
+	teardown();
+}
+END_TEST
+
+START_TEST(and_self)
+{
+	char ref[150];
+	setup(10);
+	random_bits(s1, ref, LEN(ref));
+	ck_assert_int_eq(0, sp_bitarray_copy(s2, s1));
+	ck_assert_int_eq(0, sp_bitarray_and(s1, s1));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	ck_assert_int_eq(0, sp_bitarray_or(s1, s1));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	ck_assert_int_eq(0, sp_bitarray_xor(s1, s1));
+	ck_assert_uint_eq(0, sp_bitarray_count(s1));
+	ck_assert_int_eq(0, sp_bitarray_andnot(s2, s2));
+	ck_assert_uint_eq(0, sp_bitarray_count(s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(and_size_mismatch)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s1, 5));
+	ck_assert_int_eq(0, sp_bitarray_resize(s2, 6));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bitarray_and(s1, s2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bitarray_or(s1, s2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bitarray_xor(s1, s2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bitarray_andnot(s1, s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(and_bad_args)
+{
+	setup(10);
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_and(NULL, s2));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_and(s1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_or(NULL, s2));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_or(s1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_xor(NULL, s2));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_xor(s1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_andnot(NULL, s2));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_andnot(s1, NULL));
+	teardown();
+}
+END_TEST
+
+void init_and(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, and_ops);
+	tcase_add_test(tc, and_self);
+	tcase_add_test(tc, and_size_mismatch);
+	tcase_add_test(tc, and_bad_args);
+}
+
+#undef setup
+#undef teardown
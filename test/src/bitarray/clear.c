@@ -0,0 +1,30 @@
+START_TEST(clear_basic)
+{
+	struct sp_bitarray *s;
+	size_t capacity;
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(10));
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 3 * WORD_BIT));
+	ck_assert_int_eq(0, sp_bitarray_fill(s, 0, s->size, 1));
+	capacity = s->capacity;
+	ck_assert_int_eq(0, sp_bitarray_clear(s));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(capacity, s->capacity);
+	/* Cleared bits must not reappear */
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 3 * WORD_BIT));
+	ck_assert_uint_eq(0, sp_bitarray_count(s));
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+}
+END_TEST
+
+START_TEST(clear_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_clear(NULL));
+}
+END_TEST
+
+void init_clear(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, clear_basic);
+	tcase_add_test(tc, clear_bad_args);
+}
@@ -0,0 +1,71 @@
+#define setup(X) \
+	struct sp_bitarray *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_bitarray_create(X)); \
+	ck_assert_ptr_nonnull(s2 = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s1)); \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s2));
+
+START_TEST(copy_basic)
+{
+	char ref[500];
+	setup(1);
+	random_bits(s1, ref, LEN(ref));
+	ck_assert_int_eq(0, sp_bitarray_copy(s2, s1));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	ck_assert_uint_ge(s2->capacity, s2->size);
+	teardown();
+}
+END_TEST
+
+START_TEST(copy_shrink)
+{
+	char ref[100];
+	setup(1);
+	ck_assert_int_eq(0, sp_bitarray_resize(s2, 5 * WORD_BIT));
+	ck_assert_int_eq(0, sp_bitarray_fill(s2, 0, s2->size, 1));
+	random_bits(s1, ref, LEN(ref));
+	ck_assert_int_eq(0, sp_bitarray_copy(s2, s1));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	ck_assert_uint_eq(sp_bitarray_count(s1), sp_bitarray_count(s2));
+	/* Old bits of dest must not reappear */
+	ck_assert_int_eq(0, sp_bitarray_resize(s1, 5 * WORD_BIT));
+	ck_assert_int_eq(0, sp_bitarray_resize(s2, 5 * WORD_BIT));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(copy_empty)
+{
+	setup(1);
+	ck_assert_int_eq(0, sp_bitarray_push(s2, 1));
+	ck_assert_int_eq(0, sp_bitarray_copy(s2, s1));
+	ck_assert_uint_eq(0, s2->size);
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(copy_bad_args)
+{
+	setup(1);
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_copy(NULL, s2));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_copy(s1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_copy(NULL, NULL));
+	teardown();
+}
+END_TEST
+
+void init_copy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, copy_basic);
+	tcase_add_test(tc, copy_shrink);
+	tcase_add_test(tc, copy_empty);
+	tcase_add_test(tc, copy_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,72 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(count_basic)
+{
+	char ref[1000];
+	size_t i, count = 0;
+	setup(10);
+	ck_assert_uint_eq(0, sp_bitarray_count(s));
+	random_bits(s, ref, LEN(ref));
+	for (i = 0; i < LEN(ref); i++)
+		count += ref[i];
+	ck_assert_uint_eq(count, sp_bitarray_count(s));
+	ck_assert_int_eq(0, sp_bitarray_fill(s, 0, s->size, 1));
+	ck_assert_uint_eq(LEN(ref), sp_bitarray_count(s));
+	teardown();
+}
+END_TEST
+
+START_TEST(count_rank_select)
+{
+	char ref[1000];
+	size_t i, rank = 0;
+	setup(10);
+	random_bits(s, ref, LEN(ref));
+	for (i = 0; i < LEN(ref); i++) {
+		ck_assert_uint_eq(rank, sp_bitarray_rank(s, i));
+		if (ref[i]) {
+			ck_assert_uint_eq(i, sp_bitarray_select(s, rank));
+			++rank;
+		}
+	}
+	ck_assert_uint_eq(rank, sp_bitarray_rank(s, LEN(ref)));
+	ck_assert_uint_eq(s->size, sp_bitarray_select(s, rank));
+	ck_assert_uint_eq(s->size, sp_bitarray_select(s, SIZE_MAX));
+	teardown();
+}
+END_TEST
+
+START_TEST(count_rank_out_of_range)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_uint_eq(1, sp_bitarray_rank(s, 1));
+	ck_assert_uint_eq(0, sp_bitarray_rank(s, 2));
+	teardown();
+}
+END_TEST
+
+START_TEST(count_bad_args)
+{
+	ck_assert_uint_eq(0, sp_bitarray_count(NULL));
+	ck_assert_uint_eq(0, sp_bitarray_rank(NULL, 0));
+	ck_assert_uint_eq(0, sp_bitarray_select(NULL, 0));
+}
+END_TEST
+
+void init_count(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, count_basic);
+	tcase_add_test(tc, count_rank_select);
+	tcase_add_test(tc, count_rank_out_of_range);
+	tcase_add_test(tc, count_bad_args);
+}
+
+#undef setup
+#undef teardown
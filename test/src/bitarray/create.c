@@ -0,0 +1,40 @@
+START_TEST(create_ok)
+{
+	struct sp_bitarray *s;
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(1));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(WORD_BIT, s->capacity);
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(WORD_BIT + 1));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(2 * WORD_BIT, s->capacity);
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(SIZE_MAX / WORD_BIT * WORD_BIT));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(SIZE_MAX / WORD_BIT * WORD_BIT, s->capacity);
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_bitarray_create(SIZE_MAX / WORD_BIT * WORD_BIT + 1));
+	ck_assert_ptr_null(sp_bitarray_create(SIZE_MAX));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_bitarray_create(0));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
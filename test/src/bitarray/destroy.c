@@ -0,0 +1,23 @@
+START_TEST(destroy_ok)
+{
+	struct sp_bitarray *s;
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(30));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 0));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_destroy(NULL));
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_bad_args);
+}
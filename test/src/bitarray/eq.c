@@ -0,0 +1,72 @@
+#define setup(X) \
+	struct sp_bitarray *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_bitarray_create(X)); \
+	ck_assert_ptr_nonnull(s2 = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s1)); \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s2));
+
+START_TEST(eq_basic)
+{
+	size_t i;
+	setup(10);
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	for (i = 0; i < 3 * WORD_BIT; i++) {
+		ck_assert_int_eq(0, sp_bitarray_push(s1, i % 5 == 0));
+		ck_assert_int_eq(0, sp_bitarray_eq(s1, s2));
+		ck_assert_int_eq(0, sp_bitarray_push(s2, i % 5 == 0));
+		ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+		ck_assert_int_eq(1, sp_bitarray_eq(s2, s1));
+	}
+	ck_assert_int_eq(0, sp_bitarray_flip(s1, WORD_BIT + 3));
+	ck_assert_int_eq(0, sp_bitarray_eq(s1, s2));
+	ck_assert_int_eq(0, sp_bitarray_flip(s2, WORD_BIT + 3));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(eq_different_capacity)
+{
+	struct sp_bitarray *s1, *s2;
+	ck_assert_ptr_nonnull(s1 = sp_bitarray_create(1));
+	ck_assert_ptr_nonnull(s2 = sp_bitarray_create(10 * WORD_BIT));
+	ck_assert_int_eq(0, sp_bitarray_push(s1, 1));
+	ck_assert_int_eq(0, sp_bitarray_push(s2, 1));
+	ck_assert_int_eq(1, sp_bitarray_eq(s1, s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(eq_zeros_different_size)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s1, 5));
+	ck_assert_int_eq(0, sp_bitarray_resize(s2, 6));
+	ck_assert_int_eq(0, sp_bitarray_eq(s1, s2));
+	teardown();
+}
+END_TEST
+
+START_TEST(eq_bad_args)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_eq(NULL, s2));
+	ck_assert_int_eq(0, sp_bitarray_eq(s1, NULL));
+	ck_assert_int_eq(0, sp_bitarray_eq(NULL, NULL));
+	teardown();
+}
+END_TEST
+
+void init_eq(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, eq_basic);
+	tcase_add_test(tc, eq_different_capacity);
+	tcase_add_test(tc, eq_zeros_different_size);
+	tcase_add_test(tc, eq_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,76 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(fill_word_boundaries)
+{
+	const size_t size = 4 * WORD_BIT + 5;
+	size_t idx, n, i;
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s, size));
+	for (idx = 0; idx < size; idx += 13) {
+		for (n = 0; idx + n <= size; n += 11) {
+			ck_assert_int_eq(0, sp_bitarray_fill(s, 0, size, 0));
+			ck_assert_int_eq(0, sp_bitarray_fill(s, idx, n, 1));
+			ck_assert_uint_eq(n, sp_bitarray_count(s));
+			for (i = 0; i < size; i++)
+				ck_assert_int_eq(i >= idx && i < idx + n, sp_bitarray_get(s, i));
+
+			ck_assert_int_eq(0, sp_bitarray_fill(s, 0, size, 1));
+			ck_assert_int_eq(0, sp_bitarray_fill(s, idx, n, 0));
+			ck_assert_uint_eq(size - n, sp_bitarray_count(s));
+			for (i = 0; i < size; i++)
+				ck_assert_int_eq(i < idx || i >= idx + n, sp_bitarray_get(s, i));
+		}
+	}
+	teardown();
+}
+END_TEST
+
+START_TEST(fill_whole_words)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 3 * WORD_BIT));
+	ck_assert_int_eq(0, sp_bitarray_fill(s, WORD_BIT, WORD_BIT, 1));
+	ck_assert_uint_eq(WORD_BIT, sp_bitarray_count(s));
+	ck_assert_int_eq(0, sp_bitarray_get(s, WORD_BIT - 1));
+	ck_assert_int_eq(1, sp_bitarray_get(s, WORD_BIT));
+	ck_assert_int_eq(1, sp_bitarray_get(s, 2 * WORD_BIT - 1));
+	ck_assert_int_eq(0, sp_bitarray_get(s, 2 * WORD_BIT));
+	teardown();
+}
+END_TEST
+
+START_TEST(fill_out_of_range)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 10));
+	ck_assert_int_eq(0, sp_bitarray_fill(s, 10, 0, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_fill(s, 11, 0, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_fill(s, 5, 6, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_fill(s, 5, SIZE_MAX, 1));
+	ck_assert_uint_eq(0, sp_bitarray_count(s));
+	teardown();
+}
+END_TEST
+
+START_TEST(fill_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_fill(NULL, 0, 0, 1));
+}
+END_TEST
+
+void init_fill(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, fill_word_boundaries);
+	tcase_add_test(tc, fill_whole_words);
+	tcase_add_test(tc, fill_out_of_range);
+	tcase_add_test(tc, fill_bad_args);
+}
+
+#undef setup
+#undef teardown
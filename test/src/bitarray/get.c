@@ -0,0 +1,47 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(get_basic)
+{
+	char ref[500];
+	size_t i;
+	setup(10);
+	random_bits(s, ref, LEN(ref));
+	for (i = 0; i < LEN(ref); i++)
+		ck_assert_int_eq(ref[i], sp_bitarray_get(s, i));
+	teardown();
+}
+END_TEST
+
+START_TEST(get_out_of_range)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_get(s, 0));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(1, sp_bitarray_get(s, 0));
+	ck_assert_int_eq(0, sp_bitarray_get(s, 1));
+	ck_assert_int_eq(0, sp_bitarray_get(s, SIZE_MAX));
+	teardown();
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	ck_assert_int_eq(0, sp_bitarray_get(NULL, 0));
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_basic);
+	tcase_add_test(tc, get_out_of_range);
+	tcase_add_test(tc, get_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,56 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(next_basic)
+{
+	char ref[1000];
+	size_t i, j;
+	setup(10);
+	random_bits(s, ref, LEN(ref));
+	for (i = 0; i <= LEN(ref); i++) {
+		for (j = i; j < LEN(ref) && !ref[j]; j++)
+			;
+		ck_assert_uint_eq(j, sp_bitarray_next(s, i));
+	}
+	ck_assert_uint_eq(s->size, sp_bitarray_next(s, SIZE_MAX));
+	teardown();
+}
+END_TEST
+
+START_TEST(next_sparse)
+{
+	size_t i, n = 0;
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 10 * WORD_BIT + 1));
+	ck_assert_uint_eq(s->size, sp_bitarray_next(s, 0));
+	ck_assert_int_eq(0, sp_bitarray_set(s, 3 * WORD_BIT + 2, 1));
+	ck_assert_int_eq(0, sp_bitarray_set(s, 10 * WORD_BIT, 1));
+	for (i = sp_bitarray_next(s, 0); i < s->size; i = sp_bitarray_next(s, i + 1))
+		++n;
+	ck_assert_uint_eq(2, n);
+	ck_assert_uint_eq(3 * WORD_BIT + 2, sp_bitarray_next(s, 0));
+	ck_assert_uint_eq(10 * WORD_BIT, sp_bitarray_next(s, 3 * WORD_BIT + 3));
+	teardown();
+}
+END_TEST
+
+START_TEST(next_bad_args)
+{
+	ck_assert_uint_eq(0, sp_bitarray_next(NULL, 0));
+}
+END_TEST
+
+void init_next(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, next_basic);
+	tcase_add_test(tc, next_sparse);
+	tcase_add_test(tc, next_bad_args);
+}
+
+#undef setup
+#undef teardown
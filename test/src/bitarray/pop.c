@@ -0,0 +1,60 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(pop_basic)
+{
+	char ref[300];
+	size_t i;
+	setup(10);
+	random_bits(s, ref, LEN(ref));
+	for (i = LEN(ref); i-- > 0;) {
+		ck_assert_int_eq(ref[i], sp_bitarray_pop(s));
+		ck_assert_uint_eq(i, s->size);
+	}
+	teardown();
+}
+END_TEST
+
+START_TEST(pop_clears_bit)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(1, sp_bitarray_pop(s));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 0));
+	ck_assert_int_eq(0, sp_bitarray_get(s, 1));
+	ck_assert_uint_eq(1, sp_bitarray_count(s));
+	teardown();
+}
+END_TEST
+
+START_TEST(pop_empty)
+{
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_pop(s));
+	ck_assert_uint_eq(0, s->size);
+	teardown();
+}
+END_TEST
+
+START_TEST(pop_bad_args)
+{
+	ck_assert_int_eq(0, sp_bitarray_pop(NULL));
+}
+END_TEST
+
+void init_pop(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pop_basic);
+	tcase_add_test(tc, pop_clears_bit);
+	tcase_add_test(tc, pop_empty);
+	tcase_add_test(tc, pop_bad_args);
+}
+
+#undef setup
+#undef teardown
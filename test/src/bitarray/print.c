@@ -0,0 +1,25 @@
+START_TEST(print_basic)
+{
+	struct sp_bitarray *s;
+	size_t i;
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(10));
+	ck_assert_int_eq(0, sp_bitarray_print(s));
+	for (i = 0; i < 2 * WORD_BIT + 3; i++)
+		ck_assert_int_eq(0, sp_bitarray_push(s, i % 2));
+	ck_assert_int_eq(0, sp_bitarray_print(s));
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_print(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_basic);
+	tcase_add_test(tc, print_bad_args);
+}
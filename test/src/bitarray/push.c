@@ -0,0 +1,65 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(push_basic)
+{
+	size_t i;
+	setup(1);
+	for (i = 0; i < 5 * WORD_BIT + 3; i++) {
+		ck_assert_int_eq(0, sp_bitarray_push(s, i % 3 == 1));
+		ck_assert_uint_eq(i + 1, s->size);
+		ck_assert_uint_ge(s->capacity, s->size);
+		ck_assert_uint_eq(0, s->capacity % WORD_BIT);
+	}
+	for (i = 0; i < s->size; i++)
+		ck_assert_int_eq(i % 3 == 1, sp_bitarray_get(s, i));
+	teardown();
+}
+END_TEST
+
+START_TEST(push_nonzero_is_one)
+{
+	setup(1);
+	ck_assert_int_eq(0, sp_bitarray_push(s, 42));
+	ck_assert_int_eq(0, sp_bitarray_push(s, -1));
+	ck_assert_int_eq(1, sp_bitarray_get(s, 0));
+	ck_assert_int_eq(1, sp_bitarray_get(s, 1));
+	ck_assert_uint_eq(2, sp_bitarray_count(s));
+	teardown();
+}
+END_TEST
+
+START_TEST(push_max_limit)
+{
+	size_t i;
+	setup(1);
+	for (i = 0; i < SIZE_MAX / WORD_BIT * WORD_BIT; i++)
+		ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(SP_ERANGE, sp_bitarray_push(s, 1));
+	ck_assert_uint_eq(SIZE_MAX / WORD_BIT * WORD_BIT, s->size);
+	ck_assert_uint_eq(s->size, sp_bitarray_count(s));
+	teardown();
+}
+END_TEST
+
+START_TEST(push_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_push(NULL, 1));
+}
+END_TEST
+
+void init_push(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, push_basic);
+	tcase_add_test(tc, push_nonzero_is_one);
+	tcase_add_test(tc, push_max_limit);
+	tcase_add_test(tc, push_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,70 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(resize_grow)
+{
+	size_t i;
+	setup(1);
+	ck_assert_int_eq(0, sp_bitarray_push(s, 1));
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 4 * WORD_BIT + 1));
+	ck_assert_uint_eq(4 * WORD_BIT + 1, s->size);
+	ck_assert_uint_ge(s->capacity, s->size);
+	ck_assert_int_eq(1, sp_bitarray_get(s, 0));
+	for (i = 1; i < s->size; i++)
+		ck_assert_int_eq(0, sp_bitarray_get(s, i));
+	teardown();
+}
+END_TEST
+
+START_TEST(resize_shrink)
+{
+	size_t sizes[] = {0, 1, WORD_BIT - 1, WORD_BIT, WORD_BIT + 1, 2 * WORD_BIT + 7};
+	size_t i, j;
+	setup(1);
+	for (i = 0; i < LEN(sizes); i++) {
+		ck_assert_int_eq(0, sp_bitarray_resize(s, 3 * WORD_BIT));
+		ck_assert_int_eq(0, sp_bitarray_fill(s, 0, s->size, 1));
+		ck_assert_int_eq(0, sp_bitarray_resize(s, sizes[i]));
+		ck_assert_uint_eq(sizes[i], sp_bitarray_count(s));
+		/* Growing back must yield zeros past the old size */
+		ck_assert_int_eq(0, sp_bitarray_resize(s, 3 * WORD_BIT));
+		ck_assert_uint_eq(sizes[i], sp_bitarray_count(s));
+		for (j = 0; j < s->size; j++)
+			ck_assert_int_eq(j < sizes[i], sp_bitarray_get(s, j));
+	}
+	teardown();
+}
+END_TEST
+
+START_TEST(resize_max_limit)
+{
+	setup(1);
+	ck_assert_int_eq(0, sp_bitarray_resize(s, SIZE_MAX / WORD_BIT * WORD_BIT));
+	ck_assert_int_eq(SP_ERANGE, sp_bitarray_resize(s, SIZE_MAX / WORD_BIT * WORD_BIT + 1));
+	ck_assert_int_eq(SP_ERANGE, sp_bitarray_resize(s, SIZE_MAX));
+	ck_assert_uint_eq(SIZE_MAX / WORD_BIT * WORD_BIT, s->size);
+	teardown();
+}
+END_TEST
+
+START_TEST(resize_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_resize(NULL, 5));
+}
+END_TEST
+
+void init_resize(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, resize_grow);
+	tcase_add_test(tc, resize_shrink);
+	tcase_add_test(tc, resize_max_limit);
+	tcase_add_test(tc, resize_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,76 @@
+#define setup(X) \
+	struct sp_bitarray *s; \
+	ck_assert_ptr_nonnull(s = sp_bitarray_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_bitarray_destroy(s));
+
+START_TEST(set_basic)
+{
+	size_t i;
+	setup(10);
+	ck_assert_int_eq(0, sp_bitarray_resize(s, 3 * WORD_BIT));
+	for (i = 0; i < s->size; i += 7)
+		ck_assert_int_eq(0, sp_bitarray_set(s, i, 1));
+	for (i = 0; i < s->size; i++)
+		ck_assert_int_eq(i % 7 == 0, sp_bitarray_get(s, i));
+	for (i = 0; i < s->size; i += 14)
+		ck_assert_int_eq(0, sp_bitarray_set(s, i, 0));
+	for (i = 0; i < s->size; i++)
+		ck_assert_int_eq(i % 7 == 0 && i % 14 != 0, sp_bitarray_get(s, i));
+	/* Setting a bit twice changes nothing */
+	ck_assert_int_eq(0, sp_bitarray_set(s, 7, 1));
+	ck_assert_int_eq(1, sp_bitarray_get(s, 7));
+	ck_assert_int_eq(0, sp_bitarray_set(s, 0, 0));
+	ck_assert_int_eq(0, sp_bitarray_get(s, 0));
+	teardown();
+}
+END_TEST
+
+START_TEST(set_flip)
+{
+	char ref[300];
+	size_t i;
+	setup(10);
+	random_bits(s, ref, LEN(ref));
+	for (i = 0; i < LEN(ref); i += 3) {
+		ck_assert_int_eq(0, sp_bitarray_flip(s, i));
+		ref[i] = !ref[i];
+	}
+	for (i = 0; i < LEN(ref); i++)
+		ck_assert_int_eq(ref[i], sp_bitarray_get(s, i));
+	teardown();
+}
+END_TEST
+
+START_TEST(set_out_of_range)
+{
+	setup(10);
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_set(s, 0, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_flip(s, 0));
+	ck_assert_int_eq(0, sp_bitarray_push(s, 0));
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_set(s, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_bitarray_flip(s, 1));
+	ck_assert_uint_eq(0, sp_bitarray_count(s));
+	teardown();
+}
+END_TEST
+
+START_TEST(set_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_set(NULL, 0, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bitarray_flip(NULL, 0));
+}
+END_TEST
+
+void init_set(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, set_basic);
+	tcase_add_test(tc, set_flip);
+	tcase_add_test(tc, set_out_of_range);
+	tcase_add_test(tc, set_bad_args);
+}
+
+#undef setup
+#undef teardown
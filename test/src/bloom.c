@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_bloom.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+#define WORD_BIT (sizeof(unsigned long) * 8)
+
+/* Returns the first word of the bits of a filter */
+#define BLOOM_WORDS(BLOOM) ((BLOOM)->bits->data + (BLOOM)->offset)
+
+/* Checks the layout of a filter, and that no bits outside of it are set */
+static void bloom_check(const struct sp_bloom *bloom)
+{
+	size_t i;
+	ck_assert_ptr_nonnull(bloom->bits);
+	ck_assert_uint_ne(0, bloom->nbits);
+	ck_assert_uint_ne(0, bloom->nhashes);
+	ck_assert_uint_eq(0, bloom->nbits % 64);
+	ck_assert_int_eq(bloom->blocked, !!bloom->blocked);
+	if (bloom->blocked) {
+		ck_assert_uint_eq(0, bloom->nbits % SP_BLOOM_BLOCK);
+		ck_assert_uint_eq(0, (size_t)((char*)BLOOM_WORDS(bloom)) % (SP_BLOOM_BLOCK / 8));
+	}
+	ck_assert_uint_ge(bloom->bits->size, bloom->offset * WORD_BIT + bloom->nbits);
+	for (i = 0; i < bloom->offset; i++)
+		ck_assert_uint_eq(0, bloom->bits->data[i]);
+	for (i = bloom->offset * WORD_BIT + bloom->nbits; i < bloom->bits->size; i++)
+		ck_assert_int_eq(0, (int)(bloom->bits->data[i / WORD_BIT] >> i % WORD_BIT & 1));
+}
+
+#include "bloom/create.c"
+#include "bloom/insert.c"
+#include "bloom/merge.c"
+#include "bloom/serialize.c"
+#include "bloom/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create    = tcase_create("create"),
+	      *tc_insert    = tcase_create("insert"),
+	      *tc_merge     = tcase_create("merge"),
+	      *tc_serialize = tcase_create("serialize"),
+	      *tc_print     = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("bloom");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(merge);
+	init_and_add(serialize);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,87 @@
+START_TEST(create_ok)
+{
+	struct sp_bloom *bloom;
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(1000, 0.01, 0));
+	bloom_check(bloom);
+	ck_assert_uint_ge(bloom->nbits, 9586);
+	ck_assert_uint_lt(bloom->nbits, 9586 + 64);
+	ck_assert_uint_eq(7, bloom->nhashes);
+	ck_assert_uint_eq(0, bloom->size);
+	ck_assert_int_eq(0, bloom->blocked);
+	ck_assert_uint_eq(0, sp_bitarray_count(bloom->bits));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(1000, 0.01, 2));
+	bloom_check(bloom);
+	ck_assert_uint_ge(bloom->nbits, 9586);
+	ck_assert_uint_lt(bloom->nbits, 9586 + SP_BLOOM_BLOCK);
+	ck_assert_uint_eq(7, bloom->nhashes);
+	ck_assert_int_eq(1, bloom->blocked);
+	ck_assert_uint_eq(0, sp_bitarray_count(bloom->bits));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(1, 0.5, 1));
+	bloom_check(bloom);
+	ck_assert_uint_eq(SP_BLOOM_BLOCK, bloom->nbits);
+	ck_assert_uint_eq(1, bloom->nhashes);
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+}
+END_TEST
+
+START_TEST(create_nhashes)
+{
+	static const double fpr[] = {0.9, 0.5, 0.1, 0.01, 0.001, 1e-6};
+	static const size_t nhashes[] = {1, 1, 3, 7, 10, 20};
+	struct sp_bloom *bloom;
+	size_t i;
+	for (i = 0; i < LEN(fpr); i++) {
+		ck_assert_ptr_nonnull(bloom = sp_bloom_create(100, fpr[i], i % 2));
+		bloom_check(bloom);
+		ck_assert_uint_eq(nhashes[i], bloom->nhashes);
+		ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	}
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_bloom_create(0, 0.01, 0));
+	ck_assert_ptr_null(sp_bloom_create(100, 0, 0));
+	ck_assert_ptr_null(sp_bloom_create(100, 1, 1));
+	ck_assert_ptr_null(sp_bloom_create(100, -0.5, 0));
+	ck_assert_ptr_null(sp_bloom_create(100, 1.5, 1));
+	ck_assert_ptr_null(sp_bloom_create(10000, 0.01, 0));
+	ck_assert_ptr_null(sp_bloom_create(SIZE_MAX, 0.5, 1));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_bloom *bloom;
+	int i;
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(100, 0.01, 1));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_bloom_inserti(bloom, i));
+	ck_assert_uint_ne(0, bloom->size);
+	ck_assert_uint_ne(0, sp_bitarray_count(bloom->bits));
+	ck_assert_int_eq(0, sp_bloom_clear(bloom));
+	bloom_check(bloom);
+	ck_assert_uint_eq(0, bloom->size);
+	ck_assert_uint_eq(0, sp_bitarray_count(bloom->bits));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_bloom_containsi(bloom, i));
+	ck_assert_int_eq(0, sp_bloom_clear(bloom));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_clear(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_destroy(NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_nhashes);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,122 @@
+START_TEST(insert_ok)
+{
+	struct sp_bloom *bloom;
+	int blocked, i, elems[1000];
+	for (blocked = 0; blocked <= 1; blocked++) {
+		ck_assert_ptr_nonnull(bloom = sp_bloom_create(1000, 0.01, blocked));
+		for (i = 0; i < (int)LEN(elems); i++) {
+			elems[i] = rand();
+			ck_assert_int_eq(0, sp_bloom_insert(bloom, &elems[i], sizeof(int)));
+			ck_assert_int_eq(1, sp_bloom_contains(bloom, &elems[i], sizeof(int)));
+		}
+		bloom_check(bloom);
+		ck_assert_uint_le(bloom->size, LEN(elems));
+		ck_assert_uint_ge(bloom->size, LEN(elems) - 30);
+
+		/* There are no false negatives */
+		for (i = 0; i < (int)LEN(elems); i++)
+			ck_assert_int_eq(1, sp_bloom_contains(bloom, &elems[i], sizeof(int)));
+		ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	}
+}
+END_TEST
+
+START_TEST(insert_fpr)
+{
+	static const double rates[] = {0.1, 0.01, 0.001};
+	struct sp_bloom *bloom;
+	int blocked, i, fp;
+	size_t j;
+	double fpr;
+	for (j = 0; j < LEN(rates); j++) {
+		for (blocked = 0; blocked <= 1; blocked++) {
+			ck_assert_ptr_nonnull(bloom = sp_bloom_create(1000, rates[j], blocked));
+			ck_assert_double_eq(0, sp_bloom_fpr(bloom));
+			for (i = 0; i < 1000; i++)
+				ck_assert_int_eq(0, sp_bloom_insertl(bloom, 2L * i));
+			ck_assert_uint_ge(bloom->size, 1000 - 1000 * rates[j] * 3);
+
+			/* The rate of false positives stays close to the target
+			 * at capacity, somewhat higher for blocked filters */
+			for (i = 0, fp = 0; i < 100000; i++)
+				fp += sp_bloom_containsl(bloom, 2L * i + 1);
+			ck_assert_double_lt(fp / 100000.0, rates[j] * (blocked ? 2 : 1.5));
+			ck_assert_double_gt(fp / 100000.0, rates[j] / 2);
+
+			fpr = sp_bloom_fpr(bloom);
+			ck_assert_double_lt(fpr, rates[j] * (blocked ? 2 : 1.5));
+			ck_assert_double_gt(fpr, rates[j] / 2);
+			ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+		}
+	}
+}
+END_TEST
+
+START_TEST(insert_types)
+{
+	struct sp_bloom *bloom;
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(100, 0.001, 0));
+
+	ck_assert_int_eq(0, sp_bloom_insertstr(bloom, "apple"));
+	ck_assert_int_eq(1, sp_bloom_containsstr(bloom, "apple"));
+	ck_assert_int_eq(1, sp_bloom_contains(bloom, "apple", 5));
+	ck_assert_int_eq(0, sp_bloom_containsstr(bloom, "apples"));
+	ck_assert_int_eq(0, sp_bloom_containsstr(bloom, "appl"));
+	ck_assert_int_eq(0, sp_bloom_containsstr(bloom, ""));
+	ck_assert_int_eq(0, sp_bloom_insert(bloom, NULL, 0));
+	ck_assert_int_eq(1, sp_bloom_containsstr(bloom, ""));
+
+	/* Equal values are equal elements */
+	ck_assert_int_eq(0, sp_bloom_insertd(bloom, 0.0));
+	ck_assert_int_eq(1, sp_bloom_containsd(bloom, -0.0));
+	ck_assert_int_eq(0, sp_bloom_containsd(bloom, 1.0));
+	ck_assert_int_eq(0, sp_bloom_insertf(bloom, -2.5f));
+	ck_assert_int_eq(1, sp_bloom_containsf(bloom, -2.5f));
+	ck_assert_int_eq(0, sp_bloom_containsf(bloom, 2.5f));
+	ck_assert_int_eq(0, sp_bloom_insertl(bloom, -123456789L));
+	ck_assert_int_eq(1, sp_bloom_containsl(bloom, -123456789L));
+	ck_assert_int_eq(0, sp_bloom_containsl(bloom, 123456789L));
+	ck_assert_int_eq(0, sp_bloom_insertuc(bloom, 200));
+	ck_assert_int_eq(1, sp_bloom_containsuc(bloom, 200));
+	ck_assert_int_eq(0, sp_bloom_containsuc(bloom, 201));
+	ck_assert_int_eq(0, sp_bloom_insertul(bloom, 0xDEADBEEFUL));
+	ck_assert_int_eq(1, sp_bloom_containsul(bloom, 0xDEADBEEFUL));
+	ck_assert_int_eq(0, sp_bloom_containsul(bloom, 0xDEADBEEEUL));
+	ck_assert_uint_eq(7, bloom->size);
+
+	/* Elements already present are not counted twice */
+	ck_assert_int_eq(0, sp_bloom_insertstr(bloom, "apple"));
+	ck_assert_int_eq(0, sp_bloom_insertd(bloom, -0.0));
+	ck_assert_uint_eq(7, bloom->size);
+	bloom_check(bloom);
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_bloom *bloom;
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(100, 0.01, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_insert(NULL, "a", 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_insert(bloom, NULL, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_inserti(NULL, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_insertstr(bloom, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_insertstr(NULL, "a"));
+	ck_assert_uint_eq(0, bloom->size);
+	ck_assert_uint_eq(0, sp_bitarray_count(bloom->bits));
+	ck_assert_int_eq(0, sp_bloom_contains(NULL, "a", 1));
+	ck_assert_int_eq(0, sp_bloom_contains(bloom, NULL, 1));
+	ck_assert_int_eq(0, sp_bloom_containsi(NULL, 1));
+	ck_assert_int_eq(0, sp_bloom_containsstr(bloom, NULL));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_ok);
+	tcase_add_test(tc, insert_fpr);
+	tcase_add_test(tc, insert_types);
+	tcase_add_test(tc, insert_bad_args);
+}
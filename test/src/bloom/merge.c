@@ -0,0 +1,108 @@
+START_TEST(merge_union)
+{
+	struct sp_bloom *a, *b, *all;
+	int blocked, i;
+	for (blocked = 0; blocked <= 1; blocked++) {
+		ck_assert_ptr_nonnull(a   = sp_bloom_create(1000, 0.01, blocked));
+		ck_assert_ptr_nonnull(b   = sp_bloom_create(1000, 0.01, blocked));
+		ck_assert_ptr_nonnull(all = sp_bloom_create(1000, 0.01, blocked));
+		for (i = 0; i < 1000; i++) {
+			ck_assert_int_eq(0, sp_bloom_inserti(i % 2 ? a : b, i));
+			ck_assert_int_eq(0, sp_bloom_inserti(all, i));
+		}
+		ck_assert_int_eq(0, sp_bloom_union(a, b));
+		bloom_check(a);
+		bloom_check(b);
+
+		/* The union is the filter of all elements */
+		ck_assert_int_eq(0, memcmp(BLOOM_WORDS(a), BLOOM_WORDS(all), a->nbits / 8));
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(1, sp_bloom_containsi(a, i));
+		ck_assert_uint_ge(a->size, 900);
+		ck_assert_uint_le(a->size, 1100);
+		ck_assert_uint_ge(b->size, 490);
+		ck_assert_uint_le(b->size, 500);
+
+		/* Merging with itself or an empty filter changes nothing */
+		ck_assert_int_eq(0, sp_bloom_union(a, a));
+		ck_assert_int_eq(0, sp_bloom_clear(b));
+		ck_assert_int_eq(0, sp_bloom_union(a, b));
+		ck_assert_int_eq(0, memcmp(BLOOM_WORDS(a), BLOOM_WORDS(all), a->nbits / 8));
+		ck_assert_int_eq(0, sp_bloom_union(b, a));
+		ck_assert_int_eq(0, memcmp(BLOOM_WORDS(b), BLOOM_WORDS(all), b->nbits / 8));
+		ck_assert_int_eq(0, sp_bloom_destroy(a));
+		ck_assert_int_eq(0, sp_bloom_destroy(b));
+		ck_assert_int_eq(0, sp_bloom_destroy(all));
+	}
+}
+END_TEST
+
+START_TEST(merge_intersect)
+{
+	struct sp_bloom *a, *b;
+	int blocked, i, fp;
+	for (blocked = 0; blocked <= 1; blocked++) {
+		ck_assert_ptr_nonnull(a = sp_bloom_create(1000, 0.01, blocked));
+		ck_assert_ptr_nonnull(b = sp_bloom_create(1000, 0.01, blocked));
+		for (i = 0; i < 600; i++) {
+			ck_assert_int_eq(0, sp_bloom_inserti(a, i));
+			ck_assert_int_eq(0, sp_bloom_inserti(b, 999 - i));
+		}
+		ck_assert_int_eq(0, sp_bloom_intersect(a, b));
+		bloom_check(a);
+
+		/* Common elements are kept, and most others are dropped */
+		for (i = 400; i < 600; i++)
+			ck_assert_int_eq(1, sp_bloom_containsi(a, i));
+		for (i = 0, fp = 0; i < 400; i++)
+			fp += sp_bloom_containsi(a, i) + sp_bloom_containsi(a, 999 - i);
+		ck_assert_int_lt(fp, 80);
+		ck_assert_uint_ge(a->size, 200);
+		ck_assert_uint_lt(a->size, 400);
+
+		ck_assert_int_eq(0, sp_bloom_clear(b));
+		ck_assert_int_eq(0, sp_bloom_intersect(a, b));
+		ck_assert_uint_eq(0, a->size);
+		ck_assert_uint_eq(0, sp_bitarray_count(a->bits));
+		ck_assert_int_eq(0, sp_bloom_destroy(a));
+		ck_assert_int_eq(0, sp_bloom_destroy(b));
+	}
+}
+END_TEST
+
+START_TEST(merge_bad_args)
+{
+	struct sp_bloom *a, *b, *c, *d;
+	ck_assert_ptr_nonnull(a = sp_bloom_create(1000, 0.01, 0));
+	ck_assert_ptr_nonnull(b = sp_bloom_create(2000, 0.01, 0));
+	ck_assert_ptr_nonnull(c = sp_bloom_create(1000, 0.01, 1));
+	ck_assert_ptr_nonnull(d = sp_bloom_create(1000, 0.01, 0));
+	ck_assert_int_eq(0, sp_bloom_inserti(a, 1));
+	d->nhashes++;
+	ck_assert_int_eq(SP_EILLEGAL, sp_bloom_union(a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bloom_intersect(a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bloom_union(d, a));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bloom_intersect(d, a));
+	c->nbits = a->nbits;
+	ck_assert_int_eq(SP_EILLEGAL, sp_bloom_union(c, a));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bloom_intersect(a, c));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_union(NULL, a));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_union(a, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_intersect(NULL, a));
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_intersect(a, NULL));
+	ck_assert_uint_eq(1, a->size);
+	ck_assert_int_eq(1, sp_bloom_containsi(a, 1));
+	ck_assert_int_eq(0, sp_bloom_destroy(a));
+	ck_assert_int_eq(0, sp_bloom_destroy(b));
+	ck_assert_int_eq(0, sp_bloom_destroy(c));
+	ck_assert_int_eq(0, sp_bloom_destroy(d));
+}
+END_TEST
+
+void init_merge(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, merge_union);
+	tcase_add_test(tc, merge_intersect);
+	tcase_add_test(tc, merge_bad_args);
+}
@@ -0,0 +1,28 @@
+START_TEST(print_ok)
+{
+	struct sp_bloom *bloom;
+	int blocked, i;
+	for (blocked = 0; blocked <= 1; blocked++) {
+		ck_assert_ptr_nonnull(bloom = sp_bloom_create(100, 0.01, blocked));
+		ck_assert_int_eq(0, sp_bloom_print(bloom));
+		for (i = 0; i < 100; i++)
+			ck_assert_int_eq(0, sp_bloom_inserti(bloom, i));
+		ck_assert_int_eq(0, sp_bloom_print(bloom));
+		ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	}
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bloom_print(NULL));
+	ck_assert_double_eq(0, sp_bloom_fpr(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
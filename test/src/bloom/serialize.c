@@ -0,0 +1,115 @@
+START_TEST(serialize_ok)
+{
+	struct sp_bloom *bloom, *copy;
+	unsigned char *buf;
+	size_t size, i;
+	int blocked;
+	for (blocked = 0; blocked <= 1; blocked++) {
+		ck_assert_ptr_nonnull(bloom = sp_bloom_create(500, 0.01, blocked));
+		for (i = 0; i < 500; i++)
+			ck_assert_int_eq(0, sp_bloom_insertul(bloom, (unsigned long)rand()));
+		size = SP_BLOOM_HEADER + bloom->nbits / 8;
+		ck_assert_uint_eq(size, sp_bloom_serialize(bloom, NULL, 0));
+		ck_assert_ptr_nonnull(buf = malloc(size + 1));
+
+		/* Nothing is written to a buffer which is too small */
+		memset(buf, 0xAA, size + 1);
+		ck_assert_uint_eq(size, sp_bloom_serialize(bloom, buf, size - 1));
+		for (i = 0; i <= size; i++)
+			ck_assert_uint_eq(0xAA, buf[i]);
+		ck_assert_uint_eq(size, sp_bloom_serialize(bloom, buf, size + 1));
+		ck_assert_uint_eq(0xAA, buf[size]);
+
+		ck_assert_int_eq(0, memcmp(buf, "SPBF", 4));
+		ck_assert_uint_eq(1, buf[4]);
+		ck_assert_uint_eq(blocked, buf[5]);
+		ck_assert_uint_eq(bloom->nhashes, (size_t)buf[10] << 8 | buf[11]);
+		ck_assert_uint_eq(bloom->nbits, (size_t)buf[18] << 8 | buf[19]);
+		ck_assert_uint_eq(bloom->size, (size_t)buf[26] << 8 | buf[27]);
+		for (i = 0; i < bloom->nbits; i++)
+			ck_assert_int_eq((int)(BLOOM_WORDS(bloom)[i / WORD_BIT] >> i % WORD_BIT & 1),
+					buf[SP_BLOOM_HEADER + i / 8] >> i % 8 & 1);
+
+		ck_assert_ptr_nonnull(copy = sp_bloom_deserialize(buf, size + 1));
+		bloom_check(copy);
+		ck_assert_uint_eq(bloom->nbits, copy->nbits);
+		ck_assert_uint_eq(bloom->nhashes, copy->nhashes);
+		ck_assert_uint_eq(bloom->size, copy->size);
+		ck_assert_int_eq(bloom->blocked, copy->blocked);
+		ck_assert_int_eq(0, memcmp(BLOOM_WORDS(bloom), BLOOM_WORDS(copy), bloom->nbits / 8));
+		ck_assert_double_eq(sp_bloom_fpr(bloom), sp_bloom_fpr(copy));
+		ck_assert_int_eq(0, sp_bloom_union(copy, bloom));
+		ck_assert_int_eq(0, sp_bloom_destroy(copy));
+
+		free(buf);
+		ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	}
+}
+END_TEST
+
+START_TEST(serialize_empty)
+{
+	struct sp_bloom *bloom;
+	unsigned char buf[SP_BLOOM_HEADER + SP_BLOOM_BLOCK / 8];
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(1, 0.5, 1));
+	ck_assert_uint_eq(sizeof(buf), sp_bloom_serialize(bloom, buf, sizeof(buf)));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	ck_assert_ptr_nonnull(bloom = sp_bloom_deserialize(buf, sizeof(buf)));
+	bloom_check(bloom);
+	ck_assert_uint_eq(SP_BLOOM_BLOCK, bloom->nbits);
+	ck_assert_uint_eq(1, bloom->nhashes);
+	ck_assert_uint_eq(0, bloom->size);
+	ck_assert_uint_eq(0, sp_bitarray_count(bloom->bits));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+}
+END_TEST
+
+START_TEST(serialize_bad_args)
+{
+	/* Offsets of bytes to corrupt, and values to store in them */
+	static const size_t at[]  = {0, 3, 4, 5, 11, 19, 19, 12, 20};
+	static const int    val[] = {'X', 'X', 2, 2, 0, 65, 128, 1, 1};
+	struct sp_bloom *bloom;
+	unsigned char buf[SP_BLOOM_HEADER + 1024 / 8];
+	unsigned char bad[sizeof(buf)];
+	size_t i;
+	ck_assert_ptr_nonnull(bloom = sp_bloom_create(105, 0.01, 0));
+	ck_assert_uint_eq(1024, bloom->nbits);
+	ck_assert_int_eq(0, sp_bloom_inserti(bloom, 1));
+	ck_assert_uint_eq(sizeof(buf), sp_bloom_serialize(bloom, buf, sizeof(buf)));
+	ck_assert_uint_eq(0, sp_bloom_serialize(NULL, buf, sizeof(buf)));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+
+	ck_assert_ptr_null(sp_bloom_deserialize(NULL, sizeof(buf)));
+	ck_assert_ptr_null(sp_bloom_deserialize(buf, 0));
+	ck_assert_ptr_null(sp_bloom_deserialize(buf, SP_BLOOM_HEADER - 1));
+	ck_assert_ptr_null(sp_bloom_deserialize(buf, SP_BLOOM_HEADER));
+	ck_assert_ptr_null(sp_bloom_deserialize(buf, sizeof(buf) - 1));
+	for (i = 0; i < LEN(at); i++) {
+		memcpy(bad, buf, sizeof(buf));
+		bad[at[i]] = val[i];
+		ck_assert_ptr_null(sp_bloom_deserialize(bad, sizeof(bad)));
+	}
+
+	/* Blocked filters must hold a whole number of blocks */
+	memcpy(bad, buf, sizeof(buf));
+	bad[5] = 1;
+	ck_assert_ptr_nonnull(bloom = sp_bloom_deserialize(bad, sizeof(bad)));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+	bad[19] = 0xC0;
+	bad[18] = 0x01;
+	ck_assert_ptr_null(sp_bloom_deserialize(bad, sizeof(bad)));
+
+	ck_assert_ptr_nonnull(bloom = sp_bloom_deserialize(buf, sizeof(buf)));
+	ck_assert_int_eq(1, sp_bloom_containsi(bloom, 1));
+	ck_assert_int_eq(0, sp_bloom_destroy(bloom));
+}
+END_TEST
+
+void init_serialize(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, serialize_ok);
+	tcase_add_test(tc, serialize_empty);
+	tcase_add_test(tc, serialize_bad_args);
+}
@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_bptree.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Small nodes, to grow trees of several levels from few elements */
+#define SMALL_NODE 64
+
+/* Ordering for the generic functions */
+static int int_cmp(const void *a, const void *b)
+{
+	const int x = *(const int*)a, y = *(const int*)b;
+	return (x > y) - (x < y);
+}
+
+#define BPTREE_KEY(TREE, NODE, I) \
+	(*(const int*)((const char*)(NODE) + (TREE)->key_offset + (I) * sizeof(int)))
+#define BPTREE_CHILD(TREE, NODE, I) \
+	(((struct sp_bptree_node* const*)((const char*)(NODE) + (TREE)->child_offset))[I])
+
+/* Checks the fill, order and depth of a subtree with int keys, whose keys must
+ * lie within [lo, hi) where the bounds are given, and that its leaves come
+ * next in the leaf chain. Returns the number of elements of the subtree. */
+static size_t bptree_check_node(const struct sp_bptree *tree, const struct sp_bptree_node *node, size_t depth,
+		const int *lo, const int *hi, const struct sp_bptree_node **leaf)
+{
+	const int leaf_level = depth + 1 == tree->height;
+	const size_t cap = leaf_level ? tree->leaf_cap : tree->inner_cap;
+	size_t i, ret = 0;
+
+	ck_assert_uint_le(node->count, cap);
+	if (depth > 0)
+		ck_assert_uint_ge(node->count, cap / 2);
+	else
+		ck_assert_uint_ge(node->count, 1);
+	for (i = 0; i < node->count; i++) {
+		if (i > 0)
+			ck_assert_int_lt(BPTREE_KEY(tree, node, i - 1), BPTREE_KEY(tree, node, i));
+		if (lo != NULL)
+			ck_assert_int_ge(BPTREE_KEY(tree, node, i), *lo);
+		if (hi != NULL)
+			ck_assert_int_lt(BPTREE_KEY(tree, node, i), *hi);
+	}
+	if (leaf_level) {
+		ck_assert_ptr_eq(*leaf, node);
+		ck_assert_ptr_eq(node->next == NULL ? tree->tail : node->next->prev, node);
+		*leaf = node->next;
+		return node->count;
+	}
+	for (i = 0; i <= node->count; i++) {
+		ret += bptree_check_node(tree, BPTREE_CHILD(tree, node, i), depth + 1,
+				i == 0 ? lo : &BPTREE_KEY(tree, node, i - 1),
+				i == node->count ? hi : &BPTREE_KEY(tree, node, i), leaf);
+	}
+	return ret;
+}
+
+static void bptree_check(const struct sp_bptree *tree)
+{
+	const struct sp_bptree_node *leaf = tree->head;
+	if (tree->root == NULL) {
+		ck_assert_uint_eq(0, tree->height);
+		ck_assert_uint_eq(0, tree->size);
+		ck_assert_ptr_null(tree->head);
+		ck_assert_ptr_null(tree->tail);
+		return;
+	}
+	ck_assert_ptr_null(tree->head->prev);
+	ck_assert_uint_eq(tree->size, bptree_check_node(tree, tree->root, 0, NULL, NULL, &leaf));
+	ck_assert_ptr_null(leaf);
+}
+
+#include "bptree/create.c"
+#include "bptree/insert.c"
+#include "bptree/build.c"
+#include "bptree/iter.c"
+#include "bptree/remove.c"
+#include "bptree/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_insert = tcase_create("insert"),
+	      *tc_build  = tcase_create("build"),
+	      *tc_iter   = tcase_create("iter"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("bptree");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(build);
+	init_and_add(iter);
+	init_and_add(remove);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
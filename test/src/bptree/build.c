@@ -0,0 +1,76 @@
+START_TEST(build_ok)
+{
+	struct sp_bptree *tree;
+	int keys[600], vals[600];
+	size_t n, i;
+	for (i = 0; i < LEN(keys); i++) {
+		keys[i] = 3 * i - 100;
+		vals[i] = i;
+	}
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(int), SMALL_NODE, NULL));
+	for (n = 0; n <= LEN(keys); n += 1 + n / 4) {
+		ck_assert_int_eq(0, sp_bptree_buildi(tree, keys, vals, n));
+		ck_assert_uint_eq(n, tree->size);
+		bptree_check(tree);
+		for (i = 0; i < n; i++)
+			ck_assert_int_eq(vals[i], *(int*)sp_bptree_geti(tree, keys[i]));
+		ck_assert_int_eq(0, sp_bptree_clear(tree, NULL, NULL));
+	}
+	ck_assert_int_eq(0, sp_bptree_buildi(tree, keys, vals, LEN(keys)));
+	ck_assert_uint_ge(tree->height, 5);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(build_then_update)
+{
+	struct sp_bptree *tree;
+	int keys[300], i;
+	for (i = 0; i < 300; i++)
+		keys[i] = 2 * i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, SMALL_NODE, int_cmp));
+	ck_assert_int_eq(0, sp_bptree_build(tree, keys, NULL, 300));
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, 2 * i + 1, NULL));
+	bptree_check(tree);
+	for (i = 0; i < 600; i += 3)
+		ck_assert_int_eq(0, sp_bptree_removei(tree, i, NULL));
+	bptree_check(tree);
+	ck_assert_uint_eq(400, tree->size);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(build_bad_args)
+{
+	struct sp_bptree *tree;
+	int keys[] = {1, 2, 2, 3}, vals[4] = {0};
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(int), 0, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_build(NULL, keys, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_build(tree, NULL, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_build(tree, keys, NULL, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_build(tree, keys, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_buildi(NULL, keys, vals, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_buildi(tree, NULL, vals, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_buildc(tree, (char*)keys, vals, 1));
+
+	/* Keys must be strictly increasing */
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_buildi(tree, keys, vals, 3));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_buildi(tree, keys + 1, vals, 3));
+	ck_assert_uint_eq(0, tree->size);
+
+	/* The tree must be empty */
+	ck_assert_int_eq(0, sp_bptree_buildi(tree, keys, vals, 2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_buildi(tree, keys + 2, vals, 2));
+	ck_assert_uint_eq(2, tree->size);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+void init_build(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, build_ok);
+	tcase_add_test(tc, build_then_update);
+	tcase_add_test(tc, build_bad_args);
+}
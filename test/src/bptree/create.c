@@ -0,0 +1,81 @@
+START_TEST(create_ok)
+{
+	struct sp_bptree *tree;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(double), 0, int_cmp));
+	ck_assert_ptr_null(tree->root);
+	ck_assert_ptr_null(tree->head);
+	ck_assert_ptr_null(tree->tail);
+	ck_assert_uint_eq(sizeof(int), tree->key_size);
+	ck_assert_uint_eq(sizeof(double), tree->val_size);
+	ck_assert_uint_eq(0, tree->key_offset % sizeof(int));
+	ck_assert_uint_ge(tree->key_offset, sizeof(struct sp_bptree_node));
+	ck_assert_uint_eq(0, tree->val_offset % sizeof(double));
+	ck_assert_uint_ge(tree->val_offset, tree->key_offset + tree->leaf_cap * sizeof(int));
+	ck_assert_uint_eq(tree->leaf_size, tree->val_offset + tree->leaf_cap * sizeof(double));
+	ck_assert_uint_le(tree->leaf_size, SP_BPTREE_NODE_SIZE);
+	ck_assert_uint_gt(tree->leaf_size + sizeof(int) + sizeof(double), SP_BPTREE_NODE_SIZE);
+	ck_assert_uint_eq(0, tree->child_offset % sizeof(void*));
+	ck_assert_uint_ge(tree->child_offset, tree->key_offset + tree->inner_cap * sizeof(int));
+	ck_assert_uint_eq(tree->inner_size, tree->child_offset + (tree->inner_cap + 1) * sizeof(void*));
+	ck_assert_uint_le(tree->inner_size, SP_BPTREE_NODE_SIZE);
+	ck_assert_uint_gt(tree->inner_size + sizeof(int) + sizeof(void*), SP_BPTREE_NODE_SIZE);
+	ck_assert_uint_eq(0, tree->size);
+	ck_assert_uint_eq(0, tree->height);
+	ck_assert_ptr_eq(int_cmp, tree->cmp);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+
+	/* Nodes hold at least 3 keys, however small they are asked to be */
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(char), 0, 1, NULL));
+	ck_assert_uint_eq(0, tree->val_size);
+	ck_assert_uint_eq(3, tree->leaf_cap);
+	ck_assert_uint_eq(3, tree->inner_cap);
+	ck_assert_uint_eq(tree->key_offset + 3, tree->leaf_size);
+	ck_assert_ptr_null(tree->cmp);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_bptree_create(0, 1, 0, NULL));
+	ck_assert_ptr_null(sp_bptree_create(SIZE_MAX, 1, 0, NULL));
+	ck_assert_ptr_null(sp_bptree_create(1, SIZE_MAX, 0, NULL));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_bptree *tree;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(struct data), SMALL_NODE, NULL));
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, i, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_bptree_clear(tree, NULL, data_dtor_bad));
+	ck_assert_uint_eq(100, tree->size);
+	bptree_check(tree);
+	ck_assert_int_eq(0, sp_bptree_clear(tree, NULL, data_dtor));
+	bptree_check(tree);
+	ck_assert_int_eq(0, sp_bptree_clear(tree, NULL, data_dtor));
+
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, -i, &d));
+	}
+	bptree_check(tree);
+	ck_assert_int_eq(SP_ECALLBK, sp_bptree_destroy(tree, NULL, data_dtor_bad));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, data_dtor));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_clear(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_destroy(NULL, NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
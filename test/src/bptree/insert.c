@@ -0,0 +1,141 @@
+START_TEST(insert_random)
+{
+	struct sp_bptree *tree;
+	char seen[1000] = {0};
+	size_t count = 0;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(int), SMALL_NODE, NULL));
+	for (i = 0; i < 700; i++) {
+		const int key = IRANGE(0, 999), val = -key;
+		count += !seen[key];
+		seen[key] = 1;
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, key, &val));
+		ck_assert_uint_eq(count, tree->size);
+	}
+	bptree_check(tree);
+	ck_assert_uint_ge(tree->height, 4);
+	for (i = 0; i < 1000; i++) {
+		const int *val = sp_bptree_geti(tree, i);
+		if (!seen[i]) {
+			ck_assert_ptr_null(val);
+			continue;
+		}
+		ck_assert_ptr_nonnull(val);
+		ck_assert_int_eq(-i, *val);
+	}
+	ck_assert_ptr_null(sp_bptree_geti(tree, -1));
+	ck_assert_ptr_null(sp_bptree_geti(tree, 1000));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_sorted)
+{
+	struct sp_bptree *tree;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, SMALL_NODE, NULL));
+	for (i = 0; i < 2000; i++) {
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, i, NULL));
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, -i - 1, NULL));
+	}
+	bptree_check(tree);
+	ck_assert_uint_eq(4000, tree->size);
+	for (i = -2000; i < 2000; i++)
+		ck_assert_ptr_nonnull(sp_bptree_geti(tree, i));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_wide)
+{
+	struct sp_bptree *tree;
+	int i;
+
+	/* Nodes of default size hold many keys, searched by suffixed functions
+	 * with a bisection followed by a linear count */
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(short), sizeof(int), 0, NULL));
+	ck_assert_uint_gt(tree->leaf_cap, 64);
+	for (i = 0; i < 3000; i++) {
+		const short key = (i * 7919) % 3000;
+		const int val = key * 2;
+		ck_assert_int_eq(0, sp_bptree_inserts(tree, key, &val));
+	}
+	for (i = 0; i < 3000; i++)
+		ck_assert_int_eq(i * 2, *(int*)sp_bptree_gets(tree, i));
+	ck_assert_ptr_null(sp_bptree_gets(tree, 3000));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_overwrite)
+{
+	struct sp_bptree *tree;
+	double val = 1.5;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(long), sizeof(double), 0, NULL));
+	ck_assert_int_eq(0, sp_bptree_insertl(tree, 7, &val));
+	val = 2.5;
+	ck_assert_int_eq(0, sp_bptree_insertl(tree, 7, &val));
+	ck_assert_uint_eq(1, tree->size);
+	ck_assert(2.5 == *(double*)sp_bptree_getl(tree, 7));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_generic)
+{
+	struct sp_bptree *tree;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(struct data), SMALL_NODE, int_cmp));
+	for (i = 0; i < 200; i++) {
+		const int key = (i * 37) % 200;
+		ck_assert_int_eq(0, data_init(&d));
+		d.age = key;
+		ck_assert_int_eq(0, sp_bptree_insert(tree, &key, &d));
+	}
+	bptree_check(tree);
+	for (i = 0; i < 200; i++) {
+		const struct data *val = sp_bptree_get(tree, &i);
+		ck_assert_ptr_nonnull(val);
+		ck_assert_uint_eq(i, val->age);
+		ck_assert_ptr_eq(val, sp_bptree_geti(tree, i));
+	}
+	i = 200;
+	ck_assert_ptr_null(sp_bptree_get(tree, &i));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_bptree *tree;
+	int key = 1;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(int), 0, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_insert(NULL, &key, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_insert(tree, NULL, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_insert(tree, &key, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_insert(tree, &key, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_inserti(NULL, 1, &key));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_inserti(tree, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_insertc(tree, 1, &key));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_insertd(tree, 1, &key));
+	ck_assert_ptr_null(sp_bptree_get(NULL, &key));
+	ck_assert_ptr_null(sp_bptree_get(tree, NULL));
+	ck_assert_ptr_null(sp_bptree_get(tree, &key));
+	ck_assert_ptr_null(sp_bptree_geti(NULL, 1));
+	ck_assert_ptr_null(sp_bptree_getc(tree, 1));
+	ck_assert_uint_eq(0, tree->size);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_random);
+	tcase_add_test(tc, insert_sorted);
+	tcase_add_test(tc, insert_wide);
+	tcase_add_test(tc, insert_overwrite);
+	tcase_add_test(tc, insert_generic);
+	tcase_add_test(tc, insert_bad_args);
+}
@@ -0,0 +1,103 @@
+START_TEST(iter_walk)
+{
+	struct sp_bptree *tree;
+	struct sp_bptree_iter it;
+	int i, ok;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(int), SMALL_NODE, NULL));
+	ck_assert_int_eq(0, sp_bptree_first(tree, &it));
+	ck_assert_int_eq(0, sp_bptree_last(tree, &it));
+	ck_assert_int_eq(0, sp_bptree_next(&it));
+	ck_assert_int_eq(0, sp_bptree_prev(&it));
+	for (i = 0; i < 300; i++) {
+		const int key = (i * 101) % 300, val = key + 1;
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, key, &val));
+	}
+	for (i = 0, ok = sp_bptree_first(tree, &it); ok; i++, ok = sp_bptree_next(&it)) {
+		ck_assert_int_eq(i, *(int*)sp_bptree_key(tree, &it));
+		ck_assert_int_eq(i + 1, *(int*)sp_bptree_val(tree, &it));
+	}
+	ck_assert_int_eq(300, i);
+	ck_assert_int_eq(0, sp_bptree_next(&it));
+	for (i = 299, ok = sp_bptree_last(tree, &it); ok; i--, ok = sp_bptree_prev(&it))
+		ck_assert_int_eq(i, *(int*)sp_bptree_key(tree, &it));
+	ck_assert_int_eq(-1, i);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(iter_bounds)
+{
+	struct sp_bptree *tree;
+	struct sp_bptree_iter it;
+	int i, key;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, SMALL_NODE, int_cmp));
+	ck_assert_int_eq(0, sp_bptree_lowerboundi(tree, 0, &it));
+	ck_assert_int_eq(0, sp_bptree_upperboundi(tree, 0, &it));
+	for (i = 0; i < 200; i++)
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, 10 * i, NULL));
+	for (key = -5; key < 2000; key++) {
+		const int lower = key < 0 ? 0 : (key + 9) / 10 * 10,
+		          upper = key < 0 ? 0 : key / 10 * 10 + 10;
+		ck_assert_int_eq(lower < 2000, sp_bptree_lowerboundi(tree, key, &it));
+		if (lower < 2000)
+			ck_assert_int_eq(lower, *(int*)sp_bptree_key(tree, &it));
+		ck_assert_int_eq(lower < 2000, sp_bptree_lowerbound(tree, &key, &it));
+		if (lower < 2000)
+			ck_assert_int_eq(lower, *(int*)sp_bptree_key(tree, &it));
+		ck_assert_int_eq(upper < 2000, sp_bptree_upperboundi(tree, key, &it));
+		if (upper < 2000)
+			ck_assert_int_eq(upper, *(int*)sp_bptree_key(tree, &it));
+		ck_assert_int_eq(upper < 2000, sp_bptree_upperbound(tree, &key, &it));
+		if (upper < 2000)
+			ck_assert_int_eq(upper, *(int*)sp_bptree_key(tree, &it));
+	}
+
+	/* Range scan from a bound */
+	ck_assert(sp_bptree_lowerboundi(tree, 95, &it));
+	for (key = 100; key <= 500; key += 10) {
+		ck_assert_int_eq(key, *(int*)sp_bptree_key(tree, &it));
+		ck_assert(sp_bptree_next(&it));
+	}
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(iter_bad_args)
+{
+	struct sp_bptree *tree;
+	struct sp_bptree_iter it;
+	int key = 0;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, 0, NULL));
+	ck_assert_int_eq(0, sp_bptree_inserti(tree, 1, NULL));
+	ck_assert_int_eq(0, sp_bptree_first(NULL, &it));
+	ck_assert_int_eq(0, sp_bptree_first(tree, NULL));
+	ck_assert_int_eq(0, sp_bptree_last(NULL, &it));
+	ck_assert_int_eq(0, sp_bptree_last(tree, NULL));
+	ck_assert_int_eq(0, sp_bptree_next(NULL));
+	ck_assert_int_eq(0, sp_bptree_prev(NULL));
+	ck_assert_int_eq(0, sp_bptree_lowerbound(NULL, &key, &it));
+	ck_assert_int_eq(0, sp_bptree_lowerbound(tree, NULL, &it));
+	ck_assert_int_eq(0, sp_bptree_lowerbound(tree, &key, NULL));
+	ck_assert_int_eq(0, sp_bptree_lowerbound(tree, &key, &it));
+	ck_assert_int_eq(0, sp_bptree_lowerboundc(tree, 0, &it));
+	ck_assert_int_eq(0, sp_bptree_upperbound(tree, &key, &it));
+	ck_assert_int_eq(0, sp_bptree_upperboundi(NULL, 0, &it));
+	ck_assert_int_eq(0, sp_bptree_upperboundi(tree, 0, NULL));
+	ck_assert(sp_bptree_first(tree, &it));
+	ck_assert_ptr_null(sp_bptree_key(NULL, &it));
+	ck_assert_ptr_null(sp_bptree_key(tree, NULL));
+	ck_assert_ptr_null(sp_bptree_val(NULL, &it));
+	ck_assert_ptr_null(sp_bptree_val(tree, NULL));
+	ck_assert_int_eq(0, sp_bptree_next(&it));
+	ck_assert_ptr_null(sp_bptree_key(tree, &it));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+void init_iter(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, iter_walk);
+	tcase_add_test(tc, iter_bounds);
+	tcase_add_test(tc, iter_bad_args);
+}
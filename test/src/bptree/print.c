@@ -0,0 +1,56 @@
+static int kv_print(const void *key, const void *val)
+{
+	printf("%d\t", *(const int*)key);
+	return data_print(val);
+}
+
+static int kv_print_bad(const void *key, const void *val)
+{
+	return data_print_bad(val);
+}
+
+START_TEST(print_object)
+{
+	struct sp_bptree *tree;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(struct data), 0, NULL));
+	ck_assert_int_eq(0, sp_bptree_print(tree, kv_print_bad));
+	for (i = 0; i < 3; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, i, &d));
+	}
+	ck_assert_int_eq(0, sp_bptree_print(tree, NULL));
+	ck_assert_int_eq(0, sp_bptree_print(tree, kv_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_bptree_print(tree, kv_print_bad));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	struct sp_bptree *tree;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, 0, NULL));
+	ck_assert_int_eq(0, sp_bptree_inserti(tree, 7, NULL));
+	ck_assert_int_eq(0, sp_bptree_inserti(tree, 3, NULL));
+	ck_assert_int_eq(0, sp_bptree_printi(tree));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_printd(tree));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_print(NULL, kv_print));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_printi(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
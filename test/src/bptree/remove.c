@@ -0,0 +1,128 @@
+START_TEST(remove_random)
+{
+	struct sp_bptree *tree;
+	char present[500] = {0};
+	size_t count = 0;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(int), SMALL_NODE, int_cmp));
+	for (i = 0; i < 500; i += 2) {
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, i, &i));
+		present[i] = 1;
+		count++;
+	}
+	for (i = 0; i < 3000; i++) {
+		const int key = IRANGE(0, 499);
+		if (rand() % 3 == 0) {
+			ck_assert_int_eq(0, sp_bptree_inserti(tree, key, &key));
+			count += !present[key];
+			present[key] = 1;
+		} else if (rand() % 2) {
+			ck_assert_int_eq(present[key] ? 0 : SP_ENOKEY, sp_bptree_removei(tree, key, NULL));
+			count -= present[key];
+			present[key] = 0;
+		} else if (present[key]) {
+			ck_assert_int_eq(0, sp_bptree_remove(tree, &key, NULL, NULL));
+			present[key] = 0;
+			count--;
+		} else {
+			ck_assert_int_eq(SP_ENOKEY, sp_bptree_remove(tree, &key, NULL, NULL));
+		}
+		ck_assert_uint_eq(count, tree->size);
+		if (i % 100 == 0)
+			bptree_check(tree);
+	}
+	bptree_check(tree);
+	for (i = 0; i < 500; i++) {
+		const int *val = sp_bptree_geti(tree, i);
+		ck_assert_int_eq(present[i], val != NULL);
+		if (val != NULL)
+			ck_assert_int_eq(i, *val);
+	}
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_all)
+{
+	struct sp_bptree *tree;
+	int keys[1000], i;
+	for (i = 0; i < 1000; i++)
+		keys[i] = i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, SMALL_NODE, NULL));
+
+	/* Empty the tree from the front, the back and the middle, so that nodes
+	 * borrow from and merge with siblings on both sides */
+	ck_assert_int_eq(0, sp_bptree_buildi(tree, keys, NULL, 1000));
+	for (i = 0; i < 1000; i++) {
+		ck_assert_int_eq(0, sp_bptree_removei(tree, i, NULL));
+		if (i % 50 == 0)
+			bptree_check(tree);
+	}
+	bptree_check(tree);
+	ck_assert_int_eq(0, sp_bptree_buildi(tree, keys, NULL, 1000));
+	for (i = 999; i >= 0; i--) {
+		ck_assert_int_eq(0, sp_bptree_removei(tree, i, NULL));
+		if (i % 50 == 0)
+			bptree_check(tree);
+	}
+	bptree_check(tree);
+	ck_assert_int_eq(0, sp_bptree_buildi(tree, keys, NULL, 1000));
+	for (i = 0; i < 500; i++) {
+		ck_assert_int_eq(0, sp_bptree_removei(tree, 500 + i, NULL));
+		ck_assert_int_eq(0, sp_bptree_removei(tree, 499 - i, NULL));
+		if (i % 25 == 0)
+			bptree_check(tree);
+	}
+	bptree_check(tree);
+	ck_assert_int_eq(SP_ENOKEY, sp_bptree_removei(tree, 0, NULL));
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_dtor)
+{
+	struct sp_bptree *tree;
+	struct data d;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), sizeof(struct data), SMALL_NODE, int_cmp));
+	for (i = 0; i < 10; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_bptree_inserti(tree, i, &d));
+	}
+	i = 5;
+	ck_assert_int_eq(SP_ECALLBK, sp_bptree_remove(tree, &i, NULL, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_bptree_removei(tree, 5, data_dtor_bad));
+	ck_assert_uint_eq(10, tree->size);
+	ck_assert_int_eq(0, sp_bptree_remove(tree, &i, NULL, data_dtor));
+	ck_assert_int_eq(0, sp_bptree_removei(tree, 6, data_dtor));
+	ck_assert_uint_eq(8, tree->size);
+	bptree_check(tree);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	struct sp_bptree *tree;
+	int key = 1;
+	ck_assert_ptr_nonnull(tree = sp_bptree_create(sizeof(int), 0, 0, NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_bptree_removei(tree, key, NULL));
+	ck_assert_int_eq(0, sp_bptree_inserti(tree, key, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_remove(NULL, &key, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_remove(tree, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_remove(tree, &key, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_bptree_removei(NULL, key, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_bptree_removes(tree, key, NULL));
+	ck_assert_uint_eq(1, tree->size);
+	ck_assert_int_eq(0, sp_bptree_destroy(tree, NULL, NULL));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_random);
+	tcase_add_test(tc, remove_all);
+	tcase_add_test(tc, remove_dtor);
+	tcase_add_test(tc, remove_bad_args);
+}
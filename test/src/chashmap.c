@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_chashmap.h"
+#include "test_struct.h"
+#include <pthread.h>
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+#include "chashmap/create.c"
+#include "chashmap/destroy.c"
+#include "chashmap/clear.c"
+#include "chashmap/insert.c"
+#include "chashmap/get.c"
+#include "chashmap/remove.c"
+#include "chashmap/size.c"
+#include "chashmap/map.c"
+#include "chashmap/print.c"
+#include "chashmap/concurrent.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create     = tcase_create("create"),
+	      *tc_destroy    = tcase_create("destroy"),
+	      *tc_clear      = tcase_create("clear"),
+	      *tc_insert     = tcase_create("insert"),
+	      *tc_get        = tcase_create("get"),
+	      *tc_remove     = tcase_create("remove"),
+	      *tc_size       = tcase_create("size"),
+	      *tc_map        = tcase_create("map"),
+	      *tc_print      = tcase_create("print"),
+	      *tc_concurrent = tcase_create("concurrent");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("chashmap");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(clear);
+	init_and_add(insert);
+	init_and_add(get);
+	init_and_add(remove);
+	init_and_add(size);
+	init_and_add(map);
+	init_and_add(print);
+	init_and_add(concurrent);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
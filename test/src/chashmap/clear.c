@@ -0,0 +1,62 @@
+START_TEST(clear_ok)
+{
+	struct sp_chashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(int), 10, 4, NULL, NULL));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	ck_assert_int_eq(0, sp_chashmap_clear(s, NULL, NULL));
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(SP_ENOKEY, sp_chashmap_geti(s, i, NULL));
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, 5, &i));
+	ck_assert_int_eq(0, sp_chashmap_geti(s, 5, NULL));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(clear_object)
+{
+	struct sp_chashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(struct data), 5, 4, NULL, NULL));
+	for (i = 0; i < 10; i++) {
+		struct data v;
+		ck_assert_int_eq(0, data_init(&v));
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &v));
+	}
+	ck_assert_int_eq(0, sp_chashmap_clear(s, NULL, data_dtor));
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(clear_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_clear(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_clear(NULL, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(clear_bad_dtor)
+{
+	struct sp_chashmap *s;
+	struct data a;
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(struct data), 10, 4, NULL, NULL));
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, 1, &a));
+	ck_assert_int_eq(SP_ECALLBK, sp_chashmap_clear(s, NULL, data_dtor_bad));
+	ck_assert_uint_eq(1, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_clear(s, NULL, data_dtor));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+void init_clear(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, clear_ok);
+	tcase_add_test(tc, clear_object);
+	tcase_add_test(tc, clear_bad_args);
+	tcase_add_test(tc, clear_bad_dtor);
+}
@@ -0,0 +1,96 @@
+/* Readers check that they never observe a value which was only partially
+ * written, while writers keep inserting, overwriting and removing keys, and
+ * tables keep growing underneath the readers. */
+#define CONCURRENT_KEYS    2000
+#define CONCURRENT_WORDS   4
+#define CONCURRENT_READERS 3
+#define CONCURRENT_WRITERS 2
+
+struct concurrent_ctx {
+	struct sp_chashmap *map;
+	unsigned long seed;
+	volatile int done;
+	unsigned long errors;
+};
+
+static void *concurrent_reader(void *arg)
+{
+	struct concurrent_ctx *const ctx = arg;
+	unsigned long r = ctx->seed;
+	while (!ctx->done) {
+		unsigned long v[CONCURRENT_WORDS], k;
+		int i;
+		r = r * 1103515245UL + 12345UL;
+		k = (r >> 8) % CONCURRENT_KEYS;
+		if (sp_chashmap_getul(ctx->map, k, v) != 0)
+			continue;
+		for (i = 0; i < CONCURRENT_WORDS; i++)
+			if (v[i] != v[0])
+				++ctx->errors;
+		if (v[0] % CONCURRENT_KEYS != k)
+			++ctx->errors;
+	}
+	return NULL;
+}
+
+static void *concurrent_writer(void *arg)
+{
+	struct concurrent_ctx *const ctx = arg;
+	unsigned long r = ctx->seed, n;
+	for (n = 0; n < 20000; n++) {
+		unsigned long v[CONCURRENT_WORDS], k;
+		int i;
+		r = r * 1103515245UL + 12345UL;
+		k = (r >> 8) % CONCURRENT_KEYS;
+		if ((r >> 4) % 4 == 0) {
+			if (sp_chashmap_removeul(ctx->map, k, NULL) == SP_EINVAL)
+				++ctx->errors;
+			continue;
+		}
+		for (i = 0; i < CONCURRENT_WORDS; i++)
+			v[i] = k + CONCURRENT_KEYS * n;
+		if (sp_chashmap_insertul(ctx->map, k, v))
+			++ctx->errors;
+	}
+	return NULL;
+}
+
+START_TEST(concurrent_ok)
+{
+	struct concurrent_ctx readers[CONCURRENT_READERS], writers[CONCURRENT_WRITERS];
+	pthread_t rt[CONCURRENT_READERS], wt[CONCURRENT_WRITERS];
+	struct sp_chashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(unsigned long), CONCURRENT_WORDS * sizeof(unsigned long), 1, 4, NULL, NULL));
+	for (i = 0; i < CONCURRENT_READERS; i++) {
+		readers[i].map    = s;
+		readers[i].seed   = rand();
+		readers[i].done   = 0;
+		readers[i].errors = 0;
+		ck_assert_int_eq(0, pthread_create(&rt[i], NULL, concurrent_reader, &readers[i]));
+	}
+	for (i = 0; i < CONCURRENT_WRITERS; i++) {
+		writers[i].map    = s;
+		writers[i].seed   = rand();
+		writers[i].errors = 0;
+		ck_assert_int_eq(0, pthread_create(&wt[i], NULL, concurrent_writer, &writers[i]));
+	}
+	for (i = 0; i < CONCURRENT_WRITERS; i++) {
+		ck_assert_int_eq(0, pthread_join(wt[i], NULL));
+		ck_assert_uint_eq(0, writers[i].errors);
+	}
+	for (i = 0; i < CONCURRENT_READERS; i++)
+		readers[i].done = 1;
+	for (i = 0; i < CONCURRENT_READERS; i++) {
+		ck_assert_int_eq(0, pthread_join(rt[i], NULL));
+		ck_assert_uint_eq(0, readers[i].errors);
+	}
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+void init_concurrent(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, concurrent_ok);
+}
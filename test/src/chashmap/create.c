@@ -0,0 +1,51 @@
+START_TEST(create_ok)
+{
+	struct sp_chashmap *s;
+	size_t i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(double), 100, 5, NULL, NULL));
+	ck_assert_uint_eq(sizeof(int), s->key_size);
+	ck_assert_uint_eq(sizeof(double), s->val_size);
+	ck_assert_uint_eq(8, s->nshards);
+	for (i = 0; i < s->nshards; i++) {
+		const struct sp_hashmap *tab = s->shards[i].table;
+		ck_assert_uint_eq(0, tab->size);
+		ck_assert_uint_ge(tab->capacity - tab->capacity / 8, 100 / 8 + 1);
+		ck_assert_uint_eq(0, s->shards[i].nretired);
+	}
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(1, 1, 1, 1, NULL, NULL));
+	ck_assert_uint_eq(1, s->nshards);
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(1, 1, 14336, 1, NULL, NULL));
+	ck_assert_uint_eq(16384, s->shards[0].table->capacity);
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_chashmap_create(1, 1, 14337, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_chashmap_create(SIZE_MAX, 1, 1, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_chashmap_create(1, SIZE_MAX, 1, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_chashmap_create(1, 1, 1, SIZE_MAX, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_chashmap_create(0, 1, 10, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_chashmap_create(1, 0, 10, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_chashmap_create(1, 1, 0, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_chashmap_create(1, 1, 10, 0, NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,59 @@
+START_TEST(destroy_ok)
+{
+	struct sp_chashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(int), 1, 4, NULL, NULL));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+
+	/* Retired tables are freed too, here kept alive by a pretend reader */
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(int), 1, 4, NULL, NULL));
+	++s->shards[0].readers[0];
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	ck_assert_uint_ne(0, s->shards[0].nretired);
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(destroy_object)
+{
+	struct sp_chashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(struct data), sizeof(struct data), 10, 2, NULL, NULL));
+	for (i = 0; i < 20; i++) {
+		struct data k, v;
+		ck_assert_int_eq(0, data_init(&k));
+		ck_assert_int_eq(0, data_init(&v));
+		ck_assert_int_eq(0, sp_chashmap_insert(s, &k, &v));
+	}
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_destroy(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_destroy(NULL, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_dtor)
+{
+	struct sp_chashmap *s;
+	struct data a;
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(struct data), 10, 2, NULL, NULL));
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, 7, &a));
+	ck_assert_int_eq(SP_ECALLBK, sp_chashmap_destroy(s, NULL, data_dtor_bad));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, data_dtor));
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_object);
+	tcase_add_test(tc, destroy_bad_args);
+	tcase_add_test(tc, destroy_bad_dtor);
+}
@@ -0,0 +1,72 @@
+#define setup(K, V, X) \
+	struct sp_chashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(K), sizeof(V), X, 4, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, K, V));
+
+START_TEST(get_ok)
+{
+	int i, v;
+	setup(double, int, 10);
+	for (i = 0; i < 500; i++)
+		ck_assert_int_eq(0, sp_chashmap_insertd(s, i / 4.0, &i));
+	for (i = 0; i < 500; i++) {
+		double k = i / 4.0;
+		ck_assert_int_eq(0, sp_chashmap_get(s, &k, &v));
+		ck_assert_int_eq(i, v);
+		v = -1;
+		ck_assert_int_eq(0, sp_chashmap_getd(s, k, &v));
+		ck_assert_int_eq(i, v);
+		ck_assert_int_eq(0, sp_chashmap_getd(s, k, NULL));
+	}
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(get_missing)
+{
+	int i, v = 7;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_ENOKEY, sp_chashmap_geti(s, 0, &v));
+	for (i = 0; i < 1000; i += 2)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	for (i = 1; i < 1000; i += 2)
+		ck_assert_int_eq(SP_ENOKEY, sp_chashmap_geti(s, i, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	int k = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_get(NULL, &k, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_get(s, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_geti(NULL, k, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(get_bad_key_size)
+{
+	int v = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, 1, &v));
+	ck_assert_int_eq(SP_EILLEGAL, sp_chashmap_getc(s, 1, &v));
+	ck_assert_int_eq(SP_EILLEGAL, sp_chashmap_getd(s, 1, &v));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_ok);
+	tcase_add_test(tc, get_missing);
+	tcase_add_test(tc, get_bad_args);
+	tcase_add_test(tc, get_bad_key_size);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,140 @@
+#define setup(K, V, X) \
+	struct sp_chashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(K), sizeof(V), X, 4, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, K, V));
+
+START_TEST(insert_ok)
+{
+	long i, v;
+	setup(long, long, 1);
+	for (i = 0; i < 1000; i++) {
+		v = i * 3;
+		ck_assert_int_eq(0, sp_chashmap_insert(s, &i, &v));
+		ck_assert_uint_eq(i + 1, sp_chashmap_size(s));
+	}
+	for (i = 0; i < 1000; i++) {
+		ck_assert_int_eq(0, sp_chashmap_get(s, &i, &v));
+		ck_assert_int_eq(i * 3, v);
+	}
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_overwrite)
+{
+	int k = 42, v;
+	setup(int, int, 10);
+	v = 1;
+	ck_assert_int_eq(0, sp_chashmap_insert(s, &k, &v));
+	v = 2;
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, k, &v));
+	ck_assert_uint_eq(1, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_geti(s, k, &v));
+	ck_assert_int_eq(2, v);
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_churn)
+{
+	/* Tables full of tombstones are replaced by copies of the same size, and
+	 * with no readers around, the old ones are freed right away */
+	int i, j;
+	size_t n, capacity[4];
+	setup(int, int, 1000);
+	for (n = 0; n < s->nshards; n++)
+		capacity[n] = s->shards[n].table->capacity;
+	for (j = 0; j < 50; j++) {
+		for (i = 0; i < 200; i++)
+			ck_assert_int_eq(0, sp_chashmap_inserti(s, j * 200 + i, &i));
+		for (i = 0; i < 200; i++)
+			ck_assert_int_eq(0, sp_chashmap_removei(s, j * 200 + i, NULL));
+	}
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	for (n = 0; n < s->nshards; n++) {
+		ck_assert_uint_eq(capacity[n], s->shards[n].table->capacity);
+		ck_assert_uint_eq(0, s->shards[n].nretired);
+	}
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_reclaim)
+{
+	/* A lookup in progress keeps retired tables alive until it is done */
+	struct sp_chashmap_shard *shard;
+	unsigned long epoch;
+	int i;
+	setup(int, int, 1);
+	shard = s->shards;
+	epoch = shard->epoch;
+	++shard->readers[epoch & 1];
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	ck_assert_uint_ne(0, shard->nretired);
+	ck_assert_uint_eq(epoch + 1, shard->epoch);
+	--shard->readers[epoch & 1];
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_chashmap_removei(s, i, NULL));
+	for (i = 0; i < 4; i++)
+		ck_assert_uint_eq(0, s->shards[i].nretired);
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_too_big)
+{
+	/* 8192 slots of 4 bytes is the limit, 7/8 of which are usable */
+	struct sp_chashmap *s;
+	unsigned short k;
+	char v = 0;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(k), 1, 1, 1, NULL, NULL));
+	for (k = 0; k < 7 * 1024; k++)
+		ck_assert_int_eq(0, sp_chashmap_insertus(s, k, &v));
+	ck_assert_int_eq(SP_ERANGE, sp_chashmap_insertus(s, k, &v));
+	ck_assert_uint_eq(7 * 1024, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	int k = 0, v = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_insert(NULL, &k, &v));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_insert(s, NULL, &v));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_insert(s, &k, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_inserti(NULL, k, &v));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_inserti(s, k, NULL));
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_bad_key_size)
+{
+	int v = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EILLEGAL, sp_chashmap_insertc(s, 1, &v));
+	ck_assert_int_eq(SP_EILLEGAL, sp_chashmap_insertld(s, 1, &v));
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_ok);
+	tcase_add_test(tc, insert_overwrite);
+	tcase_add_test(tc, insert_churn);
+	tcase_add_test(tc, insert_reclaim);
+	tcase_add_test(tc, insert_too_big);
+	tcase_add_test(tc, insert_bad_args);
+	tcase_add_test(tc, insert_bad_key_size);
+}
+
+#undef setup
+#undef teardown
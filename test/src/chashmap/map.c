@@ -0,0 +1,116 @@
+/* Adapters from the hash map's key-value callbacks to the test_struct ones */
+static int ckv_mutate(const void *key, void *val)
+{
+	return data_mutate(val, *(const int*)key);
+}
+
+static int ckv_mutate_bad(const void *key, void *val)
+{
+	return data_mutate_bad(val, *(const int*)key);
+}
+
+static int ckv_verify(const void *key, void *val)
+{
+	return data_verify(val, *(const int*)key);
+}
+
+static int ckv_nop(const void *key, void *val)
+{
+	return 0;
+}
+
+static int ckv_double_odd(const void *key, void *val)
+{
+	if (*(const int*)key % 2)
+		*(int*)val *= 2;
+	return 0;
+}
+
+#define setup(K, V, X) \
+	struct sp_chashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(K), sizeof(V), X, 4, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, K, V));
+
+START_TEST(map_ok)
+{
+	int i;
+	setup(int, struct data, 10);
+	for (i = 0; i < 30; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i * 13, &d));
+	}
+	ck_assert_int_eq(0, sp_chashmap_map(s, ckv_mutate));
+	ck_assert_int_eq(0, sp_chashmap_map(s, ckv_verify));
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+START_TEST(map_write_changed)
+{
+	/* Readers are only held up by values that have actually changed */
+	unsigned long seq[4];
+	size_t n;
+	int i, v;
+	setup(int, int, 10);
+	for (i = 0; i < 40; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	for (n = 0; n < s->nshards; n++)
+		seq[n] = s->shards[n].seq;
+	ck_assert_int_eq(0, sp_chashmap_map(s, ckv_nop));
+	for (n = 0; n < s->nshards; n++)
+		ck_assert_uint_eq(seq[n], s->shards[n].seq);
+	ck_assert_int_eq(0, sp_chashmap_map(s, ckv_double_odd));
+	for (n = 0; n < s->nshards; n++) {
+		ck_assert_uint_eq(0, s->shards[n].seq % 2);
+		seq[n] = (s->shards[n].seq - seq[n]) / 2;
+	}
+	ck_assert_uint_eq(20, seq[0] + seq[1] + seq[2] + seq[3]);
+	for (i = 0; i < 40; i++) {
+		ck_assert_int_eq(0, sp_chashmap_geti(s, i, &v));
+		ck_assert_int_eq(i % 2 ? 2 * i : i, v);
+	}
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(map_bad_args)
+{
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_map(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_map(NULL, ckv_mutate));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_map(NULL, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(map_bad_callback)
+{
+	int i;
+	setup(int, struct data, 10);
+	ck_assert_int_eq(0, sp_chashmap_map(s, ckv_mutate_bad));
+	for (i = 0; i < 3; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_chashmap_map(s, ckv_mutate_bad));
+	/* The shard must have been unlocked */
+	ck_assert_int_eq(0, sp_chashmap_map(s, ckv_mutate));
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+void init_map(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, map_ok);
+	tcase_add_test(tc, map_write_changed);
+	tcase_add_test(tc, map_bad_args);
+	tcase_add_test(tc, map_bad_callback);
+}
+
+#undef setup
+#undef teardown
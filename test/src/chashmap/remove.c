@@ -0,0 +1,96 @@
+#define setup(K, V, X) \
+	struct sp_chashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(K), sizeof(V), X, 4, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, K, V));
+
+START_TEST(remove_ok)
+{
+	int i;
+	setup(int, int, 10);
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	for (i = 0; i < 1000; i += 2)
+		ck_assert_int_eq(0, sp_chashmap_remove(s, &i, NULL, NULL));
+	for (i = 1; i < 1000; i += 4)
+		ck_assert_int_eq(0, sp_chashmap_removei(s, i, NULL));
+	ck_assert_uint_eq(250, sp_chashmap_size(s));
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(i % 4 == 3 ? 0 : SP_ENOKEY, sp_chashmap_geti(s, i, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_object)
+{
+	struct sp_chashmap *s;
+	struct data k, v;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(struct data), sizeof(struct data), 10, 2, NULL, NULL));
+	ck_assert_int_eq(0, data_init(&k));
+	ck_assert_int_eq(0, data_init(&v));
+	ck_assert_int_eq(0, sp_chashmap_insert(s, &k, &v));
+	ck_assert_int_eq(0, sp_chashmap_remove(s, &k, data_dtor, data_dtor));
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_missing)
+{
+	int k = 5;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_ENOKEY, sp_chashmap_remove(s, &k, NULL, NULL));
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, k, &k));
+	ck_assert_int_eq(0, sp_chashmap_removei(s, k, NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_chashmap_removei(s, k, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	int k = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_remove(NULL, &k, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_remove(s, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_chashmap_removei(NULL, k, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_dtor)
+{
+	struct data d;
+	setup(int, struct data, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_chashmap_inserti(s, 3, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_chashmap_removei(s, 3, data_dtor_bad));
+	ck_assert_uint_eq(1, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_removei(s, 3, data_dtor));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_key_size)
+{
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EILLEGAL, sp_chashmap_removec(s, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_chashmap_removeld(s, 1, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_ok);
+	tcase_add_test(tc, remove_object);
+	tcase_add_test(tc, remove_missing);
+	tcase_add_test(tc, remove_bad_args);
+	tcase_add_test(tc, remove_bad_dtor);
+	tcase_add_test(tc, remove_bad_key_size);
+}
+
+#undef setup
+#undef teardown
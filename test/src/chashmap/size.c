@@ -0,0 +1,28 @@
+START_TEST(size_ok)
+{
+	struct sp_chashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_chashmap_create(sizeof(int), sizeof(int), 10, 8, NULL, NULL));
+	ck_assert_uint_eq(0, sp_chashmap_size(s));
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	ck_assert_uint_eq(300, sp_chashmap_size(s));
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(0, sp_chashmap_inserti(s, i, &i));
+	ck_assert_uint_eq(300, sp_chashmap_size(s));
+	ck_assert_int_eq(0, sp_chashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(size_bad_args)
+{
+	ck_assert_uint_eq(0, sp_chashmap_size(NULL));
+}
+END_TEST
+
+void init_size(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, size_ok);
+	tcase_add_test(tc, size_bad_args);
+}
@@ -0,0 +1,57 @@
+START_TEST(create_ok)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(5, 10));
+	ck_assert_uint_eq(5, s->elem_size);
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(10, s->block_size);
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(SIZE_MAX, 1));
+	ck_assert_uint_eq(SIZE_MAX, s->elem_size);
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(1, s->block_size);
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(1, SIZE_MAX));
+	ck_assert_uint_eq(1,  s->elem_size);
+	ck_assert_uint_eq(0,  s->size);
+	ck_assert_uint_eq(SIZE_MAX, s->block_size);
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(2, SIZE_MAX / 2));
+	ck_assert_uint_eq(2,  s->elem_size);
+	ck_assert_uint_eq(0,  s->size);
+	ck_assert_uint_eq(SIZE_MAX / 2, s->block_size);
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(SIZE_MAX / 2, 2));
+	ck_assert_uint_eq(SIZE_MAX / 2,  s->elem_size);
+	ck_assert_uint_eq(0,  s->size);
+	ck_assert_uint_eq(2, s->block_size);
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_deque_create(2, 1 + SIZE_MAX / 2));
+	ck_assert_ptr_null(sp_deque_create(SIZE_MAX, SIZE_MAX));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_deque_create(0, 10));
+	ck_assert_ptr_null(sp_deque_create(10, 0));
+	ck_assert_ptr_null(sp_deque_create(0, 0));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,54 @@
+START_TEST(destroy_ok)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 30));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(destroy_object)
+{
+	struct sp_deque *s;
+	struct data a, b, c;
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 5));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &b));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &c));
+	ck_assert_int_eq(0, sp_deque_destroy(s, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_deque_destroy(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_destroy(NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_dtor)
+{
+	struct sp_deque *s;
+	struct data a;
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 10));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(SP_ECALLBK, sp_deque_destroy(s, data_dtor_bad));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+	data_dtor(&a);
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_object);
+	tcase_add_test(tc, destroy_bad_args);
+	tcase_add_test(tc, destroy_bad_dtor);
+}
@@ -0,0 +1,131 @@
+#define setup(T, X) \
+	struct sp_deque *s; \
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_deque_destroy(s, D));
+
+START_TEST(get_basic)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(1, sp_deque_geti(s, 0));
+
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(1, sp_deque_geti(s, 0));
+	ck_assert_int_eq(2, sp_deque_geti(s, 1));
+
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_int_eq(1, sp_deque_geti(s, 0));
+	ck_assert_int_eq(2, sp_deque_geti(s, 1));
+	ck_assert_int_eq(3, sp_deque_geti(s, 2));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(get_object)
+{
+	struct data a, b, c;
+	setup(struct data, 10);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_get(s, 0)));
+
+	ck_assert_int_eq(0, sp_deque_pushback(s, &b));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_get(s, 0)));
+	ck_assert_int_eq(0, data_cmp(&b, sp_deque_get(s, 1)));
+
+	ck_assert_int_eq(0, sp_deque_pushback(s, &c));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_get(s, 0)));
+	ck_assert_int_eq(0, data_cmp(&b, sp_deque_get(s, 1)));
+	ck_assert_int_eq(0, data_cmp(&c, sp_deque_get(s, 2)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(get_string)
+{
+	setup(char*, 10);
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_str_eq("first", sp_deque_getstr(s, 0));
+
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_str_eq("first", sp_deque_getstr(s, 0));
+	ck_assert_str_eq("second", sp_deque_getstr(s, 1));
+
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "third"));
+	ck_assert_str_eq("first", sp_deque_getstr(s, 0));
+	ck_assert_str_eq("second", sp_deque_getstr(s, 1));
+	ck_assert_str_eq("third", sp_deque_getstr(s, 2));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	ck_assert_int_eq(0, sp_deque_geti(NULL, 0));
+	ck_assert_ptr_null(sp_deque_get(NULL, 0));
+	ck_assert_ptr_null(sp_deque_getstr(NULL, 0));
+}
+END_TEST
+
+START_TEST(get_bad_elem_size)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int) + 1, 20));
+	ck_assert_int_eq(0, sp_deque_geti(s, 0));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*) + 1, 20));
+	ck_assert_ptr_null(sp_deque_getstr(s, 0));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(get_bad_index)
+{
+	struct sp_deque *s;
+	struct data a;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 10));
+	ck_assert_int_eq(0, sp_deque_geti(s, 0));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_deque_geti(s, 1));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(0, sp_deque_geti(s, 2));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 10));
+	ck_assert_ptr_null(sp_deque_get(s, 0));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_ptr_null(sp_deque_get(s, 1));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_ptr_null(sp_deque_get(s, 2));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+	data_dtor(&a);
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 10));
+	ck_assert_ptr_null(sp_deque_getstr(s, 0));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_ptr_null(sp_deque_getstr(s, 1));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_ptr_null(sp_deque_getstr(s, 2));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_basic);
+	tcase_add_test(tc, get_object);
+	tcase_add_test(tc, get_string);
+	tcase_add_test(tc, get_bad_args);
+	tcase_add_test(tc, get_bad_elem_size);
+	tcase_add_test(tc, get_bad_index);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,147 @@
+#define setup(T, X) \
+	struct sp_deque *s; \
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_deque_destroy(s, D));
+
+START_TEST(peek_basic)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(peek_object)
+{
+	struct data a, b, c;
+	setup(struct data, 10);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &b));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &c));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(peek_string)
+{
+	setup(char*, 10);
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "third"));
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(peek_back)
+{
+	setup(int, 2);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(1, sp_deque_peekbacki(s));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(2, sp_deque_peekbacki(s));
+	ck_assert_int_eq(0, sp_deque_pushfronti(s, 3));
+	ck_assert_int_eq(2, sp_deque_peekbacki(s));
+	ck_assert_int_eq(3, sp_deque_peekfronti(s));
+	ck_assert_int_eq(2, *(int*)sp_deque_peekback(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 2));
+	ck_assert_ptr_null(sp_deque_peekbackstr(s));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_str_eq("second", sp_deque_peekbackstr(s));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(peek_empty)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 10));
+	ck_assert_int_eq(0, sp_deque_peekfronti(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 10));
+	ck_assert_ptr_null(sp_deque_peekfront(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, data_dtor));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 10));
+	ck_assert_ptr_null(sp_deque_peekfrontstr(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(peek_bad_args)
+{
+	struct data a;
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 10));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_deque_peekfronti(NULL));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 10));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_ptr_null(sp_deque_peekfront(NULL));
+	ck_assert_int_eq(0, sp_deque_destroy(s, data_dtor));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 10));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "abc"));
+	ck_assert_ptr_null(sp_deque_peekfrontstr(NULL));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(peek_bad_elem_size)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(1, 10));
+	ck_assert_int_eq(0, sp_deque_peekfronti(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(1, 10));
+	ck_assert_ptr_null(sp_deque_peekfrontstr(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+void init_peek(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, peek_basic);
+	tcase_add_test(tc, peek_object);
+	tcase_add_test(tc, peek_string);
+	tcase_add_test(tc, peek_back);
+	tcase_add_test(tc, peek_empty);
+	tcase_add_test(tc, peek_bad_args);
+	tcase_add_test(tc, peek_bad_elem_size);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,220 @@
+#define setup(T, X) \
+	struct sp_deque *s; \
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_deque_destroy(s, D));
+
+START_TEST(pop_basic)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_int_eq(1, sp_deque_popfronti(s));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(2, sp_deque_popfronti(s));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 4));
+	ck_assert_int_eq(3, sp_deque_popfronti(s));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(4, sp_deque_popfronti(s));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pop_object)
+{
+	struct data a, b, c, d;
+	setup(struct data, 10);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	data_init(&d);
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &b));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &c));
+	ck_assert_int_eq(0, sp_deque_popfront(s, data_dtor));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(0, sp_deque_popfront(s, data_dtor));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_deque_pushback(s, &d));
+	ck_assert_int_eq(0, sp_deque_popfront(s, data_dtor));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_deque_popfront(s, data_dtor));
+	ck_assert_uint_eq(0, s->size);
+
+	/* `a` is uninitialized, but it doesn't matter. */
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, sp_deque_popfront(s, NULL));
+	ck_assert_uint_eq(0, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(pop_string)
+{
+	char *str;
+	setup(char*, 10);
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "third"));
+	ck_assert_ptr_nonnull(str = sp_deque_popfrontstr(s));
+	ck_assert_str_eq("first", str);
+	free(str);
+	ck_assert_ptr_nonnull(str = sp_deque_popfrontstr(s));
+	ck_assert_str_eq("second", str);
+	free(str);
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "fourth"));
+	ck_assert_ptr_nonnull(str = sp_deque_popfrontstr(s));
+	ck_assert_str_eq("third", str);
+	free(str);
+	ck_assert_ptr_nonnull(str = sp_deque_popfrontstr(s));
+	ck_assert_str_eq("fourth", str);
+	free(str);
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(pop_back)
+{
+	char *str;
+	setup(int, 2);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_int_eq(3, sp_deque_popbacki(s));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(1, sp_deque_popfronti(s));
+	ck_assert_int_eq(0, sp_deque_popback(s, NULL));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 2));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_ptr_nonnull(str = sp_deque_popbackstr(s));
+	ck_assert_str_eq("second", str);
+	free(str);
+	ck_assert_int_eq(0, sp_deque_popback(s, sp_free));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_ptr_null(sp_deque_popbackstr(s));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(pop_random)
+{
+	int ref[512];
+	size_t lo, hi, i;
+	setup(int, 5);
+	/* Model the deque with a window into a plain array */
+	lo = hi = LEN(ref) / 2;
+	for (i = 0; i < 5000; i++) {
+		switch (rand() % 4) {
+		case 0:
+			if (lo == 0)
+				break;
+			ref[--lo] = i;
+			ck_assert_int_eq(0, sp_deque_pushfronti(s, i));
+			break;
+		case 1:
+			if (hi == LEN(ref))
+				break;
+			ref[hi++] = i;
+			ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+			break;
+		case 2:
+			if (lo == hi)
+				break;
+			ck_assert_int_eq(ref[lo++], sp_deque_popfronti(s));
+			break;
+		case 3:
+			if (lo == hi)
+				break;
+			ck_assert_int_eq(ref[--hi], sp_deque_popbacki(s));
+			break;
+		}
+		ck_assert_uint_eq(hi - lo, s->size);
+		if (lo != hi) {
+			ck_assert_int_eq(ref[lo], sp_deque_peekfronti(s));
+			ck_assert_int_eq(ref[hi - 1], sp_deque_peekbacki(s));
+		}
+	}
+	for (i = lo; i < hi; i++)
+		ck_assert_int_eq(ref[i], sp_deque_geti(s, i - lo));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pop_empty)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 20));
+	ck_assert_int_eq(0, sp_deque_popfronti(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 20));
+	ck_assert_int_eq(SP_EILLEGAL, sp_deque_popfront(s, NULL));
+	ck_assert_int_eq(0, sp_deque_destroy(s, data_dtor));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 20));
+	ck_assert_ptr_null(sp_deque_popfrontstr(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(pop_bad_args)
+{
+	ck_assert_int_eq(0, sp_deque_popfronti(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_popfront(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_popfront(NULL, data_dtor));
+	ck_assert_ptr_null(sp_deque_popfrontstr(NULL));
+}
+END_TEST
+
+START_TEST(pop_bad_elem_size)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(1, 20));
+	ck_assert_int_eq(0, sp_deque_popfronti(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(1, 20));
+	ck_assert_ptr_null(sp_deque_popfrontstr(s));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(pop_bad_dtor)
+{
+	struct data a, b, c;
+	setup(struct data, 10);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &b));
+	ck_assert_int_eq(0, sp_deque_pushback(s, &c));
+	ck_assert_int_eq(SP_ECALLBK, sp_deque_popfront(s, data_dtor_bad));
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_pop(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pop_basic);
+	tcase_add_test(tc, pop_object);
+	tcase_add_test(tc, pop_string);
+	tcase_add_test(tc, pop_back);
+	tcase_add_test(tc, pop_random);
+	tcase_add_test(tc, pop_empty);
+	tcase_add_test(tc, pop_bad_args);
+	tcase_add_test(tc, pop_bad_elem_size);
+	tcase_add_test(tc, pop_bad_dtor);
+}
+
+#undef setup
+#undef teardown
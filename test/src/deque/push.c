@@ -0,0 +1,292 @@
+#define setup(T, X) \
+	struct sp_deque *s; \
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_deque_destroy(s, D));
+
+START_TEST(push_basic)
+{
+	setup(int, 30);
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 1));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 2));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(2, sp_deque_geti(s, 1));
+
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+	ck_assert_int_eq(2, sp_deque_geti(s, 1));
+	ck_assert_int_eq(3, sp_deque_geti(s, 2));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(push_object)
+{
+	struct data a, b, c;
+	setup(struct data, 30);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+
+	ck_assert_int_eq(0, sp_deque_pushback(s, &b));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, data_cmp(&b, sp_deque_get(s, 1)));
+
+	ck_assert_int_eq(0, sp_deque_pushback(s, &c));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_deque_peekfront(s)));
+	ck_assert_int_eq(0, data_cmp(&b, sp_deque_get(s, 1)));
+	ck_assert_int_eq(0, data_cmp(&c, sp_deque_get(s, 2)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(push_string)
+{
+	setup(char*, 20);
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "first"));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "second"));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("second", sp_deque_getstr(s, 1));
+
+	ck_assert_int_eq(0, sp_deque_pushbackstr(s, "third"));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_str_eq("first", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("second", sp_deque_getstr(s, 1));
+	ck_assert_str_eq("third", sp_deque_getstr(s, 2));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(push_substring)
+{
+	setup(char*, 20);
+	ck_assert_int_eq(0, sp_deque_pushbackstrn(s, "first", 0));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_str_eq("", sp_deque_peekfrontstr(s));
+
+	ck_assert_int_eq(0, sp_deque_pushbackstrn(s, "second", 3));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_str_eq("", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("sec", sp_deque_getstr(s, 1));
+
+	ck_assert_int_eq(0, sp_deque_pushbackstrn(s, "third", 5));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_str_eq("", sp_deque_peekfrontstr(s));
+	ck_assert_str_eq("sec", sp_deque_getstr(s, 1));
+	ck_assert_str_eq("third", sp_deque_getstr(s, 2));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(push_front)
+{
+	setup(int, 4);
+	ck_assert_int_eq(0, sp_deque_pushfronti(s, 1));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(1, sp_deque_peekfronti(s));
+
+	ck_assert_int_eq(0, sp_deque_pushfronti(s, 2));
+	ck_assert_int_eq(0, sp_deque_pushbacki(s, 3));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_int_eq(2, sp_deque_geti(s, 0));
+	ck_assert_int_eq(1, sp_deque_geti(s, 1));
+	ck_assert_int_eq(3, sp_deque_geti(s, 2));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(push_front_string)
+{
+	setup(char*, 2);
+	ck_assert_int_eq(0, sp_deque_pushfrontstr(s, "first"));
+	ck_assert_int_eq(0, sp_deque_pushfrontstrn(s, "second", 3));
+	ck_assert_int_eq(0, sp_deque_pushfrontstr(s, "third"));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_str_eq("third", sp_deque_getstr(s, 0));
+	ck_assert_str_eq("sec", sp_deque_getstr(s, 1));
+	ck_assert_str_eq("first", sp_deque_getstr(s, 2));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(push_both_ends)
+{
+	int i;
+	setup(int, 3);
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, sp_deque_pushfronti(s, -i));
+		ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+	}
+	ck_assert_uint_eq(200, s->size);
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(-99 + i, sp_deque_geti(s, i));
+		ck_assert_int_eq(i, sp_deque_geti(s, 100 + i));
+	}
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(push_pointer_stability)
+{
+	int *addr[300];
+	int i;
+	setup(int, 7);
+	/* Growing the deque on either end must not move existing elements */
+	for (i = 0; i < 300; i++) {
+		if (i % 2)
+			ck_assert_int_eq(0, sp_deque_pushfronti(s, i));
+		else
+			ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+		addr[i] = i % 2 ? sp_deque_peekfront(s) : sp_deque_peekback(s);
+	}
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(i, *addr[i]);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(push_steady_state)
+{
+	size_t nblocks;
+	int i;
+	setup(int, 8);
+	for (i = 0; i < 20; i++)
+		ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+		ck_assert_int_eq(i < 20 ? i : i - 20, sp_deque_popfronti(s));
+	}
+	/* Once the map has been re-centered, spare blocks are reused and the
+	 * map does not grow any further */
+	nblocks = s->nblocks;
+	for (i = 0; i < 1000; i++) {
+		ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+		ck_assert_int_eq(0, sp_deque_popfront(s, NULL));
+	}
+	ck_assert_uint_eq(nblocks, s->nblocks);
+	ck_assert_uint_eq(20, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(push_bad_args)
+{
+	struct data a;
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbacki(NULL, 1));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushback(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushback(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushback(NULL, &a));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+	data_dtor(&a);
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbackstr(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbackstr(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbackstr(NULL, "abc"));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbackstrn(NULL, NULL, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbackstrn(s, NULL, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_deque_pushbackstrn(NULL, "abc", 0));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(push_bad_elem_size)
+{
+	struct sp_deque *s;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int) + 1, 10));
+	ck_assert_int_eq(SP_EILLEGAL, sp_deque_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*) + 1, 10));
+	ck_assert_int_eq(SP_EILLEGAL, sp_deque_pushbackstr(s, "abc"));
+	ck_assert_int_eq(SP_EILLEGAL, sp_deque_pushbackstrn(s, "abc", 3));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(push_buffer_max_limit)
+{
+	struct data a;
+	struct sp_deque *s;
+	size_t i;
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(int), 10));
+	for (i = 0; i < SIZE_MAX / s->elem_size; i++)
+		ck_assert_int_eq(0, sp_deque_pushbacki(s, i));
+	ck_assert_int_eq(SP_ERANGE, sp_deque_pushbacki(s, 0));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(struct data), 10));
+	for (i = 0; i < SIZE_MAX / s->elem_size; i++)
+		ck_assert_int_eq(0, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(SP_ERANGE, sp_deque_pushback(s, &a));
+	ck_assert_int_eq(0, sp_deque_destroy(s, NULL));
+	data_dtor(&a);
+
+	ck_assert_ptr_nonnull(s = sp_deque_create(sizeof(char*), 10));
+	for (i = 0; i < SIZE_MAX / s->elem_size; i++)
+		ck_assert_int_eq(0, sp_deque_pushbackstr(s, "abc"));
+	ck_assert_int_eq(SP_ERANGE, sp_deque_pushbackstr(s, "abc"));
+	ck_assert_int_eq(SP_ERANGE, sp_deque_pushbackstrn(s, "abc", 2));
+	ck_assert_int_eq(0, sp_deque_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(push_string_too_long)
+{
+	size_t i;
+	char *str;
+	setup(char*, 10);
+	/* SIZE_MAX + 1 is safe, because we redefined SIZE_MAX to be small */
+	ck_assert_ptr_nonnull(str = malloc(sizeof(char) * (SIZE_MAX + 1)));
+	for (i = 0; i < SIZE_MAX + 1; i++)
+		str[i] = ' ';
+	str[SIZE_MAX] = '\0';
+	ck_assert_int_eq(SP_ERANGE, sp_deque_pushbackstr(s, str));
+	ck_assert_int_eq(SP_ERANGE, sp_deque_pushbackstrn(s, str, SIZE_MAX));
+	free(str);
+	teardown(sp_free);
+}
+END_TEST
+
+void init_push(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, push_basic);
+	tcase_add_test(tc, push_object);
+	tcase_add_test(tc, push_string);
+	tcase_add_test(tc, push_substring);
+	tcase_add_test(tc, push_front);
+	tcase_add_test(tc, push_front_string);
+	tcase_add_test(tc, push_both_ends);
+	tcase_add_test(tc, push_pointer_stability);
+	tcase_add_test(tc, push_steady_state);
+	tcase_add_test(tc, push_bad_args);
+	tcase_add_test(tc, push_bad_elem_size);
+	tcase_add_test(tc, push_buffer_max_limit);
+	tcase_add_test(tc, push_string_too_long);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,69 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_fenwick.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks every element and every prefix sum against a plain array */
+static void fenwick_check(const struct sp_fenwick *fw, const long *vals)
+{
+	size_t i;
+	long sum = 0;
+	ck_assert_int_eq(0, sp_fenwick_prefixl(fw, 0));
+	for (i = 0; i < fw->size; i++) {
+		ck_assert_int_eq(vals[i], sp_fenwick_getl(fw, i));
+		sum += vals[i];
+		ck_assert_int_eq(sum, sp_fenwick_prefixl(fw, i + 1));
+	}
+}
+
+#include "fenwick/create.c"
+#include "fenwick/update.c"
+#include "fenwick/query.c"
+#include "fenwick/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_update = tcase_create("update"),
+	      *tc_query  = tcase_create("query"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("fenwick");
+	init_and_add(create);
+	init_and_add(update);
+	init_and_add(query);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,46 @@
+START_TEST(create_ok)
+{
+	struct sp_fenwick *fw;
+	long vals[10] = {0};
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), LEN(vals)));
+	ck_assert_ptr_nonnull(fw->data);
+	ck_assert_uint_eq(sizeof(long), fw->elem_size);
+	ck_assert_uint_eq(LEN(vals), fw->size);
+	fenwick_check(fw, vals);
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_fenwick_create(0, 10));
+	ck_assert_ptr_null(sp_fenwick_create(1, 0));
+	ck_assert_ptr_null(sp_fenwick_create(SIZE_MAX, 2));
+	ck_assert_ptr_null(sp_fenwick_create(2, SIZE_MAX));
+	ck_assert_int_eq(SP_EINVAL, sp_fenwick_clear(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_fenwick_destroy(NULL));
+}
+END_TEST
+
+START_TEST(create_clear)
+{
+	struct sp_fenwick *fw;
+	long vals[37];
+	size_t i;
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), LEN(vals)));
+	for (i = 0; i < LEN(vals); i++)
+		ck_assert_int_eq(0, sp_fenwick_addl(fw, i, rand() % 100));
+	ck_assert_int_eq(0, sp_fenwick_clear(fw));
+	memset(vals, 0, sizeof(vals));
+	fenwick_check(fw, vals);
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear);
+}
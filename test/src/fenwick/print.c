@@ -0,0 +1,18 @@
+START_TEST(print_suffixed)
+{
+	struct sp_fenwick *fw;
+	const int vals[] = {3, 1, 4, 1, 5};
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(int), LEN(vals)));
+	ck_assert_int_eq(0, sp_fenwick_buildi(fw, vals));
+	ck_assert_int_eq(0, sp_fenwick_printi(fw));
+	ck_assert_int_eq(SP_EILLEGAL, sp_fenwick_printd(fw));
+	ck_assert_int_eq(SP_EINVAL, sp_fenwick_printi(NULL));
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_suffixed);
+}
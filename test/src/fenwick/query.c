@@ -0,0 +1,70 @@
+START_TEST(query_sum)
+{
+	struct sp_fenwick *fw;
+	long vals[50];
+	size_t i, j, k;
+	for (i = 0; i < LEN(vals); i++)
+		vals[i] = rand() % 201 - 100;
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), LEN(vals)));
+	ck_assert_int_eq(0, sp_fenwick_buildl(fw, vals));
+	for (i = 0; i <= LEN(vals); i++)
+	for (j = 0; i + j <= LEN(vals); j++) {
+		long sum = 0;
+		for (k = i; k < i + j; k++)
+			sum += vals[k];
+		ck_assert_int_eq(sum, sp_fenwick_suml(fw, i, j));
+	}
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+START_TEST(query_lowerbound)
+{
+	struct sp_fenwick *fw;
+	unsigned long vals[41], prefix[42], target;
+	size_t i;
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(unsigned long), LEN(vals)));
+	prefix[0] = 0;
+	for (i = 0; i < LEN(vals); i++) {
+		/* Runs of empty buckets are the interesting case */
+		vals[i] = rand() % 3 == 0 ? 0 : rand() % 10;
+		prefix[i + 1] = prefix[i] + vals[i];
+	}
+	ck_assert_int_eq(0, sp_fenwick_buildul(fw, vals));
+	for (target = 0; target <= prefix[LEN(vals)] + 1; target++) {
+		size_t expect = 0;
+		while (expect < LEN(vals) && prefix[expect + 1] < target)
+			expect++;
+		ck_assert_uint_eq(expect, sp_fenwick_lowerboundul(fw, target));
+	}
+	ck_assert_uint_eq(LEN(vals), sp_fenwick_lowerboundul(fw, prefix[LEN(vals)] + 1));
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+START_TEST(query_bad_args)
+{
+	struct sp_fenwick *fw;
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), 8));
+	ck_assert_int_eq(0, sp_fenwick_addl(fw, 7, 3));
+	ck_assert_int_eq(3, sp_fenwick_prefixl(fw, 8));
+	ck_assert_int_eq(0, sp_fenwick_prefixl(fw, 9));
+	ck_assert_int_eq(0, sp_fenwick_prefixl(NULL, 0));
+	ck_assert_int_eq(3, sp_fenwick_suml(fw, 7, 1));
+	ck_assert_int_eq(0, sp_fenwick_suml(fw, 8, 0));
+	ck_assert_int_eq(0, sp_fenwick_suml(fw, 7, 2));
+	ck_assert_int_eq(0, sp_fenwick_suml(fw, 9, 0));
+	ck_assert_int_eq(0, sp_fenwick_sumi(fw, 0, 8));
+	ck_assert_uint_eq(0, sp_fenwick_lowerboundi(fw, 1));
+	ck_assert_uint_eq(0, sp_fenwick_lowerboundl(NULL, 1));
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+void init_query(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, query_sum);
+	tcase_add_test(tc, query_lowerbound);
+	tcase_add_test(tc, query_bad_args);
+}
@@ -0,0 +1,82 @@
+START_TEST(update_build)
+{
+	struct sp_fenwick *fw;
+	long vals[100];
+	size_t n, i;
+	for (n = 1; n <= LEN(vals); n++) {
+		ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), n));
+		for (i = 0; i < n; i++)
+			vals[i] = rand() % 201 - 100;
+		ck_assert_int_eq(0, sp_fenwick_buildl(fw, vals));
+		fenwick_check(fw, vals);
+		ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+	}
+}
+END_TEST
+
+START_TEST(update_add_set)
+{
+	struct sp_fenwick *fw;
+	long vals[77] = {0};
+	size_t i;
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), LEN(vals)));
+	for (i = 0; i < 2000; i++) {
+		const size_t idx = rand() % LEN(vals);
+		const long val = rand() % 201 - 100;
+		if (rand() % 2) {
+			vals[idx] += val;
+			ck_assert_int_eq(0, sp_fenwick_addl(fw, idx, val));
+		} else {
+			vals[idx] = val;
+			ck_assert_int_eq(0, sp_fenwick_setl(fw, idx, val));
+		}
+		if (i % 100 == 0)
+			fenwick_check(fw, vals);
+	}
+	fenwick_check(fw, vals);
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+START_TEST(update_floating)
+{
+	struct sp_fenwick *fw;
+	const double vals[] = {0.5, 1.25, -2, 4, 0.125, 8};
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(double), LEN(vals)));
+	ck_assert_int_eq(0, sp_fenwick_buildd(fw, vals));
+	ck_assert_double_eq(11.875, sp_fenwick_prefixd(fw, LEN(vals)));
+	ck_assert_double_eq(-2, sp_fenwick_getd(fw, 2));
+	ck_assert_int_eq(0, sp_fenwick_setd(fw, 2, 2));
+	ck_assert_double_eq(2, sp_fenwick_getd(fw, 2));
+	ck_assert_double_eq(6.125, sp_fenwick_sumd(fw, 2, 3));
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+START_TEST(update_bad_args)
+{
+	struct sp_fenwick *fw;
+	long vals[4] = {0};
+	ck_assert_ptr_nonnull(fw = sp_fenwick_create(sizeof(long), LEN(vals)));
+	ck_assert_int_eq(SP_EINVAL, sp_fenwick_addl(NULL, 0, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_fenwick_addl(fw, 4, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_fenwick_addi(fw, 0, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_fenwick_setl(fw, 4, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_fenwick_setc(fw, 0, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_fenwick_buildl(fw, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_fenwick_buildi(fw, (const int*)vals));
+	ck_assert_int_eq(0, sp_fenwick_getl(fw, 4));
+	ck_assert_int_eq(0, sp_fenwick_getl(NULL, 0));
+	fenwick_check(fw, vals);
+	ck_assert_int_eq(0, sp_fenwick_destroy(fw));
+}
+END_TEST
+
+void init_update(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, update_build);
+	tcase_add_test(tc, update_add_set);
+	tcase_add_test(tc, update_floating);
+	tcase_add_test(tc, update_bad_args);
+}
@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_hashmap.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+#include "hashmap/create.c"
+#include "hashmap/destroy.c"
+#include "hashmap/clear.c"
+#include "hashmap/reserve.c"
+#include "hashmap/insert.c"
+#include "hashmap/get.c"
+#include "hashmap/remove.c"
+#include "hashmap/eq.c"
+#include "hashmap/copy.c"
+#include "hashmap/map.c"
+#include "hashmap/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create  = tcase_create("create"),
+	      *tc_destroy = tcase_create("destroy"),
+	      *tc_clear   = tcase_create("clear"),
+	      *tc_reserve = tcase_create("reserve"),
+	      *tc_insert  = tcase_create("insert"),
+	      *tc_get     = tcase_create("get"),
+	      *tc_remove  = tcase_create("remove"),
+	      *tc_eq      = tcase_create("eq"),
+	      *tc_copy    = tcase_create("copy"),
+	      *tc_map     = tcase_create("map"),
+	      *tc_print   = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("hashmap");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(clear);
+	init_and_add(reserve);
+	init_and_add(insert);
+	init_and_add(get);
+	init_and_add(remove);
+	init_and_add(eq);
+	init_and_add(copy);
+	init_and_add(map);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,68 @@
+START_TEST(clear_ok)
+{
+	struct sp_hashmap *s;
+	size_t capacity;
+	int i, v = 0;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(int), 10, NULL, NULL));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &i));
+	capacity = s->capacity;
+	ck_assert_int_eq(0, sp_hashmap_clear(s, NULL, NULL));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(capacity, s->capacity);
+	for (i = 0; i < 100; i++)
+		ck_assert_ptr_null(sp_hashmap_geti(s, i));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, 5, &v));
+	ck_assert_ptr_nonnull(sp_hashmap_geti(s, 5));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(clear_object)
+{
+	struct sp_hashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(struct data), sizeof(struct data), 5, NULL, NULL));
+	for (i = 0; i < 10; i++) {
+		struct data k, v;
+		ck_assert_int_eq(0, data_init(&k));
+		ck_assert_int_eq(0, data_init(&v));
+		ck_assert_int_eq(0, sp_hashmap_insert(s, &k, &v));
+	}
+	ck_assert_int_eq(0, sp_hashmap_clear(s, data_dtor, data_dtor));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(clear_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_clear(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_clear(NULL, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(clear_bad_dtor)
+{
+	struct sp_hashmap *s;
+	struct data a;
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(struct data), 10, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, 1, &a));
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_clear(s, data_dtor_bad, NULL));
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_clear(s, NULL, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_hashmap_clear(s, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+	data_dtor(&a);
+}
+END_TEST
+
+void init_clear(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, clear_ok);
+	tcase_add_test(tc, clear_object);
+	tcase_add_test(tc, clear_bad_args);
+	tcase_add_test(tc, clear_bad_dtor);
+}
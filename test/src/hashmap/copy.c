@@ -0,0 +1,83 @@
+START_TEST(copy_ok)
+{
+	struct sp_hashmap *s1, *s2;
+	int i;
+	ck_assert_ptr_nonnull(s1 = sp_hashmap_create(sizeof(int), sizeof(int), 10, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(char), sizeof(char), 10, NULL, NULL));
+	for (i = 0; i < 300; i++)
+		ck_assert_int_eq(0, sp_hashmap_inserti(s1, i, &i));
+	for (i = 0; i < 300; i += 2)
+		ck_assert_int_eq(0, sp_hashmap_removei(s1, i, NULL));
+	ck_assert_int_eq(0, sp_hashmap_copy(s2, s1, NULL, NULL));
+	ck_assert_uint_eq(s1->key_size, s2->key_size);
+	ck_assert_uint_eq(s1->val_size, s2->val_size);
+	ck_assert_uint_eq(s1->size, s2->size);
+	ck_assert_uint_eq(s1->capacity, s2->capacity);
+	ck_assert_int_eq(1, sp_hashmap_eq(s1, s2, NULL));
+	for (i = 1; i < 300; i += 2)
+		ck_assert_int_eq(i, *(int*)sp_hashmap_geti(s2, i));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s2, 0, &i));
+	ck_assert_ptr_null(sp_hashmap_geti(s1, 0));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s1, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, NULL));
+}
+END_TEST
+
+START_TEST(copy_object)
+{
+	struct sp_hashmap *s1, *s2;
+	int i;
+	ck_assert_ptr_nonnull(s1 = sp_hashmap_create(sizeof(struct data), sizeof(struct data), 10, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(1, 1, 1, NULL, NULL));
+	for (i = 0; i < 20; i++) {
+		struct data k, v;
+		ck_assert_int_eq(0, data_init(&k));
+		ck_assert_int_eq(0, data_init(&v));
+		ck_assert_int_eq(0, sp_hashmap_insert(s1, &k, &v));
+	}
+	ck_assert_int_eq(0, sp_hashmap_copy(s2, s1, data_cpy, data_cpy));
+	ck_assert_uint_eq(s1->size, s2->size);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s1, data_dtor, data_dtor));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(copy_bad_args)
+{
+	struct sp_hashmap *s;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(int), 10, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_copy(NULL, s, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_copy(s, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_copy(NULL, NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(copy_bad_callback)
+{
+	struct sp_hashmap *s1, *s2;
+	int i;
+	ck_assert_ptr_nonnull(s1 = sp_hashmap_create(sizeof(int), sizeof(struct data), 10, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(int), sizeof(struct data), 10, NULL, NULL));
+	for (i = 0; i < 5; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s1, i, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_copy(s2, s1, NULL, data_cpy_bad));
+	ck_assert_uint_eq(0, s2->size);
+	for (i = 0; i < 5; i++)
+		ck_assert_ptr_null(sp_hashmap_geti(s2, i));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s1, NULL, data_dtor));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, data_dtor));
+}
+END_TEST
+
+void init_copy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, copy_ok);
+	tcase_add_test(tc, copy_object);
+	tcase_add_test(tc, copy_bad_args);
+	tcase_add_test(tc, copy_bad_callback);
+}
@@ -0,0 +1,56 @@
+START_TEST(create_ok)
+{
+	struct sp_hashmap *s;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(double), 10, NULL, NULL));
+	ck_assert_uint_eq(sizeof(int), s->key_size);
+	ck_assert_uint_eq(sizeof(double), s->val_size);
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_ge(s->capacity - s->capacity / 8, 10);
+	ck_assert_uint_eq(0, s->capacity & (s->capacity - 1));
+	ck_assert_uint_eq(0, s->val_offset % sizeof(double));
+	ck_assert_uint_eq(0, s->slot_size % sizeof(double));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(1, 1, 1, NULL, NULL));
+	ck_assert_uint_eq(1, s->val_offset);
+	ck_assert_uint_eq(2, s->slot_size);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(3, 5, 1, NULL, NULL));
+	ck_assert_uint_eq(3, s->val_offset);
+	ck_assert_uint_eq(8, s->slot_size);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+
+	/* 16384 slots of 2 bytes each, 7/8 of which are usable */
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(1, 1, 14336, NULL, NULL));
+	ck_assert_uint_eq(16384, s->capacity);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_hashmap_create(1, 1, 14337, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(SIZE_MAX, 1, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(1, SIZE_MAX, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(SIZE_MAX / 8, SIZE_MAX / 8, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(1, 1, SIZE_MAX, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_hashmap_create(0, 1, 10, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(1, 0, 10, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(1, 1, 0, NULL, NULL));
+	ck_assert_ptr_null(sp_hashmap_create(0, 0, 0, NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,50 @@
+START_TEST(destroy_ok)
+{
+	struct sp_hashmap *s;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(int), 10, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(destroy_object)
+{
+	struct sp_hashmap *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(struct data), sizeof(struct data), 10, NULL, NULL));
+	for (i = 0; i < 20; i++) {
+		struct data k, v;
+		ck_assert_int_eq(0, data_init(&k));
+		ck_assert_int_eq(0, data_init(&v));
+		ck_assert_int_eq(0, sp_hashmap_insert(s, &k, &v));
+	}
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_destroy(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_destroy(NULL, data_dtor, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_dtor)
+{
+	struct sp_hashmap *s;
+	struct data a;
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(struct data), 10, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, 7, &a));
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_destroy(s, NULL, data_dtor_bad));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, data_dtor));
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_object);
+	tcase_add_test(tc, destroy_bad_args);
+	tcase_add_test(tc, destroy_bad_dtor);
+}
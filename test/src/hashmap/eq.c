@@ -0,0 +1,92 @@
+START_TEST(eq_ok)
+{
+	struct sp_hashmap *s1, *s2;
+	int i;
+	ck_assert_ptr_nonnull(s1 = sp_hashmap_create(sizeof(int), sizeof(int), 1, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(int), sizeof(int), 1000, NULL, NULL));
+	ck_assert_int_eq(1, sp_hashmap_eq(s1, s2, NULL));
+
+	/* Capacities and insertion order do not matter */
+	for (i = 0; i < 500; i++) {
+		int j = 499 - i;
+		ck_assert_int_eq(0, sp_hashmap_inserti(s1, i, &i));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s2, j, &j));
+	}
+	ck_assert_uint_ne(s1->capacity, s2->capacity);
+	ck_assert_int_eq(1, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(1, sp_hashmap_eq(s2, s1, NULL));
+
+	i = -1;
+	ck_assert_int_eq(0, sp_hashmap_inserti(s1, 100, &i));
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s2, 100, &i));
+	ck_assert_int_eq(1, sp_hashmap_eq(s1, s2, NULL));
+
+	ck_assert_int_eq(0, sp_hashmap_inserti(s1, 1000, &i));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s2, 1001, &i));
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_hashmap_removei(s1, 1000, NULL));
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_hashmap_removei(s2, 1001, NULL));
+	ck_assert_int_eq(1, sp_hashmap_eq(s1, s2, NULL));
+
+	ck_assert_int_eq(0, sp_hashmap_destroy(s1, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, NULL));
+}
+END_TEST
+
+START_TEST(eq_object)
+{
+	struct sp_hashmap *s1, *s2;
+	int i;
+	ck_assert_ptr_nonnull(s1 = sp_hashmap_create(sizeof(int), sizeof(struct data), 10, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(int), sizeof(struct data), 10, NULL, NULL));
+	for (i = 0; i < 20; i++) {
+		struct data d1, d2;
+		ck_assert_int_eq(0, data_init(&d1));
+		ck_assert_int_eq(0, data_cpy(&d2, &d1));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s1, i, &d1));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s2, i, &d2));
+	}
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(1, sp_hashmap_eq(s1, s2, data_cmp));
+	((struct data*)sp_hashmap_geti(s2, 7))->id++;
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, data_cmp));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s1, NULL, data_dtor));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(eq_different_sizes)
+{
+	struct sp_hashmap *s1, *s2;
+	ck_assert_ptr_nonnull(s1 = sp_hashmap_create(sizeof(int), sizeof(int), 10, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(int), sizeof(long), 10, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, NULL));
+	ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(long), sizeof(int), 10, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s1, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, NULL));
+}
+END_TEST
+
+START_TEST(eq_bad_args)
+{
+	struct sp_hashmap *s;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(int), 10, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_eq(s, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_eq(NULL, s, NULL));
+	ck_assert_int_eq(0, sp_hashmap_eq(NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+void init_eq(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, eq_ok);
+	tcase_add_test(tc, eq_object);
+	tcase_add_test(tc, eq_different_sizes);
+	tcase_add_test(tc, eq_bad_args);
+}
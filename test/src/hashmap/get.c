@@ -0,0 +1,89 @@
+#define setup(K, V, X) \
+	struct sp_hashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(K), sizeof(V), X, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, K, V));
+
+START_TEST(get_ok)
+{
+	int i, keys[300];
+	setup(int, int, 10);
+	for (i = 0; i < 300; i++) {
+		keys[i] = rand() % 1000 * 300 + i;
+		ck_assert_int_eq(0, sp_hashmap_insert(s, &keys[i], &i));
+	}
+	for (i = 0; i < 300; i++) {
+		int *v;
+		ck_assert_ptr_nonnull(v = sp_hashmap_get(s, &keys[i]));
+		ck_assert_ptr_eq(v, sp_hashmap_geti(s, keys[i]));
+		ck_assert_int_eq(keys[*v], keys[i]);
+	}
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(get_missing)
+{
+	int i;
+	setup(int, int, 10);
+	i = 0;
+	ck_assert_ptr_null(sp_hashmap_get(s, &i));
+	ck_assert_ptr_null(sp_hashmap_geti(s, 0));
+	for (i = 0; i < 1000; i += 2)
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &i));
+	for (i = 1; i < 1000; i += 2)
+		ck_assert_ptr_null(sp_hashmap_geti(s, i));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(get_modify)
+{
+	setup(int, struct data, 10);
+	{
+		struct data d, *p;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, 9, &d));
+		ck_assert_ptr_nonnull(p = sp_hashmap_geti(s, 9));
+		p->id = 1234;
+		ck_assert_uint_eq(1234, ((struct data*)sp_hashmap_geti(s, 9))->id);
+	}
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	int k = 0;
+	setup(int, int, 10);
+	ck_assert_ptr_null(sp_hashmap_get(NULL, &k));
+	ck_assert_ptr_null(sp_hashmap_get(s, NULL));
+	ck_assert_ptr_null(sp_hashmap_geti(NULL, k));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(get_bad_key_size)
+{
+	int v = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, 1, &v));
+	ck_assert_ptr_null(sp_hashmap_getc(s, 1));
+	ck_assert_ptr_null(sp_hashmap_getd(s, 1));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_ok);
+	tcase_add_test(tc, get_missing);
+	tcase_add_test(tc, get_modify);
+	tcase_add_test(tc, get_bad_args);
+	tcase_add_test(tc, get_bad_key_size);
+}
+
+#undef setup
+#undef teardown
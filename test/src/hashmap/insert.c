@@ -0,0 +1,192 @@
+/* Keys are C strings, compared and hashed by content rather than address */
+static size_t str_hash(const void *key)
+{
+	const unsigned char *p = *(const unsigned char**)key;
+	size_t h = 5381;
+	while (*p)
+		h = h * 33 + *p++;
+	return h * 0x9E3779B1LU;
+}
+
+static int str_cmp(const void *a, const void *b)
+{
+	return strcmp(*(char**)a, *(char**)b);
+}
+
+#define setup(K, V, X) \
+	struct sp_hashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(K), sizeof(V), X, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, K, V));
+
+START_TEST(insert_ok)
+{
+	long i;
+	setup(long, long, 1);
+	for (i = 0; i < 1000; i++) {
+		long v = i * 3;
+		ck_assert_int_eq(0, sp_hashmap_insert(s, &i, &v));
+		ck_assert_uint_eq(i + 1, s->size);
+	}
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(i * 3, *(long*)sp_hashmap_get(s, &i));
+	ck_assert_uint_le(s->size, s->capacity - s->capacity / 8);
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_overwrite)
+{
+	int k = 42, v;
+	setup(int, int, 10);
+	v = 1;
+	ck_assert_int_eq(0, sp_hashmap_insert(s, &k, &v));
+	v = 2;
+	ck_assert_int_eq(0, sp_hashmap_insert(s, &k, &v));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(2, *(int*)sp_hashmap_get(s, &k));
+	v = 3;
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, k, &v));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(3, *(int*)sp_hashmap_geti(s, k));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_suffixed)
+{
+	int i;
+	{
+		setup(char, int, 10);
+		for (i = 0; i < 128; i++)
+			ck_assert_int_eq(0, sp_hashmap_insertc(s, i, &i));
+		for (i = 0; i < 128; i++)
+			ck_assert_int_eq(i, *(int*)sp_hashmap_getc(s, i));
+		ck_assert_uint_eq(128, s->size);
+		teardown(NULL, NULL);
+	}
+	{
+		setup(unsigned short, int, 10);
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(0, sp_hashmap_insertus(s, i * 7, &i));
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(i, *(int*)sp_hashmap_getus(s, i * 7));
+		teardown(NULL, NULL);
+	}
+	{
+		setup(unsigned long, int, 10);
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(0, sp_hashmap_insertul(s, (unsigned long)i << 20, &i));
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(i, *(int*)sp_hashmap_getul(s, (unsigned long)i << 20));
+		ck_assert_ptr_null(sp_hashmap_getul(s, 1));
+		teardown(NULL, NULL);
+	}
+	{
+		setup(double, int, 10);
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(0, sp_hashmap_insertd(s, i / 4.0, &i));
+		for (i = 0; i < 1000; i++)
+			ck_assert_int_eq(i, *(int*)sp_hashmap_getd(s, i / 4.0));
+		ck_assert_ptr_null(sp_hashmap_getd(s, 0.1));
+		teardown(NULL, NULL);
+	}
+	{
+		setup(long double, int, 10);
+		for (i = 0; i < 100; i++)
+			ck_assert_int_eq(0, sp_hashmap_insertld(s, i / 8.0L, &i));
+		for (i = 0; i < 100; i++)
+			ck_assert_int_eq(i, *(int*)sp_hashmap_getld(s, i / 8.0L));
+		teardown(NULL, NULL);
+	}
+}
+END_TEST
+
+START_TEST(insert_custom_hash)
+{
+	struct sp_hashmap *s;
+	char buf[16], *key;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(char*), sizeof(int), 10, str_hash, str_cmp));
+	for (i = 0; i < 500; i++) {
+		sprintf(buf, "key%d", i);
+		ck_assert_ptr_nonnull(key = malloc(strlen(buf) + 1));
+		strcpy(key, buf);
+		ck_assert_int_eq(0, sp_hashmap_insert(s, &key, &i));
+	}
+	for (i = 0; i < 500; i++) {
+		key = buf;
+		sprintf(buf, "key%d", i);
+		ck_assert_int_eq(i, *(int*)sp_hashmap_get(s, &key));
+	}
+	key = "key500";
+	ck_assert_ptr_null(sp_hashmap_get(s, &key));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, sp_free, NULL));
+}
+END_TEST
+
+START_TEST(insert_too_big)
+{
+	int i;
+	setup(char, char, 1);
+	for (i = 0; i < 256; i++) {
+		char c = i;
+		ck_assert_int_eq(0, sp_hashmap_insert(s, &c, &c));
+	}
+	teardown(NULL, NULL);
+	{
+		/* 8192 slots of 4 bytes is the limit, 7/8 of which are usable */
+		struct sp_hashmap *s2;
+		unsigned short k;
+		char v = 0;
+		ck_assert_ptr_nonnull(s2 = sp_hashmap_create(sizeof(k), 1, 1, NULL, NULL));
+		for (k = 0; k < 7 * 1024; k++)
+			ck_assert_int_eq(0, sp_hashmap_insertus(s2, k, &v));
+		ck_assert_int_eq(SP_ERANGE, sp_hashmap_insertus(s2, k, &v));
+		ck_assert_uint_eq(7 * 1024, s2->size);
+		ck_assert_int_eq(0, sp_hashmap_destroy(s2, NULL, NULL));
+	}
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	int k = 0, v = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_insert(NULL, &k, &v));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_insert(s, NULL, &v));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_insert(s, &k, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_inserti(NULL, k, &v));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_inserti(s, k, NULL));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(insert_bad_key_size)
+{
+	int v = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EILLEGAL, sp_hashmap_insertc(s, 1, &v));
+	ck_assert_int_eq(SP_EILLEGAL, sp_hashmap_insertd(s, 1, &v));
+	ck_assert_int_eq(SP_EILLEGAL, sp_hashmap_insertld(s, 1, &v));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL, NULL);
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_ok);
+	tcase_add_test(tc, insert_overwrite);
+	tcase_add_test(tc, insert_suffixed);
+	tcase_add_test(tc, insert_custom_hash);
+	tcase_add_test(tc, insert_too_big);
+	tcase_add_test(tc, insert_bad_args);
+	tcase_add_test(tc, insert_bad_key_size);
+}
+
+#undef setup
+#undef teardown
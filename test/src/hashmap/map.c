@@ -0,0 +1,73 @@
+/* Adapters from the hash map's key-value callbacks to the test_struct ones */
+static int kv_mutate(const void *key, void *val)
+{
+	return data_mutate(val, *(const int*)key);
+}
+
+static int kv_mutate_bad(const void *key, void *val)
+{
+	return data_mutate_bad(val, *(const int*)key);
+}
+
+static int kv_verify(const void *key, void *val)
+{
+	return data_verify(val, *(const int*)key);
+}
+
+#define setup(K, V, X) \
+	struct sp_hashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(K), sizeof(V), X, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, K, V));
+
+START_TEST(map_ok)
+{
+	int i;
+	setup(int, struct data, 10);
+	for (i = 0; i < 30; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i * 13, &d));
+	}
+	ck_assert_int_eq(0, sp_hashmap_map(s, kv_mutate));
+	ck_assert_int_eq(0, sp_hashmap_map(s, kv_verify));
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+START_TEST(map_bad_args)
+{
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_map(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_map(NULL, kv_mutate));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_map(NULL, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(map_bad_callback)
+{
+	int i;
+	setup(int, struct data, 10);
+	ck_assert_int_eq(0, sp_hashmap_map(s, kv_mutate_bad));
+	for (i = 0; i < 3; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_map(s, kv_mutate_bad));
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+void init_map(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, map_ok);
+	tcase_add_test(tc, map_bad_args);
+	tcase_add_test(tc, map_bad_callback);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,64 @@
+static int kv_print(const void *key, const void *val)
+{
+	printf("%d\t", *(const int*)key);
+	return data_print(val);
+}
+
+static int kv_print_bad(const void *key, const void *val)
+{
+	return data_print_bad(val);
+}
+
+#define setup(K, V, X) \
+	struct sp_hashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(K), sizeof(V), X, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, K, V));
+
+START_TEST(print_object)
+{
+	int i;
+	setup(int, struct data, 10);
+	ck_assert_int_eq(0, sp_hashmap_print(s, NULL));
+	ck_assert_int_eq(0, sp_hashmap_print(s, kv_print));
+	for (i = 0; i < 3; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &d));
+	}
+	ck_assert_int_eq(0, sp_hashmap_print(s, NULL));
+	ck_assert_int_eq(0, sp_hashmap_print(s, kv_print));
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_print(NULL, kv_print));
+}
+END_TEST
+
+START_TEST(print_bad_callback)
+{
+	struct data d;
+	setup(int, struct data, 10);
+	ck_assert_int_eq(0, sp_hashmap_print(s, kv_print_bad));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, 1, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_print(s, kv_print_bad));
+	teardown(NULL, data_dtor);
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_bad_args);
+	tcase_add_test(tc, print_bad_callback);
+}
+
+#undef setup
+#undef teardown
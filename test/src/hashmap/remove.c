@@ -0,0 +1,129 @@
+#define setup(K, V, X) \
+	struct sp_hashmap *s; \
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(K), sizeof(V), X, NULL, NULL));
+
+#define teardown(K, V) \
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, K, V));
+
+START_TEST(remove_ok)
+{
+	int i;
+	setup(int, int, 10);
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &i));
+	for (i = 0; i < 1000; i += 3) {
+		ck_assert_int_eq(0, sp_hashmap_remove(s, &i, NULL, NULL));
+		ck_assert_ptr_null(sp_hashmap_geti(s, i));
+	}
+	for (i = 1; i < 1000; i += 3)
+		ck_assert_int_eq(0, sp_hashmap_removei(s, i, NULL));
+	ck_assert_uint_eq(333, s->size);
+	for (i = 0; i < 1000; i++) {
+		if (i % 3 == 2)
+			ck_assert_int_eq(i, *(int*)sp_hashmap_geti(s, i));
+		else
+			ck_assert_ptr_null(sp_hashmap_geti(s, i));
+	}
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_churn)
+{
+	/* Repeated insertions and removals must not grow the table forever,
+	 * whatever tombstones they leave behind */
+	int keys[100], next = 0, i, j;
+	size_t capacity;
+	setup(int, int, 100);
+	capacity = s->capacity;
+	for (i = 0; i < 100; i++) {
+		keys[i] = next++;
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, keys[i], &i));
+	}
+	for (j = 0; j < 20000; j++) {
+		i = rand() % 100;
+		ck_assert_int_eq(0, sp_hashmap_removei(s, keys[i], NULL));
+		keys[i] = next++;
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, keys[i], &i));
+	}
+	ck_assert_uint_le(s->capacity, 2 * capacity);
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(i, *(int*)sp_hashmap_geti(s, keys[i]));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_object)
+{
+	struct sp_hashmap *s;
+	struct data k, v;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(struct data), sizeof(struct data), 10, NULL, NULL));
+	ck_assert_int_eq(0, data_init(&k));
+	ck_assert_int_eq(0, data_init(&v));
+	ck_assert_int_eq(0, sp_hashmap_insert(s, &k, &v));
+	ck_assert_int_eq(0, sp_hashmap_remove(s, &k, data_dtor, data_dtor));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_missing)
+{
+	int k = 5;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_ENOKEY, sp_hashmap_remove(s, &k, NULL, NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_hashmap_removei(s, k, NULL));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, k, &k));
+	ck_assert_int_eq(0, sp_hashmap_removei(s, k, NULL));
+	ck_assert_int_eq(SP_ENOKEY, sp_hashmap_removei(s, k, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	int k = 0;
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_remove(NULL, &k, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_remove(s, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_removei(NULL, k, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_dtor)
+{
+	struct data d;
+	setup(int, struct data, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_hashmap_inserti(s, 3, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_hashmap_removei(s, 3, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_hashmap_removei(s, 3, data_dtor));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_key_size)
+{
+	setup(int, int, 10);
+	ck_assert_int_eq(SP_EILLEGAL, sp_hashmap_removec(s, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_hashmap_removeld(s, 1, NULL));
+	teardown(NULL, NULL);
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_ok);
+	tcase_add_test(tc, remove_churn);
+	tcase_add_test(tc, remove_object);
+	tcase_add_test(tc, remove_missing);
+	tcase_add_test(tc, remove_bad_args);
+	tcase_add_test(tc, remove_bad_dtor);
+	tcase_add_test(tc, remove_bad_key_size);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,50 @@
+START_TEST(reserve_ok)
+{
+	struct sp_hashmap *s;
+	size_t capacity;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(sizeof(int), sizeof(int), 1, NULL, NULL));
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &i));
+	ck_assert_int_eq(0, sp_hashmap_reserve(s, 1000));
+	ck_assert_uint_ge(s->capacity - s->capacity / 8, 1000);
+	ck_assert_uint_ge(s->growth_left, 995);
+	capacity = s->capacity;
+	for (i = 5; i < 1000; i++)
+		ck_assert_int_eq(0, sp_hashmap_inserti(s, i, &i));
+	ck_assert_uint_eq(capacity, s->capacity);
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(i, *(int*)sp_hashmap_geti(s, i));
+
+	/* Never shrinks */
+	ck_assert_int_eq(0, sp_hashmap_reserve(s, 1));
+	ck_assert_uint_eq(capacity, s->capacity);
+	ck_assert_uint_eq(1000, s->size);
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(reserve_too_big)
+{
+	struct sp_hashmap *s;
+	ck_assert_ptr_nonnull(s = sp_hashmap_create(1, 1, 1, NULL, NULL));
+	ck_assert_int_eq(SP_ERANGE, sp_hashmap_reserve(s, 14337));
+	ck_assert_int_eq(SP_ERANGE, sp_hashmap_reserve(s, SIZE_MAX));
+	ck_assert_int_eq(0, sp_hashmap_reserve(s, 14336));
+	ck_assert_int_eq(0, sp_hashmap_destroy(s, NULL, NULL));
+}
+END_TEST
+
+START_TEST(reserve_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_hashmap_reserve(NULL, 10));
+}
+END_TEST
+
+void init_reserve(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, reserve_ok);
+	tcase_add_test(tc, reserve_too_big);
+	tcase_add_test(tc, reserve_bad_args);
+}
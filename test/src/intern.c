@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_intern.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+#include "intern/create.c"
+#include "intern/destroy.c"
+#include "intern/clear.c"
+#include "intern/add.c"
+#include "intern/find.c"
+#include "intern/get.c"
+#include "intern/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create  = tcase_create("create"),
+	      *tc_destroy = tcase_create("destroy"),
+	      *tc_clear   = tcase_create("clear"),
+	      *tc_add     = tcase_create("add"),
+	      *tc_find    = tcase_create("find"),
+	      *tc_get     = tcase_create("get"),
+	      *tc_print   = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("intern");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(clear);
+	init_and_add(add);
+	init_and_add(find);
+	init_and_add(get);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+#define setup(X) \
+	struct sp_intern *s; \
+	ck_assert_ptr_nonnull(s = sp_intern_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+
+START_TEST(add_ok)
+{
+	size_t id;
+	setup(10);
+	ck_assert_int_eq(0, sp_intern_add(s, "first", &id));
+	ck_assert_uint_eq(0, id);
+	ck_assert_int_eq(0, sp_intern_add(s, "second", &id));
+	ck_assert_uint_eq(1, id);
+	ck_assert_int_eq(0, sp_intern_add(s, "", &id));
+	ck_assert_uint_eq(2, id);
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_str_eq("first", sp_intern_get(s, 0));
+	ck_assert_str_eq("second", sp_intern_get(s, 1));
+	ck_assert_str_eq("", sp_intern_get(s, 2));
+	ck_assert_uint_eq(6, s->strs[1].len);
+	teardown();
+}
+END_TEST
+
+START_TEST(add_duplicate)
+{
+	char buf[16];
+	const char *p;
+	size_t id;
+	setup(10);
+	ck_assert_int_eq(0, sp_intern_add(s, "topic", &id));
+	ck_assert_uint_eq(0, id);
+	p = sp_intern_get(s, 0);
+
+	/* Strings are compared by content, not by address */
+	strcpy(buf, "topic");
+	ck_assert_int_eq(0, sp_intern_add(s, buf, &id));
+	ck_assert_uint_eq(0, id);
+	ck_assert_int_eq(0, sp_intern_addn(s, "topics", 5, &id));
+	ck_assert_uint_eq(0, id);
+	ck_assert_int_eq(0, sp_intern_add(s, "topic", NULL));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_ptr_eq(p, sp_intern_get(s, 0));
+	teardown();
+}
+END_TEST
+
+START_TEST(add_substring)
+{
+	size_t id;
+	setup(10);
+	ck_assert_int_eq(0, sp_intern_addn(s, "abcdef", 3, &id));
+	ck_assert_str_eq("abc", sp_intern_get(s, id));
+	ck_assert_int_eq(0, sp_intern_addn(s, "abcdef", 0, &id));
+	ck_assert_str_eq("", sp_intern_get(s, id));
+
+	/* Embedded null bytes are part of the string */
+	ck_assert_int_eq(0, sp_intern_addn(s, "ab\0cd", 5, &id));
+	ck_assert_uint_eq(2, id);
+	ck_assert_uint_eq(5, s->strs[id].len);
+	ck_assert_int_eq(0, sp_intern_addn(s, "ab\0xy", 5, &id));
+	ck_assert_uint_eq(3, id);
+	ck_assert_int_eq(0, sp_intern_addn(s, "ab", 2, &id));
+	ck_assert_uint_eq(4, id);
+	teardown();
+}
+END_TEST
+
+START_TEST(add_stable)
+{
+	const char *ptrs[800];
+	char buf[32];
+	size_t id;
+	int i;
+	setup(1);
+	for (i = 0; i < 800; i++) {
+		sprintf(buf, "some/topic/name/%d", i);
+		ck_assert_int_eq(0, sp_intern_add(s, buf, &id));
+		ck_assert_uint_eq(i, id);
+		ptrs[i] = sp_intern_get(s, id);
+	}
+	ck_assert_uint_eq(800, s->size);
+	ck_assert_uint_gt(s->nblocks, 1);
+
+	/* Neither new blocks nor a larger index move existing strings */
+	for (i = 0; i < 800; i++) {
+		sprintf(buf, "some/topic/name/%d", i);
+		ck_assert_ptr_eq(ptrs[i], sp_intern_get(s, i));
+		ck_assert_str_eq(buf, ptrs[i]);
+		ck_assert_int_eq(0, sp_intern_add(s, buf, &id));
+		ck_assert_uint_eq(i, id);
+	}
+	ck_assert_uint_eq(800, s->size);
+	teardown();
+}
+END_TEST
+
+START_TEST(add_long)
+{
+	static char big[3 * 4096];
+	const char *p;
+	size_t id, nblocks;
+	setup(10);
+	memset(big, 'x', sizeof(big) - 1);
+	ck_assert_int_eq(0, sp_intern_add(s, "short", &id));
+	p = sp_intern_get(s, id);
+	nblocks = s->nblocks;
+
+	/* A long string gets a block of its own, leaving the current one be */
+	ck_assert_int_eq(0, sp_intern_add(s, big, &id));
+	ck_assert_uint_eq(nblocks + 1, s->nblocks);
+	ck_assert_str_eq(big, sp_intern_get(s, id));
+	ck_assert_int_eq(0, sp_intern_add(s, "next", &id));
+	ck_assert_uint_eq(nblocks + 1, s->nblocks);
+	ck_assert_ptr_eq(p + 6, sp_intern_get(s, id));
+	teardown();
+}
+END_TEST
+
+START_TEST(add_bad_args)
+{
+	setup(10);
+	ck_assert_int_eq(SP_EINVAL, sp_intern_add(NULL, "abc", NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_intern_add(s, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_intern_addn(NULL, "abc", 3, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_intern_addn(s, NULL, 0, NULL));
+	ck_assert_uint_eq(0, s->size);
+	teardown();
+}
+END_TEST
+
+START_TEST(add_too_long)
+{
+	setup(10);
+	ck_assert_int_eq(SP_ERANGE, sp_intern_addn(s, "abc", SIZE_MAX, NULL));
+	ck_assert_uint_eq(0, s->size);
+	teardown();
+}
+END_TEST
+
+void init_add(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, add_ok);
+	tcase_add_test(tc, add_duplicate);
+	tcase_add_test(tc, add_substring);
+	tcase_add_test(tc, add_stable);
+	tcase_add_test(tc, add_long);
+	tcase_add_test(tc, add_bad_args);
+	tcase_add_test(tc, add_too_long);
+}
+
+#undef setup
+#undef teardown
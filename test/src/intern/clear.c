@@ -0,0 +1,37 @@
+START_TEST(clear_ok)
+{
+	struct sp_intern *s;
+	size_t id;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	ck_assert_int_eq(0, sp_intern_clear(s));
+	for (i = 0; i < 100; i++) {
+		char buf[16];
+		sprintf(buf, "str%d", i);
+		ck_assert_int_eq(0, sp_intern_add(s, buf, NULL));
+	}
+	ck_assert_int_eq(0, sp_intern_clear(s));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(0, s->nblocks);
+	ck_assert_int_eq(SP_ENOKEY, sp_intern_find(s, "str5", NULL));
+
+	/* Ids start from scratch */
+	ck_assert_int_eq(0, sp_intern_add(s, "str5", &id));
+	ck_assert_uint_eq(0, id);
+	ck_assert_str_eq("str5", sp_intern_get(s, 0));
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+}
+END_TEST
+
+START_TEST(clear_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_intern_clear(NULL));
+}
+END_TEST
+
+void init_clear(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, clear_ok);
+	tcase_add_test(tc, clear_bad_args);
+}
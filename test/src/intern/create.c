@@ -0,0 +1,37 @@
+START_TEST(create_ok)
+{
+	struct sp_intern *s;
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(10, s->capacity);
+	ck_assert_uint_eq(0, s->nblocks);
+	ck_assert_ptr_nonnull(s->index);
+	ck_assert_uint_eq(0, s->index->size);
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+
+	ck_assert_ptr_nonnull(s = sp_intern_create(1));
+	ck_assert_uint_eq(1, s->capacity);
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_intern_create(SIZE_MAX));
+	ck_assert_ptr_null(sp_intern_create(SIZE_MAX / sizeof(struct sp_intern_str) + 1));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_intern_create(0));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,29 @@
+START_TEST(destroy_ok)
+{
+	struct sp_intern *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	for (i = 0; i < 100; i++) {
+		char buf[16];
+		sprintf(buf, "str%d", i);
+		ck_assert_int_eq(0, sp_intern_add(s, buf, NULL));
+	}
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_intern_destroy(NULL));
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_bad_args);
+}
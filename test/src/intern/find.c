@@ -0,0 +1,67 @@
+#define setup(X) \
+	struct sp_intern *s; \
+	ck_assert_ptr_nonnull(s = sp_intern_create(X));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+
+START_TEST(find_ok)
+{
+	char buf[16];
+	size_t id;
+	int i;
+	setup(10);
+	for (i = 0; i < 300; i += 2) {
+		sprintf(buf, "key%d", i);
+		ck_assert_int_eq(0, sp_intern_add(s, buf, NULL));
+	}
+	for (i = 0; i < 300; i++) {
+		sprintf(buf, "key%d", i);
+		if (i % 2) {
+			ck_assert_int_eq(SP_ENOKEY, sp_intern_find(s, buf, &id));
+		} else {
+			ck_assert_int_eq(0, sp_intern_find(s, buf, &id));
+			ck_assert_uint_eq(i / 2, id);
+			ck_assert_int_eq(0, sp_intern_find(s, buf, NULL));
+		}
+	}
+	ck_assert_uint_eq(150, s->size);
+	teardown();
+}
+END_TEST
+
+START_TEST(find_substring)
+{
+	size_t id;
+	setup(10);
+	ck_assert_int_eq(0, sp_intern_add(s, "abc", NULL));
+	ck_assert_int_eq(0, sp_intern_findn(s, "abcdef", 3, &id));
+	ck_assert_uint_eq(0, id);
+	ck_assert_int_eq(SP_ENOKEY, sp_intern_findn(s, "abcdef", 2, &id));
+	ck_assert_int_eq(SP_ENOKEY, sp_intern_findn(s, "abcdef", 4, &id));
+	ck_assert_int_eq(SP_ENOKEY, sp_intern_find(s, "", &id));
+	teardown();
+}
+END_TEST
+
+START_TEST(find_bad_args)
+{
+	setup(10);
+	ck_assert_int_eq(SP_EINVAL, sp_intern_find(NULL, "abc", NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_intern_find(s, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_intern_findn(NULL, "abc", 3, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_intern_findn(s, NULL, 0, NULL));
+	teardown();
+}
+END_TEST
+
+void init_find(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, find_ok);
+	tcase_add_test(tc, find_substring);
+	tcase_add_test(tc, find_bad_args);
+}
+
+#undef setup
+#undef teardown
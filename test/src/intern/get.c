@@ -0,0 +1,31 @@
+START_TEST(get_ok)
+{
+	struct sp_intern *s;
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	ck_assert_int_eq(0, sp_intern_add(s, "zero", NULL));
+	ck_assert_int_eq(0, sp_intern_add(s, "one", NULL));
+	ck_assert_str_eq("zero", sp_intern_get(s, 0));
+	ck_assert_str_eq("one", sp_intern_get(s, 1));
+	ck_assert_ptr_eq(s->strs[1].str, sp_intern_get(s, 1));
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	struct sp_intern *s;
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	ck_assert_ptr_null(sp_intern_get(NULL, 0));
+	ck_assert_ptr_null(sp_intern_get(s, 0));
+	ck_assert_int_eq(0, sp_intern_add(s, "zero", NULL));
+	ck_assert_ptr_null(sp_intern_get(s, 1));
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_ok);
+	tcase_add_test(tc, get_bad_args);
+}
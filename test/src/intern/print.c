@@ -0,0 +1,25 @@
+START_TEST(print_ok)
+{
+	struct sp_intern *s;
+	ck_assert_ptr_nonnull(s = sp_intern_create(10));
+	ck_assert_int_eq(0, sp_intern_print(s));
+	ck_assert_int_eq(0, sp_intern_add(s, "first", NULL));
+	ck_assert_int_eq(0, sp_intern_add(s, "second", NULL));
+	ck_assert_int_eq(0, sp_intern_addn(s, "thirdly", 5, NULL));
+	ck_assert_int_eq(0, sp_intern_print(s));
+	ck_assert_int_eq(0, sp_intern_destroy(s));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_intern_print(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_ipqueue.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Orderings for the generic functions */
+static int int_cmp(const void *a, const void *b)
+{
+	const int x = *(const int*)a, y = *(const int*)b;
+	return (x > y) - (x < y);
+}
+
+static int data_age_cmp(const void *a, const void *b)
+{
+	const unsigned x = ((const struct data*)a)->age, y = ((const struct data*)b)->age;
+	return (x > y) - (x < y);
+}
+
+/* Checks the heap property and the position index of a queue of ints */
+static void ipq_check(const struct sp_ipqueue *ipq)
+{
+	const int *const val = ipq->data;
+	size_t i;
+	for (i = 0; i < ipq->size; i++) {
+		ck_assert_uint_lt(ipq->heap[i], ipq->count);
+		ck_assert_uint_eq(i, ipq->pos[ipq->heap[i]]);
+		if (i > 0) {
+			const int parent = val[ipq->heap[(i - 1) / ipq->arity]], child = val[ipq->heap[i]];
+			if (ipq->order == SP_PQUEUE_MIN)
+				ck_assert_int_le(parent, child);
+			else
+				ck_assert_int_ge(parent, child);
+		}
+	}
+	for (; i < ipq->count; i++)
+		ck_assert_uint_eq(i, ipq->pos[ipq->heap[i]]);
+}
+
+#include "ipqueue/create.c"
+#include "ipqueue/push.c"
+#include "ipqueue/update.c"
+#include "ipqueue/remove.c"
+#include "ipqueue/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_push   = tcase_create("push"),
+	      *tc_update = tcase_create("update"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("ipqueue");
+	init_and_add(create);
+	init_and_add(push);
+	init_and_add(update);
+	init_and_add(remove);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
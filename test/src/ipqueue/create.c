@@ -0,0 +1,74 @@
+START_TEST(create_ok)
+{
+	struct sp_ipqueue *ipq;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 10, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(ipq->data);
+	ck_assert_ptr_nonnull(ipq->heap);
+	ck_assert_ptr_nonnull(ipq->pos);
+	ck_assert_uint_eq(sizeof(int), ipq->elem_size);
+	ck_assert_uint_eq(0, ipq->size);
+	ck_assert_uint_eq(0, ipq->count);
+	ck_assert_uint_eq(10, ipq->capacity);
+	ck_assert_uint_eq(SP_PQUEUE_ARITY, ipq->arity);
+	ck_assert_int_eq(SP_PQUEUE_MIN, ipq->order);
+	ck_assert_ptr_eq(int_cmp, ipq->cmp);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(char), 1, 2, SP_PQUEUE_MAX, NULL));
+	ck_assert_uint_eq(2, ipq->arity);
+	ck_assert_int_eq(SP_PQUEUE_MAX, ipq->order);
+	ck_assert_ptr_null(ipq->cmp);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_ipqueue_create(0, 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_ipqueue_create(1, 0, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_ipqueue_create(1, 1, 1, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_ipqueue_create(1, 1, 0, 2, NULL));
+
+	/* The index arrays count towards the limit even for small elements */
+	ck_assert_ptr_null(sp_ipqueue_create(1, SIZE_MAX / sizeof(size_t) + 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_ipqueue_create(32, SIZE_MAX / 32 + 1, 0, SP_PQUEUE_MIN, NULL));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_ipqueue *ipq;
+	struct data d;
+	size_t i, h;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(struct data), 1, 0, SP_PQUEUE_MIN, data_age_cmp));
+	for (i = 0; i < 10; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ipqueue_push(ipq, &d, NULL));
+	}
+	ck_assert_int_eq(0, sp_ipqueue_clear(ipq, data_dtor));
+	ck_assert_uint_eq(0, ipq->size);
+	ck_assert_uint_eq(10, ipq->count);
+	for (i = 0; i < 10; i++)
+		ck_assert(!sp_ipqueue_contains(ipq, i));
+	ck_assert_int_eq(0, sp_ipqueue_clear(ipq, data_dtor));
+
+	/* Handles are reused after clearing */
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_ipqueue_push(ipq, &d, &h));
+	ck_assert_uint_lt(h, 10);
+	ck_assert_uint_eq(10, ipq->count);
+	ck_assert_int_eq(SP_ECALLBK, sp_ipqueue_clear(ipq, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_ipqueue_destroy(ipq, data_dtor_bad));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, data_dtor));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_destroy(NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,44 @@
+START_TEST(print_object)
+{
+	struct sp_ipqueue *ipq;
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(struct data), 1, 0, SP_PQUEUE_MIN, data_age_cmp));
+	for (i = 0; i < 3; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ipqueue_push(ipq, &d, NULL));
+	}
+	ck_assert_int_eq(0, sp_ipqueue_print(ipq, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_print(ipq, data_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_ipqueue_print(ipq, data_print_bad));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, data_dtor));
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	struct sp_ipqueue *ipq;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 3, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 7, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_printi(ipq));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_printd(ipq));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_print(NULL, data_print));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_printi(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
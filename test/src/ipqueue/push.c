@@ -0,0 +1,166 @@
+/* Pushes random integers with both the generic and the suffixed functions,
+ * and checks that they pop in sorted order along with their handles */
+static void push_check(size_t arity, int order, size_t n)
+{
+	struct sp_ipqueue *g, *t;
+	int *val, last;
+	size_t i;
+	ck_assert_ptr_nonnull(val = malloc(n * sizeof(int)));
+	ck_assert_ptr_nonnull(g = sp_ipqueue_create(sizeof(int), 1, arity, order, int_cmp));
+	ck_assert_ptr_nonnull(t = sp_ipqueue_create(sizeof(int), 1, arity, order, NULL));
+	for (i = 0; i < n; i++) {
+		size_t hg, ht;
+		val[i] = IRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_ipqueue_push(g, &val[i], &hg));
+		ck_assert_int_eq(0, sp_ipqueue_pushi(t, val[i], &ht));
+		ck_assert_uint_eq(i, hg);
+		ck_assert_uint_eq(i, ht);
+	}
+	ipq_check(g);
+	ipq_check(t);
+	for (i = 0; i < n; i++) {
+		const size_t hg = sp_ipqueue_top(g), ht = sp_ipqueue_top(t);
+		const int x = *(int*)sp_ipqueue_peek(g);
+		ck_assert_int_eq(val[hg], x);
+		ck_assert_int_eq(val[ht], sp_ipqueue_peeki(t));
+		ck_assert_int_eq(x, sp_ipqueue_peeki(t));
+		if (i > 0) {
+			if (order == SP_PQUEUE_MIN)
+				ck_assert_int_ge(x, last);
+			else
+				ck_assert_int_le(x, last);
+		}
+		last = x;
+		ck_assert_int_eq(0, sp_ipqueue_pop(g, NULL));
+		ck_assert_int_eq(x, sp_ipqueue_popi(t));
+		ck_assert(!sp_ipqueue_contains(g, hg));
+		ck_assert(!sp_ipqueue_contains(t, ht));
+	}
+	ck_assert_uint_eq(0, g->size);
+	ck_assert_uint_eq(0, t->size);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(g, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(t, NULL));
+	free(val);
+}
+
+START_TEST(push_pop_sorted)
+{
+	size_t arity;
+	for (arity = 2; arity <= 9; arity++) {
+		push_check(arity, SP_PQUEUE_MIN, 1);
+		push_check(arity, SP_PQUEUE_MIN, 300);
+		push_check(arity, SP_PQUEUE_MAX, 2);
+		push_check(arity, SP_PQUEUE_MAX, 300);
+	}
+}
+END_TEST
+
+START_TEST(push_reuse_handles)
+{
+	struct sp_ipqueue *ipq;
+	size_t h, i;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, NULL));
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, i, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_popi(ipq));
+	ck_assert_int_eq(1, sp_ipqueue_popi(ipq));
+
+	/* The most recently freed handle is given out first */
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 10, &h));
+	ck_assert_uint_eq(1, h);
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 11, &h));
+	ck_assert_uint_eq(0, h);
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 12, &h));
+	ck_assert_uint_eq(5, h);
+	ck_assert_uint_eq(6, ipq->count);
+	ck_assert_int_eq(10, sp_ipqueue_geti(ipq, 1));
+	ck_assert_int_eq(11, sp_ipqueue_geti(ipq, 0));
+	ipq_check(ipq);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+}
+END_TEST
+
+START_TEST(push_pop_object)
+{
+	struct sp_ipqueue *ipq;
+	struct data d;
+	unsigned last = 0;
+	size_t i;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(struct data), 1, 3, SP_PQUEUE_MIN, data_age_cmp));
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ipqueue_push(ipq, &d, NULL));
+	}
+	while (ipq->size > 0) {
+		const struct data *top = sp_ipqueue_peek(ipq);
+		ck_assert_ptr_eq(top, sp_ipqueue_get(ipq, sp_ipqueue_top(ipq)));
+		ck_assert_uint_ge(top->age, last);
+		last = top->age;
+		ck_assert_int_eq(0, sp_ipqueue_pop(ipq, data_dtor));
+	}
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+}
+END_TEST
+
+START_TEST(push_too_many)
+{
+	struct sp_ipqueue *ipq;
+	const size_t max = SIZE_MAX / sizeof(size_t);
+	size_t i;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, NULL));
+	for (i = 0; i < max; i++)
+		ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, i, NULL));
+	ck_assert_int_eq(SP_ERANGE, sp_ipqueue_pushi(ipq, 0, NULL));
+	ck_assert_int_eq(max - 1, sp_ipqueue_popi(ipq));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 0, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+}
+END_TEST
+
+START_TEST(push_bad_args)
+{
+	struct sp_ipqueue *ipq, *nocmp;
+	const int x = 1;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(nocmp = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_push(NULL, &x, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_push(ipq, NULL, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_push(nocmp, &x, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_pushi(NULL, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_pushd(ipq, 1, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(nocmp, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_pop(nocmp, NULL));
+
+	/* Empty queue */
+	ck_assert_ptr_null(sp_ipqueue_peek(ipq));
+	ck_assert_int_eq(0, sp_ipqueue_peeki(ipq));
+	ck_assert_uint_eq(0, sp_ipqueue_top(ipq));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_pop(ipq, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_popi(ipq));
+	ck_assert_ptr_null(sp_ipqueue_peek(NULL));
+	ck_assert_int_eq(0, sp_ipqueue_peeki(NULL));
+	ck_assert_uint_eq(0, sp_ipqueue_top(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_pop(NULL, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_popi(NULL));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 5, NULL));
+	ck_assert(sp_ipqueue_peekd(ipq) == 0);
+	ck_assert(sp_ipqueue_popd(ipq) == 0);
+	ck_assert_uint_eq(1, ipq->size);
+
+	/* Failing destructor leaves the queue intact */
+	ck_assert_int_eq(SP_ECALLBK, sp_ipqueue_pop(ipq, data_dtor_bad));
+	ck_assert_uint_eq(1, ipq->size);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(nocmp, NULL));
+}
+END_TEST
+
+void init_push(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, push_pop_sorted);
+	tcase_add_test(tc, push_reuse_handles);
+	tcase_add_test(tc, push_pop_object);
+	tcase_add_test(tc, push_too_many);
+	tcase_add_test(tc, push_bad_args);
+}
@@ -0,0 +1,114 @@
+/* Removes random handles with both function forms, keeping track of which
+ * ones are left, then checks that the queues drain in sorted order */
+static void remove_check(size_t arity, int order, size_t n)
+{
+	struct sp_ipqueue *g, *t;
+	int *val, last;
+	char *live;
+	size_t i, left = n;
+	ck_assert_ptr_nonnull(val = malloc(n * sizeof(int)));
+	ck_assert_ptr_nonnull(live = malloc(n));
+	ck_assert_ptr_nonnull(g = sp_ipqueue_create(sizeof(int), 1, arity, order, int_cmp));
+	ck_assert_ptr_nonnull(t = sp_ipqueue_create(sizeof(int), 1, arity, order, NULL));
+	for (i = 0; i < n; i++) {
+		val[i]  = IRANGE(-1000, 1000);
+		live[i] = 1;
+		ck_assert_int_eq(0, sp_ipqueue_push(g, &val[i], NULL));
+		ck_assert_int_eq(0, sp_ipqueue_pushi(t, val[i], NULL));
+	}
+	for (i = 0; i < n / 2; i++) {
+		const size_t h = rand() % n;
+		if (!live[h])
+			continue;
+		ck_assert_int_eq(0, sp_ipqueue_remove(g, h, NULL));
+		ck_assert_int_eq(val[h], sp_ipqueue_removei(t, h));
+		ck_assert(!sp_ipqueue_contains(g, h));
+		ck_assert(!sp_ipqueue_contains(t, h));
+		live[h] = 0;
+		--left;
+		ipq_check(g);
+		ipq_check(t);
+	}
+	ck_assert_uint_eq(left, g->size);
+	ck_assert_uint_eq(left, t->size);
+	for (i = 0; i < n; i++)
+		ck_assert_int_eq(live[i], sp_ipqueue_contains(g, i));
+	for (i = 0; i < left; i++) {
+		const int x = sp_ipqueue_peeki(g);
+		ck_assert(live[sp_ipqueue_top(g)]);
+		if (i > 0) {
+			if (order == SP_PQUEUE_MIN)
+				ck_assert_int_ge(x, last);
+			else
+				ck_assert_int_le(x, last);
+		}
+		last = x;
+		ck_assert_int_eq(0, sp_ipqueue_pop(g, NULL));
+		ck_assert_int_eq(x, sp_ipqueue_popi(t));
+	}
+	ck_assert_int_eq(0, sp_ipqueue_destroy(g, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(t, NULL));
+	free(val);
+	free(live);
+}
+
+START_TEST(remove_random)
+{
+	size_t arity;
+	for (arity = 2; arity <= 5; arity++) {
+		remove_check(arity, SP_PQUEUE_MIN, 1);
+		remove_check(arity, SP_PQUEUE_MIN, 200);
+		remove_check(arity, SP_PQUEUE_MAX, 200);
+	}
+}
+END_TEST
+
+START_TEST(remove_object)
+{
+	struct sp_ipqueue *ipq;
+	struct data d;
+	size_t h[10], i;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(struct data), 1, 0, SP_PQUEUE_MAX, data_age_cmp));
+	for (i = 0; i < 10; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ipqueue_push(ipq, &d, &h[i]));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_ipqueue_remove(ipq, h[3], data_dtor_bad));
+	ck_assert(sp_ipqueue_contains(ipq, h[3]));
+	for (i = 0; i < 10; i += 2)
+		ck_assert_int_eq(0, sp_ipqueue_remove(ipq, h[i], data_dtor));
+	ck_assert_uint_eq(5, ipq->size);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, data_dtor));
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	struct sp_ipqueue *ipq, *nocmp;
+	size_t h;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(nocmp = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 3, &h));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(nocmp, 3, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_remove(NULL, h, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_remove(nocmp, 0, NULL));
+	ck_assert_int_eq(SP_EINDEX, sp_ipqueue_remove(ipq, h + 1, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_removei(NULL, h));
+	ck_assert_int_eq(0, sp_ipqueue_removei(ipq, h + 1));
+	ck_assert(sp_ipqueue_removed(ipq, h) == 0);
+	ck_assert_uint_eq(1, ipq->size);
+	ck_assert_int_eq(0, sp_ipqueue_remove(ipq, h, NULL));
+	ck_assert_int_eq(SP_EINDEX, sp_ipqueue_remove(ipq, h, NULL));
+	ck_assert_int_eq(3, sp_ipqueue_removei(nocmp, 0));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(nocmp, NULL));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_random);
+	tcase_add_test(tc, remove_object);
+	tcase_add_test(tc, remove_bad_args);
+}
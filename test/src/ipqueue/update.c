@@ -0,0 +1,138 @@
+/* Randomly raises and lowers keys by handle with both function forms, keeping
+ * a copy of every key, then checks that the queues drain in sorted order */
+static void update_check(size_t arity, int order, size_t n)
+{
+	struct sp_ipqueue *g, *t;
+	int *val, last;
+	size_t i;
+	ck_assert_ptr_nonnull(val = malloc(n * sizeof(int)));
+	ck_assert_ptr_nonnull(g = sp_ipqueue_create(sizeof(int), 1, arity, order, int_cmp));
+	ck_assert_ptr_nonnull(t = sp_ipqueue_create(sizeof(int), 1, arity, order, NULL));
+	for (i = 0; i < n; i++) {
+		val[i] = IRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_ipqueue_push(g, &val[i], NULL));
+		ck_assert_int_eq(0, sp_ipqueue_pushi(t, val[i], NULL));
+	}
+	for (i = 0; i < 4 * n; i++) {
+		const size_t h = rand() % n;
+		val[h] = IRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_ipqueue_update(g, h, &val[h]));
+		ck_assert_int_eq(0, sp_ipqueue_updatei(t, h, val[h]));
+		ck_assert_int_eq(val[h], *(int*)sp_ipqueue_get(g, h));
+		ck_assert_int_eq(val[h], sp_ipqueue_geti(t, h));
+	}
+	ipq_check(g);
+	ipq_check(t);
+	for (i = 0; i < n; i++) {
+		const int x = sp_ipqueue_peeki(g);
+		ck_assert_int_eq(val[sp_ipqueue_top(g)], x);
+		if (i > 0) {
+			if (order == SP_PQUEUE_MIN)
+				ck_assert_int_ge(x, last);
+			else
+				ck_assert_int_le(x, last);
+		}
+		last = x;
+		ck_assert_int_eq(0, sp_ipqueue_pop(g, NULL));
+		ck_assert_int_eq(x, sp_ipqueue_popi(t));
+	}
+	ck_assert_int_eq(0, sp_ipqueue_destroy(g, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(t, NULL));
+	free(val);
+}
+
+START_TEST(update_random)
+{
+	size_t arity;
+	for (arity = 2; arity <= 5; arity++) {
+		update_check(arity, SP_PQUEUE_MIN, 1);
+		update_check(arity, SP_PQUEUE_MIN, 200);
+		update_check(arity, SP_PQUEUE_MAX, 200);
+	}
+}
+END_TEST
+
+/* Single-source shortest paths on a random graph, relaxing distances with
+ * decrease-key and checking them against Bellman-Ford */
+START_TEST(update_dijkstra)
+{
+	enum { V = 60, E = 400 };
+	static size_t from[E], to[E];
+	static double w[E], ref[V];
+	double dist[V];
+	struct sp_ipqueue *ipq;
+	size_t i, j, h[V];
+	for (i = 0; i < E; i++) {
+		from[i] = rand() % V;
+		to[i]   = rand() % V;
+		w[i]    = FRANGE(0, 10);
+	}
+	for (i = 0; i < V; i++)
+		ref[i] = dist[i] = 1e300;
+	ref[0] = 0;
+	for (i = 0; i < V; i++)
+		for (j = 0; j < E; j++)
+			if (ref[from[j]] + w[j] < ref[to[j]])
+				ref[to[j]] = ref[from[j]] + w[j];
+
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(double), 1, 0, SP_PQUEUE_MIN, NULL));
+	for (i = 0; i < V; i++)
+		ck_assert_int_eq(0, sp_ipqueue_pushd(ipq, i == 0 ? 0 : 1e300, &h[i]));
+	for (i = 0; i < V; i++)
+		ck_assert_uint_eq(i, h[i]);
+	while (ipq->size > 0) {
+		const size_t u = sp_ipqueue_top(ipq);
+		dist[u] = sp_ipqueue_popd(ipq);
+		for (j = 0; j < E; j++) {
+			const size_t v = to[j];
+			if (from[j] == u && sp_ipqueue_contains(ipq, v) && dist[u] + w[j] < sp_ipqueue_getd(ipq, v))
+				ck_assert_int_eq(0, sp_ipqueue_updated(ipq, v, dist[u] + w[j]));
+		}
+	}
+	for (i = 0; i < V; i++)
+		ck_assert(dist[i] == ref[i]);
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+}
+END_TEST
+
+START_TEST(update_bad_args)
+{
+	struct sp_ipqueue *ipq, *nocmp;
+	const int x = 1;
+	size_t h;
+	ck_assert_ptr_nonnull(ipq = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(nocmp = sp_ipqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(ipq, 3, &h));
+	ck_assert_int_eq(0, sp_ipqueue_pushi(nocmp, 3, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_update(NULL, h, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_update(ipq, h, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_update(nocmp, 0, &x));
+	ck_assert_int_eq(SP_EINDEX, sp_ipqueue_update(ipq, h + 1, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_ipqueue_updatei(NULL, h, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ipqueue_updated(ipq, h, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_ipqueue_updatei(ipq, h + 1, 1));
+	ck_assert_ptr_null(sp_ipqueue_get(NULL, h));
+	ck_assert_ptr_null(sp_ipqueue_get(ipq, h + 1));
+	ck_assert_int_eq(0, sp_ipqueue_geti(NULL, h));
+	ck_assert_int_eq(0, sp_ipqueue_geti(ipq, h + 1));
+	ck_assert(sp_ipqueue_getd(ipq, h) == 0);
+	ck_assert(!sp_ipqueue_contains(NULL, h));
+	ck_assert(!sp_ipqueue_contains(ipq, h + 1));
+
+	/* Stale handles are rejected */
+	ck_assert_int_eq(3, sp_ipqueue_popi(ipq));
+	ck_assert(!sp_ipqueue_contains(ipq, h));
+	ck_assert_int_eq(SP_EINDEX, sp_ipqueue_updatei(ipq, h, 1));
+	ck_assert_ptr_null(sp_ipqueue_get(ipq, h));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(ipq, NULL));
+	ck_assert_int_eq(0, sp_ipqueue_destroy(nocmp, NULL));
+}
+END_TEST
+
+void init_update(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, update_random);
+	tcase_add_test(tc, update_dijkstra);
+	tcase_add_test(tc, update_bad_args);
+}
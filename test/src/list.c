@@ -0,0 +1,89 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_list.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+#include "list/create.c"
+#include "list/destroy.c"
+#include "list/clear.c"
+#include "list/eq.c"
+#include "list/copy.c"
+#include "list/map.c"
+#include "list/pushfront.c"
+#include "list/pushback.c"
+#include "list/insert.c"
+#include "list/pop.c"
+#include "list/remove.c"
+#include "list/elem.c"
+#include "list/splice.c"
+#include "list/move.c"
+#include "list/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create    = tcase_create("create"),
+	      *tc_destroy   = tcase_create("destroy"),
+	      *tc_clear     = tcase_create("clear"),
+	      *tc_eq        = tcase_create("eq"),
+	      *tc_copy      = tcase_create("copy"),
+	      *tc_map       = tcase_create("map"),
+	      *tc_pushfront = tcase_create("pushfront"),
+	      *tc_pushback  = tcase_create("pushback"),
+	      *tc_insert    = tcase_create("insert"),
+	      *tc_pop       = tcase_create("pop"),
+	      *tc_remove    = tcase_create("remove"),
+	      *tc_elem      = tcase_create("elem"),
+	      *tc_splice    = tcase_create("splice"),
+	      *tc_move      = tcase_create("move"),
+	      *tc_print     = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("list");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(clear);
+	init_and_add(eq);
+	init_and_add(copy);
+	init_and_add(map);
+	init_and_add(pushfront);
+	init_and_add(pushback);
+	init_and_add(insert);
+	init_and_add(pop);
+	init_and_add(remove);
+	init_and_add(elem);
+	init_and_add(splice);
+	init_and_add(move);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
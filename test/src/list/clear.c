@@ -0,0 +1,71 @@
+START_TEST(clear_ok)
+{
+	struct sp_list *s;
+	size_t capacity, nslabs;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(int), 10));
+	ck_assert_int_eq(0, sp_list_clear(s, NULL));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+	capacity = s->pool.capacity;
+	nslabs   = s->pool.nslabs;
+	ck_assert_int_eq(0, sp_list_clear(s, NULL));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	ck_assert_uint_eq(capacity, s->pool.capacity);
+
+	/* Cleared nodes are reused before any new slab is allocated */
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_list_pushfronti(s, i));
+	ck_assert_uint_eq(nslabs, s->pool.nslabs);
+	ck_assert_uint_eq(capacity, s->pool.capacity);
+	ck_assert_int_eq(99, *(int*)sp_list_elem(s, s->head));
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(clear_object)
+{
+	struct sp_list *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(struct data), 5));
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_list_clear(s, data_dtor));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(clear_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_list_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_clear(NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(clear_bad_dtor)
+{
+	struct sp_list *s;
+	struct data d;
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(struct data), 5));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_list_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_list_clear(s, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_list_destroy(s, data_dtor));
+}
+END_TEST
+
+void init_clear(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, clear_ok);
+	tcase_add_test(tc, clear_object);
+	tcase_add_test(tc, clear_bad_args);
+	tcase_add_test(tc, clear_bad_dtor);
+}
@@ -0,0 +1,99 @@
+#define setup(T, X, Y) \
+	struct sp_list *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_list_create(sizeof(T), X)); \
+	ck_assert_ptr_nonnull(s2 = sp_list_create(sizeof(T), Y));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s1, D)); \
+	ck_assert_int_eq(0, sp_list_destroy(s2, D));
+
+START_TEST(copy_ok)
+{
+	int i;
+	setup(int, 10, 10);
+	ck_assert_int_eq(0, sp_list_copy(s2, s1, NULL));
+	ck_assert_uint_eq(0, s2->size);
+	for (i = 0; i < 3; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, i));
+	ck_assert_int_eq(0, sp_list_pushbacki(s2, 100));
+	ck_assert_int_eq(0, sp_list_copy(s2, s1, NULL));
+	ck_assert_uint_eq(3, s2->size);
+	ck_assert_int_eq(1, sp_list_eq(s1, s2, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(copy_with_enlargement)
+{
+	int i;
+	setup(int, 1000, 50);
+	for (i = 0; i < 420; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, i));
+	ck_assert_int_eq(0, sp_list_copy(s2, s1, NULL));
+	ck_assert_uint_eq(420, s2->size);
+	ck_assert_uint_ge(s2->pool.capacity, 420);
+	ck_assert_int_eq(1, sp_list_eq(s1, s2, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(copy_object)
+{
+	int i;
+	setup(struct data, 10, 10);
+	for (i = 0; i < 30; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(s1, &d));
+	}
+	ck_assert_int_eq(0, sp_list_copy(s2, s1, data_cpy));
+	ck_assert_int_eq(1, sp_list_eq(s1, s2, data_cmp));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(copy_bad_args)
+{
+	setup(int, 10, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_list_copy(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_copy(s2, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_copy(NULL, s1, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(copy_bad_elem_size)
+{
+	struct sp_list *s1, *s2;
+	ck_assert_ptr_nonnull(s1 = sp_list_create(sizeof(int), 10));
+	ck_assert_ptr_nonnull(s2 = sp_list_create(sizeof(double), 10));
+	ck_assert_int_eq(SP_EILLEGAL, sp_list_copy(s2, s1, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(copy_bad_callback)
+{
+	struct data d;
+	setup(struct data, 10, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_list_pushback(s1, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_list_copy(s2, s1, data_cpy_bad));
+	ck_assert_uint_eq(0, s2->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_copy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, copy_ok);
+	tcase_add_test(tc, copy_with_enlargement);
+	tcase_add_test(tc, copy_object);
+	tcase_add_test(tc, copy_bad_args);
+	tcase_add_test(tc, copy_bad_elem_size);
+	tcase_add_test(tc, copy_bad_callback);
+}
+
+#undef setup
+#undef teardown
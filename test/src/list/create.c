@@ -0,0 +1,49 @@
+START_TEST(create_ok)
+{
+	struct sp_list *s;
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(int), 10));
+	ck_assert_uint_eq(sizeof(int), s->elem_size);
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(10, s->pool.capacity);
+	ck_assert_uint_eq(1, s->pool.nslabs);
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	ck_assert_uint_ge(s->data_offset, sizeof(struct sp_list_node));
+	ck_assert_uint_ge(s->pool.stride, s->data_offset + sizeof(int));
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+
+	/* Elements stay aligned for any type of their size */
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(double), 1));
+	ck_assert_uint_eq(0, s->data_offset % sizeof(double));
+	ck_assert_uint_eq(0, s->pool.stride % sizeof(double));
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_list_create(1, 1));
+	ck_assert_uint_eq(0, s->pool.stride % sizeof(struct sp_list_node*));
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_list_create(SIZE_MAX, 1));
+	ck_assert_ptr_null(sp_list_create(1, SIZE_MAX));
+	ck_assert_ptr_null(sp_list_create(SIZE_MAX / 2, 2));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_list_create(0, 10));
+	ck_assert_ptr_null(sp_list_create(1, 0));
+	ck_assert_ptr_null(sp_list_create(0, 0));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,33 @@
+START_TEST(elem_ok)
+{
+	struct sp_list *s;
+	double *p;
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(double), 4));
+	ck_assert_int_eq(0, sp_list_pushbackd(s, 1.5));
+	ck_assert_int_eq(0, sp_list_pushbackd(s, 2.5));
+	ck_assert_ptr_nonnull(p = sp_list_elem(s, s->head));
+	ck_assert(*p == 1.5);
+	*p = 3.0;
+	ck_assert(*(double*)sp_list_elem(s, s->head) == 3.0);
+	ck_assert(*(double*)sp_list_elem(s, s->tail) == 2.5);
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(elem_bad_args)
+{
+	struct sp_list *s;
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(int), 4));
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1));
+	ck_assert_ptr_null(sp_list_elem(NULL, s->head));
+	ck_assert_ptr_null(sp_list_elem(s, NULL));
+	ck_assert_int_eq(0, sp_list_destroy(s, NULL));
+}
+END_TEST
+
+void init_elem(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, elem_ok);
+	tcase_add_test(tc, elem_bad_args);
+}
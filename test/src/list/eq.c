@@ -0,0 +1,72 @@
+#define setup(T) \
+	struct sp_list *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_list_create(sizeof(T), 3)); \
+	ck_assert_ptr_nonnull(s2 = sp_list_create(sizeof(T), 7));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s1, D)); \
+	ck_assert_int_eq(0, sp_list_destroy(s2, D));
+
+START_TEST(eq_ok)
+{
+	int i;
+	setup(int);
+	ck_assert_int_eq(1, sp_list_eq(s1, s2, NULL));
+	for (i = 0; i < 50; i++) {
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, i));
+		ck_assert_int_eq(0, sp_list_pushbacki(s2, i));
+	}
+	ck_assert_int_eq(1, sp_list_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_list_pushbacki(s2, 50));
+	ck_assert_int_eq(0, sp_list_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_list_pushbacki(s1, 51));
+	ck_assert_int_eq(0, sp_list_eq(s1, s2, NULL));
+
+	/* The same elements in a different order are not equal */
+	ck_assert_int_eq(0, sp_list_clear(s1, NULL));
+	ck_assert_int_eq(0, sp_list_clear(s2, NULL));
+	ck_assert_int_eq(0, sp_list_pushbacki(s1, 1));
+	ck_assert_int_eq(0, sp_list_pushbacki(s1, 2));
+	ck_assert_int_eq(0, sp_list_pushfronti(s2, 1));
+	ck_assert_int_eq(0, sp_list_pushfronti(s2, 2));
+	ck_assert_int_eq(0, sp_list_eq(s1, s2, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(eq_object)
+{
+	int i;
+	setup(struct data);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(s1, &d));
+	}
+	ck_assert_int_eq(0, sp_list_copy(s2, s1, data_cpy));
+	ck_assert_int_eq(1, sp_list_eq(s1, s2, data_cmp));
+	ck_assert_int_eq(0, sp_list_eq(s1, s2, NULL));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(eq_bad_args)
+{
+	setup(int);
+	ck_assert_int_eq(0, sp_list_eq(NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_list_eq(s1, NULL, NULL));
+	ck_assert_int_eq(0, sp_list_eq(NULL, s2, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+void init_eq(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, eq_ok);
+	tcase_add_test(tc, eq_object);
+	tcase_add_test(tc, eq_bad_args);
+}
+
+#undef setup
+#undef teardown
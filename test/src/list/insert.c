@@ -0,0 +1,101 @@
+#define setup(T, X) \
+	struct sp_list *s; \
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s, D));
+
+static void verify_ints(const struct sp_list *s, const int *expected, size_t n)
+{
+	const struct sp_list_node *node, *prev = NULL;
+	size_t i = 0;
+	ck_assert_uint_eq(n, s->size);
+	for (node = s->head; node != NULL; prev = node, node = node->next) {
+		ck_assert_uint_lt(i, n);
+		ck_assert_ptr_eq(prev, node->prev);
+		ck_assert_int_eq(expected[i++], *(int*)sp_list_elem(s, node));
+	}
+	ck_assert_ptr_eq(prev, s->tail);
+	ck_assert_uint_eq(n, i);
+}
+
+START_TEST(insert_ok)
+{
+	int x;
+	const int expected[] = {0, 1, 2, 3, 4};
+	setup(int, 2);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 2));
+	x = 3;
+	ck_assert_int_eq(0, sp_list_insertafter(s, s->head, &x));
+	x = 0;
+	ck_assert_int_eq(0, sp_list_insertbefore(s, s->head, &x));
+	x = 1;
+	ck_assert_int_eq(0, sp_list_insertafter(s, s->head, &x));
+	x = 4;
+	ck_assert_int_eq(0, sp_list_insertafter(s, s->tail, &x));
+	verify_ints(s, expected, LEN(expected));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(insert_middle)
+{
+	int i;
+	struct sp_list_node *mid;
+	setup(int, 4);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 0));
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1000));
+	mid = s->head;
+	for (i = 1; i < 1000; i++) {
+		ck_assert_int_eq(0, sp_list_insertafter(s, mid, &i));
+		mid = mid->next;
+	}
+	i = 0;
+	for (mid = s->head; mid != NULL; mid = mid->next)
+		ck_assert_int_eq(i++, *(int*)sp_list_elem(s, mid));
+	ck_assert_int_eq(1001, i);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(insert_object)
+{
+	struct data a, b;
+	setup(struct data, 2);
+	ck_assert_int_eq(0, data_init(&a));
+	ck_assert_int_eq(0, data_init(&b));
+	ck_assert_int_eq(0, sp_list_pushback(s, &a));
+	ck_assert_int_eq(0, sp_list_insertbefore(s, s->tail, &b));
+	ck_assert_int_eq(0, data_cmp(&b, sp_list_elem(s, s->head)));
+	ck_assert_int_eq(0, data_cmp(&a, sp_list_elem(s, s->tail)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	int x = 0;
+	setup(int, 2);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_list_insertafter(NULL, s->head, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_list_insertafter(s, NULL, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_list_insertafter(s, s->head, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_insertbefore(NULL, s->head, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_list_insertbefore(s, NULL, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_list_insertbefore(s, s->head, NULL));
+	ck_assert_uint_eq(1, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_ok);
+	tcase_add_test(tc, insert_middle);
+	tcase_add_test(tc, insert_object);
+	tcase_add_test(tc, insert_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,74 @@
+#define setup(T, X) \
+	struct sp_list *s; \
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s, D));
+
+static struct sp_list_node *nth(const struct sp_list *s, size_t n)
+{
+	struct sp_list_node *node = s->head;
+	while (n--)
+		node = node->next;
+	return node;
+}
+
+static void verify(const struct sp_list *s, const int *expected, size_t n)
+{
+	const struct sp_list_node *node, *prev = NULL;
+	size_t i = 0;
+	ck_assert_uint_eq(n, s->size);
+	for (node = s->head; node != NULL; prev = node, node = node->next) {
+		ck_assert_ptr_eq(prev, node->prev);
+		ck_assert_int_eq(expected[i++], *(int*)sp_list_elem(s, node));
+	}
+	ck_assert_ptr_eq(prev, s->tail);
+	ck_assert_uint_eq(n, i);
+}
+
+START_TEST(move_ok)
+{
+	int i;
+	const int exp1[] = {0, 3, 4, 1, 2, 5},
+	          exp2[] = {1, 2, 5, 0, 3, 4},
+	          exp3[] = {4, 1, 2, 5, 0, 3},
+	          exp4[] = {4, 1, 2, 5, 0, 3};
+	setup(int, 6);
+	for (i = 0; i < 6; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+
+	/* Range to the middle, to the end, single node to the front */
+	ck_assert_int_eq(0, sp_list_move(s, nth(s, 5), nth(s, 1), nth(s, 2)));
+	verify(s, exp1, LEN(exp1));
+	ck_assert_int_eq(0, sp_list_move(s, NULL, nth(s, 0), nth(s, 2)));
+	verify(s, exp2, LEN(exp2));
+	ck_assert_int_eq(0, sp_list_move(s, s->head, s->tail, s->tail));
+	verify(s, exp3, LEN(exp3));
+
+	/* The whole list onto itself is a no-op */
+	ck_assert_int_eq(0, sp_list_move(s, NULL, s->head, s->tail));
+	verify(s, exp4, LEN(exp4));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(move_bad_args)
+{
+	setup(int, 4);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_list_move(NULL, NULL, s->head, s->head));
+	ck_assert_int_eq(SP_EINVAL, sp_list_move(s, NULL, NULL, s->head));
+	ck_assert_int_eq(SP_EINVAL, sp_list_move(s, NULL, s->head, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+void init_move(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, move_ok);
+	tcase_add_test(tc, move_bad_args);
+}
+
+#undef setup
+#undef teardown
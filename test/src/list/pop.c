@@ -0,0 +1,88 @@
+#define setup(T, X) \
+	struct sp_list *s; \
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s, D));
+
+START_TEST(pop_basic)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 2));
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 3));
+	ck_assert_int_eq(0, sp_list_popfront(s, NULL));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(2, *(int*)sp_list_elem(s, s->head));
+	ck_assert_ptr_null(s->head->prev);
+	ck_assert_int_eq(0, sp_list_popback(s, NULL));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_ptr_eq(s->head, s->tail);
+	ck_assert_ptr_null(s->tail->next);
+	ck_assert_int_eq(0, sp_list_popback(s, NULL));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pop_object)
+{
+	int i;
+	setup(struct data, 4);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(s, &d));
+	}
+	for (i = 0; i < 5; i++) {
+		ck_assert_int_eq(0, sp_list_popfront(s, data_dtor));
+		ck_assert_int_eq(0, sp_list_popback(s, data_dtor));
+	}
+	ck_assert_uint_eq(0, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(pop_empty)
+{
+	setup(int, 10);
+	ck_assert_int_eq(SP_EILLEGAL, sp_list_popfront(s, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_list_popback(s, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pop_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_list_popfront(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_popback(NULL, NULL));
+}
+END_TEST
+
+START_TEST(pop_bad_dtor)
+{
+	struct data d;
+	setup(struct data, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_list_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_list_popfront(s, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_list_popback(s, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_pop(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pop_basic);
+	tcase_add_test(tc, pop_object);
+	tcase_add_test(tc, pop_empty);
+	tcase_add_test(tc, pop_bad_args);
+	tcase_add_test(tc, pop_bad_dtor);
+}
+
+#undef setup
+#undef teardown
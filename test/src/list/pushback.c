@@ -0,0 +1,104 @@
+#define setup(T, X) \
+	struct sp_list *s; \
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s, D));
+
+START_TEST(pushback_ok)
+{
+	int i;
+	const struct sp_list_node *node;
+	setup(int, 1);
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+	ck_assert_uint_eq(1000, s->size);
+	ck_assert_uint_ge(s->pool.capacity, 1000);
+	ck_assert_ptr_null(s->head->prev);
+	ck_assert_ptr_null(s->tail->next);
+	i = 0;
+	for (node = s->head; node != NULL; node = node->next) {
+		ck_assert_int_eq(i, *(int*)sp_list_elem(s, node));
+		if (node->next != NULL)
+			ck_assert_ptr_eq(node, node->next->prev);
+		i++;
+	}
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pushback_stable)
+{
+	int *first;
+	int i;
+	setup(int, 1);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 42));
+	first = sp_list_elem(s, s->head);
+
+	/* Elements never move, however many slabs are allocated */
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+	ck_assert_int_eq(42, *first);
+	ck_assert_ptr_eq(first, sp_list_elem(s, s->head));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pushback_reuse)
+{
+	int i;
+	size_t capacity;
+	setup(int, 8);
+	for (i = 0; i < 8; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+	capacity = s->pool.capacity;
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, sp_list_popfront(s, NULL));
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+	}
+	ck_assert_uint_eq(capacity, s->pool.capacity);
+	ck_assert_uint_eq(1, s->pool.nslabs);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pushback_object)
+{
+	int i;
+	setup(struct data, 3);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(s, &d));
+		ck_assert_int_eq(0, data_cmp(&d, sp_list_elem(s, s->tail)));
+	}
+	ck_assert_uint_eq(10, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(pushback_bad_args)
+{
+	int x = 0;
+	setup(int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_list_pushback(NULL, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_list_pushback(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_pushbacki(NULL, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_list_pushbackd(s, 1.0));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+void init_pushback(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pushback_ok);
+	tcase_add_test(tc, pushback_stable);
+	tcase_add_test(tc, pushback_reuse);
+	tcase_add_test(tc, pushback_object);
+	tcase_add_test(tc, pushback_bad_args);
+}
+
+#undef setup
+#undef teardown
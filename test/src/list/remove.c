@@ -0,0 +1,98 @@
+#define setup(T, X) \
+	struct sp_list *s; \
+	ck_assert_ptr_nonnull(s = sp_list_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s, D));
+
+START_TEST(remove_ok)
+{
+	int i;
+	struct sp_list_node *node, *next;
+	setup(int, 16);
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s, i));
+
+	/* Drop every odd element while walking the list */
+	for (node = s->head; node != NULL; node = next) {
+		next = node->next;
+		if (*(int*)sp_list_elem(s, node) % 2)
+			ck_assert_int_eq(0, sp_list_remove(s, node, NULL));
+	}
+	ck_assert_uint_eq(50, s->size);
+	i = 0;
+	for (node = s->head; node != NULL; node = node->next, i += 2)
+		ck_assert_int_eq(i, *(int*)sp_list_elem(s, node));
+	ck_assert_int_eq(98, *(int*)sp_list_elem(s, s->tail));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(remove_ends)
+{
+	setup(int, 16);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 2));
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 3));
+	ck_assert_int_eq(0, sp_list_remove(s, s->tail, NULL));
+	ck_assert_int_eq(2, *(int*)sp_list_elem(s, s->tail));
+	ck_assert_int_eq(0, sp_list_remove(s, s->head, NULL));
+	ck_assert_int_eq(2, *(int*)sp_list_elem(s, s->head));
+	ck_assert_ptr_eq(s->head, s->tail);
+	ck_assert_int_eq(0, sp_list_remove(s, s->head, NULL));
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(remove_object)
+{
+	int i;
+	setup(struct data, 4);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_list_remove(s, s->head->next->next, data_dtor));
+	ck_assert_uint_eq(9, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_list_pushbacki(s, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_list_remove(NULL, s->head, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_list_remove(s, NULL, NULL));
+	ck_assert_uint_eq(1, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_dtor)
+{
+	struct data d;
+	setup(struct data, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_list_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_list_remove(s, s->head, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_ok);
+	tcase_add_test(tc, remove_ends);
+	tcase_add_test(tc, remove_object);
+	tcase_add_test(tc, remove_bad_args);
+	tcase_add_test(tc, remove_bad_dtor);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,229 @@
+#define setup(T, X, Y) \
+	struct sp_list *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_list_create(sizeof(T), X)); \
+	ck_assert_ptr_nonnull(s2 = sp_list_create(sizeof(T), Y));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_list_destroy(s1, D)); \
+	ck_assert_int_eq(0, sp_list_destroy(s2, D));
+
+START_TEST(splice_ok)
+{
+	int i;
+	const struct sp_list_node *node;
+	int *moved;
+	setup(int, 4, 4);
+	for (i = 0; i < 10; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, i < 5 ? i : i + 10));
+	for (i = 5; i < 15; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s2, i));
+	moved = sp_list_elem(s2, s2->head);
+
+	/* Insert s2 in the middle of s1 */
+	node = s1->head;
+	for (i = 0; i < 5; i++)
+		node = node->next;
+	ck_assert_int_eq(0, sp_list_splice(s1, (struct sp_list_node*)node, s2));
+	ck_assert_uint_eq(20, s1->size);
+	ck_assert_uint_eq(0, s2->size);
+	ck_assert_uint_eq(0, s2->pool.capacity);
+	ck_assert_ptr_null(s2->head);
+	ck_assert_ptr_null(s2->tail);
+	i = 0;
+	for (node = s1->head; node != NULL; node = node->next)
+		ck_assert_int_eq(i++, *(int*)sp_list_elem(s1, node));
+	ck_assert_int_eq(20, i);
+
+	/* Nodes are relinked, not copied */
+	ck_assert_int_eq(5, *moved);
+	ck_assert_ptr_eq(moved, sp_list_elem(s1, s1->head->next->next->next->next->next));
+
+	/* Both lists stay usable */
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, 20 + i));
+		ck_assert_int_eq(0, sp_list_pushbacki(s2, i));
+	}
+	ck_assert_uint_eq(120, s1->size);
+	ck_assert_uint_eq(100, s2->size);
+	ck_assert_uint_ge(s1->pool.capacity, 120);
+	ck_assert_int_eq(119, *(int*)sp_list_elem(s1, s1->tail));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(splice_ends)
+{
+	int i;
+	const struct sp_list_node *node;
+	setup(int, 4, 4);
+	ck_assert_int_eq(0, sp_list_pushbacki(s1, 2));
+	ck_assert_int_eq(0, sp_list_pushbacki(s2, 0));
+	ck_assert_int_eq(0, sp_list_pushbacki(s2, 1));
+	ck_assert_int_eq(0, sp_list_splice(s1, s1->head, s2));
+	ck_assert_int_eq(0, sp_list_pushbacki(s2, 3));
+	ck_assert_int_eq(0, sp_list_splice(s1, NULL, s2));
+	i = 0;
+	for (node = s1->head; node != NULL; node = node->next)
+		ck_assert_int_eq(i++, *(int*)sp_list_elem(s1, node));
+	ck_assert_int_eq(4, i);
+	ck_assert_int_eq(3, *(int*)sp_list_elem(s1, s1->tail));
+	ck_assert_ptr_null(s1->head->prev);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(splice_empty)
+{
+	int i;
+	setup(int, 4, 4);
+
+	/* Splicing into an emptied list hands over the whole pool */
+	ck_assert_int_eq(0, sp_list_pushbacki(s2, 1));
+	ck_assert_int_eq(0, sp_list_splice(s1, NULL, s2));
+	ck_assert_int_eq(0, sp_list_splice(s2, NULL, s1));
+	ck_assert_uint_eq(1, s2->size);
+	ck_assert_uint_eq(0, s1->pool.nslabs);
+	ck_assert_int_eq(0, sp_list_splice(s2, NULL, s1));
+	ck_assert_uint_eq(1, s2->size);
+	for (i = 0; i < 10; i++)
+		ck_assert_int_eq(0, sp_list_pushfronti(s1, i));
+	ck_assert_int_eq(0, sp_list_splice(s2, s2->head, s1));
+	ck_assert_uint_eq(11, s2->size);
+	ck_assert_int_eq(9, *(int*)sp_list_elem(s2, s2->head));
+	ck_assert_int_eq(1, *(int*)sp_list_elem(s2, s2->tail));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(splice_repeat)
+{
+	int i;
+	setup(int, 4, 4);
+
+	/* The emptied list starts over with small slabs */
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, sp_list_pushbacki(s2, i));
+		ck_assert_uint_le(s2->pool.slabs[s2->pool.nslabs - 1].size, 4);
+		ck_assert_int_eq(0, sp_list_splice(s1, NULL, s2));
+		ck_assert_uint_eq(0, s2->pool.nslabs);
+	}
+	ck_assert_uint_eq(100, s1->size);
+	ck_assert_uint_le(s1->pool.capacity, 200);
+	ck_assert_int_eq(99, *(int*)sp_list_elem(s1, s1->tail));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(splice_free)
+{
+	int i;
+	const struct sp_list_node *node;
+	setup(int, 4, 64);
+
+	/* Free nodes and slabs not carved out of yet change hands as well */
+	for (i = 0; i < 10; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, i));
+	for (i = 0; i < 3; i++)
+		ck_assert_int_eq(0, sp_list_popfront(s1, NULL));
+	ck_assert_int_eq(0, sp_list_splice(s1, NULL, s2));
+	ck_assert_uint_eq(7, s1->size);
+	ck_assert_uint_ge(s1->pool.capacity, 64);
+	for (i = 0; i < 10; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s2, 100 + i));
+	for (i = 0; i < 2; i++)
+		ck_assert_int_eq(0, sp_list_popfront(s2, NULL));
+	ck_assert_int_eq(0, sp_list_splice(s1, s1->head, s2));
+	ck_assert_uint_eq(15, s1->size);
+	for (i = 0; i < 200; i++)
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, 1000 + i));
+	ck_assert_uint_eq(215, s1->size);
+	ck_assert_uint_ge(s1->pool.capacity, 215);
+
+	node = s1->head;
+	for (i = 102; i < 110; i++, node = node->next)
+		ck_assert_int_eq(i, *(int*)sp_list_elem(s1, node));
+	for (i = 3; i < 10; i++, node = node->next)
+		ck_assert_int_eq(i, *(int*)sp_list_elem(s1, node));
+	for (i = 1000; i < 1200; i++, node = node->next)
+		ck_assert_int_eq(i, *(int*)sp_list_elem(s1, node));
+	ck_assert_ptr_null(node);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(splice_reuse)
+{
+	int i, round;
+	size_t capacity, nslabs;
+	setup(int, 4, 16);
+	ck_assert_int_eq(0, sp_list_pushbacki(s1, -1));
+
+	/* Neither the free nodes nor the uncarved rest of the slab of either
+	 * list are lost, so every node spliced over can be used again */
+	capacity = s1->pool.capacity;
+	for (round = 0; round < 20; round++) {
+		for (i = 0; i < 100; i++)
+			ck_assert_int_eq(0, sp_list_pushbacki(s2, i));
+		for (i = 0; i < 50; i++)
+			ck_assert_int_eq(0, sp_list_popfront(s2, NULL));
+		capacity += s2->pool.capacity;
+		ck_assert_int_eq(0, sp_list_splice(s1, NULL, s2));
+		for (i = 0; i < 50; i++)
+			ck_assert_int_eq(0, sp_list_popback(s1, NULL));
+		ck_assert_uint_eq(1, s1->size);
+		ck_assert_uint_eq(capacity, s1->pool.capacity);
+	}
+	nslabs = s1->pool.nslabs;
+	while (s1->size < capacity)
+		ck_assert_int_eq(0, sp_list_pushbacki(s1, 0));
+	ck_assert_uint_eq(nslabs, s1->pool.nslabs);
+	ck_assert_uint_eq(capacity, s1->pool.capacity);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(splice_object)
+{
+	int i;
+	setup(struct data, 2, 2);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_list_pushback(i % 2 ? s1 : s2, &d));
+	}
+	ck_assert_int_eq(0, sp_list_popback(s2, data_dtor));
+	ck_assert_int_eq(0, sp_list_splice(s1, s1->head, s2));
+	ck_assert_uint_eq(9, s1->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(splice_bad_args)
+{
+	struct sp_list *s3;
+	setup(int, 4, 4);
+	ck_assert_ptr_nonnull(s3 = sp_list_create(sizeof(char), 4));
+	ck_assert_int_eq(SP_EINVAL, sp_list_splice(NULL, NULL, s2));
+	ck_assert_int_eq(SP_EINVAL, sp_list_splice(s1, NULL, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_list_splice(s1, NULL, s1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_list_splice(s1, NULL, s3));
+	ck_assert_int_eq(0, sp_list_destroy(s3, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+void init_splice(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, splice_ok);
+	tcase_add_test(tc, splice_ends);
+	tcase_add_test(tc, splice_empty);
+	tcase_add_test(tc, splice_repeat);
+	tcase_add_test(tc, splice_free);
+	tcase_add_test(tc, splice_reuse);
+	tcase_add_test(tc, splice_object);
+	tcase_add_test(tc, splice_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_lru.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks that the recency list links every entry both ways, that the index
+ * maps every key to its entry, and that the free list holds the rest */
+static void lru_check(const struct sp_lru *lru)
+{
+	size_t i, prev = lru->capacity, n = 0, weight = 0;
+	ck_assert_uint_le(lru->size, lru->capacity);
+	ck_assert_uint_eq(lru->size, lru->index->size);
+	for (i = lru->head; i != lru->capacity; i = lru->entries[i].next) {
+		const size_t *pos = sp_hashmap_get(lru->index, (char*)lru->keys + i * lru->key_size);
+		ck_assert_uint_lt(i, lru->capacity);
+		ck_assert_uint_eq(prev, lru->entries[i].prev);
+		ck_assert_ptr_nonnull(pos);
+		ck_assert_uint_eq(i, *pos);
+		weight += lru->entries[i].weight;
+		prev = i;
+		ck_assert_uint_le(++n, lru->size);
+	}
+	ck_assert_uint_eq(lru->size, n);
+	ck_assert_uint_eq(prev, lru->tail);
+	ck_assert_uint_eq(lru->weight, weight);
+	if (lru->max_weight != 0)
+		ck_assert_uint_le(lru->weight, lru->max_weight);
+	for (i = lru->free; i != lru->capacity; i = lru->entries[i].next)
+		ck_assert_uint_le(++n, lru->capacity);
+	ck_assert_uint_eq(lru->capacity, n);
+}
+
+/* Keys passed to the eviction callback, in order */
+static long evicted[64];
+static size_t nevicted;
+
+static int evict_log(void *key, void *val)
+{
+	if (nevicted < LEN(evicted))
+		evicted[nevicted++] = *(long*)key;
+	return 0;
+}
+
+static int evict_bad(void *key, void *val)
+{
+	return 1;
+}
+
+#include "lru/create.c"
+#include "lru/insert.c"
+#include "lru/get.c"
+#include "lru/remove.c"
+#include "lru/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_insert = tcase_create("insert"),
+	      *tc_get    = tcase_create("get"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("lru");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(get);
+	init_and_add(remove);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,82 @@
+START_TEST(create_ok)
+{
+	struct sp_lru *lru;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(struct data), 10, 0, NULL, NULL, NULL));
+	ck_assert_ptr_nonnull(lru->index);
+	ck_assert_ptr_nonnull(lru->entries);
+	ck_assert_ptr_nonnull(lru->keys);
+	ck_assert_ptr_nonnull(lru->vals);
+	ck_assert_uint_eq(sizeof(long), lru->key_size);
+	ck_assert_uint_eq(sizeof(struct data), lru->val_size);
+	ck_assert_uint_eq(0, lru->size);
+	ck_assert_uint_eq(10, lru->capacity);
+	ck_assert_uint_eq(0, lru->weight);
+	ck_assert_uint_eq(0, lru->max_weight);
+	ck_assert_uint_eq(0, lru->hits);
+	ck_assert_uint_eq(0, lru->misses);
+	ck_assert_uint_eq(0, lru->evictions);
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_lru_create(0, 1, 10, 0, NULL, NULL, NULL));
+	ck_assert_ptr_null(sp_lru_create(1, 0, 10, 0, NULL, NULL, NULL));
+	ck_assert_ptr_null(sp_lru_create(1, 1, 0, 0, NULL, NULL, NULL));
+	ck_assert_ptr_null(sp_lru_create(SIZE_MAX, 1, 2, 0, NULL, NULL, NULL));
+	ck_assert_ptr_null(sp_lru_create(1, SIZE_MAX, 2, 0, NULL, NULL, NULL));
+	ck_assert_ptr_null(sp_lru_create(1, 1, SIZE_MAX, 0, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_clear(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_destroy(NULL, NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_lru *lru;
+	struct data d;
+	long i;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(struct data), 20, 0, NULL, NULL, NULL));
+	for (i = 0; i < 20; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &d, 1));
+	}
+	ck_assert_ptr_nonnull(sp_lru_getl(lru, 3));
+	ck_assert_ptr_null(sp_lru_getl(lru, 30));
+
+	/* A failing destructor leaves every entry in place */
+	ck_assert_int_eq(SP_ECALLBK, sp_lru_clear(lru, NULL, data_dtor_bad));
+	ck_assert_uint_eq(20, lru->size);
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_clear(lru, NULL, data_dtor));
+	ck_assert_uint_eq(0, lru->size);
+	ck_assert_uint_eq(0, lru->weight);
+	ck_assert_uint_eq(1, lru->hits);
+	ck_assert_uint_eq(1, lru->misses);
+	ck_assert_uint_eq(0, lru->evictions);
+	lru_check(lru);
+	for (i = 0; i < 20; i++)
+		ck_assert_ptr_null(sp_lru_peekl(lru, i));
+
+	for (i = 0; i < 25; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		if (i >= 20)
+			ck_assert_int_eq(0, data_dtor(sp_lru_peekl(lru, i - 20)));
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &d, 1));
+	}
+	ck_assert_uint_eq(5, lru->evictions);
+	lru_check(lru);
+	ck_assert_int_eq(SP_ECALLBK, sp_lru_destroy(lru, NULL, data_dtor_bad));
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, data_dtor));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
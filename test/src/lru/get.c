@@ -0,0 +1,80 @@
+START_TEST(get_counters)
+{
+	struct sp_lru *lru;
+	long i;
+	int val;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 8, 0, NULL, NULL, NULL));
+	for (i = 0; i < 8; i++) {
+		val = (int)i;
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, 0));
+	}
+	for (i = 0; i < 16; i++) {
+		int *const p = sp_lru_getl(lru, i);
+		if (i < 8)
+			ck_assert_int_eq(i, *p);
+		else
+			ck_assert_ptr_null(p);
+	}
+	ck_assert_uint_eq(8, lru->hits);
+	ck_assert_uint_eq(8, lru->misses);
+
+	/* Values can be changed through the returned address */
+	*(int*)sp_lru_getl(lru, 3) = 33;
+	ck_assert_int_eq(33, *(int*)sp_lru_peekl(lru, 3));
+	ck_assert_int_eq(3, *(long*)((char*)lru->keys + lru->head * lru->key_size));
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(get_peek)
+{
+	struct sp_lru *lru;
+	const size_t head_of_empty = 2;
+	long i;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), head_of_empty, 0, NULL, NULL, NULL));
+	ck_assert_ptr_null(sp_lru_peekl(lru, 0));
+	for (i = 0; i < 2; i++)
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, 0));
+
+	/* Peeking neither counts nor saves an entry from eviction */
+	i = 0;
+	ck_assert_ptr_nonnull(sp_lru_peek(lru, &i));
+	ck_assert_uint_eq(0, lru->hits);
+	ck_assert_uint_eq(0, lru->misses);
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 2, &val, 0));
+	ck_assert_ptr_null(sp_lru_peekl(lru, 0));
+	ck_assert_ptr_nonnull(sp_lru_peekl(lru, 1));
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	struct sp_lru *lru;
+	long key = 0;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 2, 0, NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_lru_insertl(lru, key, &val, 0));
+	ck_assert_ptr_null(sp_lru_get(NULL, &key));
+	ck_assert_ptr_null(sp_lru_get(lru, NULL));
+	ck_assert_ptr_null(sp_lru_getl(NULL, key));
+	ck_assert_ptr_null(sp_lru_geti(lru, 0));
+	ck_assert_ptr_null(sp_lru_peek(NULL, &key));
+	ck_assert_ptr_null(sp_lru_peek(lru, NULL));
+	ck_assert_ptr_null(sp_lru_peeki(lru, 0));
+	ck_assert_uint_eq(0, lru->hits);
+	ck_assert_uint_eq(0, lru->misses);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_counters);
+	tcase_add_test(tc, get_peek);
+	tcase_add_test(tc, get_bad_args);
+}
@@ -0,0 +1,200 @@
+START_TEST(insert_evict_order)
+{
+	struct sp_lru *lru;
+	long i;
+	int val;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 4, 0, NULL, NULL, evict_log));
+	nevicted = 0;
+	for (i = 0; i < 10; i++) {
+		val = (int)i * 10;
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, 0));
+		lru_check(lru);
+	}
+	ck_assert_uint_eq(4, lru->size);
+	ck_assert_uint_eq(6, lru->evictions);
+	ck_assert_uint_eq(6, nevicted);
+	for (i = 0; i < 6; i++)
+		ck_assert_int_eq(i, evicted[i]);
+	for (i = 6; i < 10; i++)
+		ck_assert_int_eq(i * 10, *(int*)sp_lru_peekl(lru, i));
+
+	/* Using an entry saves it from being evicted next */
+	ck_assert_ptr_nonnull(sp_lru_getl(lru, 6));
+	val = 100;
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 10, &val, 0));
+	ck_assert_int_eq(7, evicted[6]);
+	ck_assert_ptr_nonnull(sp_lru_peekl(lru, 6));
+
+	/* Replacing an entry evicts nothing, and makes it the most recent */
+	val = 60;
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 8, &val, 0));
+	ck_assert_uint_eq(7, lru->evictions);
+	ck_assert_int_eq(60, *(int*)sp_lru_peekl(lru, 8));
+	ck_assert_int_eq(8, *(long*)((char*)lru->keys + lru->head * lru->key_size));
+	ck_assert_int_eq(9, *(long*)((char*)lru->keys + lru->tail * lru->key_size));
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_weight)
+{
+	struct sp_lru *lru;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 100, 10, NULL, NULL, evict_log));
+	nevicted = 0;
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 1, &val, 4));
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 2, &val, 4));
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 3, &val, 2));
+	ck_assert_uint_eq(10, lru->weight);
+	ck_assert_uint_eq(0, nevicted);
+
+	/* Room is made for the whole weight of a new entry */
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 4, &val, 7));
+	ck_assert_uint_eq(2, nevicted);
+	ck_assert_int_eq(1, evicted[0]);
+	ck_assert_int_eq(2, evicted[1]);
+	ck_assert_uint_eq(9, lru->weight);
+	lru_check(lru);
+
+	/* An entry heavier than the whole cache is turned away */
+	ck_assert_int_eq(SP_ERANGE, sp_lru_insertl(lru, 5, &val, 11));
+	ck_assert_uint_eq(2, lru->size);
+	ck_assert_uint_eq(9, lru->weight);
+
+	/* A replaced entry never evicts itself */
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 3, &val, 10));
+	ck_assert_uint_eq(3, nevicted);
+	ck_assert_int_eq(4, evicted[2]);
+	ck_assert_uint_eq(1, lru->size);
+	ck_assert_uint_eq(10, lru->weight);
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 3, &val, 1));
+	ck_assert_uint_eq(1, lru->weight);
+	lru_check(lru);
+	ck_assert_uint_eq(lru->evictions, nevicted);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_evict_bad)
+{
+	struct sp_lru *lru;
+	long i;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 3, 0, NULL, NULL, evict_bad));
+	for (i = 0; i < 3; i++)
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, 0));
+	ck_assert_int_eq(SP_ECALLBK, sp_lru_insertl(lru, 3, &val, 0));
+	ck_assert_ptr_null(sp_lru_peekl(lru, 3));
+	ck_assert_uint_eq(3, lru->size);
+	ck_assert_uint_eq(0, lru->evictions);
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 2, &val, 0));
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_model)
+{
+	/* The cache is compared against an array of keys kept in recency
+	 * order, most recent first */
+	struct sp_lru *lru;
+	long model[16], key;
+	size_t weights[16], n = 0, i, j, weight, total = 0;
+	const size_t cap = LEN(model), max_weight = 40;
+	int k, val;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), cap, max_weight, NULL, NULL, NULL));
+	for (k = 0; k < 5000; k++) {
+		key = rand() % 40;
+		for (i = 0; i < n && model[i] != key; i++);
+		switch (rand() % 3) {
+		case 0:
+			weight = rand() % 8;
+			val = (int)key;
+			ck_assert_int_eq(0, sp_lru_insertl(lru, key, &val, weight));
+			if (i < n) {
+				total -= weights[i];
+				memmove(model + 1, model, i * sizeof(*model));
+				memmove(weights + 1, weights, i * sizeof(*weights));
+				while (total + weight > max_weight)
+					total -= weights[--n];
+			} else {
+				while (n == cap || total + weight > max_weight)
+					total -= weights[--n];
+				memmove(model + 1, model, n * sizeof(*model));
+				memmove(weights + 1, weights, n * sizeof(*weights));
+				n++;
+			}
+			model[0] = key;
+			weights[0] = weight;
+			total += weight;
+			break;
+		case 1:
+			if (i == n) {
+				ck_assert_ptr_null(sp_lru_getl(lru, key));
+				break;
+			}
+			ck_assert_int_eq(key, *(int*)sp_lru_getl(lru, key));
+			weight = weights[i];
+			memmove(model + 1, model, i * sizeof(*model));
+			memmove(weights + 1, weights, i * sizeof(*weights));
+			model[0] = key;
+			weights[0] = weight;
+			break;
+		default:
+			ck_assert_int_eq(i == n ? SP_ENOKEY : 0, sp_lru_removel(lru, key, NULL));
+			if (i < n) {
+				total -= weights[i];
+				memmove(model + i, model + i + 1, (n - i - 1) * sizeof(*model));
+				memmove(weights + i, weights + i + 1, (n - i - 1) * sizeof(*weights));
+				n--;
+			}
+			break;
+		}
+		ck_assert_uint_eq(n, lru->size);
+		ck_assert_uint_eq(total, lru->weight);
+		for (i = 0, j = lru->head; i < n; i++, j = lru->entries[j].next) {
+			ck_assert_int_eq(model[i], *(long*)((char*)lru->keys + j * lru->key_size));
+			ck_assert_uint_eq(weights[i], lru->entries[j].weight);
+		}
+		if (k % 500 == 0)
+			lru_check(lru);
+	}
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_lru *lru;
+	long key = 1;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 4, 0, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_insert(NULL, &key, &val, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_insert(lru, NULL, &val, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_insert(lru, &key, NULL, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_insertl(NULL, key, &val, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_lru_inserti(lru, 1, &val, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_lru_insertc(lru, 1, &val, 0));
+	ck_assert_uint_eq(0, lru->size);
+
+	/* Generic and suffixed keys are the same keys */
+	ck_assert_int_eq(0, sp_lru_insert(lru, &key, &val, 0));
+	ck_assert_ptr_nonnull(sp_lru_getl(lru, 1));
+	ck_assert_int_eq(0, sp_lru_insertl(lru, 1, &val, 0));
+	ck_assert_uint_eq(1, lru->size);
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_evict_order);
+	tcase_add_test(tc, insert_weight);
+	tcase_add_test(tc, insert_evict_bad);
+	tcase_add_test(tc, insert_model);
+	tcase_add_test(tc, insert_bad_args);
+}
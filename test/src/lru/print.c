@@ -0,0 +1,36 @@
+static int print_entry(const void *key, const void *val)
+{
+	printf("%ld\t%d\n", *(const long*)key, *(const int*)val);
+	return 0;
+}
+
+static int print_entry_bad(const void *key, const void *val)
+{
+	return 1;
+}
+
+START_TEST(print_ok)
+{
+	struct sp_lru *lru;
+	long i;
+	int val;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 4, 100, NULL, NULL, NULL));
+	for (i = 0; i < 6; i++) {
+		val = (int)(i * i);
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, (size_t)i));
+	}
+	ck_assert_ptr_nonnull(sp_lru_getl(lru, 3));
+	ck_assert_ptr_null(sp_lru_getl(lru, 0));
+	ck_assert_int_eq(0, sp_lru_print(lru, NULL));
+	ck_assert_int_eq(0, sp_lru_print(lru, print_entry));
+	ck_assert_int_eq(SP_ECALLBK, sp_lru_print(lru, print_entry_bad));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_print(NULL, NULL));
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_ok);
+}
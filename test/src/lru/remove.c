@@ -0,0 +1,73 @@
+START_TEST(remove_ok)
+{
+	struct sp_lru *lru;
+	long i;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 10, 0, NULL, NULL, evict_log));
+	nevicted = 0;
+	for (i = 0; i < 10; i++)
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, 1));
+	for (i = 0; i < 10; i += 2) {
+		ck_assert_int_eq(0, sp_lru_removel(lru, i, NULL));
+		ck_assert_ptr_null(sp_lru_peekl(lru, i));
+		lru_check(lru);
+	}
+	ck_assert_int_eq(SP_ENOKEY, sp_lru_removel(lru, 0, NULL));
+	ck_assert_uint_eq(5, lru->size);
+	ck_assert_uint_eq(5, lru->weight);
+
+	/* Freed entries are reused before anything is evicted */
+	for (i = 10; i < 15; i++)
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &val, 1));
+	ck_assert_uint_eq(0, nevicted);
+	ck_assert_uint_eq(0, lru->evictions);
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+START_TEST(remove_dtor)
+{
+	struct sp_lru *lru;
+	struct data d;
+	long i;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(struct data), 4, 0, NULL, NULL, NULL));
+	for (i = 0; i < 4; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_lru_insertl(lru, i, &d, 0));
+	}
+	i = 1;
+	ck_assert_int_eq(SP_ECALLBK, sp_lru_remove(lru, &i, NULL, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_lru_removel(lru, 1, data_dtor_bad));
+	ck_assert_ptr_nonnull(sp_lru_peekl(lru, 1));
+	ck_assert_int_eq(0, sp_lru_remove(lru, &i, NULL, data_dtor));
+	ck_assert_int_eq(0, sp_lru_removel(lru, 2, data_dtor));
+	ck_assert_uint_eq(2, lru->size);
+	lru_check(lru);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	struct sp_lru *lru;
+	long key = 0;
+	int val = 0;
+	ck_assert_ptr_nonnull(lru = sp_lru_create(sizeof(long), sizeof(int), 2, 0, NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_lru_insertl(lru, key, &val, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_remove(NULL, &key, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_remove(lru, NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_lru_removel(NULL, key, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_lru_removei(lru, 0, NULL));
+	ck_assert_uint_eq(1, lru->size);
+	ck_assert_int_eq(0, sp_lru_destroy(lru, NULL, NULL));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_ok);
+	tcase_add_test(tc, remove_dtor);
+	tcase_add_test(tc, remove_bad_args);
+}
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_matrix.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+#include "matrix/create.c"
+#include "matrix/destroy.c"
+#include "matrix/view.c"
+#include "matrix/eq.c"
+#include "matrix/copy.c"
+#include "matrix/map.c"
+#include "matrix/get.c"
+#include "matrix/set.c"
+#include "matrix/fill.c"
+#include "matrix/transpose.c"
+#include "matrix/mul.c"
+#include "matrix/elementwise.c"
+#include "matrix/sum.c"
+#include "matrix/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create      = tcase_create("create"),
+	      *tc_destroy     = tcase_create("destroy"),
+	      *tc_view        = tcase_create("view"),
+	      *tc_eq          = tcase_create("eq"),
+	      *tc_copy        = tcase_create("copy"),
+	      *tc_map         = tcase_create("map"),
+	      *tc_get         = tcase_create("get"),
+	      *tc_set         = tcase_create("set"),
+	      *tc_fill        = tcase_create("fill"),
+	      *tc_transpose   = tcase_create("transpose"),
+	      *tc_mul         = tcase_create("mul"),
+	      *tc_elementwise = tcase_create("elementwise"),
+	      *tc_sum         = tcase_create("sum"),
+	      *tc_print       = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("matrix");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(view);
+	init_and_add(eq);
+	init_and_add(copy);
+	init_and_add(map);
+	init_and_add(get);
+	init_and_add(set);
+	init_and_add(fill);
+	init_and_add(transpose);
+	init_and_add(mul);
+	init_and_add(elementwise);
+	init_and_add(sum);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
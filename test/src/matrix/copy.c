@@ -0,0 +1,69 @@
+START_TEST(copy_ok)
+{
+	struct sp_matrix *m1, *m2;
+	size_t i;
+	ck_assert_ptr_nonnull(m1 = sp_matrix_create(sizeof(double), 3, 4, 5, 0));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(double), 3, 4, 5, 32));
+	for (i = 0; i < m1->size; i++)
+		((double*)m1->data)[i] = FRANGE(-1000, 1000);
+	ck_assert_int_eq(0, sp_matrix_copy(m2, m1, NULL));
+	ck_assert_int_eq(1, sp_matrix_eq(m1, m2, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m1, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, NULL));
+}
+END_TEST
+
+START_TEST(copy_object)
+{
+	struct sp_matrix *m1, *m2;
+	size_t i;
+	ck_assert_ptr_nonnull(m1 = sp_matrix_create(sizeof(struct data), 2, 2, 2, 0));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(struct data), 2, 2, 2, 0));
+	for (i = 0; i < m1->size; i++)
+		ck_assert_int_eq(0, data_init((struct data*)m1->data + i));
+	ck_assert_int_eq(0, sp_matrix_copy(m2, m1, data_cpy));
+	ck_assert_int_eq(1, sp_matrix_eq(m1, m2, data_cmp));
+	for (i = 0; i < m1->size; i++)
+		ck_assert_ptr_ne(((struct data*)m1->data)[i].name, ((struct data*)m2->data)[i].name);
+	ck_assert_int_eq(0, sp_matrix_destroy(m1, data_dtor));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, data_dtor));
+}
+END_TEST
+
+START_TEST(copy_bad_args)
+{
+	struct sp_matrix *m1, *m2;
+	ck_assert_ptr_nonnull(m1 = sp_matrix_create(sizeof(int), 1, 2, 3, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_copy(NULL, m1, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_copy(m1, NULL, NULL));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(int), 1, 3, 2, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_copy(m2, m1, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, NULL));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(short), 1, 2, 3, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_copy(m2, m1, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m1, NULL));
+}
+END_TEST
+
+START_TEST(copy_bad_cpy)
+{
+	struct sp_matrix *m1, *m2;
+	ck_assert_ptr_nonnull(m1 = sp_matrix_create(sizeof(struct data), 1, 1, 2, 0));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(struct data), 1, 1, 2, 0));
+	ck_assert_int_eq(0, data_init(m1->data));
+	ck_assert_int_eq(0, data_init((struct data*)m1->data + 1));
+	ck_assert_int_eq(SP_ECALLBK, sp_matrix_copy(m2, m1, data_cpy_bad));
+	ck_assert_int_eq(0, sp_matrix_destroy(m1, data_dtor));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, NULL));
+}
+END_TEST
+
+void init_copy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, copy_ok);
+	tcase_add_test(tc, copy_object);
+	tcase_add_test(tc, copy_bad_args);
+	tcase_add_test(tc, copy_bad_cpy);
+}
@@ -0,0 +1,63 @@
+START_TEST(create_ok)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 1, 3, 5, 0));
+	ck_assert_ptr_nonnull(m->data);
+	ck_assert_uint_eq(sizeof(int), m->elem_size);
+	ck_assert_uint_eq(1, m->depth);
+	ck_assert_uint_eq(3, m->rows);
+	ck_assert_uint_eq(5, m->cols);
+	ck_assert_uint_eq(15, m->size);
+	ck_assert_uint_eq(0, (size_t)m->data % sizeof(int));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(double), 4, 2, 3, 0));
+	ck_assert_uint_eq(24, m->size);
+	ck_assert_uint_eq(0, (size_t)m->data % sizeof(double));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(create_aligned)
+{
+	size_t align;
+	for (align = 1; align <= 256; align *= 2) {
+		struct sp_matrix *m;
+		ck_assert_ptr_nonnull(m = sp_matrix_create(1, 2, 7, 9, align));
+		ck_assert_uint_eq(0, (size_t)m->data % align);
+		ck_assert_uint_ge(m->align, align);
+		memset(m->data, 0xAB, m->size);
+		ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	}
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_matrix_create(SIZE_MAX, 1, 1, 2, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 256, 256, 1, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 1, 256, 256, 0));
+	ck_assert_ptr_null(sp_matrix_create(sizeof(int), 1, 128, 128, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 1, 1, 1, SIZE_MAX + 1));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_matrix_create(0, 1, 1, 1, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 0, 1, 1, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 1, 0, 1, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 1, 1, 0, 0));
+	ck_assert_ptr_null(sp_matrix_create(1, 1, 1, 1, 3));
+	ck_assert_ptr_null(sp_matrix_create(1, 1, 1, 1, 48));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_aligned);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,49 @@
+#define setup(T) \
+	struct sp_matrix *m; \
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(T), 2, 3, 4, 0));
+
+START_TEST(destroy_ok)
+{
+	setup(int);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(destroy_object)
+{
+	size_t i;
+	setup(struct data);
+	for (i = 0; i < m->size; i++)
+		ck_assert_int_eq(0, data_init((struct data*)m->data + i));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_destroy(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_destroy(NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_dtor)
+{
+	size_t i;
+	setup(struct data);
+	for (i = 0; i < m->size; i++)
+		ck_assert_int_eq(0, data_init((struct data*)m->data + i));
+	ck_assert_int_eq(SP_ECALLBK, sp_matrix_destroy(m, data_dtor_bad));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, data_dtor));
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_object);
+	tcase_add_test(tc, destroy_bad_args);
+	tcase_add_test(tc, destroy_bad_dtor);
+}
+
+#undef setup
@@ -0,0 +1,107 @@
+#define setup(T) \
+	struct sp_matrix *a, *b, *c; \
+	ck_assert_ptr_nonnull(a = sp_matrix_create(sizeof(T), 2, 5, 7, 0)); \
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(T), 2, 5, 7, 0)); \
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(T), 2, 5, 7, 0));
+
+#define teardown() \
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL)); \
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL)); \
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+
+START_TEST(elementwise_ok)
+{
+	size_t i;
+	setup(long);
+	for (i = 0; i < a->size; i++) {
+		((long*)a->data)[i] = IRANGE(-1000, 1000);
+		((long*)b->data)[i] = IRANGE(-1000, 1000);
+	}
+	ck_assert_int_eq(0, sp_matrix_addl(c, a, b));
+	for (i = 0; i < c->size; i++)
+		ck_assert_int_eq(((long*)a->data)[i] + ((long*)b->data)[i], ((long*)c->data)[i]);
+	ck_assert_int_eq(0, sp_matrix_subl(c, a, b));
+	for (i = 0; i < c->size; i++)
+		ck_assert_int_eq(((long*)a->data)[i] - ((long*)b->data)[i], ((long*)c->data)[i]);
+	ck_assert_int_eq(0, sp_matrix_emull(c, a, b));
+	for (i = 0; i < c->size; i++)
+		ck_assert_int_eq(((long*)a->data)[i] * ((long*)b->data)[i], ((long*)c->data)[i]);
+	ck_assert_int_eq(0, sp_matrix_scalel(c, a, -3));
+	for (i = 0; i < c->size; i++)
+		ck_assert_int_eq(((long*)a->data)[i] * -3, ((long*)c->data)[i]);
+	teardown();
+}
+END_TEST
+
+START_TEST(elementwise_in_place)
+{
+	size_t i;
+	setup(double);
+	for (i = 0; i < a->size; i++) {
+		((double*)a->data)[i] = IRANGE(-1000, 1000);
+		((double*)b->data)[i] = IRANGE(-1000, 1000);
+	}
+	ck_assert_int_eq(0, sp_matrix_copy(c, a, NULL));
+	ck_assert_int_eq(0, sp_matrix_addd(c, c, b));
+	ck_assert_int_eq(0, sp_matrix_subd(c, c, b));
+	ck_assert_int_eq(1, sp_matrix_eq(a, c, NULL));
+	ck_assert_int_eq(0, sp_matrix_scaled(c, c, 2));
+	ck_assert_int_eq(0, sp_matrix_subd(c, c, a));
+	ck_assert_int_eq(1, sp_matrix_eq(a, c, NULL));
+	ck_assert_int_eq(0, sp_matrix_emuld(c, c, c));
+	for (i = 0; i < c->size; i++)
+		ck_assert(((double*)a->data)[i] * ((double*)a->data)[i] == ((double*)c->data)[i]);
+	teardown();
+}
+END_TEST
+
+START_TEST(elementwise_negative_zero)
+{
+	const double nz = -0.0;
+	size_t i;
+	setup(double);
+	ck_assert_int_eq(0, sp_matrix_filld(a, -1));
+	ck_assert_int_eq(0, sp_matrix_filld(b, 0));
+	ck_assert_int_eq(0, sp_matrix_emuld(c, a, b));
+	for (i = 0; i < c->size; i++)
+		ck_assert_mem_eq((double*)c->data + i, &nz, sizeof(nz));
+	ck_assert_int_eq(0, sp_matrix_filld(c, 1));
+	ck_assert_int_eq(0, sp_matrix_scaled(c, b, -1));
+	for (i = 0; i < c->size; i++)
+		ck_assert_mem_eq((double*)c->data + i, &nz, sizeof(nz));
+	teardown();
+}
+END_TEST
+
+START_TEST(elementwise_bad_args)
+{
+	struct sp_matrix *d;
+	setup(int);
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_addi(NULL, a, b));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_subi(c, NULL, b));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_emuli(c, a, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_scalei(NULL, a, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_scalei(c, NULL, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_addd(c, a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_scalec(c, a, 1));
+	ck_assert_ptr_nonnull(d = sp_matrix_create(sizeof(int), 2, 7, 5, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_addi(c, a, d));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_subi(c, d, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_emuli(d, a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_scalei(d, a, 1));
+	ck_assert_int_eq(0, sp_matrix_destroy(d, NULL));
+	teardown();
+}
+END_TEST
+
+void init_elementwise(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, elementwise_ok);
+	tcase_add_test(tc, elementwise_in_place);
+	tcase_add_test(tc, elementwise_negative_zero);
+	tcase_add_test(tc, elementwise_bad_args);
+}
+
+#undef setup
+#undef teardown
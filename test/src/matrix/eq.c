@@ -0,0 +1,65 @@
+START_TEST(eq_ok)
+{
+	struct sp_matrix *m1, *m2, *m3;
+	size_t i;
+	ck_assert_ptr_nonnull(m1 = sp_matrix_create(sizeof(int), 2, 3, 4, 0));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(int), 2, 3, 4, 64));
+	for (i = 0; i < m1->size; i++)
+		((int*)m1->data)[i] = ((int*)m2->data)[i] = rand();
+	ck_assert_int_eq(1, sp_matrix_eq(m1, m2, NULL));
+	ck_assert_int_eq(1, sp_matrix_eq(m1, m1, NULL));
+	((int*)m2->data)[m2->size - 1] ^= 1;
+	ck_assert_int_eq(0, sp_matrix_eq(m1, m2, NULL));
+
+	/* Same number of elements, different dimensions */
+	ck_assert_ptr_nonnull(m3 = sp_matrix_create(sizeof(int), 2, 4, 3, 0));
+	memcpy(m3->data, m1->data, m1->size * sizeof(int));
+	ck_assert_int_eq(0, sp_matrix_eq(m1, m3, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m3, NULL));
+
+	/* Different element sizes */
+	ck_assert_ptr_nonnull(m3 = sp_matrix_create(sizeof(char), 2, 3, 4, 0));
+	ck_assert_int_eq(0, sp_matrix_eq(m1, m3, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m3, NULL));
+
+	ck_assert_int_eq(0, sp_matrix_destroy(m1, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, NULL));
+}
+END_TEST
+
+START_TEST(eq_object)
+{
+	struct sp_matrix *m1, *m2;
+	size_t i;
+	ck_assert_ptr_nonnull(m1 = sp_matrix_create(sizeof(struct data), 1, 3, 3, 0));
+	ck_assert_ptr_nonnull(m2 = sp_matrix_create(sizeof(struct data), 1, 3, 3, 0));
+	for (i = 0; i < m1->size; i++) {
+		ck_assert_int_eq(0, data_init((struct data*)m1->data + i));
+		ck_assert_int_eq(0, data_cpy((struct data*)m2->data + i, (struct data*)m1->data + i));
+	}
+	ck_assert_int_eq(1, sp_matrix_eq(m1, m2, data_cmp));
+	((struct data*)m2->data)[4].age++;
+	ck_assert_int_eq(0, sp_matrix_eq(m1, m2, data_cmp));
+	ck_assert_int_eq(0, sp_matrix_destroy(m1, data_dtor));
+	ck_assert_int_eq(0, sp_matrix_destroy(m2, data_dtor));
+}
+END_TEST
+
+START_TEST(eq_bad_args)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(1, 1, 1, 1, 0));
+	ck_assert_int_eq(0, sp_matrix_eq(NULL, m, NULL));
+	ck_assert_int_eq(0, sp_matrix_eq(m, NULL, NULL));
+	ck_assert_int_eq(0, sp_matrix_eq(NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+void init_eq(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, eq_ok);
+	tcase_add_test(tc, eq_object);
+	tcase_add_test(tc, eq_bad_args);
+}
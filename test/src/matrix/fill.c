@@ -0,0 +1,45 @@
+START_TEST(fill_ok)
+{
+	struct sp_matrix *m;
+	const char pattern[3] = {1, 2, 3};
+	size_t i;
+
+	/* Generic elements of an odd size, in an odd number */
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(pattern), 3, 7, 11, 0));
+	ck_assert_int_eq(0, sp_matrix_fill(m, pattern));
+	for (i = 0; i < m->size; i++)
+		ck_assert_mem_eq((char*)m->data + i * sizeof(pattern), pattern, sizeof(pattern));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(double), 1, 1, 1, 0));
+	ck_assert_int_eq(0, sp_matrix_filld(m, 2.5));
+	ck_assert(sp_matrix_getd(m, 0, 0, 0) == 2.5);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(double), 2, 10, 10, 0));
+	ck_assert_int_eq(0, sp_matrix_filld(m, -1.25));
+	for (i = 0; i < m->size; i++)
+		ck_assert(((double*)m->data)[i] == -1.25);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(fill_bad_args)
+{
+	struct sp_matrix *m;
+	const double val = 0;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(double), 1, 2, 2, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_fill(NULL, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_fill(m, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_filld(NULL, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_fills(m, 0));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+void init_fill(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, fill_ok);
+	tcase_add_test(tc, fill_bad_args);
+}
@@ -0,0 +1,45 @@
+START_TEST(get_ok)
+{
+	struct sp_matrix *m;
+	size_t k, i, j;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 3, 4, 5, 0));
+	for (i = 0; i < m->size; i++)
+		((int*)m->data)[i] = i;
+
+	/* Elements are stored plane by plane, row by row */
+	for (k = 0; k < 3; k++)
+	for (i = 0; i < 4; i++)
+	for (j = 0; j < 5; j++) {
+		const int val = (k * 4 + i) * 5 + j;
+		ck_assert_int_eq(val, *(int*)sp_matrix_get(m, k, i, j));
+		ck_assert_int_eq(val, sp_matrix_geti(m, k, i, j));
+	}
+
+	/* The element can be modified in place */
+	*(int*)sp_matrix_get(m, 2, 3, 4) = -1;
+	ck_assert_int_eq(-1, sp_matrix_geti(m, 2, 3, 4));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 2, 3, 4, 0));
+	ck_assert_ptr_null(sp_matrix_get(NULL, 0, 0, 0));
+	ck_assert_ptr_null(sp_matrix_get(m, 2, 0, 0));
+	ck_assert_ptr_null(sp_matrix_get(m, 0, 3, 0));
+	ck_assert_ptr_null(sp_matrix_get(m, 0, 0, 4));
+	ck_assert_int_eq(0, sp_matrix_geti(NULL, 0, 0, 0));
+	ck_assert_int_eq(0, sp_matrix_geti(m, 1, 2, 4));
+	ck_assert(sp_matrix_getd(m, 0, 0, 0) == 0);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_ok);
+	tcase_add_test(tc, get_bad_args);
+}
@@ -0,0 +1,41 @@
+START_TEST(map_ok)
+{
+	struct sp_matrix *m;
+	size_t i;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(struct data), 2, 3, 4, 0));
+	for (i = 0; i < m->size; i++)
+		ck_assert_int_eq(0, data_init((struct data*)m->data + i));
+	ck_assert_int_eq(0, sp_matrix_map(m, data_mutate));
+	for (i = 0; i < m->size; i++)
+		ck_assert_int_eq(0, data_verify((struct data*)m->data + i, i));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, data_dtor));
+}
+END_TEST
+
+START_TEST(map_bad_args)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(1, 1, 1, 1, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_map(NULL, data_mutate));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_map(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(map_bad_func)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(struct data), 1, 1, 1, 0));
+	ck_assert_int_eq(0, data_init(m->data));
+	ck_assert_int_eq(SP_ECALLBK, sp_matrix_map(m, data_mutate_bad));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, data_dtor));
+}
+END_TEST
+
+void init_map(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, map_ok);
+	tcase_add_test(tc, map_bad_args);
+	tcase_add_test(tc, map_bad_func);
+}
@@ -0,0 +1,124 @@
+/* Multiplies random matrices of unsigned char, whose arithmetic wraps around,
+ * and checks the product against the textbook algorithm */
+static void mul_check(size_t depth, size_t m, size_t n, size_t p)
+{
+	struct sp_matrix *a, *b, *c;
+	size_t k, i, j, l;
+	ck_assert_ptr_nonnull(a = sp_matrix_create(sizeof(unsigned char), depth, m, n, 0));
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(unsigned char), depth, n, p, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(unsigned char), depth, m, p, 0));
+	for (i = 0; i < a->size; i++)
+		((unsigned char*)a->data)[i] = rand();
+	for (i = 0; i < b->size; i++)
+		((unsigned char*)b->data)[i] = rand();
+	for (i = 0; i < c->size; i++)
+		((unsigned char*)c->data)[i] = rand();
+	ck_assert_int_eq(0, sp_matrix_muluc(c, a, b));
+	for (k = 0; k < depth; k++)
+	for (i = 0; i < m; i++)
+	for (j = 0; j < p; j++) {
+		unsigned sum = 0;
+		for (l = 0; l < n; l++)
+			sum += sp_matrix_getuc(a, k, i, l) * sp_matrix_getuc(b, k, l, j);
+		ck_assert_uint_eq(sum % 256, sp_matrix_getuc(c, k, i, j));
+	}
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+}
+
+START_TEST(mul_ok)
+{
+	struct sp_matrix *a, *b, *c;
+	const double va[] = {1, 2, 3, 4, 5, 6}, vb[] = {7, 8, 9, 10, 11, 12},
+	             vc[] = {58, 64, 139, 154};
+	ck_assert_ptr_nonnull(a = sp_matrix_create(sizeof(double), 1, 2, 3, 0));
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(double), 1, 3, 2, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(double), 1, 2, 2, 0));
+	memcpy(a->data, va, sizeof(va));
+	memcpy(b->data, vb, sizeof(vb));
+	ck_assert_int_eq(0, sp_matrix_muld(c, a, b));
+	ck_assert_mem_eq(c->data, vc, sizeof(vc));
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+}
+END_TEST
+
+START_TEST(mul_shapes)
+{
+	mul_check(1, 1, 1, 1);
+	mul_check(1, 1, 7, 1);
+	mul_check(1, 7, 1, 7);
+	mul_check(1, 4, 4, 4);
+	mul_check(3, 9, 5, 6);
+	mul_check(2, 13, 17, 11);
+}
+END_TEST
+
+START_TEST(mul_tiles)
+{
+	/* Cross every tile boundary, with row counts not divisible by 4 */
+	mul_check(1, 6, 130, 260);
+	mul_check(1, 31, 257, 70);
+}
+END_TEST
+
+START_TEST(mul_identity)
+{
+	struct sp_matrix *a, *id, *c;
+	size_t i;
+	ck_assert_ptr_nonnull(a  = sp_matrix_create(sizeof(float), 2, 21, 21, 0));
+	ck_assert_ptr_nonnull(id = sp_matrix_create(sizeof(float), 2, 21, 21, 0));
+	ck_assert_ptr_nonnull(c  = sp_matrix_create(sizeof(float), 2, 21, 21, 0));
+	for (i = 0; i < a->size; i++)
+		((float*)a->data)[i] = FRANGE(-100, 100);
+	ck_assert_int_eq(0, sp_matrix_fillf(id, 0));
+	for (i = 0; i < 21; i++) {
+		ck_assert_int_eq(0, sp_matrix_setf(id, 0, i, i, 1));
+		ck_assert_int_eq(0, sp_matrix_setf(id, 1, i, i, 1));
+	}
+	ck_assert_int_eq(0, sp_matrix_mulf(c, a, id));
+	ck_assert_int_eq(1, sp_matrix_eq(a, c, NULL));
+	ck_assert_int_eq(0, sp_matrix_mulf(c, id, a));
+	ck_assert_int_eq(1, sp_matrix_eq(a, c, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(id, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+}
+END_TEST
+
+START_TEST(mul_bad_args)
+{
+	struct sp_matrix *a, *b, *c;
+	ck_assert_ptr_nonnull(a = sp_matrix_create(sizeof(int), 1, 2, 3, 0));
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(int), 1, 3, 3, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(int), 1, 2, 3, 0));
+	ck_assert_int_eq(0, sp_matrix_filli(a, 1));
+	ck_assert_int_eq(0, sp_matrix_filli(b, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_muli(NULL, a, b));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_muli(c, NULL, b));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_muli(c, a, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_muli(a, a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_muli(b, b, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_muli(c, b, a));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_mull(c, a, b));
+	ck_assert_int_eq(0, sp_matrix_muli(c, a, b));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(int), 2, 2, 3, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_muli(c, a, b));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+}
+END_TEST
+
+void init_mul(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, mul_ok);
+	tcase_add_test(tc, mul_shapes);
+	tcase_add_test(tc, mul_tiles);
+	tcase_add_test(tc, mul_identity);
+	tcase_add_test(tc, mul_bad_args);
+}
@@ -0,0 +1,50 @@
+START_TEST(print_object)
+{
+	struct sp_matrix *m;
+	size_t i;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(struct data), 2, 1, 2, 0));
+	for (i = 0; i < m->size; i++)
+		ck_assert_int_eq(0, data_init((struct data*)m->data + i));
+	ck_assert_int_eq(0, sp_matrix_print(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_print(m, data_print));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, data_dtor));
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 1, 2, 3, 0));
+	ck_assert_int_eq(0, sp_matrix_filli(m, 7));
+	ck_assert_int_eq(0, sp_matrix_printi(m));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_printd(m));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_print(NULL, data_print));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_printi(NULL));
+}
+END_TEST
+
+START_TEST(print_bad_callback)
+{
+	struct sp_matrix *m;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(struct data), 1, 1, 1, 0));
+	ck_assert_int_eq(0, data_init(m->data));
+	ck_assert_int_eq(SP_ECALLBK, sp_matrix_print(m, data_print_bad));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, data_dtor));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+	tcase_add_test(tc, print_bad_callback);
+}
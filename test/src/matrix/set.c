@@ -0,0 +1,43 @@
+START_TEST(set_ok)
+{
+	struct sp_matrix *m;
+	size_t k, i, j;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(long), 2, 3, 4, 0));
+	for (k = 0; k < 2; k++)
+	for (i = 0; i < 3; i++)
+	for (j = 0; j < 4; j++) {
+		const long val = k * 100 + i * 10 + j;
+		if (j % 2)
+			ck_assert_int_eq(0, sp_matrix_set(m, k, i, j, &val));
+		else
+			ck_assert_int_eq(0, sp_matrix_setl(m, k, i, j, val));
+	}
+	for (i = 0; i < m->size; i++)
+		ck_assert_int_eq((i / 12) * 100 + (i / 4 % 3) * 10 + i % 4, ((long*)m->data)[i]);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(set_bad_args)
+{
+	struct sp_matrix *m;
+	const long val = 0;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(long), 2, 3, 4, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_set(NULL, 0, 0, 0, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_set(m, 0, 0, 0, NULL));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_set(m, 2, 0, 0, &val));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_set(m, 0, 3, 0, &val));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_set(m, 0, 0, 4, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_setl(NULL, 0, 0, 0, 0));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_setl(m, 0, 0, 4, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_setc(m, 0, 0, 0, 0));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+void init_set(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, set_ok);
+	tcase_add_test(tc, set_bad_args);
+}
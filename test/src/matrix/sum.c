@@ -0,0 +1,84 @@
+START_TEST(sum_ok)
+{
+	struct sp_matrix *m, *r, *c;
+	size_t k, i, j;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(long), 3, 6, 9, 0));
+	ck_assert_ptr_nonnull(r = sp_matrix_create(sizeof(long), 3, 6, 1, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(long), 3, 1, 9, 0));
+	for (i = 0; i < m->size; i++)
+		((long*)m->data)[i] = IRANGE(-1000, 1000);
+	ck_assert_int_eq(0, sp_matrix_rowsuml(r, m));
+	ck_assert_int_eq(0, sp_matrix_colsuml(c, m));
+	for (k = 0; k < 3; k++) {
+		for (i = 0; i < 6; i++) {
+			long sum = 0;
+			for (j = 0; j < 9; j++)
+				sum += sp_matrix_getl(m, k, i, j);
+			ck_assert_int_eq(sum, sp_matrix_getl(r, k, i, 0));
+		}
+		for (j = 0; j < 9; j++) {
+			long sum = 0;
+			for (i = 0; i < 6; i++)
+				sum += sp_matrix_getl(m, k, i, j);
+			ck_assert_int_eq(sum, sp_matrix_getl(c, k, 0, j));
+		}
+	}
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(r, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+}
+END_TEST
+
+START_TEST(sum_in_place)
+{
+	struct sp_matrix *m, *v;
+	size_t i;
+
+	/* A single row or column is its own sum */
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 2, 1, 10, 0));
+	ck_assert_ptr_nonnull(v = sp_matrix_create(sizeof(int), 2, 1, 10, 0));
+	for (i = 0; i < m->size; i++)
+		((int*)m->data)[i] = ((int*)v->data)[i] = rand() % 100;
+	ck_assert_int_eq(0, sp_matrix_colsumi(m, m));
+	ck_assert_int_eq(1, sp_matrix_eq(m, v, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(v, NULL));
+
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 2, 10, 1, 0));
+	ck_assert_ptr_nonnull(v = sp_matrix_create(sizeof(int), 2, 10, 1, 0));
+	for (i = 0; i < m->size; i++)
+		((int*)m->data)[i] = ((int*)v->data)[i] = rand() % 100;
+	ck_assert_int_eq(0, sp_matrix_rowsumi(m, m));
+	ck_assert_int_eq(1, sp_matrix_eq(m, v, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(v, NULL));
+}
+END_TEST
+
+START_TEST(sum_bad_args)
+{
+	struct sp_matrix *m, *r, *c;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 2, 3, 4, 0));
+	ck_assert_ptr_nonnull(r = sp_matrix_create(sizeof(int), 2, 3, 1, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(int), 2, 1, 4, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_rowsumi(NULL, m));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_rowsumi(r, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_colsumi(NULL, m));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_colsumi(c, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_rowsumi(c, m));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_colsumi(r, m));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_rowsumd(r, m));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_colsums(c, m));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(r, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+}
+END_TEST
+
+void init_sum(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, sum_ok);
+	tcase_add_test(tc, sum_in_place);
+	tcase_add_test(tc, sum_bad_args);
+}
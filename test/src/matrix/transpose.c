@@ -0,0 +1,83 @@
+/* Transposes a random matrix with elements of the given size, and checks every
+ * element against its source */
+static void transpose_check(size_t elem_size, size_t depth, size_t rows, size_t cols)
+{
+	struct sp_matrix *m, *t;
+	size_t k, i, j;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(elem_size, depth, rows, cols, 0));
+	ck_assert_ptr_nonnull(t = sp_matrix_create(elem_size, depth, cols, rows, 0));
+	for (i = 0; i < m->size * elem_size; i++)
+		((unsigned char*)m->data)[i] = rand();
+	ck_assert_int_eq(0, sp_matrix_transpose(t, m));
+	for (k = 0; k < depth; k++)
+	for (i = 0; i < rows; i++)
+	for (j = 0; j < cols; j++)
+		ck_assert_mem_eq(sp_matrix_get(t, k, j, i), sp_matrix_get(m, k, i, j), elem_size);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(t, NULL));
+}
+
+START_TEST(transpose_ok)
+{
+	transpose_check(sizeof(int), 1, 1, 1);
+	transpose_check(sizeof(int), 1, 1, 20);
+	transpose_check(sizeof(int), 1, 20, 1);
+	transpose_check(sizeof(int), 1, 32, 32);
+	transpose_check(sizeof(double), 2, 70, 45);
+}
+END_TEST
+
+START_TEST(transpose_elem_sizes)
+{
+	size_t elem_size;
+	for (elem_size = 1; elem_size <= 9; elem_size++)
+		transpose_check(elem_size, 3, 33, 40);
+}
+END_TEST
+
+START_TEST(transpose_twice)
+{
+	struct sp_matrix *m, *t, *u;
+	size_t i;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(short), 2, 50, 65, 0));
+	ck_assert_ptr_nonnull(t = sp_matrix_create(sizeof(short), 2, 65, 50, 0));
+	ck_assert_ptr_nonnull(u = sp_matrix_create(sizeof(short), 2, 50, 65, 0));
+	for (i = 0; i < m->size; i++)
+		((short*)m->data)[i] = rand();
+	ck_assert_int_eq(0, sp_matrix_transpose(t, m));
+	ck_assert_int_eq(0, sp_matrix_transpose(u, t));
+	ck_assert_int_eq(1, sp_matrix_eq(m, u, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(t, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(u, NULL));
+}
+END_TEST
+
+START_TEST(transpose_bad_args)
+{
+	struct sp_matrix *m, *t;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), 1, 2, 3, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_transpose(NULL, m));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_transpose(m, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_transpose(m, m));
+	ck_assert_ptr_nonnull(t = sp_matrix_create(sizeof(int), 1, 2, 3, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_transpose(t, m));
+	ck_assert_int_eq(0, sp_matrix_destroy(t, NULL));
+	ck_assert_ptr_nonnull(t = sp_matrix_create(sizeof(int), 2, 3, 2, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_transpose(t, m));
+	ck_assert_int_eq(0, sp_matrix_destroy(t, NULL));
+	ck_assert_ptr_nonnull(t = sp_matrix_create(sizeof(short), 1, 3, 2, 0));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_transpose(t, m));
+	ck_assert_int_eq(0, sp_matrix_destroy(t, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+void init_transpose(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, transpose_ok);
+	tcase_add_test(tc, transpose_elem_sizes);
+	tcase_add_test(tc, transpose_twice);
+	tcase_add_test(tc, transpose_bad_args);
+}
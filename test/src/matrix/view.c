@@ -0,0 +1,290 @@
+/* Creates a matrix of ints where every element holds its own linear index */
+static struct sp_matrix *view_numbered(size_t depth, size_t rows, size_t cols)
+{
+	struct sp_matrix *m;
+	size_t i;
+	ck_assert_ptr_nonnull(m = sp_matrix_create(sizeof(int), depth, rows, cols, 0));
+	for (i = 0; i < m->size; i++)
+		((int*)m->data)[i] = i;
+	return m;
+}
+
+START_TEST(view_slice)
+{
+	struct sp_matrix *m, v, w;
+	size_t k, i, j;
+	m = view_numbered(3, 5, 6);
+	ck_assert_int_eq(0, sp_matrix_slice(&v, m, 1, 2, 1, 2, 3, 4));
+	ck_assert_uint_eq(v.depth, 2);
+	ck_assert_uint_eq(v.rows, 3);
+	ck_assert_uint_eq(v.cols, 4);
+	ck_assert_uint_eq(v.size, 24);
+	ck_assert_uint_eq(v.align, 0);
+	for (k = 0; k < v.depth; k++)
+	for (i = 0; i < v.rows; i++)
+	for (j = 0; j < v.cols; j++)
+		ck_assert_ptr_eq(sp_matrix_get(&v, k, i, j), sp_matrix_get(m, k + 1, i + 2, j + 1));
+
+	/* Writes through a view land in the underlying matrix */
+	ck_assert_int_eq(0, sp_matrix_seti(&v, 1, 2, 3, -1));
+	ck_assert_int_eq(-1, sp_matrix_geti(m, 2, 4, 4));
+
+	/* Views of views compose */
+	ck_assert_int_eq(0, sp_matrix_slice(&w, &v, 1, 1, 1, 1, 2, 2));
+	ck_assert_ptr_eq(sp_matrix_get(&w, 0, 1, 1), sp_matrix_get(m, 2, 4, 3));
+
+	/* The whole matrix */
+	ck_assert_int_eq(0, sp_matrix_slice(&v, m, 0, 0, 0, 3, 5, 6));
+	ck_assert_int_eq(1, sp_matrix_eq(&v, m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(view_slice_bad_args)
+{
+	struct sp_matrix *m, v;
+	m = view_numbered(2, 3, 4);
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_slice(NULL, m, 0, 0, 0, 1, 1, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_slice(&v, NULL, 0, 0, 0, 1, 1, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_slice(&v, m, 0, 0, 0, 0, 1, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_slice(&v, m, 0, 0, 0, 1, 0, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_slice(&v, m, 0, 0, 0, 1, 1, 0));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_slice(&v, m, 2, 0, 0, 1, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_slice(&v, m, 1, 0, 0, 2, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_slice(&v, m, 0, 1, 0, 1, 3, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_slice(&v, m, 0, 0, 4, 1, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_slice(&v, m, 0, 0, 1, 1, 1, (size_t)-1));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_row(&v, m, 0, 3));
+	ck_assert_int_eq(SP_EINDEX, sp_matrix_col(&v, m, 2, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_row(&v, NULL, 0, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_col(&v, NULL, 0, 0));
+	ck_assert_int_eq(0, sp_matrix_slice(&v, m, 0, 0, 0, 1, 1, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_destroy(&v, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(view_row_col)
+{
+	struct sp_matrix *m, v;
+	size_t i;
+	m = view_numbered(2, 4, 5);
+	ck_assert_int_eq(0, sp_matrix_row(&v, m, 1, 2));
+	ck_assert_uint_eq(v.depth, 1);
+	ck_assert_uint_eq(v.rows, 1);
+	ck_assert_uint_eq(v.cols, 5);
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(sp_matrix_geti(&v, 0, 0, i), 20 + 10 + i);
+	ck_assert_int_eq(0, sp_matrix_col(&v, m, 1, 3));
+	ck_assert_uint_eq(v.depth, 1);
+	ck_assert_uint_eq(v.rows, 4);
+	ck_assert_uint_eq(v.cols, 1);
+	for (i = 0; i < 4; i++)
+		ck_assert_int_eq(sp_matrix_geti(&v, 0, i, 0), 20 + i * 5 + 3);
+	ck_assert_int_eq(0, sp_matrix_filli(&v, 7));
+	for (i = 0; i < 4; i++)
+		ck_assert_int_eq(sp_matrix_geti(m, 1, i, 3), 7);
+	ck_assert_int_eq(sp_matrix_geti(m, 1, 0, 2), 22);
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(view_transposed)
+{
+	struct sp_matrix *m, *t, v, w;
+	size_t k, i, j;
+	m = view_numbered(2, 7, 3);
+	ck_assert_int_eq(0, sp_matrix_transposed(&v, m));
+	ck_assert_uint_eq(v.depth, 2);
+	ck_assert_uint_eq(v.rows, 3);
+	ck_assert_uint_eq(v.cols, 7);
+	for (k = 0; k < 2; k++)
+	for (i = 0; i < 7; i++)
+	for (j = 0; j < 3; j++)
+		ck_assert_ptr_eq(sp_matrix_get(&v, k, j, i), sp_matrix_get(m, k, i, j));
+
+	/* Agrees with the copying transposition */
+	ck_assert_ptr_nonnull(t = sp_matrix_create(sizeof(int), 2, 3, 7, 0));
+	ck_assert_int_eq(0, sp_matrix_transpose(t, m));
+	ck_assert_int_eq(1, sp_matrix_eq(t, &v, NULL));
+
+	/* Transposing in place, and back */
+	w = v;
+	ck_assert_int_eq(0, sp_matrix_transposed(&w, &w));
+	ck_assert_int_eq(1, sp_matrix_eq(&w, m, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_transposed(NULL, m));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_transposed(&v, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(t, NULL));
+}
+END_TEST
+
+START_TEST(view_reshape)
+{
+	struct sp_matrix *m, v, w;
+	size_t i;
+	m = view_numbered(2, 3, 4);
+	ck_assert_int_eq(0, sp_matrix_reshape(&v, m, 1, 6, 4));
+	ck_assert_int_eq(sp_matrix_geti(&v, 0, 5, 3), 23);
+	ck_assert_int_eq(0, sp_matrix_reshape(&v, m, 4, 3, 2));
+	for (i = 0; i < 24; i++)
+		ck_assert_int_eq(sp_matrix_geti(&v, i / 6, i / 2 % 3, i % 2), i);
+
+	/* A slice of whole rows is still contiguous, a narrower one is not */
+	ck_assert_int_eq(0, sp_matrix_slice(&w, m, 1, 0, 0, 1, 2, 4));
+	ck_assert_int_eq(0, sp_matrix_reshape(&v, &w, 1, 1, 8));
+	ck_assert_int_eq(sp_matrix_geti(&v, 0, 0, 7), 19);
+	ck_assert_int_eq(0, sp_matrix_slice(&w, m, 0, 0, 0, 1, 2, 3));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_reshape(&v, &w, 1, 1, 6));
+	ck_assert_int_eq(0, sp_matrix_transposed(&w, m));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_reshape(&v, &w, 1, 1, 24));
+
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_reshape(NULL, m, 1, 1, 24));
+	ck_assert_int_eq(SP_EINVAL, sp_matrix_reshape(&v, NULL, 1, 1, 24));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_reshape(&v, m, 0, 1, 24));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_reshape(&v, m, 1, 5, 5));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_reshape(&v, m, 5, 1, 5));
+	ck_assert_int_eq(SP_EILLEGAL, sp_matrix_reshape(&v, m, 1, 1, 25));
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+}
+END_TEST
+
+START_TEST(view_ops)
+{
+	struct sp_matrix *a, *b, *c, *d, va, vb, vc;
+	size_t i, j;
+
+	/* Multiplication by a transposed view matches multiplication by a
+	 * transposed copy */
+	ck_assert_ptr_nonnull(a = sp_matrix_create(sizeof(long), 1, 9, 13, 0));
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(long), 1, 11, 13, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(long), 1, 13, 11, 0));
+	ck_assert_ptr_nonnull(d = sp_matrix_create(sizeof(long), 1, 9, 11, 0));
+	for (i = 0; i < a->size; i++)
+		((long*)a->data)[i] = rand() % 100 - 50;
+	for (i = 0; i < b->size; i++)
+		((long*)b->data)[i] = rand() % 100 - 50;
+	ck_assert_int_eq(0, sp_matrix_transpose(c, b));
+	ck_assert_int_eq(0, sp_matrix_mull(d, a, c));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(long), 1, 9, 11, 0));
+	ck_assert_int_eq(0, sp_matrix_transposed(&vb, b));
+	ck_assert_int_eq(0, sp_matrix_mull(c, a, &vb));
+	ck_assert_int_eq(1, sp_matrix_eq(c, d, NULL));
+
+	/* The same, with a transposed destination, and with sliced operands */
+	ck_assert_int_eq(0, sp_matrix_filll(c, 0));
+	ck_assert_int_eq(0, sp_matrix_transposed(&vc, c));
+	ck_assert_int_eq(0, sp_matrix_transposed(&va, a));
+	ck_assert_int_eq(0, sp_matrix_mull(&vc, b, &va));
+	ck_assert_int_eq(1, sp_matrix_eq(c, d, NULL));
+	ck_assert_int_eq(0, sp_matrix_filll(c, 0));
+	ck_assert_int_eq(0, sp_matrix_slice(&va, a, 0, 2, 0, 1, 5, 13));
+	ck_assert_int_eq(0, sp_matrix_slice(&vc, c, 0, 3, 0, 1, 5, 11));
+	ck_assert_int_eq(0, sp_matrix_mull(&vc, &va, &vb));
+	for (i = 0; i < 9; i++)
+	for (j = 0; j < 11; j++)
+		ck_assert_int_eq(sp_matrix_getl(c, 0, i, j), i >= 3 && i < 8 ? sp_matrix_getl(d, 0, i - 1, j) : 0);
+
+	/* Element-wise operations between windows and transposed views */
+	ck_assert_int_eq(0, sp_matrix_slice(&va, a, 0, 0, 2, 1, 9, 11));
+	ck_assert_int_eq(0, sp_matrix_addl(c, &va, d));
+	ck_assert_int_eq(0, sp_matrix_subl(c, c, d));
+	ck_assert_int_eq(1, sp_matrix_eq(c, &va, NULL));
+	ck_assert_int_eq(0, sp_matrix_slice(&va, b, 0, 0, 0, 1, 11, 9));
+	ck_assert_int_eq(0, sp_matrix_transposed(&va, &va));
+	ck_assert_int_eq(0, sp_matrix_emull(c, &va, &va));
+	ck_assert_int_eq(0, sp_matrix_transposed(&vc, c));
+	ck_assert_int_eq(0, sp_matrix_scalel(&vc, &vc, 2));
+	for (i = 0; i < 9; i++)
+	for (j = 0; j < 11; j++)
+		ck_assert_int_eq(sp_matrix_getl(c, 0, i, j), 2 * sp_matrix_getl(b, 0, j, i) * sp_matrix_getl(b, 0, j, i));
+
+	/* Sums over transposed views and into views */
+	ck_assert_int_eq(0, sp_matrix_destroy(d, NULL));
+	ck_assert_ptr_nonnull(d = sp_matrix_create(sizeof(long), 1, 1, 13, 0));
+	ck_assert_int_eq(0, sp_matrix_transposed(&va, d));
+	ck_assert_int_eq(0, sp_matrix_rowsuml(&va, &vb));
+	ck_assert_int_eq(0, sp_matrix_row(&vc, c, 0, 0));
+	ck_assert_int_eq(0, sp_matrix_colsuml(&vc, &vb));
+	for (j = 0; j < 13; j++) {
+		long sum = 0;
+		for (i = 0; i < 11; i++)
+			sum += sp_matrix_getl(b, 0, i, j);
+		ck_assert_int_eq(sp_matrix_getl(d, 0, 0, j), sum);
+	}
+	for (i = 0; i < 11; i++) {
+		long sum = 0;
+		for (j = 0; j < 13; j++)
+			sum += sp_matrix_getl(b, 0, i, j);
+		ck_assert_int_eq(sp_matrix_getl(c, 0, 0, i), sum);
+	}
+
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(d, NULL));
+}
+END_TEST
+
+static int view_map_func(void *elem, size_t idx)
+{
+	*(int*)elem = idx;
+	return 0;
+}
+
+START_TEST(view_generic_ops)
+{
+	struct sp_matrix *m, *n, v, w;
+	size_t k, i, j;
+	const int val = 42;
+	m = view_numbered(3, 6, 7);
+	ck_assert_ptr_nonnull(n = sp_matrix_create(sizeof(int), 2, 4, 3, 0));
+
+	/* Copying a window out of a larger matrix, and back into a window */
+	ck_assert_int_eq(0, sp_matrix_slice(&v, m, 1, 1, 0, 2, 4, 3));
+	ck_assert_int_eq(0, sp_matrix_copy(n, &v, NULL));
+	ck_assert_int_eq(1, sp_matrix_eq(n, &v, NULL));
+	for (k = 0; k < 2; k++)
+	for (i = 0; i < 4; i++)
+	for (j = 0; j < 3; j++)
+		ck_assert_int_eq(sp_matrix_geti(n, k, i, j), (k + 1) * 42 + (i + 1) * 7 + j);
+	ck_assert_int_eq(0, sp_matrix_slice(&w, m, 0, 2, 4, 2, 4, 3));
+	ck_assert_int_eq(0, sp_matrix_copy(&w, n, NULL));
+	ck_assert_int_eq(1, sp_matrix_eq(&w, &v, NULL));
+	ck_assert_int_eq(0, sp_matrix_eq(&w, m, NULL));
+
+	/* Mapping visits the elements of a view in row-major order */
+	ck_assert_int_eq(0, sp_matrix_transposed(&v, n));
+	ck_assert_int_eq(0, sp_matrix_map(&v, view_map_func));
+	for (k = 0; k < 2; k++)
+	for (i = 0; i < 3; i++)
+	for (j = 0; j < 4; j++)
+		ck_assert_int_eq(sp_matrix_geti(n, k, j, i), k * 12 + i * 4 + j);
+
+	/* Filling, with and without contiguous rows */
+	ck_assert_int_eq(0, sp_matrix_fill(&v, &val));
+	ck_assert_int_eq(0, sp_matrix_slice(&w, m, 2, 1, 1, 1, 2, 5));
+	ck_assert_int_eq(0, sp_matrix_fill(&w, &val));
+	for (i = 0; i < n->size; i++)
+		ck_assert_int_eq(((int*)n->data)[i], 42);
+	for (i = 0; i < 6; i++)
+	for (j = 0; j < 7; j++)
+		ck_assert_int_eq(sp_matrix_geti(m, 2, i, j) == 42, i >= 1 && i < 3 && j >= 1 && j < 6);
+
+	ck_assert_int_eq(0, sp_matrix_destroy(m, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(n, NULL));
+}
+END_TEST
+
+void init_view(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, view_slice);
+	tcase_add_test(tc, view_slice_bad_args);
+	tcase_add_test(tc, view_row_col);
+	tcase_add_test(tc, view_transposed);
+	tcase_add_test(tc, view_reshape);
+	tcase_add_test(tc, view_ops);
+	tcase_add_test(tc, view_generic_ops);
+}
@@ -0,0 +1,110 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_pool.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks that the slabs add up to the capacity, and that every block carved
+ * out of them so far is either handed out or on the free list, which only
+ * links carved blocks */
+static void pool_check(const struct sp_pool *pool)
+{
+	size_t i, carved = 0, capacity = 0, nfree = 0;
+	const void *block;
+	ck_assert_uint_le(pool->used, pool->nslabs);
+	ck_assert_uint_ge(pool->stride, pool->block_size);
+	ck_assert_uint_ge(pool->stride, sizeof(void*));
+	ck_assert_uint_eq(0, pool->stride % sizeof(void*));
+	for (i = 0; i < pool->nslabs; i++) {
+		capacity += pool->slabs[i].size;
+		if (i + 1 < pool->used)
+			carved += pool->slabs[i].size;
+		else if (i + 1 == pool->used)
+			carved += pool->slabs[i].size - pool->left;
+	}
+	if (pool->used == 0)
+		ck_assert_uint_eq(0, pool->left);
+	ck_assert_uint_eq(pool->capacity, capacity);
+	for (block = pool->free; block != NULL; block = *(void* const*)block) {
+		for (i = 0; i < pool->used; i++) {
+			const char *const data = pool->slabs[i].data;
+			if ((const char*)block >= data && (const char*)block < data + pool->slabs[i].size * pool->stride)
+				break;
+		}
+		ck_assert_uint_lt(i, pool->used);
+		ck_assert_uint_le(++nfree, carved);
+	}
+	ck_assert_uint_eq(carved, pool->size + nfree);
+}
+
+/* Number of times the hooks were invoked */
+static size_t nctor, ndtor;
+
+static int ctor_count(void *block)
+{
+	++nctor;
+	memset(block, 0xAB, sizeof(long));
+	return 0;
+}
+
+static int dtor_count(void *block)
+{
+	++ndtor;
+	return 0;
+}
+
+static int hook_bad(void *block)
+{
+	return 1;
+}
+
+#include "pool/create.c"
+#include "pool/alloc.c"
+#include "pool/reset.c"
+#include "pool/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_alloc  = tcase_create("alloc"),
+	      *tc_reset  = tcase_create("reset"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("pool");
+	init_and_add(create);
+	init_and_add(alloc);
+	init_and_add(reset);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
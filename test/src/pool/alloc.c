@@ -0,0 +1,165 @@
+START_TEST(alloc_ok)
+{
+	struct sp_pool *pool;
+	long *blocks[100];
+	size_t i, j;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(long), 4, NULL, NULL));
+
+	/* Slabs double in size as the pool grows */
+	for (i = 0; i < LEN(blocks); i++) {
+		ck_assert_ptr_nonnull(blocks[i] = sp_pool_alloc(pool));
+		ck_assert_uint_eq(0, (unsigned long)blocks[i] % sizeof(long));
+		*blocks[i] = (long)i;
+		ck_assert_uint_eq(i + 1, pool->size);
+	}
+	ck_assert_uint_eq(5, pool->nslabs);
+	ck_assert_uint_eq(4 + 8 + 16 + 32 + 64, pool->capacity);
+	pool_check(pool);
+	for (i = 0; i < LEN(blocks); i++) {
+		ck_assert_int_eq((long)i, *blocks[i]);
+		for (j = 0; j < i; j++)
+			ck_assert_ptr_ne(blocks[i], blocks[j]);
+	}
+
+	/* Freed blocks are reused last in, first out, without growing */
+	for (i = 0; i < LEN(blocks); i += 3)
+		ck_assert_int_eq(0, sp_pool_free(pool, blocks[i]));
+	pool_check(pool);
+	for (i = 99; i < LEN(blocks); i -= 3)
+		ck_assert_ptr_eq(blocks[i], sp_pool_alloc(pool));
+	ck_assert_uint_eq(LEN(blocks), pool->size);
+	ck_assert_uint_eq(5, pool->nslabs);
+	for (i = 0; i < LEN(blocks); i++)
+		ck_assert_int_eq(0, sp_pool_free(pool, blocks[i]));
+	ck_assert_uint_eq(0, pool->size);
+	pool_check(pool);
+	ck_assert_ptr_null(sp_pool_alloc(NULL));
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+START_TEST(alloc_hooks)
+{
+	struct sp_pool *pool;
+	long *a, *b;
+	nctor = ndtor = 0;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(long), 2, ctor_count, dtor_count));
+	ck_assert_ptr_nonnull(a = sp_pool_alloc(pool));
+	ck_assert_ptr_nonnull(b = sp_pool_alloc(pool));
+	ck_assert_uint_eq(2, nctor);
+	ck_assert_int_eq(0, memcmp(a, b, sizeof(long)));
+	ck_assert_int_eq(0, sp_pool_free(pool, a));
+	ck_assert_uint_eq(1, ndtor);
+	*b = 5;
+	ck_assert_ptr_eq(a, sp_pool_alloc(pool));
+	ck_assert_uint_eq(3, nctor);
+	ck_assert_int_ne(5, *a);
+	ck_assert_int_eq(0, sp_pool_free(pool, a));
+	ck_assert_int_eq(0, sp_pool_free(pool, b));
+	ck_assert_uint_eq(3, ndtor);
+
+	/* Failing hooks leave the block where it was */
+	pool->ctor = hook_bad;
+	ck_assert_ptr_null(sp_pool_alloc(pool));
+	ck_assert_uint_eq(0, pool->size);
+	pool_check(pool);
+	pool->ctor = NULL;
+	ck_assert_ptr_nonnull(a = sp_pool_alloc(pool));
+	pool->dtor = hook_bad;
+	ck_assert_int_eq(SP_ECALLBK, sp_pool_free(pool, a));
+	ck_assert_uint_eq(1, pool->size);
+	pool_check(pool);
+	pool->dtor = NULL;
+	ck_assert_int_eq(0, sp_pool_free(pool, a));
+	ck_assert_uint_eq(2, pool->capacity);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+START_TEST(alloc_free_bad)
+{
+	struct sp_pool *pool, *other;
+	long local, *a, *b;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(long), 4, NULL, NULL));
+	ck_assert_ptr_nonnull(other = sp_pool_create(sizeof(long), 4, NULL, NULL));
+	ck_assert_ptr_nonnull(a = sp_pool_alloc(pool));
+	ck_assert_ptr_nonnull(b = sp_pool_alloc(other));
+	ck_assert_int_eq(SP_EINVAL, sp_pool_free(NULL, a));
+	ck_assert_int_eq(SP_EINVAL, sp_pool_free(pool, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pool_free(pool, &local));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pool_free(pool, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pool_free(pool, (char*)a + 1));
+	ck_assert_int_eq(0, sp_pool_free(pool, a));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pool_free(pool, a));
+	pool_check(pool);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+	ck_assert_int_eq(0, sp_pool_destroy(other));
+}
+END_TEST
+
+START_TEST(alloc_reserve)
+{
+	struct sp_pool *pool;
+	void *blocks[50];
+	size_t i;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(24, 4, NULL, NULL));
+	ck_assert_int_eq(0, sp_pool_reserve(pool, 4));
+	ck_assert_uint_eq(1, pool->nslabs);
+	ck_assert_int_eq(0, sp_pool_reserve(pool, LEN(blocks)));
+	ck_assert_uint_eq(2, pool->nslabs);
+	ck_assert_uint_ge(pool->capacity, LEN(blocks));
+	pool_check(pool);
+	for (i = 0; i < LEN(blocks); i++)
+		ck_assert_ptr_nonnull(blocks[i] = sp_pool_alloc(pool));
+	ck_assert_uint_eq(2, pool->nslabs);
+
+	/* Free blocks count towards the room there is */
+	for (i = 0; i < 10; i++)
+		ck_assert_int_eq(0, sp_pool_free(pool, blocks[i]));
+	ck_assert_int_eq(0, sp_pool_reserve(pool, 10));
+	ck_assert_uint_eq(2, pool->nslabs);
+	ck_assert_int_eq(SP_ERANGE, sp_pool_reserve(pool, SIZE_MAX));
+	ck_assert_uint_eq(2, pool->nslabs);
+	pool_check(pool);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+START_TEST(alloc_random)
+{
+	struct sp_pool *pool;
+	unsigned char *blocks[300];
+	size_t i, n = 0, round;
+	const size_t block_size = (size_t)IRANGE(1, 64);
+	memset(blocks, 0, sizeof(blocks));
+	ck_assert_ptr_nonnull(pool = sp_pool_create(block_size, (size_t)IRANGE(1, 16), NULL, NULL));
+	for (round = 0; round < 5000; round++) {
+		i = (size_t)IRANGE(0, (int)LEN(blocks) - 1);
+		if (blocks[i] == NULL) {
+			ck_assert_ptr_nonnull(blocks[i] = sp_pool_alloc(pool));
+			memset(blocks[i], (int)(i & 0xFF), block_size);
+			++n;
+		} else {
+			size_t j;
+			for (j = 0; j < block_size; j++)
+				ck_assert_uint_eq(i & 0xFF, blocks[i][j]);
+			ck_assert_int_eq(0, sp_pool_free(pool, blocks[i]));
+			blocks[i] = NULL;
+			--n;
+		}
+		ck_assert_uint_eq(n, pool->size);
+	}
+	pool_check(pool);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+void init_alloc(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, alloc_ok);
+	tcase_add_test(tc, alloc_hooks);
+	tcase_add_test(tc, alloc_free_bad);
+	tcase_add_test(tc, alloc_reserve);
+	tcase_add_test(tc, alloc_random);
+}
@@ -0,0 +1,62 @@
+START_TEST(create_ok)
+{
+	struct sp_pool *pool;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(struct data), 10, NULL, NULL));
+	ck_assert_ptr_nonnull(pool->slabs);
+	ck_assert_ptr_null(pool->free);
+	ck_assert_uint_eq(sizeof(struct data), pool->block_size);
+	ck_assert_uint_eq(sizeof(struct data), pool->stride);
+	ck_assert_uint_eq(0, pool->size);
+	ck_assert_uint_eq(10, pool->capacity);
+	ck_assert_uint_eq(1, pool->nslabs);
+	ck_assert_uint_eq(10, pool->slabs[0].size);
+	ck_assert_uint_eq(0, pool->used);
+	ck_assert_uint_eq(0, pool->left);
+	ck_assert(pool->ctor == NULL);
+	ck_assert(pool->dtor == NULL);
+	pool_check(pool);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+START_TEST(create_stride)
+{
+	struct sp_pool *pool;
+	size_t size;
+
+	/* Every block can hold the free list link, and the next one is aligned
+	 * for any type of the block size */
+	for (size = 1; size <= 40; size++) {
+		ck_assert_ptr_nonnull(pool = sp_pool_create(size, 3, ctor_count, dtor_count));
+		ck_assert(pool->ctor == ctor_count);
+		ck_assert(pool->dtor == dtor_count);
+		ck_assert_uint_lt(pool->stride, (size > sizeof(void*) ? size : sizeof(void*)) + sizeof(void*));
+		if (size % 16 == 0)
+			ck_assert_uint_eq(0, pool->stride % 16);
+		else if (size % 8 == 0)
+			ck_assert_uint_eq(0, pool->stride % 8);
+		pool_check(pool);
+		ck_assert_int_eq(0, sp_pool_destroy(pool));
+	}
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_pool_create(0, 10, NULL, NULL));
+	ck_assert_ptr_null(sp_pool_create(1, 0, NULL, NULL));
+	ck_assert_ptr_null(sp_pool_create(SIZE_MAX, 1, NULL, NULL));
+	ck_assert_ptr_null(sp_pool_create(1, SIZE_MAX, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pool_destroy(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pool_reset(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pool_reserve(NULL, 1));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_stride);
+	tcase_add_test(tc, create_bad_args);
+}
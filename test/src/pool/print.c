@@ -0,0 +1,19 @@
+START_TEST(print_ok)
+{
+	struct sp_pool *pool;
+	size_t i;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(struct data), 4, NULL, NULL));
+	ck_assert_int_eq(0, sp_pool_print(pool));
+	for (i = 0; i < 10; i++)
+		ck_assert_ptr_nonnull(sp_pool_alloc(pool));
+	ck_assert_int_eq(0, sp_pool_print(pool));
+	ck_assert_int_eq(SP_EINVAL, sp_pool_print(NULL));
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_ok);
+}
@@ -0,0 +1,72 @@
+START_TEST(reset_ok)
+{
+	struct sp_pool *pool;
+	void *blocks[40], *again[LEN(blocks)];
+	size_t i, nslabs, capacity;
+	ndtor = 0;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(struct data), 8, NULL, dtor_count));
+	for (i = 0; i < LEN(blocks); i++)
+		ck_assert_ptr_nonnull(blocks[i] = sp_pool_alloc(pool));
+	for (i = 0; i < LEN(blocks); i += 2)
+		ck_assert_int_eq(0, sp_pool_free(pool, blocks[i]));
+	nslabs = pool->nslabs;
+	capacity = pool->capacity;
+
+	/* Everything is free again, and carved out of the same slabs in the same
+	 * order, without invoking the destructor */
+	ndtor = 0;
+	ck_assert_int_eq(0, sp_pool_reset(pool));
+	ck_assert_uint_eq(0, ndtor);
+	ck_assert_uint_eq(0, pool->size);
+	ck_assert_ptr_null(pool->free);
+	ck_assert_uint_eq(nslabs, pool->nslabs);
+	ck_assert_uint_eq(capacity, pool->capacity);
+	pool_check(pool);
+	for (i = 0; i < LEN(again); i++) {
+		ck_assert_ptr_nonnull(again[i] = sp_pool_alloc(pool));
+		ck_assert_ptr_eq(blocks[i], again[i]);
+	}
+	pool_check(pool);
+
+	/* The whole capacity is available after a reset */
+	ck_assert_int_eq(0, sp_pool_reset(pool));
+	for (i = 0; i < capacity; i++)
+		ck_assert_ptr_nonnull(sp_pool_alloc(pool));
+	ck_assert_uint_eq(nslabs, pool->nslabs);
+	ck_assert_uint_eq(0, pool->left);
+	pool_check(pool);
+	ck_assert_ptr_nonnull(sp_pool_alloc(pool));
+	ck_assert_uint_eq(nslabs + 1, pool->nslabs);
+	pool_check(pool);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+START_TEST(reset_reserve)
+{
+	struct sp_pool *pool;
+	size_t i;
+	ck_assert_ptr_nonnull(pool = sp_pool_create(sizeof(long), 4, NULL, NULL));
+	for (i = 0; i < 10; i++)
+		ck_assert_ptr_nonnull(sp_pool_alloc(pool));
+	ck_assert_int_eq(0, sp_pool_reset(pool));
+
+	/* Slabs appended after a reset come after the ones carving has yet to
+	 * reach again */
+	ck_assert_int_eq(0, sp_pool_reserve(pool, 30));
+	ck_assert_uint_eq(3, pool->nslabs);
+	for (i = 0; i < 30; i++)
+		ck_assert_ptr_nonnull(sp_pool_alloc(pool));
+	ck_assert_uint_eq(3, pool->nslabs);
+	ck_assert_uint_eq(3, pool->used);
+	pool_check(pool);
+	ck_assert_int_eq(0, sp_pool_destroy(pool));
+}
+END_TEST
+
+void init_reset(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, reset_ok);
+	tcase_add_test(tc, reset_reserve);
+}
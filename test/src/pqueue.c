@@ -0,0 +1,77 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_pqueue.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Orderings for the generic functions */
+static int int_cmp(const void *a, const void *b)
+{
+	const int x = *(const int*)a, y = *(const int*)b;
+	return (x > y) - (x < y);
+}
+
+static int int_rcmp(const void *a, const void *b)
+{
+	return int_cmp(b, a);
+}
+
+static int data_age_cmp(const void *a, const void *b)
+{
+	const unsigned x = ((const struct data*)a)->age, y = ((const struct data*)b)->age;
+	return (x > y) - (x < y);
+}
+
+#include "pqueue/create.c"
+#include "pqueue/push.c"
+#include "pqueue/heapify.c"
+#include "pqueue/merge.c"
+#include "pqueue/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create  = tcase_create("create"),
+	      *tc_push    = tcase_create("push"),
+	      *tc_heapify = tcase_create("heapify"),
+	      *tc_merge   = tcase_create("merge"),
+	      *tc_print   = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("pqueue");
+	init_and_add(create);
+	init_and_add(push);
+	init_and_add(heapify);
+	init_and_add(merge);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,62 @@
+START_TEST(create_ok)
+{
+	struct sp_pqueue *pq;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(int), 10, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(pq->data);
+	ck_assert_uint_eq(sizeof(int), pq->elem_size);
+	ck_assert_uint_eq(0, pq->size);
+	ck_assert_uint_eq(10, pq->capacity);
+	ck_assert_uint_eq(SP_PQUEUE_ARITY, pq->arity);
+	ck_assert_int_eq(SP_PQUEUE_MIN, pq->order);
+	ck_assert_ptr_eq(int_cmp, pq->cmp);
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(double), 1, 2, SP_PQUEUE_MAX, NULL));
+	ck_assert_uint_eq(2, pq->arity);
+	ck_assert_int_eq(SP_PQUEUE_MAX, pq->order);
+	ck_assert_ptr_null(pq->cmp);
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_pqueue_create(0, 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_pqueue_create(1, 0, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_pqueue_create(1, 1, 1, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_null(sp_pqueue_create(1, 1, 0, 2, NULL));
+	ck_assert_ptr_null(sp_pqueue_create(1, 1, 0, -1, NULL));
+	ck_assert_ptr_null(sp_pqueue_create(2, SIZE_MAX, 0, SP_PQUEUE_MIN, NULL));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_pqueue *pq;
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(struct data), 1, 0, SP_PQUEUE_MIN, data_age_cmp));
+	for (i = 0; i < 10; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_pqueue_push(pq, &d));
+	}
+	ck_assert_int_eq(0, sp_pqueue_clear(pq, data_dtor));
+	ck_assert_uint_eq(0, pq->size);
+	ck_assert_int_eq(0, sp_pqueue_clear(pq, data_dtor));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_pqueue_push(pq, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_pqueue_clear(pq, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_pqueue_destroy(pq, data_dtor_bad));
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, data_dtor));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_destroy(NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,80 @@
+/* Checks that a queue pops exactly the given elements, in order */
+static void heapify_drain(struct sp_pqueue *pq, int *expected, size_t n)
+{
+	size_t i;
+	qsort(expected, n, sizeof(int), pq->order == SP_PQUEUE_MIN ? int_cmp : int_rcmp);
+	ck_assert_uint_eq(n, pq->size);
+	for (i = 0; i < n; i++)
+		if (pq->cmp != NULL) {
+			ck_assert_int_eq(expected[i], *(int*)sp_pqueue_peek(pq));
+			ck_assert_int_eq(0, sp_pqueue_pop(pq, NULL));
+		} else {
+			ck_assert_int_eq(expected[i], sp_pqueue_popi(pq));
+		}
+}
+
+START_TEST(heapify_ok)
+{
+	/* Every combination of existing and added elements exercises both the
+	 * sift-up and the rebuild strategies */
+	const size_t sizes[] = {0, 1, 3, 40, 400};
+	size_t a, b, i, arity;
+	int arr[800];
+	for (arity = 2; arity <= 5; arity++)
+	for (a = 0; a < LEN(sizes); a++)
+	for (b = 0; b < LEN(sizes); b++) {
+		struct sp_pqueue *g, *t;
+		ck_assert_ptr_nonnull(g = sp_pqueue_create(sizeof(int), 1, arity, SP_PQUEUE_MIN, int_cmp));
+		ck_assert_ptr_nonnull(t = sp_pqueue_create(sizeof(int), 1, arity, SP_PQUEUE_MAX, NULL));
+		for (i = 0; i < sizes[a] + sizes[b]; i++)
+			arr[i] = IRANGE(-100, 100);
+		for (i = 0; i < sizes[a]; i++) {
+			ck_assert_int_eq(0, sp_pqueue_push(g, &arr[i]));
+			ck_assert_int_eq(0, sp_pqueue_pushi(t, arr[i]));
+		}
+		ck_assert_int_eq(0, sp_pqueue_heapify(g, arr + sizes[a], sizes[b]));
+		ck_assert_int_eq(0, sp_pqueue_heapifyi(t, arr + sizes[a], sizes[b]));
+		heapify_drain(t, arr, sizes[a] + sizes[b]);
+		heapify_drain(g, arr, sizes[a] + sizes[b]);
+		ck_assert_int_eq(0, sp_pqueue_destroy(g, NULL));
+		ck_assert_int_eq(0, sp_pqueue_destroy(t, NULL));
+	}
+}
+END_TEST
+
+START_TEST(heapify_too_many)
+{
+	struct sp_pqueue *pq;
+	const int arr[2] = {1, 2};
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_int_eq(SP_ERANGE, sp_pqueue_heapify(pq, arr, SIZE_MAX / sizeof(int) + 1));
+	ck_assert_int_eq(SP_ERANGE, sp_pqueue_heapifyi(pq, arr, SIZE_MAX));
+	ck_assert_uint_eq(0, pq->size);
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+}
+END_TEST
+
+START_TEST(heapify_bad_args)
+{
+	struct sp_pqueue *pq, *nocmp;
+	const int arr[2] = {1, 2};
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(nocmp = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_heapify(NULL, arr, 2));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_heapify(pq, NULL, 2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_heapify(nocmp, arr, 2));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_heapifyi(NULL, arr, 2));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_heapifyi(pq, NULL, 2));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_heapifyd(pq, (const double*)arr, 1));
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(nocmp, NULL));
+}
+END_TEST
+
+void init_heapify(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, heapify_ok);
+	tcase_add_test(tc, heapify_too_many);
+	tcase_add_test(tc, heapify_bad_args);
+}
@@ -0,0 +1,63 @@
+START_TEST(merge_ok)
+{
+	struct sp_pqueue *g1, *g2, *t1, *t2;
+	int arr[300], rest[200];
+	size_t i;
+	ck_assert_ptr_nonnull(g1 = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, int_cmp));
+	ck_assert_ptr_nonnull(g2 = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, int_cmp));
+	ck_assert_ptr_nonnull(t1 = sp_pqueue_create(sizeof(int), 1, 2, SP_PQUEUE_MIN, NULL));
+	ck_assert_ptr_nonnull(t2 = sp_pqueue_create(sizeof(int), 1, 8, SP_PQUEUE_MIN, NULL));
+	for (i = 0; i < LEN(arr); i++) {
+		arr[i] = IRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_pqueue_push(i < 100 ? g1 : g2, &arr[i]));
+		ck_assert_int_eq(0, sp_pqueue_pushi(i < 100 ? t1 : t2, arr[i]));
+	}
+	memcpy(rest, arr + 100, sizeof(rest));
+	ck_assert_int_eq(0, sp_pqueue_merge(g1, g2));
+	ck_assert_int_eq(0, sp_pqueue_mergei(t1, t2));
+
+	/* src is left untouched */
+	ck_assert_uint_eq(200, g2->size);
+	ck_assert_uint_eq(200, t2->size);
+	heapify_drain(g1, arr, LEN(arr));
+	heapify_drain(t1, arr, LEN(arr));
+
+	/* Merging into an empty queue copies src */
+	ck_assert_int_eq(0, sp_pqueue_mergei(t1, t2));
+	heapify_drain(t1, rest, LEN(rest));
+	ck_assert_int_eq(0, sp_pqueue_destroy(g1, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(g2, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(t1, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(t2, NULL));
+}
+END_TEST
+
+START_TEST(merge_bad_args)
+{
+	struct sp_pqueue *a, *b, *c;
+	ck_assert_ptr_nonnull(a = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(b = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, int_cmp));
+	ck_assert_ptr_nonnull(c = sp_pqueue_create(sizeof(double), 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_merge(NULL, a));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_merge(a, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_merge(a, a));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_merge(a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_merge(a, c));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_mergei(NULL, a));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_mergei(a, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_mergei(a, a));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_mergei(a, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_mergei(a, c));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_merged(c, a));
+	ck_assert_int_eq(0, sp_pqueue_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(c, NULL));
+}
+END_TEST
+
+void init_merge(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, merge_ok);
+	tcase_add_test(tc, merge_bad_args);
+}
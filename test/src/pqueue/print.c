@@ -0,0 +1,44 @@
+START_TEST(print_object)
+{
+	struct sp_pqueue *pq;
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(struct data), 1, 0, SP_PQUEUE_MIN, data_age_cmp));
+	for (i = 0; i < 3; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_pqueue_push(pq, &d));
+	}
+	ck_assert_int_eq(0, sp_pqueue_print(pq, NULL));
+	ck_assert_int_eq(0, sp_pqueue_print(pq, data_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_pqueue_print(pq, data_print_bad));
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, data_dtor));
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	struct sp_pqueue *pq;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, NULL));
+	ck_assert_int_eq(0, sp_pqueue_pushi(pq, 3));
+	ck_assert_int_eq(0, sp_pqueue_pushi(pq, 7));
+	ck_assert_int_eq(0, sp_pqueue_printi(pq));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_printd(pq));
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_print(NULL, data_print));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_printi(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
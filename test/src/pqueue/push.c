@@ -0,0 +1,143 @@
+/* Pushes random integers into queues of every arity with both the generic and
+ * the suffixed functions, and checks that they pop in sorted order */
+static void push_check(size_t arity, int order, size_t n)
+{
+	struct sp_pqueue *g, *t;
+	int *sorted;
+	size_t i;
+	ck_assert_ptr_nonnull(sorted = malloc(n * sizeof(int)));
+	ck_assert_ptr_nonnull(g = sp_pqueue_create(sizeof(int), 1, arity, order, int_cmp));
+	ck_assert_ptr_nonnull(t = sp_pqueue_create(sizeof(int), 1, arity, order, NULL));
+	for (i = 0; i < n; i++) {
+		sorted[i] = IRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_pqueue_push(g, &sorted[i]));
+		ck_assert_int_eq(0, sp_pqueue_pushi(t, sorted[i]));
+	}
+	ck_assert_uint_eq(n, g->size);
+	ck_assert_uint_eq(n, t->size);
+	qsort(sorted, n, sizeof(int), order == SP_PQUEUE_MIN ? int_cmp : int_rcmp);
+	for (i = 0; i < n; i++) {
+		ck_assert_int_eq(sorted[i], *(int*)sp_pqueue_peek(g));
+		ck_assert_int_eq(0, sp_pqueue_pop(g, NULL));
+		ck_assert_int_eq(sorted[i], sp_pqueue_peeki(t));
+		ck_assert_int_eq(sorted[i], sp_pqueue_popi(t));
+	}
+	ck_assert_uint_eq(0, g->size);
+	ck_assert_uint_eq(0, t->size);
+	ck_assert_int_eq(0, sp_pqueue_destroy(g, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(t, NULL));
+	free(sorted);
+}
+
+START_TEST(push_pop_sorted)
+{
+	size_t arity;
+	for (arity = 2; arity <= 9; arity++) {
+		push_check(arity, SP_PQUEUE_MIN, 1);
+		push_check(arity, SP_PQUEUE_MIN, 500);
+		push_check(arity, SP_PQUEUE_MAX, 2);
+		push_check(arity, SP_PQUEUE_MAX, 500);
+	}
+}
+END_TEST
+
+START_TEST(push_pop_interleaved)
+{
+	struct sp_pqueue *pq;
+	double last = -1;
+	size_t i;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(double), 4, 0, SP_PQUEUE_MIN, NULL));
+	/* Popped values never decrease as long as pushed values are larger than
+	 * the last popped one */
+	for (i = 0; i < 2000; i++) {
+		if (pq->size > 0 && rand() % 3 == 0) {
+			const double x = sp_pqueue_popd(pq);
+			ck_assert(x >= last);
+			last = x;
+		} else {
+			ck_assert_int_eq(0, sp_pqueue_pushd(pq, last + FRANGE(0, 100)));
+		}
+	}
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+}
+END_TEST
+
+START_TEST(push_pop_object)
+{
+	struct sp_pqueue *pq;
+	struct data d;
+	unsigned last = 0;
+	size_t i;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(struct data), 1, 3, SP_PQUEUE_MIN, data_age_cmp));
+	for (i = 0; i < 100; i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_pqueue_push(pq, &d));
+	}
+	while (pq->size > 0) {
+		const struct data *top = sp_pqueue_peek(pq);
+		ck_assert_uint_ge(top->age, last);
+		last = top->age;
+		ck_assert_int_eq(0, sp_pqueue_pop(pq, data_dtor));
+	}
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+}
+END_TEST
+
+START_TEST(push_too_many)
+{
+	struct sp_pqueue *pq;
+	size_t i;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MAX, NULL));
+	for (i = 0; i < SIZE_MAX / sizeof(int); i++)
+		ck_assert_int_eq(0, sp_pqueue_pushi(pq, i));
+	ck_assert_int_eq(SP_ERANGE, sp_pqueue_pushi(pq, 0));
+	ck_assert_int_eq(SIZE_MAX / sizeof(int) - 1, sp_pqueue_popi(pq));
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+}
+END_TEST
+
+START_TEST(push_bad_args)
+{
+	struct sp_pqueue *pq, *nocmp;
+	const int x = 1;
+	ck_assert_ptr_nonnull(pq = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, int_cmp));
+	ck_assert_ptr_nonnull(nocmp = sp_pqueue_create(sizeof(int), 1, 0, SP_PQUEUE_MIN, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_push(NULL, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_push(pq, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_push(nocmp, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_pushi(NULL, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_pushd(pq, 1));
+	ck_assert_int_eq(0, sp_pqueue_pushi(nocmp, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_pop(nocmp, NULL));
+
+	/* Empty queue */
+	ck_assert_ptr_null(sp_pqueue_peek(pq));
+	ck_assert_int_eq(0, sp_pqueue_peeki(pq));
+	ck_assert_int_eq(SP_EILLEGAL, sp_pqueue_pop(pq, NULL));
+	ck_assert_int_eq(0, sp_pqueue_popi(pq));
+	ck_assert_ptr_null(sp_pqueue_peek(NULL));
+	ck_assert_int_eq(0, sp_pqueue_peeki(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_pqueue_pop(NULL, NULL));
+	ck_assert_int_eq(0, sp_pqueue_popi(NULL));
+	ck_assert_int_eq(0, sp_pqueue_pushi(pq, 5));
+	ck_assert(sp_pqueue_peekd(pq) == 0);
+	ck_assert(sp_pqueue_popd(pq) == 0);
+	ck_assert_uint_eq(1, pq->size);
+
+	/* Failing destructor leaves the queue intact */
+	ck_assert_int_eq(SP_ECALLBK, sp_pqueue_pop(pq, data_dtor_bad));
+	ck_assert_uint_eq(1, pq->size);
+	ck_assert_int_eq(0, sp_pqueue_destroy(pq, NULL));
+	ck_assert_int_eq(0, sp_pqueue_destroy(nocmp, NULL));
+}
+END_TEST
+
+void init_push(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, push_pop_sorted);
+	tcase_add_test(tc, push_pop_interleaved);
+	tcase_add_test(tc, push_pop_object);
+	tcase_add_test(tc, push_too_many);
+	tcase_add_test(tc, push_bad_args);
+}
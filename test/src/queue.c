@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <time.h>
 #include "../../src/sp_queue.h"
+#include "../../src/sp_intern.h"
 #include "test_struct.h"
 #include <check.h>
 
@@ -20,9 +21,15 @@
 #include "queue/destroy.c"
 #include "queue/eq.c"
 #include "queue/push.c"
+#include "queue/pushfront.c"
+#include "queue/rpush.c"
 #include "queue/peek.c"
+#include "queue/peekback.c"
 #include "queue/pop.c"
+#include "queue/popback.c"
 #include "queue/clear.c"
+#include "queue/last.c"
+#include "queue/rotate.c"
 #include "queue/get.c"
 #include "queue/set.c"
 #include "queue/insert.c"
@@ -38,22 +45,28 @@ int main(void)
 	SRunner *runner;
 	Suite *suite;
 	int nf, seed;
-	TCase *tc_create  = tcase_create("create"),
-	      *tc_destroy = tcase_create("destroy"),
-	      *tc_eq      = tcase_create("eq"),
-	      *tc_push    = tcase_create("push"),
-	      *tc_peek    = tcase_create("peek"),
-	      *tc_pop     = tcase_create("pop"),
-	      *tc_clear   = tcase_create("clear"),
-	      *tc_get     = tcase_create("get"),
-	      *tc_set     = tcase_create("set"),
-	      *tc_insert  = tcase_create("insert"),
-	      *tc_remove  = tcase_create("remove"),
-	      *tc_qinsert = tcase_create("qinsert"),
-	      *tc_qremove = tcase_create("qremove"),
-	      *tc_copy    = tcase_create("copy"),
-	      *tc_map     = tcase_create("map"),
-	      *tc_print   = tcase_create("print");
+	TCase *tc_create    = tcase_create("create"),
+	      *tc_destroy   = tcase_create("destroy"),
+	      *tc_eq        = tcase_create("eq"),
+	      *tc_push      = tcase_create("push"),
+	      *tc_pushfront = tcase_create("pushfront"),
+	      *tc_rpush     = tcase_create("rpush"),
+	      *tc_peek      = tcase_create("peek"),
+	      *tc_peekback  = tcase_create("peekback"),
+	      *tc_pop       = tcase_create("pop"),
+	      *tc_popback   = tcase_create("popback"),
+	      *tc_clear     = tcase_create("clear"),
+	      *tc_last      = tcase_create("last"),
+	      *tc_rotate    = tcase_create("rotate"),
+	      *tc_get       = tcase_create("get"),
+	      *tc_set       = tcase_create("set"),
+	      *tc_insert    = tcase_create("insert"),
+	      *tc_remove    = tcase_create("remove"),
+	      *tc_qinsert   = tcase_create("qinsert"),
+	      *tc_qremove   = tcase_create("qremove"),
+	      *tc_copy      = tcase_create("copy"),
+	      *tc_map       = tcase_create("map"),
+	      *tc_print     = tcase_create("print");
 
 	if (!sp_is_debug() || sp_is_abort()) {
 		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
@@ -69,9 +82,15 @@ int main(void)
 	init_and_add(destroy);
 	init_and_add(eq);
 	init_and_add(push);
+	init_and_add(pushfront);
+	init_and_add(rpush);
 	init_and_add(peek);
+	init_and_add(peekback);
 	init_and_add(pop);
+	init_and_add(popback);
 	init_and_add(clear);
+	init_and_add(last);
+	init_and_add(rotate);
 	init_and_add(get);
 	init_and_add(set);
 	init_and_add(insert);
@@ -122,6 +122,34 @@ START_TEST(insert_substring)
 }
 END_TEST
 
+START_TEST(insert_wrapped)
+{
+	int ref[64];
+	size_t i, j, n;
+	setup(int, 64);
+	/* Move the head towards the end of the buffer, so that inserting at
+	 * various indices shifts elements across the wrap-around point. */
+	for (i = 0; i < 50; i++) {
+		ck_assert_int_eq(0, sp_queue_pushi(s, 0));
+		ck_assert_int_eq(0, sp_queue_popi(s));
+	}
+	n = 0;
+	for (i = 0; i < LEN(ref); i++) {
+		const size_t idx = IRANGE(0, n);
+		for (j = n; j > idx; j--)
+			ref[j] = ref[j - 1];
+		ref[idx] = i;
+		++n;
+		ck_assert_int_eq(0, sp_queue_inserti(s, idx, i));
+		ck_assert_uint_eq(n, s->size);
+		for (j = 0; j < n; j++)
+			ck_assert_int_eq(ref[j], sp_queue_geti(s, j));
+	}
+	ck_assert_uint_eq(64, s->capacity);
+	teardown(NULL);
+}
+END_TEST
+
 START_TEST(insert_bad_args)
 {
 	struct data a;
@@ -251,6 +279,7 @@ void init_insert(Suite *suite, TCase *tc)
 	tcase_add_test(tc, insert_object);
 	tcase_add_test(tc, insert_string);
 	tcase_add_test(tc, insert_substring);
+	tcase_add_test(tc, insert_wrapped);
 	tcase_add_test(tc, insert_bad_args);
 	tcase_add_test(tc, insert_bad_index);
 	tcase_add_test(tc, insert_buffer_max_limit);
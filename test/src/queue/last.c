@@ -0,0 +1,95 @@
+#define setup(T, X) \
+	struct sp_queue *s; \
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_queue_destroy(s, D));
+
+START_TEST(last_basic)
+{
+	int out[5];
+	setup(int, 5);
+	ck_assert_int_eq(0, sp_queue_last(s, 0, out));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 1));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 2));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 3));
+	ck_assert_int_eq(0, sp_queue_last(s, 1, out));
+	ck_assert_int_eq(3, out[0]);
+	ck_assert_int_eq(0, sp_queue_last(s, 3, out));
+	ck_assert_int_eq(1, out[0]);
+	ck_assert_int_eq(2, out[1]);
+	ck_assert_int_eq(3, out[2]);
+	ck_assert_uint_eq(3, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(last_wrapped)
+{
+	int out[5], i;
+	setup(int, 5);
+	for (i = 0; i < 13; i++)
+		ck_assert_int_eq(0, sp_queue_rpushi(s, i));
+	ck_assert_int_eq(0, sp_queue_last(s, 5, out));
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(8 + i, out[i]);
+	ck_assert_int_eq(0, sp_queue_last(s, 4, out));
+	for (i = 0; i < 4; i++)
+		ck_assert_int_eq(9 + i, out[i]);
+	ck_assert_int_eq(0, sp_queue_last(s, 2, out));
+	ck_assert_int_eq(11, out[0]);
+	ck_assert_int_eq(12, out[1]);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(last_object)
+{
+	struct data a, b, out[2];
+	setup(struct data, 2);
+	data_init(&a);
+	data_init(&b);
+	ck_assert_int_eq(0, sp_queue_push(s, &a));
+	ck_assert_int_eq(0, sp_queue_push(s, &b));
+	ck_assert_int_eq(0, sp_queue_last(s, 2, out));
+	ck_assert_int_eq(0, data_cmp(&a, &out[0]));
+	ck_assert_int_eq(0, data_cmp(&b, &out[1]));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(last_bad_args)
+{
+	int out[1];
+	setup(int, 5);
+	ck_assert_int_eq(SP_EINVAL, sp_queue_last(NULL, 0, out));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_last(s, 0, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_last(NULL, 0, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(last_bad_index)
+{
+	int out[3];
+	setup(int, 5);
+	ck_assert_int_eq(SP_EINDEX, sp_queue_last(s, 1, out));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 1));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 2));
+	ck_assert_int_eq(SP_EINDEX, sp_queue_last(s, 3, out));
+	teardown(NULL);
+}
+END_TEST
+
+void init_last(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, last_basic);
+	tcase_add_test(tc, last_wrapped);
+	tcase_add_test(tc, last_object);
+	tcase_add_test(tc, last_bad_args);
+	tcase_add_test(tc, last_bad_index);
+}
+
+#undef setup
+#undef teardown
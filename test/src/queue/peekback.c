@@ -0,0 +1,76 @@
+#define setup(T, X) \
+	struct sp_queue *s; \
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_queue_destroy(s, D));
+
+START_TEST(peekback_basic)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_queue_pushi(s, 1));
+	ck_assert_int_eq(1, sp_queue_peekbacki(s));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 2));
+	ck_assert_int_eq(2, sp_queue_peekbacki(s));
+	ck_assert_int_eq(0, sp_queue_pushfronti(s, 3));
+	ck_assert_int_eq(2, sp_queue_peekbacki(s));
+	ck_assert_int_eq(2, *(int*)sp_queue_peekback(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(peekback_string)
+{
+	setup(char*, 10);
+	ck_assert_int_eq(0, sp_queue_pushstr(s, "first"));
+	ck_assert_str_eq("first", sp_queue_peekbackstr(s));
+	ck_assert_int_eq(0, sp_queue_pushstr(s, "second"));
+	ck_assert_str_eq("second", sp_queue_peekbackstr(s));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(peekback_empty)
+{
+	struct sp_queue *s;
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(int), 10));
+	ck_assert_int_eq(0, sp_queue_peekbacki(s));
+	ck_assert_ptr_null(sp_queue_peekback(s));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(char*), 10));
+	ck_assert_ptr_null(sp_queue_peekbackstr(s));
+	ck_assert_int_eq(0, sp_queue_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(peekback_bad_args)
+{
+	ck_assert_int_eq(0, sp_queue_peekbacki(NULL));
+	ck_assert_ptr_null(sp_queue_peekback(NULL));
+	ck_assert_ptr_null(sp_queue_peekbackstr(NULL));
+}
+END_TEST
+
+START_TEST(peekback_bad_elem_size)
+{
+	struct sp_queue *s;
+	ck_assert_ptr_nonnull(s = sp_queue_create(1, 10));
+	ck_assert_int_eq(0, sp_queue_peekbacki(s));
+	ck_assert_ptr_null(sp_queue_peekbackstr(s));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+}
+END_TEST
+
+void init_peekback(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, peekback_basic);
+	tcase_add_test(tc, peekback_string);
+	tcase_add_test(tc, peekback_empty);
+	tcase_add_test(tc, peekback_bad_args);
+	tcase_add_test(tc, peekback_bad_elem_size);
+}
+
+#undef setup
+#undef teardown
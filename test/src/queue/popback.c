@@ -0,0 +1,124 @@
+#define setup(T, X) \
+	struct sp_queue *s; \
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_queue_destroy(s, D));
+
+START_TEST(popback_basic)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_queue_pushi(s, 1));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 2));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 3));
+	ck_assert_int_eq(3, sp_queue_popbacki(s));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(1, sp_queue_popi(s));
+	ck_assert_int_eq(2, sp_queue_popbacki(s));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_int_eq(0, sp_queue_pushi(s, 4));
+	ck_assert_int_eq(4, sp_queue_peeki(s));
+	ck_assert_int_eq(4, sp_queue_popbacki(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(popback_object)
+{
+	struct data a, b;
+	setup(struct data, 10);
+	data_init(&a);
+	data_init(&b);
+	ck_assert_int_eq(0, sp_queue_push(s, &a));
+	ck_assert_int_eq(0, sp_queue_push(s, &b));
+	ck_assert_int_eq(0, sp_queue_popback(s, data_dtor));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_queue_peekback(s)));
+	ck_assert_int_eq(0, sp_queue_popback(s, data_dtor));
+	ck_assert_uint_eq(0, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(popback_string)
+{
+	char *str;
+	setup(char*, 10);
+	ck_assert_int_eq(0, sp_queue_pushstr(s, "first"));
+	ck_assert_int_eq(0, sp_queue_pushstr(s, "second"));
+	ck_assert_ptr_nonnull(str = sp_queue_popbackstr(s));
+	ck_assert_str_eq("second", str);
+	free(str);
+	ck_assert_ptr_nonnull(str = sp_queue_popbackstr(s));
+	ck_assert_str_eq("first", str);
+	free(str);
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(popback_wrapped)
+{
+	int i;
+	setup(int, 8);
+	for (i = 0; i < 6; i++) {
+		ck_assert_int_eq(0, sp_queue_pushi(s, 0));
+		ck_assert_int_eq(0, sp_queue_popi(s));
+	}
+	for (i = 0; i < 8; i++)
+		ck_assert_int_eq(0, sp_queue_pushi(s, i));
+	ck_assert_uint_eq(8, s->capacity);
+	for (i = 7; i >= 0; i--)
+		ck_assert_int_eq(i, sp_queue_popbacki(s));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(popback_empty)
+{
+	struct sp_queue *s;
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(int), 20));
+	ck_assert_int_eq(0, sp_queue_popbacki(s));
+	ck_assert_int_eq(SP_EILLEGAL, sp_queue_popback(s, NULL));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(char*), 20));
+	ck_assert_ptr_null(sp_queue_popbackstr(s));
+	ck_assert_int_eq(0, sp_queue_destroy(s, sp_free));
+}
+END_TEST
+
+START_TEST(popback_bad_args)
+{
+	ck_assert_int_eq(0, sp_queue_popbacki(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_popback(NULL, NULL));
+	ck_assert_ptr_null(sp_queue_popbackstr(NULL));
+}
+END_TEST
+
+START_TEST(popback_bad_dtor)
+{
+	struct data a;
+	setup(struct data, 10);
+	data_init(&a);
+	ck_assert_int_eq(0, sp_queue_push(s, &a));
+	ck_assert_int_eq(SP_ECALLBK, sp_queue_popback(s, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_popback(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, popback_basic);
+	tcase_add_test(tc, popback_object);
+	tcase_add_test(tc, popback_string);
+	tcase_add_test(tc, popback_wrapped);
+	tcase_add_test(tc, popback_empty);
+	tcase_add_test(tc, popback_bad_args);
+	tcase_add_test(tc, popback_bad_dtor);
+}
+
+#undef setup
+#undef teardown
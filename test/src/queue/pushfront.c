@@ -0,0 +1,130 @@
+#define setup(T, X) \
+	struct sp_queue *s; \
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_queue_destroy(s, D));
+
+START_TEST(pushfront_basic)
+{
+	setup(int, 2);
+	ck_assert_int_eq(0, sp_queue_pushfronti(s, 1));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(1, sp_queue_peeki(s));
+	ck_assert_int_eq(1, sp_queue_peekbacki(s));
+
+	ck_assert_int_eq(0, sp_queue_pushfronti(s, 2));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 3));
+	ck_assert_int_eq(0, sp_queue_pushfronti(s, 4));
+	ck_assert_uint_eq(4, s->size);
+	ck_assert_int_eq(4, sp_queue_geti(s, 0));
+	ck_assert_int_eq(2, sp_queue_geti(s, 1));
+	ck_assert_int_eq(1, sp_queue_geti(s, 2));
+	ck_assert_int_eq(3, sp_queue_geti(s, 3));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pushfront_object)
+{
+	struct data a, b;
+	setup(struct data, 10);
+	data_init(&a);
+	data_init(&b);
+	ck_assert_int_eq(0, sp_queue_pushfront(s, &a));
+	ck_assert_int_eq(0, sp_queue_pushfront(s, &b));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(0, data_cmp(&b, sp_queue_get(s, 0)));
+	ck_assert_int_eq(0, data_cmp(&a, sp_queue_get(s, 1)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(pushfront_string)
+{
+	setup(char*, 2);
+	ck_assert_int_eq(0, sp_queue_pushfrontstr(s, "first"));
+	ck_assert_int_eq(0, sp_queue_pushfrontstrn(s, "second", 3));
+	ck_assert_int_eq(0, sp_queue_pushfrontstr(s, "third"));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_str_eq("third", sp_queue_getstr(s, 0));
+	ck_assert_str_eq("sec", sp_queue_getstr(s, 1));
+	ck_assert_str_eq("first", sp_queue_getstr(s, 2));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(pushfront_wrapped)
+{
+	int i;
+	setup(int, 8);
+	/* Mix both ends, so that the ring wraps around and gets enlarged */
+	for (i = 0; i < 50; i++) {
+		ck_assert_int_eq(0, sp_queue_pushfronti(s, -i));
+		ck_assert_int_eq(0, sp_queue_pushi(s, i));
+	}
+	ck_assert_uint_eq(100, s->size);
+	for (i = 0; i < 50; i++) {
+		ck_assert_int_eq(-49 + i, sp_queue_geti(s, i));
+		ck_assert_int_eq(i, sp_queue_geti(s, 50 + i));
+	}
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pushfront_bad_args)
+{
+	struct data a;
+	struct sp_queue *s;
+	ck_assert_int_eq(SP_EINVAL, sp_queue_pushfronti(NULL, 1));
+
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(struct data), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_pushfront(NULL, &a));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_pushfront(s, NULL));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+	data_dtor(&a);
+
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(char*), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_pushfrontstr(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_pushfrontstrn(s, NULL, 0));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(pushfront_bad_elem_size)
+{
+	struct sp_queue *s;
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(int) + 1, 10));
+	ck_assert_int_eq(SP_EILLEGAL, sp_queue_pushfronti(s, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_queue_pushfrontstr(s, "abc"));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(pushfront_buffer_max_limit)
+{
+	struct sp_queue *s;
+	size_t i;
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(int), 10));
+	for (i = 0; i < SIZE_MAX / s->elem_size; i++)
+		ck_assert_int_eq(0, sp_queue_pushfronti(s, i));
+	ck_assert_int_eq(SP_ERANGE, sp_queue_pushfronti(s, 0));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+}
+END_TEST
+
+void init_pushfront(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pushfront_basic);
+	tcase_add_test(tc, pushfront_object);
+	tcase_add_test(tc, pushfront_string);
+	tcase_add_test(tc, pushfront_wrapped);
+	tcase_add_test(tc, pushfront_bad_args);
+	tcase_add_test(tc, pushfront_bad_elem_size);
+	tcase_add_test(tc, pushfront_buffer_max_limit);
+}
+
+#undef setup
+#undef teardown
@@ -109,6 +109,37 @@ START_TEST(remove_string)
 }
 END_TEST
 
+START_TEST(remove_wrapped)
+{
+	int ref[64];
+	size_t i, j, n;
+	setup(int, 64);
+	/* Move the head towards the end of the buffer, so that removing at
+	 * various indices shifts elements across the wrap-around point. */
+	for (i = 0; i < 50; i++) {
+		ck_assert_int_eq(0, sp_queue_pushi(s, 0));
+		ck_assert_int_eq(0, sp_queue_popi(s));
+	}
+	for (i = 0; i < LEN(ref); i++) {
+		ref[i] = i;
+		ck_assert_int_eq(0, sp_queue_pushi(s, i));
+	}
+	ck_assert_uint_eq(64, s->capacity);
+	n = LEN(ref);
+	while (n != 0) {
+		const size_t idx = IRANGE(0, n - 1);
+		ck_assert_int_eq(ref[idx], sp_queue_removei(s, idx));
+		for (j = idx; j < n - 1; j++)
+			ref[j] = ref[j + 1];
+		--n;
+		ck_assert_uint_eq(n, s->size);
+		for (j = 0; j < n; j++)
+			ck_assert_int_eq(ref[j], sp_queue_geti(s, j));
+	}
+	teardown(NULL);
+}
+END_TEST
+
 START_TEST(remove_bad_args)
 {
 	ck_assert_int_eq(0, sp_queue_removei(NULL, 0));
@@ -184,6 +215,7 @@ void init_remove(Suite *suite, TCase *tc)
 	tcase_add_test(tc, remove_basic);
 	tcase_add_test(tc, remove_object);
 	tcase_add_test(tc, remove_string);
+	tcase_add_test(tc, remove_wrapped);
 	tcase_add_test(tc, remove_bad_args);
 	tcase_add_test(tc, remove_bad_elem_size);
 	tcase_add_test(tc, remove_bad_index);
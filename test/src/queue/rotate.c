@@ -0,0 +1,139 @@
+#define setup(T, X) \
+	struct sp_queue *s; \
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_queue_destroy(s, D));
+
+START_TEST(rotate_basic)
+{
+	int i;
+	setup(int, 10);
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(0, sp_queue_pushi(s, i));
+	ck_assert_int_eq(0, sp_queue_rotate(s, 2));
+	ck_assert_uint_eq(5, s->size);
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq((i + 2) % 5, sp_queue_geti(s, i));
+	ck_assert_int_eq(0, sp_queue_rotate(s, 4));
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq((i + 1) % 5, sp_queue_geti(s, i));
+	ck_assert_int_eq(0, sp_queue_rotate(s, 9));
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(i, sp_queue_geti(s, i));
+	ck_assert_int_eq(0, sp_queue_rotate(s, 0));
+	ck_assert_int_eq(0, sp_queue_peeki(s));
+	ck_assert_int_eq(4, sp_queue_peekbacki(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rotate_full)
+{
+	int i;
+	void *data;
+	setup(int, 6);
+	for (i = 0; i < 6; i++)
+		ck_assert_int_eq(0, sp_queue_pushi(s, i));
+	data = s->data;
+	ck_assert_int_eq(0, sp_queue_rotate(s, 4));
+	ck_assert_ptr_eq(data, s->data);
+	for (i = 0; i < 6; i++)
+		ck_assert_int_eq((i + 4) % 6, sp_queue_geti(s, i));
+	ck_assert_int_eq(0, sp_queue_pushi(s, 6));
+	ck_assert_int_eq(6, sp_queue_peekbacki(s));
+	ck_assert_int_eq(4, sp_queue_peeki(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rotate_random)
+{
+	int ref[40], tmp[40];
+	size_t i, j, n, size;
+	setup(int, 64);
+	for (i = 0; i < 20; i++) {
+		ck_assert_int_eq(0, sp_queue_pushi(s, 0));
+		ck_assert_int_eq(0, sp_queue_popi(s));
+	}
+	size = LEN(ref);
+	for (i = 0; i < size; i++) {
+		ref[i] = i;
+		ck_assert_int_eq(0, sp_queue_pushi(s, i));
+	}
+	for (i = 0; i < 100; i++) {
+		n = IRANGE(0, 2 * size);
+		for (j = 0; j < size; j++)
+			tmp[j] = ref[(j + n) % size];
+		for (j = 0; j < size; j++)
+			ref[j] = tmp[j];
+		ck_assert_int_eq(0, sp_queue_rotate(s, n));
+		for (j = 0; j < size; j++)
+			ck_assert_int_eq(ref[j], sp_queue_geti(s, j));
+		ck_assert_int_eq(ref[size - 1], sp_queue_peekbacki(s));
+	}
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rotate_wrap)
+{
+	char ref[97], tmp[97];
+	size_t i, j, k, n, size, offset;
+	setup(char, 97);
+	for (k = 0; k < 200; k++) {
+		ck_assert_int_eq(0, sp_queue_clear(s, NULL));
+		offset = IRANGE(0, LEN(ref) - 1);
+		for (i = 0; i < offset; i++) {
+			ck_assert_int_eq(0, sp_queue_pushc(s, 0));
+			ck_assert_int_eq(0, sp_queue_popc(s));
+		}
+		size = IRANGE(1, LEN(ref) - 1);
+		for (i = 0; i < size; i++) {
+			ref[i] = (char)i;
+			ck_assert_int_eq(0, sp_queue_pushc(s, (char)i));
+		}
+		n = IRANGE(0, size);
+		for (j = 0; j < size; j++)
+			tmp[j] = ref[(j + n) % size];
+		ck_assert_int_eq(0, sp_queue_rotate(s, n));
+		ck_assert_uint_eq(size, s->size);
+		for (j = 0; j < size; j++)
+			ck_assert_int_eq(tmp[j], sp_queue_getc(s, j));
+		ck_assert_int_eq(tmp[0], sp_queue_peekc(s));
+		ck_assert_int_eq(tmp[size - 1], sp_queue_peekbackc(s));
+	}
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rotate_empty)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_queue_rotate(s, 0));
+	ck_assert_int_eq(0, sp_queue_rotate(s, 3));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rotate_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rotate(NULL, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rotate(NULL, 1));
+}
+END_TEST
+
+void init_rotate(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, rotate_basic);
+	tcase_add_test(tc, rotate_full);
+	tcase_add_test(tc, rotate_random);
+	tcase_add_test(tc, rotate_wrap);
+	tcase_add_test(tc, rotate_empty);
+	tcase_add_test(tc, rotate_bad_args);
+}
+
+#undef setup
+#undef teardown
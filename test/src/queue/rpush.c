@@ -0,0 +1,258 @@
+#define setup(T, X) \
+	struct sp_queue *s; \
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_queue_destroy(s, D));
+
+START_TEST(rpush_basic)
+{
+	int i;
+	setup(int, 3);
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 1));
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 2));
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 3));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_int_eq(1, sp_queue_peeki(s));
+
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 4));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_uint_eq(3, s->capacity);
+	ck_assert_int_eq(2, sp_queue_peeki(s));
+	ck_assert_int_eq(3, sp_queue_geti(s, 1));
+	ck_assert_int_eq(4, sp_queue_geti(s, 2));
+
+	for (i = 5; i < 100; i++)
+		ck_assert_int_eq(0, sp_queue_rpushi(s, i));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_uint_eq(3, s->capacity);
+	ck_assert_int_eq(97, sp_queue_geti(s, 0));
+	ck_assert_int_eq(98, sp_queue_geti(s, 1));
+	ck_assert_int_eq(99, sp_queue_geti(s, 2));
+
+	ck_assert_int_eq(97, sp_queue_popi(s));
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 100));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_int_eq(98, sp_queue_peeki(s));
+	ck_assert_int_eq(100, sp_queue_geti(s, 2));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rpush_capacity_one)
+{
+	setup(int, 1);
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 1));
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 2));
+	ck_assert_int_eq(0, sp_queue_rpushi(s, 3));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_uint_eq(1, s->capacity);
+	ck_assert_int_eq(3, sp_queue_peeki(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rpush_object)
+{
+	struct data a, b, c;
+	setup(struct data, 2);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_int_eq(0, sp_queue_rpush(s, &a, data_dtor));
+	ck_assert_int_eq(0, sp_queue_rpush(s, &b, data_dtor));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_queue_peek(s)));
+
+	/* `a` gets destroyed here */
+	ck_assert_int_eq(0, sp_queue_rpush(s, &c, data_dtor));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_uint_eq(2, s->capacity);
+	ck_assert_int_eq(0, data_cmp(&b, sp_queue_peek(s)));
+	ck_assert_int_eq(0, data_cmp(&c, sp_queue_get(s, 1)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(rpush_string)
+{
+	setup(char*, 2);
+	ck_assert_int_eq(0, sp_queue_rpushstr(s, "first"));
+	ck_assert_int_eq(0, sp_queue_rpushstr(s, "second"));
+	ck_assert_int_eq(0, sp_queue_rpushstr(s, "third"));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_str_eq("second", sp_queue_peekstr(s));
+	ck_assert_str_eq("third", sp_queue_getstr(s, 1));
+
+	ck_assert_int_eq(0, sp_queue_rpushstrn(s, "fourth", 4));
+	ck_assert_int_eq(0, sp_queue_rpushstrn(s, "fifth", 0));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_uint_eq(2, s->capacity);
+	ck_assert_str_eq("four", sp_queue_peekstr(s));
+	ck_assert_str_eq("", sp_queue_getstr(s, 1));
+	teardown(sp_free);
+}
+END_TEST
+
+START_TEST(rpush_bulk)
+{
+	int arr[20];
+	size_t i;
+	setup(int, 8);
+	for (i = 0; i < LEN(arr); i++)
+		arr[i] = i;
+
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr, 0, NULL));
+	ck_assert_uint_eq(0, s->size);
+
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr, 5, NULL));
+	ck_assert_uint_eq(5, s->size);
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(i, sp_queue_geti(s, i));
+
+	/* Partially overwrites and wraps around the end of the buffer */
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr + 10, 6, NULL));
+	ck_assert_uint_eq(8, s->size);
+	ck_assert_uint_eq(8, s->capacity);
+	ck_assert_int_eq(3, sp_queue_geti(s, 0));
+	ck_assert_int_eq(4, sp_queue_geti(s, 1));
+	for (i = 2; i < 8; i++)
+		ck_assert_int_eq(8 + i, sp_queue_geti(s, i));
+
+	/* More elements than capacity, only the newest ones are kept */
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr, LEN(arr), NULL));
+	ck_assert_uint_eq(8, s->size);
+	ck_assert_uint_eq(8, s->capacity);
+	for (i = 0; i < 8; i++)
+		ck_assert_int_eq(12 + i, sp_queue_geti(s, i));
+
+	/* Bulk push is equivalent to a series of single pushes */
+	for (i = 0; i < 3; i++)
+		ck_assert_int_eq(12 + i, sp_queue_popi(s));
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr, 4, NULL));
+	ck_assert_uint_eq(8, s->size);
+	ck_assert_int_eq(16, sp_queue_geti(s, 0));
+	ck_assert_int_eq(17, sp_queue_geti(s, 1));
+	ck_assert_int_eq(18, sp_queue_geti(s, 2));
+	ck_assert_int_eq(19, sp_queue_geti(s, 3));
+	for (i = 4; i < 8; i++)
+		ck_assert_int_eq(i - 4, sp_queue_geti(s, i));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(rpush_bulk_object)
+{
+	struct data arr[5];
+	size_t i;
+	setup(struct data, 3);
+	for (i = 0; i < LEN(arr); i++)
+		data_init(&arr[i]);
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr, 2, data_dtor));
+	/* arr[0] and arr[1] get destroyed here */
+	ck_assert_int_eq(0, sp_queue_rpushn(s, arr + 2, 3, data_dtor));
+	ck_assert_uint_eq(3, s->size);
+	for (i = 0; i < 3; i++)
+		ck_assert_int_eq(0, data_cmp(&arr[2 + i], sp_queue_get(s, i)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(rpush_bad_args)
+{
+	int arr[3];
+	struct data a;
+	struct sp_queue *s;
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(int), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushi(NULL, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushn(NULL, arr, LEN(arr), NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushn(s, NULL, LEN(arr), NULL));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+
+	data_init(&a);
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(struct data), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpush(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpush(s, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpush(NULL, &a, NULL));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+	data_dtor(&a);
+
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(char*), 10));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushstr(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushstr(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushstr(NULL, "abc"));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushstrn(NULL, NULL, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushstrn(s, NULL, 0));
+	ck_assert_int_eq(SP_EINVAL, sp_queue_rpushstrn(NULL, "abc", 0));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(rpush_bad_elem_size)
+{
+	struct sp_queue *s;
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(int) + 1, 10));
+	ck_assert_int_eq(SP_EILLEGAL, sp_queue_rpushi(s, 1));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_queue_create(sizeof(char*) + 1, 10));
+	ck_assert_int_eq(SP_EILLEGAL, sp_queue_rpushstr(s, "abc"));
+	ck_assert_int_eq(SP_EILLEGAL, sp_queue_rpushstrn(s, "abc", 3));
+	ck_assert_int_eq(0, sp_queue_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(rpush_bad_dtor)
+{
+	struct data a, b, c;
+	setup(struct data, 2);
+	data_init(&a);
+	data_init(&b);
+	data_init(&c);
+	ck_assert_int_eq(0, sp_queue_rpush(s, &a, data_dtor_bad));
+	ck_assert_int_eq(0, sp_queue_rpush(s, &b, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_queue_rpush(s, &c, data_dtor_bad));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_queue_peek(s)));
+	ck_assert_int_eq(SP_ECALLBK, sp_queue_rpushn(s, &c, 1, data_dtor_bad));
+	ck_assert_uint_eq(2, s->size);
+	ck_assert_int_eq(0, data_cmp(&a, sp_queue_peek(s)));
+	teardown(data_dtor);
+	data_dtor(&c);
+}
+END_TEST
+
+START_TEST(rpush_string_too_long)
+{
+	size_t i;
+	char *str;
+	setup(char*, 10);
+	/* SIZE_MAX + 1 is safe, because we redefined SIZE_MAX to be small */
+	ck_assert_ptr_nonnull(str = malloc(sizeof(char) * (SIZE_MAX + 1)));
+	for (i = 0; i < SIZE_MAX + 1; i++)
+		str[i] = ' ';
+	str[SIZE_MAX] = '\0';
+	ck_assert_int_eq(SP_ERANGE, sp_queue_rpushstr(s, str));
+	ck_assert_int_eq(SP_ERANGE, sp_queue_rpushstrn(s, str, SIZE_MAX));
+	free(str);
+	teardown(sp_free);
+}
+END_TEST
+
+void init_rpush(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, rpush_basic);
+	tcase_add_test(tc, rpush_capacity_one);
+	tcase_add_test(tc, rpush_object);
+	tcase_add_test(tc, rpush_string);
+	tcase_add_test(tc, rpush_bulk);
+	tcase_add_test(tc, rpush_bulk_object);
+	tcase_add_test(tc, rpush_bad_args);
+	tcase_add_test(tc, rpush_bad_elem_size);
+	tcase_add_test(tc, rpush_bad_dtor);
+	tcase_add_test(tc, rpush_string_too_long);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_rbtree.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* A user structure which embeds a tree node */
+struct item {
+	int key;
+	struct sp_rbnode node;
+	unsigned seq;
+};
+
+#define ITEM(NODE) SP_RBTREE_ENTRY(NODE, struct item, node)
+#define KEY(NODE)  (ITEM(NODE)->key)
+
+static int item_cmp(const struct sp_rbnode *a, const struct sp_rbnode *b)
+{
+	const int x = KEY(a), y = KEY(b);
+	return (x > y) - (x < y);
+}
+
+static int key_cmp(const void *key, const struct sp_rbnode *node)
+{
+	const int x = *(const int*)key, y = KEY(node);
+	return (x > y) - (x < y);
+}
+
+/* Checks the red-black properties, links and order of a subtree, and returns
+ * its black height */
+static int rb_check_node(const struct sp_rbnode *node, const struct sp_rbnode *parent, size_t *count)
+{
+	int lh, rh;
+	if (node == NULL)
+		return 1;
+	++*count;
+	ck_assert_ptr_eq(parent, node->parent);
+	if (node->color == SP_RBTREE_RED) {
+		ck_assert(node->left == NULL || node->left->color == SP_RBTREE_BLACK);
+		ck_assert(node->right == NULL || node->right->color == SP_RBTREE_BLACK);
+	} else {
+		ck_assert_int_eq(SP_RBTREE_BLACK, node->color);
+	}
+	if (node->left != NULL)
+		ck_assert_int_le(KEY(node->left), KEY(node));
+	if (node->right != NULL)
+		ck_assert_int_ge(KEY(node->right), KEY(node));
+	lh = rb_check_node(node->left, node, count);
+	rh = rb_check_node(node->right, node, count);
+	ck_assert_int_eq(lh, rh);
+	return lh + (node->color == SP_RBTREE_BLACK);
+}
+
+static void rb_check(const struct sp_rbtree *tree)
+{
+	const struct sp_rbnode *node;
+	size_t count = 0;
+	ck_assert(tree->root == NULL || tree->root->color == SP_RBTREE_BLACK);
+	rb_check_node(tree->root, NULL, &count);
+	ck_assert_uint_eq(count, tree->size);
+	for (node = sp_rbtree_first(tree); node != NULL && sp_rbtree_next(node) != NULL; node = sp_rbtree_next(node))
+		ck_assert_int_le(KEY(node), KEY(sp_rbtree_next(node)));
+}
+
+#include "rbtree/create.c"
+#include "rbtree/insert.c"
+#include "rbtree/bounds.c"
+#include "rbtree/remove.c"
+#include "rbtree/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_insert = tcase_create("insert"),
+	      *tc_bounds = tcase_create("bounds"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("rbtree");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(bounds);
+	init_and_add(remove);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
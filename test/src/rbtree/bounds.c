@@ -0,0 +1,72 @@
+START_TEST(bounds_ok)
+{
+	static struct item items[400];
+	struct sp_rbtree *tree;
+	const struct sp_rbnode *node;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	for (i = 0; i < (int)LEN(items); i++) {
+		items[i].key = 2 * IRANGE(0, 100);
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[i].node));
+	}
+	for (i = -1; i <= 201; i++) {
+		const struct sp_rbnode *lb = sp_rbtree_lowerbound(tree, &i, key_cmp),
+		                       *ub = sp_rbtree_upperbound(tree, &i, key_cmp),
+		                       *eq = sp_rbtree_find(tree, &i, key_cmp);
+
+		/* Compare against a linear scan */
+		for (node = sp_rbtree_first(tree); node != NULL && KEY(node) < i; node = sp_rbtree_next(node));
+		ck_assert_ptr_eq(node, lb);
+		ck_assert_ptr_eq(node != NULL && KEY(node) == i ? node : NULL, eq);
+		for (; node != NULL && KEY(node) <= i; node = sp_rbtree_next(node));
+		ck_assert_ptr_eq(node, ub);
+	}
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+START_TEST(bounds_iterate)
+{
+	static struct item items[300];
+	struct sp_rbtree *tree;
+	const struct sp_rbnode *node;
+	size_t i;
+	int lo = 100, hi = 200;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	ck_assert_ptr_null(sp_rbtree_first(tree));
+	ck_assert_ptr_null(sp_rbtree_last(tree));
+	ck_assert_ptr_null(sp_rbtree_lowerbound(tree, &lo, key_cmp));
+	for (i = 0; i < LEN(items); i++) {
+		items[i].key = (i * 7) % LEN(items);
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[i].node));
+	}
+	for (i = 0, node = sp_rbtree_first(tree); node != NULL; node = sp_rbtree_next(node), i++)
+		ck_assert_int_eq(i, KEY(node));
+	ck_assert_uint_eq(LEN(items), i);
+	for (node = sp_rbtree_last(tree); node != NULL; node = sp_rbtree_prev(node))
+		ck_assert_int_eq(--i, KEY(node));
+
+	/* Range iteration over [lo, hi) */
+	for (i = lo, node = sp_rbtree_lowerbound(tree, &lo, key_cmp);
+			node != sp_rbtree_lowerbound(tree, &hi, key_cmp); node = sp_rbtree_next(node), i++)
+		ck_assert_int_eq(i, KEY(node));
+	ck_assert_uint_eq(hi, i);
+
+	ck_assert_ptr_null(sp_rbtree_find(NULL, &lo, key_cmp));
+	ck_assert_ptr_null(sp_rbtree_find(tree, &lo, NULL));
+	ck_assert_ptr_null(sp_rbtree_lowerbound(tree, &lo, NULL));
+	ck_assert_ptr_null(sp_rbtree_upperbound(NULL, &lo, key_cmp));
+	ck_assert_ptr_null(sp_rbtree_first(NULL));
+	ck_assert_ptr_null(sp_rbtree_last(NULL));
+	ck_assert_ptr_null(sp_rbtree_next(NULL));
+	ck_assert_ptr_null(sp_rbtree_prev(NULL));
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+void init_bounds(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, bounds_ok);
+	tcase_add_test(tc, bounds_iterate);
+}
@@ -0,0 +1,86 @@
+static unsigned freed;
+
+static int item_free(struct sp_rbnode *node)
+{
+	free(ITEM(node));
+	++freed;
+	return 0;
+}
+
+static int item_free_bad(struct sp_rbnode *node)
+{
+	free(ITEM(node));
+	++freed;
+	return 1;
+}
+
+START_TEST(create_ok)
+{
+	struct sp_rbtree *tree;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	ck_assert_ptr_null(tree->root);
+	ck_assert_uint_eq(0, tree->size);
+	ck_assert_ptr_eq(item_cmp, tree->cmp);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(NULL));
+	ck_assert_ptr_null(tree->cmp);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, item_free));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_rbtree *tree;
+	int i;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	for (i = 0; i < 100; i++) {
+		struct item *it = malloc(sizeof(*it));
+		ck_assert_ptr_nonnull(it);
+		it->key = IRANGE(0, 20);
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &it->node));
+	}
+
+	/* Every node is passed to the destructor exactly once, even if it fails */
+	freed = 0;
+	ck_assert_int_eq(SP_ECALLBK, sp_rbtree_clear(tree, item_free_bad));
+	ck_assert_uint_eq(100, freed);
+	ck_assert_ptr_null(tree->root);
+	ck_assert_uint_eq(0, tree->size);
+
+	for (i = 0; i < 100; i++) {
+		struct item *it = malloc(sizeof(*it));
+		ck_assert_ptr_nonnull(it);
+		it->key = i;
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &it->node));
+	}
+	freed = 0;
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, item_free));
+	ck_assert_uint_eq(100, freed);
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_destroy(NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_destroy_bad_dtor)
+{
+	struct sp_rbtree *tree;
+	struct item *it = malloc(sizeof(*it));
+	ck_assert_ptr_nonnull(it);
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	it->key = 1;
+	ck_assert_int_eq(0, sp_rbtree_insert(tree, &it->node));
+
+	/* A failed destructor leaves an empty tree behind */
+	ck_assert_int_eq(SP_ECALLBK, sp_rbtree_destroy(tree, item_free_bad));
+	ck_assert_uint_eq(0, tree->size);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, item_free_bad));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_clear_destroy);
+	tcase_add_test(tc, create_destroy_bad_dtor);
+}
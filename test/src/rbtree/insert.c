@@ -0,0 +1,105 @@
+START_TEST(insert_random)
+{
+	static struct item items[1000];
+	struct sp_rbtree *tree;
+	size_t i;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	for (i = 0; i < LEN(items); i++) {
+		items[i].key = IRANGE(0, 200);
+		items[i].seq = i;
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[i].node));
+		if (i % 100 == 0)
+			rb_check(tree);
+	}
+	rb_check(tree);
+	ck_assert_uint_eq(LEN(items), tree->size);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+START_TEST(insert_stable)
+{
+	static struct item items[300];
+	struct sp_rbtree *tree;
+	const struct sp_rbnode *node;
+	size_t i;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	for (i = 0; i < LEN(items); i++) {
+		items[i].key = i % 3;
+		items[i].seq = i;
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[i].node));
+	}
+	rb_check(tree);
+
+	/* Equal keys stay in insertion order */
+	for (node = sp_rbtree_first(tree); sp_rbtree_next(node) != NULL; node = sp_rbtree_next(node))
+		if (KEY(node) == KEY(sp_rbtree_next(node)))
+			ck_assert_uint_lt(ITEM(node)->seq, ITEM(sp_rbtree_next(node))->seq);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+START_TEST(insert_hint)
+{
+	static struct item items[500];
+	struct sp_rbtree *tree;
+	const struct sp_rbnode *node;
+	size_t i;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+
+	/* Appending */
+	for (i = 0; i < 200; i++) {
+		items[i].key = 2 * i;
+		ck_assert_int_eq(0, sp_rbtree_inserthint(tree, NULL, &items[i].node));
+	}
+	rb_check(tree);
+
+	/* Right before the correct hint */
+	for (i = 200; i < 400; i++) {
+		items[i].key = 2 * (i - 200) + 1;
+		ck_assert_int_eq(0, sp_rbtree_inserthint(tree, i < 399 ? &items[i - 199].node : NULL, &items[i].node));
+	}
+	rb_check(tree);
+	for (i = 0, node = sp_rbtree_first(tree); node != NULL; node = sp_rbtree_next(node), i++)
+		ck_assert_int_eq(i, KEY(node));
+
+	/* Wrong hints fall back to a regular insertion */
+	for (i = 400; i < LEN(items); i++) {
+		items[i].key = IRANGE(-10, 410);
+		ck_assert_int_eq(0, sp_rbtree_inserthint(tree, &items[IRANGE(0, 399)].node, &items[i].node));
+	}
+	for (i = 400; i < 450; i++) {
+		ck_assert_int_eq(0, sp_rbtree_remove(tree, &items[i + 50].node));
+		items[i + 50].key = IRANGE(-10, 410);
+		ck_assert_int_eq(0, sp_rbtree_inserthint(tree, NULL, &items[i + 50].node));
+	}
+	rb_check(tree);
+	ck_assert_uint_eq(LEN(items), tree->size);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_rbtree *tree;
+	struct item it;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_insert(NULL, &it.node));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_insert(tree, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_rbtree_insert(tree, &it.node));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_inserthint(NULL, NULL, &it.node));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_inserthint(tree, NULL, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_rbtree_inserthint(tree, NULL, &it.node));
+	ck_assert_uint_eq(0, tree->size);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_random);
+	tcase_add_test(tc, insert_stable);
+	tcase_add_test(tc, insert_hint);
+	tcase_add_test(tc, insert_bad_args);
+}
@@ -0,0 +1,42 @@
+static int item_print(const struct sp_rbnode *node)
+{
+	printf("%d\n", KEY(node));
+	return 0;
+}
+
+static int item_print_bad(const struct sp_rbnode *node)
+{
+	return 1;
+}
+
+START_TEST(print_ok)
+{
+	static struct item items[3];
+	struct sp_rbtree *tree;
+	size_t i;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	ck_assert_int_eq(0, sp_rbtree_print(tree, item_print_bad));
+	for (i = 0; i < LEN(items); i++) {
+		items[i].key = i;
+		ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[i].node));
+	}
+	ck_assert_int_eq(0, sp_rbtree_print(tree, NULL));
+	ck_assert_int_eq(0, sp_rbtree_print(tree, item_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_rbtree_print(tree, item_print_bad));
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_print(NULL, item_print));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
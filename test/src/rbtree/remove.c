@@ -0,0 +1,72 @@
+START_TEST(remove_random)
+{
+	static struct item items[500];
+	static char linked[500];
+	struct sp_rbtree *tree;
+	size_t i, count = 0;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	memset(linked, 0, sizeof(linked));
+	for (i = 0; i < 5000; i++) {
+		const size_t j = IRANGE(0, (int)LEN(items) - 1);
+		if (linked[j]) {
+			ck_assert_int_eq(0, sp_rbtree_remove(tree, &items[j].node));
+			count--;
+		} else {
+			items[j].key = IRANGE(0, 100);
+			ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[j].node));
+			count++;
+		}
+		linked[j] = !linked[j];
+		ck_assert_uint_eq(count, tree->size);
+		if (i % 250 == 0)
+			rb_check(tree);
+	}
+	rb_check(tree);
+
+	/* Remove every other node while iterating */
+	for (i = 0; i < LEN(items); i++) {
+		if (!linked[i]) {
+			items[i].key = i % 101;
+			ck_assert_int_eq(0, sp_rbtree_insert(tree, &items[i].node));
+		}
+	}
+	{
+		struct sp_rbnode *node = sp_rbtree_first(tree);
+		int odd = 0;
+		while (node != NULL) {
+			struct sp_rbnode *const next = sp_rbtree_next(node);
+			if ((odd = !odd))
+				ck_assert_int_eq(0, sp_rbtree_remove(tree, node));
+			node = next;
+		}
+	}
+	rb_check(tree);
+	ck_assert_uint_eq(LEN(items) / 2, tree->size);
+	while (tree->root != NULL)
+		ck_assert_int_eq(0, sp_rbtree_remove(tree, tree->root));
+	ck_assert_uint_eq(0, tree->size);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	struct sp_rbtree *tree;
+	struct item it;
+	ck_assert_ptr_nonnull(tree = sp_rbtree_create(item_cmp));
+	ck_assert_int_eq(SP_EILLEGAL, sp_rbtree_remove(tree, &it.node));
+	it.key = 0;
+	ck_assert_int_eq(0, sp_rbtree_insert(tree, &it.node));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_remove(NULL, &it.node));
+	ck_assert_int_eq(SP_EINVAL, sp_rbtree_remove(tree, NULL));
+	ck_assert_uint_eq(1, tree->size);
+	ck_assert_int_eq(0, sp_rbtree_destroy(tree, NULL));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_random);
+	tcase_add_test(tc, remove_bad_args);
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_segtree.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks every element, and the sum, minimum and maximum of every range,
+ * against a plain array */
+static void segtree_check(struct sp_segtree *tree, const long *vals)
+{
+	size_t i, j;
+	for (i = 0; i < tree->cap; i++)
+		ck_assert_uint_le(tree->lazy[i], 2);
+	for (i = 0; i < tree->size; i++)
+		ck_assert_int_eq(vals[i], sp_segtree_getl(tree, i));
+	for (i = 0; i < tree->size; i++) {
+		long sum = 0, min = vals[i], max = vals[i];
+		ck_assert_int_eq(0, sp_segtree_suml(tree, i, 0));
+		for (j = i; j < tree->size; j++) {
+			sum += vals[j];
+			if (vals[j] < min)
+				min = vals[j];
+			if (vals[j] > max)
+				max = vals[j];
+			ck_assert_int_eq(sum, sp_segtree_suml(tree, i, j - i + 1));
+			ck_assert_int_eq(min, sp_segtree_minl(tree, i, j - i + 1));
+			ck_assert_int_eq(max, sp_segtree_maxl(tree, i, j - i + 1));
+		}
+	}
+}
+
+#include "segtree/create.c"
+#include "segtree/update.c"
+#include "segtree/query.c"
+#include "segtree/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_update = tcase_create("update"),
+	      *tc_query  = tcase_create("query"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("segtree");
+	init_and_add(create);
+	init_and_add(update);
+	init_and_add(query);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,58 @@
+START_TEST(create_ok)
+{
+	struct sp_segtree *tree;
+	long vals[10] = {0};
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), LEN(vals)));
+	ck_assert_ptr_nonnull(tree->data);
+	ck_assert_ptr_nonnull(tree->lazy);
+	ck_assert_uint_eq(sizeof(long), tree->elem_size);
+	ck_assert_uint_eq(LEN(vals), tree->size);
+	ck_assert_uint_eq(16, tree->cap);
+	ck_assert_uint_eq(4, tree->height);
+	segtree_check(tree, vals);
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), 1));
+	ck_assert_uint_eq(1, tree->cap);
+	ck_assert_uint_eq(0, tree->height);
+	ck_assert_int_eq(0, sp_segtree_setl(tree, 0, -7));
+	ck_assert_int_eq(0, sp_segtree_addl(tree, 0, 1, 2));
+	ck_assert_int_eq(-5, sp_segtree_minl(tree, 0, 1));
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_segtree_create(0, 10));
+	ck_assert_ptr_null(sp_segtree_create(1, 0));
+	ck_assert_ptr_null(sp_segtree_create(SIZE_MAX, 2));
+	ck_assert_ptr_null(sp_segtree_create(1, SIZE_MAX));
+	/* The nodes take 10 times the memory of the elements */
+	ck_assert_ptr_null(sp_segtree_create(sizeof(long), SIZE_MAX / 10 / sizeof(long) + 1));
+	ck_assert_int_eq(SP_EINVAL, sp_segtree_clear(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_segtree_destroy(NULL));
+}
+END_TEST
+
+START_TEST(create_clear)
+{
+	struct sp_segtree *tree;
+	long vals[37];
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), LEN(vals)));
+	ck_assert_int_eq(0, sp_segtree_filll(tree, 0, LEN(vals), 5));
+	ck_assert_int_eq(0, sp_segtree_addl(tree, 3, 20, 2));
+	ck_assert_int_eq(0, sp_segtree_clear(tree));
+	memset(vals, 0, sizeof(vals));
+	segtree_check(tree, vals);
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear);
+}
@@ -0,0 +1,19 @@
+START_TEST(print_suffixed)
+{
+	struct sp_segtree *tree;
+	const int vals[] = {3, 1, 4, 1, 5};
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(int), LEN(vals)));
+	ck_assert_int_eq(0, sp_segtree_buildi(tree, vals));
+	ck_assert_int_eq(0, sp_segtree_addi(tree, 1, 3, 10));
+	ck_assert_int_eq(0, sp_segtree_printi(tree));
+	ck_assert_int_eq(SP_EILLEGAL, sp_segtree_printd(tree));
+	ck_assert_int_eq(SP_EINVAL, sp_segtree_printi(NULL));
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_suffixed);
+}
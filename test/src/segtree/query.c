@@ -0,0 +1,62 @@
+START_TEST(query_window)
+{
+	struct sp_segtree *tree;
+	unsigned long buckets[60] = {0}, sum, max;
+	size_t t, i;
+	/* A rolling counter: each tick resets the oldest bucket, and the sum
+	 * and peak of the last 10 buckets are read back */
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(unsigned long), LEN(buckets)));
+	for (t = 0; t < 500; t++) {
+		const size_t cur = t % LEN(buckets);
+		const size_t first = (t + LEN(buckets) - 9) % LEN(buckets);
+		const unsigned long events = rand() % 20;
+		ck_assert_int_eq(0, sp_segtree_fillul(tree, cur, 1, 0));
+		ck_assert_int_eq(0, sp_segtree_addul(tree, cur, 1, events));
+		buckets[cur] = events;
+		sum = max = 0;
+		for (i = 0; i < 10; i++) {
+			const unsigned long b = buckets[(first + i) % LEN(buckets)];
+			sum += b;
+			if (b > max)
+				max = b;
+		}
+		if (first <= cur) {
+			ck_assert_uint_eq(sum, sp_segtree_sumul(tree, first, 10));
+			ck_assert_uint_eq(max, sp_segtree_maxul(tree, first, 10));
+		} else {
+			const size_t n = LEN(buckets) - first;
+			ck_assert_uint_eq(sum, sp_segtree_sumul(tree, first, n)
+					+ sp_segtree_sumul(tree, 0, 10 - n));
+		}
+	}
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+START_TEST(query_bad_args)
+{
+	struct sp_segtree *tree;
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), 8));
+	ck_assert_int_eq(0, sp_segtree_filll(tree, 0, 8, 3));
+	ck_assert_int_eq(24, sp_segtree_suml(tree, 0, 8));
+	ck_assert_int_eq(0, sp_segtree_suml(tree, 8, 0));
+	ck_assert_int_eq(0, sp_segtree_suml(tree, 7, 2));
+	ck_assert_int_eq(0, sp_segtree_suml(NULL, 0, 1));
+	ck_assert_int_eq(0, sp_segtree_sumi(tree, 0, 1));
+	ck_assert_int_eq(3, sp_segtree_minl(tree, 7, 1));
+	ck_assert_int_eq(0, sp_segtree_minl(tree, 7, 0));
+	ck_assert_int_eq(0, sp_segtree_minl(tree, 8, 1));
+	ck_assert_int_eq(0, sp_segtree_maxl(tree, 0, 9));
+	ck_assert_int_eq(0, sp_segtree_maxf(tree, 0, 1));
+	ck_assert_int_eq(0, sp_segtree_getl(tree, 8));
+	ck_assert_int_eq(0, sp_segtree_getl(NULL, 0));
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+void init_query(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, query_window);
+	tcase_add_test(tc, query_bad_args);
+}
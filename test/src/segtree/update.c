@@ -0,0 +1,100 @@
+START_TEST(update_build)
+{
+	struct sp_segtree *tree;
+	long vals[40];
+	size_t n, i;
+	for (n = 1; n <= LEN(vals); n++) {
+		ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), n));
+		for (i = 0; i < n; i++)
+			vals[i] = rand() % 201 - 100;
+		ck_assert_int_eq(0, sp_segtree_buildl(tree, vals));
+		segtree_check(tree, vals);
+		ck_assert_int_eq(0, sp_segtree_destroy(tree));
+	}
+}
+END_TEST
+
+START_TEST(update_random)
+{
+	struct sp_segtree *tree;
+	long vals[45];
+	size_t n, i, j;
+	for (n = 1; n <= LEN(vals); n += 11) {
+		ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), n));
+		memset(vals, 0, sizeof(vals));
+		for (i = 0; i < 300; i++) {
+			const size_t idx = rand() % n, len = rand() % (n - idx + 1);
+			const long val = rand() % 201 - 100;
+			switch (rand() % 4) {
+			case 0:
+				vals[idx] = val;
+				ck_assert_int_eq(0, sp_segtree_setl(tree, idx, val));
+				break;
+			case 1:
+				for (j = idx; j < idx + len; j++)
+					vals[j] = val;
+				ck_assert_int_eq(0, sp_segtree_filll(tree, idx, len, val));
+				break;
+			default:
+				for (j = idx; j < idx + len; j++)
+					vals[j] += val;
+				ck_assert_int_eq(0, sp_segtree_addl(tree, idx, len, val));
+				break;
+			}
+			/* Checking only now and then lets updates pile up */
+			if (i % 50 == 49)
+				segtree_check(tree, vals);
+		}
+		ck_assert_int_eq(0, sp_segtree_destroy(tree));
+	}
+}
+END_TEST
+
+START_TEST(update_floating)
+{
+	struct sp_segtree *tree;
+	const double vals[] = {0.5, 1.25, -2, 4, 0.125, 8};
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(double), LEN(vals)));
+	ck_assert_int_eq(0, sp_segtree_buildd(tree, vals));
+	ck_assert_double_eq(11.875, sp_segtree_sumd(tree, 0, LEN(vals)));
+	ck_assert_double_eq(-2, sp_segtree_mind(tree, 0, LEN(vals)));
+	ck_assert_int_eq(0, sp_segtree_filld(tree, 1, 3, 0.25));
+	ck_assert_int_eq(0, sp_segtree_addd(tree, 0, 2, -1));
+	ck_assert_double_eq(-0.75, sp_segtree_mind(tree, 0, LEN(vals)));
+	ck_assert_double_eq(8, sp_segtree_maxd(tree, 0, LEN(vals)));
+	ck_assert_double_eq(-0.5, sp_segtree_getd(tree, 0));
+	ck_assert_double_eq(7.375, sp_segtree_sumd(tree, 0, LEN(vals)));
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+START_TEST(update_bad_args)
+{
+	struct sp_segtree *tree;
+	long vals[5] = {0};
+	ck_assert_ptr_nonnull(tree = sp_segtree_create(sizeof(long), LEN(vals)));
+	ck_assert_int_eq(SP_EINVAL, sp_segtree_addl(NULL, 0, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_segtree_addl(tree, 4, 2, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_segtree_addl(tree, 6, 0, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_segtree_addi(tree, 0, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_segtree_filll(tree, 0, 6, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_segtree_fillc(tree, 0, 1, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_segtree_setl(tree, 5, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_segtree_setf(tree, 0, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_segtree_buildl(tree, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_segtree_buildi(tree, (const int*)vals));
+	ck_assert_int_eq(0, sp_segtree_addl(tree, 5, 0, 1));
+	ck_assert_int_eq(0, sp_segtree_filll(tree, 0, 0, 1));
+	segtree_check(tree, vals);
+	ck_assert_int_eq(0, sp_segtree_destroy(tree));
+}
+END_TEST
+
+void init_update(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, update_build);
+	tcase_add_test(tc, update_random);
+	tcase_add_test(tc, update_floating);
+	tcase_add_test(tc, update_bad_args);
+}
@@ -0,0 +1,90 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_slotmap.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks that elements and slots point at each other, and that the free list
+ * holds exactly the free slots which are not retired */
+static void slotmap_check(const struct sp_slotmap *sm)
+{
+	size_t i, idx, live = 0, nfree = 0;
+	ck_assert_uint_le(sm->size, sm->count);
+	ck_assert_uint_le(sm->count, sm->capacity);
+	for (i = 0; i < sm->size; i++) {
+		ck_assert_uint_lt(sm->owner[i], sm->count);
+		ck_assert_uint_eq(i, sm->slots[sm->owner[i]].pos);
+		ck_assert_uint_eq(1, sm->slots[sm->owner[i]].gen & 1);
+	}
+	for (i = 0; i < sm->count; i++) {
+		ck_assert_uint_le(sm->slots[i].gen, SP_SLOTMAP_MAX);
+		if (sm->slots[i].gen & 1)
+			live++;
+		else if (sm->slots[i].gen != 0)
+			nfree++;
+	}
+	ck_assert_uint_eq(sm->size, live);
+	ck_assert_uint_eq(sm->nfree, nfree);
+	for (i = 0, idx = sm->head; i < sm->nfree; i++) {
+		ck_assert_uint_lt(idx, sm->count);
+		ck_assert_uint_eq(0, sm->slots[idx].gen & 1);
+		ck_assert_uint_ne(0, sm->slots[idx].gen);
+		if (i + 1 == sm->nfree)
+			ck_assert_uint_eq(sm->tail, idx);
+		idx = sm->slots[idx].pos;
+	}
+}
+
+#include "slotmap/create.c"
+#include "slotmap/insert.c"
+#include "slotmap/remove.c"
+#include "slotmap/iter.c"
+#include "slotmap/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create = tcase_create("create"),
+	      *tc_insert = tcase_create("insert"),
+	      *tc_remove = tcase_create("remove"),
+	      *tc_iter   = tcase_create("iter"),
+	      *tc_print  = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("slotmap");
+	init_and_add(create);
+	init_and_add(insert);
+	init_and_add(remove);
+	init_and_add(iter);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
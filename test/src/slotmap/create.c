@@ -0,0 +1,73 @@
+START_TEST(create_ok)
+{
+	struct sp_slotmap *sm;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(struct data), 10));
+	ck_assert_ptr_nonnull(sm->data);
+	ck_assert_ptr_nonnull(sm->owner);
+	ck_assert_ptr_nonnull(sm->slots);
+	ck_assert_uint_eq(sizeof(struct data), sm->elem_size);
+	ck_assert_uint_eq(0, sm->size);
+	ck_assert_uint_eq(0, sm->count);
+	ck_assert_uint_eq(10, sm->capacity);
+	ck_assert_uint_eq(0, sm->nfree);
+	slotmap_check(sm);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_slotmap_create(0, 10));
+	ck_assert_ptr_null(sp_slotmap_create(1, 0));
+	ck_assert_ptr_null(sp_slotmap_create(SIZE_MAX, 2));
+	ck_assert_ptr_null(sp_slotmap_create(2, SIZE_MAX));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h[100];
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(struct data), 1));
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_slotmap_insert(sm, &d, &h[i]));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_slotmap_clear(sm, data_dtor_bad));
+	ck_assert_uint_eq(LEN(h), sm->size);
+	for (i = 0; i < LEN(h); i++)
+		ck_assert_int_eq(1, sp_slotmap_contains(sm, h[i]));
+	ck_assert_int_eq(0, sp_slotmap_clear(sm, data_dtor));
+	slotmap_check(sm);
+	ck_assert_uint_eq(0, sm->size);
+	ck_assert_uint_eq(LEN(h), sm->nfree);
+
+	/* Clearing makes every handle stale */
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(0, sp_slotmap_contains(sm, h[i]));
+		ck_assert_ptr_null(sp_slotmap_get(sm, h[i]));
+	}
+	ck_assert_int_eq(0, sp_slotmap_clear(sm, data_dtor));
+
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_slotmap_insert(sm, &d, NULL));
+	}
+	ck_assert_uint_eq(LEN(h), sm->count);
+	slotmap_check(sm);
+	ck_assert_int_eq(SP_ECALLBK, sp_slotmap_destroy(sm, data_dtor_bad));
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, data_dtor));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_destroy(NULL, NULL));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,119 @@
+START_TEST(insert_ok)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h[1000];
+	double vals[LEN(h)];
+	size_t i, j;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(double), 1));
+	for (i = 0; i < LEN(h); i++) {
+		vals[i] = FRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_slotmap_insert(sm, &vals[i], &h[i]));
+		ck_assert_uint_eq(i, h[i].idx);
+		ck_assert_uint_eq(1, h[i].gen);
+		ck_assert_uint_eq(i + 1, sm->size);
+	}
+	slotmap_check(sm);
+	ck_assert_uint_ge(sm->capacity, LEN(h));
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(1, sp_slotmap_contains(sm, h[i]));
+		ck_assert_ptr_nonnull(sp_slotmap_get(sm, h[i]));
+		ck_assert_double_eq(vals[i], *(double*)sp_slotmap_get(sm, h[i]));
+		ck_assert_double_eq(vals[i], sp_slotmap_getd(sm, h[i]));
+		ck_assert_double_eq(vals[i], ((double*)sm->data)[i]);
+	}
+
+	/* Values can be modified through the returned address */
+	for (i = 0; i < LEN(h); i++)
+		*(double*)sp_slotmap_get(sm, h[i]) = -vals[i];
+	for (i = 0; i < LEN(h); i++)
+		ck_assert_double_eq(-vals[i], sp_slotmap_getd(sm, h[i]));
+
+	/* Handles which were never given out are not live */
+	for (i = 0; i < 5; i++) {
+		struct sp_slotmap_handle bad;
+		j = IRANGE(0, (int)LEN(h) - 1);
+		bad = h[j];
+		bad.gen = 0;
+		ck_assert_int_eq(0, sp_slotmap_contains(sm, bad));
+		bad.gen = 2;
+		ck_assert_int_eq(0, sp_slotmap_contains(sm, bad));
+		bad.gen = 3;
+		ck_assert_int_eq(0, sp_slotmap_contains(sm, bad));
+		bad.gen = 1;
+		bad.idx = LEN(h) + i;
+		ck_assert_int_eq(0, sp_slotmap_contains(sm, bad));
+		ck_assert_ptr_null(sp_slotmap_get(sm, bad));
+		ck_assert_double_eq(0, sp_slotmap_getd(sm, bad));
+	}
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(insert_types)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h[100];
+	int i;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(int), 4));
+	for (i = 0; i < (int)LEN(h); i++)
+		ck_assert_int_eq(0, sp_slotmap_inserti(sm, i * i, &h[i]));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, -1, NULL));
+	slotmap_check(sm);
+	ck_assert_uint_eq(LEN(h) + 1, sm->size);
+	for (i = 0; i < (int)LEN(h); i++)
+		ck_assert_int_eq(i * i, sp_slotmap_geti(sm, h[i]));
+	ck_assert_int_eq(-1, sp_slotmap_geti(sm, sp_slotmap_at(sm, LEN(h))));
+
+	ck_assert_int_eq(SP_EILLEGAL, sp_slotmap_insertc(sm, 'a', NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_slotmap_insertd(sm, 1.0, NULL));
+	ck_assert_double_eq(0, sp_slotmap_getd(sm, h[0]));
+	ck_assert_uint_eq(LEN(h) + 1, sm->size);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h;
+	int i = 0;
+	h.idx = 0;
+	h.gen = 1;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(int), 4));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_insert(NULL, &i, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_insert(sm, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_inserti(NULL, i, NULL));
+	ck_assert_uint_eq(0, sm->size);
+	ck_assert_int_eq(0, sp_slotmap_contains(NULL, h));
+	ck_assert_ptr_null(sp_slotmap_get(NULL, h));
+	ck_assert_int_eq(0, sp_slotmap_geti(NULL, h));
+	ck_assert_int_eq(0, sp_slotmap_contains(sm, h));
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(insert_overflow)
+{
+	struct sp_slotmap *sm;
+	int err = 0;
+	size_t i;
+
+	/* The buffers of one byte elements are capped by the size of a slot */
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(1, 1));
+	for (i = 0; i <= SIZE_MAX && (err = sp_slotmap_insertc(sm, 'x', NULL)) == 0; i++)
+		;
+	ck_assert_int_eq(SP_ERANGE, err);
+	ck_assert_uint_eq(SIZE_MAX / sizeof(struct sp_slotmap_slot), sm->size);
+	ck_assert_uint_eq(sm->capacity, sm->size);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_ok);
+	tcase_add_test(tc, insert_types);
+	tcase_add_test(tc, insert_bad_args);
+	tcase_add_test(tc, insert_overflow);
+}
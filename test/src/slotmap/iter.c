@@ -0,0 +1,71 @@
+static int sum_func(void *elem, size_t idx)
+{
+	static long sum;
+	if (elem == NULL)
+		return (int)(sum = 0);
+	sum += *(int*)elem;
+	*(int*)elem = (int)sum;
+	return 0;
+}
+
+static int bad_func(void *elem, size_t idx)
+{
+	return idx == 3;
+}
+
+START_TEST(iter_map)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h[20];
+	size_t i;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(int), 4));
+	for (i = 0; i < LEN(h); i++)
+		ck_assert_int_eq(0, sp_slotmap_inserti(sm, 1, &h[i]));
+	for (i = 0; i < LEN(h); i += 2)
+		ck_assert_int_eq(0, sp_slotmap_remove(sm, h[i], NULL));
+	sum_func(NULL, 0);
+	ck_assert_int_eq(0, sp_slotmap_map(sm, sum_func));
+	for (i = 0; i < sm->size; i++)
+		ck_assert_int_eq((int)i + 1, ((int*)sm->data)[i]);
+	ck_assert_int_eq(SP_ECALLBK, sp_slotmap_map(sm, bad_func));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_map(NULL, sum_func));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_map(sm, NULL));
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(iter_at)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h[100], at;
+	size_t i;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(size_t), 4));
+	for (i = 0; i < LEN(h); i++)
+		ck_assert_int_eq(0, sp_slotmap_insert(sm, &i, &h[i]));
+	for (i = 0; i < LEN(h); i += 3)
+		ck_assert_int_eq(0, sp_slotmap_remove(sm, h[i], NULL));
+
+	/* Every element of the dense array leads back to its own handle */
+	for (i = 0; i < sm->size; i++) {
+		const size_t orig = ((size_t*)sm->data)[i];
+		at = sp_slotmap_at(sm, i);
+		ck_assert_uint_eq(h[orig].idx, at.idx);
+		ck_assert_uint_eq(h[orig].gen, at.gen);
+		ck_assert_ptr_eq((size_t*)sm->data + i, sp_slotmap_get(sm, at));
+	}
+	at = sp_slotmap_at(sm, sm->size);
+	ck_assert_uint_eq(0, at.idx);
+	ck_assert_uint_eq(0, at.gen);
+	ck_assert_int_eq(0, sp_slotmap_contains(sm, at));
+	at = sp_slotmap_at(NULL, 0);
+	ck_assert_uint_eq(0, at.gen);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+void init_iter(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, iter_map);
+	tcase_add_test(tc, iter_at);
+}
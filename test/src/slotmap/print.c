@@ -0,0 +1,42 @@
+START_TEST(print_object)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h;
+	struct data d;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(struct data), 4));
+	ck_assert_int_eq(0, sp_slotmap_print(sm, data_print_bad));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_slotmap_insert(sm, &d, &h));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_slotmap_insert(sm, &d, NULL));
+	ck_assert_int_eq(0, sp_slotmap_remove(sm, h, data_dtor));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_slotmap_insert(sm, &d, NULL));
+	ck_assert_int_eq(0, sp_slotmap_print(sm, NULL));
+	ck_assert_int_eq(0, sp_slotmap_print(sm, data_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_slotmap_print(sm, data_print_bad));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_print(NULL, NULL));
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, data_dtor));
+}
+END_TEST
+
+START_TEST(print_suffixed)
+{
+	struct sp_slotmap *sm;
+	int i;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(int), 4));
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(0, sp_slotmap_inserti(sm, i * 10, NULL));
+	ck_assert_int_eq(0, sp_slotmap_printi(sm));
+	ck_assert_int_eq(SP_EILLEGAL, sp_slotmap_printd(sm));
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_printi(NULL));
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_suffixed);
+}
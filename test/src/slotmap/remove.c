@@ -0,0 +1,141 @@
+START_TEST(remove_ok)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle live[500], dead[2000];
+	long vals[LEN(live)];
+	size_t nlive = 0, ndead = 0, i, j;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(long), 8));
+	for (i = 0; i < 5000; i++) {
+		if (nlive < LEN(live) && (nlive == 0 || rand() % 3 != 0)) {
+			vals[nlive] = rand();
+			ck_assert_int_eq(0, sp_slotmap_insertl(sm, vals[nlive], &live[nlive]));
+			nlive++;
+		} else {
+			j = IRANGE(0, (int)nlive - 1);
+			if (rand() % 2)
+				ck_assert_int_eq(vals[j], sp_slotmap_removel(sm, live[j]));
+			else
+				ck_assert_int_eq(0, sp_slotmap_remove(sm, live[j], NULL));
+			if (ndead < LEN(dead))
+				dead[ndead++] = live[j];
+			live[j] = live[--nlive];
+			vals[j] = vals[nlive];
+		}
+		ck_assert_uint_eq(nlive, sm->size);
+	}
+	slotmap_check(sm);
+
+	/* Removed elements never disturb the handles of others */
+	for (j = 0; j < nlive; j++)
+		ck_assert_int_eq(vals[j], sp_slotmap_getl(sm, live[j]));
+	for (j = 0; j < ndead; j++) {
+		ck_assert_int_eq(0, sp_slotmap_contains(sm, dead[j]));
+		ck_assert_ptr_null(sp_slotmap_get(sm, dead[j]));
+		ck_assert_int_eq(SP_ENOKEY, sp_slotmap_remove(sm, dead[j], NULL));
+		ck_assert_int_eq(0, sp_slotmap_removel(sm, dead[j]));
+	}
+	ck_assert_uint_eq(nlive, sm->size);
+	slotmap_check(sm);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(remove_reuse)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle a, b, c, d;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(int), 4));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 1, &a));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 2, &b));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 3, &c));
+
+	/* The last element fills the hole and keeps its handle */
+	ck_assert_int_eq(0, sp_slotmap_remove(sm, a, NULL));
+	ck_assert_int_eq(3, ((int*)sm->data)[0]);
+	ck_assert_int_eq(3, sp_slotmap_geti(sm, c));
+	ck_assert_int_eq(2, sp_slotmap_geti(sm, b));
+	slotmap_check(sm);
+
+	/* Slots are reused in the order they were freed, with a new generation */
+	ck_assert_int_eq(0, sp_slotmap_remove(sm, c, NULL));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 4, &d));
+	ck_assert_uint_eq(a.idx, d.idx);
+	ck_assert_uint_eq(a.gen + 2, d.gen);
+	ck_assert_int_eq(0, sp_slotmap_contains(sm, a));
+	ck_assert_int_eq(0, sp_slotmap_geti(sm, a));
+	ck_assert_int_eq(4, sp_slotmap_geti(sm, d));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 5, &a));
+	ck_assert_uint_eq(c.idx, a.idx);
+	ck_assert_int_eq(0, sp_slotmap_contains(sm, c));
+	ck_assert_uint_eq(3, sm->count);
+	slotmap_check(sm);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(remove_retire)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle a, b;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(int), 4));
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 1, &a));
+	ck_assert_int_eq(0, sp_slotmap_remove(sm, a, NULL));
+
+	/* A slot whose generation wraps around is never reused */
+	sm->slots[a.idx].gen = SP_SLOTMAP_MAX - 1;
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 2, &a));
+	ck_assert_uint_eq(0, a.idx);
+	ck_assert_uint_eq(SP_SLOTMAP_MAX, a.gen);
+	ck_assert_int_eq(2, sp_slotmap_geti(sm, a));
+	ck_assert_int_eq(2, sp_slotmap_removei(sm, a));
+	ck_assert_uint_eq(0, sm->slots[0].gen);
+	ck_assert_uint_eq(0, sm->nfree);
+	slotmap_check(sm);
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 3, &b));
+	ck_assert_uint_eq(1, b.idx);
+	ck_assert_uint_eq(1, b.gen);
+	ck_assert_int_eq(0, sp_slotmap_contains(sm, a));
+	a.gen = 1;
+	ck_assert_int_eq(0, sp_slotmap_contains(sm, a));
+	ck_assert_int_eq(0, sp_slotmap_clear(sm, NULL));
+	ck_assert_uint_eq(1, sm->nfree);
+	ck_assert_int_eq(0, sp_slotmap_inserti(sm, 4, &a));
+	ck_assert_uint_eq(1, a.idx);
+	slotmap_check(sm);
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, NULL));
+}
+END_TEST
+
+START_TEST(remove_dtor)
+{
+	struct sp_slotmap *sm;
+	struct sp_slotmap_handle h[10];
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(sm = sp_slotmap_create(sizeof(struct data), 4));
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_slotmap_insert(sm, &d, &h[i]));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_slotmap_remove(sm, h[3], data_dtor_bad));
+	ck_assert_int_eq(1, sp_slotmap_contains(sm, h[3]));
+	for (i = 0; i < LEN(h); i += 2)
+		ck_assert_int_eq(0, sp_slotmap_remove(sm, h[i], data_dtor));
+	ck_assert_uint_eq(LEN(h) / 2, sm->size);
+	slotmap_check(sm);
+	ck_assert_int_eq(SP_EINVAL, sp_slotmap_remove(NULL, h[1], NULL));
+	ck_assert_int_eq(0, sp_slotmap_removei(NULL, h[1]));
+	ck_assert_int_eq(0, sp_slotmap_removei(sm, h[1]));
+	ck_assert_int_eq(1, sp_slotmap_contains(sm, h[1]));
+	ck_assert_int_eq(0, sp_slotmap_destroy(sm, data_dtor));
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_ok);
+	tcase_add_test(tc, remove_reuse);
+	tcase_add_test(tc, remove_retire);
+	tcase_add_test(tc, remove_dtor);
+}
@@ -0,0 +1,167 @@
+/* Pushes the entries of a small matrix in scrambled order, along with a
+ * duplicate of (1, 2), which the conversions must keep */
+static struct sp_sparse_coo *convert_example(void)
+{
+	/* [ 1 0 2 0 ]
+	 * [ 0 0 3 4 ]
+	 * [ 0 0 0 0 ]
+	 * [ 5 0 0 6 ] */
+	struct sp_sparse_coo *coo;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 4, 4, 2));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 3, 3, 6));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 1, 2, 1));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 0, 2, 2));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 3, 0, 5));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 0, 0, 1));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 1, 3, 4));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 1, 2, 2));
+	return coo;
+}
+
+START_TEST(convert_csr)
+{
+	struct sp_sparse_coo *coo = convert_example();
+	struct sp_sparse *s;
+	const size_t ptr[] = {0, 2, 5, 5, 7}, idx[] = {0, 2, 2, 2, 3, 0, 3};
+	const int vals[] = {1, 2, 1, 2, 4, 5, 6};
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(SP_SPARSE_CSR, s->format);
+	ck_assert_uint_eq(sizeof(int), s->elem_size);
+	ck_assert_uint_eq(4, s->rows);
+	ck_assert_uint_eq(4, s->cols);
+	ck_assert_uint_eq(7, s->nnz);
+	ck_assert_mem_eq(s->ptr, ptr, sizeof(ptr));
+	ck_assert_mem_eq(s->idx, idx, sizeof(idx));
+	ck_assert_mem_eq(s->vals, vals, sizeof(vals));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(convert_csc)
+{
+	struct sp_sparse_coo *coo = convert_example();
+	struct sp_sparse *s;
+	const size_t ptr[] = {0, 2, 2, 5, 7}, idx[] = {0, 3, 0, 1, 1, 1, 3};
+	const int vals[] = {1, 5, 2, 1, 2, 4, 6};
+	ck_assert_ptr_nonnull(s = sp_sparse_csc(coo));
+	ck_assert_int_eq(SP_SPARSE_CSC, s->format);
+	ck_assert_uint_eq(7, s->nnz);
+	ck_assert_mem_eq(s->ptr, ptr, sizeof(ptr));
+	ck_assert_mem_eq(s->idx, idx, sizeof(idx));
+	ck_assert_mem_eq(s->vals, vals, sizeof(vals));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(convert_empty)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	size_t i;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 3, 2, 1));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_uint_eq(0, s->nnz);
+	for (i = 0; i <= 3; i++)
+		ck_assert_uint_eq(0, s->ptr[i]);
+	ck_assert_int_eq(0, sp_sparse_geti(s, 2, 1));
+	ck_assert_ptr_null(sp_sparse_get(s, 2, 1));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(convert_get)
+{
+	struct sp_sparse_coo *coo = convert_example();
+	struct sp_sparse *csr, *csc;
+	const int dense[4][4] = {{1, 0, 2, 0}, {0, 0, 3, 4}, {0, 0, 0, 0}, {5, 0, 0, 6}};
+	size_t i, j;
+	ck_assert_ptr_nonnull(csr = sp_sparse_csr(coo));
+	ck_assert_ptr_nonnull(csc = sp_sparse_csc(coo));
+	for (i = 0; i < 4; i++)
+	for (j = 0; j < 4; j++) {
+		ck_assert_int_eq(dense[i][j], sp_sparse_geti(csr, i, j));
+		ck_assert_int_eq(dense[i][j], sp_sparse_geti(csc, i, j));
+		if (dense[i][j] == 0) {
+			ck_assert_ptr_null(sp_sparse_get(csr, i, j));
+			ck_assert_ptr_null(sp_sparse_get(csc, i, j));
+		}
+	}
+	/* The generic form finds the first of duplicate entries */
+	ck_assert_int_eq(1, *(int*)sp_sparse_get(csr, 1, 2));
+	ck_assert_int_eq(1, *(int*)sp_sparse_get(csc, 1, 2));
+	*(int*)sp_sparse_get(csr, 3, 0) = 7;
+	ck_assert_int_eq(7, sp_sparse_geti(csr, 3, 0));
+	ck_assert_int_eq(0, sp_sparse_destroy(csr));
+	ck_assert_int_eq(0, sp_sparse_destroy(csc));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(convert_random)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *csr, *csc;
+	struct sp_matrix *dense;
+	size_t n, i, j;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(long), 37, 23, 8));
+	ck_assert_ptr_nonnull(dense = sp_matrix_create(sizeof(long), 1, 37, 23, 0));
+	ck_assert_int_eq(0, sp_matrix_filll(dense, 0));
+	for (n = 0; n < 300; n++) {
+		const size_t row = IRANGE(0, 36), col = IRANGE(0, 22);
+		const long val = IRANGE(-1000, 1000);
+		ck_assert_int_eq(0, sp_sparse_coo_pushl(coo, row, col, val));
+		ck_assert_int_eq(0, sp_matrix_setl(dense, 0, row, col, sp_matrix_getl(dense, 0, row, col) + val));
+	}
+	ck_assert_ptr_nonnull(csr = sp_sparse_csr(coo));
+	ck_assert_ptr_nonnull(csc = sp_sparse_csc(coo));
+	for (i = 0; i < 37; i++)
+	for (j = 0; j < 23; j++) {
+		ck_assert_int_eq(sp_matrix_getl(dense, 0, i, j), sp_sparse_getl(csr, i, j));
+		ck_assert_int_eq(sp_matrix_getl(dense, 0, i, j), sp_sparse_getl(csc, i, j));
+	}
+	/* Indices are sorted within every row or column */
+	for (i = 0; i < 37; i++)
+	for (n = csr->ptr[i] + 1; n < csr->ptr[i + 1]; n++)
+		ck_assert_uint_le(csr->idx[n - 1], csr->idx[n]);
+	for (j = 0; j < 23; j++)
+	for (n = csc->ptr[j] + 1; n < csc->ptr[j + 1]; n++)
+		ck_assert_uint_le(csc->idx[n - 1], csc->idx[n]);
+	ck_assert_int_eq(0, sp_sparse_destroy(csr));
+	ck_assert_int_eq(0, sp_sparse_destroy(csc));
+	ck_assert_int_eq(0, sp_matrix_destroy(dense, NULL));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(convert_bad_args)
+{
+	struct sp_sparse_coo *coo = convert_example();
+	struct sp_sparse *s;
+	ck_assert_ptr_null(sp_sparse_csr(NULL));
+	ck_assert_ptr_null(sp_sparse_csc(NULL));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_ptr_null(sp_sparse_get(NULL, 0, 0));
+	ck_assert_ptr_null(sp_sparse_get(s, 4, 0));
+	ck_assert_ptr_null(sp_sparse_get(s, 0, 4));
+	ck_assert_int_eq(0, sp_sparse_geti(NULL, 0, 0));
+	ck_assert_int_eq(0, sp_sparse_geti(s, 4, 4));
+	ck_assert(sp_sparse_getd(s, 0, 0) == 0);
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_destroy(NULL));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+void init_convert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, convert_csr);
+	tcase_add_test(tc, convert_csc);
+	tcase_add_test(tc, convert_empty);
+	tcase_add_test(tc, convert_get);
+	tcase_add_test(tc, convert_random);
+	tcase_add_test(tc, convert_bad_args);
+}
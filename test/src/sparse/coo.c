@@ -0,0 +1,93 @@
+START_TEST(coo_create_ok)
+{
+	struct sp_sparse_coo *coo;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 3, 5, 4));
+	ck_assert_ptr_nonnull(coo->vals);
+	ck_assert_ptr_nonnull(coo->row_idx);
+	ck_assert_ptr_nonnull(coo->col_idx);
+	ck_assert_uint_eq(sizeof(int), coo->elem_size);
+	ck_assert_uint_eq(3, coo->rows);
+	ck_assert_uint_eq(5, coo->cols);
+	ck_assert_uint_eq(0, coo->size);
+	ck_assert_uint_eq(4, coo->capacity);
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(coo_create_bad_args)
+{
+	ck_assert_ptr_null(sp_sparse_coo_create(0, 1, 1, 1));
+	ck_assert_ptr_null(sp_sparse_coo_create(1, 0, 1, 1));
+	ck_assert_ptr_null(sp_sparse_coo_create(1, 1, 0, 1));
+	ck_assert_ptr_null(sp_sparse_coo_create(1, 1, 1, 0));
+	ck_assert_ptr_null(sp_sparse_coo_create(1, 1, 1, SIZE_MAX));
+	ck_assert_ptr_null(sp_sparse_coo_create(SIZE_MAX, 1, 1, 2));
+}
+END_TEST
+
+START_TEST(coo_push_ok)
+{
+	struct sp_sparse_coo *coo;
+	const double val = 2.5;
+	size_t i;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(double), 10, 20, 1));
+	ck_assert_int_eq(0, sp_sparse_coo_push(coo, 9, 19, &val));
+	for (i = 1; i < 100; i++)
+		ck_assert_int_eq(0, sp_sparse_coo_pushd(coo, i % 10, i % 20, i));
+	ck_assert_uint_eq(100, coo->size);
+	ck_assert_uint_ge(coo->capacity, 100);
+	ck_assert(((double*)coo->vals)[0] == 2.5);
+	ck_assert_uint_eq(9, coo->row_idx[0]);
+	ck_assert_uint_eq(19, coo->col_idx[0]);
+	for (i = 1; i < 100; i++) {
+		ck_assert(((double*)coo->vals)[i] == i);
+		ck_assert_uint_eq(i % 10, coo->row_idx[i]);
+		ck_assert_uint_eq(i % 20, coo->col_idx[i]);
+	}
+	ck_assert_int_eq(0, sp_sparse_coo_clear(coo));
+	ck_assert_uint_eq(0, coo->size);
+	ck_assert_uint_ge(coo->capacity, 100);
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(coo_push_too_many)
+{
+	struct sp_sparse_coo *coo;
+	size_t i;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(1, 1, 1, 1));
+	for (i = 0; i < SIZE_MAX / sizeof(size_t); i++)
+		ck_assert_int_eq(0, sp_sparse_coo_pushc(coo, 0, 0, 1));
+	ck_assert_int_eq(SP_ERANGE, sp_sparse_coo_pushc(coo, 0, 0, 1));
+	ck_assert_uint_eq(SIZE_MAX / sizeof(size_t), coo->size);
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(coo_bad_args)
+{
+	struct sp_sparse_coo *coo;
+	const int val = 1;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 2, 3, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_coo_push(NULL, 0, 0, &val));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_coo_push(coo, 0, 0, NULL));
+	ck_assert_int_eq(SP_EINDEX, sp_sparse_coo_push(coo, 2, 0, &val));
+	ck_assert_int_eq(SP_EINDEX, sp_sparse_coo_pushi(coo, 0, 3, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_coo_pushd(coo, 0, 0, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_coo_pushi(NULL, 0, 0, 1));
+	ck_assert_uint_eq(0, coo->size);
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_coo_clear(NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_coo_destroy(NULL));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+void init_coo(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, coo_create_ok);
+	tcase_add_test(tc, coo_create_bad_args);
+	tcase_add_test(tc, coo_push_ok);
+	tcase_add_test(tc, coo_push_too_many);
+	tcase_add_test(tc, coo_bad_args);
+}
@@ -0,0 +1,229 @@
+/* Fills a COO builder with random entries, duplicates included, and adds the
+ * same entries to a dense matrix. Values stay small so that products of long
+ * are exact. */
+static struct sp_sparse_coo *mul_random(struct sp_matrix *dense, size_t n)
+{
+	struct sp_sparse_coo *coo;
+	size_t i;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(long), dense->rows, dense->cols, 1));
+	ck_assert_int_eq(0, sp_matrix_filll(dense, 0));
+	for (i = 0; i < n; i++) {
+		const size_t row = IRANGE(0, (int)dense->rows - 1), col = IRANGE(0, (int)dense->cols - 1);
+		const long val = IRANGE(-100, 100);
+		ck_assert_int_eq(0, sp_sparse_coo_pushl(coo, row, col, val));
+		ck_assert_int_eq(0, sp_matrix_setl(dense, 0, row, col, sp_matrix_getl(dense, 0, row, col) + val));
+	}
+	return coo;
+}
+
+START_TEST(mulv_ok)
+{
+	struct sp_matrix *dense, *x, *y;
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *csr, *csc;
+	long yv[29];
+	size_t i;
+	ck_assert_ptr_nonnull(dense = sp_matrix_create(sizeof(long), 1, 29, 17, 0));
+	ck_assert_ptr_nonnull(x = sp_matrix_create(sizeof(long), 1, 17, 1, 0));
+	ck_assert_ptr_nonnull(y = sp_matrix_create(sizeof(long), 1, 29, 1, 0));
+	coo = mul_random(dense, 60);
+	for (i = 0; i < 17; i++)
+		((long*)x->data)[i] = IRANGE(-100, 100);
+	ck_assert_int_eq(0, sp_matrix_mull(y, dense, x));
+	ck_assert_ptr_nonnull(csr = sp_sparse_csr(coo));
+	ck_assert_ptr_nonnull(csc = sp_sparse_csc(coo));
+
+	memset(yv, 0x55, sizeof(yv));
+	ck_assert_int_eq(0, sp_sparse_mulvl(yv, csr, x->data));
+	ck_assert_mem_eq(yv, y->data, sizeof(yv));
+	memset(yv, 0x55, sizeof(yv));
+	ck_assert_int_eq(0, sp_sparse_mulvl(yv, csc, x->data));
+	ck_assert_mem_eq(yv, y->data, sizeof(yv));
+
+	ck_assert_int_eq(0, sp_sparse_destroy(csr));
+	ck_assert_int_eq(0, sp_sparse_destroy(csc));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+	ck_assert_int_eq(0, sp_matrix_destroy(dense, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(x, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(y, NULL));
+}
+END_TEST
+
+START_TEST(mulv_range)
+{
+	struct sp_matrix *dense, *x, *y;
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *csr, *csc;
+	long yv[31], fill;
+	size_t bounds[4], i, p;
+	ck_assert_ptr_nonnull(dense = sp_matrix_create(sizeof(long), 1, 31, 13, 0));
+	ck_assert_ptr_nonnull(x = sp_matrix_create(sizeof(long), 1, 13, 1, 0));
+	ck_assert_ptr_nonnull(y = sp_matrix_create(sizeof(long), 1, 31, 1, 0));
+	coo = mul_random(dense, 90);
+	for (i = 0; i < 13; i++)
+		((long*)x->data)[i] = IRANGE(-100, 100);
+	ck_assert_int_eq(0, sp_matrix_mull(y, dense, x));
+	ck_assert_ptr_nonnull(csr = sp_sparse_csr(coo));
+
+	/* The parts of a split cover every row exactly once */
+	memset(yv, 0x55, sizeof(yv));
+	ck_assert_int_eq(0, sp_sparse_split(csr, 3, bounds));
+	for (p = 0; p < 3; p++)
+		ck_assert_int_eq(0, sp_sparse_mulvrangel(yv, csr, x->data, bounds[p], bounds[p + 1]));
+	ck_assert_mem_eq(yv, y->data, sizeof(yv));
+
+	/* Rows outside of the range are left alone */
+	memset(yv, 0x55, sizeof(yv));
+	memset(&fill, 0x55, sizeof(fill));
+	ck_assert_int_eq(0, sp_sparse_mulvrangel(yv, csr, x->data, 5, 5));
+	ck_assert_int_eq(0, sp_sparse_mulvrangel(yv, csr, x->data, 5, 9));
+	for (i = 0; i < 31; i++)
+		if (i >= 5 && i < 9)
+			ck_assert_int_eq(((long*)y->data)[i], yv[i]);
+		else
+			ck_assert_int_eq(fill, yv[i]);
+
+	ck_assert_ptr_nonnull(csc = sp_sparse_csc(coo));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_mulvrangel(yv, csc, x->data, 0, 1));
+	ck_assert_int_eq(0, sp_sparse_destroy(csc));
+	ck_assert_int_eq(0, sp_sparse_destroy(csr));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+	ck_assert_int_eq(0, sp_matrix_destroy(dense, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(x, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(y, NULL));
+}
+END_TEST
+
+/* Multiplies a random sparse matrix by a random dense one in both formats,
+ * and with b given as a strided view, against sp_matrix_mul() */
+static void mul_check(size_t depth, size_t m, size_t n, size_t p)
+{
+	struct sp_matrix *dense, *a, *b, *bt, bv, *c, *expected;
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *csr, *csc;
+	size_t k, i, j;
+	ck_assert_ptr_nonnull(dense = sp_matrix_create(sizeof(long), 1, m, n, 0));
+	ck_assert_ptr_nonnull(a = sp_matrix_create(sizeof(long), depth, m, n, 0));
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(long), depth, n, p, 0));
+	ck_assert_ptr_nonnull(bt = sp_matrix_create(sizeof(long), depth, p, n, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(long), depth, m, p, 0));
+	ck_assert_ptr_nonnull(expected = sp_matrix_create(sizeof(long), depth, m, p, 0));
+	coo = mul_random(dense, m * n / 4 + 1);
+	for (k = 0; k < depth; k++)
+	for (i = 0; i < m; i++)
+	for (j = 0; j < n; j++)
+		ck_assert_int_eq(0, sp_matrix_setl(a, k, i, j, sp_matrix_getl(dense, 0, i, j)));
+	for (i = 0; i < b->size; i++)
+		((long*)b->data)[i] = IRANGE(-100, 100);
+	ck_assert_int_eq(0, sp_matrix_transpose(bt, b));
+	ck_assert_int_eq(0, sp_matrix_transposed(&bv, bt));
+	ck_assert_int_eq(0, sp_matrix_mull(expected, a, b));
+	ck_assert_ptr_nonnull(csr = sp_sparse_csr(coo));
+	ck_assert_ptr_nonnull(csc = sp_sparse_csc(coo));
+
+	ck_assert_int_eq(0, sp_matrix_filll(c, 7));
+	ck_assert_int_eq(0, sp_sparse_mull(c, csr, b));
+	ck_assert_int_eq(1, sp_matrix_eq(c, expected, NULL));
+	ck_assert_int_eq(0, sp_matrix_filll(c, 7));
+	ck_assert_int_eq(0, sp_sparse_mull(c, csc, b));
+	ck_assert_int_eq(1, sp_matrix_eq(c, expected, NULL));
+	ck_assert_int_eq(0, sp_matrix_filll(c, 7));
+	ck_assert_int_eq(0, sp_sparse_mull(c, csr, &bv));
+	ck_assert_int_eq(1, sp_matrix_eq(c, expected, NULL));
+	ck_assert_int_eq(0, sp_matrix_filll(c, 7));
+	ck_assert_int_eq(0, sp_sparse_mull(c, csc, &bv));
+	ck_assert_int_eq(1, sp_matrix_eq(c, expected, NULL));
+
+	ck_assert_int_eq(0, sp_sparse_destroy(csr));
+	ck_assert_int_eq(0, sp_sparse_destroy(csc));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+	ck_assert_int_eq(0, sp_matrix_destroy(dense, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(a, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(bt, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(expected, NULL));
+}
+
+START_TEST(mul_ok)
+{
+	mul_check(1, 1, 1, 1);
+	mul_check(1, 7, 5, 3);
+	mul_check(1, 20, 30, 1);
+	mul_check(2, 13, 17, 11);
+	mul_check(3, 9, 4, 6);
+}
+END_TEST
+
+START_TEST(mul_range)
+{
+	struct sp_matrix *dense, *b, *c, *expected;
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *csr;
+	size_t bounds[5], i, p;
+	ck_assert_ptr_nonnull(dense = sp_matrix_create(sizeof(long), 1, 19, 8, 0));
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(long), 1, 8, 5, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(long), 1, 19, 5, 0));
+	ck_assert_ptr_nonnull(expected = sp_matrix_create(sizeof(long), 1, 19, 5, 0));
+	coo = mul_random(dense, 40);
+	for (i = 0; i < b->size; i++)
+		((long*)b->data)[i] = IRANGE(-100, 100);
+	ck_assert_int_eq(0, sp_matrix_mull(expected, dense, b));
+	ck_assert_ptr_nonnull(csr = sp_sparse_csr(coo));
+	ck_assert_int_eq(0, sp_matrix_filll(c, 7));
+	ck_assert_int_eq(0, sp_sparse_split(csr, 4, bounds));
+	for (p = 4; p-- > 0;)
+		ck_assert_int_eq(0, sp_sparse_mulrangel(c, csr, b, bounds[p], bounds[p + 1]));
+	ck_assert_int_eq(1, sp_matrix_eq(c, expected, NULL));
+	ck_assert_int_eq(SP_EINDEX, sp_sparse_mulrangel(c, csr, b, 3, 2));
+	ck_assert_int_eq(SP_EINDEX, sp_sparse_mulrangel(c, csr, b, 0, 20));
+	ck_assert_int_eq(0, sp_sparse_destroy(csr));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+	ck_assert_int_eq(0, sp_matrix_destroy(dense, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(expected, NULL));
+}
+END_TEST
+
+START_TEST(mul_bad_args)
+{
+	struct sp_matrix *b, *c, *wrong;
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	long v[4];
+	ck_assert_ptr_nonnull(b = sp_matrix_create(sizeof(long), 1, 4, 2, 0));
+	ck_assert_ptr_nonnull(c = sp_matrix_create(sizeof(long), 1, 3, 2, 0));
+	ck_assert_ptr_nonnull(wrong = sp_matrix_create(sizeof(long), 1, 3, 3, 0));
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(long), 3, 4, 1));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_mulvl(NULL, s, v));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_mulvl(v, NULL, v));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_mulvl(v, s, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_mulvi((int*)v, s, (int*)v));
+	ck_assert_int_eq(SP_EINDEX, sp_sparse_mulvrangel(v, s, v, 2, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_sparse_mulvrangel(v, s, v, 0, 4));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_mull(NULL, s, b));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_mull(c, NULL, b));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_mull(c, s, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_muli(c, s, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_mull(wrong, s, b));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_mull(c, s, c));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_mulrangel(wrong, s, b, 0, 1));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+	ck_assert_int_eq(0, sp_matrix_destroy(b, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(c, NULL));
+	ck_assert_int_eq(0, sp_matrix_destroy(wrong, NULL));
+}
+END_TEST
+
+void init_mul(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, mulv_ok);
+	tcase_add_test(tc, mulv_range);
+	tcase_add_test(tc, mul_ok);
+	tcase_add_test(tc, mul_range);
+	tcase_add_test(tc, mul_bad_args);
+}
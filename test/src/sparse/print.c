@@ -0,0 +1,54 @@
+START_TEST(print_object)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	struct data d[2];
+	ck_assert_int_eq(0, data_init(&d[0]));
+	ck_assert_int_eq(0, data_init(&d[1]));
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(struct data), 2, 3, 2));
+	ck_assert_int_eq(0, sp_sparse_coo_push(coo, 1, 2, &d[0]));
+	ck_assert_int_eq(0, sp_sparse_coo_push(coo, 0, 1, &d[1]));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(0, sp_sparse_print(s, NULL));
+	ck_assert_int_eq(0, sp_sparse_print(s, data_print));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_ptr_nonnull(s = sp_sparse_csc(coo));
+	ck_assert_int_eq(0, sp_sparse_print(s, data_print));
+	ck_assert_int_eq(SP_ECALLBK, sp_sparse_print(s, data_print_bad));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+	ck_assert_int_eq(0, data_dtor(&d[0]));
+	ck_assert_int_eq(0, data_dtor(&d[1]));
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 2, 3, 2));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 1, 0, 7));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 0, 2, 8));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(0, sp_sparse_printi(s));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_printd(s));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_print(NULL, data_print));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_printi(NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+}
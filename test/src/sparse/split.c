@@ -0,0 +1,78 @@
+START_TEST(split_balanced)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	size_t bounds[5], i, p;
+	/* Row i holds i entries */
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 40, 40, 16));
+	for (i = 0; i < 40; i++)
+	for (p = 0; p < i; p++)
+		ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, i, p, 1));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(0, sp_sparse_split(s, 4, bounds));
+	ck_assert_uint_eq(0, bounds[0]);
+	ck_assert_uint_eq(40, bounds[4]);
+	for (p = 0; p < 4; p++) {
+		const size_t nnz = s->ptr[bounds[p + 1]] - s->ptr[bounds[p]];
+		ck_assert_uint_le(bounds[p], bounds[p + 1]);
+		/* Every part is within one row of its share */
+		ck_assert_uint_ge(nnz + 40, s->nnz / 4);
+		ck_assert_uint_le(nnz, s->nnz / 4 + 40);
+	}
+	ck_assert_int_eq(0, sp_sparse_split(s, 1, bounds));
+	ck_assert_uint_eq(0, bounds[0]);
+	ck_assert_uint_eq(40, bounds[1]);
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(split_more_parts_than_rows)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	size_t bounds[9], p;
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 3, 5, 4));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 0, 1, 1));
+	ck_assert_int_eq(0, sp_sparse_coo_pushi(coo, 2, 4, 1));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(0, sp_sparse_split(s, 8, bounds));
+	ck_assert_uint_eq(0, bounds[0]);
+	ck_assert_uint_eq(3, bounds[8]);
+	for (p = 0; p < 8; p++)
+		ck_assert_uint_le(bounds[p], bounds[p + 1]);
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+
+	/* Columns are split for CSC */
+	ck_assert_ptr_nonnull(s = sp_sparse_csc(coo));
+	ck_assert_int_eq(0, sp_sparse_split(s, 2, bounds));
+	ck_assert_uint_eq(0, bounds[0]);
+	ck_assert_uint_eq(2, bounds[1]);
+	ck_assert_uint_eq(5, bounds[2]);
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+START_TEST(split_bad_args)
+{
+	struct sp_sparse_coo *coo;
+	struct sp_sparse *s;
+	size_t bounds[2];
+	ck_assert_ptr_nonnull(coo = sp_sparse_coo_create(sizeof(int), 3, 5, 4));
+	ck_assert_ptr_nonnull(s = sp_sparse_csr(coo));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_split(NULL, 1, bounds));
+	ck_assert_int_eq(SP_EINVAL, sp_sparse_split(s, 1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_sparse_split(s, 0, bounds));
+	ck_assert_int_eq(0, sp_sparse_destroy(s));
+	ck_assert_int_eq(0, sp_sparse_coo_destroy(coo));
+}
+END_TEST
+
+void init_split(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, split_balanced);
+	tcase_add_test(tc, split_more_parts_than_rows);
+	tcase_add_test(tc, split_bad_args);
+}
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <time.h>
 #include "../../src/sp_stack.h"
+#include "../../src/sp_intern.h"
 #include "test_struct.h"
 #include <check.h>
 
@@ -93,6 +93,29 @@ START_TEST(push_substring)
 }
 END_TEST
 
+START_TEST(push_interned)
+{
+	struct sp_intern *pool;
+	char buf[16];
+	setup(char*, 20);
+	ck_assert_ptr_nonnull(pool = sp_intern_create(10));
+	ck_assert_int_eq(0, sp_stack_pushistr(s, pool, "first"));
+	ck_assert_int_eq(0, sp_stack_pushistr(s, pool, "second"));
+	sprintf(buf, "first");
+	ck_assert_int_eq(0, sp_stack_pushistr(s, pool, buf));
+	ck_assert_uint_eq(3, s->size);
+	ck_assert_uint_eq(2, pool->size);
+
+	/* Equal strings share a single copy owned by the pool */
+	ck_assert_ptr_eq(sp_stack_getstr(s, 0), sp_stack_getstr(s, 2));
+	ck_assert_str_eq("first", sp_stack_peekstr(s));
+	ck_assert_str_eq("second", sp_stack_getstr(s, 1));
+	ck_assert_ptr_eq(sp_intern_get(pool, 0), sp_stack_getstr(s, 2));
+	teardown(NULL);
+	ck_assert_int_eq(0, sp_intern_destroy(pool));
+}
+END_TEST
+
 START_TEST(push_bad_args)
 {
 	struct data a;
@@ -116,6 +139,8 @@ START_TEST(push_bad_args)
 	ck_assert_int_eq(SP_EINVAL, sp_stack_pushstrn(NULL, NULL, 0));
 	ck_assert_int_eq(SP_EINVAL, sp_stack_pushstrn(s, NULL, 0));
 	ck_assert_int_eq(SP_EINVAL, sp_stack_pushstrn(NULL, "abc", 0));
+	ck_assert_int_eq(SP_EINVAL, sp_stack_pushistr(NULL, NULL, "abc"));
+	ck_assert_int_eq(SP_EINVAL, sp_stack_pushistr(s, NULL, "abc"));
 	ck_assert_int_eq(0, sp_stack_destroy(s, NULL));
 }
 END_TEST
@@ -186,6 +211,7 @@ void init_push(Suite *suite, TCase *tc)
 	tcase_add_test(tc, push_object);
 	tcase_add_test(tc, push_string);
 	tcase_add_test(tc, push_substring);
+	tcase_add_test(tc, push_interned);
 	tcase_add_test(tc, push_bad_args);
 	tcase_add_test(tc, push_bad_elem_size);
 	tcase_add_test(tc, push_buffer_max_limit);
@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_ulist.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks the links of an unrolled list, and that its nodes account for all of
+ * its elements, with every node but the head and the tail at least half full */
+static void verify_nodes(const struct sp_ulist *s)
+{
+	const struct sp_ulist_node *node, *prev = NULL;
+	size_t size = 0, nnodes = 0;
+	for (node = s->head; node != NULL; prev = node, node = node->next) {
+		ck_assert_ptr_eq(prev, node->prev);
+		ck_assert_uint_gt(node->count, 0);
+		ck_assert_uint_le(node->count, s->node_cap);
+		if (node != s->head && node != s->tail)
+			ck_assert_uint_ge(node->count, s->node_cap / 2);
+		size += node->count;
+		++nnodes;
+	}
+	ck_assert_ptr_eq(prev, s->tail);
+	ck_assert_uint_eq(size, s->size);
+	ck_assert_uint_eq(nnodes, s->nnodes);
+}
+
+#include "ulist/create.c"
+#include "ulist/destroy.c"
+#include "ulist/clear.c"
+#include "ulist/eq.c"
+#include "ulist/copy.c"
+#include "ulist/map.c"
+#include "ulist/pushfront.c"
+#include "ulist/pushback.c"
+#include "ulist/insert.c"
+#include "ulist/pop.c"
+#include "ulist/remove.c"
+#include "ulist/get.c"
+#include "ulist/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create    = tcase_create("create"),
+	      *tc_destroy   = tcase_create("destroy"),
+	      *tc_clear     = tcase_create("clear"),
+	      *tc_eq        = tcase_create("eq"),
+	      *tc_copy      = tcase_create("copy"),
+	      *tc_map       = tcase_create("map"),
+	      *tc_pushfront = tcase_create("pushfront"),
+	      *tc_pushback  = tcase_create("pushback"),
+	      *tc_insert    = tcase_create("insert"),
+	      *tc_pop       = tcase_create("pop"),
+	      *tc_remove    = tcase_create("remove"),
+	      *tc_get       = tcase_create("get"),
+	      *tc_print     = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("ulist");
+	init_and_add(create);
+	init_and_add(destroy);
+	init_and_add(clear);
+	init_and_add(eq);
+	init_and_add(copy);
+	init_and_add(map);
+	init_and_add(pushfront);
+	init_and_add(pushback);
+	init_and_add(insert);
+	init_and_add(pop);
+	init_and_add(remove);
+	init_and_add(get);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
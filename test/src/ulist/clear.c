@@ -0,0 +1,68 @@
+START_TEST(clear_ok)
+{
+	struct sp_ulist *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(int), 8));
+	ck_assert_int_eq(0, sp_ulist_clear(s, NULL));
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s, i));
+	ck_assert_int_eq(7, sp_ulist_geti(s, 7));
+	ck_assert_int_eq(0, sp_ulist_clear(s, NULL));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(0, s->nnodes);
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	ck_assert_ptr_null(s->cursor);
+	ck_assert_ptr_nonnull(s->spare);
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_ulist_pushfronti(s, i));
+	ck_assert_int_eq(99, sp_ulist_geti(s, 0));
+	verify_nodes(s);
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(clear_object)
+{
+	struct sp_ulist *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(struct data), 3));
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_clear(s, data_dtor));
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(clear_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_clear(NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(clear_bad_dtor)
+{
+	struct sp_ulist *s;
+	struct data d;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(struct data), 5));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_clear(s, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	ck_assert_int_eq(0, sp_ulist_destroy(s, data_dtor));
+}
+END_TEST
+
+void init_clear(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, clear_ok);
+	tcase_add_test(tc, clear_object);
+	tcase_add_test(tc, clear_bad_args);
+	tcase_add_test(tc, clear_bad_dtor);
+}
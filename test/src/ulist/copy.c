@@ -0,0 +1,81 @@
+#define setup(T, X, Y) \
+	struct sp_ulist *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_ulist_create(sizeof(T), X)); \
+	ck_assert_ptr_nonnull(s2 = sp_ulist_create(sizeof(T), Y));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s1, D)); \
+	ck_assert_int_eq(0, sp_ulist_destroy(s2, D));
+
+START_TEST(copy_ok)
+{
+	int i;
+	setup(int, 8, 5);
+	ck_assert_int_eq(0, sp_ulist_copy(s2, s1, NULL));
+	ck_assert_uint_eq(0, s2->size);
+	for (i = 0; i < 420; i++)
+		ck_assert_int_eq(0, sp_ulist_pushfronti(s1, i));
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s2, 100));
+	ck_assert_int_eq(0, sp_ulist_copy(s2, s1, NULL));
+	ck_assert_uint_eq(420, s2->size);
+	ck_assert_int_eq(1, sp_ulist_eq(s1, s2, NULL));
+	verify_nodes(s2);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(copy_object)
+{
+	int i;
+	setup(struct data, 4, 4);
+	for (i = 0; i < 30; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s1, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_copy(s2, s1, data_cpy));
+	ck_assert_int_eq(1, sp_ulist_eq(s1, s2, data_cmp));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(copy_bad_args)
+{
+	struct sp_ulist *s3;
+	setup(int, 4, 4);
+	ck_assert_ptr_nonnull(s3 = sp_ulist_create(sizeof(double), 4));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_copy(NULL, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_copy(s2, NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_copy(NULL, s1, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ulist_copy(s3, s1, NULL));
+	ck_assert_int_eq(0, sp_ulist_destroy(s3, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(copy_bad_callback)
+{
+	int i;
+	setup(struct data, 4, 4);
+	for (i = 0; i < 6; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s1, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_copy(s2, s1, data_cpy_bad));
+	ck_assert_uint_eq(0, s2->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_copy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, copy_ok);
+	tcase_add_test(tc, copy_object);
+	tcase_add_test(tc, copy_bad_args);
+	tcase_add_test(tc, copy_bad_callback);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,49 @@
+START_TEST(create_ok)
+{
+	struct sp_ulist *s;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(int), 16));
+	ck_assert_uint_eq(sizeof(int), s->elem_size);
+	ck_assert_uint_eq(16, s->node_cap);
+	ck_assert_uint_eq(0, s->size);
+	ck_assert_uint_eq(0, s->nnodes);
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	ck_assert_ptr_null(s->cursor);
+	ck_assert_uint_ge(s->data_offset, sizeof(struct sp_ulist_node));
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+
+	/* Elements stay aligned for any type of their size */
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(double), 4));
+	ck_assert_uint_eq(0, s->data_offset % sizeof(double));
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+
+	/* Nodes hold at least 2 elements */
+	ck_assert_ptr_nonnull(s = sp_ulist_create(1, 1));
+	ck_assert_uint_eq(2, s->node_cap);
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(create_buffer_too_big)
+{
+	ck_assert_ptr_null(sp_ulist_create(SIZE_MAX, 2));
+	ck_assert_ptr_null(sp_ulist_create(1, SIZE_MAX));
+	ck_assert_ptr_null(sp_ulist_create(SIZE_MAX / 4, 4));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_ulist_create(0, 10));
+	ck_assert_ptr_null(sp_ulist_create(1, 0));
+	ck_assert_ptr_null(sp_ulist_create(0, 0));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_buffer_too_big);
+	tcase_add_test(tc, create_bad_args);
+}
@@ -0,0 +1,55 @@
+START_TEST(destroy_ok)
+{
+	struct sp_ulist *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(int), 10));
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(int), 4));
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s, i));
+	ck_assert_int_eq(0, sp_ulist_destroy(s, NULL));
+}
+END_TEST
+
+START_TEST(destroy_object)
+{
+	struct sp_ulist *s;
+	int i;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(struct data), 4));
+	for (i = 0; i < 20; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_destroy(s, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_destroy(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_destroy(NULL, data_dtor));
+}
+END_TEST
+
+START_TEST(destroy_bad_dtor)
+{
+	struct sp_ulist *s;
+	struct data d;
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(struct data), 4));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_destroy(s, data_dtor_bad));
+	ck_assert_int_eq(0, sp_ulist_destroy(s, data_dtor));
+}
+END_TEST
+
+void init_destroy(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, destroy_ok);
+	tcase_add_test(tc, destroy_object);
+	tcase_add_test(tc, destroy_bad_args);
+	tcase_add_test(tc, destroy_bad_dtor);
+}
@@ -0,0 +1,65 @@
+#define setup(T, X, Y) \
+	struct sp_ulist *s1, *s2; \
+	ck_assert_ptr_nonnull(s1 = sp_ulist_create(sizeof(T), X)); \
+	ck_assert_ptr_nonnull(s2 = sp_ulist_create(sizeof(T), Y));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s1, D)); \
+	ck_assert_int_eq(0, sp_ulist_destroy(s2, D));
+
+START_TEST(eq_ok)
+{
+	int i;
+	setup(int, 3, 7);
+	ck_assert_int_eq(1, sp_ulist_eq(s1, s2, NULL));
+
+	/* Node boundaries do not matter */
+	for (i = 0; i < 50; i++) {
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s1, i));
+		ck_assert_int_eq(0, sp_ulist_pushfronti(s2, 49 - i));
+	}
+	ck_assert_int_eq(1, sp_ulist_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s2, 50));
+	ck_assert_int_eq(0, sp_ulist_eq(s1, s2, NULL));
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s1, 51));
+	ck_assert_int_eq(0, sp_ulist_eq(s1, s2, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(eq_object)
+{
+	int i;
+	setup(struct data, 4, 4);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s1, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_copy(s2, s1, data_cpy));
+	ck_assert_int_eq(1, sp_ulist_eq(s1, s2, data_cmp));
+	ck_assert_int_eq(0, sp_ulist_eq(s1, s2, NULL));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(eq_bad_args)
+{
+	setup(int, 4, 4);
+	ck_assert_int_eq(0, sp_ulist_eq(NULL, NULL, NULL));
+	ck_assert_int_eq(0, sp_ulist_eq(s1, NULL, NULL));
+	ck_assert_int_eq(0, sp_ulist_eq(NULL, s2, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+void init_eq(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, eq_ok);
+	tcase_add_test(tc, eq_object);
+	tcase_add_test(tc, eq_bad_args);
+}
+
+#undef setup
+#undef teardown
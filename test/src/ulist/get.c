@@ -0,0 +1,54 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(get_ok)
+{
+	int i;
+	setup(int, 8);
+	for (i = 0; i < 500; i++)
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s, i));
+
+	/* Forwards, backwards and scattered lookups */
+	for (i = 0; i < 500; i++)
+		ck_assert_int_eq(i, *(int*)sp_ulist_get(s, i));
+	for (i = 499; i >= 0; i--)
+		ck_assert_int_eq(i, sp_ulist_geti(s, i));
+	for (i = 0; i < 500; i++) {
+		const int idx = rand() % 500;
+		ck_assert_int_eq(idx, sp_ulist_geti(s, idx));
+	}
+
+	/* The element can be modified in place */
+	*(int*)sp_ulist_get(s, 250) = -1;
+	ck_assert_int_eq(-1, sp_ulist_geti(s, 250));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(get_bad_args)
+{
+	setup(int, 8);
+	ck_assert_ptr_null(sp_ulist_get(NULL, 0));
+	ck_assert_ptr_null(sp_ulist_get(s, 0));
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s, 5));
+	ck_assert_ptr_null(sp_ulist_get(s, 1));
+	ck_assert_int_eq(0, sp_ulist_geti(NULL, 0));
+	ck_assert_int_eq(0, sp_ulist_geti(s, 1));
+	ck_assert(sp_ulist_getd(s, 0) == 0);
+	teardown(NULL);
+}
+END_TEST
+
+void init_get(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, get_ok);
+	tcase_add_test(tc, get_bad_args);
+}
+
+#undef setup
+#undef teardown
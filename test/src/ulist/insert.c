@@ -0,0 +1,105 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(insert_ok)
+{
+	int i;
+	setup(int, 4);
+	ck_assert_int_eq(0, sp_ulist_inserti(s, 0, 2));
+	ck_assert_int_eq(0, sp_ulist_inserti(s, 0, 0));
+	ck_assert_int_eq(0, sp_ulist_inserti(s, 1, 1));
+	ck_assert_int_eq(0, sp_ulist_inserti(s, 3, 4));
+	ck_assert_int_eq(0, sp_ulist_inserti(s, 3, 3));
+	ck_assert_uint_eq(5, s->size);
+	for (i = 0; i < 5; i++)
+		ck_assert_int_eq(i, sp_ulist_geti(s, i));
+	verify_nodes(s);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(insert_middle)
+{
+	int i;
+	setup(int, 16);
+
+	/* Always insert in the middle, splitting nodes over and over */
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s, 0));
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s, 1999));
+	for (i = 1; i < 1000; i++) {
+		ck_assert_int_eq(0, sp_ulist_inserti(s, i, i));
+		ck_assert_int_eq(0, sp_ulist_inserti(s, i + 1, 1999 - i));
+	}
+	ck_assert_uint_eq(2000, s->size);
+	for (i = 0; i < 2000; i++)
+		ck_assert_int_eq(i, sp_ulist_geti(s, i));
+	verify_nodes(s);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(insert_random)
+{
+	int model[600];
+	size_t n = 0;
+	int i;
+	setup(int, 5);
+	for (i = 0; i < (int)LEN(model); i++) {
+		const size_t idx = rand() % (n + 1);
+		memmove(model + idx + 1, model + idx, (n - idx) * sizeof(*model));
+		model[idx] = i;
+		++n;
+		ck_assert_int_eq(0, sp_ulist_insert(s, idx, &i));
+	}
+	verify_nodes(s);
+	for (i = 0; i < (int)LEN(model); i++)
+		ck_assert_int_eq(model[i], sp_ulist_geti(s, i));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(insert_object)
+{
+	struct data a, b;
+	setup(struct data, 2);
+	ck_assert_int_eq(0, data_init(&a));
+	ck_assert_int_eq(0, data_init(&b));
+	ck_assert_int_eq(0, sp_ulist_insert(s, 0, &a));
+	ck_assert_int_eq(0, sp_ulist_insert(s, 0, &b));
+	ck_assert_int_eq(0, data_cmp(&b, sp_ulist_get(s, 0)));
+	ck_assert_int_eq(0, data_cmp(&a, sp_ulist_get(s, 1)));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(insert_bad_args)
+{
+	int x = 0;
+	setup(int, 4);
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_insert(NULL, 0, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_insert(s, 0, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_inserti(NULL, 0, 1));
+	ck_assert_int_eq(SP_EINDEX, sp_ulist_insert(s, 1, &x));
+	ck_assert_int_eq(SP_EINDEX, sp_ulist_inserti(s, 1, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ulist_insertd(s, 0, 1.0));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+void init_insert(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, insert_ok);
+	tcase_add_test(tc, insert_middle);
+	tcase_add_test(tc, insert_random);
+	tcase_add_test(tc, insert_object);
+	tcase_add_test(tc, insert_bad_args);
+}
+
+#undef setup
+#undef teardown
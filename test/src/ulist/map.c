@@ -0,0 +1,57 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(map_ok)
+{
+	int i;
+	setup(struct data, 2);
+	ck_assert_int_eq(0, sp_ulist_map(s, data_mutate));
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_map(s, data_mutate));
+	ck_assert_int_eq(0, sp_ulist_map(s, data_verify));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(map_bad_args)
+{
+	setup(int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_map(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_map(NULL, data_mutate));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_map(NULL, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(map_bad_callback)
+{
+	int i;
+	setup(struct data, 10);
+	for (i = 0; i < 3; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_map(s, data_mutate_bad));
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_map(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, map_ok);
+	tcase_add_test(tc, map_bad_args);
+	tcase_add_test(tc, map_bad_callback);
+}
+
+#undef setup
+#undef teardown
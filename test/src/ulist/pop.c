@@ -0,0 +1,89 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(pop_basic)
+{
+	int i;
+	setup(int, 4);
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s, i));
+	for (i = 0; i < 25; i++) {
+		ck_assert_int_eq(0, sp_ulist_popfront(s, NULL));
+		ck_assert_int_eq(0, sp_ulist_popback(s, NULL));
+		verify_nodes(s);
+	}
+	ck_assert_uint_eq(50, s->size);
+	ck_assert_int_eq(25, sp_ulist_geti(s, 0));
+	ck_assert_int_eq(74, sp_ulist_geti(s, 49));
+	while (s->size > 0)
+		ck_assert_int_eq(0, sp_ulist_popback(s, NULL));
+	ck_assert_ptr_null(s->head);
+	ck_assert_ptr_null(s->tail);
+	ck_assert_uint_eq(0, s->nnodes);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pop_object)
+{
+	int i;
+	setup(struct data, 4);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	for (i = 0; i < 5; i++) {
+		ck_assert_int_eq(0, sp_ulist_popfront(s, data_dtor));
+		ck_assert_int_eq(0, sp_ulist_popback(s, data_dtor));
+	}
+	ck_assert_uint_eq(0, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(pop_empty)
+{
+	setup(int, 10);
+	ck_assert_int_eq(SP_EILLEGAL, sp_ulist_popfront(s, NULL));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ulist_popback(s, NULL));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pop_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_popfront(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_popback(NULL, NULL));
+}
+END_TEST
+
+START_TEST(pop_bad_dtor)
+{
+	struct data d;
+	setup(struct data, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_popfront(s, data_dtor_bad));
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_popback(s, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_pop(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pop_basic);
+	tcase_add_test(tc, pop_object);
+	tcase_add_test(tc, pop_empty);
+	tcase_add_test(tc, pop_bad_args);
+	tcase_add_test(tc, pop_bad_dtor);
+}
+
+#undef setup
+#undef teardown
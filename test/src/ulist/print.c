@@ -0,0 +1,67 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(print_object)
+{
+	int i;
+	setup(struct data, 10);
+	ck_assert_int_eq(0, sp_ulist_print(s, NULL));
+	ck_assert_int_eq(0, sp_ulist_print(s, data_print));
+	for (i = 0; i < 3; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_print(s, NULL));
+	ck_assert_int_eq(0, sp_ulist_print(s, data_print));
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(print_ok)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_ulist_printi(s));
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s, 1));
+	ck_assert_int_eq(0, sp_ulist_pushfronti(s, 2));
+	ck_assert_int_eq(0, sp_ulist_printi(s));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ulist_printd(s));
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(print_bad_args)
+{
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_print(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_print(NULL, data_print));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_printi(NULL));
+}
+END_TEST
+
+START_TEST(print_bad_callback)
+{
+	struct data d;
+	setup(struct data, 10);
+	ck_assert_int_eq(0, sp_ulist_print(s, data_print_bad));
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_print(s, data_print_bad));
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_object);
+	tcase_add_test(tc, print_ok);
+	tcase_add_test(tc, print_bad_args);
+	tcase_add_test(tc, print_bad_callback);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,62 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(pushback_ok)
+{
+	int i;
+	setup(int, 8);
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s, i));
+	ck_assert_uint_eq(1000, s->size);
+	for (i = 0; i < 1000; i++)
+		ck_assert_int_eq(i, sp_ulist_geti(s, i));
+	verify_nodes(s);
+
+	/* Pushing on the back fills nodes completely */
+	ck_assert_uint_eq(125, s->nnodes);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(pushback_object)
+{
+	int i;
+	setup(struct data, 3);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+		ck_assert_int_eq(0, data_cmp(&d, sp_ulist_get(s, s->size - 1)));
+	}
+	ck_assert_uint_eq(10, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(pushback_bad_args)
+{
+	int x = 0;
+	setup(int, 10);
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_pushback(NULL, &x));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_pushback(s, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_pushbacki(NULL, 1));
+	ck_assert_int_eq(SP_EILLEGAL, sp_ulist_pushbackd(s, 1.0));
+	ck_assert_uint_eq(0, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+void init_pushback(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, pushback_ok);
+	tcase_add_test(tc, pushback_object);
+	tcase_add_test(tc, pushback_bad_args);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,117 @@
+#define setup(T, X) \
+	struct sp_ulist *s; \
+	ck_assert_ptr_nonnull(s = sp_ulist_create(sizeof(T), X));
+
+#define teardown(D) \
+	ck_assert_int_eq(0, sp_ulist_destroy(s, D));
+
+START_TEST(remove_ok)
+{
+	int i;
+	setup(int, 6);
+	for (i = 0; i < 100; i++)
+		ck_assert_int_eq(0, sp_ulist_pushbacki(s, i));
+
+	/* Drop every odd element */
+	for (i = 1; i <= 50; i++)
+		ck_assert_int_eq(0, sp_ulist_remove(s, i, NULL));
+	ck_assert_uint_eq(50, s->size);
+	for (i = 0; i < 50; i++)
+		ck_assert_int_eq(2 * i, sp_ulist_geti(s, i));
+	verify_nodes(s);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(remove_random)
+{
+	int model[800];
+	size_t n = 0;
+	int i;
+	setup(int, 7);
+
+	/* Mixed insertions and removals at random positions */
+	for (i = 0; i < 4000; i++) {
+		if (n > 0 && (n == LEN(model) || rand() % 5 < 2)) {
+			const size_t idx = rand() % n;
+			ck_assert_int_eq(model[idx], sp_ulist_geti(s, idx));
+			ck_assert_int_eq(0, sp_ulist_remove(s, idx, NULL));
+			memmove(model + idx, model + idx + 1, (n - idx - 1) * sizeof(*model));
+			--n;
+		} else {
+			const size_t idx = rand() % (n + 1);
+			ck_assert_int_eq(0, sp_ulist_inserti(s, idx, i));
+			memmove(model + idx + 1, model + idx, (n - idx) * sizeof(*model));
+			model[idx] = i;
+			++n;
+		}
+		if (i % 100 == 0)
+			verify_nodes(s);
+	}
+	verify_nodes(s);
+	ck_assert_uint_eq(n, s->size);
+	for (i = 0; i < (int)n; i++)
+		ck_assert_int_eq(model[i], sp_ulist_geti(s, i));
+	while (n > 0) {
+		const size_t idx = rand() % n;
+		ck_assert_int_eq(0, sp_ulist_remove(s, idx, NULL));
+		memmove(model + idx, model + idx + 1, (n - idx - 1) * sizeof(*model));
+		--n;
+		if (n > 0)
+			ck_assert_int_eq(model[n / 2], sp_ulist_geti(s, n / 2));
+	}
+	ck_assert_ptr_null(s->head);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(remove_object)
+{
+	int i;
+	setup(struct data, 4);
+	for (i = 0; i < 10; i++) {
+		struct data d;
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	}
+	ck_assert_int_eq(0, sp_ulist_remove(s, 5, data_dtor));
+	ck_assert_uint_eq(9, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+START_TEST(remove_bad_args)
+{
+	setup(int, 10);
+	ck_assert_int_eq(0, sp_ulist_pushbacki(s, 1));
+	ck_assert_int_eq(SP_EINVAL, sp_ulist_remove(NULL, 0, NULL));
+	ck_assert_int_eq(SP_EINDEX, sp_ulist_remove(s, 1, NULL));
+	ck_assert_uint_eq(1, s->size);
+	teardown(NULL);
+}
+END_TEST
+
+START_TEST(remove_bad_dtor)
+{
+	struct data d;
+	setup(struct data, 10);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_ulist_pushback(s, &d));
+	ck_assert_int_eq(SP_ECALLBK, sp_ulist_remove(s, 0, data_dtor_bad));
+	ck_assert_uint_eq(1, s->size);
+	teardown(data_dtor);
+}
+END_TEST
+
+void init_remove(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, remove_ok);
+	tcase_add_test(tc, remove_random);
+	tcase_add_test(tc, remove_object);
+	tcase_add_test(tc, remove_bad_args);
+	tcase_add_test(tc, remove_bad_dtor);
+}
+
+#undef setup
+#undef teardown
@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "../../src/sp_wheel.h"
+#include "test_struct.h"
+#include <check.h>
+
+/* Make testing for size overflow feasible */
+#ifdef SIZE_MAX
+#undef SIZE_MAX
+#endif
+#define SIZE_MAX 65535LU
+
+/* Shortcut to reduce boilerplate */
+#define init_and_add(N) \
+	init_##N(suite, tc_##N); \
+	suite_add_tcase(suite, tc_##N);
+
+/* Checks that every slot links its timers both ways, that every timer is
+ * pending, still due and in the slot its expiry selects on its level, and that
+ * the free list of the pool and its uncarved blocks hold the rest of the nodes */
+static void wheel_check(const struct sp_wheel *wheel)
+{
+	size_t i, n = 0;
+	const struct sp_wheel_node *node;
+	const void *block;
+	ck_assert_ptr_eq(&wheel->expired, wheel->expired.next);
+	ck_assert_ptr_eq(&wheel->expired, wheel->expired.prev);
+	for (i = 0; i < LEN(wheel->slots); i++) {
+		const struct sp_wheel_link *const slot = &wheel->slots[i], *link;
+		const int level = (int)(i / SP_WHEEL_SLOTS);
+		for (link = slot->next; link != slot; link = link->next) {
+			node = (const struct sp_wheel_node*)link;
+			ck_assert_ptr_eq(link, link->next->prev);
+			ck_assert_uint_eq(1, node->gen & 1);
+			ck_assert_uint_ge(node->expiry - wheel->now, 1);
+			ck_assert_uint_le(node->expiry - wheel->now, SP_WHEEL_MAX);
+			ck_assert_uint_eq(i % SP_WHEEL_SLOTS, (node->expiry >> (level * SP_WHEEL_BITS)) % SP_WHEEL_SLOTS);
+			ck_assert_uint_le(++n, wheel->size);
+		}
+		ck_assert_ptr_eq(link, slot->prev->next);
+	}
+	ck_assert_uint_eq(wheel->size, n);
+	/* Nodes retired when their generation wrapped stay in use by the pool */
+	ck_assert_uint_ge(wheel->pool.size, n);
+	n = wheel->pool.size;
+	for (block = wheel->pool.free; block != NULL; block = *(const void* const*)block) {
+		node = block;
+		ck_assert_uint_eq(0, node->gen & 1);
+		ck_assert_uint_le(++n, wheel->pool.capacity);
+	}
+	n += wheel->pool.left;
+	for (i = wheel->pool.used; i < wheel->pool.nslabs; i++)
+		n += wheel->pool.slabs[i].size;
+	ck_assert_uint_eq(wheel->pool.capacity, n);
+}
+
+/* Elements of the timers which fired, in order, and the tick of each */
+static long fired[1024];
+static unsigned long fired_at[LEN(fired)];
+static size_t nfired;
+static const struct sp_wheel *firing;
+
+static int fire_log(void *elem)
+{
+	if (nfired < LEN(fired)) {
+		fired[nfired] = *(long*)elem;
+		fired_at[nfired++] = firing->now;
+	}
+	return 0;
+}
+
+static int fire_bad(void *elem)
+{
+	return 1;
+}
+
+#include "wheel/create.c"
+#include "wheel/schedule.c"
+#include "wheel/cancel.c"
+#include "wheel/advance.c"
+#include "wheel/print.c"
+
+int main(void)
+{
+	SRunner *runner;
+	Suite *suite;
+	int nf, seed;
+	TCase *tc_create   = tcase_create("create"),
+	      *tc_schedule = tcase_create("schedule"),
+	      *tc_cancel   = tcase_create("cancel"),
+	      *tc_advance  = tcase_create("advance"),
+	      *tc_print    = tcase_create("print");
+
+	if (!sp_is_debug() || sp_is_abort()) {
+		printf("staple was not compiled correctly for testing -- debug mode should be enabled and abort mode disabled\n");
+		return EXIT_FAILURE;
+	}
+
+	seed = time(NULL);
+	srand(seed);
+	printf("seed: %d\n", seed);
+
+	suite = suite_create("wheel");
+	init_and_add(create);
+	init_and_add(schedule);
+	init_and_add(cancel);
+	init_and_add(advance);
+	init_and_add(print);
+
+	runner = srunner_create(suite);
+	srunner_run_all(runner, CK_ENV);
+	nf = srunner_ntests_failed(runner);
+	srunner_free(runner);
+
+	return nf == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
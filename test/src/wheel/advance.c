@@ -0,0 +1,212 @@
+START_TEST(advance_order)
+{
+	struct sp_wheel *wheel;
+	const unsigned long delays[] = {1, 2, 100, 255, 256, 257, 300, 511, 512, 65535, 65536, 65537, 70000, 16777216, 16777217};
+	size_t i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	firing = wheel;
+	nfired = 0;
+	for (i = LEN(delays); i-- != 0;)
+		ck_assert_int_eq(0, sp_wheel_schedulel(wheel, delays[i], (long)i, NULL));
+	wheel_check(wheel);
+
+	/* Timers fire on the tick they are due on, whatever level they start on
+	 * and however the ticks are split between calls */
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 0, fire_log));
+	ck_assert_uint_eq(0, wheel->now);
+	for (i = 0; wheel->size != 0; i++) {
+		ck_assert_int_eq(0, sp_wheel_advance(wheel, (unsigned long)IRANGE(1, 5000), fire_log));
+		wheel_check(wheel);
+	}
+	ck_assert_uint_eq(LEN(delays), nfired);
+	for (i = 0; i < LEN(delays); i++) {
+		ck_assert_int_eq((long)i, fired[i]);
+		ck_assert_uint_eq(delays[i], fired_at[i]);
+	}
+
+	/* With no timers left, time jumps ahead */
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, (unsigned long)-1 / 2, fire_log));
+	ck_assert_uint_eq(LEN(delays), nfired);
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 3, 7, NULL));
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 3, fire_log));
+	ck_assert_uint_eq(LEN(delays) + 1, nfired);
+	ck_assert_uint_eq(wheel->now, fired_at[LEN(delays)]);
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_advance(NULL, 1, NULL));
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(advance_wrap)
+{
+	struct sp_wheel *wheel;
+	const unsigned long delays[] = {5, 10, 11, 12, 300, 70000};
+	unsigned long start;
+	size_t i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	firing = wheel;
+	nfired = 0;
+
+	/* The tick counter wraps around in the middle of these */
+	start = (unsigned long)-1 - 10;
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, start, NULL));
+	ck_assert_uint_eq(start, wheel->now);
+	for (i = 0; i < LEN(delays); i++)
+		ck_assert_int_eq(0, sp_wheel_schedulel(wheel, delays[i], (long)i, NULL));
+	wheel_check(wheel);
+	while (wheel->size != 0)
+		ck_assert_int_eq(0, sp_wheel_advance(wheel, 7, fire_log));
+	ck_assert_uint_eq(LEN(delays), nfired);
+	for (i = 0; i < LEN(delays); i++) {
+		ck_assert_int_eq((long)i, fired[i]);
+		ck_assert_uint_eq(start + delays[i], fired_at[i]);
+	}
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+/* Handles used by fire_meddle, which cancels, reschedules and schedules
+ * timers of the wheel being advanced */
+static struct sp_wheel *meddled;
+static struct sp_wheel_handle meddle_h[4];
+
+static int fire_meddle(void *elem)
+{
+	const long id = *(long*)elem;
+	fire_log(elem);
+	if (id == 0) {
+		ck_assert_int_eq(SP_ENOKEY, sp_wheel_cancel(meddled, meddle_h[0], NULL));
+		ck_assert_ptr_null(sp_wheel_get(meddled, meddle_h[0]));
+		ck_assert_uint_eq(0, sp_wheel_remaining(meddled, meddle_h[1]));
+		ck_assert_int_eq(0, sp_wheel_cancel(meddled, meddle_h[1], NULL));
+		ck_assert_int_eq(0, sp_wheel_reschedule(meddled, meddle_h[2], 10));
+		ck_assert_int_eq(0, sp_wheel_schedulel(meddled, 0, 100, NULL));
+		*(long*)elem = -1;
+	}
+	return 0;
+}
+
+START_TEST(advance_batch)
+{
+	struct sp_wheel *wheel;
+	long i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 2));
+	firing = meddled = wheel;
+	nfired = 0;
+	for (i = 0; i < 4; i++)
+		ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 400, i, &meddle_h[i]));
+
+	/* The first timer of the batch cancels the second and delays the third,
+	 * and the new timer it schedules fires on the next tick */
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 400, fire_meddle));
+	ck_assert_uint_eq(2, nfired);
+	ck_assert_int_eq(0, fired[0]);
+	ck_assert_int_eq(3, fired[1]);
+	ck_assert_uint_eq(2, wheel->size);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 10, fire_meddle));
+	ck_assert_uint_eq(4, nfired);
+	ck_assert_int_eq(100, fired[2]);
+	ck_assert_uint_eq(401, fired_at[2]);
+	ck_assert_int_eq(2, fired[3]);
+	ck_assert_uint_eq(410, fired_at[3]);
+	ck_assert_uint_eq(0, wheel->size);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(advance_bad)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h[3];
+	long i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	firing = wheel;
+	nfired = 0;
+	for (i = 0; i < 3; i++)
+		ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 20, i, &h[i]));
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 30, 3, NULL));
+
+	/* The wheel stops on the failing tick, and the rest of the batch is due
+	 * on the next one */
+	ck_assert_int_eq(SP_ECALLBK, sp_wheel_advance(wheel, 100, fire_bad));
+	ck_assert_uint_eq(20, wheel->now);
+	ck_assert_uint_eq(3, wheel->size);
+	ck_assert_ptr_null(sp_wheel_get(wheel, h[0]));
+	ck_assert_uint_eq(1, sp_wheel_remaining(wheel, h[1]));
+	ck_assert_uint_eq(1, sp_wheel_remaining(wheel, h[2]));
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 80, fire_log));
+	ck_assert_uint_eq(3, nfired);
+	ck_assert_int_eq(1, fired[0]);
+	ck_assert_int_eq(2, fired[1]);
+	ck_assert_int_eq(3, fired[2]);
+	ck_assert_uint_eq(21, fired_at[0]);
+	ck_assert_uint_eq(30, fired_at[2]);
+	ck_assert_uint_eq(100, wheel->now);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(advance_random)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h[200];
+	unsigned long due[LEN(h)];
+	int pending[LEN(h)];
+	size_t i, j, n = 0, round;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 16));
+	firing = wheel;
+	memset(pending, 0, sizeof(pending));
+	memset(h, 0, sizeof(h));
+	for (round = 0; round < 2000; round++) {
+		const int op = IRANGE(0, 9);
+		i = (size_t)IRANGE(0, (int)LEN(h) - 1);
+		if (op < 4 && !pending[i]) {
+			unsigned long delay = (unsigned long)(op < 2 ? IRANGE(0, 600) : IRANGE(0, 80000));
+			ck_assert_int_eq(0, sp_wheel_schedulel(wheel, delay, (long)i, &h[i]));
+			due[i] = wheel->now + (delay == 0 ? 1 : delay);
+			pending[i] = 1;
+			++n;
+		} else if (op < 6 && pending[i]) {
+			unsigned long delay = (unsigned long)IRANGE(1, 70000);
+			ck_assert_int_eq(0, sp_wheel_reschedule(wheel, h[i], delay));
+			due[i] = wheel->now + delay;
+		} else if (op < 7 && pending[i]) {
+			ck_assert_int_eq(0, sp_wheel_cancel(wheel, h[i], NULL));
+			pending[i] = 0;
+			--n;
+		} else {
+			const unsigned long ticks = (unsigned long)(op < 9 ? IRANGE(1, 300) : IRANGE(1, 20000));
+			nfired = 0;
+			ck_assert_int_eq(0, sp_wheel_advance(wheel, ticks, fire_log));
+			for (j = 0; j < nfired; j++) {
+				ck_assert_int_eq(1, pending[fired[j]]);
+				ck_assert_uint_eq(due[fired[j]], fired_at[j]);
+				pending[fired[j]] = 0;
+				--n;
+			}
+			for (j = 0; j < LEN(h); j++) {
+				if (pending[j])
+					ck_assert_uint_eq(due[j] - wheel->now, sp_wheel_remaining(wheel, h[j]));
+				else
+					ck_assert_ptr_null(sp_wheel_get(wheel, h[j]));
+			}
+		}
+		ck_assert_uint_eq(n, wheel->size);
+	}
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+void init_advance(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, advance_order);
+	tcase_add_test(tc, advance_wrap);
+	tcase_add_test(tc, advance_batch);
+	tcase_add_test(tc, advance_bad);
+	tcase_add_test(tc, advance_random);
+}
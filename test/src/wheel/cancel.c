@@ -0,0 +1,92 @@
+START_TEST(cancel_ok)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h[10];
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(struct data), 4));
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_wheel_schedule(wheel, (unsigned long)(i % 3) * 300 + 1, &d, &h[i]));
+	}
+
+	/* A failing destructor leaves the timer pending */
+	ck_assert_int_eq(SP_ECALLBK, sp_wheel_cancel(wheel, h[4], data_dtor_bad));
+	ck_assert_ptr_nonnull(sp_wheel_get(wheel, h[4]));
+	for (i = 0; i < LEN(h); i += 2) {
+		ck_assert_int_eq(0, sp_wheel_cancel(wheel, h[i], data_dtor));
+		ck_assert_ptr_null(sp_wheel_get(wheel, h[i]));
+		ck_assert_int_eq(SP_ENOKEY, sp_wheel_cancel(wheel, h[i], data_dtor));
+		wheel_check(wheel);
+	}
+	ck_assert_uint_eq(LEN(h) / 2, wheel->size);
+
+	/* Cancelled timers never fire, and the rest all do */
+	firing = wheel;
+	nfired = 0;
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 1000, data_dtor));
+	ck_assert_uint_eq(0, wheel->size);
+	wheel_check(wheel);
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_ptr_null(sp_wheel_get(wheel, h[i]));
+		ck_assert_int_eq(SP_ENOKEY, sp_wheel_cancel(wheel, h[i], NULL));
+	}
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_cancel(NULL, h[0], NULL));
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(cancel_reuse)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h, old;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 1));
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 50, 1, &h));
+	old = h;
+	ck_assert_int_eq(0, sp_wheel_cancel(wheel, h, NULL));
+
+	/* The node is reused, but the old handle does not match it */
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 50, 2, &h));
+	ck_assert_ptr_eq(old.node, h.node);
+	ck_assert_uint_ne(old.gen, h.gen);
+	ck_assert_ptr_null(sp_wheel_get(wheel, old));
+	ck_assert_int_eq(SP_ENOKEY, sp_wheel_cancel(wheel, old, NULL));
+	ck_assert_int_eq(2, *(long*)sp_wheel_get(wheel, h));
+	ck_assert_uint_eq(1, wheel->size);
+	ck_assert_uint_eq(1, wheel->pool.capacity);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(cancel_retire)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h, old;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 1));
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 50, 1, &h));
+
+	/* A node whose generation wraps around is never reused, as the handles
+	 * of its first timer would match it again */
+	h.node->gen = (unsigned long)-1;
+	h.gen       = h.node->gen;
+	old = h;
+	ck_assert_int_eq(0, sp_wheel_cancel(wheel, h, NULL));
+	ck_assert_ptr_null(wheel->pool.free);
+	ck_assert_uint_eq(0, wheel->size);
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 50, 2, &h));
+	ck_assert_ptr_ne(old.node, h.node);
+	ck_assert_uint_eq(1, h.gen);
+	ck_assert_uint_eq(2, wheel->pool.nslabs);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+void init_cancel(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, cancel_ok);
+	tcase_add_test(tc, cancel_reuse);
+	tcase_add_test(tc, cancel_retire);
+}
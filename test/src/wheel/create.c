@@ -0,0 +1,82 @@
+START_TEST(create_ok)
+{
+	struct sp_wheel *wheel;
+	size_t i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(struct data), 10));
+	for (i = 0; i < LEN(wheel->slots); i++) {
+		ck_assert_ptr_eq(&wheel->slots[i], wheel->slots[i].next);
+		ck_assert_ptr_eq(&wheel->slots[i], wheel->slots[i].prev);
+	}
+	ck_assert_uint_eq(0, wheel->now);
+	ck_assert_uint_eq(sizeof(struct data), wheel->elem_size);
+	ck_assert_uint_eq(0, wheel->size);
+	ck_assert_uint_eq(10, wheel->pool.capacity);
+	ck_assert_uint_ge(wheel->data_offset, sizeof(struct sp_wheel_node));
+	ck_assert_uint_ge(wheel->pool.stride, wheel->data_offset + wheel->elem_size);
+	ck_assert_ptr_null(wheel->pool.free);
+	ck_assert_uint_eq(1, wheel->pool.nslabs);
+	ck_assert_uint_eq(10, wheel->pool.slabs[0].size);
+	ck_assert_uint_eq(0, wheel->pool.used);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(create_bad_args)
+{
+	ck_assert_ptr_null(sp_wheel_create(0, 10));
+	ck_assert_ptr_null(sp_wheel_create(1, 0));
+	ck_assert_ptr_null(sp_wheel_create(SIZE_MAX, 1));
+	ck_assert_ptr_null(sp_wheel_create(1, SIZE_MAX));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_clear(NULL, NULL));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_destroy(NULL, NULL));
+}
+END_TEST
+
+START_TEST(create_clear_destroy)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h[30];
+	struct data d;
+	size_t i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(struct data), 8));
+	for (i = 0; i < LEN(h); i++) {
+		ck_assert_int_eq(0, data_init(&d));
+		ck_assert_int_eq(0, sp_wheel_schedule(wheel, (unsigned long)i * 1000 + 1, &d, &h[i]));
+	}
+	ck_assert_uint_eq(30, wheel->size);
+	ck_assert_uint_ge(wheel->pool.capacity, 30);
+	ck_assert_uint_gt(wheel->pool.nslabs, 1);
+	wheel_check(wheel);
+
+	/* A failing destructor leaves every timer pending */
+	ck_assert_int_eq(SP_ECALLBK, sp_wheel_clear(wheel, data_dtor_bad));
+	ck_assert_uint_eq(30, wheel->size);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_clear(wheel, data_dtor));
+	ck_assert_uint_eq(0, wheel->size);
+	wheel_check(wheel);
+	for (i = 0; i < LEN(h); i++)
+		ck_assert_ptr_null(sp_wheel_get(wheel, h[i]));
+
+	/* Cleared nodes are reused, without allocating more */
+	i = wheel->pool.nslabs;
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 5, NULL));
+	ck_assert_uint_eq(5, wheel->now);
+	ck_assert_int_eq(0, data_init(&d));
+	ck_assert_int_eq(0, sp_wheel_schedule(wheel, 3, &d, &h[0]));
+	ck_assert_uint_eq(i, wheel->pool.nslabs);
+	ck_assert_uint_eq(3, sp_wheel_remaining(wheel, h[0]));
+	wheel_check(wheel);
+	ck_assert_int_eq(SP_ECALLBK, sp_wheel_destroy(wheel, data_dtor_bad));
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, data_dtor));
+}
+END_TEST
+
+void init_create(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, create_ok);
+	tcase_add_test(tc, create_bad_args);
+	tcase_add_test(tc, create_clear_destroy);
+}
@@ -0,0 +1,27 @@
+static int print_long(const void *elem)
+{
+	printf("%ld\n", *(const long*)elem);
+	return 0;
+}
+
+START_TEST(print_ok)
+{
+	struct sp_wheel *wheel;
+	long i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	for (i = 0; i < 6; i++)
+		ck_assert_int_eq(0, sp_wheel_schedulel(wheel, (unsigned long)i * i * i * 100, i, NULL));
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 50, NULL));
+	ck_assert_int_eq(0, sp_wheel_print(wheel, NULL));
+	ck_assert_int_eq(0, sp_wheel_print(wheel, print_long));
+	ck_assert_int_eq(SP_ECALLBK, sp_wheel_print(wheel, data_print_bad));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_print(NULL, NULL));
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+void init_print(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, print_ok);
+}
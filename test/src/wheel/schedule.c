@@ -0,0 +1,131 @@
+START_TEST(schedule_ok)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h[8];
+	const unsigned long delays[LEN(h)] = {0, 1, 255, 257, 65535, 65537, 16777217, SP_WHEEL_MAX};
+	long i;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	for (i = 0; i < (long)LEN(h); i++) {
+		if (i % 2)
+			ck_assert_int_eq(0, sp_wheel_schedulel(wheel, delays[i], i, &h[i]));
+		else
+			ck_assert_int_eq(0, sp_wheel_schedule(wheel, delays[i], &i, &h[i]));
+		ck_assert_ptr_eq(&h[i].node->link, h[i].node->link.next->prev);
+		ck_assert_uint_eq(1, h[i].gen & 1);
+	}
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 7, 100, NULL));
+	ck_assert_uint_eq(LEN(h) + 1, wheel->size);
+	wheel_check(wheel);
+
+	/* A delay of 0 means the next tick, and every level gets used */
+	ck_assert_uint_eq(1, sp_wheel_remaining(wheel, h[0]));
+	for (i = 1; i < (long)LEN(h); i++)
+		ck_assert_uint_eq(delays[i], sp_wheel_remaining(wheel, h[i]));
+	for (i = 0; i < (long)LEN(h); i++) {
+		ck_assert_ptr_nonnull(sp_wheel_get(wheel, h[i]));
+		ck_assert_int_eq(i, *(long*)sp_wheel_get(wheel, h[i]));
+	}
+	ck_assert_ptr_eq(&wheel->slots[1], h[0].node->link.prev);
+	ck_assert_ptr_eq(&wheel->slots[SP_WHEEL_SLOTS + 1], h[3].node->link.prev);
+	ck_assert_ptr_eq(&wheel->slots[2 * SP_WHEEL_SLOTS + 1], h[5].node->link.prev);
+	ck_assert_ptr_eq(&wheel->slots[3 * SP_WHEEL_SLOTS + 1], h[6].node->link.prev);
+
+	/* Elements can be modified in place */
+	*(long*)sp_wheel_get(wheel, h[2]) = 42;
+	ck_assert_int_eq(42, *(long*)sp_wheel_get(wheel, h[2]));
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(schedule_bad_args)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h;
+	long l = 1;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_schedule(NULL, 1, &l, &h));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_schedule(wheel, 1, NULL, &h));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_schedulel(NULL, 1, l, &h));
+	ck_assert_int_eq(SP_EILLEGAL, sp_wheel_schedulec(wheel, 1, 'a', &h));
+	ck_assert_int_eq(SP_EILLEGAL, sp_wheel_schedulef(wheel, 1, 1.0f, &h));
+	if (SP_WHEEL_MAX < (unsigned long)-1) {
+		ck_assert_int_eq(SP_ERANGE, sp_wheel_schedule(wheel, SP_WHEEL_MAX + 1, &l, &h));
+		ck_assert_int_eq(SP_ERANGE, sp_wheel_schedulel(wheel, (unsigned long)-1, l, &h));
+	}
+	ck_assert_uint_eq(0, wheel->size);
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(schedule_reschedule)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h, stale;
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	nfired = 0;
+	firing = wheel;
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 10, 1, &h));
+	ck_assert_int_eq(0, sp_wheel_reschedule(wheel, h, 1000));
+	ck_assert_uint_eq(1000, sp_wheel_remaining(wheel, h));
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 999, fire_log));
+	ck_assert_uint_eq(0, nfired);
+
+	/* Pushing a timeout back, as activity is seen, over and over */
+	ck_assert_int_eq(0, sp_wheel_reschedule(wheel, h, 300));
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 299, fire_log));
+	ck_assert_int_eq(0, sp_wheel_reschedule(wheel, h, 70000));
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 69999, fire_log));
+	ck_assert_uint_eq(0, nfired);
+	ck_assert_uint_eq(1, sp_wheel_remaining(wheel, h));
+	ck_assert_int_eq(0, sp_wheel_reschedule(wheel, h, 0));
+	ck_assert_uint_eq(1, sp_wheel_remaining(wheel, h));
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_advance(wheel, 1, fire_log));
+	ck_assert_uint_eq(1, nfired);
+	ck_assert_int_eq(1, fired[0]);
+	ck_assert_uint_eq(999 + 299 + 69999 + 1, fired_at[0]);
+
+	/* Fired timers can only be scheduled anew */
+	stale = h;
+	ck_assert_int_eq(SP_ENOKEY, sp_wheel_reschedule(wheel, stale, 5));
+	ck_assert_int_eq(0, sp_wheel_schedulel(wheel, 5, 2, &h));
+	ck_assert_ptr_eq(stale.node, h.node);
+	ck_assert_int_eq(SP_ENOKEY, sp_wheel_reschedule(wheel, stale, 5));
+	ck_assert_ptr_null(sp_wheel_get(wheel, stale));
+	ck_assert_uint_eq(0, sp_wheel_remaining(wheel, stale));
+	ck_assert_uint_eq(5, sp_wheel_remaining(wheel, h));
+	if (SP_WHEEL_MAX < (unsigned long)-1)
+		ck_assert_int_eq(SP_ERANGE, sp_wheel_reschedule(wheel, h, SP_WHEEL_MAX + 1));
+	ck_assert_uint_eq(5, sp_wheel_remaining(wheel, h));
+	ck_assert_int_eq(SP_EINVAL, sp_wheel_reschedule(NULL, h, 5));
+	ck_assert_ptr_null(sp_wheel_get(NULL, h));
+	ck_assert_uint_eq(0, sp_wheel_remaining(NULL, h));
+	wheel_check(wheel);
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+START_TEST(schedule_null_handle)
+{
+	struct sp_wheel *wheel;
+	struct sp_wheel_handle h;
+	memset(&h, 0, sizeof(h));
+	ck_assert_ptr_nonnull(wheel = sp_wheel_create(sizeof(long), 4));
+	ck_assert_ptr_null(sp_wheel_get(wheel, h));
+	ck_assert_uint_eq(0, sp_wheel_remaining(wheel, h));
+	ck_assert_int_eq(SP_ENOKEY, sp_wheel_reschedule(wheel, h, 1));
+	ck_assert_int_eq(SP_ENOKEY, sp_wheel_cancel(wheel, h, NULL));
+	ck_assert_int_eq(0, sp_wheel_destroy(wheel, NULL));
+}
+END_TEST
+
+void init_schedule(Suite *suite, TCase *tc)
+{
+	suite_add_tcase(suite, tc);
+	tcase_add_test(tc, schedule_ok);
+	tcase_add_test(tc, schedule_bad_args);
+	tcase_add_test(tc, schedule_reschedule);
+	tcase_add_test(tc, schedule_null_handle);
+}